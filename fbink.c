@@ -178,10 +178,10 @@ static inline __attribute__((const, always_inline, hot)) uint16_t
 #	ifdef FBINK_WITH_DRAW
 // Pack an FBInkPixel accordingly for the target pixel format
 static __attribute__((pure)) FBInkPixel
-    pack_pixel_from_rgba(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+    pack_pixel_from_rgba(FBInkContext* restrict ctx, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
 {
 	FBInkPixel px;
-	switch (deviceQuirks.pixelFormat) {
+	switch (ctx->deviceQuirks.pixelFormat) {
 		case FBINK_PXFMT_Y4:
 		case FBINK_PXFMT_Y8:
 			// NOTE: We inline stbi__compute_y to avoid needing to depend on FBINK_WITH_IMAGE
@@ -216,10 +216,10 @@ static __attribute__((pure)) FBInkPixel
 }
 
 static __attribute__((pure)) FBInkPixel
-    pack_pixel_from_y8(uint8_t v)
+    pack_pixel_from_y8(FBInkContext* restrict ctx, uint8_t v)
 {
 	FBInkPixel px;
-	switch (deviceQuirks.pixelFormat) {
+	switch (ctx->deviceQuirks.pixelFormat) {
 		case FBINK_PXFMT_Y4:
 		case FBINK_PXFMT_Y8:
 			px.gray8 = v;
@@ -248,49 +248,49 @@ static __attribute__((pure)) FBInkPixel
 
 // Helper functions to 'plot' a specific pixel in a given color to the framebuffer
 static inline __attribute__((always_inline, hot)) void
-    put_pixel_Gray4(const FBInkCoordinates* restrict coords, const FBInkPixel* restrict px)
+    put_pixel_Gray4(FBInkContext* restrict ctx, const FBInkCoordinates* restrict coords, const FBInkPixel* restrict px)
 {
 	// calculate the pixel's byte offset inside the buffer
 	// note: x / 2 as every byte holds 2 pixels
-	const size_t pix_offset = (coords->x >> 1U) + (coords->y * fInfo.line_length);
+	const size_t pix_offset = (coords->x >> 1U) + (coords->y * ctx->fInfo.line_length);
 
 	// NOTE: Squash 8bpp to 4bpp:
 	// (v >> 4)
 	// or: v * 16 / 256
 
 	// First, we'll need the current full byte to make sure we never clobber a nibble...
-	const uint8_t b = *((unsigned char*) (fbPtr + pix_offset));
+	const uint8_t b = *((unsigned char*) (ctx->fbPtr + pix_offset));
 
 	// We can't address nibbles directly, so this takes some shenanigans...
 	if ((coords->x & 0x01u) == 0U) {
 		// Even pixel: high nibble
 		// ORed to avoid clobbering our odd pixel
-		*((unsigned char*) (fbPtr + pix_offset)) = (unsigned char) ((b & 0x0Fu) | (px->gray8 & 0xF0u));
+		*((unsigned char*) (ctx->fbPtr + pix_offset)) = (unsigned char) ((b & 0x0Fu) | (px->gray8 & 0xF0u));
 		// Squash to 4bpp, and write to the top/left nibble
 		// or: ((v >> 4) << 4)
 	} else {
 		// Odd pixel: low nibble
 		// ORed to avoid clobbering our even pixel
-		*((unsigned char*) (fbPtr + pix_offset)) = (unsigned char) ((b & 0xF0u) | (px->gray8 >> 4U));
+		*((unsigned char*) (ctx->fbPtr + pix_offset)) = (unsigned char) ((b & 0xF0u) | (px->gray8 >> 4U));
 	}
 }
 
 static inline __attribute__((always_inline, hot)) void
-    put_pixel_Gray8(const FBInkCoordinates* restrict coords, const FBInkPixel* restrict px)
+    put_pixel_Gray8(FBInkContext* restrict ctx, const FBInkCoordinates* restrict coords, const FBInkPixel* restrict px)
 {
 	// calculate the pixel's byte offset inside the buffer
-	const size_t pix_offset = coords->x + (coords->y * fInfo.line_length);
+	const size_t pix_offset = coords->x + (coords->y * ctx->fInfo.line_length);
 
 	// now this is about the same as 'fbp[pix_offset] = value'
-	*((unsigned char*) (fbPtr + pix_offset)) = px->gray8;
+	*((unsigned char*) (ctx->fbPtr + pix_offset)) = px->gray8;
 }
 
 static inline __attribute__((always_inline)) void
-    put_pixel_BGR24(const FBInkCoordinates* restrict coords, const FBInkPixel* restrict px)
+    put_pixel_BGR24(FBInkContext* restrict ctx, const FBInkCoordinates* restrict coords, const FBInkPixel* restrict px)
 {
 	// calculate the pixel's byte offset inside the buffer
 	// note: x * 3 as every pixel is 3 consecutive bytes
-	const size_t pix_offset = (coords->x * 3U) + (coords->y * fInfo.line_length);
+	const size_t pix_offset = (coords->x * 3U) + (coords->y * ctx->fInfo.line_length);
 
 	// now this is about the same as 'fbp[pix_offset] = value'
 	// NOTE: Technically legitimate warning. In practice, we always pass RGB32 pixels in 24bpp codepaths.
@@ -298,18 +298,18 @@ static inline __attribute__((always_inline)) void
 #	pragma GCC diagnostic ignored "-Wunknown-pragmas"
 #	pragma clang diagnostic ignored "-Wunknown-warning-option"
 #	pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
-	*((unsigned char*) (fbPtr + pix_offset))      = px->bgra.color.b;
-	*((unsigned char*) (fbPtr + pix_offset + 1U)) = px->bgra.color.g;
-	*((unsigned char*) (fbPtr + pix_offset + 2U)) = px->bgra.color.r;
+	*((unsigned char*) (ctx->fbPtr + pix_offset))      = px->bgra.color.b;
+	*((unsigned char*) (ctx->fbPtr + pix_offset + 1U)) = px->bgra.color.g;
+	*((unsigned char*) (ctx->fbPtr + pix_offset + 2U)) = px->bgra.color.r;
 #	pragma GCC diagnostic pop
 }
 
 static inline __attribute__((always_inline)) void
-    put_pixel_RGB24(const FBInkCoordinates* restrict coords, const FBInkPixel* restrict px)
+    put_pixel_RGB24(FBInkContext* restrict ctx, const FBInkCoordinates* restrict coords, const FBInkPixel* restrict px)
 {
 	// calculate the pixel's byte offset inside the buffer
 	// note: x * 3 as every pixel is 3 consecutive bytes
-	const size_t pix_offset = (coords->x * 3U) + (coords->y * fInfo.line_length);
+	const size_t pix_offset = (coords->x * 3U) + (coords->y * ctx->fInfo.line_length);
 
 	// now this is about the same as 'fbp[pix_offset] = value'
 	// NOTE: Technically legitimate warning. In practice, we always pass RGB32 pixels in 24bpp codepaths.
@@ -317,17 +317,17 @@ static inline __attribute__((always_inline)) void
 #	pragma GCC diagnostic ignored "-Wunknown-pragmas"
 #	pragma clang diagnostic ignored "-Wunknown-warning-option"
 #	pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
-	*((unsigned char*) (fbPtr + pix_offset))      = px->rgba.color.r;
-	*((unsigned char*) (fbPtr + pix_offset + 1U)) = px->rgba.color.g;
-	*((unsigned char*) (fbPtr + pix_offset + 2U)) = px->rgba.color.b;
+	*((unsigned char*) (ctx->fbPtr + pix_offset))      = px->rgba.color.r;
+	*((unsigned char*) (ctx->fbPtr + pix_offset + 1U)) = px->rgba.color.g;
+	*((unsigned char*) (ctx->fbPtr + pix_offset + 2U)) = px->rgba.color.b;
 #	pragma GCC diagnostic pop
 }
 
 static inline __attribute__((always_inline, hot)) void
-    put_pixel_RGB32(const FBInkCoordinates* restrict coords, const FBInkPixel* restrict px)
+    put_pixel_RGB32(FBInkContext* restrict ctx, const FBInkCoordinates* restrict coords, const FBInkPixel* restrict px)
 {
 	// calculate the scanline's byte offset inside the buffer
-	const size_t scanline_offset = (size_t) coords->y * fInfo.line_length;
+	const size_t scanline_offset = (size_t) coords->y * ctx->fInfo.line_length;
 
 	// write the four bytes at once
 	// NOTE: We rely on pointer arithmetic rules to handle the pixel offset inside the scanline,
@@ -335,21 +335,21 @@ static inline __attribute__((always_inline, hot)) void
 	//       which is exactly what we want ;).
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
-	*((uint32_t*) (fbPtr + scanline_offset) + coords->x) = px->p;
+	*((uint32_t*) (ctx->fbPtr + scanline_offset) + coords->x) = px->p;
 #	pragma GCC diagnostic pop
 }
 
 static inline __attribute__((always_inline, hot)) void
-    put_pixel_RGB565(const FBInkCoordinates* restrict coords, const FBInkPixel* restrict px)
+    put_pixel_RGB565(FBInkContext* restrict ctx, const FBInkCoordinates* restrict coords, const FBInkPixel* restrict px)
 {
 	// calculate the scanline's byte offset inside the buffer
-	const size_t scanline_offset = (size_t) coords->y * fInfo.line_length;
+	const size_t scanline_offset = (size_t) coords->y * ctx->fInfo.line_length;
 
 	// write the two bytes at once, much to GCC's dismay...
 	// NOTE: Input pixel *has* to be properly packed to BGR565/RGB565 first (via pack_bgr565/pack_rgb565, c.f., put_pixel)!
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
-	*((uint16_t*) (fbPtr + scanline_offset) + coords->x) = px->rgb565;
+	*((uint16_t*) (ctx->fbPtr + scanline_offset) + coords->x) = px->rgb565;
 #	pragma GCC diagnostic pop
 }
 #endif    // FBINK_WITH_DRAW
@@ -357,11 +357,11 @@ static inline __attribute__((always_inline, hot)) void
 #if defined(FBINK_FOR_KOBO) || defined(FBINK_FOR_CERVANTES) || defined(FBINK_FOR_POCKETBOOK)
 // Handle rotation quirks...
 static void
-    rotate_coordinates_pickel(FBInkCoordinates* restrict coords)
+    rotate_coordinates_pickel(FBInkContext* restrict ctx, FBInkCoordinates* restrict coords)
 {
 	// Rotate the coordinates to account for pickel's rotation...
 	const unsigned short int rx = coords->y;
-	const unsigned short int ry = (unsigned short int) (screenWidth - coords->x - 1);
+	const unsigned short int ry = (unsigned short int) (ctx->screenWidth - coords->x - 1);
 
 // NOTE: This codepath is not production ready, it was just an experiment to wrap my head around framebuffer rotation...
 //       In particular, only CW has been actually confirmed to behave properly (to handle the isNTX16bLandscape quirk),
@@ -379,7 +379,7 @@ static void
 	switch (rotation) {
 		case FB_ROTATE_CW:
 			xp = (unsigned short int) lround(-fxp);
-			yp = (unsigned short int) lround(vInfo.yres - 1 - fyp);
+			yp = (unsigned short int) lround(ctx->vInfo.yres - 1 - fyp);
 			break;
 		case FB_ROTATE_UD:
 			// NOTE: IIRC, this pretty much ends up with (x', y') being equal to (y, x).
@@ -387,7 +387,7 @@ static void
 			yp = (unsigned short int) lround(-fxp);
 			break;
 		case FB_ROTATE_CCW:
-			xp = (unsigned short int) lround(vInfo.xres - 1 - fxp);
+			xp = (unsigned short int) lround(ctx->vInfo.xres - 1 - fxp);
 			yp = (unsigned short int) lround(-fyp);
 			break;
 		default:
@@ -415,12 +415,12 @@ static void
 
 #if defined(FBINK_FOR_KOBO) || defined(FBINK_FOR_CERVANTES)
 static void
-    rotate_coordinates_boot(FBInkCoordinates* restrict coords)
+    rotate_coordinates_boot(FBInkContext* restrict ctx, FBInkCoordinates* restrict coords)
 {
 	// Rotate the coordinates to account for the native boot rotation...
 	// NOTE: See the note is fbink_init, this is based on a replicated boot modeset,
 	//       which apparently doesn't exactly match the *real* boot modeset... -_-".
-	const unsigned short int rx = (unsigned short int) (screenHeight - coords->y - 1);
+	const unsigned short int rx = (unsigned short int) (ctx->screenHeight - coords->y - 1);
 	const unsigned short int ry = coords->x;
 
 	coords->x = rx;
@@ -432,15 +432,15 @@ static void
 //       This is basically left as-is for archeological purposes only,
 //       the only caller is in button_scan, which was kind of a crazy experiment to begin with ;).
 static void
-    rotate_touch_coordinates(FBInkCoordinates* restrict coords)
+    rotate_touch_coordinates(FBInkContext* restrict ctx, FBInkCoordinates* restrict coords)
 {
 	unsigned short int rx = coords->x;
 	unsigned short int ry = coords->y;
 
-	uint32_t rotation = vInfo.rotate;
+	uint32_t rotation = ctx->vInfo.rotate;
 	// NOTE: Try to take into account the various rotation quirks, depending on the device...
 	//       c.f., mxc_epdc_fb_check_var @ drivers/video/mxc/mxc_epdc_fb.c OR drivers/video/fbdev/mxc/mxc_epdc_v2_fb.c
-	if (deviceQuirks.ntxRotaQuirk == NTX_ROTA_ODD_INVERTED) {
+	if (ctx->deviceQuirks.ntxRotaQuirk == NTX_ROTA_ODD_INVERTED) {
 		// On the Forma, only Portrait orientations are inverted...
 		// When I say Portrait/Landscape, that's how the device *looks*, which doesn't match the FB_ROTATE_* constants...
 		// i.e., in Nickel, *visually*, UR is 3, CW is 2, UD is 1, CCW is 0,
@@ -452,10 +452,10 @@ static void
 		// NOTE: Plato goes with a simple rotation = (4 - rotation) % 4; which does the exact same thing,
 		//       I just have a harder time wrapping my head around it ;).
 		//       Plus, I'm inclined to believe a simple branch would be faster than a modulo.
-	} else if (deviceQuirks.ntxRotaQuirk == NTX_ROTA_ALL_INVERTED) {
+	} else if (ctx->deviceQuirks.ntxRotaQuirk == NTX_ROTA_ALL_INVERTED) {
 		// On *some* devices with a 6.8" panel, *every* orientation is inverted...
 		rotation ^= 2U;
-	} else if (deviceQuirks.ntxRotaQuirk == NTX_ROTA_SANE) {
+	} else if (ctx->deviceQuirks.ntxRotaQuirk == NTX_ROTA_SANE) {
 		// NOTE: This is for the Libra, but I don't have access to that device to double-check...
 		//       And I probably never will, see the deprecation comment above this function ;).
 		// The reasoning being to try to match the Forma's behavior:
@@ -480,14 +480,14 @@ static void
 			break;
 		case FB_ROTATE_CW:
 			rx = coords->y;
-			ry = (unsigned short int) (screenWidth - coords->x - 1);
+			ry = (unsigned short int) (ctx->screenWidth - coords->x - 1);
 			break;
 		case FB_ROTATE_UD:
-			rx = (unsigned short int) (screenWidth - coords->x - 1);
-			ry = (unsigned short int) (screenHeight - coords->y - 1);
+			rx = (unsigned short int) (ctx->screenWidth - coords->x - 1);
+			ry = (unsigned short int) (ctx->screenHeight - coords->y - 1);
 			break;
 		case FB_ROTATE_CCW:
-			rx = (unsigned short int) (screenHeight - coords->y - 1);
+			rx = (unsigned short int) (ctx->screenHeight - coords->y - 1);
 			ry = coords->x;
 			break;
 	}
@@ -525,7 +525,8 @@ static void
 #endif            // FBINK_FOR_KOBO || FBINK_FOR_CERVANTES
 
 static void
-    rotate_coordinates_nop(FBInkCoordinates* restrict coords __attribute__((unused)))
+    rotate_coordinates_nop(FBInkContext* restrict ctx        __attribute__((unused)),
+			   FBInkCoordinates* restrict coords __attribute__((unused)))
 {
 	// NOP!
 	// May be smarter than one might think on armv7-a,
@@ -548,41 +549,41 @@ static void
 //       and in this case (ha!) appears to behave *noticeably* better than switching...
 //       Which is why we now branch via an if ladder, as it should offer marginally better performance on newer devices.
 static inline __attribute__((always_inline, hot)) void
-    put_pixel(FBInkCoordinates coords, const FBInkPixel* restrict px, bool is_rgb565)
+    put_pixel(FBInkContext* restrict ctx, FBInkCoordinates coords, const FBInkPixel* restrict px, bool is_rgb565)
 {
 	// Handle rotation now, so we can properly validate if the pixel is off-screen or not ;).
 	// fbink_init() takes care of setting this global pointer to the right function...
 	// NOTE: In this case, going through the function pointer is *noticeably* faster than branching...
-	(*fxpRotateCoords)(&coords);
+	(*ctx->fxpRotateCoords)(ctx, &coords);
 
 	// NOTE: Discard off-screen pixels!
 	//       For instance, when we have a halfcell offset in conjunction with a !isPerfectFit pixel offset,
 	//       when we're padding and centering, the final whitespace of right-padding will have its last
 	//       few pixels (the exact amount being half of the dead zone width) pushed off-screen...
 	//       And, of course, anything using hoffset or voffset can happily push stuff OOB ;).
-	if (unlikely(coords.x >= vInfo.xres || coords.y >= vInfo.yres)) {
+	if (unlikely(coords.x >= ctx->vInfo.xres || coords.y >= ctx->vInfo.yres)) {
 #	ifdef DEBUG
 		// NOTE: This is only enabled in Debug builds because it can be pretty verbose,
 		//       and does not necessarily indicate an actual issue, as we've just explained...
 		LOG("Put: discarding off-screen pixel @ (%hu, %hu) (out of %ux%u bounds)",
 		    coords.x,
 		    coords.y,
-		    vInfo.xres,
-		    vInfo.yres);
+		    ctx->vInfo.xres,
+		    ctx->vInfo.yres);
 #	endif
 		return;
 	}
 
 	// NOTE: Hmm, here, an if ladder appears to be ever so *slightly* faster than going through the function pointer...
-	if (deviceQuirks.pixelFormat == FBINK_PXFMT_Y4) {
-		put_pixel_Gray4(&coords, px);
-	} else if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_Y8)) {
-		put_pixel_Gray8(&coords, px);
-	} else if (vInfo.bits_per_pixel == 16U) {
+	if (ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y4) {
+		put_pixel_Gray4(ctx, &coords, px);
+	} else if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y8)) {
+		put_pixel_Gray8(ctx, &coords, px);
+	} else if (ctx->vInfo.bits_per_pixel == 16U) {
 		// Do we need to pack the pixel, first?
 		if (is_rgb565) {
 			// Nope :)
-			put_pixel_RGB565(&coords, px);
+			put_pixel_RGB565(ctx, &coords, px);
 		} else {
 			// Yep :(
 			FBInkPixel packed_px;
@@ -591,20 +592,20 @@ static inline __attribute__((always_inline, hot)) void
 #	pragma GCC diagnostic ignored "-Wunknown-pragmas"
 #	pragma clang diagnostic ignored "-Wunknown-warning-option"
 #	pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
-			if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR565)) {
+			if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR565)) {
 				packed_px.rgb565 = pack_bgr565(px->bgra.color.r, px->bgra.color.g, px->bgra.color.b);
 			} else {
 				packed_px.rgb565 = pack_rgb565(px->rgba.color.r, px->rgba.color.g, px->rgba.color.b);
 			}
 #	pragma GCC diagnostic pop
-			put_pixel_RGB565(&coords, &packed_px);
+			put_pixel_RGB565(ctx, &coords, &packed_px);
 		}
-	} else if (unlikely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR24)) {
-		put_pixel_BGR24(&coords, px);
-	} else if (unlikely(deviceQuirks.pixelFormat == FBINK_PXFMT_RGB24)) {
-		put_pixel_RGB24(&coords, px);
-	} else if (likely(vInfo.bits_per_pixel == 32U)) {
-		put_pixel_RGB32(&coords, px);
+	} else if (unlikely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR24)) {
+		put_pixel_BGR24(ctx, &coords, px);
+	} else if (unlikely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_RGB24)) {
+		put_pixel_RGB24(ctx, &coords, px);
+	} else if (likely(ctx->vInfo.bits_per_pixel == 32U)) {
+		put_pixel_RGB32(ctx, &coords, px);
 	}
 }
 
@@ -614,11 +615,11 @@ static inline __attribute__((always_inline, hot)) void
 // as well as KOReader's routines
 //       (https://github.com/koreader/koreader-base/blob/b3e72affd0e1ba819d92194b229468452c58836f/ffi/blitbuffer.lua#L292)
 static inline __attribute__((always_inline, hot)) void
-    get_pixel_Gray4(const FBInkCoordinates* restrict coords, FBInkPixel* restrict px)
+    get_pixel_Gray4(FBInkContext* restrict ctx, const FBInkCoordinates* restrict coords, FBInkPixel* restrict px)
 {
 	// calculate the pixel's byte offset inside the buffer
 	// note: x / 2 as every byte holds 2 pixels
-	const size_t pix_offset = (coords->x >> 1U) + (coords->y * fInfo.line_length);
+	const size_t pix_offset = (coords->x >> 1U) + (coords->y * ctx->fInfo.line_length);
 
 	// NOTE: Expand 4bpp to 8bpp:
 	// (v * 0x11)
@@ -629,7 +630,7 @@ static inline __attribute__((always_inline, hot)) void
 	// ((b) & 0x0F)
 
 	// We'll need the full byte first...
-	const uint8_t b = *((const unsigned char*) (fbPtr + pix_offset));
+	const uint8_t b = *((const unsigned char*) (ctx->fbPtr + pix_offset));
 
 	if ((coords->x & 0x01u) == 0U) {
 		// Even pixel: high nibble
@@ -648,63 +649,63 @@ static inline __attribute__((always_inline, hot)) void
 }
 
 static inline __attribute__((always_inline, hot)) void
-    get_pixel_Gray8(const FBInkCoordinates* restrict coords, FBInkPixel* restrict px)
+    get_pixel_Gray8(FBInkContext* restrict ctx, const FBInkCoordinates* restrict coords, FBInkPixel* restrict px)
 {
 	// calculate the pixel's byte offset inside the buffer
-	const size_t pix_offset = coords->x + (coords->y * fInfo.line_length);
+	const size_t pix_offset = coords->x + (coords->y * ctx->fInfo.line_length);
 
-	px->gray8 = *((unsigned char*) (fbPtr + pix_offset));
+	px->gray8 = *((unsigned char*) (ctx->fbPtr + pix_offset));
 }
 
 static inline __attribute__((always_inline)) void
-    get_pixel_BGR24(const FBInkCoordinates* restrict coords, FBInkPixel* restrict px)
+    get_pixel_BGR24(FBInkContext* restrict ctx, const FBInkCoordinates* restrict coords, FBInkPixel* restrict px)
 {
 	// calculate the pixel's byte offset inside the buffer
 	// note: x * 3 as every pixel is 3 consecutive bytes
-	const size_t pix_offset = (coords->x * 3U) + (coords->y * fInfo.line_length);
+	const size_t pix_offset = (coords->x * 3U) + (coords->y * ctx->fInfo.line_length);
 
-	px->bgra.color.b = *((unsigned char*) (fbPtr + pix_offset));
-	px->bgra.color.g = *((unsigned char*) (fbPtr + pix_offset + 1U));
-	px->bgra.color.r = *((unsigned char*) (fbPtr + pix_offset + 2U));
+	px->bgra.color.b = *((unsigned char*) (ctx->fbPtr + pix_offset));
+	px->bgra.color.g = *((unsigned char*) (ctx->fbPtr + pix_offset + 1U));
+	px->bgra.color.r = *((unsigned char*) (ctx->fbPtr + pix_offset + 2U));
 }
 
 static inline __attribute__((always_inline)) void
-    get_pixel_RGB24(const FBInkCoordinates* restrict coords, FBInkPixel* restrict px)
+    get_pixel_RGB24(FBInkContext* restrict ctx, const FBInkCoordinates* restrict coords, FBInkPixel* restrict px)
 {
 	// calculate the pixel's byte offset inside the buffer
 	// note: x * 3 as every pixel is 3 consecutive bytes
-	const size_t pix_offset = (coords->x * 3U) + (coords->y * fInfo.line_length);
+	const size_t pix_offset = (coords->x * 3U) + (coords->y * ctx->fInfo.line_length);
 
-	px->rgba.color.r = *((unsigned char*) (fbPtr + pix_offset));
-	px->rgba.color.g = *((unsigned char*) (fbPtr + pix_offset + 1U));
-	px->rgba.color.b = *((unsigned char*) (fbPtr + pix_offset + 2U));
+	px->rgba.color.r = *((unsigned char*) (ctx->fbPtr + pix_offset));
+	px->rgba.color.g = *((unsigned char*) (ctx->fbPtr + pix_offset + 1U));
+	px->rgba.color.b = *((unsigned char*) (ctx->fbPtr + pix_offset + 2U));
 }
 
 static inline __attribute__((always_inline, hot)) void
-    get_pixel_RGB32(const FBInkCoordinates* restrict coords, FBInkPixel* restrict px)
+    get_pixel_RGB32(FBInkContext* restrict ctx, const FBInkCoordinates* restrict coords, FBInkPixel* restrict px)
 {
 	// calculate the pixel's byte offset inside the buffer
-	const size_t scanline_offset = (size_t) coords->y * fInfo.line_length;
+	const size_t scanline_offset = (size_t) coords->y * ctx->fInfo.line_length;
 
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
-	px->p = *((uint32_t*) (fbPtr + scanline_offset) + coords->x);
+	px->p = *((uint32_t*) (ctx->fbPtr + scanline_offset) + coords->x);
 #	pragma GCC diagnostic pop
 	// NOTE: We generally don't care about alpha, we always assume it's opaque, as that's how it behaves.
 	//       We *do* pickup the actual alpha value, here, though.
 }
 
 static inline __attribute__((always_inline, hot)) void
-    get_pixel_BGR565(const FBInkCoordinates* restrict coords, FBInkPixel* restrict px)
+    get_pixel_BGR565(FBInkContext* restrict ctx, const FBInkCoordinates* restrict coords, FBInkPixel* restrict px)
 {
 	// calculate the pixel's byte offset inside the buffer
-	const size_t scanline_offset = (size_t) coords->y * fInfo.line_length;
+	const size_t scanline_offset = (size_t) coords->y * ctx->fInfo.line_length;
 
 	// NOTE: We're honoring the fb's bitfield offsets here (B: 0, G: >> 5, R: >> 11)
 	// Like put_pixel_RGB565, read those two consecutive bytes at once
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
-	const uint16_t v = *((const uint16_t*) (fbPtr + scanline_offset) + coords->x);
+	const uint16_t v = *((const uint16_t*) (ctx->fbPtr + scanline_offset) + coords->x);
 #	pragma GCC diagnostic pop
 
 	// NOTE: Unpack to RGB32, because we have no use for BGR565, it's terrible.
@@ -722,16 +723,16 @@ static inline __attribute__((always_inline, hot)) void
 }
 
 static inline __attribute__((always_inline, hot)) void
-    get_pixel_RGB565(const FBInkCoordinates* restrict coords, FBInkPixel* restrict px)
+    get_pixel_RGB565(FBInkContext* restrict ctx, const FBInkCoordinates* restrict coords, FBInkPixel* restrict px)
 {
 	// calculate the pixel's byte offset inside the buffer
-	const size_t scanline_offset = (size_t) coords->y * fInfo.line_length;
+	const size_t scanline_offset = (size_t) coords->y * ctx->fInfo.line_length;
 
 	// NOTE: We're honoring the fb's bitfield offsets here (R: 0, G: >> 5, B: >> 11)
 	// Like put_pixel_RGB565, read those two consecutive bytes at once
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
-	const uint16_t v = *((const uint16_t*) (fbPtr + scanline_offset) + coords->x);
+	const uint16_t v = *((const uint16_t*) (ctx->fbPtr + scanline_offset) + coords->x);
 #	pragma GCC diagnostic pop
 
 	// NOTE: Unpack to RGB32, because we have no use for RGB565, it's terrible.
@@ -750,51 +751,52 @@ static inline __attribute__((always_inline, hot)) void
 
 // Handle a few sanity checks...
 static inline __attribute__((always_inline, hot)) void
-    get_pixel(FBInkCoordinates coords, FBInkPixel* restrict px)
+    get_pixel(FBInkContext* restrict ctx, FBInkCoordinates coords, FBInkPixel* restrict px)
 {
 	// Handle rotation now, so we can properly validate if the pixel is off-screen or not ;).
 	// fbink_init() takes care of setting this global pointer to the right function...
-	(*fxpRotateCoords)(&coords);
+	(*ctx->fxpRotateCoords)(ctx, &coords);
 
 	// NOTE: Discard off-screen pixels!
 	//       For instance, when we have a halfcell offset in conjunction with a !isPerfectFit pixel offset,
 	//       when we're padding and centering, the final whitespace of right-padding will have its last
 	//       few pixels (the exact amount being half of the dead zone width) pushed off-screen...
 	//       And, of course, anything using hoffset or voffset can happily push stuff OOB ;).
-	if (unlikely(coords.x >= vInfo.xres || coords.y >= vInfo.yres)) {
+	if (unlikely(coords.x >= ctx->vInfo.xres || coords.y >= ctx->vInfo.yres)) {
 #	ifdef DEBUG
 		// NOTE: This is only enabled in Debug builds because it can be pretty verbose,
 		//       and does not necessarily indicate an actual issue, as we've just explained...
 		LOG("Put: discarding off-screen pixel @ (%hu, %hu) (out of %ux%u bounds)",
 		    coords.x,
 		    coords.y,
-		    vInfo.xres,
-		    vInfo.yres);
+		    ctx->vInfo.xres,
+		    ctx->vInfo.yres);
 #	endif
 		return;
 	}
 
 	// NOTE: Hmm, here, an if ladder appears to be ever so *slightly* faster than going through the function pointer...
-	if (deviceQuirks.pixelFormat == FBINK_PXFMT_Y4) {
-		get_pixel_Gray4(&coords, px);
-	} else if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_Y8)) {
-		get_pixel_Gray8(&coords, px);
-	} else if (deviceQuirks.pixelFormat == FBINK_PXFMT_BGR565) {
-		get_pixel_BGR565(&coords, px);
-	} else if (unlikely(deviceQuirks.pixelFormat == FBINK_PXFMT_RGB565)) {
-		get_pixel_RGB565(&coords, px);
-	} else if (unlikely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR24)) {
-		get_pixel_BGR24(&coords, px);
-	} else if (unlikely(deviceQuirks.pixelFormat == FBINK_PXFMT_RGB24)) {
-		get_pixel_RGB24(&coords, px);
-	} else if (likely(vInfo.bits_per_pixel == 32U)) {
-		get_pixel_RGB32(&coords, px);
+	if (ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y4) {
+		get_pixel_Gray4(ctx, &coords, px);
+	} else if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y8)) {
+		get_pixel_Gray8(ctx, &coords, px);
+	} else if (ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR565) {
+		get_pixel_BGR565(ctx, &coords, px);
+	} else if (unlikely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_RGB565)) {
+		get_pixel_RGB565(ctx, &coords, px);
+	} else if (unlikely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR24)) {
+		get_pixel_BGR24(ctx, &coords, px);
+	} else if (unlikely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_RGB24)) {
+		get_pixel_RGB24(ctx, &coords, px);
+	} else if (likely(ctx->vInfo.bits_per_pixel == 32U)) {
+		get_pixel_RGB32(ctx, &coords, px);
 	}
 }
 
 // Helper functions to draw a rectangle in a given color
 static __attribute__((hot)) void
-    fill_rect_Gray4(unsigned short int x,
+    fill_rect_Gray4(FBInkContext* restrict ctx,
+		    unsigned short int x,
 		    unsigned short int y,
 		    unsigned short int w,
 		    unsigned short int h,
@@ -807,7 +809,7 @@ static __attribute__((hot)) void
 				.x = (unsigned short int) (x + cx),
 				.y = (unsigned short int) (y + cy),
 			};
-			put_pixel_Gray4(&coords, px);
+			put_pixel_Gray4(ctx, &coords, px);
 		}
 	}
 
@@ -817,7 +819,8 @@ static __attribute__((hot)) void
 }
 
 static __attribute__((hot)) void
-    fill_rect_Gray4_checked(unsigned short int x,
+    fill_rect_Gray4_checked(FBInkContext* restrict ctx,
+			    unsigned short int x,
 			    unsigned short int y,
 			    unsigned short int w,
 			    unsigned short int h,
@@ -825,14 +828,14 @@ static __attribute__((hot)) void
 {
 	// Bounds-checking, to ensure the memset won't do stupid things...
 	// Do signed maths, to account for the fact that x or y might already be OOB!
-	if (unlikely(x + w > screenWidth)) {
-		w = (unsigned short int) MAX(0, (w - ((x + w) - (int) screenWidth)));
+	if (unlikely(x + w > ctx->screenWidth)) {
+		w = (unsigned short int) MAX(0, (w - ((x + w) - (int) ctx->screenWidth)));
 #	ifdef DEBUG
 		LOG("Chopped rectangle width to %hu", w);
 #	endif
 	}
-	if (unlikely(y + h > screenHeight)) {
-		h = (unsigned short int) MAX(0, (h - ((y + h) - (int) screenHeight)));
+	if (unlikely(y + h > ctx->screenHeight)) {
+		h = (unsigned short int) MAX(0, (h - ((y + h) - (int) ctx->screenHeight)));
 #	ifdef DEBUG
 		LOG("Chopped rectangle height to %hu", h);
 #	endif
@@ -846,12 +849,13 @@ static __attribute__((hot)) void
 		return;
 	}
 
-	return fill_rect_Gray4(x, y, w, h, px);
+	return fill_rect_Gray4(ctx, x, y, w, h, px);
 }
 
 #	ifdef FBINK_FOR_POCKETBOOK
 static __attribute__((hot)) void
-    fill_rect_Gray8(unsigned short int x,
+    fill_rect_Gray8(FBInkContext* restrict ctx,
+		    unsigned short int x,
 		    unsigned short int y,
 		    unsigned short int w,
 		    unsigned short int h,
@@ -864,10 +868,10 @@ static __attribute__((hot)) void
 		.width  = w,
 		.height = h,
 	};
-	(*fxpRotateRegion)(&region);
+	(*ctx->fxpRotateRegion)(ctx, &region);
 
 	for (size_t j = region.top; j < region.top + region.height; j++) {
-		uint8_t* p = fbPtr + (fInfo.line_length * j) + (region.left);
+		uint8_t* p = ctx->fbPtr + (ctx->fInfo.line_length * j) + (region.left);
 		memset(p, px->gray8, region.width);
 	}
 
@@ -877,7 +881,8 @@ static __attribute__((hot)) void
 }
 #	else
 static __attribute__((hot)) void
-    fill_rect_Gray8(unsigned short int x,
+    fill_rect_Gray8(FBInkContext* restrict ctx,
+		    unsigned short int x,
 		    unsigned short int y,
 		    unsigned short int w,
 		    unsigned short int h,
@@ -885,7 +890,7 @@ static __attribute__((hot)) void
 {
 	// NOTE: fxpRotateRegion is never set at 8bpp :).
 	for (size_t j = y; j < y + h; j++) {
-		uint8_t* p = fbPtr + (fInfo.line_length * j) + (x);
+		uint8_t* p = ctx->fbPtr + (ctx->fInfo.line_length * j) + (x);
 		memset(p, px->gray8, w);
 	}
 
@@ -896,7 +901,8 @@ static __attribute__((hot)) void
 #	endif
 
 static __attribute__((hot)) void
-    fill_rect_Gray8_checked(unsigned short int x,
+    fill_rect_Gray8_checked(FBInkContext* restrict ctx,
+			    unsigned short int x,
 			    unsigned short int y,
 			    unsigned short int w,
 			    unsigned short int h,
@@ -904,14 +910,14 @@ static __attribute__((hot)) void
 {
 	// Bounds-checking, to ensure the memset won't do stupid things...
 	// Do signed maths, to account for the fact that x or y might already be OOB!
-	if (unlikely(x + w > screenWidth)) {
-		w = (unsigned short int) MAX(0, (w - ((x + w) - (int) screenWidth)));
+	if (unlikely(x + w > ctx->screenWidth)) {
+		w = (unsigned short int) MAX(0, (w - ((x + w) - (int) ctx->screenWidth)));
 #	ifdef DEBUG
 		LOG("Chopped rectangle width to %hu", w);
 #	endif
 	}
-	if (unlikely(y + h > screenHeight)) {
-		h = (unsigned short int) MAX(0, (h - ((y + h) - (int) screenHeight)));
+	if (unlikely(y + h > ctx->screenHeight)) {
+		h = (unsigned short int) MAX(0, (h - ((y + h) - (int) ctx->screenHeight)));
 #	ifdef DEBUG
 		LOG("Chopped rectangle height to %hu", h);
 #	endif
@@ -925,11 +931,12 @@ static __attribute__((hot)) void
 		return;
 	}
 
-	return fill_rect_Gray8(x, y, w, h, px);
+	return fill_rect_Gray8(ctx, x, y, w, h, px);
 }
 
 static __attribute__((hot)) void
-    fill_rect_RGB565(unsigned short int x,
+    fill_rect_RGB565(FBInkContext* restrict ctx,
+		     unsigned short int x,
 		     unsigned short int y,
 		     unsigned short int w,
 		     unsigned short int h,
@@ -946,15 +953,15 @@ static __attribute__((hot)) void
 		.width  = w,
 		.height = h,
 	};
-	(*fxpRotateRegion)(&region);
+	(*ctx->fxpRotateRegion)(ctx, &region);
 
 	// And that's a cheap-ass manual memset16, let's hope the compiler can do something fun with that...
 	// That's the exact pattern used by the Linux kernel (c.f., memset16 @ lib/string.c), so, here's hoping ;).
 	for (size_t j = region.top; j < region.top + region.height; j++) {
-		const size_t scanline_offset = fInfo.line_length * j;
+		const size_t scanline_offset = ctx->fInfo.line_length * j;
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
-		uint16_t* restrict p = (uint16_t*) (fbPtr + scanline_offset) + region.left;
+		uint16_t* restrict p = (uint16_t*) (ctx->fbPtr + scanline_offset) + region.left;
 #	pragma GCC diagnostic pop
 		size_t px_count = region.width;
 
@@ -969,7 +976,8 @@ static __attribute__((hot)) void
 }
 
 static __attribute__((hot)) void
-    fill_rect_RGB565_checked(unsigned short int x,
+    fill_rect_RGB565_checked(FBInkContext* restrict ctx,
+			     unsigned short int x,
 			     unsigned short int y,
 			     unsigned short int w,
 			     unsigned short int h,
@@ -979,14 +987,14 @@ static __attribute__((hot)) void
 	// Do signed maths, to account for the fact that x or y might already be OOB!
 	// NOTE: Unlike put_pixel, we check against screenWidth/screenHeight instead of xres/yres because we're doing this
 	//       *before* fxpRotateRegion!
-	if (unlikely(x + w > screenWidth)) {
-		w = (unsigned short int) MAX(0, (w - ((x + w) - (int) screenWidth)));
+	if (unlikely(x + w > ctx->screenWidth)) {
+		w = (unsigned short int) MAX(0, (w - ((x + w) - (int) ctx->screenWidth)));
 #	ifdef DEBUG
 		LOG("Chopped rectangle width to %hu", w);
 #	endif
 	}
-	if (unlikely(y + h > screenHeight)) {
-		h = (unsigned short int) MAX(0, (h - ((y + h) - (int) screenHeight)));
+	if (unlikely(y + h > ctx->screenHeight)) {
+		h = (unsigned short int) MAX(0, (h - ((y + h) - (int) ctx->screenHeight)));
 #	ifdef DEBUG
 		LOG("Chopped rectangle height to %hu", h);
 #	endif
@@ -1000,11 +1008,12 @@ static __attribute__((hot)) void
 		return;
 	}
 
-	return fill_rect_RGB565(x, y, w, h, px);
+	return fill_rect_RGB565(ctx, x, y, w, h, px);
 }
 
 static void
-    fill_rect_RGB24(unsigned short int x,
+    fill_rect_RGB24(FBInkContext* restrict ctx,
+		    unsigned short int x,
 		    unsigned short int y,
 		    unsigned short int w,
 		    unsigned short int h,
@@ -1012,7 +1021,7 @@ static void
 {
 	// NOTE: fxpRotateRegion is never set at 24bpp :).
 	for (size_t j = y; j < y + h; j++) {
-		uint8_t* p = fbPtr + (fInfo.line_length * j) + (x * 3U);
+		uint8_t* p = ctx->fbPtr + (ctx->fInfo.line_length * j) + (x * 3U);
 		memset(p, px->gray8, w * 3U);
 	}
 
@@ -1022,7 +1031,8 @@ static void
 }
 
 static void
-    fill_rect_RGB24_checked(unsigned short int x,
+    fill_rect_RGB24_checked(FBInkContext* restrict ctx,
+			    unsigned short int x,
 			    unsigned short int y,
 			    unsigned short int w,
 			    unsigned short int h,
@@ -1030,14 +1040,14 @@ static void
 {
 	// Bounds-checking, to ensure the memset won't do stupid things...
 	// Do signed maths, to account for the fact that x or y might already be OOB!
-	if (unlikely(x + w > screenWidth)) {
-		w = (unsigned short int) MAX(0, (w - ((x + w) - (int) screenWidth)));
+	if (unlikely(x + w > ctx->screenWidth)) {
+		w = (unsigned short int) MAX(0, (w - ((x + w) - (int) ctx->screenWidth)));
 #	ifdef DEBUG
 		LOG("Chopped rectangle width to %hu", w);
 #	endif
 	}
-	if (unlikely(y + h > screenHeight)) {
-		h = (unsigned short int) MAX(0, (h - ((y + h) - (int) screenHeight)));
+	if (unlikely(y + h > ctx->screenHeight)) {
+		h = (unsigned short int) MAX(0, (h - ((y + h) - (int) ctx->screenHeight)));
 #	ifdef DEBUG
 		LOG("Chopped rectangle height to %hu", h);
 #	endif
@@ -1051,11 +1061,12 @@ static void
 		return;
 	}
 
-	return fill_rect_RGB24(x, y, w, h, px);
+	return fill_rect_RGB24(ctx, x, y, w, h, px);
 }
 
 static __attribute__((hot)) void
-    fill_rect_RGB32(unsigned short int x,
+    fill_rect_RGB32(FBInkContext* restrict ctx,
+		    unsigned short int x,
 		    unsigned short int y,
 		    unsigned short int w,
 		    unsigned short int h,
@@ -1065,10 +1076,10 @@ static __attribute__((hot)) void
 	for (size_t j = y; j < y + h; j++) {
 		// NOTE: Go with a cheap memset32 in order to preserve the alpha value of our input pixel...
 		//       The compiler should be able to turn that into something as fast as a plain memset ;).
-		const size_t scanline_offset = fInfo.line_length * j;
+		const size_t scanline_offset = ctx->fInfo.line_length * j;
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
-		uint32_t* p = (uint32_t*) (fbPtr + scanline_offset) + x;
+		uint32_t* p = (uint32_t*) (ctx->fbPtr + scanline_offset) + x;
 #	pragma GCC diagnostic pop
 		size_t px_count = w;
 
@@ -1083,7 +1094,8 @@ static __attribute__((hot)) void
 }
 
 static __attribute__((hot)) void
-    fill_rect_RGB32_checked(unsigned short int x,
+    fill_rect_RGB32_checked(FBInkContext* restrict ctx,
+			    unsigned short int x,
 			    unsigned short int y,
 			    unsigned short int w,
 			    unsigned short int h,
@@ -1091,14 +1103,14 @@ static __attribute__((hot)) void
 {
 	// Bounds-checking, to ensure the memset won't do stupid things...
 	// Do signed maths, to account for the fact that x or y might already be OOB!
-	if (unlikely(x + w > screenWidth)) {
-		w = (unsigned short int) MAX(0, (w - ((x + w) - (int) screenWidth)));
+	if (unlikely(x + w > ctx->screenWidth)) {
+		w = (unsigned short int) MAX(0, (w - ((x + w) - (int) ctx->screenWidth)));
 #	ifdef DEBUG
 		LOG("Chopped rectangle width to %hu", w);
 #	endif
 	}
-	if (unlikely(y + h > screenHeight)) {
-		h = (unsigned short int) MAX(0, (h - ((y + h) - (int) screenHeight)));
+	if (unlikely(y + h > ctx->screenHeight)) {
+		h = (unsigned short int) MAX(0, (h - ((y + h) - (int) ctx->screenHeight)));
 #	ifdef DEBUG
 		LOG("Chopped rectangle height to %hu", h);
 #	endif
@@ -1112,16 +1124,24 @@ static __attribute__((hot)) void
 		return;
 	}
 
-	return fill_rect_RGB32(x, y, w, h, px);
+	return fill_rect_RGB32(ctx, x, y, w, h, px);
 }
 
 // Helper function to clear the screen - fill whole screen with given color
 static void
-    clear_screen(int fbfd UNUSED_BY_NOTKINDLE, FBInkPixel* px, bool is_flashing UNUSED_BY_NOTKINDLE)
+    clear_screen(FBInkContext* restrict ctx,
+		 int fbfd         UNUSED_BY_NOTKINDLE,
+		 FBInkPixel* px,
+		 bool is_flashing UNUSED_BY_NOTKINDLE)
 {
+	// NOTE: When drawing to a surface that lives in the framebuffer (e.g., a hardware alternate buffer),
+	//       there's only a single screen's worth of memory behind fbPtr!
+	const size_t fb_size =
+	    (ctx->activeSurface && is_surface_in_fb(ctx->activeSurface)) ? ctx->activeSurface->size : ctx->fInfo.smem_len;
+
 #	ifdef FBINK_FOR_KINDLE
 	// NOTE: einkfb has a dedicated ioctl, so, use that, when it's not doing more harm than good...
-	if (deviceQuirks.isKindleLegacy) {
+	if (ctx->deviceQuirks.isKindleLegacy) {
 		// NOTE: The ioctl only does white, though, and it has a tendency to enforce a flash,
 		//       which would cause a double refresh if we were to print a rectangle in another color right after...
 		//       So, basically, only use the ioctl when we request a FLASHING clear to WHITE...
@@ -1146,9 +1166,9 @@ static void
 		//       If we memset the full smem_len, that trips this check, because we probably overwrite both buffers...
 		//       Do a slightly more targeted memset instead (line_length * yres_virtual),
 		//       which should cover the active & visible buffer only...
-		memset(fbPtr, px->gray8, fInfo.line_length * vInfo.yres_virtual);
+		memset(ctx->fbPtr, px->gray8, ctx->fInfo.line_length * ctx->vInfo.yres_virtual);
 	} else {
-		memset(fbPtr, px->gray8, fInfo.smem_len);
+		memset(ctx->fbPtr, px->gray8, fb_size);
 	}
 #	else
 	// NOTE: Apparently, some NTX devices do not appreciate a memset of the full smem_len when they're in a 16bpp mode...
@@ -1158,30 +1178,30 @@ static void
 	//       in particular size/psize vs. mapsize
 	//       Anyway, don't clobber that, as it seems to cause softlocks on BQ/Cervantes,
 	//       and be very conservative, using yres instead of yres_virtual, as Qt *may* already rely on that memory region.
-	if (unlikely(vInfo.bits_per_pixel == 16U)) {
+	if (unlikely(ctx->vInfo.bits_per_pixel == 16U)) {
 		// We whip up a quick memset16, like fill_rect_RGB565. Input pixel is guarnteed to be packed properly already.
 #		pragma GCC diagnostic push
 #		pragma GCC diagnostic ignored "-Wcast-align"
-		uint16_t* p        = (uint16_t*) fbPtr;
+		uint16_t* p        = (uint16_t*) ctx->fbPtr;
 #		pragma GCC diagnostic pop
-		size_t    px_count = (size_t) vInfo.xres_virtual * vInfo.yres;
+		size_t    px_count = (size_t) ctx->vInfo.xres_virtual * ctx->vInfo.yres;
 		while (px_count--) {
 			*p++ = px->rgb565;
 		}
-	} else if (vInfo.bits_per_pixel == 32U) {
+	} else if (ctx->vInfo.bits_per_pixel == 32U) {
 		// Much like in fill_rect_RGB32, do this in a way that'll preserve the alpha byte...
 #		pragma GCC diagnostic push
 #		pragma GCC diagnostic ignored "-Wcast-align"
-		uint32_t* p        = (uint32_t*) fbPtr;
+		uint32_t* p        = (uint32_t*) ctx->fbPtr;
 #		pragma GCC diagnostic pop
-		size_t    px_count = (size_t) vInfo.xres_virtual * vInfo.yres;
+		size_t    px_count = (size_t) ctx->vInfo.xres_virtual * ctx->vInfo.yres;
 		while (px_count--) {
 			*p++ = px->p;
 		}
 	} else {
 		// NOTE: fInfo.smem_len should actually match fInfo.line_length * vInfo.yres_virtual on 32bpp ;).
 		//       Which is how things should always be, but, alas, poor Yorick...
-		memset(fbPtr, px->gray8, fInfo.smem_len);
+		memset(ctx->fbPtr, px->gray8, fb_size);
 	}
 #	endif
 }
@@ -1217,16 +1237,17 @@ static void
 // Performance is *not* a priority for these, avoid them if at all possible!
 // (The main overhead lies in the packing/unpacking of pixels, because our internal pixel data type is... fairly gnarly).
 int
-    fbink_put_pixel_gray(int fbfd   UNUSED_BY_NODRAW,
-			 uint16_t x UNUSED_BY_NODRAW,
-			 uint16_t y UNUSED_BY_NODRAW,
-			 uint8_t v  UNUSED_BY_NODRAW)
+    fbink_put_pixel_gray_ctx(FBInkContext* restrict ctx UNUSED_BY_NODRAW,
+			     int fbfd   UNUSED_BY_NODRAW,
+			     uint16_t x UNUSED_BY_NODRAW,
+			     uint16_t y UNUSED_BY_NODRAW,
+			     uint8_t v  UNUSED_BY_NODRAW)
 {
 #ifdef FBINK_WITH_DRAW
 	// If we open a fd now, we'll only keep it open for this single call!
 	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
 	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -1234,24 +1255,24 @@ int
 	int rv = EXIT_SUCCESS;
 
 	// mmap fb to user mem
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
 	}
 
 	const FBInkCoordinates coords = { .x = x, .y = y };
-	FBInkPixel             px     = pack_pixel_from_y8(v);
-	put_pixel(coords, &px, true);
+	FBInkPixel             px     = pack_pixel_from_y8(ctx, v);
+	put_pixel(ctx, coords, &px, true);
 
 	// Cleanup
 cleanup:
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -1262,19 +1283,26 @@ cleanup:
 }
 
 int
-    fbink_put_pixel_rgba(int fbfd   UNUSED_BY_NODRAW,
-			 uint16_t x UNUSED_BY_NODRAW,
-			 uint16_t y UNUSED_BY_NODRAW,
-			 uint8_t r  UNUSED_BY_NODRAW,
-			 uint8_t g  UNUSED_BY_NODRAW,
-			 uint8_t b  UNUSED_BY_NODRAW,
-			 uint8_t a  UNUSED_BY_NODRAW)
+    fbink_put_pixel_gray(int fbfd, uint16_t x, uint16_t y, uint8_t v)
+{
+	return fbink_put_pixel_gray_ctx(&defaultCtx, fbfd, x, y, v);
+}
+
+int
+    fbink_put_pixel_rgba_ctx(FBInkContext* restrict ctx UNUSED_BY_NODRAW,
+			     int fbfd   UNUSED_BY_NODRAW,
+			     uint16_t x UNUSED_BY_NODRAW,
+			     uint16_t y UNUSED_BY_NODRAW,
+			     uint8_t r  UNUSED_BY_NODRAW,
+			     uint8_t g  UNUSED_BY_NODRAW,
+			     uint8_t b  UNUSED_BY_NODRAW,
+			     uint8_t a  UNUSED_BY_NODRAW)
 {
 #ifdef FBINK_WITH_DRAW
 	// If we open a fd now, we'll only keep it open for this single call!
 	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
 	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -1282,24 +1310,24 @@ int
 	int rv = EXIT_SUCCESS;
 
 	// mmap fb to user mem
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
 	}
 
 	const FBInkCoordinates coords = { .x = x, .y = y };
-	FBInkPixel             px     = pack_pixel_from_rgba(r, g, b, a);
-	put_pixel(coords, &px, true);
+	FBInkPixel             px     = pack_pixel_from_rgba(ctx, r, g, b, a);
+	put_pixel(ctx, coords, &px, true);
 
 	// Cleanup
 cleanup:
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -1309,14 +1337,22 @@ cleanup:
 #endif
 }
 
+int
+    fbink_put_pixel_rgba(int fbfd, uint16_t x, uint16_t y, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+	return fbink_put_pixel_rgba_ctx(&defaultCtx, fbfd, x, y, r, g, b, a);
+}
+
 // To avoid the overhead of repeatedly packing the same color,
 // expose variants of the above that allow the API user to store such a packed pixel,
 // and pass it to specific variants (fbink_put_pixel & fbink_fill_rect).
 int
-    fbink_pack_pixel_gray(uint8_t y UNUSED_BY_NODRAW, uint32_t* px UNUSED_BY_NODRAW)
+    fbink_pack_pixel_gray_ctx(FBInkContext* restrict ctx UNUSED_BY_NODRAW,
+			      uint8_t y                  UNUSED_BY_NODRAW,
+			      uint32_t* px               UNUSED_BY_NODRAW)
 {
 #ifdef FBINK_WITH_DRAW
-	FBInkPixel p = pack_pixel_from_y8(y);
+	FBInkPixel p = pack_pixel_from_y8(ctx, y);
 	*px          = p.p;
 
 	return EXIT_SUCCESS;
@@ -1327,14 +1363,21 @@ int
 }
 
 int
-    fbink_pack_pixel_rgba(uint8_t r    UNUSED_BY_NODRAW,
-			  uint8_t g    UNUSED_BY_NODRAW,
-			  uint8_t b    UNUSED_BY_NODRAW,
-			  uint8_t a    UNUSED_BY_NODRAW,
-			  uint32_t* px UNUSED_BY_NODRAW)
+    fbink_pack_pixel_gray(uint8_t y, uint32_t* px)
+{
+	return fbink_pack_pixel_gray_ctx(&defaultCtx, y, px);
+}
+
+int
+    fbink_pack_pixel_rgba_ctx(FBInkContext* restrict ctx UNUSED_BY_NODRAW,
+			      uint8_t r    UNUSED_BY_NODRAW,
+			      uint8_t g    UNUSED_BY_NODRAW,
+			      uint8_t b    UNUSED_BY_NODRAW,
+			      uint8_t a    UNUSED_BY_NODRAW,
+			      uint32_t* px UNUSED_BY_NODRAW)
 {
 #ifdef FBINK_WITH_DRAW
-	FBInkPixel p = pack_pixel_from_rgba(r, g, b, a);
+	FBInkPixel p = pack_pixel_from_rgba(ctx, r, g, b, a);
 	*px          = p.p;
 
 	return EXIT_SUCCESS;
@@ -1345,16 +1388,23 @@ int
 }
 
 int
-    fbink_put_pixel(int fbfd   UNUSED_BY_NODRAW,
-		    uint16_t x UNUSED_BY_NODRAW,
-		    uint16_t y UNUSED_BY_NODRAW,
-		    void* px   UNUSED_BY_NODRAW)
+    fbink_pack_pixel_rgba(uint8_t r, uint8_t g, uint8_t b, uint8_t a, uint32_t* px)
+{
+	return fbink_pack_pixel_rgba_ctx(&defaultCtx, r, g, b, a, px);
+}
+
+int
+    fbink_put_pixel_ctx(FBInkContext* restrict ctx UNUSED_BY_NODRAW,
+			int fbfd   UNUSED_BY_NODRAW,
+			uint16_t x UNUSED_BY_NODRAW,
+			uint16_t y UNUSED_BY_NODRAW,
+			void* px   UNUSED_BY_NODRAW)
 {
 #ifdef FBINK_WITH_DRAW
 	// If we open a fd now, we'll only keep it open for this single call!
 	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
 	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -1362,23 +1412,23 @@ int
 	int rv = EXIT_SUCCESS;
 
 	// mmap fb to user mem
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
 	}
 
 	const FBInkCoordinates coords = { .x = x, .y = y };
-	put_pixel(coords, px, true);
+	put_pixel(ctx, coords, px, true);
 
 	// Cleanup
 cleanup:
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -1389,19 +1439,26 @@ cleanup:
 }
 
 int
-    fbink_get_pixel(int fbfd   UNUSED_BY_NODRAW,
-		    uint16_t x UNUSED_BY_NODRAW,
-		    uint16_t y UNUSED_BY_NODRAW,
-		    uint8_t* r UNUSED_BY_NODRAW,
-		    uint8_t* g UNUSED_BY_NODRAW,
-		    uint8_t* b UNUSED_BY_NODRAW,
-		    uint8_t* a UNUSED_BY_NODRAW)
+    fbink_put_pixel(int fbfd, uint16_t x, uint16_t y, void* px)
+{
+	return fbink_put_pixel_ctx(&defaultCtx, fbfd, x, y, px);
+}
+
+int
+    fbink_get_pixel_ctx(FBInkContext* restrict ctx UNUSED_BY_NODRAW,
+			int fbfd   UNUSED_BY_NODRAW,
+			uint16_t x UNUSED_BY_NODRAW,
+			uint16_t y UNUSED_BY_NODRAW,
+			uint8_t* r UNUSED_BY_NODRAW,
+			uint8_t* g UNUSED_BY_NODRAW,
+			uint8_t* b UNUSED_BY_NODRAW,
+			uint8_t* a UNUSED_BY_NODRAW)
 {
 #ifdef FBINK_WITH_DRAW
 	// If we open a fd now, we'll only keep it open for this single call!
 	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
 	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -1409,8 +1466,8 @@ int
 	int rv = EXIT_SUCCESS;
 
 	// mmap fb to user mem
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
@@ -1423,19 +1480,19 @@ int
 #	pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
 	FBInkPixel px;
 #	pragma GCC diagnostic push
-	get_pixel(coords, &px);
+	get_pixel(ctx, coords, &px);
 
 	// Unpack the pixel for public consumption
-	if (deviceQuirks.pixelFormat == FBINK_PXFMT_Y4 || deviceQuirks.pixelFormat == FBINK_PXFMT_Y8) {
+	if (ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y4 || ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y8) {
 		*r = px.gray8;
 		*g = px.gray8;
 		*b = px.gray8;
 		*a = 0xFFu;
-	} else if (deviceQuirks.isRGB) {
+	} else if (ctx->deviceQuirks.isRGB) {
 		*r = px.rgba.color.r;
 		*g = px.rgba.color.g;
 		*b = px.rgba.color.b;
-		if (vInfo.bits_per_pixel == 32U) {
+		if (ctx->vInfo.bits_per_pixel == 32U) {
 			*a = px.rgba.color.a;
 		} else {
 			*a = 0xFFu;
@@ -1444,7 +1501,7 @@ int
 		*r = px.bgra.color.r;
 		*g = px.bgra.color.g;
 		*b = px.bgra.color.b;
-		if (vInfo.bits_per_pixel == 32U) {
+		if (ctx->vInfo.bits_per_pixel == 32U) {
 			*a = px.bgra.color.a;
 		} else {
 			*a = 0xFFu;
@@ -1453,11 +1510,11 @@ int
 
 	// Cleanup
 cleanup:
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -1467,6 +1524,12 @@ cleanup:
 #endif
 }
 
+int
+    fbink_get_pixel(int fbfd, uint16_t x, uint16_t y, uint8_t* r, uint8_t* g, uint8_t* b, uint8_t* a)
+{
+	return fbink_get_pixel_ctx(&defaultCtx, fbfd, x, y, r, g, b, a);
+}
+
 #ifdef FBINK_WITH_BITMAP
 // Return the font8x8 bitmap for a specific Unicode codepoint
 static const unsigned char*
@@ -1613,7 +1676,8 @@ static int
 
 // Helper function for drawing
 static struct mxcfb_rect
-    draw(const char* restrict text,
+    draw(FBInkContext* restrict ctx,
+	 const char* restrict text,
 	 unsigned short int row,
 	 unsigned short int col,
 	 unsigned short int multiline_offset,
@@ -1625,8 +1689,8 @@ static struct mxcfb_rect
 	    multiline_offset,
 	    (unsigned short int) (row + multiline_offset));
 
-	FBInkPixel fgP = penFGPixel;
-	FBInkPixel bgP = penBGPixel;
+	FBInkPixel fgP = ctx->penFGPixel;
+	FBInkPixel bgP = ctx->penBGPixel;
 	if (fbink_cfg->is_inverted) {
 		// NOTE: As far as RGB565 is concerned, our fill/put methods will only ever use the .rgb565 field,
 		//       so we don't actually care about flipping one extra byte here, nothing will ever read it ;).
@@ -1651,14 +1715,14 @@ static struct mxcfb_rect
 	unsigned short int pixel_offset = 0U;
 	// Do we have a centering induced halfcell adjustment to correct?
 	if (halfcell_offset) {
-		pixel_offset = FONTW / 2U;
+		pixel_offset = ctx->FONTW / 2U;
 		LOG("Incrementing pixel_offset by %hu pixels to account for a halfcell centering tweak", pixel_offset);
 	}
 	// Do we have a permanent adjustment to make because of dead space on the right edge?
-	if (!deviceQuirks.isPerfectFit) {
+	if (!ctx->deviceQuirks.isPerfectFit) {
 		// We correct by half of said dead space, since we want perfect centering ;).
 		unsigned short int deadzone_offset =
-		    (unsigned short int) (viewWidth - (unsigned short int) (MAXCOLS * FONTW)) / 2U;
+		    (unsigned short int) (ctx->viewWidth - (unsigned short int) (ctx->MAXCOLS * ctx->FONTW)) / 2U;
 		pixel_offset = (unsigned short int) (pixel_offset + deadzone_offset);
 		LOG("Incrementing pixel_offset by %hu pixels to compensate for dead space on the right edge",
 		    deadzone_offset);
@@ -1669,12 +1733,12 @@ static struct mxcfb_rect
 	short int hoffset = fbink_cfg->hoffset;
 	// NOTE: This test isn't perfect, but then, if you play with this, you do it knowing the risks...
 	//       It's mainly there so that stupidly large values don't wrap back on screen because of overflow wraparound.
-	if ((uint32_t) abs(voffset) >= viewHeight) {
+	if ((uint32_t) abs(voffset) >= ctx->viewHeight) {
 		LOG("The specified vertical offset (%hd) necessarily pushes *all* content out of bounds, discarding it",
 		    voffset);
 		voffset = 0;
 	}
-	if ((uint32_t) abs(hoffset) >= viewWidth) {
+	if ((uint32_t) abs(hoffset) >= ctx->viewWidth) {
 		LOG("The specified horizontal offset (%hd) necessarily pushes *all* content out of bounds, discarding it",
 		    hoffset);
 		hoffset = 0;
@@ -1682,40 +1746,41 @@ static struct mxcfb_rect
 
 	// Compute the dimension of the screen region we'll paint to (taking multi-line into account)
 	struct mxcfb_rect region = {
-		.top  = (uint32_t) MAX(0 + (viewVertOrigin - viewVertOffset),
-				       (((row - multiline_offset) * FONTH) + voffset + viewVertOrigin)),
-		.left = (uint32_t) MAX(0 + viewHoriOrigin, ((col * FONTW) + hoffset + viewHoriOrigin)),
+		.top  = (uint32_t) MAX(0 + (ctx->viewVertOrigin - ctx->viewVertOffset),
+				       (((row - multiline_offset) * ctx->FONTH) + voffset + ctx->viewVertOrigin)),
+		.left = (uint32_t) MAX(0 + ctx->viewHoriOrigin, ((col * ctx->FONTW) + hoffset + ctx->viewHoriOrigin)),
 		.width =
-		    multiline_offset > 0U ? (screenWidth - (uint32_t) (col * FONTW)) : (uint32_t) (charcount * FONTW),
-		.height = (uint32_t) ((multiline_offset + 1U) * FONTH),
+		    multiline_offset > 0U ? (ctx->screenWidth - (uint32_t) (col * ctx->FONTW))
+					  : (uint32_t) (charcount * ctx->FONTW),
+		.height = (uint32_t) ((multiline_offset + 1U) * ctx->FONTH),
 	};
 
 	// Recap final offset values
-	if (hoffset != 0 || viewHoriOrigin != 0) {
+	if (hoffset != 0 || ctx->viewHoriOrigin != 0) {
 		LOG("Adjusting horizontal pen position by %hd pixels, as requested, plus %hhu pixels, as mandated by the native viewport",
 		    hoffset,
-		    viewHoriOrigin);
+		    ctx->viewHoriOrigin);
 		// Clamp region to sane values if h/v offset is pushing stuff off-screen
-		if ((region.width + region.left + pixel_offset) > screenWidth) {
-			region.width = (uint32_t) MAX(0, (short int) (screenWidth - region.left - pixel_offset));
+		if ((region.width + region.left + pixel_offset) > ctx->screenWidth) {
+			region.width = (uint32_t) MAX(0, (short int) (ctx->screenWidth - region.left - pixel_offset));
 			LOG("Adjusted region width to account for horizontal offset pushing part of the content off-screen");
 		}
-		if ((region.left + pixel_offset) >= screenWidth) {
-			region.left = screenWidth - pixel_offset - 1;
+		if ((region.left + pixel_offset) >= ctx->screenWidth) {
+			region.left = ctx->screenWidth - pixel_offset - 1;
 			LOG("Adjusted region left to account for horizontal offset pushing part of the content off-screen");
 		}
 	}
-	if (voffset != 0 || viewVertOrigin != 0) {
+	if (voffset != 0 || ctx->viewVertOrigin != 0) {
 		LOG("Adjusting vertical pen position by %hd pixels, as requested, plus %hhu pixels, as mandated by the native viewport",
 		    voffset,
-		    viewVertOrigin);
+		    ctx->viewVertOrigin);
 		// Clamp region to sane values if h/v offset is pushing stuff off-screen
-		if ((region.top + region.height) > screenHeight) {
-			region.height = (uint32_t) MAX(0, (short int) (screenHeight - region.top));
+		if ((region.top + region.height) > ctx->screenHeight) {
+			region.height = (uint32_t) MAX(0, (short int) (ctx->screenHeight - region.top));
 			LOG("Adjusted region height to account for vertical offset pushing part of the content off-screen");
 		}
-		if (region.top >= screenHeight) {
-			region.top = screenHeight - 1;
+		if (region.top >= ctx->screenHeight) {
+			region.top = ctx->screenHeight - 1;
 			LOG("Adjusted region top to account for vertical offset pushing part of the content off-screen");
 		}
 	}
@@ -1730,8 +1795,8 @@ static struct mxcfb_rect
 		// NOTE: Make sure we don't mess with multiline strings,
 		//       because by definition left has to keep matching the value of the first line,
 		//       even on subsequent lines.
-		if (charcount != MAXCOLS && multiline_offset == 0U) {
-			if ((hoffset + viewHoriOrigin) == 0) {
+		if (charcount != ctx->MAXCOLS && multiline_offset == 0U) {
+			if ((hoffset + ctx->viewHoriOrigin) == 0) {
 				region.left += pixel_offset;
 				LOG("Updated region.left to %u", region.left);
 			} else {
@@ -1739,14 +1804,15 @@ static struct mxcfb_rect
 				// We basically have to re-do the maths from scratch,
 				// do it signed to catch corner-cases interactions between col/hoffset/pixel_offset,
 				// and clamp it to safe values!
-				if ((hoffset + viewHoriOrigin) < 0) {
-					region.left =
-					    (uint32_t) MAX(0 + viewHoriOrigin,
-							   ((col * FONTW) + hoffset + viewHoriOrigin + pixel_offset));
+				if ((hoffset + ctx->viewHoriOrigin) < 0) {
+					region.left = (uint32_t) MAX(
+					    0 + ctx->viewHoriOrigin,
+					    ((col * ctx->FONTW) + hoffset + ctx->viewHoriOrigin + pixel_offset));
 				} else {
 					region.left = (uint32_t) MIN(
-					    (uint32_t) ((col * FONTW) + hoffset + viewHoriOrigin + pixel_offset),
-					    (screenWidth - 1U));
+					    (uint32_t) ((col * ctx->FONTW) + hoffset + ctx->viewHoriOrigin +
+							pixel_offset),
+					    (ctx->screenWidth - 1U));
 				}
 				LOG("Updated region.left to %u", region.left);
 			}
@@ -1759,25 +1825,26 @@ static struct mxcfb_rect
 	//       while the final one would not if it doesn't fill the line, too ;).
 	// NOTE: In overlay or bgless mode, we don't paint background pixels. This is pure background, so skip it ;).
 	if (!fbink_cfg->is_overlay && !fbink_cfg->is_bgless) {
-		if ((charcount == MAXCOLS || (col == 0 && !fbink_cfg->is_centered && multiline_offset > 0U)) &&
+		if ((charcount == ctx->MAXCOLS || (col == 0 && !fbink_cfg->is_centered && multiline_offset > 0U)) &&
 		    pixel_offset > 0U) {
 			LOG("Painting a background rectangle on the left edge on account of pixel_offset");
 			// Make sure we don't leave a hoffset sized gap when we have a positive hoffset...
-			(*fxpFillRectChecked)(
-			    hoffset > 0 ? (unsigned short int) (hoffset + viewHoriOrigin)
-					: (unsigned short int) (0U + viewHoriOrigin),
-			    (unsigned short int) (region.top + (unsigned short int) (multiline_offset * FONTH)),
+			(*ctx->fxpFillRectChecked)(
+			    ctx,
+			    hoffset > 0 ? (unsigned short int) (hoffset + ctx->viewHoriOrigin)
+					: (unsigned short int) (0U + ctx->viewHoriOrigin),
+			    (unsigned short int) (region.top + (unsigned short int) (multiline_offset * ctx->FONTH)),
 			    pixel_offset,    // Don't append hoffset here, to make it clear stuff moved to the right.
-			    FONTH,
+			    ctx->FONTH,
 			    &bgP);
 			// Correct width, to include that bit of content, too, if needed
-			if (region.width < screenWidth) {
+			if (region.width < ctx->screenWidth) {
 				region.width += pixel_offset;
 				// And make sure it's properly clamped, because we can't necessarily rely on left & width
 				// being entirely acurate either because of the multiline print override,
 				// or because of a bit of subcell placement overshoot trickery (c.f., comment in put_pixel).
-				if (region.width + region.left > screenWidth) {
-					region.width = screenWidth - region.left;
+				if (region.width + region.left > ctx->screenWidth) {
+					region.width = ctx->screenWidth - region.left;
 					LOG("Clamped region.width to %u", region.width);
 				} else {
 					LOG("Updated region.width to %u", region.width);
@@ -1789,25 +1856,26 @@ static struct mxcfb_rect
 		//       This only applies when pixel_offset *only* accounts for the !isPerfectFit adjustment though,
 		//       because in every other case, the halfcell offset handling neatly pushes everything into place ;).
 		// NOTE: Again, skip this in overlay/bgless mode ;).
-		if (charcount == MAXCOLS && !deviceQuirks.isPerfectFit && !halfcell_offset) {
+		if (charcount == ctx->MAXCOLS && !ctx->deviceQuirks.isPerfectFit && !halfcell_offset) {
 			// NOTE: !isPerfectFit ensures pixel_offset is non-zero
 			LOG("Painting a background rectangle to fill the dead space on the right edge");
 			// Make sure we don't leave a hoffset sized gap when we have a negative hoffset...
-			(*fxpFillRectChecked)(
-			    hoffset < 0 ? (unsigned short int) (screenWidth - pixel_offset -
-								(unsigned short int) abs(hoffset) - viewHoriOrigin)
-					: (unsigned short int) (screenWidth - pixel_offset - viewHoriOrigin),
-			    (unsigned short int) (region.top + (unsigned short int) (multiline_offset * FONTH)),
+			(*ctx->fxpFillRectChecked)(
+			    ctx,
+			    hoffset < 0 ? (unsigned short int) (ctx->screenWidth - pixel_offset -
+								(unsigned short int) abs(hoffset) - ctx->viewHoriOrigin)
+					: (unsigned short int) (ctx->screenWidth - pixel_offset - ctx->viewHoriOrigin),
+			    (unsigned short int) (region.top + (unsigned short int) (multiline_offset * ctx->FONTH)),
 			    pixel_offset,    // Don't append abs(hoffset) here, to make it clear stuff moved to the left.
-			    FONTH,
+			    ctx->FONTH,
 			    &bgP);
 			// If it's not already the case, update region to the full width,
 			// because we've just plugged a hole at the very right edge of a full line.
-			if (region.width < screenWidth) {
-				region.width = screenWidth;
+			if (region.width < ctx->screenWidth) {
+				region.width = ctx->screenWidth;
 				// Keep making sure it's properly clamped, interaction w/ hoffset can push us over the edge.
-				if (region.width + region.left > screenWidth) {
-					region.width = screenWidth - region.left;
+				if (region.width + region.left > ctx->screenWidth) {
+					region.width = ctx->screenWidth - region.left;
 					LOG("Clamped region.width to %u", region.width);
 				} else {
 					LOG("Updated region.width to %u", region.width);
@@ -1820,9 +1888,9 @@ static struct mxcfb_rect
 	//       it might be significantly different than the others, and as such, we'd be computing a cropped region.
 	//       Make the region cover the full width of the screen to make sure we won't miss anything.
 	if (multiline_offset > 0U && fbink_cfg->is_centered &&
-	    (region.left > (0U + viewHoriOrigin) || region.width < screenWidth)) {
-		region.left  = 0U + viewHoriOrigin;
-		region.width = screenWidth;
+	    (region.left > (0U + ctx->viewHoriOrigin) || region.width < ctx->screenWidth)) {
+		region.left  = 0U + ctx->viewHoriOrigin;
+		region.width = ctx->screenWidth;
 		LOG("Enforced region.left to %u & region.width to %u because of multi-line centering",
 		    region.left,
 		    region.width);
@@ -1842,8 +1910,8 @@ static struct mxcfb_rect
 	//       Because we store the final position in an unsigned value, this means that, to some extent,
 	//       we rely on wraparound on underflow to still point to (large, but positive) off-screen coordinates.
 	const unsigned short int x_base_offs =
-	    (unsigned short int) ((col * FONTW) + pixel_offset + hoffset + viewHoriOrigin);
-	const unsigned short int y_offs = (unsigned short int) ((row * FONTH) + voffset + viewVertOrigin);
+	    (unsigned short int) ((col * ctx->FONTW) + pixel_offset + hoffset + ctx->viewHoriOrigin);
+	const unsigned short int y_offs = (unsigned short int) ((row * ctx->FONTH) + voffset + ctx->viewVertOrigin);
 
 	unsigned short int i;
 	unsigned short int j;
@@ -1861,7 +1929,7 @@ static struct mxcfb_rect
 	//       and I don't feel like moving that to inline functions,
 	//       because it depends on seven billion different variables I'd have to pass around...
 #	ifdef FBINK_WITH_FONTS
-	if (glyphWidth <= 8) {
+	if (ctx->glyphWidth <= 8) {
 #	endif
 		while ((ch = u8_nextchar2(text, &bi)) != 0U) {
 			LOG("Char %.*zu out of %.*zu is @ byte offset %.*zu and is U+%04X (%s)",
@@ -1875,7 +1943,7 @@ static struct mxcfb_rect
 			    u8_cp_to_utf8(ch));
 
 			// Update the x coordinates for this character
-			const unsigned short int x_offs = (unsigned short int) (x_base_offs + (ci * FONTW));
+			const unsigned short int x_offs = (unsigned short int) (x_base_offs + (ci * ctx->FONTW));
 			// Remember the next char's byte offset for next iteration's logging
 			ch_bi                           = bi;
 
@@ -1901,9 +1969,9 @@ static struct mxcfb_rect
 		/* NOTE: We only need to loop on the base glyph's dimensions (i.e., the bitmap resolution), */                         \
 		/*       and from there compute the extra pixels for that single input pixel given our scaling factor... */            \
 		if (!fbink_cfg->is_overlay && !fbink_cfg->is_bgless && !fbink_cfg->is_fgless) {                                        \
-			for (uint8_t y = 0U; y < glyphHeight; y++) {                                                                   \
+			for (uint8_t y = 0U; y < ctx->glyphHeight; y++) {                                                              \
 				/* y: input row, j: first output row after scaling */                                                  \
-				j                         = (unsigned short int) (y * FONTSIZE_MULT);                                  \
+				j                         = (unsigned short int) (y * ctx->FONTSIZE_MULT);                             \
 				cy                        = (unsigned short int) (y_offs + j);                                         \
 				/* First column might be fg or bg, but we're precomputing it anyway */                                 \
 				uint8_t px_count          = 1U;                                                                        \
@@ -1915,7 +1983,7 @@ static struct mxcfb_rect
 				/* Precompute the initial coordinates for the first column of that glyph row */                        \
 				i                         = 0U;                                                                        \
 				cx                        = x_offs;                                                                    \
-				for (uint8_t x = 0U; x < glyphWidth; x++) {                                                            \
+				for (uint8_t x = 0U; x < ctx->glyphWidth; x++) {                                                       \
 					/* Each element encodes a full row, we access a column's bit in that row by shifting. */       \
 					if (bitmap[y] & 1U << x) {                                                                     \
 						/* bit was set, pixel is fg! */                                                        \
@@ -1927,11 +1995,12 @@ static struct mxcfb_rect
 							/* Handle scaling by drawing a FONTSIZE_MULT pixels high rectangle, batched */ \
 							/* in a FONTSIZE_MULT * px_count wide stripe per same-color streak ;) */       \
 							/* Note that we're printing the *previous* color's stripe, so, bg! */          \
-							(*fxpFillRectChecked)(                                                         \
+							(*ctx->fxpFillRectChecked)(                                                    \
+							    ctx,                                                                       \
 							    cx,                                                                        \
 							    cy,                                                                        \
-							    (unsigned short int) (FONTSIZE_MULT * px_count),                           \
-							    FONTSIZE_MULT,                                                             \
+							    (unsigned short int) (ctx->FONTSIZE_MULT * px_count),                      \
+							    ctx->FONTSIZE_MULT,                                                        \
 							    &bgP);                                                                     \
 							/* Which means we're already one pixel deep into a new stripe */               \
 							px_count          = 1U;                                                        \
@@ -1946,11 +2015,12 @@ static struct mxcfb_rect
 							initial_stripe_px = false;                                                     \
 						} else if (last_px_type == 1) {                                                        \
 							/* Note that we're printing the *previous* color's stripe, so, fg! */          \
-							(*fxpFillRectChecked)(                                                         \
+							(*ctx->fxpFillRectChecked)(                                                    \
+							    ctx,                                                                       \
 							    cx,                                                                        \
 							    cy,                                                                        \
-							    (unsigned short int) (FONTSIZE_MULT * px_count),                           \
-							    FONTSIZE_MULT,                                                             \
+							    (unsigned short int) (ctx->FONTSIZE_MULT * px_count),                      \
+							    ctx->FONTSIZE_MULT,                                                        \
 							    &fgP);                                                                     \
 							px_count          = 1U;                                                        \
 							initial_stripe_px = true;                                                      \
@@ -1960,7 +2030,7 @@ static struct mxcfb_rect
 					/* If we're the first pixel of a new stripe, compute the coordinates of the stripe's start */  \
 					if (initial_stripe_px) {                                                                       \
 						/* x: input column, i: first output column after scaling */                            \
-						i  = (unsigned short int) (x * FONTSIZE_MULT);                                         \
+						i  = (unsigned short int) (x * ctx->FONTSIZE_MULT);                                    \
 						/* Initial coordinates, before we generate the extra pixels from the scaling factor */ \
 						cx = (unsigned short int) (x_offs + i);                                                \
 					}                                                                                              \
@@ -1968,29 +2038,33 @@ static struct mxcfb_rect
 				/* Draw the final fg stripe of the glyph row no matter what */                                         \
 				/* If last_px_type != -1, we're sure px_count > 0U ;) */                                               \
 				if (last_px_type == 1) {                                                                               \
-					(*fxpFillRectChecked)(cx,                                                                      \
-							      cy,                                                                      \
-							      (unsigned short int) (FONTSIZE_MULT * px_count),                         \
-							      FONTSIZE_MULT,                                                           \
-							      &fgP);                                                                   \
+					(*ctx->fxpFillRectChecked)(                                                                    \
+					    ctx,                                                                                       \
+					    cx,                                                                                        \
+					    cy,                                                                                        \
+					    (unsigned short int) (ctx->FONTSIZE_MULT * px_count),                                      \
+					    ctx->FONTSIZE_MULT,                                                                        \
+					    &fgP);                                                                                     \
 				} else if (last_px_type == 0) {                                                                        \
-					(*fxpFillRectChecked)(cx,                                                                      \
-							      cy,                                                                      \
-							      (unsigned short int) (FONTSIZE_MULT * px_count),                         \
-							      FONTSIZE_MULT,                                                           \
-							      &bgP);                                                                   \
+					(*ctx->fxpFillRectChecked)(                                                                    \
+					    ctx,                                                                                       \
+					    cx,                                                                                        \
+					    cy,                                                                                        \
+					    (unsigned short int) (ctx->FONTSIZE_MULT * px_count),                                      \
+					    ctx->FONTSIZE_MULT,                                                                        \
+					    &bgP);                                                                                     \
 				}                                                                                                      \
 			}                                                                                                              \
 		} else {                                                                                                               \
 			FBInkPixel fbP     = { 0U };                                                                                   \
 			bool       is_fgpx = false;                                                                                    \
-			for (uint8_t y = 0U; y < glyphHeight; y++) {                                                                   \
+			for (uint8_t y = 0U; y < ctx->glyphHeight; y++) {                                                              \
 				/* y: input row, j: first output row after scaling */                                                  \
-				j  = (unsigned short int) (y * FONTSIZE_MULT);                                                         \
+				j  = (unsigned short int) (y * ctx->FONTSIZE_MULT);                                                    \
 				cy = (unsigned short int) (y_offs + j);                                                                \
-				for (uint8_t x = 0U; x < glyphWidth; x++) {                                                            \
+				for (uint8_t x = 0U; x < ctx->glyphWidth; x++) {                                                       \
 					/* x: input column, i: first output column after scaling */                                    \
-					i = (unsigned short int) (x * FONTSIZE_MULT);                                                  \
+					i = (unsigned short int) (x * ctx->FONTSIZE_MULT);                                             \
 					/* Each element encodes a full row, we access a column's bit in that row by shifting. */       \
 					if (bitmap[y] & 1U << x) {                                                                     \
 						/* bit was set, pixel is fg! */                                                        \
@@ -2004,24 +2078,24 @@ static struct mxcfb_rect
 					/* Initial coordinates, before we generate the extra pixels from the scaling factor */         \
 					cx = (unsigned short int) (x_offs + i);                                                        \
 					/* NOTE: Apply our scaling factor in both dimensions! */                                       \
-					for (uint8_t l = 0U; l < FONTSIZE_MULT; l++) {                                                 \
+					for (uint8_t l = 0U; l < ctx->FONTSIZE_MULT; l++) {                                            \
 						coords.y = (unsigned short int) (cy + l);                                              \
-						for (uint8_t k = 0U; k < FONTSIZE_MULT; k++) {                                         \
+						for (uint8_t k = 0U; k < ctx->FONTSIZE_MULT; k++) {                                    \
 							coords.x = (unsigned short int) (cx + k);                                      \
 							/* In overlay mode, we only print foreground pixels, */                        \
 							/* and we print in the inverse color of the underlying pixel's */              \
 							/* Obviously, the closer we get to GRAY7, the less contrast we get */          \
 							if (is_fgpx && !fbink_cfg->is_fgless) {                                        \
 								if (fbink_cfg->is_overlay) {                                           \
-									get_pixel(coords, &fbP);                                       \
+									get_pixel(ctx, coords, &fbP);                                  \
 									fbP.p ^= 0x00FFFFFFu;                                          \
 									pxP    = &fbP;                                                 \
-									put_pixel(coords, pxP, false);                                 \
+									put_pixel(ctx, coords, pxP, false);                            \
 								} else {                                                               \
-									put_pixel(coords, pxP, true);                                  \
+									put_pixel(ctx, coords, pxP, true);                             \
 								}                                                                      \
 							} else if (!is_fgpx && fbink_cfg->is_fgless) {                                 \
-								put_pixel(coords, pxP, true);                                          \
+								put_pixel(ctx, coords, pxP, true);                                     \
 							}                                                                              \
 						}                                                                                      \
 					}                                                                                              \
@@ -2033,13 +2107,13 @@ static struct mxcfb_rect
 			if (ch == 0x20u) {
 				// Unless we're not printing bg pixels, of course ;).
 				if (!fbink_cfg->is_overlay && !fbink_cfg->is_bgless) {
-					(*fxpFillRectChecked)(x_offs, y_offs, FONTW, FONTH, &bgP);
+					(*ctx->fxpFillRectChecked)(ctx, x_offs, y_offs, ctx->FONTW, ctx->FONTH, &bgP);
 				}
 			} else {
 				// Get the glyph's pixmap (width <= 8 -> uint8_t)
 				const unsigned char* restrict bitmap = NULL;
 #	ifdef FBINK_WITH_FONTS
-				bitmap = (*fxpFont8xGetBitmap)(ch);
+				bitmap = (*ctx->fxpFont8xGetBitmap)(ch);
 #	else
 			bitmap = font8x8_get_bitmap(ch);
 #	endif
@@ -2056,7 +2130,7 @@ static struct mxcfb_rect
 			ci++;
 		}
 #	ifdef FBINK_WITH_FONTS
-	} else if (glyphWidth <= 16) {
+	} else if (ctx->glyphWidth <= 16) {
 		while ((ch = u8_nextchar2(text, &bi)) != 0U) {
 			LOG("Char %.*zu out of %.*zu is @ byte offset %.*zu and is U+%04X (%s)",
 			    pad_len,
@@ -2069,7 +2143,7 @@ static struct mxcfb_rect
 			    u8_cp_to_utf8(ch));
 
 			// Update the x coordinates for this character
-			const unsigned short int x_offs = (unsigned short int) (x_base_offs + (ci * FONTW));
+			const unsigned short int x_offs = (unsigned short int) (x_base_offs + (ci * ctx->FONTW));
 			// Remember the next char's byte offset for next iteration's logging
 			ch_bi                           = bi;
 
@@ -2077,12 +2151,12 @@ static struct mxcfb_rect
 			if (ch == 0x20u) {
 				// Unless we're not printing bg pixels, of course ;).
 				if (!fbink_cfg->is_overlay && !fbink_cfg->is_bgless) {
-					(*fxpFillRectChecked)(x_offs, y_offs, FONTW, FONTH, &bgP);
+					(*ctx->fxpFillRectChecked)(ctx, x_offs, y_offs, ctx->FONTW, ctx->FONTH, &bgP);
 				}
 			} else {
 				// Get the glyph's pixmap (width <= 16 -> uint16_t)
 				const uint16_t* restrict bitmap = NULL;
-				bitmap                          = (*fxpFont16xGetBitmap)(ch);
+				bitmap                          = (*ctx->fxpFont16xGetBitmap)(ch);
 
 				// Render, scale & plot!
 				RENDER_GLYPH();
@@ -2091,7 +2165,7 @@ static struct mxcfb_rect
 			// Next glyph! This serves as the source for the pen position, hence it being used as an index...
 			ci++;
 		}
-	} else if (glyphWidth <= 32) {
+	} else if (ctx->glyphWidth <= 32) {
 		while ((ch = u8_nextchar2(text, &bi)) != 0U) {
 			LOG("Char %.*zu out of %.*zu is @ byte offset %.*zu and is U+%04X (%s)",
 			    pad_len,
@@ -2104,7 +2178,7 @@ static struct mxcfb_rect
 			    u8_cp_to_utf8(ch));
 
 			// Update the x coordinates for this character
-			const unsigned short int x_offs = (unsigned short int) (x_base_offs + (ci * FONTW));
+			const unsigned short int x_offs = (unsigned short int) (x_base_offs + (ci * ctx->FONTW));
 			// Remember the next char's byte offset for next iteration's logging
 			ch_bi                           = bi;
 
@@ -2112,12 +2186,12 @@ static struct mxcfb_rect
 			if (ch == 0x20u) {
 				// Unless we're not printing bg pixels, of course ;).
 				if (!fbink_cfg->is_overlay && !fbink_cfg->is_bgless) {
-					(*fxpFillRectChecked)(x_offs, y_offs, FONTW, FONTH, &bgP);
+					(*ctx->fxpFillRectChecked)(ctx, x_offs, y_offs, ctx->FONTW, ctx->FONTH, &bgP);
 				}
 			} else {
 				// Get the glyph's pixmap (width <= 32 -> uint32_t)
 				const uint32_t* restrict bitmap = NULL;
-				bitmap                          = (*fxpFont32xGetBitmap)(ch);
+				bitmap                          = (*ctx->fxpFont32xGetBitmap)(ch);
 
 				// Render, scale & plot!
 				RENDER_GLYPH();
@@ -2182,17 +2256,38 @@ static struct mxcfb_rect
 // NOTE: Fun fact, waiting for a FULL update is hardly any longer than waiting for a PARTIAL one.
 //       Apparently, the gist of the differences lies in the waveform mode, not the update mode or the region size.
 static __attribute__((cold)) long int
-    jiffies_to_ms(long int jiffies)
+    jiffies_to_ms(FBInkContext* restrict ctx, long int jiffies)
 {
 	// We need the Kernel's clock tick frequency for this, which we stored in USER_HZ during fbink_init ;).
-	return (jiffies * 1000 / USER_HZ);
+	return (jiffies * 1000 / ctx->USER_HZ);
+}
+
+// If we're presenting a hardware alternate buffer (c.f., fbink_present_surface),
+// fill in the alternate buffer data of an update request, so that the EPDC updates from there instead of the fb.
+// Returns the flags to add to said update request.
+static uint32_t
+    set_alt_buffer_data(FBInkContext* restrict ctx,
+			const struct mxcfb_rect region,
+			struct mxcfb_alt_buffer_data* restrict alt_buffer_data)
+{
+	if (ctx->altBufferAddr == 0U) {
+		return 0U;
+	}
+
+	// NOTE: The alternate update region has to match the update region.
+	alt_buffer_data->phys_addr         = ctx->altBufferAddr;
+	alt_buffer_data->width             = ctx->vInfo.xres_virtual;
+	alt_buffer_data->height            = ctx->vInfo.yres;
+	alt_buffer_data->alt_update_region = region;
+
+	return EPDC_FLAG_USE_ALT_BUFFER;
 }
 
 // Handle the various eInk update API quirks for the full range of HW we support...
 #	if defined(FBINK_FOR_KINDLE)
 // Legacy Kindle devices ([K2<->K4])
 static int
-    refresh_legacy(int fbfd, const struct mxcfb_rect region, bool is_flashing)
+    refresh_legacy(FBInkContext* restrict ctx, int fbfd, const struct mxcfb_rect region, bool is_flashing)
 {
 	struct update_area_t area = {
 		.x1       = (int) region.left,
@@ -2209,7 +2304,7 @@ static int
 	//       and it really is what the framework itself uses...
 	int  rv;
 	bool is_fs = false;
-	if (region.width == vInfo.xres && region.height == vInfo.yres) {
+	if (region.width == ctx->vInfo.xres && region.height == ctx->vInfo.yres) {
 		// NOTE: In the hopes that UPDATE_DISPLAY is less finicky,
 		//       we use it instead when area covers the full screen.
 		LOG("Detected a full-screen area, upgrading to FBIO_EINK_UPDATE_DISPLAY");
@@ -2233,7 +2328,7 @@ static int
 
 // All mxcfb Kindle devices ([K5<->??)
 static int
-    wait_for_submission_kindle(int fbfd, uint32_t marker)
+    wait_for_submission_kindle(FBInkContext* restrict ctx, int fbfd, uint32_t marker)
 {
 	int rv = ioctl(fbfd, MXCFB_WAIT_FOR_UPDATE_SUBMISSION, &marker);
 
@@ -2245,7 +2340,7 @@ static int
 			LOG("Update %u has already fully been submitted", marker);
 		} else {
 			// NOTE: Timeout is set to 5000ms
-			LOG("Waited %ldms for submission of update %u", (5000 - jiffies_to_ms(rv)), marker);
+			LOG("Waited %ldms for submission of update %u", (5000 - jiffies_to_ms(ctx, rv)), marker);
 		}
 	}
 
@@ -2254,12 +2349,12 @@ static int
 
 // Touch Kindle devices ([K5<->]KOA2)
 static int
-    refresh_kindle(int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
+    refresh_kindle(FBInkContext* restrict ctx, int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
 {
 	// Handle the common waveform_mode/update_mode switcheroo...
 	const uint32_t waveform_mode = (fbink_cfg->is_flashing && fbink_cfg->wfm_mode == WFM_AUTO)
-					   ? get_wfm_mode(WFM_GC16)
-					   : get_wfm_mode(fbink_cfg->wfm_mode);
+					   ? get_wfm_mode(ctx, WFM_GC16)
+					   : get_wfm_mode(ctx, fbink_cfg->wfm_mode);
 	const uint32_t update_mode   = fbink_cfg->is_flashing ? UPDATE_MODE_FULL : UPDATE_MODE_PARTIAL;
 
 	// NOTE: The hist_* fields are probably used to color the final decision AUTO will take,
@@ -2268,7 +2363,7 @@ static int
 		.update_region         = region,
 		.waveform_mode         = waveform_mode,
 		.update_mode           = update_mode,
-		.update_marker         = lastMarker,
+		.update_marker         = ctx->lastMarker,
 		.hist_bw_waveform_mode = (waveform_mode == WAVEFORM_MODE_REAGL) ? WAVEFORM_MODE_REAGL : WAVEFORM_MODE_DU,
 		.hist_gray_waveform_mode =
 		    (waveform_mode == WAVEFORM_MODE_REAGL) ? WAVEFORM_MODE_REAGL : WAVEFORM_MODE_GC16_FAST,
@@ -2279,7 +2374,7 @@ static int
 		.alt_buffer_data = { 0U },
 	};
 
-	if (fbink_cfg->is_nightmode && deviceQuirks.canHWInvert) {
+	if (fbink_cfg->is_nightmode && ctx->deviceQuirks.canHWInvert) {
 		update.flags |= EPDC_FLAG_ENABLE_INVERSION;
 	}
 
@@ -2301,6 +2396,9 @@ static int
 		}
 	}
 
+	// Update from a hardware alternate buffer instead of the front buffer, if we're presenting one
+	update.flags |= set_alt_buffer_data(ctx, region, &update.alt_buffer_data);
+
 	int rv = ioctl(fbfd, MXCFB_SEND_UPDATE, &update);
 
 	if (rv < 0) {
@@ -2328,7 +2426,7 @@ static int
 
 // Touch Kindle devices with a Pearl screen ([K5<->PW1])
 static int
-    wait_for_complete_kindle_pearl(int fbfd, uint32_t marker)
+    wait_for_complete_kindle_pearl(FBInkContext* restrict ctx, int fbfd, uint32_t marker)
 {
 	int rv = ioctl(fbfd, MXCFB_WAIT_FOR_UPDATE_COMPLETE_PEARL, &marker);
 
@@ -2340,7 +2438,7 @@ static int
 			LOG("Update %u has already fully been completed", marker);
 		} else {
 			// NOTE: Timeout is set to 5000ms
-			LOG("Waited %ldms for completion of update %u", (5000 - jiffies_to_ms(rv)), marker);
+			LOG("Waited %ldms for completion of update %u", (5000 - jiffies_to_ms(ctx, rv)), marker);
 		}
 	}
 
@@ -2349,7 +2447,7 @@ static int
 
 // Touch Kindle devices with a Carta screen ([PW2<->??)
 static int
-    wait_for_complete_kindle(int fbfd, uint32_t marker)
+    wait_for_complete_kindle(FBInkContext* restrict ctx, int fbfd, uint32_t marker)
 {
 	struct mxcfb_update_marker_data update_marker = {
 		.update_marker  = marker,
@@ -2365,7 +2463,7 @@ static int
 			LOG("Update %u has already fully been completed", marker);
 		} else {
 			// NOTE: Timeout is set to 5000ms
-			LOG("Waited %ldms for completion of update %u", (5000 - jiffies_to_ms(rv)), marker);
+			LOG("Waited %ldms for completion of update %u", (5000 - jiffies_to_ms(ctx, rv)), marker);
 		}
 	}
 
@@ -2374,12 +2472,15 @@ static int
 
 // Kindle Oasis 2 & Oasis 3 ([KOA2<->KOA3])
 static int
-    refresh_kindle_zelda(int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
+    refresh_kindle_zelda(FBInkContext* restrict ctx,
+			 int                     fbfd,
+			 const struct mxcfb_rect region,
+			 const FBInkConfig*      fbink_cfg)
 {
 	// Handle the common waveform_mode/update_mode switcheroo...
 	const uint32_t waveform_mode = (fbink_cfg->is_flashing && fbink_cfg->wfm_mode == WFM_AUTO)
-					   ? get_wfm_mode(WFM_GC16)
-					   : get_wfm_mode(fbink_cfg->wfm_mode);
+					   ? get_wfm_mode(ctx, WFM_GC16)
+					   : get_wfm_mode(ctx, fbink_cfg->wfm_mode);
 	// NOTE: The caller is responsible for honoring the expected wfm + mode pairings, if any.
 	//       e.g., REAGL should always be paired with FULL.
 	const uint32_t update_mode   = fbink_cfg->is_flashing ? UPDATE_MODE_FULL : UPDATE_MODE_PARTIAL;
@@ -2398,7 +2499,7 @@ static int
 		.update_region   = region,
 		.waveform_mode   = waveform_mode,
 		.update_mode     = update_mode,
-		.update_marker   = lastMarker,
+		.update_marker   = ctx->lastMarker,
 		.temp            = TEMP_USE_AMBIENT,
 		.flags           = (waveform_mode == WAVEFORM_MODE_ZELDA_GLD16) ? EPDC_FLAG_USE_ZELDA_REGAL
 				   : (waveform_mode == WAVEFORM_MODE_ZELDA_A2)  ? EPDC_FLAG_FORCE_MONOCHROME
@@ -2417,7 +2518,7 @@ static int
 		.ts_epdc = 0U,
 	};
 
-	if (fbink_cfg->is_nightmode && deviceQuirks.canHWInvert) {
+	if (fbink_cfg->is_nightmode && ctx->deviceQuirks.canHWInvert) {
 		update.flags |= EPDC_FLAG_ENABLE_INVERSION;
 	}
 
@@ -2441,6 +2542,9 @@ static int
 		// NOTE: EPDC_FLAG_USE_DITHERING_Y2 is gone on Zelda/Rex.
 	}
 
+	// Update from a hardware alternate buffer instead of the front buffer, if we're presenting one
+	update.flags |= set_alt_buffer_data(ctx, region, &update.alt_buffer_data);
+
 	int rv = ioctl(fbfd, MXCFB_SEND_UPDATE_ZELDA, &update);
 
 	if (rv < 0) {
@@ -2468,12 +2572,12 @@ static int
 
 // Kindle PaperWhite 4 & Basic 3 ([PW4<->KT4])
 static int
-    refresh_kindle_rex(int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
+    refresh_kindle_rex(FBInkContext* restrict ctx, int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
 {
 	// Handle the common waveform_mode/update_mode switcheroo...
 	const uint32_t waveform_mode = (fbink_cfg->is_flashing && fbink_cfg->wfm_mode == WFM_AUTO)
-					   ? get_wfm_mode(WFM_GC16)
-					   : get_wfm_mode(fbink_cfg->wfm_mode);
+					   ? get_wfm_mode(ctx, WFM_GC16)
+					   : get_wfm_mode(ctx, fbink_cfg->wfm_mode);
 	// NOTE: The caller is responsible for honoring the expected wfm + mode pairings, if any.
 	//       e.g., REAGL should always be paired with FULL.
 	const uint32_t update_mode   = fbink_cfg->is_flashing ? UPDATE_MODE_FULL : UPDATE_MODE_PARTIAL;
@@ -2493,7 +2597,7 @@ static int
 		.update_region   = region,
 		.waveform_mode   = waveform_mode,
 		.update_mode     = update_mode,
-		.update_marker   = lastMarker,
+		.update_marker   = ctx->lastMarker,
 		.temp            = TEMP_USE_AMBIENT,
 		.flags           = (waveform_mode == WAVEFORM_MODE_ZELDA_GLD16) ? EPDC_FLAG_USE_ZELDA_REGAL
 				   : (waveform_mode == WAVEFORM_MODE_ZELDA_A2)  ? EPDC_FLAG_FORCE_MONOCHROME
@@ -2510,7 +2614,7 @@ static int
 		    (waveform_mode == WAVEFORM_MODE_ZELDA_REAGL) ? WAVEFORM_MODE_ZELDA_REAGL : WAVEFORM_MODE_GC16,
 	};
 
-	if (fbink_cfg->is_nightmode && deviceQuirks.canHWInvert) {
+	if (fbink_cfg->is_nightmode && ctx->deviceQuirks.canHWInvert) {
 		update.flags |= EPDC_FLAG_ENABLE_INVERSION;
 	}
 
@@ -2533,6 +2637,9 @@ static int
 		// NOTE: EPDC_FLAG_USE_DITHERING_Y2 is gone on Zelda/Rex.
 	}
 
+	// Update from a hardware alternate buffer instead of the front buffer, if we're presenting one
+	update.flags |= set_alt_buffer_data(ctx, region, &update.alt_buffer_data);
+
 	int rv = ioctl(fbfd, MXCFB_SEND_UPDATE_REX, &update);
 
 	if (rv < 0) {
@@ -2560,12 +2667,12 @@ static int
 
 // Kindle PaperWhite 5, Basic 4, Scribe, Basic 5, PaperWhite 6, ColorSoft, Scribe 2 ([PW5<->??)
 static int
-    refresh_kindle_mtk(int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
+    refresh_kindle_mtk(FBInkContext* restrict ctx, int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
 {
 	// Handle the common waveform_mode/update_mode switcheroo...
 	const uint32_t waveform_mode = (fbink_cfg->is_flashing && fbink_cfg->wfm_mode == WFM_AUTO)
-					   ? get_wfm_mode(WFM_GC16)
-					   : get_wfm_mode(fbink_cfg->wfm_mode);
+					   ? get_wfm_mode(ctx, WFM_GC16)
+					   : get_wfm_mode(ctx, fbink_cfg->wfm_mode);
 	// NOTE: The caller is responsible for honoring the expected wfm + mode pairings, if any.
 	//       e.g., REAGL should always be paired with FULL.
 	const uint32_t update_mode   = fbink_cfg->is_flashing ? UPDATE_MODE_FULL : UPDATE_MODE_PARTIAL;
@@ -2578,7 +2685,7 @@ static int
 		.update_region   = region,
 		.waveform_mode   = waveform_mode,
 		.update_mode     = update_mode,
-		.update_marker   = lastMarker,
+		.update_marker   = ctx->lastMarker,
 		.temp            = TEMP_USE_AMBIENT,
 		.flags           = (waveform_mode == MTK_WAVEFORM_MODE_A2) ? EPDC_FLAG_FORCE_MONOCHROME : 0U,
 		.dither_mode     = EPDC_FLAG_USE_DITHERING_PASSTHROUGH,
@@ -2607,16 +2714,16 @@ static int
 		// NOTE: The MTK Driver will crash if given an area smaller than the number of steps:
 		//       i.e., if direction is L/R and w is smaller or if it is U/D and h is smaller.
 		bool sane_stride = false;
-		switch (mtkSwipeData.direction) {
+		switch (ctx->mtkSwipeData.direction) {
 			case MTK_SWIPE_DOWN:
 			case MTK_SWIPE_UP:
-				if (region.height >= mtkSwipeData.steps) {
+				if (region.height >= ctx->mtkSwipeData.steps) {
 					sane_stride = true;
 				}
 				break;
 			case MTK_SWIPE_LEFT:
 			case MTK_SWIPE_RIGHT:
-				if (region.width >= mtkSwipeData.steps) {
+				if (region.width >= ctx->mtkSwipeData.steps) {
 					sane_stride = true;
 				}
 				break;
@@ -2625,7 +2732,7 @@ static int
 		}
 
 		if (sane_stride) {
-			update.swipe_data    = mtkSwipeData;
+			update.swipe_data    = ctx->mtkSwipeData;
 			// Leave waveform_mode on AUTO, the kernel will internally switch to REAGL & P2SW as-needed.
 			update.waveform_mode = WAVEFORM_MODE_AUTO;
 			update.update_mode   = UPDATE_MODE_PARTIAL;
@@ -2642,7 +2749,7 @@ static int
 		// FIXME: When dither actually works, MONOCHROME + DITHER might actually be a viable combination...
 		update.flags &= (unsigned int) ~EPDC_FLAG_FORCE_MONOCHROME;
 
-		if (deviceQuirks.isKindleBellatrix4) {
+		if (ctx->deviceQuirks.isKindleBellatrix4) {
 			// Should work properly on Bellatrix4, where we also have proper Y1 support
 			if (waveform_mode == MTK_WAVEFORM_MODE_A2 || waveform_mode == MTK_WAVEFORM_MODE_DU) {
 				update.flags |= EPDC_FLAG_USE_DITHERING_Y1;    // Maps to MDP_DITHER_ALGO_Y8_Y1_S
@@ -2677,19 +2784,19 @@ static int
 // Cervantes devices
 // All of them support MX50 "compat" ioctls, much like Kobos.
 static int
-    refresh_cervantes(int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
+    refresh_cervantes(FBInkContext* restrict ctx, int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
 {
 	// Handle the common waveform_mode/update_mode switcheroo...
 	const uint32_t waveform_mode = (fbink_cfg->is_flashing && fbink_cfg->wfm_mode == WFM_AUTO)
-					   ? get_wfm_mode(WFM_GC16)
-					   : get_wfm_mode(fbink_cfg->wfm_mode);
+					   ? get_wfm_mode(ctx, WFM_GC16)
+					   : get_wfm_mode(ctx, fbink_cfg->wfm_mode);
 	const uint32_t update_mode   = fbink_cfg->is_flashing ? UPDATE_MODE_FULL : UPDATE_MODE_PARTIAL;
 
 	struct mxcfb_update_data update = {
 		.update_region   = region,
 		.waveform_mode   = waveform_mode,
 		.update_mode     = update_mode,
-		.update_marker   = lastMarker,
+		.update_marker   = ctx->lastMarker,
 		.temp            = TEMP_USE_AMBIENT,
 		.flags           = (waveform_mode == WAVEFORM_MODE_REAGLD) ? EPDC_FLAG_USE_AAD
 				   : (waveform_mode == WAVEFORM_MODE_A2)   ? EPDC_FLAG_FORCE_MONOCHROME
@@ -2697,7 +2804,7 @@ static int
 		.alt_buffer_data = { 0U },
 	};
 
-	if (fbink_cfg->is_nightmode && deviceQuirks.canHWInvert) {
+	if (fbink_cfg->is_nightmode && ctx->deviceQuirks.canHWInvert) {
 		update.flags |= EPDC_FLAG_ENABLE_INVERSION;
 	}
 
@@ -2717,6 +2824,9 @@ static int
 		}
 	}
 
+	// Update from a hardware alternate buffer instead of the front buffer, if we're presenting one
+	update.flags |= set_alt_buffer_data(ctx, region, &update.alt_buffer_data);
+
 	int rv = ioctl(fbfd, MXCFB_SEND_UPDATE, &update);
 
 	if (rv < 0) {
@@ -2739,7 +2849,7 @@ static int
 // NOTE: We *could* theoretically use MXCFB_WAIT_FOR_UPDATE_COMPLETE2 on 2013+ stuff (C2+)
 //       But, like on Kobo, don't bother, we'd gain nothing by switching anyway ;).
 static int
-    wait_for_complete_cervantes(int fbfd, uint32_t marker)
+    wait_for_complete_cervantes(FBInkContext* restrict ctx, int fbfd, uint32_t marker)
 {
 	int rv = ioctl(fbfd, MXCFB_WAIT_FOR_UPDATE_COMPLETE, &marker);
 
@@ -2751,7 +2861,7 @@ static int
 			LOG("Update %u has already fully been completed", marker);
 		} else {
 			// NOTE: Timeout is set to 5000ms
-			LOG("Waited %ldms for completion of update %u", (5000 - jiffies_to_ms(rv)), marker);
+			LOG("Waited %ldms for completion of update %u", (5000 - jiffies_to_ms(ctx, rv)), marker);
 		}
 	}
 
@@ -2759,12 +2869,12 @@ static int
 }
 #	elif defined(FBINK_FOR_REMARKABLE)
 static int
-    refresh_remarkable(int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
+    refresh_remarkable(FBInkContext* restrict ctx, int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
 {
 	// Handle the common waveform_mode/update_mode switcheroo...
 	const uint32_t waveform_mode = (fbink_cfg->is_flashing && fbink_cfg->wfm_mode == WFM_AUTO)
-					   ? get_wfm_mode(WFM_GC16)
-					   : get_wfm_mode(fbink_cfg->wfm_mode);
+					   ? get_wfm_mode(ctx, WFM_GC16)
+					   : get_wfm_mode(ctx, fbink_cfg->wfm_mode);
 	const uint32_t update_mode   = fbink_cfg->is_flashing ? UPDATE_MODE_FULL : UPDATE_MODE_PARTIAL;
 
 	// NOTE: Actually uses the V1 epdc driver, hence dither_mode & quant_bit being unused.
@@ -2772,7 +2882,7 @@ static int
 		.update_region   = region,
 		.waveform_mode   = waveform_mode,
 		.update_mode     = update_mode,
-		.update_marker   = lastMarker,
+		.update_marker   = ctx->lastMarker,
 		.temp            = (waveform_mode == WAVEFORM_MODE_DU) ? TEMP_USE_REMARKABLE : TEMP_USE_AMBIENT,
 		.flags           = (waveform_mode == WAVEFORM_MODE_A2) ? EPDC_FLAG_FORCE_MONOCHROME : 0U,
 		.dither_mode     = 0,
@@ -2780,7 +2890,7 @@ static int
 		.alt_buffer_data = { 0U }
 	};
 
-	if (fbink_cfg->is_nightmode && deviceQuirks.canHWInvert) {
+	if (fbink_cfg->is_nightmode && ctx->deviceQuirks.canHWInvert) {
 		update.flags |= EPDC_FLAG_ENABLE_INVERSION;
 	}
 
@@ -2797,6 +2907,9 @@ static int
 		}
 	}
 
+	// Update from a hardware alternate buffer instead of the front buffer, if we're presenting one
+	update.flags |= set_alt_buffer_data(ctx, region, &update.alt_buffer_data);
+
 	int rv = ioctl(fbfd, MXCFB_SEND_UPDATE, &update);
 
 	if (rv < 0) {
@@ -2817,7 +2930,7 @@ static int
 }
 
 static int
-    wait_for_complete_remarkable(int fbfd, uint32_t marker)
+    wait_for_complete_remarkable(FBInkContext* restrict ctx, int fbfd, uint32_t marker)
 {
 	struct mxcfb_update_marker_data update_data = { .update_marker = marker, .collision_test = 0U };
 	int                             rv          = ioctl(fbfd, MXCFB_WAIT_FOR_UPDATE_COMPLETE, &update_data);
@@ -2830,7 +2943,7 @@ static int
 			LOG("Update %u has already fully been completed", marker);
 		} else {
 			// NOTE: Timeout is set to 5000ms
-			LOG("Waited %ldms for completion of update %u", (5000 - jiffies_to_ms(rv)), marker);
+			LOG("Waited %ldms for completion of update %u", (5000 - jiffies_to_ms(ctx, rv)), marker);
 		}
 	}
 
@@ -2838,26 +2951,26 @@ static int
 }
 #	elif defined(FBINK_FOR_POCKETBOOK)
 static int
-    refresh_pocketbook(int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
+    refresh_pocketbook(FBInkContext* restrict ctx, int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
 {
 	// Handle the common waveform_mode/update_mode switcheroo...
 	const uint32_t waveform_mode = (fbink_cfg->is_flashing && fbink_cfg->wfm_mode == WFM_AUTO)
-					   ? get_wfm_mode(WFM_GC16)
-					   : get_wfm_mode(fbink_cfg->wfm_mode);
+					   ? get_wfm_mode(ctx, WFM_GC16)
+					   : get_wfm_mode(ctx, fbink_cfg->wfm_mode);
 	const uint32_t update_mode   = fbink_cfg->is_flashing ? UPDATE_MODE_FULL : UPDATE_MODE_PARTIAL;
 
 	// NOTE: Apparently benefits from the same trick as on rM of enforcing the 24°C table for DU
 	struct mxcfb_update_data update = { .update_region = region,
 					    .waveform_mode = waveform_mode,
 					    .update_mode   = update_mode,
-					    .update_marker = lastMarker,
+					    .update_marker = ctx->lastMarker,
 					    .temp          = (waveform_mode == WAVEFORM_MODE_DU) ? 24 : TEMP_USE_AMBIENT,
 					    .flags = (waveform_mode == WAVEFORM_MODE_REAGLD) ? EPDC_FLAG_USE_AAD
 						     : (waveform_mode == WAVEFORM_MODE_A2)   ? EPDC_FLAG_FORCE_MONOCHROME
 											     : 0U,
 					    .alt_buffer_data = { 0U } };
 
-	if (fbink_cfg->is_nightmode && deviceQuirks.canHWInvert) {
+	if (fbink_cfg->is_nightmode && ctx->deviceQuirks.canHWInvert) {
 		update.flags |= EPDC_FLAG_ENABLE_INVERSION;
 	}
 
@@ -2879,10 +2992,13 @@ static int
 
 	// NOTE: The MXCFB shim on devices with a B288 SoC does *NOT* support AUTO (and *will* throw an EINVAL).
 	//       Use GC16 instead to be conservative (this appears to be what InkView itself does).
-	if (deviceQuirks.isSunxi && waveform_mode == WAVEFORM_MODE_AUTO) {
+	if (ctx->deviceQuirks.isSunxi && waveform_mode == WAVEFORM_MODE_AUTO) {
 		update.waveform_mode = WAVEFORM_MODE_GC16;
 	}
 
+	// Update from a hardware alternate buffer instead of the front buffer, if we're presenting one
+	update.flags |= set_alt_buffer_data(ctx, region, &update.alt_buffer_data);
+
 	int rv = ioctl(fbfd, MXCFB_SEND_UPDATE, &update);
 
 	if (rv < 0) {
@@ -2903,7 +3019,7 @@ static int
 }
 
 static int
-    wait_for_complete_pocketbook(int fbfd, uint32_t marker)
+    wait_for_complete_pocketbook(FBInkContext* restrict ctx, int fbfd, uint32_t marker)
 {
 	// NOTE: Yes, some kernels will attempt to write back to the struct,
 	//       despite using an ioctl that should only read an uint32_t...
@@ -2919,7 +3035,7 @@ static int
 			LOG("Update %u has already fully been completed", marker);
 		} else {
 			// NOTE: Timeout is set to 5000ms
-			LOG("Waited %ldms for completion of update %u", (5000 - jiffies_to_ms(rv)), marker);
+			LOG("Waited %ldms for completion of update %u", (5000 - jiffies_to_ms(ctx, rv)), marker);
 		}
 	}
 
@@ -2928,12 +3044,12 @@ static int
 #	elif defined(FBINK_FOR_KOBO)
 // Kobo devices ([Mk3<->Mk6])
 static int
-    refresh_kobo(int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
+    refresh_kobo(FBInkContext* restrict ctx, int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
 {
 	// Handle the common waveform_mode/update_mode switcheroo...
 	const uint32_t waveform_mode = (fbink_cfg->is_flashing && fbink_cfg->wfm_mode == WFM_AUTO)
-					   ? get_wfm_mode(WFM_GC16)
-					   : get_wfm_mode(fbink_cfg->wfm_mode);
+					   ? get_wfm_mode(ctx, WFM_GC16)
+					   : get_wfm_mode(ctx, fbink_cfg->wfm_mode);
 	// NOTE: The caller is responsible for honoring the expected wfm + mode pairings, if any.
 	//       e.g., REAGLD, which is only ever used and implemented "properly" on the original Aura,
 	//       should always be paired with FULL.
@@ -2943,7 +3059,7 @@ static int
 		.update_region   = region,
 		.waveform_mode   = waveform_mode,
 		.update_mode     = update_mode,
-		.update_marker   = lastMarker,
+		.update_marker   = ctx->lastMarker,
 		.temp            = TEMP_USE_AMBIENT,
 		.flags           = (waveform_mode == WAVEFORM_MODE_REAGLD) ? EPDC_FLAG_USE_AAD
 				   : (waveform_mode == WAVEFORM_MODE_A2)   ? EPDC_FLAG_FORCE_MONOCHROME
@@ -2951,7 +3067,7 @@ static int
 		.alt_buffer_data = { 0U },
 	};
 
-	if (fbink_cfg->is_nightmode && deviceQuirks.canHWInvert) {
+	if (fbink_cfg->is_nightmode && ctx->deviceQuirks.canHWInvert) {
 		update.flags |= EPDC_FLAG_ENABLE_INVERSION;
 	}
 
@@ -2974,6 +3090,15 @@ static int
 		}
 	}
 
+	// Update from a hardware alternate buffer instead of the front buffer, if we're presenting one
+	// NOTE: The NTX flavor of the struct only differs by a leading (unused) virt_addr field.
+	struct mxcfb_alt_buffer_data alt_buffer_data = { 0U };
+	update.flags |= set_alt_buffer_data(ctx, region, &alt_buffer_data);
+	update.alt_buffer_data.phys_addr         = alt_buffer_data.phys_addr;
+	update.alt_buffer_data.width             = alt_buffer_data.width;
+	update.alt_buffer_data.height            = alt_buffer_data.height;
+	update.alt_buffer_data.alt_update_region = alt_buffer_data.alt_update_region;
+
 	int rv = ioctl(fbfd, MXCFB_SEND_UPDATE_V1_NTX, &update);
 
 	if (rv < 0) {
@@ -2994,7 +3119,7 @@ static int
 }
 
 static int
-    wait_for_complete_kobo(int fbfd, uint32_t marker)
+    wait_for_complete_kobo(FBInkContext* restrict ctx, int fbfd, uint32_t marker)
 {
 	int rv = ioctl(fbfd, MXCFB_WAIT_FOR_UPDATE_COMPLETE_V1, &marker);
 
@@ -3005,12 +3130,12 @@ static int
 		if (rv == 0) {
 			LOG("Update %u has already fully been completed", marker);
 		} else {
-			if (strcmp(deviceQuirks.devicePlatform, "Mark 4") <= 0) {
+			if (strcmp(ctx->deviceQuirks.devicePlatform, "Mark 4") <= 0) {
 				// NOTE: Timeout is set to 5000ms on older devices
-				LOG("Waited %ldms for completion of update %u", (5000 - jiffies_to_ms(rv)), marker);
+				LOG("Waited %ldms for completion of update %u", (5000 - jiffies_to_ms(ctx, rv)), marker);
 			} else {
 				// NOTE: Timeout is set to 10000ms
-				LOG("Waited %ldms for completion of update %u", (10000 - jiffies_to_ms(rv)), marker);
+				LOG("Waited %ldms for completion of update %u", (10000 - jiffies_to_ms(ctx, rv)), marker);
 			}
 		}
 	}
@@ -3020,7 +3145,7 @@ static int
 
 // Kobo Mark 7+ devices on i.MX SoCs (Mk7, Mk9, Mk10)
 static int
-    refresh_kobo_mk7(int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
+    refresh_kobo_mk7(FBInkContext* restrict ctx, int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
 {
 	// NOTE: On Mk. 7 devices, for reasons that are unclear (and under circumstances which are equally unclear),
 	//       the EPDC may repeatedly ignore the requested flags and/or dither_mode...
@@ -3058,8 +3183,8 @@ static int
 
 	// Handle the common waveform_mode/update_mode switcheroo...
 	const uint32_t waveform_mode = (fbink_cfg->is_flashing && fbink_cfg->wfm_mode == WFM_AUTO)
-					   ? get_wfm_mode(WFM_GC16)
-					   : get_wfm_mode(fbink_cfg->wfm_mode);
+					   ? get_wfm_mode(ctx, WFM_GC16)
+					   : get_wfm_mode(ctx, fbink_cfg->wfm_mode);
 	// NOTE: The caller is responsible for honoring the expected wfm + mode pairings, if any.
 	//       e.g., REAGL should always be paired with *PARTIAL*.
 	//       This is in stark contrast with most other REAGL implementations!
@@ -3079,7 +3204,7 @@ static int
 		.update_region   = region,
 		.waveform_mode   = waveform_mode,
 		.update_mode     = update_mode,
-		.update_marker   = lastMarker,
+		.update_marker   = ctx->lastMarker,
 		.temp            = TEMP_USE_AMBIENT,
 		.flags           = (waveform_mode == WAVEFORM_MODE_GLD16) ? EPDC_FLAG_USE_REGAL
 				   : (waveform_mode == WAVEFORM_MODE_A2)  ? EPDC_FLAG_FORCE_MONOCHROME
@@ -3092,7 +3217,7 @@ static int
 		.alt_buffer_data = { 0U },
 	};
 
-	if (fbink_cfg->is_nightmode && deviceQuirks.canHWInvert) {
+	if (fbink_cfg->is_nightmode && ctx->deviceQuirks.canHWInvert) {
 		update.flags |= EPDC_FLAG_ENABLE_INVERSION;
 	}
 
@@ -3120,6 +3245,9 @@ static int
 		//       (even @ rota UR, where the q1 dithering pattern appears to be less obvious and much less glitchy).
 	}
 
+	// Update from a hardware alternate buffer instead of the front buffer, if we're presenting one
+	update.flags |= set_alt_buffer_data(ctx, region, &update.alt_buffer_data);
+
 	int rv = ioctl(fbfd, MXCFB_SEND_UPDATE_V2, &update);
 
 	if (rv < 0) {
@@ -3140,7 +3268,7 @@ static int
 }
 
 static int
-    wait_for_complete_kobo_mk7(int fbfd, uint32_t marker)
+    wait_for_complete_kobo_mk7(FBInkContext* restrict ctx, int fbfd, uint32_t marker)
 {
 	struct mxcfb_update_marker_data update_marker = {
 		.update_marker  = marker,
@@ -3156,7 +3284,7 @@ static int
 			LOG("Update %u has already fully been completed", marker);
 		} else {
 			// NOTE: Timeout is set to 5000ms
-			LOG("Waited %ldms for completion of update %u", (5000 - jiffies_to_ms(rv)), marker);
+			LOG("Waited %ldms for completion of update %u", (5000 - jiffies_to_ms(ctx, rv)), marker);
 		}
 	}
 
@@ -3167,7 +3295,7 @@ static int
 
 // Kobo Mark 8 devices ([Mk8<->??)
 static int
-    refresh_kobo_sunxi(const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
+    refresh_kobo_sunxi(FBInkContext* restrict ctx, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
 {
 	// NOTE: In case of issues, enable full verbosity in the DISP driver:
 	//       echo 8 >| /proc/sys/kernel/printk
@@ -3186,15 +3314,15 @@ static int
 
 	// Handle the common waveform_mode/update_mode switcheroo...
 	const uint32_t waveform_mode = (fbink_cfg->is_flashing && fbink_cfg->wfm_mode == WFM_AUTO)
-					   ? get_wfm_mode(WFM_GC16)
-					   : get_wfm_mode(fbink_cfg->wfm_mode);
+					   ? get_wfm_mode(ctx, WFM_GC16)
+					   : get_wfm_mode(ctx, fbink_cfg->wfm_mode);
 
 	sunxi_disp_eink_update2 update = { .area        = &area,
 					   .layer_num   = 1U,
 					   .update_mode = waveform_mode,
-					   .lyr_cfg2    = &sunxiCtx.layer,
-					   .frame_id    = &lastMarker,
-					   .rotate      = &sunxiCtx.rota,
+					   .lyr_cfg2    = &ctx->sunxiCtx.layer,
+					   .frame_id    = &ctx->lastMarker,
+					   .rotate      = &ctx->sunxiCtx.rota,
 					   .cfa_use     = 0U };
 
 	// Update mode shenanigans...
@@ -3239,17 +3367,17 @@ static int
 		}
 	}
 
-	int rv = ioctl(sunxiCtx.disp_fd, DISP_EINK_UPDATE2, &update);
+	int rv = ioctl(ctx->sunxiCtx.disp_fd, DISP_EINK_UPDATE2, &update);
 
 	if (rv < 0) {
 		// NOTE: The code flow is so funky that you can end up with a wide array of not necessarily
 		//       semantically meaningful errno values...
 		PFWARN("DISP_EINK_UPDATE2: %m");
 		WARN("screen_win={x=%d, y=%d, width=%u, height=%u}; update_region={top=%u, left=%u, width=%u, height=%u}",
-		     sunxiCtx.layer.info.screen_win.x,
-		     sunxiCtx.layer.info.screen_win.y,
-		     sunxiCtx.layer.info.screen_win.width,
-		     sunxiCtx.layer.info.screen_win.height,
+		     ctx->sunxiCtx.layer.info.screen_win.x,
+		     ctx->sunxiCtx.layer.info.screen_win.y,
+		     ctx->sunxiCtx.layer.info.screen_win.width,
+		     ctx->sunxiCtx.layer.info.screen_win.height,
 		     region.top,
 		     region.left,
 		     region.width,
@@ -3261,12 +3389,12 @@ static int
 }
 
 static int
-    wait_for_complete_kobo_sunxi(uint32_t marker)
+    wait_for_complete_kobo_sunxi(FBInkContext* restrict ctx, uint32_t marker)
 {
 	// Use the union to avoid passing garbage to the ioctl handler...
 	sunxi_disp_eink_ioctl cmd = { .wait_for.frame_id = marker };
 
-	int rv = ioctl(sunxiCtx.disp_fd, DISP_EINK_WAIT_FRAME_SYNC_COMPLETE, &cmd);
+	int rv = ioctl(ctx->sunxiCtx.disp_fd, DISP_EINK_WAIT_FRAME_SYNC_COMPLETE, &cmd);
 
 	if (rv < 0) {
 		PFWARN("DISP_EINK_WAIT_FRAME_SYNC_COMPLETE: %m");
@@ -3276,7 +3404,7 @@ static int
 			LOG("Update %u has already fully been completed", marker);
 		} else {
 			// NOTE: Timeout is set to 3000ms
-			LOG("Waited %ldms for completion of update %u", (3000 - jiffies_to_ms(rv)), marker);
+			LOG("Waited %ldms for completion of update %u", (3000 - jiffies_to_ms(ctx, rv)), marker);
 		}
 	}
 
@@ -3285,7 +3413,7 @@ static int
 
 // Kobo Mark 11 devices on MTK SoCs
 static int
-    refresh_kobo_mtk(int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
+    refresh_kobo_mtk(FBInkContext* restrict ctx, int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
 {
 	// NOTE: There appears to be a slightly different issue with refresh regions than what happened on Mk. 7 with dithering:
 	//       despite a perfectly sized & positioned region, the effective refresh *may*,
@@ -3294,8 +3422,8 @@ static int
 	//       consider enforcing aligning refresh coordinates & dimensions to multiples of 8 as described above...
 	// Handle the common waveform_mode/update_mode switcheroo...
 	const uint32_t waveform_mode = (fbink_cfg->is_flashing && fbink_cfg->wfm_mode == WFM_AUTO)
-					   ? get_wfm_mode(WFM_GC16)
-					   : get_wfm_mode(fbink_cfg->wfm_mode);
+					   ? get_wfm_mode(ctx, WFM_GC16)
+					   : get_wfm_mode(ctx, fbink_cfg->wfm_mode);
 	// NOTE: The caller is responsible for honoring the expected wfm + mode pairings, if any.
 	//       e.g., REAGL, GLRC16 & GCC16 should always be paired with FULL...
 	//       Except on the Elipsa 2E, which behaves like older Kobo devices, and expects PARTIAL...
@@ -3312,7 +3440,7 @@ static int
                                   .height = region.height },
 		.waveform_mode = waveform_mode,
 		.update_mode   = update_mode,
-		.update_marker = lastMarker,
+		.update_marker = ctx->lastMarker,
 		.flags         = 0U,
 		.dither_mode   = 0
 	};
@@ -3420,7 +3548,7 @@ static int
 }
 
 static int
-    wait_for_submission_kobo_mtk(int fbfd, uint32_t marker)
+    wait_for_submission_kobo_mtk(FBInkContext* restrict ctx, int fbfd, uint32_t marker)
 {
 	int rv = ioctl(fbfd, HWTCON_WAIT_FOR_UPDATE_SUBMISSION, &marker);
 
@@ -3432,7 +3560,7 @@ static int
 			LOG("Update %u has already fully been submitted", marker);
 		} else {
 			// NOTE: Timeout is set to 5000ms
-			LOG("Waited %ldms for submission of update %u", (5000 - jiffies_to_ms(rv)), marker);
+			LOG("Waited %ldms for submission of update %u", (5000 - jiffies_to_ms(ctx, rv)), marker);
 		}
 	}
 
@@ -3440,7 +3568,7 @@ static int
 }
 
 static int
-    wait_for_complete_kobo_mtk(int fbfd, uint32_t marker)
+    wait_for_complete_kobo_mtk(FBInkContext* restrict ctx, int fbfd, uint32_t marker)
 {
 	int rv = ioctl(fbfd, HWTCON_WAIT_FOR_UPDATE_COMPLETE, &marker);
 
@@ -3452,7 +3580,7 @@ static int
 			LOG("Update %u has already fully been completed", marker);
 		} else {
 			// NOTE: Timeout is set to 5000ms
-			LOG("Waited %ldms for completion of update %u", (5000 - jiffies_to_ms(rv)), marker);
+			LOG("Waited %ldms for completion of update %u", (5000 - jiffies_to_ms(ctx, rv)), marker);
 		}
 	}
 
@@ -3462,19 +3590,21 @@ static int
 #endif            // !FBINK_FOR_LINUX
 
 int
-    fbink_sunxi_toggle_ntx_pen_mode(int fbfd UNUSED_BY_NOTKOBO, bool toggle UNUSED_BY_NOTKOBO)
+    fbink_sunxi_toggle_ntx_pen_mode_ctx(FBInkContext* restrict ctx UNUSED_BY_NOTKOBO,
+					int fbfd                   UNUSED_BY_NOTKOBO,
+					bool toggle                UNUSED_BY_NOTKOBO)
 {
 #ifndef FBINK_FOR_KOBO
 	PFWARN("This feature is not supported on your device");
 	return ERRCODE(ENOSYS);
 #else
-	if (!deviceQuirks.isSunxi) {
+	if (!ctx->deviceQuirks.isSunxi) {
 		PFWARN("This feature is not supported on your device");
 		return ERRCODE(ENOSYS);
 	}
 
 	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -3482,8 +3612,8 @@ int
 	int rv = EXIT_SUCCESS;
 
 	// We need a disp fd...
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
@@ -3492,7 +3622,7 @@ int
 	// Use the union to avoid passing garbage to the ioctl handler...
 	sunxi_disp_eink_ioctl cmd = { .toggle_handw.enable = toggle };
 
-	rv = ioctl(sunxiCtx.disp_fd, DISP_EINK_SET_NTX_HANDWRITE_ONOFF, &cmd);
+	rv = ioctl(ctx->sunxiCtx.disp_fd, DISP_EINK_SET_NTX_HANDWRITE_ONOFF, &cmd);
 
 	if (rv < 0) {
 		PFWARN("DISP_EINK_SET_NTX_HANDWRITE_ONOFF: %m");
@@ -3502,11 +3632,11 @@ int
 
 	// Cleanup
 cleanup:
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -3514,15 +3644,22 @@ cleanup:
 }
 
 int
-    fbink_sunxi_ntx_enforce_rota(int fbfd                              UNUSED_BY_NOTKOBO,
-				 SUNXI_FORCE_ROTA_INDEX_T mode         UNUSED_BY_NOTKOBO,
-				 const FBInkConfig* restrict fbink_cfg UNUSED_BY_NOTKOBO)
+    fbink_sunxi_toggle_ntx_pen_mode(int fbfd, bool toggle)
+{
+	return fbink_sunxi_toggle_ntx_pen_mode_ctx(&defaultCtx, fbfd, toggle);
+}
+
+int
+    fbink_sunxi_ntx_enforce_rota_ctx(FBInkContext* restrict ctx            UNUSED_BY_NOTKOBO,
+				     int fbfd                              UNUSED_BY_NOTKOBO,
+				     SUNXI_FORCE_ROTA_INDEX_T mode         UNUSED_BY_NOTKOBO,
+				     const FBInkConfig* restrict fbink_cfg UNUSED_BY_NOTKOBO)
 {
 #ifndef FBINK_FOR_KOBO
 	PFWARN("This feature is not supported on your device");
 	return ERRCODE(ENOSYS);
 #else
-	if (!deviceQuirks.isSunxi) {
+	if (!ctx->deviceQuirks.isSunxi) {
 		PFWARN("This feature is not supported on your device");
 		return ERRCODE(ENOSYS);
 	}
@@ -3532,12 +3669,12 @@ int
 
 	// Check whether we can actually use the fbdamage modes...
 	if (mode == FORCE_ROTA_CURRENT_ROTA || mode == FORCE_ROTA_CURRENT_LAYOUT || mode == FORCE_ROTA_WORKBUF) {
-		if (!sunxiCtx.has_fbdamage) {
+		if (!ctx->sunxiCtx.has_fbdamage) {
 			WARN(
 			    "Unsupported fbdamage mode `%hhd` passed to fbink_sunxi_ntx_enforce_rota, keeping the current value: %hhd (%s)",
 			    mode,
-			    sunxiCtx.force_rota,
-			    sunxi_force_rota_to_string(sunxiCtx.force_rota));
+			    ctx->sunxiCtx.force_rota,
+			    sunxi_force_rota_to_string(ctx->sunxiCtx.force_rota));
 			rv = ERRCODE(ENOTSUP);
 			goto cleanup;
 		}
@@ -3554,23 +3691,23 @@ int
 		case FORCE_ROTA_UD:
 		case FORCE_ROTA_CCW:
 		case FORCE_ROTA_WORKBUF:
-			sunxiCtx.force_rota = mode;
+			ctx->sunxiCtx.force_rota = mode;
 			LOG("Set custom rotation handling mode to: %hhd (%s)",
-			    sunxiCtx.force_rota,
-			    sunxi_force_rota_to_string(sunxiCtx.force_rota));
+			    ctx->sunxiCtx.force_rota,
+			    sunxi_force_rota_to_string(ctx->sunxiCtx.force_rota));
 			break;
 		default:
 			WARN(
 			    "Invalid mode `%hhd` passed to fbink_sunxi_ntx_enforce_rota, keeping the current value: %hhd (%s)",
 			    mode,
-			    sunxiCtx.force_rota,
-			    sunxi_force_rota_to_string(sunxiCtx.force_rota));
+			    ctx->sunxiCtx.force_rota,
+			    sunxi_force_rota_to_string(ctx->sunxiCtx.force_rota));
 			rv = ERRCODE(EINVAL);
 			goto cleanup;
 	}
 
 	// Chain an fbink_reinit to make sure the new mode takes *immediately*.
-	return kobo_sunxi_reinit_check(fbfd, fbink_cfg);
+	return kobo_sunxi_reinit_check(ctx, fbfd, fbink_cfg);
 
 cleanup:
 	return rv;
@@ -3578,39 +3715,53 @@ cleanup:
 }
 
 int
-    fbink_mtk_set_swipe_data(MTK_SWIPE_DIRECTION_INDEX_T direction UNUSED_BY_NOTKINDLE, uint8_t steps UNUSED_BY_NOTKINDLE)
+    fbink_sunxi_ntx_enforce_rota(int fbfd, SUNXI_FORCE_ROTA_INDEX_T mode, const FBInkConfig* restrict fbink_cfg)
+{
+	return fbink_sunxi_ntx_enforce_rota_ctx(&defaultCtx, fbfd, mode, fbink_cfg);
+}
+
+int
+    fbink_mtk_set_swipe_data_ctx(FBInkContext* restrict ctx            UNUSED_BY_NOTKINDLE,
+				 MTK_SWIPE_DIRECTION_INDEX_T direction UNUSED_BY_NOTKINDLE,
+				 uint8_t steps                         UNUSED_BY_NOTKINDLE)
 {
 #ifndef FBINK_FOR_KINDLE
 	PFWARN("This feature is not supported on your device");
 	return ERRCODE(ENOSYS);
 #else
-	if (!deviceQuirks.isMTK) {
+	if (!ctx->deviceQuirks.isMTK) {
 		PFWARN("This feature is not supported on your device");
 		return ERRCODE(ENOSYS);
 	}
 
-	mtkSwipeData.direction = (uint32_t) direction;
-	mtkSwipeData.steps     = (uint32_t) steps;
+	ctx->mtkSwipeData.direction = (uint32_t) direction;
+	ctx->mtkSwipeData.steps     = (uint32_t) steps;
 
 	return EXIT_SUCCESS;
 #endif    // !FBINK_FOR_KINDLE
 }
 
 int
-    fbink_wait_for_any_complete(int fbfd UNUSED_BY_NOTKINDLE)
+    fbink_mtk_set_swipe_data(MTK_SWIPE_DIRECTION_INDEX_T direction, uint8_t steps)
+{
+	return fbink_mtk_set_swipe_data_ctx(&defaultCtx, direction, steps);
+}
+
+int
+    fbink_wait_for_any_complete_ctx(FBInkContext* restrict ctx UNUSED_BY_NOTKINDLE, int fbfd UNUSED_BY_NOTKINDLE)
 {
 #ifndef FBINK_FOR_KINDLE
 	PFWARN("This feature is not supported on your device");
 	return ERRCODE(ENOSYS);
 #else
-	if (!deviceQuirks.isMTK) {
+	if (!ctx->deviceQuirks.isMTK) {
 		PFWARN("This feature is not supported on your device");
 		return ERRCODE(ENOSYS);
 	}
 
 	bool keep_fd = true;
 	// Open the framebuffer if need be (nonblock, we'll only do ioctls)...
-	if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd_nonblock(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -3638,7 +3789,7 @@ int
 	}
 
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -3646,22 +3797,29 @@ int
 }
 
 int
-    fbink_mtk_set_halftone(int fbfd                       UNUSED_BY_NOTKINDLE,
-			   const FBInkRect                exclude_regions[2] UNUSED_BY_NOTKINDLE,
-			   MTK_HALFTONE_MODE_INDEX_T size UNUSED_BY_NOTKINDLE)
+    fbink_wait_for_any_complete(int fbfd)
+{
+	return fbink_wait_for_any_complete_ctx(&defaultCtx, fbfd);
+}
+
+int
+    fbink_mtk_set_halftone_ctx(FBInkContext* restrict ctx UNUSED_BY_NOTKINDLE,
+			       int fbfd                       UNUSED_BY_NOTKINDLE,
+			       const FBInkRect                exclude_regions[2] UNUSED_BY_NOTKINDLE,
+			       MTK_HALFTONE_MODE_INDEX_T size UNUSED_BY_NOTKINDLE)
 {
 #ifndef FBINK_FOR_KINDLE
 	PFWARN("This feature is not supported on your device");
 	return ERRCODE(ENOSYS);
 #else
-	if (!deviceQuirks.isMTK) {
+	if (!ctx->deviceQuirks.isMTK) {
 		PFWARN("This feature is not supported on your device");
 		return ERRCODE(ENOSYS);
 	}
 
 	bool keep_fd = true;
 	// Open the framebuffer if need be (nonblock, we'll only do ioctls)...
-	if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd_nonblock(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -3689,7 +3847,7 @@ int
 	}
 
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -3697,20 +3855,28 @@ int
 }
 
 int
-    fbink_mtk_toggle_auto_reagl(int fbfd UNUSED_BY_NOTKINDLE, bool toggle UNUSED_BY_NOTKINDLE)
+    fbink_mtk_set_halftone(int fbfd, const FBInkRect exclude_regions[2], MTK_HALFTONE_MODE_INDEX_T size)
+{
+	return fbink_mtk_set_halftone_ctx(&defaultCtx, fbfd, exclude_regions, size);
+}
+
+int
+    fbink_mtk_toggle_auto_reagl_ctx(FBInkContext* restrict ctx UNUSED_BY_NOTKINDLE,
+				    int fbfd                   UNUSED_BY_NOTKINDLE,
+				    bool toggle                UNUSED_BY_NOTKINDLE)
 {
 #ifndef FBINK_FOR_KINDLE
 	PFWARN("This feature is not supported on your device");
 	return ERRCODE(ENOSYS);
 #else
-	if (!deviceQuirks.isMTK) {
+	if (!ctx->deviceQuirks.isMTK) {
 		PFWARN("This feature is not supported on your device");
 		return ERRCODE(ENOSYS);
 	}
 
 	bool keep_fd = true;
 	// Open the framebuffer if need be (nonblock, we'll only do ioctls)...
-	if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd_nonblock(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -3730,7 +3896,7 @@ int
 	}
 
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -3738,21 +3904,29 @@ int
 }
 
 int
-    fbink_mtk_toggle_pen_mode(int fbfd UNUSED_BY_NOTKINDLE, bool toggle UNUSED_BY_NOTKINDLE)
+    fbink_mtk_toggle_auto_reagl(int fbfd, bool toggle)
+{
+	return fbink_mtk_toggle_auto_reagl_ctx(&defaultCtx, fbfd, toggle);
+}
+
+int
+    fbink_mtk_toggle_pen_mode_ctx(FBInkContext* restrict ctx UNUSED_BY_NOTKINDLE,
+				  int fbfd                   UNUSED_BY_NOTKINDLE,
+				  bool toggle                UNUSED_BY_NOTKINDLE)
 {
 #ifndef FBINK_FOR_KINDLE
 	PFWARN("This feature is not supported on your device");
 	return ERRCODE(ENOSYS);
 #else
 	// NOTE: Technically requires a Bellatrix3, will return HWTCON_STATUS_INVALID_IOCTL_CMD (-4) otherwise.
-	if (!deviceQuirks.isMTK) {
+	if (!ctx->deviceQuirks.isMTK) {
 		PFWARN("This feature is not supported on your device");
 		return ERRCODE(ENOSYS);
 	}
 
 	bool keep_fd = true;
 	// Open the framebuffer if need be (nonblock, we'll only do ioctls)...
-	if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd_nonblock(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -3765,56 +3939,83 @@ int
 	}
 
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
 #endif    // !FBINK_FOR_KINDLE
 }
 
+int
+    fbink_mtk_toggle_pen_mode(int fbfd, bool toggle)
+{
+	return fbink_mtk_toggle_pen_mode_ctx(&defaultCtx, fbfd, toggle);
+}
+
 // And finally, dispatch the right refresh request for our HW...
 #ifdef FBINK_FOR_LINUX
 // NOP when we don't have an eInk screen ;).
 static int
-    refresh(int                     fbfd __attribute__((unused)),
-	    const struct mxcfb_rect region __attribute__((unused)),
+    refresh(FBInkContext* restrict ctx UNUSED_BY_NODRAW,
+	    int                     fbfd __attribute__((unused)),
+	    const struct mxcfb_rect region UNUSED_BY_NODRAW,
 	    const FBInkConfig*      fbink_cfg __attribute__((unused)))
 {
+#	ifdef FBINK_WITH_DRAW
+	// We still need to track damage when drawing to an offscreen surface
+	if (ctx->activeSurface) {
+		damage_surface(ctx, &region);
+	}
+#	endif
 	return EXIT_SUCCESS;
 }
 
 static int
-    refresh_compat(int                     fbfd __attribute__((unused)),
-		   const struct mxcfb_rect region __attribute__((unused)),
+    refresh_compat(FBInkContext* restrict ctx UNUSED_BY_NODRAW,
+		   int                     fbfd __attribute__((unused)),
+		   const struct mxcfb_rect region UNUSED_BY_NODRAW,
 		   bool                    no_refresh __attribute__((unused)),
 		   const FBInkConfig*      fbink_cfg __attribute__((unused)))
 {
+#	ifdef FBINK_WITH_DRAW
+	if (ctx->activeSurface) {
+		damage_surface(ctx, &region);
+	}
+#	endif
 	return EXIT_SUCCESS;
 }
 #else
 
 static inline void
-    compute_update_marker(void)
+    compute_update_marker(FBInkContext* restrict ctx)
 {
 	// We'll want to increment the marker on each subsequent calls (for API users)...
-	if (lastMarker == 0U) {
+	if (ctx->lastMarker == 0U) {
 		// Seed it with our PID
-		lastMarker = (uint32_t) getpid();
+		ctx->lastMarker = (uint32_t) getpid();
 	} else {
-		lastMarker++;
+		ctx->lastMarker++;
 	}
 
 	// NOTE: Make sure update_marker is valid, an invalid marker *may* hang the kernel instead of failing gracefully,
 	//       depending on the device/FW...
-	if (unlikely(lastMarker == 0U)) {
-		lastMarker = ('F' + 'B' + 'I' + 'n' + 'k');
+	if (unlikely(ctx->lastMarker == 0U)) {
+		ctx->lastMarker = ('F' + 'B' + 'I' + 'n' + 'k');
 		// i.e.,      70  + 66  + 73  + 110 + 107
 	}
 }
 
 static int
-    refresh(int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
+    refresh(FBInkContext* restrict ctx, int fbfd, const struct mxcfb_rect region, const FBInkConfig* fbink_cfg)
 {
+#	ifdef FBINK_WITH_DRAW
+	// If we're drawing to an offscreen surface, the refresh will happen when it's presented.
+	if (ctx->activeSurface) {
+		damage_surface(ctx, &region);
+		return EXIT_SUCCESS;
+	}
+#	endif
+
 	// Were we asked to skip refreshes?
 	if (fbink_cfg->no_refresh) {
 		LOG("Skipping eInk refresh, as requested.");
@@ -3836,8 +4037,8 @@ static int
 	//       I'm hoping everything handles this sanely, because I really don't want to duplicate the driver's job...
 
 #	ifdef FBINK_FOR_KINDLE
-	if (deviceQuirks.isKindleLegacy) {
-		return refresh_legacy(fbfd, region, fbink_cfg->is_flashing);
+	if (ctx->deviceQuirks.isKindleLegacy) {
+		return refresh_legacy(ctx, fbfd, region, fbink_cfg->is_flashing);
 	}
 #	endif
 	// NOTE: While the fixed-cell codepath, when rendering in B&W, would be the perfect candidate for using A2 waveform mode,
@@ -3854,39 +4055,39 @@ static int
 
 	// Update our own update marker
 #	ifdef FBINK_FOR_KOBO
-	if (!deviceQuirks.isSunxi) {
+	if (!ctx->deviceQuirks.isSunxi) {
 		// NOTE: On Sunxi, it's the *kernel* that updates the marker, not us.
-		compute_update_marker();
+		compute_update_marker(ctx);
 	}
 #	else
-	compute_update_marker();
+	compute_update_marker(ctx);
 #	endif
 
 #	if defined(FBINK_FOR_KINDLE)
-	if (deviceQuirks.isMTK) {
-		return refresh_kindle_mtk(fbfd, region, fbink_cfg);
-	} else if (deviceQuirks.isKindleRex) {
-		return refresh_kindle_rex(fbfd, region, fbink_cfg);
-	} else if (deviceQuirks.isKindleZelda) {
-		return refresh_kindle_zelda(fbfd, region, fbink_cfg);
+	if (ctx->deviceQuirks.isMTK) {
+		return refresh_kindle_mtk(ctx, fbfd, region, fbink_cfg);
+	} else if (ctx->deviceQuirks.isKindleRex) {
+		return refresh_kindle_rex(ctx, fbfd, region, fbink_cfg);
+	} else if (ctx->deviceQuirks.isKindleZelda) {
+		return refresh_kindle_zelda(ctx, fbfd, region, fbink_cfg);
 	} else {
-		return refresh_kindle(fbfd, region, fbink_cfg);
+		return refresh_kindle(ctx, fbfd, region, fbink_cfg);
 	}
 #	elif defined(FBINK_FOR_CERVANTES)
-	return refresh_cervantes(fbfd, region, fbink_cfg);
+	return refresh_cervantes(ctx, fbfd, region, fbink_cfg);
 #	elif defined(FBINK_FOR_REMARKABLE)
-	return refresh_remarkable(fbfd, region, fbink_cfg);
+	return refresh_remarkable(ctx, fbfd, region, fbink_cfg);
 #	elif defined(FBINK_FOR_POCKETBOOK)
-	return refresh_pocketbook(fbfd, region, fbink_cfg);
+	return refresh_pocketbook(ctx, fbfd, region, fbink_cfg);
 #	elif defined(FBINK_FOR_KOBO)
-	if (deviceQuirks.isMTK) {
-		return refresh_kobo_mtk(fbfd, region, fbink_cfg);
-	} else if (deviceQuirks.isSunxi) {
-		return refresh_kobo_sunxi(region, fbink_cfg);
-	} else if (deviceQuirks.isKoboMk7) {
-		return refresh_kobo_mk7(fbfd, region, fbink_cfg);
+	if (ctx->deviceQuirks.isMTK) {
+		return refresh_kobo_mtk(ctx, fbfd, region, fbink_cfg);
+	} else if (ctx->deviceQuirks.isSunxi) {
+		return refresh_kobo_sunxi(ctx, region, fbink_cfg);
+	} else if (ctx->deviceQuirks.isKoboMk7) {
+		return refresh_kobo_mk7(ctx, fbfd, region, fbink_cfg);
 	} else {
-		return refresh_kobo(fbfd, region, fbink_cfg);
+		return refresh_kobo(ctx, fbfd, region, fbink_cfg);
 	}
 #	endif    // FBINK_FOR_KINDLE
 }
@@ -3894,8 +4095,19 @@ static int
 // Compat variant for functions that support not using an FBInkConfig, or want to tweak the settings internally,
 // on a per call basis...
 static int
-    refresh_compat(int fbfd, const struct mxcfb_rect region, bool no_refresh, const FBInkConfig* fbink_cfg)
+    refresh_compat(FBInkContext* restrict ctx,
+		   int                     fbfd,
+		   const struct mxcfb_rect region,
+		   bool                    no_refresh,
+		   const FBInkConfig*      fbink_cfg)
 {
+#	ifdef FBINK_WITH_DRAW
+	if (ctx->activeSurface) {
+		damage_surface(ctx, &region);
+		return EXIT_SUCCESS;
+	}
+#	endif
+
 	if (no_refresh) {
 		LOG("Skipping eInk refresh, as requested.");
 		return EXIT_SUCCESS;
@@ -3911,7 +4123,7 @@ static int
 	// And then enforce the per-call overrides
 	cfg.no_refresh = no_refresh;
 
-	int ret = refresh(fbfd, region, &cfg);
+	int ret = refresh(ctx, fbfd, region, &cfg);
 	return ret;
 }
 #endif            // FBINK_FOR_LINUX
@@ -3919,19 +4131,19 @@ static int
 // Same thing for WAIT_FOR_UPDATE_SUBMISSION requests...
 #if defined(FBINK_FOR_KINDLE) || defined(FBINK_FOR_KOBO)
 static int
-    wait_for_submission(int fbfd, uint32_t marker)
+    wait_for_submission(FBInkContext* restrict ctx, int fbfd, uint32_t marker)
 {
 #	if defined(FBINK_FOR_KINDLE)
 	// Only implemented for mxcfb Kindles...
-	if (deviceQuirks.isKindleLegacy) {
+	if (ctx->deviceQuirks.isKindleLegacy) {
 		return ERRCODE(ENOSYS);
 	} else {
-		return wait_for_submission_kindle(fbfd, marker);
+		return wait_for_submission_kindle(ctx, fbfd, marker);
 	}
 #	elif defined(FBINK_FOR_KOBO)
 	// Only implemented on MTK
-	if (deviceQuirks.isMTK) {
-		return wait_for_submission_kobo_mtk(fbfd, marker);
+	if (ctx->deviceQuirks.isMTK) {
+		return wait_for_submission_kobo_mtk(ctx, fbfd, marker);
 	} else {
 		return ERRCODE(ENOSYS);
 	}
@@ -3942,33 +4154,33 @@ static int
 // Same thing for WAIT_FOR_UPDATE_COMPLETE requests...
 #ifndef FBINK_FOR_LINUX
 static int
-    wait_for_complete(int fbfd, uint32_t marker)
+    wait_for_complete(FBInkContext* restrict ctx, int fbfd, uint32_t marker)
 {
 #	if defined(FBINK_FOR_KINDLE)
-	if (deviceQuirks.isKindleLegacy) {
+	if (ctx->deviceQuirks.isKindleLegacy) {
 		// MXCFB only ;).
 		return EXIT_SUCCESS;
-	} else if (deviceQuirks.isKindlePearlScreen) {
-		return wait_for_complete_kindle_pearl(fbfd, marker);
+	} else if (ctx->deviceQuirks.isKindlePearlScreen) {
+		return wait_for_complete_kindle_pearl(ctx, fbfd, marker);
 	} else {
-		return wait_for_complete_kindle(fbfd, marker);
+		return wait_for_complete_kindle(ctx, fbfd, marker);
 	}
 #	elif defined(FBINK_FOR_CERVANTES)
-	return wait_for_complete_cervantes(fbfd, marker);
+	return wait_for_complete_cervantes(ctx, fbfd, marker);
 #	elif defined(FBINK_FOR_KOBO)
-	if (deviceQuirks.isMTK) {
-		return wait_for_complete_kobo_mtk(fbfd, marker);
-	} else if (deviceQuirks.isSunxi) {
-		return wait_for_complete_kobo_sunxi(marker);
-	} else if (deviceQuirks.isKoboMk7) {
-		return wait_for_complete_kobo_mk7(fbfd, marker);
+	if (ctx->deviceQuirks.isMTK) {
+		return wait_for_complete_kobo_mtk(ctx, fbfd, marker);
+	} else if (ctx->deviceQuirks.isSunxi) {
+		return wait_for_complete_kobo_sunxi(ctx, marker);
+	} else if (ctx->deviceQuirks.isKoboMk7) {
+		return wait_for_complete_kobo_mk7(ctx, fbfd, marker);
 	} else {
-		return wait_for_complete_kobo(fbfd, marker);
+		return wait_for_complete_kobo(ctx, fbfd, marker);
 	}
 #	elif defined(FBINK_FOR_REMARKABLE)
-	return wait_for_complete_remarkable(fbfd, marker);
+	return wait_for_complete_remarkable(ctx, fbfd, marker);
 #	elif defined(FBINK_FOR_POCKETBOOK)
-	return wait_for_complete_pocketbook(fbfd, marker);
+	return wait_for_complete_pocketbook(ctx, fbfd, marker);
 #	endif    // FBINK_FOR_KINDLE
 }
 #endif    // !FBINK_FOR_LINUX
@@ -4033,7 +4245,7 @@ static int
 
 // And the public API call for that mess
 int
-    fbink_wakeup_epdc(void)
+    fbink_wakeup_epdc_ctx(FBInkContext* restrict ctx UNUSED_BY_NOTKOBO)
 {
 #ifndef FBINK_FOR_KOBO
 	// Abort silently, this thing is niche enough already...
@@ -4041,10 +4253,16 @@ int
 #else
 	// We go through a function pointer instead of an if ladder because the NXP implementation is only available on the latest devices,
 	// so to keep things simple, we want to handle that check during fbink_init...
-	return (*fxpWakeupEpdc)();
+	return (*ctx->fxpWakeupEpdc)();
 #endif
 }
 
+int
+    fbink_wakeup_epdc(void)
+{
+	return fbink_wakeup_epdc_ctx(&defaultCtx);
+}
+
 static inline __attribute__((always_inline)) const char*
     get_fbdev_path(void)
 {
@@ -4061,7 +4279,7 @@ static inline __attribute__((always_inline)) const char*
 
 // Open the framebuffer file & return the opened fd
 int
-    fbink_open(void)
+    fbink_open_ctx(FBInkContext* restrict ctx UNUSED_BY_NOTKOBO)
 {
 	// Open the framebuffer file for reading and writing
 	int fbfd = open(get_fbdev_path(), O_RDWR | O_CLOEXEC);
@@ -4076,8 +4294,8 @@ int
 	//       But, because we can chain multiple fbink_open & fbink_close during the lifetime of a process,
 	//       we still need to handle it here, because fbink_close would have closed it.
 #if defined(FBINK_FOR_KOBO)
-	if (deviceQuirks.isSunxi && sunxiCtx.force_rota < FORCE_ROTA_UR) {
-		if (open_accelerometer_i2c() != EXIT_SUCCESS) {
+	if (ctx->deviceQuirks.isSunxi && ctx->sunxiCtx.force_rota < FORCE_ROTA_UR) {
+		if (open_accelerometer_i2c(ctx) != EXIT_SUCCESS) {
 			PFWARN("Cannot open accelerometer I²C handle, aborting");
 			return ERRCODE(EXIT_FAILURE);
 		}
@@ -4087,14 +4305,20 @@ int
 	return fbfd;
 }
 
+int
+    fbink_open(void)
+{
+	return fbink_open_ctx(&defaultCtx);
+}
+
 // Internal version of this which keeps track of whether we were fed an already opened fd or not...
 static int
-    open_fb_fd(int* restrict fbfd, bool* restrict keep_fd)
+    open_fb_fd(FBInkContext* restrict ctx, int* restrict fbfd, bool* restrict keep_fd)
 {
 	if (*fbfd == FBFD_AUTO) {
 		// If we're opening a fd now, don't keep it around.
 		*keep_fd = false;
-		if ((*fbfd = fbink_open()) == ERRCODE(EXIT_FAILURE)) {
+		if ((*fbfd = fbink_open_ctx(ctx)) == ERRCODE(EXIT_FAILURE)) {
 			WARN("Failed to open the framebuffer character device, aborting");
 			return ERRCODE(EXIT_FAILURE);
 		}
@@ -4102,8 +4326,8 @@ static int
 #if defined(FBINK_FOR_KOBO)
 		// NOTE: In case we're *not* in an FBFD_AUTO workflow,
 		//       the I²C handle opened during the first fbink_init has been kept, too.
-		if (deviceQuirks.isSunxi && sunxiCtx.force_rota < FORCE_ROTA_UR) {
-			if (open_accelerometer_i2c() != EXIT_SUCCESS) {
+		if (ctx->deviceQuirks.isSunxi && ctx->sunxiCtx.force_rota < FORCE_ROTA_UR) {
+			if (open_accelerometer_i2c(ctx) != EXIT_SUCCESS) {
 				PFWARN("Cannot open accelerometer I²C handle, aborting");
 				return ERRCODE(EXIT_FAILURE);
 			}
@@ -4118,7 +4342,7 @@ static int
 // NOTE: Only use this for functions that don't actually need to write to the fb, and only need an fd for ioctls!
 //       Generally, those won't try to mmap the fb either ;).
 static int
-    open_fb_fd_nonblock(int* restrict fbfd, bool* restrict keep_fd)
+    open_fb_fd_nonblock(FBInkContext* restrict ctx UNUSED_BY_NOTKOBO, int* restrict fbfd, bool* restrict keep_fd)
 {
 	if (*fbfd == FBFD_AUTO) {
 		// If we're opening a fd now, don't keep it around.
@@ -4131,8 +4355,8 @@ static int
 		}
 
 #if defined(FBINK_FOR_KOBO)
-		if (deviceQuirks.isSunxi && sunxiCtx.force_rota < FORCE_ROTA_UR) {
-			if (open_accelerometer_i2c() != EXIT_SUCCESS) {
+		if (ctx->deviceQuirks.isSunxi && ctx->sunxiCtx.force_rota < FORCE_ROTA_UR) {
+			if (open_accelerometer_i2c(ctx) != EXIT_SUCCESS) {
 				PFWARN("Cannot open accelerometer I²C handle, aborting");
 				return ERRCODE(EXIT_FAILURE);
 			}
@@ -4214,7 +4438,15 @@ static __attribute__((cold)) const char*
 #ifdef FBINK_WITH_DRAW
 // Used to manually set the pen colors
 static __attribute__((cold)) int
-    set_pen_color(bool is_fg, bool is_y8, bool quantize, bool update, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+    set_pen_color(FBInkContext* restrict ctx,
+		  bool    is_fg,
+		  bool    is_y8,
+		  bool    quantize,
+		  bool    update,
+		  uint8_t r,
+		  uint8_t g,
+		  uint8_t b,
+		  uint8_t a)
 {
 	int rv = EXIT_SUCCESS;
 
@@ -4252,11 +4484,11 @@ static __attribute__((cold)) int
 	//       but we could arguably check RGB & RGBA properly at >= 24bpp...
 	if (update) {
 		if (is_fg) {
-			if (v == penFGColor) {
+			if (v == ctx->penFGColor) {
 				return OK_ALREADY_SAME;
 			}
 		} else {
-			if (v == penBGColor) {
+			if (v == ctx->penBGColor) {
 				return OK_ALREADY_SAME;
 			}
 		}
@@ -4265,41 +4497,41 @@ static __attribute__((cold)) int
 	// NOTE: We're using ELOG here to be consistent w/ fbink_init, and because this affects an internal global state.
 	// NOTE: We need to take into account the inverted cmap on Legacy Kindles...
 #	ifdef FBINK_FOR_KINDLE
-	if (deviceQuirks.isKindleLegacy) {
+	if (ctx->deviceQuirks.isKindleLegacy) {
 		if (is_fg) {
-			penFGColor = v ^ 0xFFu;
-			ELOG("Foreground pen color set to #%02X -> #%02X", v, penFGColor);
+			ctx->penFGColor = v ^ 0xFFu;
+			ELOG("Foreground pen color set to #%02X -> #%02X", v, ctx->penFGColor);
 		} else {
-			penBGColor = v ^ 0xFFu;
-			ELOG("Background pen color set to #%02X -> #%02X", v, penBGColor);
+			ctx->penBGColor = v ^ 0xFFu;
+			ELOG("Background pen color set to #%02X -> #%02X", v, ctx->penBGColor);
 		}
 	} else {
 #	endif
 		// NOTE: penFGColor/penBGColor are designed to be grayscale only,
 		//       but if we passed an RGBA value, we'll actually honor it for penFGPixel & penBGPixel!
 		if (is_fg) {
-			penFGColor = v;
+			ctx->penFGColor = v;
 			if (is_y8) {
-				ELOG("Foreground pen color set to #%02X", penFGColor);
+				ELOG("Foreground pen color set to #%02X", ctx->penFGColor);
 			} else {
 				ELOG("Foreground pen color set to #%02X%02X%02X%02X (grayscaled: #%02X)",
 				     r,
 				     g,
 				     b,
 				     a,
-				     penFGColor);
+				     ctx->penFGColor);
 			}
 		} else {
-			penBGColor = v;
+			ctx->penBGColor = v;
 			if (is_y8) {
-				ELOG("Background pen color set to #%02X", penBGColor);
+				ELOG("Background pen color set to #%02X", ctx->penBGColor);
 			} else {
 				ELOG("Background pen color set to #%02X%02X%02X%02X (grayscaled: #%02X)",
 				     r,
 				     g,
 				     b,
 				     a,
-				     penBGColor);
+				     ctx->penBGColor);
 			}
 		}
 #	ifdef FBINK_FOR_KINDLE
@@ -4309,15 +4541,15 @@ static __attribute__((cold)) int
 	// Pack the pen colors into the appropriate pixel format...
 	if (is_y8) {
 		if (is_fg) {
-			penFGPixel = pack_pixel_from_y8(penFGColor);
+			ctx->penFGPixel = pack_pixel_from_y8(ctx, ctx->penFGColor);
 		} else {
-			penBGPixel = pack_pixel_from_y8(penBGColor);
+			ctx->penBGPixel = pack_pixel_from_y8(ctx, ctx->penBGColor);
 		}
 	} else {
 		if (is_fg) {
-			penFGPixel = pack_pixel_from_rgba(r, g, b, a);
+			ctx->penFGPixel = pack_pixel_from_rgba(ctx, r, g, b, a);
 		} else {
-			penBGPixel = pack_pixel_from_rgba(r, g, b, a);
+			ctx->penBGPixel = pack_pixel_from_rgba(ctx, r, g, b, a);
 		}
 	}
 
@@ -4327,10 +4559,13 @@ static __attribute__((cold)) int
 
 // Public wrappers around set_pen_color
 int
-    fbink_set_fg_pen_gray(uint8_t y UNUSED_BY_NODRAW, bool quantize UNUSED_BY_NODRAW, bool update UNUSED_BY_NODRAW)
+    fbink_set_fg_pen_gray_ctx(FBInkContext* restrict ctx UNUSED_BY_NODRAW,
+			      uint8_t y                  UNUSED_BY_NODRAW,
+			      bool quantize              UNUSED_BY_NODRAW,
+			      bool update                UNUSED_BY_NODRAW)
 {
 #ifdef FBINK_WITH_DRAW
-	return set_pen_color(true, true, quantize, update, y, y, y, 0xFFu);
+	return set_pen_color(ctx, true, true, quantize, update, y, y, y, 0xFFu);
 #else
 	WARN("Drawing primitives are disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
@@ -4338,15 +4573,22 @@ int
 }
 
 int
-    fbink_set_fg_pen_rgba(uint8_t r     UNUSED_BY_NODRAW,
-			  uint8_t g     UNUSED_BY_NODRAW,
-			  uint8_t b     UNUSED_BY_NODRAW,
-			  uint8_t a     UNUSED_BY_NODRAW,
-			  bool quantize UNUSED_BY_NODRAW,
-			  bool update   UNUSED_BY_NODRAW)
+    fbink_set_fg_pen_gray(uint8_t y, bool quantize, bool update)
+{
+	return fbink_set_fg_pen_gray_ctx(&defaultCtx, y, quantize, update);
+}
+
+int
+    fbink_set_fg_pen_rgba_ctx(FBInkContext* restrict ctx UNUSED_BY_NODRAW,
+			      uint8_t r     UNUSED_BY_NODRAW,
+			      uint8_t g     UNUSED_BY_NODRAW,
+			      uint8_t b     UNUSED_BY_NODRAW,
+			      uint8_t a     UNUSED_BY_NODRAW,
+			      bool quantize UNUSED_BY_NODRAW,
+			      bool update   UNUSED_BY_NODRAW)
 {
 #ifdef FBINK_WITH_DRAW
-	return set_pen_color(true, false, quantize, update, r, g, b, a);
+	return set_pen_color(ctx, true, false, quantize, update, r, g, b, a);
 #else
 	WARN("Drawing primitives are disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
@@ -4354,10 +4596,19 @@ int
 }
 
 int
-    fbink_set_bg_pen_gray(uint8_t y UNUSED_BY_NODRAW, bool quantize UNUSED_BY_NODRAW, bool update UNUSED_BY_NODRAW)
+    fbink_set_fg_pen_rgba(uint8_t r, uint8_t g, uint8_t b, uint8_t a, bool quantize, bool update)
+{
+	return fbink_set_fg_pen_rgba_ctx(&defaultCtx, r, g, b, a, quantize, update);
+}
+
+int
+    fbink_set_bg_pen_gray_ctx(FBInkContext* restrict ctx UNUSED_BY_NODRAW,
+			      uint8_t y                  UNUSED_BY_NODRAW,
+			      bool quantize              UNUSED_BY_NODRAW,
+			      bool update                UNUSED_BY_NODRAW)
 {
 #ifdef FBINK_WITH_DRAW
-	return set_pen_color(false, true, quantize, update, y, y, y, 0xFFu);
+	return set_pen_color(ctx, false, true, quantize, update, y, y, y, 0xFFu);
 #else
 	WARN("Drawing primitives are disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
@@ -4365,68 +4616,81 @@ int
 }
 
 int
-    fbink_set_bg_pen_rgba(uint8_t r     UNUSED_BY_NODRAW,
-			  uint8_t g     UNUSED_BY_NODRAW,
-			  uint8_t b     UNUSED_BY_NODRAW,
-			  uint8_t a     UNUSED_BY_NODRAW,
-			  bool quantize UNUSED_BY_NODRAW,
-			  bool update   UNUSED_BY_NODRAW)
+    fbink_set_bg_pen_gray(uint8_t y, bool quantize, bool update)
+{
+	return fbink_set_bg_pen_gray_ctx(&defaultCtx, y, quantize, update);
+}
+
+int
+    fbink_set_bg_pen_rgba_ctx(FBInkContext* restrict ctx UNUSED_BY_NODRAW,
+			      uint8_t r     UNUSED_BY_NODRAW,
+			      uint8_t g     UNUSED_BY_NODRAW,
+			      uint8_t b     UNUSED_BY_NODRAW,
+			      uint8_t a     UNUSED_BY_NODRAW,
+			      bool quantize UNUSED_BY_NODRAW,
+			      bool update   UNUSED_BY_NODRAW)
 {
 #ifdef FBINK_WITH_DRAW
-	return set_pen_color(false, false, quantize, update, r, g, b, a);
+	return set_pen_color(ctx, false, false, quantize, update, r, g, b, a);
 #else
 	WARN("Drawing primitives are disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
 #endif
 }
 
+int
+    fbink_set_bg_pen_rgba(uint8_t r, uint8_t g, uint8_t b, uint8_t a, bool quantize, bool update)
+{
+	return fbink_set_bg_pen_rgba_ctx(&defaultCtx, r, g, b, a, quantize, update);
+}
+
 #ifdef FBINK_WITH_DRAW
 // Update our internal representation of pen colors (i.e., packed into the right pixel format).
 static __attribute__((cold)) int
-    update_pen_colors(const FBInkConfig* restrict fbink_cfg)
+    update_pen_colors(FBInkContext* restrict ctx, const FBInkConfig* restrict fbink_cfg)
 {
 	int rv = EXIT_SUCCESS;
 
 	// NOTE: Now that we know which device we're running on, setup pen colors,
 	//       taking into account the inverted cmap on legacy Kindles...
 #	ifdef FBINK_FOR_KINDLE
-	if (deviceQuirks.isKindleLegacy) {
-		penFGColor = eInkBGCMap[fbink_cfg->fg_color];
-		penBGColor = eInkFGCMap[fbink_cfg->bg_color];
+	if (ctx->deviceQuirks.isKindleLegacy) {
+		ctx->penFGColor = eInkBGCMap[fbink_cfg->fg_color];
+		ctx->penBGColor = eInkFGCMap[fbink_cfg->bg_color];
 
 		ELOG(
 		    "Pen colors set to #%02X%02X%02X -> #%02X%02X%02X for the foreground and #%02X%02X%02X -> #%02X%02X%02X for the background",
 		    eInkFGCMap[fbink_cfg->fg_color],
 		    eInkFGCMap[fbink_cfg->fg_color],
 		    eInkFGCMap[fbink_cfg->fg_color],
-		    penFGColor,
-		    penFGColor,
-		    penFGColor,
+		    ctx->penFGColor,
+		    ctx->penFGColor,
+		    ctx->penFGColor,
 		    eInkBGCMap[fbink_cfg->bg_color],
 		    eInkBGCMap[fbink_cfg->bg_color],
 		    eInkBGCMap[fbink_cfg->bg_color],
-		    penBGColor,
-		    penBGColor,
-		    penBGColor);
+		    ctx->penBGColor,
+		    ctx->penBGColor,
+		    ctx->penBGColor);
 	} else {
 #	endif
-		penFGColor = eInkFGCMap[fbink_cfg->fg_color];
-		penBGColor = eInkBGCMap[fbink_cfg->bg_color];
+		ctx->penFGColor = eInkFGCMap[fbink_cfg->fg_color];
+		ctx->penBGColor = eInkBGCMap[fbink_cfg->bg_color];
 
 		ELOG("Pen colors set to #%02X%02X%02X for the foreground and #%02X%02X%02X for the background",
-		     penFGColor,
-		     penFGColor,
-		     penFGColor,
-		     penBGColor,
-		     penBGColor,
-		     penBGColor);
+		     ctx->penFGColor,
+		     ctx->penFGColor,
+		     ctx->penFGColor,
+		     ctx->penBGColor,
+		     ctx->penBGColor,
+		     ctx->penBGColor);
 #	ifdef FBINK_FOR_KINDLE
 	}
 #	endif
 
 	// Pack the pen colors into the appropriate pixel format...
-	penFGPixel = pack_pixel_from_y8(penFGColor);
-	penBGPixel = pack_pixel_from_y8(penBGColor);
+	ctx->penFGPixel = pack_pixel_from_y8(ctx, ctx->penFGColor);
+	ctx->penBGPixel = pack_pixel_from_y8(ctx, ctx->penBGColor);
 
 	return rv;
 }
@@ -4461,104 +4725,104 @@ static __attribute__((cold)) void
 // c.f., the similar logic in https://github.com/koreader/koreader-base/blob/50a965c28fd5ea2100257aa9ce2e62c9c301155c/ffi/framebuffer_linux.lua#L119-L189
 #ifdef FBINK_FOR_POCKETBOOK
 static __attribute__((cold)) void
-    pocketbook_fix_fb_info(void)
+    pocketbook_fix_fb_info(FBInkContext* restrict ctx)
 {
-	ELOG("Virtual resolution: %ux%u", vInfo.xres_virtual, vInfo.yres_virtual);
+	ELOG("Virtual resolution: %ux%u", ctx->vInfo.xres_virtual, ctx->vInfo.yres_virtual);
 	// Not duplicating all the explanations here, c.f., the KOReader snippet linked earlier ;).
-	if (fInfo.id[0] == '\0') {
-		const uint32_t xres_virtual = vInfo.xres_virtual;
-		if (!IS_ALIGNED(vInfo.xres_virtual, 32)) {
-			vInfo.xres_virtual = ALIGN(vInfo.xres, 32);
-			ELOG("xres_virtual -> %u", vInfo.xres_virtual);
-		}
-		const uint32_t yres_virtual = vInfo.yres_virtual;
-		if (!IS_ALIGNED(vInfo.yres_virtual, 128)) {
-			vInfo.yres_virtual = ALIGN(vInfo.yres, 128);
-			ELOG("yres_virtual -> %u", vInfo.yres_virtual);
-		}
-		const uint32_t line_length = fInfo.line_length;
-		fInfo.line_length          = (vInfo.xres_virtual * vInfo.bits_per_pixel) >> 3U;
-		ELOG("line_length -> %u", fInfo.line_length);
-
-		size_t fb_size = fInfo.line_length * vInfo.yres_virtual;
-		if (fb_size > fInfo.smem_len) {
+	if (ctx->fInfo.id[0] == '\0') {
+		const uint32_t xres_virtual = ctx->vInfo.xres_virtual;
+		if (!IS_ALIGNED(ctx->vInfo.xres_virtual, 32)) {
+			ctx->vInfo.xres_virtual = ALIGN(ctx->vInfo.xres, 32);
+			ELOG("xres_virtual -> %u", ctx->vInfo.xres_virtual);
+		}
+		const uint32_t yres_virtual = ctx->vInfo.yres_virtual;
+		if (!IS_ALIGNED(ctx->vInfo.yres_virtual, 128)) {
+			ctx->vInfo.yres_virtual = ALIGN(ctx->vInfo.yres, 128);
+			ELOG("yres_virtual -> %u", ctx->vInfo.yres_virtual);
+		}
+		const uint32_t line_length = ctx->fInfo.line_length;
+		ctx->fInfo.line_length     = (ctx->vInfo.xres_virtual * ctx->vInfo.bits_per_pixel) >> 3U;
+		ELOG("line_length -> %u", ctx->fInfo.line_length);
+
+		size_t fb_size = ctx->fInfo.line_length * ctx->vInfo.yres_virtual;
+		if (fb_size > ctx->fInfo.smem_len) {
 			if (!IS_ALIGNED(yres_virtual, 32)) {
-				vInfo.yres_virtual = ALIGN(vInfo.yres, 32);
-				ELOG("yres_virtual => %u", vInfo.yres_virtual);
+				ctx->vInfo.yres_virtual = ALIGN(ctx->vInfo.yres, 32);
+				ELOG("yres_virtual => %u", ctx->vInfo.yres_virtual);
 			} else {
-				vInfo.yres_virtual = yres_virtual;
-				ELOG("yres_virtual <- %u", vInfo.yres_virtual);
+				ctx->vInfo.yres_virtual = yres_virtual;
+				ELOG("yres_virtual <- %u", ctx->vInfo.yres_virtual);
 			}
-			fb_size = fInfo.line_length * vInfo.yres_virtual;
+			fb_size = ctx->fInfo.line_length * ctx->vInfo.yres_virtual;
 
-			if (fb_size > fInfo.smem_len) {
-				fb_size           = fInfo.smem_len;
-				fInfo.line_length = line_length;
-				ELOG("line_length <- %u", fInfo.line_length);
-				vInfo.xres_virtual = xres_virtual;
-				ELOG("xres_virtual <- %u", vInfo.xres_virtual);
-				vInfo.yres_virtual = yres_virtual;
-				ELOG("yres_virtual <- %u", vInfo.yres_virtual);
+			if (fb_size > ctx->fInfo.smem_len) {
+				fb_size                = ctx->fInfo.smem_len;
+				ctx->fInfo.line_length = line_length;
+				ELOG("line_length <- %u", ctx->fInfo.line_length);
+				ctx->vInfo.xres_virtual = xres_virtual;
+				ELOG("xres_virtual <- %u", ctx->vInfo.xres_virtual);
+				ctx->vInfo.yres_virtual = yres_virtual;
+				ELOG("yres_virtual <- %u", ctx->vInfo.yres_virtual);
 
 				// Trust line_length to compute the amount of *pixels* in a scanline, visible or not,
 				// because that's what we use xres_virtual for throughout the code...
-				vInfo.xres_virtual = (fInfo.line_length << 3U) / vInfo.bits_per_pixel;
-				ELOG("xres_virtual => %u", vInfo.xres_virtual);
+				ctx->vInfo.xres_virtual = (ctx->fInfo.line_length << 3U) / ctx->vInfo.bits_per_pixel;
+				ELOG("xres_virtual => %u", ctx->vInfo.xres_virtual);
 			}
 		}
 	}
 
-	if (deviceQuirks.hasColorPanel) {
+	if (ctx->deviceQuirks.hasColorPanel) {
 		// They all use a 24bpp RGB framebuffer, despite potentially reporting it as 8bpp...
-		vInfo.bits_per_pixel = 24U;
+		ctx->vInfo.bits_per_pixel = 24U;
 		// Enforce RGB24
-		vInfo.red.offset     = 0U << 3U;
-		vInfo.red.length     = 8U;
-		vInfo.green.offset   = 1U << 3U;
-		vInfo.green.length   = 8U;
-		vInfo.blue.offset    = 2U << 3U;
-		vInfo.blue.length    = 8U;
-		vInfo.transp.offset  = 0U;
-		vInfo.transp.length  = 0U;
+		ctx->vInfo.red.offset     = 0U << 3U;
+		ctx->vInfo.red.length     = 8U;
+		ctx->vInfo.green.offset   = 1U << 3U;
+		ctx->vInfo.green.length   = 8U;
+		ctx->vInfo.blue.offset    = 2U << 3U;
+		ctx->vInfo.blue.length    = 8U;
+		ctx->vInfo.transp.offset  = 0U;
+		ctx->vInfo.transp.length  = 0U;
 	}
 
 	// In addition to the above, the first color device was extra quirky...
-	if (deviceQuirks.deviceId == DEVICE_POCKETBOOK_COLOR_LUX) {
-		vInfo.xres = vInfo.xres / 3U;
+	if (ctx->deviceQuirks.deviceId == DEVICE_POCKETBOOK_COLOR_LUX) {
+		ctx->vInfo.xres = ctx->vInfo.xres / 3U;
 	}
 }
 #endif    // FBINK_FOR_POCKETBOOK
 
 #ifdef FBINK_FOR_KOBO
 static __attribute__((cold)) void
-    kobo_sunxi_fb_fixup(bool is_reinit)
+    kobo_sunxi_fb_fixup(FBInkContext* restrict ctx, bool is_reinit)
 {
 	// If necessary, query the accelerometer to check the current rotation...
 	if (!is_reinit) {
 		// fbink_reinit already took care of this, so this only affects explicit fbink_init calls.
 		// NOTE: Ideally, we should only affect the *first* fbink_init call, period...
-		if (sunxiCtx.force_rota >= FORCE_ROTA_UR) {
-			if (sunxiCtx.force_rota == FORCE_ROTA_WORKBUF) {
+		if (ctx->sunxiCtx.force_rota >= FORCE_ROTA_UR) {
+			if (ctx->sunxiCtx.force_rota == FORCE_ROTA_WORKBUF) {
 				// Attempt to match the working buffer...
-				int rotate = query_fbdamage();
+				int rotate = query_fbdamage(ctx);
 				if (rotate < 0) {
 					ELOG("FBDamage is inconclusive, assuming Upright");
 					rotate = FB_ROTATE_UR;
 				}
-				vInfo.rotate = (uint32_t) rotate;
+				ctx->vInfo.rotate = (uint32_t) rotate;
 			} else {
-				vInfo.rotate = (uint32_t) sunxiCtx.force_rota;
+				ctx->vInfo.rotate = (uint32_t) ctx->sunxiCtx.force_rota;
 			}
 		} else {
-			int rotate = query_accelerometer();
+			int rotate = query_accelerometer(ctx);
 			if (rotate < 0) {
 				ELOG("Accelerometer is inconclusive, assuming Upright");
 				rotate = FB_ROTATE_UR;
 			}
-			vInfo.rotate = (uint32_t) rotate;
+			ctx->vInfo.rotate = (uint32_t) rotate;
 		}
 	}
-	ELOG("Canonical rotation: %u (%s)", vInfo.rotate, fb_rotate_to_string(vInfo.rotate));
+	ELOG("Canonical rotation: %u (%s)", ctx->vInfo.rotate, fb_rotate_to_string(ctx->vInfo.rotate));
 	// NOTE: And because, of course, we can't have nice things, if the current working buffer
 	//       (e.g., Nickel's) is laid out in a different rotation,
 	//       the layer overlap detection and subsequent blending royally screws Nickel's own layer... :(.
@@ -4569,21 +4833,21 @@ static __attribute__((cold)) void
 
 	// Devise the required G2D rotation angle (for UPDATE ioctls), given the current "fb" rotate flag.
 	// This is unfortunately not as nice and easy as usual...
-	sunxiCtx.rota = ((deviceQuirks.ntxBootRota - vInfo.rotate) & 3) * 90U;
+	ctx->sunxiCtx.rota = ((ctx->deviceQuirks.ntxBootRota - ctx->vInfo.rotate) & 3) * 90U;
 
 	// Handle Portrait/Landscape swaps
-	const uint32_t xres = vInfo.xres;
-	const uint32_t yres = vInfo.yres;
-	if ((vInfo.rotate & 0x01) == 1) {
+	const uint32_t xres = ctx->vInfo.xres;
+	const uint32_t yres = ctx->vInfo.yres;
+	if ((ctx->vInfo.rotate & 0x01) == 1) {
 		// Odd, Landscape
-		vInfo.xres = MAX(xres, yres);
-		vInfo.yres = MIN(xres, yres);
+		ctx->vInfo.xres = MAX(xres, yres);
+		ctx->vInfo.yres = MIN(xres, yres);
 	} else {
 		// Even, Portrait
-		vInfo.xres = MIN(xres, yres);
-		vInfo.yres = MAX(xres, yres);
+		ctx->vInfo.xres = MIN(xres, yres);
+		ctx->vInfo.yres = MAX(xres, yres);
 	}
-	ELOG("Screen layout fixup (%ux%u -> %ux%u)", xres, yres, vInfo.xres, vInfo.yres);
+	ELOG("Screen layout fixup (%ux%u -> %ux%u)", xres, yres, ctx->vInfo.xres, ctx->vInfo.yres);
 
 	// Make the pitch NEON-friendly...
 	// NOTE: We don't do it because it can introduce layout change glitches on rotation,
@@ -4595,20 +4859,20 @@ static __attribute__((cold)) void
 	vInfo.yres_virtual = ALIGN(vInfo.yres, 32);
 	ELOG("yres_virtual -> %u", vInfo.yres_virtual);
 	*/
-	vInfo.xres_virtual = vInfo.xres;
-	ELOG("xres_virtual -> %u", vInfo.xres_virtual);
-	vInfo.yres_virtual = vInfo.yres;
-	ELOG("yres_virtual -> %u", vInfo.yres_virtual);
+	ctx->vInfo.xres_virtual = ctx->vInfo.xres;
+	ELOG("xres_virtual -> %u", ctx->vInfo.xres_virtual);
+	ctx->vInfo.yres_virtual = ctx->vInfo.yres;
+	ELOG("yres_virtual -> %u", ctx->vInfo.yres_virtual);
 
 	// Make it grayscale...
-	vInfo.bits_per_pixel = 8U;
-	vInfo.grayscale      = 1U;
-	ELOG("bits_per_pixel -> %u", vInfo.bits_per_pixel);
-	fInfo.line_length = (vInfo.xres_virtual * vInfo.bits_per_pixel) >> 3U;
-	ELOG("line_length -> %u", fInfo.line_length);
+	ctx->vInfo.bits_per_pixel = 8U;
+	ctx->vInfo.grayscale      = 1U;
+	ELOG("bits_per_pixel -> %u", ctx->vInfo.bits_per_pixel);
+	ctx->fInfo.line_length = (ctx->vInfo.xres_virtual * ctx->vInfo.bits_per_pixel) >> 3U;
+	ELOG("line_length -> %u", ctx->fInfo.line_length);
 	// Used by clear_screen & memmap_ion
-	fInfo.smem_len = fInfo.line_length * vInfo.yres_virtual;
-	ELOG("smem_len -> %u", fInfo.smem_len);
+	ctx->fInfo.smem_len = ctx->fInfo.line_length * ctx->vInfo.yres_virtual;
+	ELOG("smem_len -> %u", ctx->fInfo.smem_len);
 }
 
 static __attribute__((cold)) const char*
@@ -4643,11 +4907,11 @@ static __attribute__((cold)) const char*
 
 // Get the various fb info & setup global variables
 static __attribute__((cold)) int
-    initialize_fbink(int fbfd, const FBInkConfig* restrict fbink_cfg, bool skip_vinfo)
+    initialize_fbink(FBInkContext* restrict ctx, int fbfd, const FBInkConfig* restrict fbink_cfg, bool skip_vinfo)
 {
 	// Open the framebuffer if need be (nonblock, we'll only do ioctls)...
 	bool keep_fd = true;
-	if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd_nonblock(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -4658,38 +4922,38 @@ static __attribute__((cold)) int
 
 	// Start with some more generic stuff, not directly related to the framebuffer.
 	// As all this stuff is pretty much set in stone, we'll only query it once.
-	if (!deviceQuirks.skipId) {
+	if (!ctx->deviceQuirks.skipId) {
 #ifndef FBINK_FOR_LINUX
 		// Identify the device's specific model...
-		identify_device();
+		identify_device(ctx);
 #	if defined(FBINK_FOR_KINDLE)
 		// Most kindle support the WAIT_FOR_UPDATE_SUBMISSION ioctl...
-		deviceQuirks.canWaitForSubmission = true;
-		if (deviceQuirks.isKindleLegacy) {
+		ctx->deviceQuirks.canWaitForSubmission = true;
+		if (ctx->deviceQuirks.isKindleLegacy) {
 			ELOG("Enabled Legacy einkfb Kindle quirks");
 			// ... as long as they're not really old devices ;).
-			deviceQuirks.canWaitForSubmission = false;
-		} else if (deviceQuirks.isKindlePearlScreen) {
+			ctx->deviceQuirks.canWaitForSubmission = false;
+		} else if (ctx->deviceQuirks.isKindlePearlScreen) {
 			ELOG("Enabled Kindle with Pearl screen quirks");
-		} else if (deviceQuirks.isKindleZelda) {
+		} else if (ctx->deviceQuirks.isKindleZelda) {
 			ELOG("Enabled Kindle Zelda platform quirks");
-		} else if (deviceQuirks.isKindleRex) {
+		} else if (ctx->deviceQuirks.isKindleRex) {
 			ELOG("Enabled Kindle Rex platform quirks");
 		}
 #	elif defined(FBINK_FOR_KOBO)
 		// Being able to poke at the EPDC PM is roughly a Mk.8+ thing...
-		fxpWakeupEpdc = &wakeup_epdc_nop;
+		ctx->fxpWakeupEpdc = &wakeup_epdc_nop;
 
-		if (deviceQuirks.isKoboNonMT) {
+		if (ctx->deviceQuirks.isKoboNonMT) {
 			ELOG("Enabled Kobo w/o Multi-Touch quirks");
-		} else if (deviceQuirks.isKoboMk7) {
+		} else if (ctx->deviceQuirks.isKoboMk7) {
 			ELOG("Enabled Kobo Mark 7 quirks");
 
 			// This is only available on the latest boards (ca. Mk.8 and up)
 			if (access(NTX_NXP_EPDC_POWER, F_OK) == 0) {
-				fxpWakeupEpdc = &wakeup_epdc_kobo_nxp;
+				ctx->fxpWakeupEpdc = &wakeup_epdc_kobo_nxp;
 			}
-		} else if (deviceQuirks.isSunxi) {
+		} else if (ctx->deviceQuirks.isSunxi) {
 			ELOG("Enabled sunxi quirks");
 
 			// NOTE: Check if the fbdamage kernel module is loaded,
@@ -4698,10 +4962,10 @@ static __attribute__((cold)) int
 			// NOTE: Only checking this on startup ought to be good enough,
 			//       as the module is only really truly useful when loaded very early during the boot process...
 			if (access(FBDAMAGE_ROTATE_SYSFS, F_OK) == 0) {
-				sunxiCtx.has_fbdamage = true;
+				ctx->sunxiCtx.has_fbdamage = true;
 				ELOG("Working buffer rotation sniffing available, thanks to fbdamage");
 			} else {
-				sunxiCtx.has_fbdamage = false;
+				ctx->sunxiCtx.has_fbdamage = false;
 			}
 
 			// NOTE: Allow selectively or completely overriding the accelerometer.
@@ -4715,7 +4979,7 @@ static __attribute__((cold)) int
 				// check and validate the fallback value instead...
 				if (val == FORCE_ROTA_CURRENT_ROTA || val == FORCE_ROTA_CURRENT_LAYOUT ||
 				    val == FORCE_ROTA_WORKBUF) {
-					if (!sunxiCtx.has_fbdamage) {
+					if (!ctx->sunxiCtx.has_fbdamage) {
 						const char* force_rota_fallback = getenv("FBINK_FORCE_ROTA_FALLBACK");
 						if (force_rota_fallback) {
 							val = strtol(force_rota_fallback, NULL, 10);
@@ -4745,49 +5009,49 @@ static __attribute__((cold)) int
 					case FORCE_ROTA_UD:
 					case FORCE_ROTA_CCW:
 					case FORCE_ROTA_WORKBUF:
-						sunxiCtx.force_rota = (SUNXI_FORCE_ROTA_INDEX_T) val;
+						ctx->sunxiCtx.force_rota = (SUNXI_FORCE_ROTA_INDEX_T) val;
 						break;
 					default:
 						WARN("Invalid value `%s` for env var FBINK_FORCE_ROTA", force_rota);
-						sunxiCtx.force_rota = FORCE_ROTA_GYRO;
+						ctx->sunxiCtx.force_rota = FORCE_ROTA_GYRO;
 						break;
 				}
 				ELOG("Requested custom rotation handling: %hhd (%s)",
-				     sunxiCtx.force_rota,
-				     sunxi_force_rota_to_string(sunxiCtx.force_rota));
+				     ctx->sunxiCtx.force_rota,
+				     sunxi_force_rota_to_string(ctx->sunxiCtx.force_rota));
 			}
 
 			// As the force_rota state may be updated at runtime,
 			// make sure we *always* lookup the accelerometer bus/address...
-			if (populate_accelerometer_i2c_info() != EXIT_SUCCESS) {
+			if (populate_accelerometer_i2c_info(ctx) != EXIT_SUCCESS) {
 				WARN("Unable to handle rotation detection: assuming UR");
 				// Make sure we won't try again
-				sunxiCtx.force_rota = FORCE_ROTA_UR;
+				ctx->sunxiCtx.force_rota = FORCE_ROTA_UR;
 			}
 
 			// Only open an I²C handle if we're actually going to query the gyro
-			if (sunxiCtx.force_rota < FORCE_ROTA_UR) {
+			if (ctx->sunxiCtx.force_rota < FORCE_ROTA_UR) {
 				// The fb fixup may require being able to poke at the accelerometer...
-				if (open_accelerometer_i2c() != EXIT_SUCCESS) {
+				if (open_accelerometer_i2c(ctx) != EXIT_SUCCESS) {
 					WARN("Unable to handle rotation detection: assuming UR");
-					sunxiCtx.force_rota = FORCE_ROTA_UR;
+					ctx->sunxiCtx.force_rota = FORCE_ROTA_UR;
 				}
 			}
 
-			fxpWakeupEpdc = &wakeup_epdc_kobo_sunxi;
-		} else if (deviceQuirks.isMTK) {
+			ctx->fxpWakeupEpdc = &wakeup_epdc_kobo_sunxi;
+		} else if (ctx->deviceQuirks.isMTK) {
 			ELOG("Enabled MediaTek quirks");
 
-			deviceQuirks.canWaitForSubmission = true;
-			fxpWakeupEpdc                     = &wakeup_epdc_kobo_mtk;
+			ctx->deviceQuirks.canWaitForSubmission = true;
+			ctx->fxpWakeupEpdc                     = &wakeup_epdc_kobo_mtk;
 		}
 
 		// Make it obvious if the feature isn't available (this should pretty much *exactly* match anything < Mk. 8)
-		if (fxpWakeupEpdc == &wakeup_epdc_nop) {
+		if (ctx->fxpWakeupEpdc == &wakeup_epdc_nop) {
 			ELOG("Explicit EPDC wakeup isn't supported on this device");
-			deviceQuirks.canWakeEPDC = false;
+			ctx->deviceQuirks.canWakeEPDC = false;
 		} else {
-			deviceQuirks.canWakeEPDC = true;
+			ctx->deviceQuirks.canWakeEPDC = true;
 		}
 #	elif defined(FBINK_FOR_POCKETBOOK)
 		// Check if the device is running on an AllWinner SoC instead of an NXP one...
@@ -4795,12 +5059,12 @@ static __attribute__((cold)) int
 		// Should fail w/ ENOTTY (or EINVAL?) on NXP
 		if (ioctl(fbfd, EPDC_GET_UPDATE_STATE, &aw_busy) != -1) {
 			ELOG("Device appears to be running on an AW B288 SoC!");
-			deviceQuirks.isSunxi = true;
+			ctx->deviceQuirks.isSunxi = true;
 		}
 #	elif defined(FBINK_FOR_REMARKABLE)
 		// NOTE: Check if we're running on an rM 2, in which case abort with extreme prejudice,
 		//       because its kernel doesn't ship with an EPDC driver, despite running on an i.MX 7D...
-		if (deviceQuirks.deviceId == DEVICE_REMARKABLE_2) {
+		if (ctx->deviceQuirks.deviceId == DEVICE_REMARKABLE_2) {
 			// ... unless we're running under the https://github.com/ddvk/remarkable2-framebuffer shim
 			const char* rm2fb = getenv("RM2FB_SHIM");
 			if (rm2fb) {
@@ -4824,50 +5088,50 @@ static __attribute__((cold)) int
 		//       c.f., sysconf(3)
 		const long int rc = sysconf(_SC_CLK_TCK);
 		if (rc > 0) {
-			USER_HZ = rc;
-			ELOG("Clock tick frequency appears to be %ld Hz", USER_HZ);
+			ctx->USER_HZ = rc;
+			ELOG("Clock tick frequency appears to be %ld Hz", ctx->USER_HZ);
 		} else {
-			ELOG("Unable to query clock tick frequency, assuming %ld Hz", USER_HZ);
+			ELOG("Unable to query clock tick frequency, assuming %ld Hz", ctx->USER_HZ);
 		}
 
 		// Support user override, could come in handy on platforms with potentially shakey device identification (e.g., no InkView PB).
 		const char* dpi_override = getenv("FBINK_FORCE_DPI");
 		if (dpi_override) {
-			deviceQuirks.screenDPI = (unsigned short) strtoul(dpi_override, NULL, 10);
+			ctx->deviceQuirks.screenDPI = (unsigned short) strtoul(dpi_override, NULL, 10);
 		}
 		// Much like KOReader, assume a baseline DPI for devices where we don't specify a value in device_id
-		if (deviceQuirks.screenDPI == 0U) {
+		if (ctx->deviceQuirks.screenDPI == 0U) {
 #ifdef FBINK_FOR_LINUX
 			// Assume non-HiDPI screens on pure Linux
-			deviceQuirks.screenDPI = 96U;
+			ctx->deviceQuirks.screenDPI = 96U;
 #else
 			// Should roughly apply to a vast majority of early Pearl screens
-			deviceQuirks.screenDPI = 167U;
+			ctx->deviceQuirks.screenDPI = 167U;
 #endif
 		}
-		ELOG("Screen density set to %hu dpi%s", deviceQuirks.screenDPI, dpi_override ? " (override)" : "");
+		ELOG("Screen density set to %hu dpi%s", ctx->deviceQuirks.screenDPI, dpi_override ? " (override)" : "");
 
 		// And make sure we won't do that again ;).
-		deviceQuirks.skipId = true;
+		ctx->deviceQuirks.skipId = true;
 	}
 
 	// Get variable screen information (unless we were asked to skip it, because we've already populated it elsewhere)
 	if (!skip_vinfo) {
-		if (ioctl(fbfd, FBIOGET_VSCREENINFO, &vInfo)) {
+		if (ioctl(fbfd, FBIOGET_VSCREENINFO, &ctx->vInfo)) {
 			PFWARN("Error reading variable fb information: %m");
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
 	}
 	ELOG("Variable fb info: %ux%u, %ubpp @ rotation: %u (%s)",
-	     vInfo.xres,
-	     vInfo.yres,
-	     vInfo.bits_per_pixel,
-	     vInfo.rotate,
-	     fb_rotate_to_string(vInfo.rotate));
+	     ctx->vInfo.xres,
+	     ctx->vInfo.yres,
+	     ctx->vInfo.bits_per_pixel,
+	     ctx->vInfo.rotate,
+	     fb_rotate_to_string(ctx->vInfo.rotate));
 #ifdef FBINK_FOR_KINDLE
 	// On einkfb, log the effective orientation, too...
-	if (deviceQuirks.isKindleLegacy) {
+	if (ctx->deviceQuirks.isKindleLegacy) {
 		orientation_t orientation = orientation_portrait;
 		if (ioctl(fbfd, FBIO_EINK_GET_DISPLAY_ORIENTATION, &orientation)) {
 			PFWARN("FBIO_EINK_GET_DISPLAY_ORIENTATION: %m");
@@ -4880,15 +5144,15 @@ static __attribute__((cold)) int
 #endif
 
 	// Get fixed screen information
-	if (ioctl(fbfd, FBIOGET_FSCREENINFO, &fInfo)) {
+	if (ioctl(fbfd, FBIOGET_FSCREENINFO, &ctx->fInfo)) {
 		PFWARN("Error reading fixed fb information: %m");
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
 	}
 	ELOG("Fixed fb info: ID is \"%s\", length of fb mem: %u bytes & line length: %u bytes",
-	     fInfo.id,
-	     fInfo.smem_len,
-	     fInfo.line_length);
+	     ctx->fInfo.id,
+	     ctx->fInfo.smem_len,
+	     ctx->fInfo.line_length);
 	// NOTE: On a reinit, we're trusting that smem_len will *NOT* have changed,
 	//       which thankfully appears to hold true on our target devices.
 	//       Otherwise, we'd probably have to compare the previous smem_len to the new, and to
@@ -4896,27 +5160,27 @@ static __attribute__((cold)) int
 
 #ifdef FBINK_FOR_POCKETBOOK
 	// On PocketBook, fix the broken mess that the ioctls returns...
-	pocketbook_fix_fb_info();
+	pocketbook_fix_fb_info(ctx);
 #endif
 #ifdef FBINK_FOR_KOBO
 	// Ditto on Sunxi...
-	if (deviceQuirks.isSunxi) {
-		kobo_sunxi_fb_fixup(skip_vinfo);
+	if (ctx->deviceQuirks.isSunxi) {
+		kobo_sunxi_fb_fixup(ctx, skip_vinfo);
 	}
 #endif
 
 	// NOTE: In most every cases, we assume (0, 0) is at the top left of the screen,
 	//       and (xres, yres) at the bottom right, as we should.
-	screenWidth  = vInfo.xres;
-	screenHeight = vInfo.yres;
+	ctx->screenWidth  = ctx->vInfo.xres;
+	ctx->screenHeight = ctx->vInfo.yres;
 
 	// NOTE: This needs to be NOP by default, no matter the target device ;).
-	fxpRotateCoords = &rotate_coordinates_nop;
-	fxpRotateRegion = &rotate_region_nop;
+	ctx->fxpRotateCoords = &rotate_coordinates_nop;
+	ctx->fxpRotateRegion = &rotate_region_nop;
 #if defined(FBINK_FOR_KOBO) || defined(FBINK_FOR_CERVANTES)
 	// NOTE: This applies both to Kobo & Cervantes!
 	// Make sure we default to no rotation shenanigans, to avoid issues on reinit...
-	deviceQuirks.isNTX16bLandscape = false;
+	ctx->deviceQuirks.isNTX16bLandscape = false;
 	// NOTE: But in some very specific circumstances, that doesn't hold true...
 	//       In particular, Kobos boot with a framebuffer in Landscape orientation (i.e., xres > yres),
 	//       but a viewport in Portrait (the boot progress, as well as Nickel itself are presented in Portrait mode),
@@ -4929,7 +5193,7 @@ static __attribute__((cold)) int
 	//       In fact, if you manage to run *before* pickel (i.e., before on-animator),
 	//       you'll notice that it's in yet another rotation at very early boot (CCW?)...
 	// NOTE: The Libra finally appears to have put a stop to this madness (it boots UR, with an UR panel).
-	if (!deviceQuirks.isSunxi && vInfo.xres > vInfo.yres) {
+	if (!ctx->deviceQuirks.isSunxi && ctx->vInfo.xres > ctx->vInfo.yres) {
 		// NOTE: PW2:
 		//         vInfo.rotate == 2 in Landscape (vs. 3 in Portrait mode), w/ the xres/yres switch in Landscape,
 		//         and (0, 0) is always at the top-left of the viewport, so we're always correct.
@@ -4951,11 +5215,11 @@ static __attribute__((cold)) int
 		//           & https://github.com/koreader/koreader-base/blob/master/ffi/framebuffer.lua#L74-L84
 		// NOTE: See the discussion around p16 of the Plato thread for even more gory details!
 		//       https://www.mobileread.com/forums/showthread.php?t=292914&page=16
-		if (unlikely(vInfo.bits_per_pixel == 16U)) {
+		if (unlikely(ctx->vInfo.bits_per_pixel == 16U)) {
 			// Correct screenWidth & screenHeight, so we do all our row/column arithmetics on the right values...
-			screenWidth                    = vInfo.yres;
-			screenHeight                   = vInfo.xres;
-			deviceQuirks.isNTX16bLandscape = true;
+			ctx->screenWidth                    = ctx->vInfo.yres;
+			ctx->screenHeight                   = ctx->vInfo.xres;
+			ctx->deviceQuirks.isNTX16bLandscape = true;
 			// NOTE: Here be dragons!
 			//       I'm assuming that most devices follow the same pattern as far as rotation is concerned,
 			//       with a few exceptions hardcoded (c.f., identify_kobo in fbink_device_id.c).
@@ -4967,7 +5231,7 @@ static __attribute__((cold)) int
 			// NOTE: The *name* of the rotation quirk *might* be wrong on newer devices (c.f., my notes on a Forma,
 			//       in set_kobo_quirks in fbink_device_id.c),
 			//       but we nonetheless currently appear to do the right thing, so just let sleeping dogs lie...
-			if (vInfo.rotate == deviceQuirks.ntxBootRota) {
+			if (ctx->vInfo.rotate == ctx->deviceQuirks.ntxBootRota) {
 				// NOTE: Fun fact: on my H2O, the initial boot rotation appears to be even weirder...
 				//       This rotation shenanigan was tested by running pickel, then rotating the fb via sysfs,
 				//       until I got something that matched what I get during KFMon's boot process.
@@ -4976,21 +5240,21 @@ static __attribute__((cold)) int
 				//       the message is printed near the top of the screen instead of near the bottom...
 				//       On the plus side, it's no longer upside down and RTL, so, progress!
 				//       >_<".
-				fxpRotateCoords = &rotate_coordinates_boot;
-				fxpRotateRegion = &rotate_region_boot;
+				ctx->fxpRotateCoords = &rotate_coordinates_boot;
+				ctx->fxpRotateRegion = &rotate_region_boot;
 				ELOG("Enabled NTX @ 16bpp boot rotation quirks (%ux%u -> %ux%u)",
-				     vInfo.xres,
-				     vInfo.yres,
-				     screenWidth,
-				     screenHeight);
+				     ctx->vInfo.xres,
+				     ctx->vInfo.yres,
+				     ctx->screenWidth,
+				     ctx->screenHeight);
 			} else {
-				fxpRotateCoords = &rotate_coordinates_pickel;
-				fxpRotateRegion = &rotate_region_pickel;
+				ctx->fxpRotateCoords = &rotate_coordinates_pickel;
+				ctx->fxpRotateRegion = &rotate_region_pickel;
 				ELOG("Enabled NTX @ 16bpp pickel rotation quirks (%ux%u -> %ux%u)",
-				     vInfo.xres,
-				     vInfo.yres,
-				     screenWidth,
-				     screenHeight);
+				     ctx->vInfo.xres,
+				     ctx->vInfo.yres,
+				     ctx->screenWidth,
+				     ctx->screenHeight);
 			}
 		}
 	}
@@ -5001,31 +5265,31 @@ static __attribute__((cold)) int
 #	if defined(FBINK_FOR_KOBO)
 	// NOTE: fbink_rota_native_to_canonical is only implemented/tested on Kobo, so, don't do it on Cervantes.
 	//       They're all in a quirky state anyway ;).
-	if (!deviceQuirks.isSunxi && !deviceQuirks.isNTX16bLandscape) {
+	if (!ctx->deviceQuirks.isSunxi && !ctx->deviceQuirks.isNTX16bLandscape) {
 		// Otherwise, attempt to untangle it ourselves...
-		canonical_rota = fbink_rota_native_to_canonical(vInfo.rotate);
+		canonical_rota = fbink_rota_native_to_canonical_ctx(ctx, ctx->vInfo.rotate);
 		ELOG("Canonical rotation: %hhu (%s)", canonical_rota, fb_rotate_to_string(canonical_rota));
 	}
 
 	// Setup the disp layer insanity on sunxi...
-	if (deviceQuirks.isSunxi) {
+	if (ctx->deviceQuirks.isSunxi) {
 		// disp_layer_info2
-		sunxiCtx.layer.info.mode        = LAYER_MODE_BUFFER;
-		sunxiCtx.layer.info.zorder      = 0U;
+		ctx->sunxiCtx.layer.info.mode        = LAYER_MODE_BUFFER;
+		ctx->sunxiCtx.layer.info.zorder      = 0U;
 		// NOTE: Ignore pixel alpha.
 		//       We actually *do* handle alpha sanely, so,
 		//       if we were actually using an RGB32 fb, we might want to tweak that & pre_multiply...
-		sunxiCtx.layer.info.alpha_mode  = 1U;
-		sunxiCtx.layer.info.alpha_value = 0xFFu;
+		ctx->sunxiCtx.layer.info.alpha_mode  = 1U;
+		ctx->sunxiCtx.layer.info.alpha_value = 0xFFu;
 
 		// disp_rect
-		sunxiCtx.layer.info.screen_win.x      = 0;
-		sunxiCtx.layer.info.screen_win.y      = 0;
-		sunxiCtx.layer.info.screen_win.width  = vInfo.xres;
-		sunxiCtx.layer.info.screen_win.height = vInfo.yres;
+		ctx->sunxiCtx.layer.info.screen_win.x      = 0;
+		ctx->sunxiCtx.layer.info.screen_win.y      = 0;
+		ctx->sunxiCtx.layer.info.screen_win.width  = ctx->vInfo.xres;
+		ctx->sunxiCtx.layer.info.screen_win.height = ctx->vInfo.yres;
 
-		sunxiCtx.layer.info.b_trd_out    = false;
-		sunxiCtx.layer.info.out_trd_mode = 0;
+		ctx->sunxiCtx.layer.info.b_trd_out    = false;
+		ctx->sunxiCtx.layer.info.out_trd_mode = 0;
 
 		// disp_fb_info2
 		// NOTE: fd & y8_fd are handled in mmap_ion.
@@ -5035,121 +5299,123 @@ static __attribute__((cold)) int
 		// disp_rectsz
 		// NOTE: Used in conjunction with align below.
 		//       We obviously only have a single buffer, because we're not a 3D display...
-		sunxiCtx.layer.info.fb.size[0].width  = vInfo.xres_virtual;
-		sunxiCtx.layer.info.fb.size[0].height = vInfo.yres_virtual;
-		sunxiCtx.layer.info.fb.size[1].width  = 0U;
-		sunxiCtx.layer.info.fb.size[1].height = 0U;
-		sunxiCtx.layer.info.fb.size[2].width  = 0U;
-		sunxiCtx.layer.info.fb.size[2].height = 0U;
+		ctx->sunxiCtx.layer.info.fb.size[0].width  = ctx->vInfo.xres_virtual;
+		ctx->sunxiCtx.layer.info.fb.size[0].height = ctx->vInfo.yres_virtual;
+		ctx->sunxiCtx.layer.info.fb.size[1].width  = 0U;
+		ctx->sunxiCtx.layer.info.fb.size[1].height = 0U;
+		ctx->sunxiCtx.layer.info.fb.size[2].width  = 0U;
+		ctx->sunxiCtx.layer.info.fb.size[2].height = 0U;
 
 		// NOTE: Used to compute the scanline pitch in bytes (e.g., pitch = ALIGN(scanline_pixels * components, align).
 		//       This is set to 2 by Nickel, but we appear to go by without it just fine with a Y8 fb fd...
-		sunxiCtx.layer.info.fb.align[0]      = 0U;
-		sunxiCtx.layer.info.fb.align[1]      = 0U;
-		sunxiCtx.layer.info.fb.align[2]      = 0U;
-		sunxiCtx.layer.info.fb.format        = DISP_FORMAT_8BIT_GRAY;
-		sunxiCtx.layer.info.fb.color_space   = DISP_GBR_F;    // Full-range RGB
-		sunxiCtx.layer.info.fb.trd_right_fd  = 0;
-		sunxiCtx.layer.info.fb.pre_multiply  = true;    // Because we're using global alpha, I guess?
-		sunxiCtx.layer.info.fb.crop.x        = 0;
-		sunxiCtx.layer.info.fb.crop.y        = 0;
+		ctx->sunxiCtx.layer.info.fb.align[0]      = 0U;
+		ctx->sunxiCtx.layer.info.fb.align[1]      = 0U;
+		ctx->sunxiCtx.layer.info.fb.align[2]      = 0U;
+		ctx->sunxiCtx.layer.info.fb.format        = DISP_FORMAT_8BIT_GRAY;
+		ctx->sunxiCtx.layer.info.fb.color_space   = DISP_GBR_F;    // Full-range RGB
+		ctx->sunxiCtx.layer.info.fb.trd_right_fd  = 0;
+		ctx->sunxiCtx.layer.info.fb.pre_multiply  = true;    // Because we're using global alpha, I guess?
+		ctx->sunxiCtx.layer.info.fb.crop.x        = 0;
+		ctx->sunxiCtx.layer.info.fb.crop.y        = 0;
 		// Don't ask me why this needs to be shifted 32 bits to the left... ¯\_(ツ)_/¯
 		// NOTE: I managed to bork it during the KOReader port and it appeared to behave fine *without* the shift...
-		sunxiCtx.layer.info.fb.crop.width    = (long long int) vInfo.xres << 32;
-		sunxiCtx.layer.info.fb.crop.height   = (long long int) vInfo.yres << 32;
-		sunxiCtx.layer.info.fb.flags         = DISP_BF_NORMAL;
-		sunxiCtx.layer.info.fb.scan          = DISP_SCAN_PROGRESSIVE;
-		sunxiCtx.layer.info.fb.eotf          = DISP_EOTF_GAMMA22;    // SDR
-		sunxiCtx.layer.info.fb.depth         = 0;
-		sunxiCtx.layer.info.fb.fbd_en        = 0U;
-		sunxiCtx.layer.info.fb.metadata_fd   = 0;
-		sunxiCtx.layer.info.fb.metadata_size = 0U;
-		sunxiCtx.layer.info.fb.metadata_flag = 0U;
-
-		sunxiCtx.layer.info.id = 0U;
+		ctx->sunxiCtx.layer.info.fb.crop.width    = (long long int) ctx->vInfo.xres << 32;
+		ctx->sunxiCtx.layer.info.fb.crop.height   = (long long int) ctx->vInfo.yres << 32;
+		ctx->sunxiCtx.layer.info.fb.flags         = DISP_BF_NORMAL;
+		ctx->sunxiCtx.layer.info.fb.scan          = DISP_SCAN_PROGRESSIVE;
+		ctx->sunxiCtx.layer.info.fb.eotf          = DISP_EOTF_GAMMA22;    // SDR
+		ctx->sunxiCtx.layer.info.fb.depth         = 0;
+		ctx->sunxiCtx.layer.info.fb.fbd_en        = 0U;
+		ctx->sunxiCtx.layer.info.fb.metadata_fd   = 0;
+		ctx->sunxiCtx.layer.info.fb.metadata_size = 0U;
+		ctx->sunxiCtx.layer.info.fb.metadata_flag = 0U;
+
+		ctx->sunxiCtx.layer.info.id = 0U;
 
 		// disp_atw_info
-		sunxiCtx.layer.info.atw.used   = false;
-		sunxiCtx.layer.info.atw.mode   = 0;
-		sunxiCtx.layer.info.atw.b_row  = 0;
-		sunxiCtx.layer.info.atw.b_col  = 0;
-		sunxiCtx.layer.info.atw.cof_fd = 0;
-
-		sunxiCtx.layer.enable   = true;
-		sunxiCtx.layer.channel  = 0U;
+		ctx->sunxiCtx.layer.info.atw.used   = false;
+		ctx->sunxiCtx.layer.info.atw.mode   = 0;
+		ctx->sunxiCtx.layer.info.atw.b_row  = 0;
+		ctx->sunxiCtx.layer.info.atw.b_col  = 0;
+		ctx->sunxiCtx.layer.info.atw.cof_fd = 0;
+
+		ctx->sunxiCtx.layer.enable   = true;
+		ctx->sunxiCtx.layer.channel  = 0U;
 		// NOTE: Nickel uses layer 0, pickel layer 1.
-		sunxiCtx.layer.layer_id = 1U;
+		ctx->sunxiCtx.layer.layer_id = 1U;
 	}
 #	endif
 
 	// NOTE: Well, granted, this next part is (hopefully) Kobo-specific ;).
 	// Handle the Kobo viewport trickery for the few devices with hidden rows of pixels...
-	if (fbink_cfg->no_viewport || deviceQuirks.koboVertOffset == 0) {
+	if (fbink_cfg->no_viewport || ctx->deviceQuirks.koboVertOffset == 0) {
 		// Device is not utterly mad, the top-left corner is at (0, 0)!
-		viewWidth      = screenWidth;
-		viewHoriOrigin = 0U;
-		viewHeight     = screenHeight;
-		viewVertOrigin = 0U;
+		ctx->viewWidth      = ctx->screenWidth;
+		ctx->viewHoriOrigin = 0U;
+		ctx->viewHeight     = ctx->screenHeight;
+		ctx->viewVertOrigin = 0U;
 	} else {
 		// Device has a few rows of pixels hidden behind the bezel, what fun...
 		switch (canonical_rota) {
 			case FB_ROTATE_UR:
-				viewWidth      = screenWidth;
-				viewHoriOrigin = 0U;
-				viewHeight     = screenHeight - (uint32_t) abs(deviceQuirks.koboVertOffset);
-				if (deviceQuirks.koboVertOffset > 0) {
+				ctx->viewWidth      = ctx->screenWidth;
+				ctx->viewHoriOrigin = 0U;
+				ctx->viewHeight     =
+				    ctx->screenHeight - (uint32_t) abs(ctx->deviceQuirks.koboVertOffset);
+				if (ctx->deviceQuirks.koboVertOffset > 0) {
 					// Rows of pixels are hidden at the (physical) top
-					viewVertOrigin = (uint8_t) deviceQuirks.koboVertOffset;
+					ctx->viewVertOrigin = (uint8_t) ctx->deviceQuirks.koboVertOffset;
 				} else {
 					// Rows of pixels are hidden at the (physical) bottom
-					viewVertOrigin = 0U;
+					ctx->viewVertOrigin = 0U;
 				}
 				break;
 			case FB_ROTATE_CW:
-				viewWidth = screenWidth - (uint32_t) abs(deviceQuirks.koboVertOffset);
-				if (deviceQuirks.koboVertOffset > 0) {
+				ctx->viewWidth = ctx->screenWidth - (uint32_t) abs(ctx->deviceQuirks.koboVertOffset);
+				if (ctx->deviceQuirks.koboVertOffset > 0) {
 					// Rows of pixels are hidden at the (physical) top
-					viewHoriOrigin = 0U;
+					ctx->viewHoriOrigin = 0U;
 				} else {
 					// Rows of pixels are hidden at the (physical) bottom
-					viewHoriOrigin = (uint8_t) deviceQuirks.koboVertOffset;
+					ctx->viewHoriOrigin = (uint8_t) ctx->deviceQuirks.koboVertOffset;
 				}
-				viewHeight     = screenHeight;
-				viewVertOrigin = 0U;
+				ctx->viewHeight     = ctx->screenHeight;
+				ctx->viewVertOrigin = 0U;
 				break;
 			case FB_ROTATE_UD:
-				viewWidth      = screenWidth;
-				viewHoriOrigin = 0U;
-				viewHeight     = screenHeight - (uint32_t) abs(deviceQuirks.koboVertOffset);
-				if (deviceQuirks.koboVertOffset > 0) {
+				ctx->viewWidth      = ctx->screenWidth;
+				ctx->viewHoriOrigin = 0U;
+				ctx->viewHeight     =
+				    ctx->screenHeight - (uint32_t) abs(ctx->deviceQuirks.koboVertOffset);
+				if (ctx->deviceQuirks.koboVertOffset > 0) {
 					// Rows of pixels are hidden at the (physical) top
-					viewVertOrigin = 0U;
+					ctx->viewVertOrigin = 0U;
 				} else {
 					// Rows of pixels are hidden at the (physical) bottom
-					viewVertOrigin = (uint8_t) deviceQuirks.koboVertOffset;
+					ctx->viewVertOrigin = (uint8_t) ctx->deviceQuirks.koboVertOffset;
 				}
 				break;
 			case FB_ROTATE_CCW:
-				viewWidth = screenWidth - (uint32_t) abs(deviceQuirks.koboVertOffset);
-				if (deviceQuirks.koboVertOffset > 0) {
+				ctx->viewWidth = ctx->screenWidth - (uint32_t) abs(ctx->deviceQuirks.koboVertOffset);
+				if (ctx->deviceQuirks.koboVertOffset > 0) {
 					// Rows of pixels are hidden at the (physical) top
-					viewHoriOrigin = (uint8_t) deviceQuirks.koboVertOffset;
+					ctx->viewHoriOrigin = (uint8_t) ctx->deviceQuirks.koboVertOffset;
 				} else {
 					// Rows of pixels are hidden at the (physical) bottom
-					viewHoriOrigin = 0U;
+					ctx->viewHoriOrigin = 0U;
 				}
-				viewHeight     = screenHeight;
-				viewVertOrigin = 0U;
+				ctx->viewHeight     = ctx->screenHeight;
+				ctx->viewVertOrigin = 0U;
 				break;
 		}
 
 		ELOG("Enabled Kobo viewport insanity (%ux%u -> %ux%u), top-left corner is @ (%hhu, %hhu)",
-		     screenWidth,
-		     screenHeight,
-		     viewWidth,
-		     viewHeight,
-		     viewHoriOrigin,
-		     viewVertOrigin);
+		     ctx->screenWidth,
+		     ctx->screenHeight,
+		     ctx->viewWidth,
+		     ctx->viewHeight,
+		     ctx->viewHoriOrigin,
+		     ctx->viewVertOrigin);
 	}
 #elif defined(FBINK_FOR_POCKETBOOK)
 	// NOTE: Some PocketBook devices have their panel mounted sideways, like the NTX boards we handled above...
@@ -5158,29 +5424,29 @@ static __attribute__((cold)) int
 	//       Obviously, the broadness of this check severely limits the possibility of actually handling hardware rotations
 	//       sanely, but for now, we only want to deal with the default rotation properly...
 	if (!getenv("FBINK_NO_SW_ROTA")) {
-		if (vInfo.xres > vInfo.yres) {
-			screenWidth     = vInfo.yres;
-			screenHeight    = vInfo.xres;
-			fxpRotateCoords = &rotate_coordinates_pickel;
-			fxpRotateRegion = &rotate_region_pickel;
+		if (ctx->vInfo.xres > ctx->vInfo.yres) {
+			ctx->screenWidth     = ctx->vInfo.yres;
+			ctx->screenHeight    = ctx->vInfo.xres;
+			ctx->fxpRotateCoords = &rotate_coordinates_pickel;
+			ctx->fxpRotateRegion = &rotate_region_pickel;
 			ELOG("Enabled PocketBook rotation quirks (%ux%u -> %ux%u)",
-			     vInfo.xres,
-			     vInfo.yres,
-			     screenWidth,
-			     screenHeight);
+			     ctx->vInfo.xres,
+			     ctx->vInfo.yres,
+			     ctx->screenWidth,
+			     ctx->screenHeight);
 		}
 	}
 
-	viewWidth      = screenWidth;
-	viewHoriOrigin = 0U;
-	viewHeight     = screenHeight;
-	viewVertOrigin = 0U;
+	ctx->viewWidth      = ctx->screenWidth;
+	ctx->viewHoriOrigin = 0U;
+	ctx->viewHeight     = ctx->screenHeight;
+	ctx->viewVertOrigin = 0U;
 #else
 	// Other devices are generally never broken-by-design (at least not on that front ;))
-	viewWidth      = screenWidth;
-	viewHoriOrigin = 0U;
-	viewHeight     = screenHeight;
-	viewVertOrigin = 0U;
+	ctx->viewWidth      = ctx->screenWidth;
+	ctx->viewHoriOrigin = 0U;
+	ctx->viewHeight     = ctx->screenHeight;
+	ctx->viewVertOrigin = 0U;
 #endif
 
 #ifdef FBINK_WITH_BITMAP
@@ -5191,170 +5457,170 @@ static __attribute__((cold)) int
 	// Setup custom fonts (glyph size, render fx, bitmap fx)
 	switch (fbink_cfg->fontname) {
 		case VGA:
-			glyphWidth         = 8U;
-			glyphHeight        = 16U;
-			fxpFont8xGetBitmap = &vga_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 16U;
+			ctx->fxpFont8xGetBitmap = &vga_get_bitmap;
 			break;
 		case MICROKNIGHT:
-			glyphWidth         = 8U;
-			glyphHeight        = 16U;
-			fxpFont8xGetBitmap = &microknight_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 16U;
+			ctx->fxpFont8xGetBitmap = &microknight_get_bitmap;
 			break;
 		case TOPAZ:
-			glyphWidth         = 8U;
-			glyphHeight        = 16U;
-			fxpFont8xGetBitmap = &topaz_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 16U;
+			ctx->fxpFont8xGetBitmap = &topaz_get_bitmap;
 			break;
 		case TEWIB:
-			glyphWidth         = 6U;
-			glyphHeight        = 13U;
-			fxpFont8xGetBitmap = &tewib_get_bitmap;
+			ctx->glyphWidth         = 6U;
+			ctx->glyphHeight        = 13U;
+			ctx->fxpFont8xGetBitmap = &tewib_get_bitmap;
 			break;
 		case TEWI:
-			glyphWidth         = 6U;
-			glyphHeight        = 13U;
-			fxpFont8xGetBitmap = &tewi_get_bitmap;
+			ctx->glyphWidth         = 6U;
+			ctx->glyphHeight        = 13U;
+			ctx->fxpFont8xGetBitmap = &tewi_get_bitmap;
 			break;
 		case SPLEEN:
-			glyphWidth          = 16U;
-			glyphHeight         = 32U;
-			fxpFont16xGetBitmap = &spleen_get_bitmap;
+			ctx->glyphWidth          = 16U;
+			ctx->glyphHeight         = 32U;
+			ctx->fxpFont16xGetBitmap = &spleen_get_bitmap;
 			break;
 		case FATTY:
-			glyphWidth         = 7U;
-			glyphHeight        = 16U;
-			fxpFont8xGetBitmap = &fatty_get_bitmap;
+			ctx->glyphWidth         = 7U;
+			ctx->glyphHeight        = 16U;
+			ctx->fxpFont8xGetBitmap = &fatty_get_bitmap;
 			break;
 		case TERMINUSB:
-			glyphWidth         = 8U;
-			glyphHeight        = 16U;
-			fxpFont8xGetBitmap = &terminusb_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 16U;
+			ctx->fxpFont8xGetBitmap = &terminusb_get_bitmap;
 			break;
 		case TERMINUS:
-			glyphWidth         = 8U;
-			glyphHeight        = 16U;
-			fxpFont8xGetBitmap = &terminus_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 16U;
+			ctx->fxpFont8xGetBitmap = &terminus_get_bitmap;
 			break;
 		case SCIENTIFICAI:
-			glyphWidth         = 7U;
-			glyphHeight        = 12U;
-			fxpFont8xGetBitmap = &scientificai_get_bitmap;
+			ctx->glyphWidth         = 7U;
+			ctx->glyphHeight        = 12U;
+			ctx->fxpFont8xGetBitmap = &scientificai_get_bitmap;
 			break;
 		case SCIENTIFICAB:
-			glyphWidth         = 5U;
-			glyphHeight        = 12U;
-			fxpFont8xGetBitmap = &scientificab_get_bitmap;
+			ctx->glyphWidth         = 5U;
+			ctx->glyphHeight        = 12U;
+			ctx->fxpFont8xGetBitmap = &scientificab_get_bitmap;
 			break;
 		case SCIENTIFICA:
-			glyphWidth         = 5U;
-			glyphHeight        = 12U;
-			fxpFont8xGetBitmap = &scientifica_get_bitmap;
+			ctx->glyphWidth         = 5U;
+			ctx->glyphHeight        = 12U;
+			ctx->fxpFont8xGetBitmap = &scientifica_get_bitmap;
 			break;
 		case ORPI:
-			glyphWidth         = 6U;
-			glyphHeight        = 12U;
-			fxpFont8xGetBitmap = &orpi_get_bitmap;
+			ctx->glyphWidth         = 6U;
+			ctx->glyphHeight        = 12U;
+			ctx->fxpFont8xGetBitmap = &orpi_get_bitmap;
 			break;
 		case ORPB:
-			glyphWidth         = 6U;
-			glyphHeight        = 12U;
-			fxpFont8xGetBitmap = &orpb_get_bitmap;
+			ctx->glyphWidth         = 6U;
+			ctx->glyphHeight        = 12U;
+			ctx->fxpFont8xGetBitmap = &orpb_get_bitmap;
 			break;
 		case ORP:
-			glyphWidth         = 6U;
-			glyphHeight        = 12U;
-			fxpFont8xGetBitmap = &orp_get_bitmap;
+			ctx->glyphWidth         = 6U;
+			ctx->glyphHeight        = 12U;
+			ctx->fxpFont8xGetBitmap = &orp_get_bitmap;
 			break;
 		case CTRLD:
-			glyphWidth         = 8U;
-			glyphHeight        = 16U;
-			fxpFont8xGetBitmap = &ctrld_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 16U;
+			ctx->fxpFont8xGetBitmap = &ctrld_get_bitmap;
 			break;
 		case FKP:
-			glyphWidth         = 8U;
-			glyphHeight        = 16U;
-			fxpFont8xGetBitmap = &fkp_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 16U;
+			ctx->fxpFont8xGetBitmap = &fkp_get_bitmap;
 			break;
 		case KATES:
-			glyphWidth         = 7U;
-			glyphHeight        = 15U;
-			fxpFont8xGetBitmap = &kates_get_bitmap;
+			ctx->glyphWidth         = 7U;
+			ctx->glyphHeight        = 15U;
+			ctx->fxpFont8xGetBitmap = &kates_get_bitmap;
 			break;
 		case VEGGIE:
-			glyphWidth         = 8U;
-			glyphHeight        = 16U;
-			fxpFont8xGetBitmap = &veggie_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 16U;
+			ctx->fxpFont8xGetBitmap = &veggie_get_bitmap;
 			break;
 		case LEGGIE:
-			glyphWidth         = 8U;
-			glyphHeight        = 18U;
-			fxpFont8xGetBitmap = &leggie_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 18U;
+			ctx->fxpFont8xGetBitmap = &leggie_get_bitmap;
 			break;
 		case BLOCK:
-			glyphWidth          = 32U;
-			glyphHeight         = 32U;
+			ctx->glyphWidth          = 32U;
+			ctx->glyphHeight         = 32U;
 			// An horizontal resolution > 8 means a different data type...
-			fxpFont32xGetBitmap = &block_get_bitmap;
+			ctx->fxpFont32xGetBitmap = &block_get_bitmap;
 			break;
 		case UNSCII_TALL:
-			glyphWidth         = 8U;
-			glyphHeight        = 16U;
-			fxpFont8xGetBitmap = &tall_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 16U;
+			ctx->fxpFont8xGetBitmap = &tall_get_bitmap;
 			break;
 		case UNSCII_MCR:
-			glyphWidth         = 8U;
-			glyphHeight        = 8U;
-			fxpFont8xGetBitmap = &mcr_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 8U;
+			ctx->fxpFont8xGetBitmap = &mcr_get_bitmap;
 			break;
 		case UNSCII_FANTASY:
-			glyphWidth         = 8U;
-			glyphHeight        = 8U;
-			fxpFont8xGetBitmap = &fantasy_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 8U;
+			ctx->fxpFont8xGetBitmap = &fantasy_get_bitmap;
 			break;
 		case UNSCII_THIN:
-			glyphWidth         = 8U;
-			glyphHeight        = 8U;
-			fxpFont8xGetBitmap = &thin_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 8U;
+			ctx->fxpFont8xGetBitmap = &thin_get_bitmap;
 			break;
 		case UNSCII_ALT:
-			glyphWidth         = 8U;
-			glyphHeight        = 8U;
-			fxpFont8xGetBitmap = &alt_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 8U;
+			ctx->fxpFont8xGetBitmap = &alt_get_bitmap;
 			break;
 		case UNSCII:
-			glyphWidth         = 8U;
-			glyphHeight        = 8U;
-			fxpFont8xGetBitmap = &unscii_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 8U;
+			ctx->fxpFont8xGetBitmap = &unscii_get_bitmap;
 			break;
 #		ifdef FBINK_WITH_UNIFONT
 		case UNIFONT:
-			glyphWidth         = 8U;
-			glyphHeight        = 16U;
-			fxpFont8xGetBitmap = &unifont_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 16U;
+			ctx->fxpFont8xGetBitmap = &unifont_get_bitmap;
 			break;
 		case UNIFONTDW:
-			glyphWidth          = 16U;
-			glyphHeight         = 16U;
-			fxpFont16xGetBitmap = &unifontdw_get_bitmap;
+			ctx->glyphWidth          = 16U;
+			ctx->glyphHeight         = 16U;
+			ctx->fxpFont16xGetBitmap = &unifontdw_get_bitmap;
 			break;
 #		endif
 		case COZETTE:
-			glyphWidth         = 8U;
-			glyphHeight        = 13U;
-			fxpFont8xGetBitmap = &cozette_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 13U;
+			ctx->fxpFont8xGetBitmap = &cozette_get_bitmap;
 			break;
 		case IBM:
 		default:
-			glyphWidth         = 8U;
-			glyphHeight        = 8U;
-			fxpFont8xGetBitmap = &font8x8_get_bitmap;
+			ctx->glyphWidth         = 8U;
+			ctx->glyphHeight        = 8U;
+			ctx->fxpFont8xGetBitmap = &font8x8_get_bitmap;
 			break;
 	}
 #	else
 	// Default font is IBM
-	glyphWidth         = 8U;
-	glyphHeight        = 8U;
-	fxpFont8xGetBitmap = &font8x8_get_bitmap;
+	ctx->glyphWidth         = 8U;
+	ctx->glyphHeight        = 8U;
+	ctx->fxpFont8xGetBitmap = &font8x8_get_bitmap;
 
 	if (fbink_cfg->fontname != IBM) {
 		ELOG("Custom fonts are not supported in this FBInk build, using IBM instead.");
@@ -5364,7 +5630,7 @@ static __attribute__((cold)) int
 
 	// Obey user-specified font scaling multiplier
 	if (fbink_cfg->fontmult > 0) {
-		FONTSIZE_MULT = fbink_cfg->fontmult;
+		ctx->FONTSIZE_MULT = fbink_cfg->fontmult;
 		uint8_t max_fontmult;
 
 		// NOTE: Clamp to safe values to avoid a division by zero later if a glyph becomes so big
@@ -5380,138 +5646,140 @@ static __attribute__((cold)) int
 #ifdef FBINK_WITH_FONTS
 		// NOTE: Handle custom fonts, no matter their base glyph size...
 		// We want at least N columns, so, viewWidth / N / glyphWidth gives us the maximum multiplier.
-		const uint8_t max_fontmult_width  = (uint8_t) (viewWidth / min_maxcols / glyphWidth);
+		const uint8_t max_fontmult_width  = (uint8_t) (ctx->viewWidth / min_maxcols / ctx->glyphWidth);
 		// We want at least 1 row, so, viewHeight / glyphHeight gives us the maximum multiplier.
-		const uint8_t max_fontmult_height = (uint8_t) (viewHeight / glyphHeight);
+		const uint8_t max_fontmult_height = (uint8_t) (ctx->viewHeight / ctx->glyphHeight);
 		max_fontmult                      = (uint8_t) MIN(max_fontmult_width, max_fontmult_height);
-		if (FONTSIZE_MULT > max_fontmult) {
-			FONTSIZE_MULT = max_fontmult;
+		if (ctx->FONTSIZE_MULT > max_fontmult) {
+			ctx->FONTSIZE_MULT = max_fontmult;
 			ELOG("Clamped font size multiplier from %hhu to %hhu", fbink_cfg->fontmult, max_fontmult);
 		}
 #else
 		// The default font's glyphs are 8x8, do the least amount of work possible ;).
-		max_fontmult = (uint8_t) (viewWidth / min_maxcols / 8U);
-		if (FONTSIZE_MULT > max_fontmult) {
-			FONTSIZE_MULT = max_fontmult;
+		max_fontmult = (uint8_t) (ctx->viewWidth / min_maxcols / 8U);
+		if (ctx->FONTSIZE_MULT > max_fontmult) {
+			ctx->FONTSIZE_MULT = max_fontmult;
 			ELOG("Clamped font size multiplier from %hhu to %hhu", fbink_cfg->fontmult, max_fontmult);
 		}
 #endif
 	} else {
 		// Set font-size based on screen DPI
 		// (roughly matches: Linux (96), Pearl (167), Carta (212), 6.8" Carta (265), 6/7/8" Carta HD (300))
-		if (deviceQuirks.screenDPI <= 212U) {
+		if (ctx->deviceQuirks.screenDPI <= 212U) {
 			// Most of these should be 6", with the notable exception of the DX/DXg ;).
-			FONTSIZE_MULT = 2U;    // 16x16
-		} else if (deviceQuirks.screenDPI <= 265U) {
+			ctx->FONTSIZE_MULT = 2U;    // 16x16
+		} else if (ctx->deviceQuirks.screenDPI <= 265U) {
 			// All of these 265dpi devices are from NTX/Kobo, and feature a 6.8" screen,
 			// so we have horizontal space to spare to justify the higher scaling factor ;).
-			FONTSIZE_MULT = 3U;    // 24x24
+			ctx->FONTSIZE_MULT = 3U;    // 24x24
 		} else {
 			// NOTE: Try to differentiate between 6" devices and larger screens,
 			//       because we'll want a smaller scaling factor on 6" devices,
 			//       because column space is sparse there ;).
-			const uint32_t actual_height = MAX(vInfo.xres, vInfo.yres);
+			const uint32_t actual_height = MAX(ctx->vInfo.xres, ctx->vInfo.yres);
 			if (actual_height <= 1448U) {
 				// That should cover everyone (Voyage/Oasis 1/PaperWhite 3 & 4/Glo HD/Clara HD)
-				FONTSIZE_MULT = 3U;    // 24x24
+				ctx->FONTSIZE_MULT = 3U;    // 24x24
 			} else {
 				// We have more headroom on larger screens ;) (Oasis 2/Forma)
-				FONTSIZE_MULT = 4U;    // 32x32
+				ctx->FONTSIZE_MULT = 4U;    // 32x32
 			}
 		}
 #ifdef FBINK_WITH_FONTS
 		if (fbink_cfg->fontname == BLOCK) {
 			// Block is roughly 4 times wider than other fonts, compensate for that...
-			FONTSIZE_MULT = (uint8_t) MAX(1U, FONTSIZE_MULT / 4U);
+			ctx->FONTSIZE_MULT = (uint8_t) MAX(1U, ctx->FONTSIZE_MULT / 4U);
 #	ifdef FBINK_WITH_UNIFONT
 		} else if (fbink_cfg->fontname == SPLEEN || fbink_cfg->fontname == UNIFONTDW) {
 #	else
 		} else if (fbink_cfg->fontname == SPLEEN) {
 #	endif
 			// Spleen & Unifont DW are roughly twice as wide as other fonts, compensate for that...
-			FONTSIZE_MULT = (uint8_t) MAX(1U, FONTSIZE_MULT / 2U);
+			ctx->FONTSIZE_MULT = (uint8_t) MAX(1U, ctx->FONTSIZE_MULT / 2U);
 		}
 #endif
 	}
 	// Go!
-	FONTW = (unsigned short int) (glyphWidth * FONTSIZE_MULT);
-	FONTH = (unsigned short int) (glyphHeight * FONTSIZE_MULT);
+	ctx->FONTW = (unsigned short int) (ctx->glyphWidth * ctx->FONTSIZE_MULT);
+	ctx->FONTH = (unsigned short int) (ctx->glyphHeight * ctx->FONTSIZE_MULT);
 	ELOG("Fontsize set to %hux%hu (%s base glyph size: %hhux%hhu)",
-	     FONTW,
-	     FONTH,
+	     ctx->FONTW,
+	     ctx->FONTH,
 	     fontname_to_string(fbink_cfg->fontname),
-	     glyphWidth,
-	     glyphHeight);
+	     ctx->glyphWidth,
+	     ctx->glyphHeight);
 
 	// Compute MAX* values now that we know the screen & font resolution
-	MAXCOLS = (unsigned short int) (viewWidth / FONTW);
-	MAXROWS = (unsigned short int) (viewHeight / FONTH);
-	ELOG("Line length: %hu cols, Page size: %hu rows", MAXCOLS, MAXROWS);
+	ctx->MAXCOLS = (unsigned short int) (ctx->viewWidth / ctx->FONTW);
+	ctx->MAXROWS = (unsigned short int) (ctx->viewHeight / ctx->FONTH);
+	ELOG("Line length: %hu cols, Page size: %hu rows", ctx->MAXCOLS, ctx->MAXROWS);
 
 	// Mention & remember if we can perfectly fit the final column on screen
-	if ((uint32_t) (FONTW * MAXCOLS) == viewWidth) {
-		deviceQuirks.isPerfectFit = true;
+	if ((uint32_t) (ctx->FONTW * ctx->MAXCOLS) == ctx->viewWidth) {
+		ctx->deviceQuirks.isPerfectFit = true;
 		ELOG("Horizontal fit is perfect!");
 	} else {
-		deviceQuirks.isPerfectFit = false;
+		ctx->deviceQuirks.isPerfectFit = false;
 	}
 
 	// In a similar fashion, add a vertical offset to make sure rows are vertically "centered",
 	// in case we can't perfectly fit the final row.
-	if ((uint32_t) (FONTH * MAXROWS) == viewHeight) {
-		viewVertOffset = 0U;
+	if ((uint32_t) (ctx->FONTH * ctx->MAXROWS) == ctx->viewHeight) {
+		ctx->viewVertOffset = 0U;
 	} else {
 		// NOTE: That should also fall under no_viewport's purview
 		if (!fbink_cfg->no_viewport) {
-			viewVertOffset = (uint8_t) (((float) (viewHeight - (uint32_t) (FONTH * MAXROWS)) / 2.0f) + 0.5f);
-			ELOG("Vertical fit isn't perfect, shifting rows down by %hhu pixels", viewVertOffset);
+			ctx->viewVertOffset =
+			    (uint8_t) (((float) (ctx->viewHeight - (uint32_t) (ctx->FONTH * ctx->MAXROWS)) / 2.0f) +
+				       0.5f);
+			ELOG("Vertical fit isn't perfect, shifting rows down by %hhu pixels", ctx->viewVertOffset);
 		} else {
-			viewVertOffset = 0U;
+			ctx->viewVertOffset = 0U;
 			ELOG("Vertical fit isn't perfect, but viewport fiddling was explicitly disabled");
 		}
 	}
 	// Bake that into the viewport computations,
 	// we'll special-case the image codepath to ignore it when row is unspecified (i.e., 0) ;).
-	viewVertOrigin = (uint8_t) (viewVertOrigin + viewVertOffset);
+	ctx->viewVertOrigin = (uint8_t) (ctx->viewVertOrigin + ctx->viewVertOffset);
 
 	// Compute the pixel format
-	switch (vInfo.bits_per_pixel) {
+	switch (ctx->vInfo.bits_per_pixel) {
 		case 4U:
-			deviceQuirks.pixelFormat = FBINK_PXFMT_Y4;
+			ctx->deviceQuirks.pixelFormat = FBINK_PXFMT_Y4;
 			break;
 		case 8U:
-			deviceQuirks.pixelFormat = FBINK_PXFMT_Y8;
+			ctx->deviceQuirks.pixelFormat = FBINK_PXFMT_Y8;
 			break;
 		case 16U:
-			if (vInfo.red.offset == 0U) {
-				deviceQuirks.pixelFormat = FBINK_PXFMT_RGB565;
-				deviceQuirks.isRGB       = true;
+			if (ctx->vInfo.red.offset == 0U) {
+				ctx->deviceQuirks.pixelFormat = FBINK_PXFMT_RGB565;
+				ctx->deviceQuirks.isRGB       = true;
 			} else {
-				deviceQuirks.pixelFormat = FBINK_PXFMT_BGR565;
+				ctx->deviceQuirks.pixelFormat = FBINK_PXFMT_BGR565;
 			}
 			break;
 		case 24U:
-			if (vInfo.red.offset == 0U) {
-				deviceQuirks.pixelFormat = FBINK_PXFMT_RGB24;
-				deviceQuirks.isRGB       = true;
+			if (ctx->vInfo.red.offset == 0U) {
+				ctx->deviceQuirks.pixelFormat = FBINK_PXFMT_RGB24;
+				ctx->deviceQuirks.isRGB       = true;
 			} else {
-				deviceQuirks.pixelFormat = FBINK_PXFMT_BGR24;
+				ctx->deviceQuirks.pixelFormat = FBINK_PXFMT_BGR24;
 			}
 			break;
 		case 32U:
-			if (vInfo.transp.length == 0U) {
-				if (vInfo.red.offset == 0U) {
-					deviceQuirks.pixelFormat = FBINK_PXFMT_RGB32;
-					deviceQuirks.isRGB       = true;
+			if (ctx->vInfo.transp.length == 0U) {
+				if (ctx->vInfo.red.offset == 0U) {
+					ctx->deviceQuirks.pixelFormat = FBINK_PXFMT_RGB32;
+					ctx->deviceQuirks.isRGB       = true;
 				} else {
-					deviceQuirks.pixelFormat = FBINK_PXFMT_BGR32;
+					ctx->deviceQuirks.pixelFormat = FBINK_PXFMT_BGR32;
 				}
 			} else {
-				if (vInfo.red.offset == 0U) {
-					deviceQuirks.pixelFormat = FBINK_PXFMT_RGBA;
-					deviceQuirks.isRGB       = true;
+				if (ctx->vInfo.red.offset == 0U) {
+					ctx->deviceQuirks.pixelFormat = FBINK_PXFMT_RGBA;
+					ctx->deviceQuirks.isRGB       = true;
 				} else {
-					deviceQuirks.pixelFormat = FBINK_PXFMT_BGRA;
+					ctx->deviceQuirks.pixelFormat = FBINK_PXFMT_BGRA;
 				}
 			}
 			break;
@@ -5522,55 +5790,55 @@ static __attribute__((cold)) int
 			goto cleanup;
 			break;
 	}
-	ELOG("Framebuffer pixel format: %s", fb_pixfmt_to_string(deviceQuirks.pixelFormat));
+	ELOG("Framebuffer pixel format: %s", fb_pixfmt_to_string(ctx->deviceQuirks.pixelFormat));
 
 #ifdef FBINK_WITH_DRAW
 	// Use the appropriate get/put pixel functions...
-	switch (deviceQuirks.pixelFormat) {
+	switch (ctx->deviceQuirks.pixelFormat) {
 		case FBINK_PXFMT_Y4:
 			//fxpPutPixel = &put_pixel_Gray4;
-			fxpGetPixel        = &get_pixel_Gray4;
-			fxpFillRect        = &fill_rect_Gray4;
-			fxpFillRectChecked = &fill_rect_Gray4_checked;
+			ctx->fxpGetPixel        = &get_pixel_Gray4;
+			ctx->fxpFillRect        = &fill_rect_Gray4;
+			ctx->fxpFillRectChecked = &fill_rect_Gray4_checked;
 			break;
 		case FBINK_PXFMT_Y8:
 			//fxpPutPixel = &put_pixel_Gray8;
-			fxpGetPixel        = &get_pixel_Gray8;
-			fxpFillRect        = &fill_rect_Gray8;
-			fxpFillRectChecked = &fill_rect_Gray8_checked;
+			ctx->fxpGetPixel        = &get_pixel_Gray8;
+			ctx->fxpFillRect        = &fill_rect_Gray8;
+			ctx->fxpFillRectChecked = &fill_rect_Gray8_checked;
 			break;
 		case FBINK_PXFMT_BGR565:
 			//fxpPutPixel = &put_pixel_RGB565;
-			fxpGetPixel        = &get_pixel_BGR565;
-			fxpFillRect        = &fill_rect_RGB565;
-			fxpFillRectChecked = &fill_rect_RGB565_checked;
+			ctx->fxpGetPixel        = &get_pixel_BGR565;
+			ctx->fxpFillRect        = &fill_rect_RGB565;
+			ctx->fxpFillRectChecked = &fill_rect_RGB565_checked;
 			break;
 		case FBINK_PXFMT_RGB565:
 			//fxpPutPixel = &put_pixel_RGB565;
-			fxpGetPixel        = &get_pixel_RGB565;
-			fxpFillRect        = &fill_rect_RGB565;
-			fxpFillRectChecked = &fill_rect_RGB565_checked;
+			ctx->fxpGetPixel        = &get_pixel_RGB565;
+			ctx->fxpFillRect        = &fill_rect_RGB565;
+			ctx->fxpFillRectChecked = &fill_rect_RGB565_checked;
 			break;
 		case FBINK_PXFMT_BGR24:
 			//fxpPutPixel = &put_pixel_BGR24;
-			fxpGetPixel        = &get_pixel_BGR24;
-			fxpFillRect        = &fill_rect_RGB24;
-			fxpFillRectChecked = &fill_rect_RGB24_checked;
+			ctx->fxpGetPixel        = &get_pixel_BGR24;
+			ctx->fxpFillRect        = &fill_rect_RGB24;
+			ctx->fxpFillRectChecked = &fill_rect_RGB24_checked;
 			break;
 		case FBINK_PXFMT_RGB24:
 			//fxpPutPixel = &put_pixel_RGB24;
-			fxpGetPixel        = &get_pixel_RGB24;
-			fxpFillRect        = &fill_rect_RGB24;
-			fxpFillRectChecked = &fill_rect_RGB24_checked;
+			ctx->fxpGetPixel        = &get_pixel_RGB24;
+			ctx->fxpFillRect        = &fill_rect_RGB24;
+			ctx->fxpFillRectChecked = &fill_rect_RGB24_checked;
 			break;
 		case FBINK_PXFMT_BGRA:
 		case FBINK_PXFMT_RGBA:
 		case FBINK_PXFMT_BGR32:
 		case FBINK_PXFMT_RGB32:
 			//fxpPutPixel = &put_pixel_RGB32;
-			fxpGetPixel        = &get_pixel_RGB32;
-			fxpFillRect        = &fill_rect_RGB32;
-			fxpFillRectChecked = &fill_rect_RGB32_checked;
+			ctx->fxpGetPixel        = &get_pixel_RGB32;
+			ctx->fxpFillRect        = &fill_rect_RGB32;
+			ctx->fxpFillRectChecked = &fill_rect_RGB32_checked;
 			break;
 		default:
 			// Huh oh... Should never happen!
@@ -5582,7 +5850,7 @@ static __attribute__((cold)) int
 
 	// Pack the pen colors into the right pixel format...
 	// NOTE: This *will* enforce grayscale, unlike fbink_set_fg/bg_pen_*!
-	if (update_pen_colors(fbink_cfg) != EXIT_SUCCESS) {
+	if (update_pen_colors(ctx, fbink_cfg) != EXIT_SUCCESS) {
 		goto cleanup;
 	}
 #endif    // FBINK_WITH_DRAW
@@ -5592,7 +5860,7 @@ static __attribute__((cold)) int
 	//       while wanting to avoid a useless open/close/open/close cycle when used as a standalone tool.
 cleanup:
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -5600,10 +5868,16 @@ cleanup:
 
 // And that's how we expose it to the API ;)
 int
-    fbink_init(int fbfd, const FBInkConfig* restrict fbink_cfg)
+    fbink_init_ctx(FBInkContext* restrict ctx, int fbfd, const FBInkConfig* restrict fbink_cfg)
 {
 	// Don't skip any ioctls on a first init ;)
-	return initialize_fbink(fbfd, fbink_cfg, false);
+	return initialize_fbink(ctx, fbfd, fbink_cfg, false);
+}
+
+int
+    fbink_init(int fbfd, const FBInkConfig* restrict fbink_cfg)
+{
+	return fbink_init_ctx(&defaultCtx, fbfd, fbink_cfg);
 }
 
 #ifdef FBINK_WITH_OPENTYPE
@@ -5626,7 +5900,7 @@ static __attribute__((cold)) const char*
 
 // Load OT fonts for fbink_add_ot_font & fbink_add_ot_font_v2
 static __attribute__((cold)) int
-    add_ot_font(const char* filename, FONT_STYLE_T style, FBInkOTFonts* restrict ot_fonts)
+    add_ot_font(FBInkContext* restrict ctx, const char* filename, FONT_STYLE_T style, FBInkOTFonts* restrict ot_fonts)
 {
 #	ifdef FBINK_FOR_KOBO
 	// NOTE: Bail if we were passed a Kobo system font, as they're obfuscated,
@@ -5639,18 +5913,18 @@ static __attribute__((cold)) int
 #	endif
 
 	// Init libunibreak the first time we're called
-	if (!otInit) {
+	if (!ctx->otInit) {
 		init_linebreak();
 		LOG("Initialized libunibreak");
 	}
-	otInit = true;
+	ctx->otInit = true;
 
 	// Open font from given path, and load into buffer
 	FILE* f                      = fopen(filename, "r" STDIO_CLOEXEC);
 	unsigned char* restrict data = NULL;
 	if (!f) {
 		PFWARN("fopen: %m");
-		otInit = false;
+		ctx->otInit = false;
 		return ERRCODE(EXIT_FAILURE);
 	} else {
 		const int   fd = fileno(f);
@@ -5658,20 +5932,20 @@ static __attribute__((cold)) int
 		if (fstat(fd, &st) == -1) {
 			PFWARN("fstat: %m");
 			fclose(f);
-			otInit = false;
+			ctx->otInit = false;
 			return ERRCODE(EXIT_FAILURE);
 		}
 		data = calloc((size_t) st.st_size, sizeof(*data));
 		if (!data) {
 			PFWARN("Error allocating font data buffer: %m");
 			fclose(f);
-			otInit = false;
+			ctx->otInit = false;
 			return ERRCODE(EXIT_FAILURE);
 		}
 		if (fread(data, 1U, (size_t) st.st_size, f) < (size_t) st.st_size || ferror(f) != 0) {
 			free(data);
 			fclose(f);
-			otInit = false;
+			ctx->otInit = false;
 			WARN("Error reading font file `%s`", filename);
 			return ERRCODE(EXIT_FAILURE);
 		}
@@ -5752,23 +6026,32 @@ static __attribute__((cold)) int
 
 // Load font from given file path. Up to four font styles may be used by FBInk at any given time.
 int
-    fbink_add_ot_font(const char* filename UNUSED_BY_MINIMAL, FONT_STYLE_T style UNUSED_BY_MINIMAL)
+    fbink_add_ot_font_ctx(FBInkContext* restrict ctx UNUSED_BY_MINIMAL,
+			  const char* filename       UNUSED_BY_MINIMAL,
+			  FONT_STYLE_T style         UNUSED_BY_MINIMAL)
 {
 #ifdef FBINK_WITH_OPENTYPE
 	// Legacy variant, using the global otFonts
 	LOG("Loading font data in the global font pool . . .");
-	return add_ot_font(filename, style, &otFonts);
+	return add_ot_font(ctx, filename, style, &ctx->otFonts);
 #else
 	WARN("OpenType support is disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
 #endif    // FBINK_WITH_OPENTYPE
 }
 
+int
+    fbink_add_ot_font(const char* filename, FONT_STYLE_T style)
+{
+	return fbink_add_ot_font_ctx(&defaultCtx, filename, style);
+}
+
 // Load font from given file path. Up to four font styles may be used per FBInkOTConfig instance.
 int
-    fbink_add_ot_font_v2(const char* filename        UNUSED_BY_MINIMAL,
-			 FONT_STYLE_T style          UNUSED_BY_MINIMAL,
-			 FBInkOTConfig* restrict cfg UNUSED_BY_MINIMAL)
+    fbink_add_ot_font_v2_ctx(FBInkContext* restrict ctx  UNUSED_BY_MINIMAL,
+			     const char* filename        UNUSED_BY_MINIMAL,
+			     FONT_STYLE_T style          UNUSED_BY_MINIMAL,
+			     FBInkOTConfig* restrict cfg UNUSED_BY_MINIMAL)
 {
 #ifdef FBINK_WITH_OPENTYPE
 	// Start by allocating an FBInkOTFonts struct, if need be...
@@ -5781,13 +6064,19 @@ int
 	}
 	// New variant, using a per-FBInkOTConfig instance
 	LOG("Loading font data in a local FBInkOTFonts instance (%p) . . .", cfg->font);
-	return add_ot_font(filename, style, (FBInkOTFonts*) cfg->font);
+	return add_ot_font(ctx, filename, style, (FBInkOTFonts*) cfg->font);
 #else
 	WARN("OpenType support is disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
 #endif    // FBINK_WITH_OPENTYPE
 }
 
+int
+    fbink_add_ot_font_v2(const char* filename, FONT_STYLE_T style, FBInkOTConfig* restrict cfg)
+{
+	return fbink_add_ot_font_v2_ctx(&defaultCtx, filename, style, cfg);
+}
+
 #ifdef FBINK_WITH_OPENTYPE
 // Free an individual OpenType font structure
 static __attribute__((cold)) int
@@ -5828,18 +6117,24 @@ static __attribute__((cold)) int
 
 // Free all OpenType fonts (as loaded by fbink_add_ot_font)
 int
-    fbink_free_ot_fonts(void)
+    fbink_free_ot_fonts_ctx(FBInkContext* restrict ctx UNUSED_BY_MINIMAL)
 {
 #ifdef FBINK_WITH_OPENTYPE
 	// Legacy variant, using the global otFonts
 	LOG("Releasing font data from the global font pool . . .");
-	return free_ot_fonts(&otFonts);
+	return free_ot_fonts(&ctx->otFonts);
 #else
 	WARN("OpenType support is disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
 #endif    // FBINK_WITH_OPENTYPE
 }
 
+int
+    fbink_free_ot_fonts(void)
+{
+	return fbink_free_ot_fonts_ctx(&defaultCtx);
+}
+
 // Same, but as loaded by fbink_add_ot_font_v2 for this specific FBInkOTConfig instance.
 int
     fbink_free_ot_fonts_v2(FBInkOTConfig* cfg UNUSED_BY_MINIMAL)
@@ -5867,7 +6162,7 @@ int
 
 // Dump a few of our internal state variables to stdout, for shell script consumption
 void
-    fbink_state_dump(const FBInkConfig* fbink_cfg)
+    fbink_state_dump_ctx(FBInkContext* restrict ctx, const FBInkConfig* fbink_cfg)
 {
 	fprintf(
 	    stdout,
@@ -5875,135 +6170,150 @@ void
 	    fbink_version(),
 	    fbink_target(),
 	    fbink_features(),
-	    viewWidth,
-	    viewHeight,
-	    screenWidth,
-	    screenHeight,
-	    viewHoriOrigin,
-	    viewVertOrigin,
-	    viewVertOffset,
-	    deviceQuirks.screenDPI,
-	    vInfo.bits_per_pixel,
-	    fInfo.line_length,
-	    !!(vInfo.bits_per_pixel == 8U && vInfo.grayscale == GRAYSCALE_8BIT_INVERTED),
-	    FONTW,
-	    FONTH,
-	    FONTSIZE_MULT,
+	    ctx->viewWidth,
+	    ctx->viewHeight,
+	    ctx->screenWidth,
+	    ctx->screenHeight,
+	    ctx->viewHoriOrigin,
+	    ctx->viewVertOrigin,
+	    ctx->viewVertOffset,
+	    ctx->deviceQuirks.screenDPI,
+	    ctx->vInfo.bits_per_pixel,
+	    ctx->fInfo.line_length,
+	    !!(ctx->vInfo.bits_per_pixel == 8U && ctx->vInfo.grayscale == GRAYSCALE_8BIT_INVERTED),
+	    ctx->FONTW,
+	    ctx->FONTH,
+	    ctx->FONTSIZE_MULT,
 	    fontname_to_string(fbink_cfg->fontname),
-	    glyphWidth,
-	    glyphHeight,
-	    MAXCOLS,
-	    MAXROWS,
-	    deviceQuirks.isPerfectFit,
-	    fInfo.id,
-	    USER_HZ,
-	    penFGColor,
-	    penBGColor,
-	    deviceQuirks.deviceName,
-	    deviceQuirks.deviceId,
-	    deviceQuirks.deviceCodename,
-	    deviceQuirks.devicePlatform,
-	    deviceQuirks.isMTK,
-	    deviceQuirks.isSunxi,
+	    ctx->glyphWidth,
+	    ctx->glyphHeight,
+	    ctx->MAXCOLS,
+	    ctx->MAXROWS,
+	    ctx->deviceQuirks.isPerfectFit,
+	    ctx->fInfo.id,
+	    ctx->USER_HZ,
+	    ctx->penFGColor,
+	    ctx->penBGColor,
+	    ctx->deviceQuirks.deviceName,
+	    ctx->deviceQuirks.deviceId,
+	    ctx->deviceQuirks.deviceCodename,
+	    ctx->deviceQuirks.devicePlatform,
+	    ctx->deviceQuirks.isMTK,
+	    ctx->deviceQuirks.isSunxi,
 #if defined(FBINK_FOR_KOBO)
-	    deviceQuirks.isTolino,
-	    sunxiCtx.has_fbdamage,
-	    sunxiCtx.force_rota,
+	    ctx->deviceQuirks.isTolino,
+	    ctx->sunxiCtx.has_fbdamage,
+	    ctx->sunxiCtx.force_rota,
 #else
 	    false,
 	    FORCE_ROTA_NOTSUP,
 #endif
-	    deviceQuirks.isKindleLegacy,
-	    deviceQuirks.isKoboNonMT,
-	    deviceQuirks.unreliableWaitFor,
-	    deviceQuirks.canWakeEPDC,
-	    deviceQuirks.ntxBootRota,
-	    deviceQuirks.ntxRotaQuirk,
-	    deviceQuirks.rotationMap[FB_ROTATE_UR],
-	    deviceQuirks.rotationMap[FB_ROTATE_CW],
-	    deviceQuirks.rotationMap[FB_ROTATE_UD],
-	    deviceQuirks.rotationMap[FB_ROTATE_CCW],
-	    deviceQuirks.touchSwapAxes,
-	    deviceQuirks.touchMirrorX,
-	    deviceQuirks.touchMirrorY,
-	    deviceQuirks.isNTX16bLandscape,
-	    vInfo.rotate,
-	    deviceQuirks.canRotate,
-	    deviceQuirks.canHWInvert,
-	    deviceQuirks.hasEclipseWfm,
-	    deviceQuirks.hasColorPanel,
-	    fb_pixfmt_to_string(deviceQuirks.pixelFormat),
-	    deviceQuirks.canWaitForSubmission);
+	    ctx->deviceQuirks.isKindleLegacy,
+	    ctx->deviceQuirks.isKoboNonMT,
+	    ctx->deviceQuirks.unreliableWaitFor,
+	    ctx->deviceQuirks.canWakeEPDC,
+	    ctx->deviceQuirks.ntxBootRota,
+	    ctx->deviceQuirks.ntxRotaQuirk,
+	    ctx->deviceQuirks.rotationMap[FB_ROTATE_UR],
+	    ctx->deviceQuirks.rotationMap[FB_ROTATE_CW],
+	    ctx->deviceQuirks.rotationMap[FB_ROTATE_UD],
+	    ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW],
+	    ctx->deviceQuirks.touchSwapAxes,
+	    ctx->deviceQuirks.touchMirrorX,
+	    ctx->deviceQuirks.touchMirrorY,
+	    ctx->deviceQuirks.isNTX16bLandscape,
+	    ctx->vInfo.rotate,
+	    ctx->deviceQuirks.canRotate,
+	    ctx->deviceQuirks.canHWInvert,
+	    ctx->deviceQuirks.hasEclipseWfm,
+	    ctx->deviceQuirks.hasColorPanel,
+	    fb_pixfmt_to_string(ctx->deviceQuirks.pixelFormat),
+	    ctx->deviceQuirks.canWaitForSubmission);
+}
+
+void
+    fbink_state_dump(const FBInkConfig* fbink_cfg)
+{
+	fbink_state_dump_ctx(&defaultCtx, fbink_cfg);
 }
 
 // Dump a few of our internal state variables to the FBInkState struct pointed to by fbink_state
 void
-    fbink_get_state(const FBInkConfig* restrict fbink_cfg, FBInkState* restrict fbink_state)
+    fbink_get_state_ctx(FBInkContext* restrict ctx,
+			const FBInkConfig* restrict fbink_cfg,
+			FBInkState* restrict fbink_state)
 {
-	fbink_state->user_hz            = USER_HZ;
+	fbink_state->user_hz            = ctx->USER_HZ;
 	fbink_state->font_name          = fontname_to_string(fbink_cfg->fontname);
-	fbink_state->view_width         = viewWidth;
-	fbink_state->view_height        = viewHeight;
-	fbink_state->screen_width       = screenWidth;
-	fbink_state->screen_height      = screenHeight;
-	fbink_state->scanline_stride    = fInfo.line_length;
-	fbink_state->bpp                = vInfo.bits_per_pixel;
-	fbink_state->inverted_grayscale = !!(vInfo.bits_per_pixel == 8U && vInfo.grayscale == GRAYSCALE_8BIT_INVERTED);
-	strcpy(fbink_state->device_name, deviceQuirks.deviceName);
-	strcpy(fbink_state->device_codename, deviceQuirks.deviceCodename);
-	strcpy(fbink_state->device_platform, deviceQuirks.devicePlatform);
-	fbink_state->device_id        = deviceQuirks.deviceId;
-	fbink_state->pen_fg_color     = penFGColor;
-	fbink_state->pen_bg_color     = penBGColor;
-	fbink_state->screen_dpi       = deviceQuirks.screenDPI;
-	fbink_state->font_w           = FONTW;
-	fbink_state->font_h           = FONTH;
-	fbink_state->max_cols         = MAXCOLS;
-	fbink_state->max_rows         = MAXROWS;
-	fbink_state->view_hori_origin = viewHoriOrigin;
-	fbink_state->view_vert_origin = viewVertOrigin;
-	fbink_state->view_vert_offset = viewVertOffset;
-	fbink_state->fontsize_mult    = FONTSIZE_MULT;
-	fbink_state->glyph_width      = glyphWidth;
-	fbink_state->glyph_height     = glyphHeight;
-	fbink_state->is_perfect_fit   = deviceQuirks.isPerfectFit;
-	fbink_state->is_mtk           = deviceQuirks.isMTK;
-	fbink_state->is_sunxi         = deviceQuirks.isSunxi;
+	fbink_state->view_width         = ctx->viewWidth;
+	fbink_state->view_height        = ctx->viewHeight;
+	fbink_state->screen_width       = ctx->screenWidth;
+	fbink_state->screen_height      = ctx->screenHeight;
+	fbink_state->scanline_stride    = ctx->fInfo.line_length;
+	fbink_state->bpp                = ctx->vInfo.bits_per_pixel;
+	fbink_state->inverted_grayscale =
+	    !!(ctx->vInfo.bits_per_pixel == 8U && ctx->vInfo.grayscale == GRAYSCALE_8BIT_INVERTED);
+	strcpy(fbink_state->device_name, ctx->deviceQuirks.deviceName);
+	strcpy(fbink_state->device_codename, ctx->deviceQuirks.deviceCodename);
+	strcpy(fbink_state->device_platform, ctx->deviceQuirks.devicePlatform);
+	fbink_state->device_id        = ctx->deviceQuirks.deviceId;
+	fbink_state->pen_fg_color     = ctx->penFGColor;
+	fbink_state->pen_bg_color     = ctx->penBGColor;
+	fbink_state->screen_dpi       = ctx->deviceQuirks.screenDPI;
+	fbink_state->font_w           = ctx->FONTW;
+	fbink_state->font_h           = ctx->FONTH;
+	fbink_state->max_cols         = ctx->MAXCOLS;
+	fbink_state->max_rows         = ctx->MAXROWS;
+	fbink_state->view_hori_origin = ctx->viewHoriOrigin;
+	fbink_state->view_vert_origin = ctx->viewVertOrigin;
+	fbink_state->view_vert_offset = ctx->viewVertOffset;
+	fbink_state->fontsize_mult    = ctx->FONTSIZE_MULT;
+	fbink_state->glyph_width      = ctx->glyphWidth;
+	fbink_state->glyph_height     = ctx->glyphHeight;
+	fbink_state->is_perfect_fit   = ctx->deviceQuirks.isPerfectFit;
+	fbink_state->is_mtk           = ctx->deviceQuirks.isMTK;
+	fbink_state->is_sunxi         = ctx->deviceQuirks.isSunxi;
 #if defined(FBINK_FOR_KOBO)
-	fbink_state->is_tolino          = deviceQuirks.isTolino;
-	fbink_state->sunxi_has_fbdamage = sunxiCtx.has_fbdamage;
-	fbink_state->sunxi_force_rota   = sunxiCtx.force_rota;
+	fbink_state->is_tolino          = ctx->deviceQuirks.isTolino;
+	fbink_state->sunxi_has_fbdamage = ctx->sunxiCtx.has_fbdamage;
+	fbink_state->sunxi_force_rota   = ctx->sunxiCtx.force_rota;
 #else
 	fbink_state->sunxi_has_fbdamage = false;
 	fbink_state->sunxi_force_rota   = FORCE_ROTA_NOTSUP;
 #endif
-	fbink_state->is_kindle_legacy    = deviceQuirks.isKindleLegacy;
-	fbink_state->is_kobo_non_mt      = deviceQuirks.isKoboNonMT;
-	fbink_state->unreliable_wait_for = deviceQuirks.unreliableWaitFor;
-	fbink_state->can_wake_epdc       = deviceQuirks.canWakeEPDC;
-	fbink_state->ntx_boot_rota       = deviceQuirks.ntxBootRota;
-	fbink_state->ntx_rota_quirk      = deviceQuirks.ntxRotaQuirk;
-	memcpy(fbink_state->rotation_map, deviceQuirks.rotationMap, sizeof(deviceQuirks.rotationMap));
-	fbink_state->touch_swap_axes         = deviceQuirks.touchSwapAxes;
-	fbink_state->touch_mirror_x          = deviceQuirks.touchMirrorX;
-	fbink_state->touch_mirror_y          = deviceQuirks.touchMirrorY;
-	fbink_state->is_ntx_quirky_landscape = deviceQuirks.isNTX16bLandscape;
-	fbink_state->current_rota            = (uint8_t) vInfo.rotate;
-	fbink_state->can_rotate              = deviceQuirks.canRotate;
-	fbink_state->can_hw_invert           = deviceQuirks.canHWInvert;
-	fbink_state->has_eclipse_wfm         = deviceQuirks.hasEclipseWfm;
-	fbink_state->has_color_panel         = deviceQuirks.hasColorPanel;
-	fbink_state->pixel_format            = deviceQuirks.pixelFormat;
-	fbink_state->can_wait_for_submission = deviceQuirks.canWaitForSubmission;
+	fbink_state->is_kindle_legacy    = ctx->deviceQuirks.isKindleLegacy;
+	fbink_state->is_kobo_non_mt      = ctx->deviceQuirks.isKoboNonMT;
+	fbink_state->unreliable_wait_for = ctx->deviceQuirks.unreliableWaitFor;
+	fbink_state->can_wake_epdc       = ctx->deviceQuirks.canWakeEPDC;
+	fbink_state->ntx_boot_rota       = ctx->deviceQuirks.ntxBootRota;
+	fbink_state->ntx_rota_quirk      = ctx->deviceQuirks.ntxRotaQuirk;
+	memcpy(fbink_state->rotation_map, ctx->deviceQuirks.rotationMap, sizeof(ctx->deviceQuirks.rotationMap));
+	fbink_state->touch_swap_axes         = ctx->deviceQuirks.touchSwapAxes;
+	fbink_state->touch_mirror_x          = ctx->deviceQuirks.touchMirrorX;
+	fbink_state->touch_mirror_y          = ctx->deviceQuirks.touchMirrorY;
+	fbink_state->is_ntx_quirky_landscape = ctx->deviceQuirks.isNTX16bLandscape;
+	fbink_state->current_rota            = (uint8_t) ctx->vInfo.rotate;
+	fbink_state->can_rotate              = ctx->deviceQuirks.canRotate;
+	fbink_state->can_hw_invert           = ctx->deviceQuirks.canHWInvert;
+	fbink_state->has_eclipse_wfm         = ctx->deviceQuirks.hasEclipseWfm;
+	fbink_state->has_color_panel         = ctx->deviceQuirks.hasColorPanel;
+	fbink_state->pixel_format            = ctx->deviceQuirks.pixelFormat;
+	fbink_state->can_wait_for_submission = ctx->deviceQuirks.canWaitForSubmission;
+}
+
+void
+    fbink_get_state(const FBInkConfig* restrict fbink_cfg, FBInkState* restrict fbink_state)
+{
+	fbink_get_state_ctx(&defaultCtx, fbink_cfg, fbink_state);
 }
 
 // Memory map the framebuffer
 static int
-    memmap_fb(int fbfd)
+    memmap_fb(FBInkContext* restrict ctx, int fbfd)
 {
 #ifdef FBINK_FOR_KOBO
-	if (deviceQuirks.isSunxi) {
-		return memmap_ion();
+	if (ctx->deviceQuirks.isSunxi) {
+		return memmap_ion(ctx);
 	}
 #endif
 
@@ -6013,13 +6323,13 @@ static int
 	//              but I've yet to see that be an issue with what I'm doing,
 	//              and trusting it is much simpler than trying to outsmart broken fb setup info...
 	//       See also the Cervantes quirk documented in clear_screen...
-	fbPtr = (unsigned char*) mmap(NULL, fInfo.smem_len, PROT_READ | PROT_WRITE, MAP_SHARED, fbfd, 0);
-	if (fbPtr == MAP_FAILED) {
+	ctx->fbPtr = (unsigned char*) mmap(NULL, ctx->fInfo.smem_len, PROT_READ | PROT_WRITE, MAP_SHARED, fbfd, 0);
+	if (ctx->fbPtr == MAP_FAILED) {
 		PFWARN("mmap: %m");
-		fbPtr = NULL;
+		ctx->fbPtr = NULL;
 		return ERRCODE(EXIT_FAILURE);
 	} else {
-		isFbMapped = true;
+		ctx->isFbMapped = true;
 	}
 
 	return EXIT_SUCCESS;
@@ -6038,23 +6348,23 @@ static void
 
 // Do the same, but via ION on sunxi...
 static int
-    memmap_ion(void)
+    memmap_ion(FBInkContext* restrict ctx)
 {
 	int rv = EXIT_SUCCESS;
 
 	// Start by registering as an ION client
-	sunxiCtx.ion_fd = open("/dev/ion", O_RDONLY | O_NONBLOCK | O_CLOEXEC);
-	if (sunxiCtx.ion_fd == -1) {
+	ctx->sunxiCtx.ion_fd = open("/dev/ion", O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+	if (ctx->sunxiCtx.ion_fd == -1) {
 		PFWARN("ion open: %m");
 		return ERRCODE(EXIT_FAILURE);
 	}
 
 	// Then request a page-aligned carveout mapping large enough to fit our screen.
-	sunxiCtx.alloc_size              = ALIGN(fInfo.smem_len, 4096);
-	struct ion_allocation_data alloc = { .len          = sunxiCtx.alloc_size,
+	ctx->sunxiCtx.alloc_size         = ALIGN(ctx->fInfo.smem_len, 4096);
+	struct ion_allocation_data alloc = { .len          = ctx->sunxiCtx.alloc_size,
 					     .align        = 4096,
 					     .heap_id_mask = ION_HEAP_MASK_CARVEOUT };
-	int                        ret   = ioctl(sunxiCtx.ion_fd, ION_IOC_ALLOC, &alloc);
+	int                        ret   = ioctl(ctx->sunxiCtx.ion_fd, ION_IOC_ALLOC, &alloc);
 	if (ret < 0) {
 		PFWARN("ION_IOC_ALLOC: %m");
 		rv = ERRCODE(EXIT_FAILURE);
@@ -6062,8 +6372,8 @@ static int
 	}
 
 	// Request a dmabuff handle that we can share & mmap for that alloc
-	sunxiCtx.ion.handle = alloc.handle;
-	ret                 = ioctl(sunxiCtx.ion_fd, ION_IOC_MAP, &sunxiCtx.ion);
+	ctx->sunxiCtx.ion.handle = alloc.handle;
+	ret                      = ioctl(ctx->sunxiCtx.ion_fd, ION_IOC_MAP, &ctx->sunxiCtx.ion);
 	if (ret < 0) {
 		PFWARN("ION_IOC_MAP: %m");
 		rv = ERRCODE(EXIT_FAILURE);
@@ -6071,14 +6381,15 @@ static int
 	}
 
 	// Finally, mmap it...
-	fbPtr = (unsigned char*) mmap(NULL, sunxiCtx.alloc_size, PROT_READ | PROT_WRITE, MAP_SHARED, sunxiCtx.ion.fd, 0);
-	if (fbPtr == MAP_FAILED) {
+	ctx->fbPtr = (unsigned char*) mmap(
+	    NULL, ctx->sunxiCtx.alloc_size, PROT_READ | PROT_WRITE, MAP_SHARED, ctx->sunxiCtx.ion.fd, 0);
+	if (ctx->fbPtr == MAP_FAILED) {
 		PFWARN("mmap: %m");
-		fbPtr = NULL;
-		rv    = ERRCODE(EXIT_FAILURE);
+		ctx->fbPtr = NULL;
+		rv         = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
 	} else {
-		isFbMapped = true;
+		ctx->isFbMapped = true;
 	}
 
 	// And finally, register as a DISP client, too
@@ -6086,7 +6397,7 @@ static int
 	//       at which point it can reliably throw an ENODEV for some mysterious reason...
 	//       O_NONBLOCK appears to only have a minimal effect on this new quirk...
 	size_t disp_retry = 0U;
-	while ((sunxiCtx.disp_fd = open("/dev/disp", O_RDONLY | O_NONBLOCK | O_CLOEXEC)) == -1) {
+	while ((ctx->sunxiCtx.disp_fd = open("/dev/disp", O_RDONLY | O_NONBLOCK | O_CLOEXEC)) == -1) {
 		// Retry a few times, waiting for a few ticks between each attempt...
 		yield_to_sunxi_disp();
 		disp_retry++;
@@ -6100,56 +6411,56 @@ static int
 	}
 
 	// And update our layer config to use that dmabuff fd, as a grayscale buffer.
-	sunxiCtx.layer.info.fb.fd    = 0;
-	sunxiCtx.layer.info.fb.y8_fd = sunxiCtx.ion.fd;
+	ctx->sunxiCtx.layer.info.fb.fd    = 0;
+	ctx->sunxiCtx.layer.info.fb.y8_fd = ctx->sunxiCtx.ion.fd;
 
 	return rv;
 
 cleanup:
-	if (isFbMapped) {
-		if (munmap(fbPtr, sunxiCtx.alloc_size) < 0) {
+	if (ctx->isFbMapped) {
+		if (munmap(ctx->fbPtr, ctx->sunxiCtx.alloc_size) < 0) {
 			PFWARN("munmap: %m");
 			rv = ERRCODE(EXIT_FAILURE);
 		} else {
-			isFbMapped          = false;
-			fbPtr               = NULL;
-			sunxiCtx.alloc_size = 0U;
+			ctx->isFbMapped          = false;
+			ctx->fbPtr               = NULL;
+			ctx->sunxiCtx.alloc_size = 0U;
 
-			if (close(sunxiCtx.ion.fd) != 0) {
+			if (close(ctx->sunxiCtx.ion.fd) != 0) {
 				PFWARN("close: %m");
 				rv = ERRCODE(EXIT_FAILURE);
 			} else {
-				sunxiCtx.ion.fd = -1;
+				ctx->sunxiCtx.ion.fd = -1;
 			}
 		}
 	}
 
-	if (sunxiCtx.ion.handle != 0) {
-		struct ion_handle_data handle = { .handle = sunxiCtx.ion.handle };
-		ret                           = ioctl(sunxiCtx.ion_fd, ION_IOC_FREE, &handle);
+	if (ctx->sunxiCtx.ion.handle != 0) {
+		struct ion_handle_data handle = { .handle = ctx->sunxiCtx.ion.handle };
+		ret                           = ioctl(ctx->sunxiCtx.ion_fd, ION_IOC_FREE, &handle);
 		if (ret < 0) {
 			PFWARN("ION_IOC_FREE: %m");
 			rv = ERRCODE(EXIT_FAILURE);
 		} else {
-			sunxiCtx.ion.handle = 0;
+			ctx->sunxiCtx.ion.handle = 0;
 		}
 	}
 
-	if (sunxiCtx.ion_fd != -1) {
-		if (close(sunxiCtx.ion_fd) != 0) {
+	if (ctx->sunxiCtx.ion_fd != -1) {
+		if (close(ctx->sunxiCtx.ion_fd) != 0) {
 			PFWARN("ion close: %m");
 			rv = ERRCODE(EXIT_FAILURE);
 		} else {
-			sunxiCtx.ion_fd = -1;
+			ctx->sunxiCtx.ion_fd = -1;
 		}
 	}
 
-	if (sunxiCtx.disp_fd != -1) {
-		if (close(sunxiCtx.disp_fd) != 0) {
+	if (ctx->sunxiCtx.disp_fd != -1) {
+		if (close(ctx->sunxiCtx.disp_fd) != 0) {
 			PFWARN("disp close: %m");
 			rv = ERRCODE(EXIT_FAILURE);
 		} else {
-			sunxiCtx.disp_fd = -1;
+			ctx->sunxiCtx.disp_fd = -1;
 		}
 	}
 
@@ -6159,73 +6470,94 @@ cleanup:
 
 // And unmap it
 static int
-    unmap_fb(void)
+    unmap_fb(FBInkContext* restrict ctx)
 {
+#ifdef FBINK_WITH_DRAW
+	// NOTE: If we're drawing to an offscreen surface, fbPtr is *not* our mapping, and the actual one is stashed away.
+	//       Since the only way we end up here is at the end of an FBFD_AUTO call, just leave everything as-is.
+	if (ctx->activeSurface) {
+		return EXIT_SUCCESS;
+	}
+#endif
+
 #ifdef FBINK_FOR_KOBO
-	if (deviceQuirks.isSunxi) {
-		return unmap_ion();
+	if (ctx->deviceQuirks.isSunxi) {
+		return unmap_ion(ctx);
 	}
 #endif
 
-	if (munmap(fbPtr, fInfo.smem_len) < 0) {
+	if (munmap(ctx->fbPtr, ctx->fInfo.smem_len) < 0) {
 		PFWARN("munmap: %m");
 		return ERRCODE(EXIT_FAILURE);
 	} else {
 		// NOTE: Don't forget to reset those state flags,
 		//       so we won't skip mmap'ing on the next call without a fb fd passed...
-		isFbMapped = false;
-		fbPtr      = NULL;
+		ctx->isFbMapped = false;
+		ctx->fbPtr      = NULL;
 	}
 
 	return EXIT_SUCCESS;
 }
 
+#ifdef FBINK_WITH_DRAW
+// Size of the framebuffer mapping
+static size_t
+    get_fb_map_size(FBInkContext* restrict ctx)
+{
+#	ifdef FBINK_FOR_KOBO
+	return ctx->deviceQuirks.isSunxi ? ctx->sunxiCtx.alloc_size : ctx->fInfo.smem_len;
+#	else
+	return ctx->fInfo.smem_len;
+#	endif
+}
+#endif    // FBINK_WITH_DRAW
+
 #ifdef FBINK_FOR_KOBO
 // And the same for ION again...
 static int
-    unmap_ion(void)
+    unmap_ion(FBInkContext* restrict ctx)
 {
 	int rv = EXIT_SUCCESS;
 
-	if (munmap(fbPtr, sunxiCtx.alloc_size) < 0) {
+	if (munmap(ctx->fbPtr, ctx->sunxiCtx.alloc_size) < 0) {
 		PFWARN("munmap: %m");
 		rv = ERRCODE(EXIT_FAILURE);
 	} else {
-		isFbMapped          = false;
-		fbPtr               = NULL;
-		sunxiCtx.alloc_size = 0U;
+		ctx->isFbMapped          = false;
+		ctx->fbPtr               = NULL;
+		ctx->sunxiCtx.alloc_size = 0U;
 
-		if (close(sunxiCtx.ion.fd) != 0) {
+		if (close(ctx->sunxiCtx.ion.fd) != 0) {
 			PFWARN("close: %m");
 			rv = ERRCODE(EXIT_FAILURE);
 		} else {
-			sunxiCtx.ion.fd = -1;
+			ctx->sunxiCtx.ion.fd = -1;
 		}
 	}
 
-	struct ion_handle_data handle = { .handle = sunxiCtx.ion.handle };
-	int                    ret    = ioctl(sunxiCtx.ion_fd, ION_IOC_FREE, &handle);
+	struct ion_handle_data handle = { .handle = ctx->sunxiCtx.ion.handle };
+	int                    ret    = ioctl(ctx->sunxiCtx.ion_fd, ION_IOC_FREE, &handle);
 	if (ret < 0) {
 		PFWARN("ION_IOC_FREE: %m");
 		rv = ERRCODE(EXIT_FAILURE);
 	} else {
-		sunxiCtx.ion.handle          = 0;
-		sunxiCtx.layer.info.fb.fd    = 0;
-		sunxiCtx.layer.info.fb.y8_fd = 0;
+		ctx->sunxiCtx.ion.handle          = 0;
+		ctx->sunxiCtx.layer.info.fb.fd    = 0;
+		ctx->sunxiCtx.layer.info.fb.y8_fd = 0;
 	}
 
-	if (close(sunxiCtx.ion_fd) != 0) {
+	if (close(ctx->sunxiCtx.ion_fd) != 0) {
 		PFWARN("close: %m");
 		rv = ERRCODE(EXIT_FAILURE);
 	} else {
-		sunxiCtx.ion_fd = -1;
+		ctx->sunxiCtx.ion_fd = -1;
 	}
 
-	if (close(sunxiCtx.disp_fd) != 0) {
+	if (close(ctx->sunxiCtx.disp_fd) != 0) {
 		PFWARN("close: %m");
 		rv = ERRCODE(EXIT_FAILURE);
 	} else {
-		sunxiCtx.disp_fd = -1;
+		ctx->sunxiCtx.disp_fd = -1;
 	}
 
 	return rv;
@@ -6234,14 +6566,14 @@ static int
 
 // Handle closing the fb's fd for FBFD_AUTO workflows
 static inline void
-    close_fb(int fbfd)
+    close_fb(FBInkContext* restrict ctx UNUSED_BY_NOTKOBO, int fbfd)
 {
 	close(fbfd);
 
 #ifdef FBINK_FOR_KOBO
-	if (deviceQuirks.isSunxi) {
+	if (ctx->deviceQuirks.isSunxi) {
 		// Also close the accelerometer I²C handle...
-		close_accelerometer_i2c();
+		close_accelerometer_i2c(ctx);
 	}
 #endif
 }
@@ -6249,12 +6581,12 @@ static inline void
 // Public helper function that handles unmapping the fb & closing its fd, for applications that want to keep both around,
 // (i.e., those that use fbink_open in the first place).
 int
-    fbink_close(int fbfd)
+    fbink_close_ctx(FBInkContext* restrict ctx, int fbfd)
 {
 	// With a few sprinkles of sanity checks, in case something *really* unexpected happen,
 	// or simply to cover a wide range of API usage.
-	if (isFbMapped) {
-		if (unmap_fb() != EXIT_SUCCESS) {
+	if (ctx->isFbMapped) {
+		if (unmap_fb(ctx) != EXIT_SUCCESS) {
 			return ERRCODE(EXIT_FAILURE);
 		}
 	}
@@ -6267,8 +6599,8 @@ int
 	}
 
 #ifdef FBINK_FOR_KOBO
-	if (deviceQuirks.isSunxi) {
-		if (close_accelerometer_i2c() != EXIT_SUCCESS) {
+	if (ctx->deviceQuirks.isSunxi) {
+		if (close_accelerometer_i2c(ctx) != EXIT_SUCCESS) {
 			WARN("Failed to close accelerometer I²C handle");
 			return ERRCODE(EXIT_FAILURE);
 		}
@@ -6278,16 +6610,22 @@ int
 	return EXIT_SUCCESS;
 }
 
+int
+    fbink_close(int fbfd)
+{
+	return fbink_close_ctx(&defaultCtx, fbfd);
+}
+
 // Much like rotate_coordinates, but for a mxcfb rectangle
 // c.f., adjust_coordinates @ drivers/video/fbdev/mxc/mxc_epdc_v2_fb.c
 #if defined(FBINK_FOR_KOBO) || defined(FBINK_FOR_CERVANTES) || defined(FBINK_FOR_POCKETBOOK)
 static void
-    rotate_region_pickel(struct mxcfb_rect* restrict region)
+    rotate_region_pickel(FBInkContext* restrict ctx, struct mxcfb_rect* restrict region)
 {
 	// Rotate the region to account for pickel's rotation...
 	struct mxcfb_rect oregion = *region;
 	// NOTE: left = x, top = y
-	region->top               = screenWidth - oregion.left - oregion.width;
+	region->top               = ctx->screenWidth - oregion.left - oregion.width;
 	region->left              = oregion.top;
 	region->width             = oregion.height;
 	region->height            = oregion.width;
@@ -6296,38 +6634,40 @@ static void
 
 #if defined(FBINK_FOR_KOBO) || defined(FBINK_FOR_CERVANTES)
 static void
-    rotate_region_boot(struct mxcfb_rect* restrict region)
+    rotate_region_boot(FBInkContext* restrict ctx, struct mxcfb_rect* restrict region)
 {
 	// Rotate the region to account for the native boot rotation...
 	struct mxcfb_rect oregion = *region;
 	// NOTE: left = x, top = y
 	region->top               = oregion.left;
-	region->left              = screenHeight - oregion.top - oregion.height;
+	region->left              = ctx->screenHeight - oregion.top - oregion.height;
 	region->width             = oregion.height;
 	region->height            = oregion.width;
 }
 #endif    // FBINK_FOR_KOBO || FBINK_FOR_CERVANTES
 
 static void
-    rotate_region_nop(struct mxcfb_rect* restrict region __attribute__((unused)))
+    rotate_region_nop(FBInkContext* restrict ctx         __attribute__((unused)),
+		      struct mxcfb_rect* restrict region __attribute__((unused)))
 {
 	// NOP! See rotate_coordinates_nop for the rationale ;)
 }
 
 // Tweak the region to cover the full screen
 static void
-    fullscreen_region(struct mxcfb_rect* restrict region)
+    fullscreen_region(FBInkContext* restrict ctx, struct mxcfb_rect* restrict region)
 {
 	region->top    = 0U;
 	region->left   = 0U;
-	region->width  = vInfo.xres;
-	region->height = vInfo.yres;
+	region->width  = ctx->vInfo.xres;
+	region->height = ctx->vInfo.yres;
 }
 
 #ifdef FBINK_WITH_DRAW
 // Helper function to allow exporting fxpFillRectChecked as a public API in slightly less convoluted ways than simply via fbink_cls ;).
 static int
-    fill_rect(int fbfd,
+    fill_rect(FBInkContext* restrict ctx,
+	      int fbfd,
 	      const FBInkConfig* restrict fbink_cfg,
 	      const FBInkRect* restrict rect,
 	      const FBInkPixel* restrict c,
@@ -6336,7 +6676,7 @@ static int
 	// If we open a fd now, we'll only keep it open for this single call!
 	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
 	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -6344,17 +6684,17 @@ static int
 	int rv = EXIT_SUCCESS;
 
 	// mmap fb to user mem
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
 	}
 
 	// If we requested to disable rotation tricks, just fudge fxpRotateRegion for the call's duration...
-	void (*actual_region_rotate_fxp)(struct mxcfb_rect* restrict) = fxpRotateRegion;
+	void (*actual_region_rotate_fxp)(FBInkContext* restrict, struct mxcfb_rect* restrict) = ctx->fxpRotateRegion;
 	if (no_rota) {
-		fxpRotateRegion = &rotate_region_nop;
+		ctx->fxpRotateRegion = &rotate_region_nop;
 	}
 
 	// We'll need a matching region for the refresh...
@@ -6370,16 +6710,16 @@ static int
 	bool full_clear = false;
 	if (!rect || (rect->width == 0U || rect->height == 0U)) {
 		// Nope -> full-screen.
-		clear_screen(fbfd, &px, fbink_cfg->is_flashing);
+		clear_screen(ctx, fbfd, &px, fbink_cfg->is_flashing);
 		full_clear    = true;
 		// Set a region for set_last_rect...
 		region.top    = 0U;
 		region.left   = 0U;
-		region.width  = screenWidth;
-		region.height = screenHeight;
+		region.width  = ctx->screenWidth;
+		region.height = ctx->screenHeight;
 	} else {
 		// Yes -> simply fill a rectangle w/ the requested color
-		(*fxpFillRectChecked)(rect->left, rect->top, rect->width, rect->height, &px);
+		(*ctx->fxpFillRectChecked)(ctx, rect->left, rect->top, rect->width, rect->height, &px);
 		// And update the region...
 		region.top    = rect->top;
 		region.left   = rect->left;
@@ -6388,20 +6728,20 @@ static int
 	}
 
 	// Remember the rect...
-	set_last_rect(&region);
+	set_last_rect(ctx, &region);
 	// Rotate the region if need be...
-	(*fxpRotateRegion)(&region);
+	(*ctx->fxpRotateRegion)(ctx, &region);
 	// Fudge the region if we asked for a screen clear, so that we actually refresh the full screen...
 	if (full_clear) {
-		fullscreen_region(&region);
+		fullscreen_region(ctx, &region);
 	}
 
 	if (no_rota) {
-		fxpRotateRegion = actual_region_rotate_fxp;
+		ctx->fxpRotateRegion = actual_region_rotate_fxp;
 	}
 
 	// Refresh screen
-	if (refresh(fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
+	if (refresh(ctx, fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
 		PFWARN("Failed to refresh the screen");
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
@@ -6409,11 +6749,11 @@ static int
 
 	// Cleanup
 cleanup:
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -6422,30 +6762,38 @@ cleanup:
 
 // Do a full-screen clear, eInk refresh included
 int
-    fbink_cls(int fbfd                              UNUSED_BY_NODRAW,
-	      const FBInkConfig* restrict fbink_cfg UNUSED_BY_NODRAW,
-	      const FBInkRect* restrict rect        UNUSED_BY_NODRAW,
-	      bool no_rota                          UNUSED_BY_NODRAW)
+    fbink_cls_ctx(FBInkContext* restrict ctx            UNUSED_BY_NODRAW,
+		  int fbfd                              UNUSED_BY_NODRAW,
+		  const FBInkConfig* restrict fbink_cfg UNUSED_BY_NODRAW,
+		  const FBInkRect* restrict rect        UNUSED_BY_NODRAW,
+		  bool no_rota                          UNUSED_BY_NODRAW)
 {
 #ifdef FBINK_WITH_DRAW
-	return fill_rect(fbfd, fbink_cfg, rect, &penBGPixel, no_rota);
+	return fill_rect(ctx, fbfd, fbink_cfg, rect, &ctx->penBGPixel, no_rota);
 #else
 	WARN("Drawing primitives are disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
 #endif
 }
 
+int
+    fbink_cls(int fbfd, const FBInkConfig* restrict fbink_cfg, const FBInkRect* restrict rect, bool no_rota)
+{
+	return fbink_cls_ctx(&defaultCtx, fbfd, fbink_cfg, rect, no_rota);
+}
+
 // Same, but with user-specified colors
 int
-    fbink_fill_rect_gray(int fbfd                              UNUSED_BY_NODRAW,
-			 const FBInkConfig* restrict fbink_cfg UNUSED_BY_NODRAW,
-			 const FBInkRect* restrict rect        UNUSED_BY_NODRAW,
-			 bool no_rota                          UNUSED_BY_NODRAW,
-			 uint8_t y                             UNUSED_BY_NODRAW)
+    fbink_fill_rect_gray_ctx(FBInkContext* restrict ctx            UNUSED_BY_NODRAW,
+			     int fbfd                              UNUSED_BY_NODRAW,
+			     const FBInkConfig* restrict fbink_cfg UNUSED_BY_NODRAW,
+			     const FBInkRect* restrict rect        UNUSED_BY_NODRAW,
+			     bool no_rota                          UNUSED_BY_NODRAW,
+			     uint8_t y                             UNUSED_BY_NODRAW)
 {
 #ifdef FBINK_WITH_DRAW
-	const FBInkPixel px = pack_pixel_from_y8(y);
-	return fill_rect(fbfd, fbink_cfg, rect, &px, no_rota);
+	const FBInkPixel px = pack_pixel_from_y8(ctx, y);
+	return fill_rect(ctx, fbfd, fbink_cfg, rect, &px, no_rota);
 #else
 	WARN("Drawing primitives are disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
@@ -6453,48 +6801,83 @@ int
 }
 
 int
-    fbink_fill_rect_rgba(int fbfd                              UNUSED_BY_NODRAW,
-			 const FBInkConfig* restrict fbink_cfg UNUSED_BY_NODRAW,
-			 const FBInkRect* restrict rect        UNUSED_BY_NODRAW,
-			 bool no_rota                          UNUSED_BY_NODRAW,
-			 uint8_t r                             UNUSED_BY_NODRAW,
-			 uint8_t g                             UNUSED_BY_NODRAW,
-			 uint8_t b                             UNUSED_BY_NODRAW,
-			 uint8_t a                             UNUSED_BY_NODRAW)
+    fbink_fill_rect_gray(int fbfd,
+			 const FBInkConfig* restrict fbink_cfg,
+			 const FBInkRect* restrict rect,
+			 bool    no_rota,
+			 uint8_t y)
+{
+	return fbink_fill_rect_gray_ctx(&defaultCtx, fbfd, fbink_cfg, rect, no_rota, y);
+}
+
+int
+    fbink_fill_rect_rgba_ctx(FBInkContext* restrict ctx            UNUSED_BY_NODRAW,
+			     int fbfd                              UNUSED_BY_NODRAW,
+			     const FBInkConfig* restrict fbink_cfg UNUSED_BY_NODRAW,
+			     const FBInkRect* restrict rect        UNUSED_BY_NODRAW,
+			     bool no_rota                          UNUSED_BY_NODRAW,
+			     uint8_t r                             UNUSED_BY_NODRAW,
+			     uint8_t g                             UNUSED_BY_NODRAW,
+			     uint8_t b                             UNUSED_BY_NODRAW,
+			     uint8_t a                             UNUSED_BY_NODRAW)
 {
 #ifdef FBINK_WITH_DRAW
-	const FBInkPixel px = pack_pixel_from_rgba(r, g, b, a);
-	return fill_rect(fbfd, fbink_cfg, rect, &px, no_rota);
+	const FBInkPixel px = pack_pixel_from_rgba(ctx, r, g, b, a);
+	return fill_rect(ctx, fbfd, fbink_cfg, rect, &px, no_rota);
 #else
 	WARN("Drawing primitives are disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
 #endif
 }
 
+int
+    fbink_fill_rect_rgba(int fbfd,
+			 const FBInkConfig* restrict fbink_cfg,
+			 const FBInkRect* restrict rect,
+			 bool    no_rota,
+			 uint8_t r,
+			 uint8_t g,
+			 uint8_t b,
+			 uint8_t a)
+{
+	return fbink_fill_rect_rgba_ctx(&defaultCtx, fbfd, fbink_cfg, rect, no_rota, r, g, b, a);
+}
+
 // Takes a pointer to a pixel packed via fbink_pack_pixel_gray/rgba
 int
-    fbink_fill_rect(int fbfd                              UNUSED_BY_NODRAW,
-		    const FBInkConfig* restrict fbink_cfg UNUSED_BY_NODRAW,
-		    const FBInkRect* restrict rect        UNUSED_BY_NODRAW,
-		    bool no_rota                          UNUSED_BY_NODRAW,
-		    void* px                              UNUSED_BY_NODRAW)
+    fbink_fill_rect_ctx(FBInkContext* restrict ctx            UNUSED_BY_NODRAW,
+			int fbfd                              UNUSED_BY_NODRAW,
+			const FBInkConfig* restrict fbink_cfg UNUSED_BY_NODRAW,
+			const FBInkRect* restrict rect        UNUSED_BY_NODRAW,
+			bool no_rota                          UNUSED_BY_NODRAW,
+			void* px                              UNUSED_BY_NODRAW)
 {
 #ifdef FBINK_WITH_DRAW
-	return fill_rect(fbfd, fbink_cfg, rect, px, no_rota);
+	return fill_rect(ctx, fbfd, fbink_cfg, rect, px, no_rota);
 #else
 	WARN("Drawing primitives are disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
 #endif
 }
 
+int
+    fbink_fill_rect(int fbfd,
+		    const FBInkConfig* restrict fbink_cfg,
+		    const FBInkRect* restrict rect,
+		    bool  no_rota,
+		    void* px)
+{
+	return fbink_fill_rect_ctx(&defaultCtx, fbfd, fbink_cfg, rect, no_rota, px);
+}
+
 // Do a full-screen invert, eInk refresh included
 int
-    fbink_invert_screen(int fbfd, const FBInkConfig* restrict fbink_cfg)
+    fbink_invert_screen_ctx(FBInkContext* restrict ctx, int fbfd, const FBInkConfig* restrict fbink_cfg)
 {
 	// If we open a fd now, we'll only keep it open for this single call!
 	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
 	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -6502,37 +6885,37 @@ int
 	int rv = EXIT_SUCCESS;
 
 	// mmap fb to user mem
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
 	}
 
 	// Similar in spirit to clear_screen, but closer to KOReader's BB_invert_rect ;).
-	if (unlikely(vInfo.bits_per_pixel == 16U)) {
+	if (unlikely(ctx->vInfo.bits_per_pixel == 16U)) {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcast-align"
-		uint16_t* p = (uint16_t*) fbPtr;
+		uint16_t* p = (uint16_t*) ctx->fbPtr;
 #pragma GCC diagnostic pop
-		size_t px_count = (size_t) vInfo.xres_virtual * vInfo.yres;
+		size_t px_count = (size_t) ctx->vInfo.xres_virtual * ctx->vInfo.yres;
 		while (px_count--) {
 			// NOTE: Not actually accurate, but I don't care about RGB565 ;).
 			*p++ ^= 0xFFFFu;
 		}
-	} else if (vInfo.bits_per_pixel == 32U) {
+	} else if (ctx->vInfo.bits_per_pixel == 32U) {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcast-align"
-		uint32_t* p = (uint32_t*) fbPtr;
+		uint32_t* p = (uint32_t*) ctx->fbPtr;
 #pragma GCC diagnostic pop
-		size_t px_count = (size_t) vInfo.xres_virtual * vInfo.yres;
+		size_t px_count = (size_t) ctx->vInfo.xres_virtual * ctx->vInfo.yres;
 		while (px_count--) {
 			*p++ ^= 0x00FFFFFFu;
 		}
 	} else {
 		// Byte per byte should do the trick for the other bitdepths
-		uint8_t* p          = fbPtr;
-		size_t   byte_count = (size_t) fInfo.line_length * vInfo.yres;
+		uint8_t* p          = ctx->fbPtr;
+		size_t   byte_count = (size_t) ctx->fInfo.line_length * ctx->vInfo.yres;
 		while (byte_count--) {
 			*p++ ^= 0xFFu;
 		}
@@ -6540,15 +6923,15 @@ int
 
 	// We'll need a matching region for the refresh...
 	struct mxcfb_rect region = { 0U };
-	fullscreen_region(&region);
+	fullscreen_region(ctx, &region);
 
 	// Remember the rect...
-	set_last_rect(&region);
+	set_last_rect(ctx, &region);
 	// Rotate the region if need be...
-	(*fxpRotateRegion)(&region);
+	(*ctx->fxpRotateRegion)(ctx, &region);
 
 	// Refresh screen
-	if (refresh(fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
+	if (refresh(ctx, fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
 		PFWARN("Failed to refresh the screen");
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
@@ -6556,28 +6939,35 @@ int
 
 	// Cleanup
 cleanup:
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
 }
 
+int
+    fbink_invert_screen(int fbfd, const FBInkConfig* restrict fbink_cfg)
+{
+	return fbink_invert_screen_ctx(&defaultCtx, fbfd, fbink_cfg);
+}
+
 // Inverts a region of the framebuffer. Can be used to help implement nightmode on devices without HW inversion support.
 // NOTE: Unlike fbink_invert_screen, this does *not* trigger a refresh.
 int
-    fbink_invert_rect(int fbfd                       UNUSED_BY_NODRAW,
-		      const FBInkRect* restrict rect UNUSED_BY_NODRAW,
-		      bool no_rota                   UNUSED_BY_NODRAW)
+    fbink_invert_rect_ctx(FBInkContext* restrict ctx     UNUSED_BY_NODRAW,
+			  int fbfd                       UNUSED_BY_NODRAW,
+			  const FBInkRect* restrict rect UNUSED_BY_NODRAW,
+			  bool no_rota                   UNUSED_BY_NODRAW)
 {
 #ifdef FBINK_WITH_DRAW
 	// If we open a fd now, we'll only keep it open for this single call!
 	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
 	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -6585,8 +6975,8 @@ int
 	int rv = EXIT_SUCCESS;
 
 	// mmap fb to user mem
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
@@ -6599,7 +6989,7 @@ int
 	bool full_clear = false;
 	if (!rect || (rect->width == 0U || rect->height == 0U)) {
 		full_clear = true;
-		fullscreen_region(&region);
+		fullscreen_region(ctx, &region);
 	} else {
 		region.top    = rect->top;
 		region.left   = rect->left;
@@ -6608,49 +6998,49 @@ int
 	}
 
 	// Remember the rect...
-	set_last_rect(&region);
+	set_last_rect(ctx, &region);
 	// Rotate the region if need be...
 	if (!no_rota) {
-		(*fxpRotateRegion)(&region);
+		(*ctx->fxpRotateRegion)(ctx, &region);
 	}
 
 	// Do the thing...
 	if (full_clear) {
 		// Basically, fbink_invert_screen but without a refresh
-		if (unlikely(vInfo.bits_per_pixel == 16U)) {
+		if (unlikely(ctx->vInfo.bits_per_pixel == 16U)) {
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
-			uint16_t* p = (uint16_t*) fbPtr;
+			uint16_t* p = (uint16_t*) ctx->fbPtr;
 #	pragma GCC diagnostic pop
-			size_t px_count = (size_t) vInfo.xres_virtual * vInfo.yres;
+			size_t px_count = (size_t) ctx->vInfo.xres_virtual * ctx->vInfo.yres;
 			while (px_count--) {
 				*p++ ^= 0xFFFFu;
 			}
-		} else if (vInfo.bits_per_pixel == 32U) {
+		} else if (ctx->vInfo.bits_per_pixel == 32U) {
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
-			uint32_t* p = (uint32_t*) fbPtr;
+			uint32_t* p = (uint32_t*) ctx->fbPtr;
 #	pragma GCC diagnostic pop
-			size_t px_count = (size_t) vInfo.xres_virtual * vInfo.yres;
+			size_t px_count = (size_t) ctx->vInfo.xres_virtual * ctx->vInfo.yres;
 			while (px_count--) {
 				*p++ ^= 0x00FFFFFFu;
 			}
 		} else {
 			// Byte per byte should do the trick for the other bitdepths
-			uint8_t* p          = fbPtr;
-			size_t   byte_count = (size_t) fInfo.line_length * vInfo.yres;
+			uint8_t* p          = ctx->fbPtr;
+			size_t   byte_count = (size_t) ctx->fInfo.line_length * ctx->vInfo.yres;
 			while (byte_count--) {
 				*p++ ^= 0xFFu;
 			}
 		}
 	} else {
 		// Based on their fill_rect counterparts
-		if (unlikely(vInfo.bits_per_pixel == 16U)) {
+		if (unlikely(ctx->vInfo.bits_per_pixel == 16U)) {
 			for (size_t j = region.top; j < region.top + region.height; j++) {
-				const size_t scanline_offset = fInfo.line_length * j;
+				const size_t scanline_offset = ctx->fInfo.line_length * j;
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
-				uint16_t* restrict p = (uint16_t*) (fbPtr + scanline_offset) + region.left;
+				uint16_t* restrict p = (uint16_t*) (ctx->fbPtr + scanline_offset) + region.left;
 #	pragma GCC diagnostic pop
 				size_t px_count = region.width;
 
@@ -6658,7 +7048,7 @@ int
 					*p++ ^= 0xFFFFu;
 				}
 			}
-		} else if (unlikely(vInfo.bits_per_pixel == 4U)) {
+		} else if (unlikely(ctx->vInfo.bits_per_pixel == 4U)) {
 			// I don't particularly care about doing this in a smarter way either...
 			for (uint32_t cy = 0U; cy < region.height; cy++) {
 				for (uint32_t cx = 0U; cx < region.width; cx++) {
@@ -6667,17 +7057,17 @@ int
 						.y = (unsigned short int) (region.top + cy),
 					};
 					FBInkPixel px = { 0 };
-					get_pixel_Gray4(&coords, &px);
+					get_pixel_Gray4(ctx, &coords, &px);
 					px.gray8 ^= 0xFFu;
-					put_pixel_Gray4(&coords, &px);
+					put_pixel_Gray4(ctx, &coords, &px);
 				}
 			}
-		} else if (vInfo.bits_per_pixel == 32U) {
+		} else if (ctx->vInfo.bits_per_pixel == 32U) {
 			for (size_t j = region.top; j < region.top + region.height; j++) {
-				const size_t scanline_offset = fInfo.line_length * j;
+				const size_t scanline_offset = ctx->fInfo.line_length * j;
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
-				uint32_t* p = (uint32_t*) (fbPtr + scanline_offset) + region.left;
+				uint32_t* p = (uint32_t*) (ctx->fbPtr + scanline_offset) + region.left;
 #	pragma GCC diagnostic pop
 				size_t px_count = region.width;
 
@@ -6690,10 +7080,10 @@ int
 			for (size_t j = region.top; j < region.top + region.height; j++) {
 				// NOTE: Go with a cheap memset32 in order to preserve the alpha value of our input pixel...
 				//       The compiler should be able to turn that into something as fast as a plain memset ;).
-				const size_t scanline_offset = fInfo.line_length * j;
+				const size_t scanline_offset = ctx->fInfo.line_length * j;
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
-				uint8_t* p = (uint8_t*) (fbPtr + scanline_offset) + region.left;
+				uint8_t* p = (uint8_t*) (ctx->fbPtr + scanline_offset) + region.left;
 #	pragma GCC diagnostic pop
 				size_t px_count = region.width;
 
@@ -6706,11 +7096,11 @@ int
 
 	// Cleanup
 cleanup:
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -6720,9 +7110,16 @@ cleanup:
 #endif
 }
 
+int
+    fbink_invert_rect(int fbfd, const FBInkRect* restrict rect, bool no_rota)
+{
+	return fbink_invert_rect_ctx(&defaultCtx, fbfd, rect, no_rota);
+}
+
 // Handle cls & refresh, but for grid-based coordinates (i.e., like fbink_print()'s draw())
 static int
-    grid_to_region(int                fbfd,
+    grid_to_region(FBInkContext* restrict ctx,
+		   int                fbfd,
 		   unsigned short int cols,
 		   unsigned short int rows,
 		   bool               do_clear,
@@ -6731,7 +7128,7 @@ static int
 	// If we open a fd now, we'll only keep it open for this single call!
 	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
 	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -6740,8 +7137,8 @@ static int
 
 	// mmap fb to user mem if need be
 	if (do_clear) {
-		if (!isFbMapped) {
-			if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+		if (!ctx->isFbMapped) {
+			if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 				rv = ERRCODE(EXIT_FAILURE);
 				goto cleanup;
 			}
@@ -6760,27 +7157,27 @@ static int
 	// NOTE: If we asked to print in the middle of the screen, make the specified row an offset from the middle of the screen,
 	//       instead of the top.
 	if (fbink_cfg->is_halfway) {
-		row = (short int) (row + (short int) (MAXROWS / 2U));
+		row = (short int) (row + (short int) (ctx->MAXROWS / 2U));
 		// NOTE: Clamp to positive values to avoid wrap-around,
 		//       (i.e., -MAX should always be 0, and +MAX always the last row (i.e., MAXROWS - 1)).
 		//       Our default behavior of starting negative rows from the bottom essentially amounts to valign == bottom,
 		//       which is not desirable when we explicitly asked for center ;).
-		row = (short int) MIN(MAX(0, row), (MAXROWS - 1));
+		row = (short int) MIN(MAX(0, row), (ctx->MAXROWS - 1));
 		LOG("Adjusted row to %hd for vertical centering", row);
 	}
 
 	// See if want to position our text relative to the edge of the screen, and not the beginning
 	if (col < 0) {
-		col = (short int) MAX(MAXCOLS + col, 0);
+		col = (short int) MAX(ctx->MAXCOLS + col, 0);
 	}
 	if (row < 0) {
-		row = (short int) MAX(MAXROWS + row, 0);
+		row = (short int) MAX(ctx->MAXROWS + row, 0);
 	}
 	LOG("Adjusted position: column %hd, row %hd", col, row);
 
 	// Clamp coordinates to the screen, to avoid blowing up ;).
-	if (col >= MAXCOLS) {
-		col = (short int) (MAXCOLS - 1U);
+	if (col >= ctx->MAXCOLS) {
+		col = (short int) (ctx->MAXCOLS - 1U);
 		LOG("Clamped column to %hd", col);
 	}
 	// NOTE: For lines, we attempt to do something potentially a bit less destructive, namely,
@@ -6790,8 +7187,8 @@ static int
 	//       In any case, we're always going to overwrite something, but that way,
 	//       stuff shown on screen should be more or less consistent,
 	//       instead of overwriting over and over again the final line at the bottom of the screen...
-	while (row >= MAXROWS) {
-		row = (short int) (row - MAXROWS);
+	while (row >= ctx->MAXROWS) {
+		row = (short int) (row - ctx->MAXROWS);
 		LOG("Wrapped row back to %hd", row);
 	}
 
@@ -6799,11 +7196,11 @@ static int
 	// NOTE: When centered, we enforce one padding character on the left,
 	//       as well as one padding character on the right when we have a perfect fit.
 	//       This is to avoid potentially printing stuff too close to the bezel and/or behind the bezel.
-	unsigned short int available_cols = MAXCOLS;
+	unsigned short int available_cols = ctx->MAXCOLS;
 	if (fbink_cfg->is_centered) {
 		// One for the left padding
 		available_cols = (unsigned short int) (available_cols - 1U);
-		if (deviceQuirks.isPerfectFit) {
+		if (ctx->deviceQuirks.isPerfectFit) {
 			// And one for the right padding
 			available_cols = (unsigned short int) (available_cols - 1U);
 			// NOTE: If that makes us fall to 0 (because of high font scaling),
@@ -6820,21 +7217,21 @@ static int
 	}
 
 	// Move our initial row up if we add so much lines that some of it goes off-screen...
-	if (row + rows > MAXROWS) {
-		row = (short int) MIN(row - ((row + rows) - MAXROWS), MAXROWS);
+	if (row + rows > ctx->MAXROWS) {
+		row = (short int) MIN(row - ((row + rows) - ctx->MAXROWS), ctx->MAXROWS);
 	}
 	LOG("Final position: column %hd, row %hd", col, row);
 
 	// Just fudge the column for centering...
 	bool halfcell_offset = false;
 	if (fbink_cfg->is_centered) {
-		col = (short int) ((unsigned short int) (MAXCOLS - cols) / 2U);
+		col = (short int) ((unsigned short int) (ctx->MAXCOLS - cols) / 2U);
 
 		// NOTE: If the line itself is not a perfect fit, ask draw to start drawing half a cell
 		//       to the right to compensate, in order to achieve perfect centering...
 		//       This piggybacks a bit on the !isPerfectFit compensation done in draw,
 		//       which already does subcell placement ;).
-		if (((unsigned short int) col * 2U) + cols != MAXCOLS) {
+		if (((unsigned short int) col * 2U) + cols != ctx->MAXCOLS) {
 			LOG("Line is not a perfect fit, fudging centering by one half of a cell to the right");
 			// NOTE: Flag it for correction in draw
 			halfcell_offset = true;
@@ -6848,7 +7245,7 @@ static int
 		col = 0;
 
 		// We'll essentially pad to the edge of the screen
-		cols = MAXCOLS;
+		cols = ctx->MAXCOLS;
 	} else if (fbink_cfg->is_padded || fbink_cfg->is_rpadded) {
 		// We'll essentially pad to the edge of the available area
 		cols = available_cols;
@@ -6859,14 +7256,14 @@ static int
 	unsigned short int pixel_offset = 0U;
 	// Do we have a centering induced halfcell adjustment to correct?
 	if (halfcell_offset) {
-		pixel_offset = FONTW / 2U;
+		pixel_offset = ctx->FONTW / 2U;
 		LOG("Incrementing pixel_offset by %hu pixels to account for a halfcell centering tweak", pixel_offset);
 	}
 	// Do we have a permanent adjustment to make because of dead space on the right edge?
-	if (!deviceQuirks.isPerfectFit) {
+	if (!ctx->deviceQuirks.isPerfectFit) {
 		// We correct by half of said dead space, since we want perfect centering ;).
 		unsigned short int deadzone_offset =
-		    (unsigned short int) (viewWidth - (unsigned short int) (MAXCOLS * FONTW)) / 2U;
+		    (unsigned short int) (ctx->viewWidth - (unsigned short int) (ctx->MAXCOLS * ctx->FONTW)) / 2U;
 		pixel_offset = (unsigned short int) (pixel_offset + deadzone_offset);
 		LOG("Incrementing pixel_offset by %hu pixels to compensate for dead space on the right edge",
 		    deadzone_offset);
@@ -6877,12 +7274,12 @@ static int
 	short int hoffset = fbink_cfg->hoffset;
 	// NOTE: This test isn't perfect, but then, if you play with this, you do it knowing the risks...
 	//       It's mainly there so that stupidly large values don't wrap back on screen because of overflow wraparound.
-	if ((uint32_t) abs(voffset) >= viewHeight) {
+	if ((uint32_t) abs(voffset) >= ctx->viewHeight) {
 		LOG("The specified vertical offset (%hd) necessarily pushes *all* content out of bounds, discarding it",
 		    voffset);
 		voffset = 0;
 	}
-	if ((uint32_t) abs(hoffset) >= viewWidth) {
+	if ((uint32_t) abs(hoffset) >= ctx->viewWidth) {
 		LOG("The specified horizontal offset (%hd) necessarily pushes *all* content out of bounds, discarding it",
 		    hoffset);
 		hoffset = 0;
@@ -6890,38 +7287,39 @@ static int
 
 	// Compute the dimension of the screen region we'll paint to
 	struct mxcfb_rect region = {
-		.top  = (uint32_t) MAX(0 + (viewVertOrigin - viewVertOffset), ((row * FONTH) + voffset + viewVertOrigin)),
-		.left = (uint32_t) MAX(0 + viewHoriOrigin, ((col * FONTW) + hoffset + viewHoriOrigin)),
-		.width  = (uint32_t) (cols * FONTW),
-		.height = (uint32_t) (rows * FONTH),
+		.top  = (uint32_t) MAX(0 + (ctx->viewVertOrigin - ctx->viewVertOffset),
+				       ((row * ctx->FONTH) + voffset + ctx->viewVertOrigin)),
+		.left = (uint32_t) MAX(0 + ctx->viewHoriOrigin, ((col * ctx->FONTW) + hoffset + ctx->viewHoriOrigin)),
+		.width  = (uint32_t) (cols * ctx->FONTW),
+		.height = (uint32_t) (rows * ctx->FONTH),
 	};
 
 	// Recap final offset values
-	if (hoffset != 0 || viewHoriOrigin != 0) {
+	if (hoffset != 0 || ctx->viewHoriOrigin != 0) {
 		LOG("Adjusting horizontal pen position by %hd pixels, as requested, plus %hhu pixels, as mandated by the native viewport",
 		    hoffset,
-		    viewHoriOrigin);
+		    ctx->viewHoriOrigin);
 		// Clamp region to sane values if h/v offset is pushing stuff off-screen
-		if ((region.width + region.left + pixel_offset) > screenWidth) {
-			region.width = (uint32_t) MAX(0, (short int) (screenWidth - region.left - pixel_offset));
+		if ((region.width + region.left + pixel_offset) > ctx->screenWidth) {
+			region.width = (uint32_t) MAX(0, (short int) (ctx->screenWidth - region.left - pixel_offset));
 			LOG("Adjusted region width to account for horizontal offset pushing part of the content off-screen");
 		}
-		if ((region.left + pixel_offset) >= screenWidth) {
-			region.left = screenWidth - pixel_offset - 1;
+		if ((region.left + pixel_offset) >= ctx->screenWidth) {
+			region.left = ctx->screenWidth - pixel_offset - 1;
 			LOG("Adjusted region left to account for horizontal offset pushing part of the content off-screen");
 		}
 	}
-	if (voffset != 0 || viewVertOrigin != 0) {
+	if (voffset != 0 || ctx->viewVertOrigin != 0) {
 		LOG("Adjusting vertical pen position by %hd pixels, as requested, plus %hhu pixels, as mandated by the native viewport",
 		    voffset,
-		    viewVertOrigin);
+		    ctx->viewVertOrigin);
 		// Clamp region to sane values if h/v offset is pushing stuff off-screen
-		if ((region.top + region.height) > screenHeight) {
-			region.height = (uint32_t) MAX(0, (short int) (screenHeight - region.top));
+		if ((region.top + region.height) > ctx->screenHeight) {
+			region.height = (uint32_t) MAX(0, (short int) (ctx->screenHeight - region.top));
 			LOG("Adjusted region height to account for vertical offset pushing part of the content off-screen");
 		}
-		if (region.top >= screenHeight) {
-			region.top = screenHeight - 1;
+		if (region.top >= ctx->screenHeight) {
+			region.top = ctx->screenHeight - 1;
 			LOG("Adjusted region top to account for vertical offset pushing part of the content off-screen");
 		}
 	}
@@ -6933,8 +7331,8 @@ static int
 		LOG("Moving pen %hu pixels to the right to honor subcell centering adjustments", pixel_offset);
 		// NOTE: We need to update the start of our region rectangle if it doesn't already cover the full line,
 		//       i.e., when we're not padding + centering.
-		if (cols != MAXCOLS) {
-			if ((hoffset + viewHoriOrigin) == 0) {
+		if (cols != ctx->MAXCOLS) {
+			if ((hoffset + ctx->viewHoriOrigin) == 0) {
 				region.left += pixel_offset;
 				LOG("Updated region.left to %u", region.left);
 			} else {
@@ -6942,14 +7340,15 @@ static int
 				// We basically have to re-do the maths from scratch,
 				// do it signed to catch corner-cases interactions between col/hoffset/pixel_offset,
 				// and clamp it to safe values!
-				if ((hoffset + viewHoriOrigin) < 0) {
-					region.left =
-					    (uint32_t) MAX(0 + viewHoriOrigin,
-							   ((col * FONTW) + hoffset + viewHoriOrigin + pixel_offset));
+				if ((hoffset + ctx->viewHoriOrigin) < 0) {
+					region.left = (uint32_t) MAX(
+					    0 + ctx->viewHoriOrigin,
+					    ((col * ctx->FONTW) + hoffset + ctx->viewHoriOrigin + pixel_offset));
 				} else {
 					region.left = (uint32_t) MIN(
-					    (uint32_t) ((col * FONTW) + hoffset + viewHoriOrigin + pixel_offset),
-					    (screenWidth - 1U));
+					    (uint32_t) ((col * ctx->FONTW) + hoffset + ctx->viewHoriOrigin +
+							pixel_offset),
+					    (ctx->screenWidth - 1U));
 				}
 				LOG("Updated region.left to %u", region.left);
 			}
@@ -6959,16 +7358,16 @@ static int
 	// If we're a full line, we need to fill the space that honoring our offset has left vacant on the left edge...
 	// NOTE: In overlay or bgless mode, we don't paint background pixels. This is pure background, so skip it ;).
 	if (!fbink_cfg->is_overlay && !fbink_cfg->is_bgless) {
-		if (cols == MAXCOLS && pixel_offset > 0U) {
+		if (cols == ctx->MAXCOLS && pixel_offset > 0U) {
 			LOG("Extra background rectangle on the left edge on account of pixel_offset");
 			// Correct width, to include that bit of content, too, if needed
-			if (region.width < screenWidth) {
+			if (region.width < ctx->screenWidth) {
 				region.width += pixel_offset;
 				// And make sure it's properly clamped, because we can't necessarily rely on left & width
 				// being entirely acurate either because of the multiline print override,
 				// or because of a bit of subcell placement overshoot trickery (c.f., comment in put_pixel).
-				if (region.width + region.left > screenWidth) {
-					region.width = screenWidth - region.left;
+				if (region.width + region.left > ctx->screenWidth) {
+					region.width = ctx->screenWidth - region.left;
 					LOG("Clamped region.width to %u", region.width);
 				} else {
 					LOG("Updated region.width to %u", region.width);
@@ -6980,16 +7379,16 @@ static int
 		//       This only applies when pixel_offset *only* accounts for the !isPerfectFit adjustment though,
 		//       because in every other case, the halfcell offset handling neatly pushes everything into place ;).
 		// NOTE: Again, skip this in overlay/bgless mode ;).
-		if (cols == MAXCOLS && !deviceQuirks.isPerfectFit && !halfcell_offset) {
+		if (cols == ctx->MAXCOLS && !ctx->deviceQuirks.isPerfectFit && !halfcell_offset) {
 			// NOTE: !isPerfectFit ensures pixel_offset is non-zero
 			LOG("Extra background rectangle to fill the dead space on the right edge");
 			// If it's not already the case, update region to the full width,
 			// because we've just plugged a hole at the very right edge of a full line.
-			if (region.width < screenWidth) {
-				region.width = screenWidth;
+			if (region.width < ctx->screenWidth) {
+				region.width = ctx->screenWidth;
 				// Keep making sure it's properly clamped, interaction w/ hoffset can push us over the edge.
-				if (region.width + region.left > screenWidth) {
-					region.width = screenWidth - region.left;
+				if (region.width + region.left > ctx->screenWidth) {
+					region.width = ctx->screenWidth - region.left;
 					LOG("Clamped region.width to %u", region.width);
 				} else {
 					LOG("Updated region.width to %u", region.width);
@@ -7000,19 +7399,20 @@ static int
 
 	// Did we want to paint a background rectangle (i.e., to mimic fbink_cls)?
 	if (do_clear) {
-		(*fxpFillRectChecked)((unsigned short int) region.left,
-				      (unsigned short int) region.top,
-				      (unsigned short int) region.width,
-				      (unsigned short int) region.height,
-				      &penBGPixel);
+		(*ctx->fxpFillRectChecked)(ctx,
+					   (unsigned short int) region.left,
+					   (unsigned short int) region.top,
+					   (unsigned short int) region.width,
+					   (unsigned short int) region.height,
+					   &ctx->penBGPixel);
 	}
 
 	// Remember the rect, and rotate the region if need be...
-	set_last_rect(&region);
-	(*fxpRotateRegion)(&region);
+	set_last_rect(ctx, &region);
+	(*ctx->fxpRotateRegion)(ctx, &region);
 
 	// Refresh screen
-	if (refresh_compat(fbfd, region, do_clear ? fbink_cfg->no_refresh : false, fbink_cfg) != EXIT_SUCCESS) {
+	if (refresh_compat(ctx, fbfd, region, do_clear ? fbink_cfg->no_refresh : false, fbink_cfg) != EXIT_SUCCESS) {
 		PFWARN("Failed to refresh the screen");
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
@@ -7021,53 +7421,74 @@ static int
 	// Cleanup
 cleanup:
 	if (do_clear) {
-		if (isFbMapped && !keep_fd) {
-			unmap_fb();
+		if (ctx->isFbMapped && !keep_fd) {
+			unmap_fb(ctx);
 		}
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
 }
 
 // Public wrappers around grid_to_region
+int
+    fbink_grid_clear_ctx(FBInkContext* restrict ctx,
+			 int                fbfd,
+			 unsigned short int cols,
+			 unsigned short int rows,
+			 const FBInkConfig* restrict fbink_cfg)
+{
+	return grid_to_region(ctx, fbfd, cols, rows, true, fbink_cfg);
+}
+
 int
     fbink_grid_clear(int fbfd, unsigned short int cols, unsigned short int rows, const FBInkConfig* restrict fbink_cfg)
 {
-	return grid_to_region(fbfd, cols, rows, true, fbink_cfg);
+	return fbink_grid_clear_ctx(&defaultCtx, fbfd, cols, rows, fbink_cfg);
+}
+
+int
+    fbink_grid_refresh_ctx(FBInkContext* restrict ctx,
+			   int                fbfd,
+			   unsigned short int cols,
+			   unsigned short int rows,
+			   const FBInkConfig* restrict fbink_cfg)
+{
+	return grid_to_region(ctx, fbfd, cols, rows, false, fbink_cfg);
 }
 
 int
     fbink_grid_refresh(int fbfd, unsigned short int cols, unsigned short int rows, const FBInkConfig* restrict fbink_cfg)
 {
-	return grid_to_region(fbfd, cols, rows, false, fbink_cfg);
+	return fbink_grid_refresh_ctx(&defaultCtx, fbfd, cols, rows, fbink_cfg);
 }
 
 // Utility function to handle get_last_rect tracking
 static void
-    set_last_rect(const struct mxcfb_rect* restrict region)
+    set_last_rect(FBInkContext* restrict ctx, const struct mxcfb_rect* restrict region)
 {
 	// Remember the region we've just drawn to
-	lastRect.left   = (unsigned short int) region->left;
-	lastRect.top    = (unsigned short int) region->top;
-	lastRect.width  = (unsigned short int) region->width;
-	lastRect.height = (unsigned short int) region->height;
+	ctx->lastRect.left   = (unsigned short int) region->left;
+	ctx->lastRect.top    = (unsigned short int) region->top;
+	ctx->lastRect.width  = (unsigned short int) region->width;
+	ctx->lastRect.height = (unsigned short int) region->height;
 }
 
 // Magic happens here!
 int
-    fbink_print(int fbfd                     UNUSED_BY_NOBITMAP,
-		const char* restrict string  UNUSED_BY_NOBITMAP,
-		const FBInkConfig* fbink_cfg UNUSED_BY_NOBITMAP)
+    fbink_print_ctx(FBInkContext* restrict ctx   UNUSED_BY_NOBITMAP,
+		    int fbfd                     UNUSED_BY_NOBITMAP,
+		    const char* restrict string  UNUSED_BY_NOBITMAP,
+		    const FBInkConfig* fbink_cfg UNUSED_BY_NOBITMAP)
 {
 #ifdef FBINK_WITH_BITMAP
 	// Abort if we were passed an empty string
 	if (!*string) {
 		// Unless we just want a clear, in which case, bypass everything and just do that.
 		if (fbink_cfg->is_cleared) {
-			return fbink_cls(fbfd, fbink_cfg, NULL, false);
+			return fbink_cls_ctx(ctx, fbfd, fbink_cfg, NULL, false);
 		} else {
 			PFWARN("Cannot print an empty string");
 			return ERRCODE(EINVAL);
@@ -7085,7 +7506,7 @@ int
 	// If we open a fd now, we'll only keep it open for this single print call!
 	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
 	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -7096,8 +7517,8 @@ int
 
 	// map fb to user mem
 	// NOTE: If we're keeping the fb's fd open, keep this mmap around, too.
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
@@ -7111,12 +7532,12 @@ int
 	// NOTE: If we asked to print in the middle of the screen, make the specified row an offset from the middle of the screen,
 	//       instead of the top.
 	if (fbink_cfg->is_halfway) {
-		row = (short int) (row + (short int) (MAXROWS / 2U));
+		row = (short int) (row + (short int) (ctx->MAXROWS / 2U));
 		// NOTE: Clamp to positive values to avoid wrap-around,
 		//       (i.e., -MAX should always be 0, and +MAX always the last row (i.e., MAXROWS - 1)).
 		//       Our default behavior of starting negative rows from the bottom essentially amounts to valign == bottom,
 		//       which is not desirable when we explicitly asked for center ;).
-		row = (short int) MIN(MAX(0, row), (MAXROWS - 1));
+		row = (short int) MIN(MAX(0, row), (ctx->MAXROWS - 1));
 		LOG("Adjusted row to %hd for vertical centering", row);
 	}
 
@@ -7126,25 +7547,25 @@ int
 
 	// Clear screen?
 	if (fbink_cfg->is_cleared) {
-		FBInkPixel bgP = penBGPixel;
+		FBInkPixel bgP = ctx->penBGPixel;
 		if (fbink_cfg->is_inverted) {
 			bgP.p ^= 0x00FFFFFFu;
 		}
-		clear_screen(fbfd, &bgP, fbink_cfg->is_flashing);
+		clear_screen(ctx, fbfd, &bgP, fbink_cfg->is_flashing);
 	}
 
 	// See if want to position our text relative to the edge of the screen, and not the beginning
 	if (col < 0) {
-		col = (short int) MAX(MAXCOLS + col, 0);
+		col = (short int) MAX(ctx->MAXCOLS + col, 0);
 	}
 	if (row < 0) {
-		row = (short int) MAX(MAXROWS + row, 0);
+		row = (short int) MAX(ctx->MAXROWS + row, 0);
 	}
 	LOG("Adjusted position: column %hd, row %hd", col, row);
 
 	// Clamp coordinates to the screen, to avoid blowing up ;).
-	if (col >= MAXCOLS) {
-		col = (short int) (MAXCOLS - 1U);
+	if (col >= ctx->MAXCOLS) {
+		col = (short int) (ctx->MAXCOLS - 1U);
 		LOG("Clamped column to %hd", col);
 	}
 	// NOTE: For lines, we attempt to do something potentially a bit less destructive, namely,
@@ -7155,8 +7576,8 @@ int
 	//       stuff shown on screen should be more or less consistent,
 	//       instead of overwriting over and over again the final line at the bottom of the screen...
 	bool wrapped_line = false;
-	while (row >= MAXROWS) {
-		row = (short int) (row - MAXROWS);
+	while (row >= ctx->MAXROWS) {
+		row = (short int) (row - ctx->MAXROWS);
 		LOG("Wrapped row back to %hd", row);
 		// Remember that, so we'll append something to our line to make the wraparound clearer...
 		wrapped_line = true;
@@ -7175,11 +7596,11 @@ int
 	// NOTE: When centered, we enforce one padding character on the left,
 	//       as well as one padding character on the right when we have a perfect fit.
 	//       This is to avoid potentially printing stuff too close to the bezel and/or behind the bezel.
-	unsigned short int available_cols = MAXCOLS;
+	unsigned short int available_cols = ctx->MAXCOLS;
 	if (fbink_cfg->is_centered) {
 		// One for the left padding
 		available_cols = (unsigned short int) (available_cols - 1U);
-		if (deviceQuirks.isPerfectFit) {
+		if (ctx->deviceQuirks.isPerfectFit) {
 			// And one for the right padding
 			available_cols = (unsigned short int) (available_cols - 1U);
 			// NOTE: If that makes us fall to 0 (because of high font scaling),
@@ -7205,14 +7626,14 @@ int
 	}
 
 	// Truncate to a single screen...
-	if (lines > MAXROWS) {
-		LOG("Can only print %hu out of %hu lines, truncating!", MAXROWS, lines);
-		lines = MAXROWS;
+	if (lines > ctx->MAXROWS) {
+		LOG("Can only print %hu out of %hu lines, truncating!", ctx->MAXROWS, lines);
+		lines = ctx->MAXROWS;
 	}
 
 	// Move our initial row up if we add so much lines that some of it goes off-screen...
-	if (row + lines > MAXROWS) {
-		row = (short int) MIN(row - ((row + lines) - MAXROWS), MAXROWS);
+	if (row + lines > ctx->MAXROWS) {
+		row = (short int) MIN(row - ((row + lines) - ctx->MAXROWS), ctx->MAXROWS);
 	}
 	LOG("Final position: column %hd, row %hd", col, row);
 
@@ -7220,7 +7641,7 @@ int
 	// NOTE: Store that on the heap, we've had some wacky adventures with automatic VLAs...
 	// NOTE: UTF-8 is at most 4 bytes per sequence, make sure we can fit a full line of UTF-8,
 	//       (+ 1 'wide' NULL, wide to make sure u8_strlen won't skip over it).
-	line = calloc((MAXCOLS + 1U) * 4U, sizeof(*line));
+	line = calloc((ctx->MAXCOLS + 1U) * 4U, sizeof(*line));
 	if (line == NULL) {
 		PFWARN("line calloc: %m");
 		rv = ERRCODE(EXIT_FAILURE);
@@ -7256,9 +7677,9 @@ int
 		    line_len,
 		    chars_left);
 		// Make sure we don't try to draw off-screen...
-		if (row + multiline_offset >= MAXROWS) {
+		if (row + multiline_offset >= ctx->MAXROWS) {
 			LOG("Can only print %hu lines, discarding the %zu characters left!",
-			    MAXROWS,
+			    ctx->MAXROWS,
 			    chars_left - line_len);
 			// And that's it, we're done.
 			break;
@@ -7321,13 +7742,13 @@ int
 		// Just fudge the column for centering...
 		bool halfcell_offset = false;
 		if (fbink_cfg->is_centered) {
-			col = (short int) ((unsigned short int) (MAXCOLS - line_len) / 2U);
+			col = (short int) ((unsigned short int) (ctx->MAXCOLS - line_len) / 2U);
 
 			// NOTE: If the line itself is not a perfect fit, ask draw to start drawing half a cell
 			//       to the right to compensate, in order to achieve perfect centering...
 			//       This piggybacks a bit on the !isPerfectFit compensation done in draw,
 			//       which already does subcell placement ;).
-			if (((unsigned short int) col * 2U) + line_len != MAXCOLS) {
+			if (((unsigned short int) col * 2U) + line_len != ctx->MAXCOLS) {
 				LOG("Line is not a perfect fit, fudging centering by one half of a cell to the right");
 				// NOTE: Flag it for correction in draw
 				halfcell_offset = true;
@@ -7344,9 +7765,9 @@ int
 			col = 0;
 
 			// Compute our padding length
-			unsigned short int left_pad  = (unsigned short int) (MAXCOLS - line_len) / 2U;
+			unsigned short int left_pad  = (unsigned short int) (ctx->MAXCOLS - line_len) / 2U;
 			// As for the right padding, we basically just have to print 'til the edge of the screen
-			unsigned short int right_pad = (unsigned short int) (MAXCOLS - line_len - left_pad);
+			unsigned short int right_pad = (unsigned short int) (ctx->MAXCOLS - line_len - left_pad);
 			// Leave a space for the wraparound marker
 			if (wrapped_line) {
 				// Prefer clipping from the *right* edge
@@ -7376,7 +7797,7 @@ int
 			//           Given that we split this in three sections,
 			//           left-padding would have had a similar effect.
 			bytes_printed = snprintf(line,
-						 (MAXCOLS * 4U) + 1U,
+						 (ctx->MAXCOLS * 4U) + 1U,
 						 "%*s%.*s%-*s",
 						 (int) left_pad,
 						 "",
@@ -7450,7 +7871,8 @@ int
 			bytes_printed += 3;
 		}
 
-		region = draw(line,
+		region = draw(ctx,
+			      line,
 			      (unsigned short int) row,
 			      (unsigned short int) col,
 			      multiline_offset,
@@ -7473,18 +7895,18 @@ int
 	}
 
 	// Handle the last rect stuff...
-	set_last_rect(&region);
+	set_last_rect(ctx, &region);
 
 	// Rotate the region if need be...
-	(*fxpRotateRegion)(&region);
+	(*ctx->fxpRotateRegion)(ctx, &region);
 
 	// Fudge the region if we asked for a screen clear, so that we actually refresh the full screen...
 	if (fbink_cfg->is_cleared) {
-		fullscreen_region(&region);
+		fullscreen_region(ctx, &region);
 	}
 
 	// Refresh screen
-	if (refresh(fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
+	if (refresh(ctx, fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
 		PFWARN("Failed to refresh the screen");
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
@@ -7496,11 +7918,11 @@ int
 	// Cleanup
 cleanup:
 	free(line);
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -7510,6 +7932,12 @@ cleanup:
 #endif    // FBINK_WITH_BITMAP
 }
 
+int
+    fbink_print(int fbfd, const char* restrict string, const FBInkConfig* fbink_cfg)
+{
+	return fbink_print_ctx(&defaultCtx, fbfd, string, fbink_cfg);
+}
+
 #ifdef FBINK_WITH_OPENTYPE
 // An extremely rudimentry "markdown" parser. It would probably be wise to cook up something better at some point...
 // (c.f., https://github.com/commonmark/commonmark-spec/wiki/List-of-CommonMark-Implementations for inspiration ^^)
@@ -7593,13 +8021,15 @@ static __attribute__((cold)) const char*
 #endif    // FBINK_WITH_OPENTYPE
 
 // printf-like wrapper around fbink_print & fbink_print_ot ;).
-int
-    fbink_printf(int fbfd,
+// NOTE: Takes a va_list, so that both the public API & its _ctx variant can share it.
+static int
+    vprintf_text(FBInkContext* restrict ctx,
+		 int fbfd,
 		 const FBInkOTConfig* restrict ot_cfg,
 		 const FBInkConfig* restrict fbink_cfg,
 		 FBInkOTFit* restrict ot_fit,
 		 const char* fmt,
-		 ...)
+		 va_list     args)
 {
 	// Assume success, until shit happens ;)
 	int rv = EXIT_SUCCESS;
@@ -7607,17 +8037,18 @@ int
 	// We'll need to store our formatted string somewhere...
 	// Rely on vsnprintf itself to tell us exactly how many bytes it needs ;).
 	// c.f., vsnprintf(3) && stdarg(3) && https://stackoverflow.com/q/10069597
-	// (especially as far as the va_start/va_end bracketing is concerned)
+	// (especially as far as the va_copy/va_end bracketing is concerned,
+	// as our caller is the one handling va_start/va_end for args itself)
 	int    ret            = -1;
 	size_t size           = 0;
 	char* restrict buffer = NULL;
-	va_list args;
+	va_list args_copy;
 
 	// Initial vsnprintf run on a zero length NULL pointer, just to determine the required buffer size
 	// NOTE: see vsnprintf(3), this is a C99 behavior made canon in POSIX.1-2001, honored since glibc 2.1
-	va_start(args, fmt);
-	ret = vsnprintf(buffer, size, fmt, args);
-	va_end(args);
+	va_copy(args_copy, args);
+	ret = vsnprintf(buffer, size, fmt, args_copy);
+	va_end(args_copy);
 
 	// See if vsnprintf made a boo-boo
 	if (ret < 0) {
@@ -7638,9 +8069,7 @@ int
 	}
 
 	// And now we can actually let vsnprintf do its job, for real ;).
-	va_start(args, fmt);
 	ret = vsnprintf(buffer, size, fmt, args);
-	va_end(args);
 
 	// See if vsnprintf made a boo-boo, one final time
 	if (ret < 0) {
@@ -7653,10 +8082,10 @@ int
 	// Did we get a valid FBInkOTConfig pointer?
 	if (ot_cfg) {
 		// Then feed our formatted string to fbink_print_ot
-		rv = fbink_print_ot(fbfd, buffer, ot_cfg, fbink_cfg, ot_fit);
+		rv = fbink_print_ot_ctx(ctx, fbfd, buffer, ot_cfg, fbink_cfg, ot_fit);
 	} else {
 		// Otherwise, feed it to fbink_print instead
-		rv = fbink_print(fbfd, buffer, fbink_cfg);
+		rv = fbink_print_ctx(ctx, fbfd, buffer, fbink_cfg);
 	}
 
 	// Cleanup
@@ -7666,18 +8095,52 @@ cleanup:
 }
 
 int
-    fbink_print_ot(int fbfd                              UNUSED_BY_MINIMAL,
-		   const char* restrict string           UNUSED_BY_MINIMAL,
-		   const FBInkOTConfig* restrict cfg     UNUSED_BY_MINIMAL,
-		   const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL,
-		   FBInkOTFit* restrict fit              UNUSED_BY_MINIMAL)
+    fbink_printf_ctx(FBInkContext* restrict ctx,
+		     int fbfd,
+		     const FBInkOTConfig* restrict ot_cfg,
+		     const FBInkConfig* restrict fbink_cfg,
+		     FBInkOTFit* restrict ot_fit,
+		     const char* fmt,
+		     ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	const int rv = vprintf_text(ctx, fbfd, ot_cfg, fbink_cfg, ot_fit, fmt, args);
+	va_end(args);
+
+	return rv;
+}
+
+int
+    fbink_printf(int fbfd,
+		 const FBInkOTConfig* restrict ot_cfg,
+		 const FBInkConfig* restrict fbink_cfg,
+		 FBInkOTFit* restrict ot_fit,
+		 const char* fmt,
+		 ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	const int rv = vprintf_text(&defaultCtx, fbfd, ot_cfg, fbink_cfg, ot_fit, fmt, args);
+	va_end(args);
+
+	return rv;
+}
+
+int
+    fbink_print_ot_ctx(FBInkContext* restrict ctx            UNUSED_BY_MINIMAL,
+		       int fbfd                              UNUSED_BY_MINIMAL,
+		       const char* restrict string           UNUSED_BY_MINIMAL,
+		       const FBInkOTConfig* restrict cfg     UNUSED_BY_MINIMAL,
+		       const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL,
+		       FBInkOTFit* restrict fit              UNUSED_BY_MINIMAL)
 {
 #ifdef FBINK_WITH_OPENTYPE
 	// Abort if we were passed an empty string
 	if (!*string) {
 		// Unless we just want a clear, in which case, bypass everything and just do that.
 		if (fbink_cfg->is_cleared) {
-			return fbink_cls(fbfd, fbink_cfg, NULL, false);
+			return fbink_cls_ctx(ctx, fbfd, fbink_cfg, NULL, false);
 		} else {
 			PFWARN("Cannot print an empty string");
 			return ERRCODE(EINVAL);
@@ -7692,7 +8155,7 @@ int
 	}
 
 	// Has fbink_add_ot_font() been successfully called yet?
-	if (!otInit) {
+	if (!ctx->otInit) {
 		WARN("No fonts have been loaded");
 		return ERRCODE(ENODATA);
 	}
@@ -7706,7 +8169,7 @@ int
 	// If we open a fd now, we'll only keep it open for this single print call!
 	// NOTE: We *expect* to be initialized at this point, though, but that's on the caller's hands!
 	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -7726,8 +8189,8 @@ int
 
 	// map fb to user mem
 	// NOTE: If we're keeping the fb's fd open, keep this mmap around, too.
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
@@ -7748,40 +8211,42 @@ int
 	if (cfg->margins.top >= 0) {
 		top_margin = (unsigned short int) cfg->margins.top;
 	} else {
-		top_margin = (unsigned short int) MAX(0, (int) viewHeight - abs(cfg->margins.top));
+		top_margin = (unsigned short int) MAX(0, (int) ctx->viewHeight - abs(cfg->margins.top));
 		LOG("Adjusted top margin to %hupx", top_margin);
 	}
 	unsigned short int bottom_margin = 0U;
 	if (cfg->margins.bottom >= 0) {
 		bottom_margin = (unsigned short int) cfg->margins.bottom;
 	} else {
-		bottom_margin = (unsigned short int) MAX(0, (int) viewHeight - abs(cfg->margins.bottom));
+		bottom_margin = (unsigned short int) MAX(0, (int) ctx->viewHeight - abs(cfg->margins.bottom));
 		LOG("Adjusted bottom margin to %hupx", bottom_margin);
 	}
 	unsigned short int left_margin = 0U;
 	if (cfg->margins.left >= 0) {
 		left_margin = (unsigned short int) cfg->margins.left;
 	} else {
-		left_margin = (unsigned short int) MAX(0, (int) viewWidth - abs(cfg->margins.left));
+		left_margin = (unsigned short int) MAX(0, (int) ctx->viewWidth - abs(cfg->margins.left));
 		LOG("Adjusted left margin to %hupx", left_margin);
 	}
 	unsigned short int right_margin = 0U;
 	if (cfg->margins.right >= 0) {
 		right_margin = (unsigned short int) cfg->margins.right;
 	} else {
-		right_margin = (unsigned short int) MAX(0, (int) viewWidth - abs(cfg->margins.right));
+		right_margin = (unsigned short int) MAX(0, (int) ctx->viewWidth - abs(cfg->margins.right));
 		LOG("Adjusted right margin to %hupx", right_margin);
 	}
 
 	// Sanity check the provided margins and calculate the printable area.
 	// We'll cap the margin at 100% for each side, and margins for opposing edges should sum to less than 100%
-	if (top_margin >= viewHeight || bottom_margin >= viewHeight || left_margin >= viewWidth ||
-	    right_margin >= viewWidth) {
-		WARN("A margin was out of range (allowed ranges :: Vert < %u  Horiz < %u)", viewHeight, viewWidth);
+	if (top_margin >= ctx->viewHeight || bottom_margin >= ctx->viewHeight || left_margin >= ctx->viewWidth ||
+	    right_margin >= ctx->viewWidth) {
+		WARN("A margin was out of range (allowed ranges :: Vert < %u  Horiz < %u)",
+		     ctx->viewHeight,
+		     ctx->viewWidth);
 		rv = ERRCODE(ERANGE);
 		goto cleanup;
 	}
-	if ((top_margin + bottom_margin) >= viewHeight || (left_margin + right_margin) >= viewWidth) {
+	if ((top_margin + bottom_margin) >= ctx->viewHeight || (left_margin + right_margin) >= ctx->viewWidth) {
 		WARN("Opposing margins sum to greater than the viewport height or width");
 		rv = ERRCODE(ERANGE);
 		goto cleanup;
@@ -7795,9 +8260,9 @@ int
 	} area = { 0U };
 #	pragma GCC diagnostic pop
 	area.tl.x                       = left_margin;
-	area.tl.y                       = (unsigned short int) (top_margin + (viewVertOrigin - viewVertOffset));
-	area.br.x                       = (unsigned short int) (viewWidth - right_margin);
-	area.br.y                       = (unsigned short int) (viewHeight - bottom_margin);
+	area.tl.y                       = (unsigned short int) (top_margin + (ctx->viewVertOrigin - ctx->viewVertOffset));
+	area.br.x                       = (unsigned short int) (ctx->viewWidth - right_margin);
+	area.br.y                       = (unsigned short int) (ctx->viewHeight - bottom_margin);
 	// Font size can be specified in pixels or in points. Pixels take precedence.
 	unsigned short int font_size_px = cfg->size_px;
 	// If it wasn't specified in pixels, then it was specified in points (which is also how the default is handled).
@@ -7811,7 +8276,7 @@ int
 			size_pt = 12.0f;
 		}
 		// We should have a fairly accurate idea of what the screen DPI is...
-		const unsigned short int ppi = deviceQuirks.screenDPI;
+		const unsigned short int ppi = ctx->deviceQuirks.screenDPI;
 		// Given the ppi, convert point height to pixels. Note, 1pt is 1/72th of an inch
 		font_size_px                 = (unsigned short int) iroundf(ppi / 72.0f * size_pt);
 	}
@@ -7844,7 +8309,7 @@ int
 		LOG("Using fonts from a local FBInkOTFonts instance (%p)", ot_fonts);
 	} else {
 		// Otherwise, default to the legacy behavior (i.e., use the global).
-		ot_fonts = &otFonts;
+		ot_fonts = &ctx->otFonts;
 		LOG("Using fonts from the global font pool");
 	}
 
@@ -7959,7 +8424,8 @@ int
 	}
 
 	// Calculate the maximum number of lines we may have to deal with
-	const unsigned int print_height = (unsigned int) (area.br.y - area.tl.y + (viewVertOrigin - viewVertOffset));
+	const unsigned int print_height =
+	    (unsigned int) (area.br.y - area.tl.y + (ctx->viewVertOrigin - ctx->viewVertOffset));
 	const unsigned int num_lines    = print_height / (unsigned int) max_row_height;
 
 	// And allocate the memory for it...
@@ -8317,10 +8783,10 @@ int
 	region.top = paint_point.y;
 
 	const uint8_t invert  = is_inverted ? 0xFFu : 0U;
-	const uint8_t fgcolor = penFGColor ^ invert;
-	const uint8_t bgcolor = penBGColor ^ invert;
-	FBInkPixel    fgP     = penFGPixel;
-	FBInkPixel    bgP     = penBGPixel;
+	const uint8_t fgcolor = ctx->penFGColor ^ invert;
+	const uint8_t bgcolor = ctx->penBGColor ^ invert;
+	FBInkPixel    fgP     = ctx->penFGPixel;
+	FBInkPixel    bgP     = ctx->penBGPixel;
 	if (is_inverted) {
 		fgP.p ^= 0x00FFFFFFu;
 		bgP.p ^= 0x00FFFFFFu;
@@ -8328,7 +8794,7 @@ int
 
 	// Do we need to clear the screen?
 	if (is_cleared) {
-		clear_screen(fbfd, &bgP, is_flashing);
+		clear_screen(ctx, fbfd, &bgP, is_flashing);
 	}
 
 	// Handle padding related region tweaks
@@ -8341,11 +8807,12 @@ int
 		region.top  = area.tl.y;
 		// That's easy enough, simply fill the drawing area with the bg color before rendering anything
 		if (!is_overlay && !is_bgless) {
-			(*fxpFillRect)((unsigned short int) region.left,
-				       (unsigned short int) region.top,
-				       max_lw,
-				       (unsigned short int) print_height,
-				       &bgP);
+			(*ctx->fxpFillRect)(ctx,
+					    (unsigned short int) region.left,
+					    (unsigned short int) region.top,
+					    max_lw,
+					    (unsigned short int) print_height,
+					    &bgP);
 		}
 	}
 
@@ -8557,17 +9024,19 @@ int
 			if (!is_overlay && !is_bgless) {
 				// NOTE: Line gaps (if any...) are left alone! Use full padding if that's an issue.
 				// Left padding (left edge of the drawing area to initial pen position)
-				(*fxpFillRect)((unsigned short int) region.left,
-					       paint_point.y,
-					       (unsigned short int) (paint_point.x - region.left),
-					       (unsigned short int) max_line_height,
-					       &bgP);
+				(*ctx->fxpFillRect)(ctx,
+						    (unsigned short int) region.left,
+						    paint_point.y,
+						    (unsigned short int) (paint_point.x - region.left),
+						    (unsigned short int) max_line_height,
+						    &bgP);
 				// Right padding (final pen position to the right edge of the drawing area)
-				(*fxpFillRect)((unsigned short int) (paint_point.x + lw),
-					       paint_point.y,
-					       (unsigned short int) (viewWidth - (paint_point.x + lw)),
-					       (unsigned short int) max_line_height,
-					       &bgP);
+				(*ctx->fxpFillRect)(ctx,
+						    (unsigned short int) (paint_point.x + lw),
+						    paint_point.y,
+						    (unsigned short int) (ctx->viewWidth - (paint_point.x + lw)),
+						    (unsigned short int) max_line_height,
+						    &bgP);
 			}
 		} else if (cfg->padding == VERT_PADDING) {
 			region.top    = area.tl.y;
@@ -8575,11 +9044,12 @@ int
 			if (!is_overlay && !is_bgless) {
 				// First line? Top padding (top edge of the drawing area to initial pen position)
 				if (line == 0U) {
-					(*fxpFillRect)(paint_point.x,
-						       (unsigned short int) region.top,
-						       (unsigned short int) lw,
-						       (unsigned short int) (paint_point.y - region.top),
-						       &bgP);
+					(*ctx->fxpFillRect)(ctx,
+							    paint_point.x,
+							    (unsigned short int) region.top,
+							    (unsigned short int) lw,
+							    (unsigned short int) (paint_point.y - region.top),
+							    &bgP);
 				}
 			}
 		} else if (cfg->padding == FULL_PADDING) {
@@ -8603,8 +9073,8 @@ int
 				// We just need to invert it ;).
 				uint8_t ainv = 0xFFu;
 #	ifdef FBINK_FOR_KINDLE
-				if ((deviceQuirks.isKindleLegacy && !is_inverted) ||
-				    (!deviceQuirks.isKindleLegacy && is_inverted)) {
+				if ((ctx->deviceQuirks.isKindleLegacy && !is_inverted) ||
+				    (!ctx->deviceQuirks.isKindleLegacy && is_inverted)) {
 #	else
 				if (is_inverted) {
 #	endif
@@ -8614,7 +9084,7 @@ int
 					for (unsigned int k = 0U; k < lw; k++) {
 						pixel.bgra.color.r = pixel.bgra.color.g = pixel.bgra.color.b =
 						    lnPtr[k] ^ ainv;
-						put_pixel(paint_point, &pixel, false);
+						put_pixel(ctx, paint_point, &pixel, false);
 						paint_point.x++;
 					}
 					lnPtr        += max_lw;
@@ -8622,24 +9092,24 @@ int
 					paint_point.y++;
 				}
 			} else {
-				if (deviceQuirks.pixelFormat == FBINK_PXFMT_Y4 ||
-				    likely(deviceQuirks.pixelFormat == FBINK_PXFMT_Y8)) {
+				if (ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y4 ||
+				    likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y8)) {
 					// Grayscale, we can use fgcolor/bgcolor & co directly
 					const uint16_t pmul_bg = (uint16_t) (bgcolor * 0xFFu);
 					for (int j = 0; j < max_line_height; j++) {
 						for (unsigned int k = 0U; k < lw; k++) {
 							if (lnPtr[k] == 0U) {
 								// No coverage (transparent) -> background
-								put_pixel(paint_point, &bgP, true);
+								put_pixel(ctx, paint_point, &bgP, true);
 							} else if (lnPtr[k] == 0xFFu) {
 								// Full coverage (opaque) -> foreground
-								put_pixel(paint_point, &fgP, true);
+								put_pixel(ctx, paint_point, &fgP, true);
 							} else {
 								// AA, blend it using the coverage mask as alpha
 								pixel.bgra.color.r     = pixel.bgra.color.g =
 								    pixel.bgra.color.b = (uint8_t) DIV255(
 									(pmul_bg + (layer_diff * lnPtr[k])));
-								put_pixel(paint_point, &pixel, false);
+								put_pixel(ctx, paint_point, &pixel, false);
 							}
 							paint_point.x++;
 						}
@@ -8663,10 +9133,10 @@ int
 						for (unsigned int k = 0U; k < lw; k++) {
 							if (lnPtr[k] == 0U) {
 								// No coverage (transparent) -> background
-								put_pixel(paint_point, &bgP, true);
+								put_pixel(ctx, paint_point, &bgP, true);
 							} else if (lnPtr[k] == 0xFFu) {
 								// Full coverage (opaque) -> foreground
-								put_pixel(paint_point, &fgP, true);
+								put_pixel(ctx, paint_point, &fgP, true);
 							} else {
 								// AA, blend it using the coverage mask as alpha
 								pixel.bgra.color.r = (uint8_t) DIV255(
@@ -8675,7 +9145,7 @@ int
 								    (pmul_bg_g + (layer_diff_g * lnPtr[k])));
 								pixel.bgra.color.b = (uint8_t) DIV255(
 								    (pmul_bg_b + (layer_diff_b * lnPtr[k])));
-								put_pixel(paint_point, &pixel, false);
+								put_pixel(ctx, paint_point, &pixel, false);
 							}
 							paint_point.x++;
 						}
@@ -8688,7 +9158,7 @@ int
 		} else if (is_fgless) {
 			FBInkPixel fb_px = { 0U };
 			uint16_t   pmul_bg_r, pmul_bg_g, pmul_bg_b;
-			if (unlikely(deviceQuirks.isRGB)) {
+			if (unlikely(ctx->deviceQuirks.isRGB)) {
 				pmul_bg_r = (uint16_t) (bgP.rgba.color.r * 0xFFu);
 				pmul_bg_g = (uint16_t) (bgP.rgba.color.g * 0xFFu);
 				pmul_bg_b = (uint16_t) (bgP.rgba.color.b * 0xFFu);
@@ -8698,18 +9168,18 @@ int
 				pmul_bg_b = (uint16_t) (bgP.bgra.color.b * 0xFFu);
 			}
 			// NOTE: One more branch needed because 4bpp fbs are terrible...
-			if (vInfo.bits_per_pixel > 4U) {
+			if (ctx->vInfo.bits_per_pixel > 4U) {
 				// 8, 16, 24 & 32bpp
 				for (int j = 0; j < max_line_height; j++) {
 					for (unsigned int k = 0U; k < lw; k++) {
 						if (lnPtr[k] == 0U) {
 							// No coverage (transparent) -> background
-							put_pixel(paint_point, &bgP, true);
+							put_pixel(ctx, paint_point, &bgP, true);
 						} else if (lnPtr[k] != 0xFFu) {
 							// AA, blend it using the coverage mask as alpha,
 							// and the underlying pixel as fg
-							get_pixel(paint_point, &fb_px);
-							if (unlikely(deviceQuirks.isRGB)) {
+							get_pixel(ctx, paint_point, &fb_px);
+							if (unlikely(ctx->deviceQuirks.isRGB)) {
 								pixel.rgba.color.r = (uint8_t) DIV255((
 								    pmul_bg_r + ((fb_px.rgba.color.r - bgP.rgba.color.r) *
 										 lnPtr[k])));
@@ -8730,7 +9200,7 @@ int
 								    pmul_bg_b + ((fb_px.bgra.color.b - bgP.bgra.color.b) *
 										 lnPtr[k])));
 							}
-							put_pixel(paint_point, &pixel, false);
+							put_pixel(ctx, paint_point, &pixel, false);
 						}
 						paint_point.x++;
 					}
@@ -8744,10 +9214,10 @@ int
 				for (int j = 0; j < max_line_height; j++) {
 					for (unsigned int k = 0U; k < lw; k++) {
 						// AA, blend it using the coverage mask as alpha, and the underlying pixel as fg
-						get_pixel(paint_point, &fb_px);
+						get_pixel(ctx, paint_point, &fb_px);
 						pixel.gray8 =
 						    (uint8_t) DIV255((pmul_bg + ((fb_px.gray8 - bgcolor) * lnPtr[k])));
-						put_pixel(paint_point, &pixel, false);
+						put_pixel(ctx, paint_point, &pixel, false);
 						paint_point.x++;
 					}
 					lnPtr        += max_lw;
@@ -8757,22 +9227,22 @@ int
 			}
 		} else if (is_overlay) {
 			FBInkPixel fb_px = { 0U };
-			if (vInfo.bits_per_pixel > 4U) {
+			if (ctx->vInfo.bits_per_pixel > 4U) {
 				// 8, 16, 24 & 32bpp
 				for (int j = 0; j < max_line_height; j++) {
 					for (unsigned int k = 0U; k < lw; k++) {
 						if (lnPtr[k] == 0xFFu) {
 							// Full coverage (opaque) -> foreground
-							get_pixel(paint_point, &fb_px);
+							get_pixel(ctx, paint_point, &fb_px);
 							// We want our foreground to be the inverse of the underlying pixel...
 							pixel.p = fb_px.p ^ 0x00FFFFFFu;
-							put_pixel(paint_point, &pixel, false);
+							put_pixel(ctx, paint_point, &pixel, false);
 						} else if (lnPtr[k] != 0U) {
 							// AA, blend it using the coverage mask as alpha,
 							// and the underlying pixel as bg
 							// Without forgetting our foreground color trickery...
-							get_pixel(paint_point, &fb_px);
-							if (unlikely(deviceQuirks.isRGB)) {
+							get_pixel(ctx, paint_point, &fb_px);
+							if (unlikely(ctx->deviceQuirks.isRGB)) {
 								pixel.rgba.color.r = (uint8_t) DIV255(
 								    (MUL255(fb_px.rgba.color.r) +
 								     (((fb_px.rgba.color.r ^ 0xFF) - fb_px.rgba.color.r) *
@@ -8799,7 +9269,7 @@ int
 								     (((fb_px.bgra.color.b ^ 0xFF) - fb_px.bgra.color.b) *
 								      lnPtr[k])));
 							}
-							put_pixel(paint_point, &pixel, false);
+							put_pixel(ctx, paint_point, &pixel, false);
 						}
 						paint_point.x++;
 					}
@@ -8813,11 +9283,11 @@ int
 					for (unsigned int k = 0U; k < lw; k++) {
 						// AA, blend it using the coverage mask as alpha, and the underlying pixel as bg
 						// Without forgetting our foreground color trickery...
-						get_pixel(paint_point, &fb_px);
+						get_pixel(ctx, paint_point, &fb_px);
 						pixel.gray8 =
 						    (uint8_t) DIV255((MUL255(fb_px.gray8) +
 								      (((fb_px.gray8 ^ 0xFF) - fb_px.gray8) * lnPtr[k])));
-						put_pixel(paint_point, &pixel, false);
+						put_pixel(ctx, paint_point, &pixel, false);
 						paint_point.x++;
 					}
 					lnPtr        += max_lw;
@@ -8827,18 +9297,18 @@ int
 			}
 		} else if (is_bgless) {
 			FBInkPixel fb_px = { 0U };
-			if (vInfo.bits_per_pixel > 4U) {
+			if (ctx->vInfo.bits_per_pixel > 4U) {
 				// 8, 16, 24 & 32bpp
 				for (int j = 0; j < max_line_height; j++) {
 					for (unsigned int k = 0U; k < lw; k++) {
 						if (lnPtr[k] == 0xFFu) {
 							// Full coverage (opaque) -> foreground
-							put_pixel(paint_point, &fgP, true);
+							put_pixel(ctx, paint_point, &fgP, true);
 						} else if (lnPtr[k] != 0U) {
 							// AA, blend it using the coverage mask as alpha,
 							// and the underlying pixel as bg
-							get_pixel(paint_point, &fb_px);
-							if (unlikely(deviceQuirks.isRGB)) {
+							get_pixel(ctx, paint_point, &fb_px);
+							if (unlikely(ctx->deviceQuirks.isRGB)) {
 								pixel.rgba.color.r = (uint8_t) DIV255(
 								    (MUL255(fb_px.rgba.color.r) +
 								     ((fgP.rgba.color.r - fb_px.rgba.color.r) *
@@ -8865,7 +9335,7 @@ int
 								     ((fgP.bgra.color.b - fb_px.bgra.color.b) *
 								      lnPtr[k])));
 							}
-							put_pixel(paint_point, &pixel, false);
+							put_pixel(ctx, paint_point, &pixel, false);
 						}
 						paint_point.x++;
 					}
@@ -8878,10 +9348,10 @@ int
 				for (int j = 0; j < max_line_height; j++) {
 					for (unsigned int k = 0U; k < lw; k++) {
 						// AA, blend it using the coverage mask as alpha, and the underlying pixel as bg
-						get_pixel(paint_point, &fb_px);
+						get_pixel(ctx, paint_point, &fb_px);
 						pixel.gray8 = (uint8_t) DIV255(
 						    (MUL255(fb_px.gray8) + ((fgcolor - fb_px.gray8) * lnPtr[k])));
-						put_pixel(paint_point, &pixel, false);
+						put_pixel(ctx, paint_point, &pixel, false);
 						paint_point.x++;
 					}
 					lnPtr        += max_lw;
@@ -8900,8 +9370,8 @@ int
 		// Don't fudge region again if we're padding vertically
 		if (cfg->padding != VERT_PADDING && cfg->padding != FULL_PADDING) {
 			region.height += (unsigned int) max_line_height;
-			if (region.top + region.height > screenHeight) {
-				region.height = (screenHeight - region.top);
+			if (region.top + region.height > ctx->screenHeight) {
+				region.height = (ctx->screenHeight - region.top);
 			}
 		}
 		LOG("Finished printing line# %u", line);
@@ -8919,12 +9389,15 @@ int
 			//       since we're rendering/computing line width line by line, we can't do that ;).
 			//       This makes vertical padding a bit gimmicky in practice.
 			//       Thankfully, there's a full padding mode available ;).
-			(*fxpFillRect)(start_x,
-				       paint_point.y,
-				       (unsigned short int) lw,
-				       (unsigned short int) ((viewHeight + (uint32_t) (viewVertOrigin - viewVertOffset)) -
-							     paint_point.y),
-				       &bgP);
+			(*ctx->fxpFillRect)(ctx,
+					    start_x,
+					    paint_point.y,
+					    (unsigned short int) lw,
+					    (unsigned short int) ((ctx->viewHeight +
+								   (uint32_t) (ctx->viewVertOrigin -
+									       ctx->viewVertOffset)) -
+								  paint_point.y),
+					    &bgP);
 		}
 	}
 	if (paint_point.y + max_line_height > area.br.y) {
@@ -8933,7 +9406,7 @@ int
 		rv  = paint_point.y;    // inform the caller what their next top margin should be to follow on
 		// NOTE: Don't forget to subtract the hardware viewport shenanigans, to avoid applying the viewport twice,
 		//       since the next print_ot call will add this to top_margin again...
-		rv -= (viewVertOrigin - viewVertOffset);
+		rv -= (ctx->viewVertOrigin - ctx->viewVertOffset);
 		// NOTE: The same idea applies to vertical centering, we don't want to apply it twice...
 		if (is_halfway || valign == CENTER) {
 			rv = rv - (int) ((print_height - curr_print_height) / 2U);
@@ -8976,25 +9449,25 @@ cleanup:
 	    region.height);
 	if (region.width > 0U && region.height > 0U) {
 		// Handle the last rect stuff...
-		set_last_rect(&region);
-		(*fxpRotateRegion)(&region);
+		set_last_rect(ctx, &region);
+		(*ctx->fxpRotateRegion)(ctx, &region);
 		// NOTE: If we asked for a clear screen, fudge the region at the last moment,
 		// so we don't get mangled by previous adjustments...
 		if (is_cleared) {
-			fullscreen_region(&region);
+			fullscreen_region(ctx, &region);
 		}
-		refresh_compat(fbfd, region, fbink_cfg ? fbink_cfg->no_refresh : false, fbink_cfg);
+		refresh_compat(ctx, fbfd, region, fbink_cfg ? fbink_cfg->no_refresh : false, fbink_cfg);
 	}
 	free(lines);
 	free(brk_buff);
 	free(fmt_buff);
 	free(line_buff);
 	free(glyph_buff);
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 	return rv;
 #else
@@ -9003,10 +9476,20 @@ cleanup:
 #endif    // FBINK_WITH_OPENTYPE
 }
 
-#ifndef FBINK_FOR_LINUX
+int
+    fbink_print_ot(int fbfd,
+		   const char* restrict string,
+		   const FBInkOTConfig* restrict cfg,
+		   const FBInkConfig* restrict fbink_cfg,
+		   FBInkOTFit* restrict fit)
+{
+	return fbink_print_ot_ctx(&defaultCtx, fbfd, string, cfg, fbink_cfg, fit);
+}
+
+#ifndef FBINK_FOR_LINUX
 // Convert our public WFM_MODE_INDEX_T values to an appropriate mxcfb waveform mode constant for the current device
 static uint32_t
-    get_wfm_mode(WFM_MODE_INDEX_T wfm_mode_index)
+    get_wfm_mode(FBInkContext* restrict ctx __attribute__((unused)), WFM_MODE_INDEX_T wfm_mode_index)
 {
 	uint32_t waveform_mode = WAVEFORM_MODE_AUTO;
 
@@ -9014,9 +9497,10 @@ static uint32_t
 #	if defined(FBINK_FOR_KINDLE)
 	// Is this a Zelda or a Rex with new waveforms?
 	// (MTK also supports those with matching constants).
-	const bool has_new_wfm = (deviceQuirks.isKindleZelda || deviceQuirks.isKindleRex || deviceQuirks.isMTK);
+	const bool has_new_wfm =
+	    (ctx->deviceQuirks.isKindleZelda || ctx->deviceQuirks.isKindleRex || ctx->deviceQuirks.isMTK);
 	// Is this device running on a MTK SoC?
-	const bool has_mtk_wfm = deviceQuirks.isMTK;
+	const bool has_mtk_wfm = ctx->deviceQuirks.isMTK;
 
 	switch (wfm_mode_index) {
 		case WFM_INIT:
@@ -9094,14 +9578,14 @@ static uint32_t
 			}
 			break;
 		case WFM_GCK16:
-			if (deviceQuirks.hasEclipseWfm) {
+			if (ctx->deviceQuirks.hasEclipseWfm) {
 				waveform_mode = WAVEFORM_MODE_ZELDA_GCK16;
 			} else {
 				waveform_mode = WAVEFORM_MODE_GC16;
 			}
 			break;
 		case WFM_GLKW16:
-			if (deviceQuirks.hasEclipseWfm) {
+			if (ctx->deviceQuirks.hasEclipseWfm) {
 				waveform_mode = WAVEFORM_MODE_ZELDA_GLKW16;
 			} else {
 				if (has_new_wfm) {
@@ -9122,7 +9606,7 @@ static uint32_t
 			if (has_mtk_wfm) {
 				waveform_mode = MTK_WAVEFORM_MODE_GCK16_PARTIAL;
 			} else {
-				if (deviceQuirks.hasEclipseWfm) {
+				if (ctx->deviceQuirks.hasEclipseWfm) {
 					waveform_mode = WAVEFORM_MODE_ZELDA_GCK16;
 				} else {
 					waveform_mode = WAVEFORM_MODE_GC16;
@@ -9281,7 +9765,7 @@ static uint32_t
 			break;
 	}
 #	elif defined(FBINK_FOR_KOBO)
-	if (deviceQuirks.isMTK) {
+	if (ctx->deviceQuirks.isMTK) {
 		switch (wfm_mode_index) {
 			case WFM_INIT:
 				waveform_mode = HWTCON_WAVEFORM_MODE_INIT;
@@ -9323,7 +9807,7 @@ static uint32_t
 				waveform_mode = HWTCON_WAVEFORM_MODE_GL16;
 				break;
 		}
-	} else if (deviceQuirks.isSunxi) {
+	} else if (ctx->deviceQuirks.isSunxi) {
 		switch (wfm_mode_index) {
 			case WFM_INIT:
 				waveform_mode = EINK_INIT_MODE;
@@ -9407,7 +9891,7 @@ static uint32_t
 				waveform_mode = WAVEFORM_MODE_REAGLD;
 				break;
 			case WFM_DU4:
-				if (deviceQuirks.hasEclipseWfm) {
+				if (ctx->deviceQuirks.hasEclipseWfm) {
 					// NOTE: Not *technically* related to eclipse waveform modes,
 					//       but actually introduced on Kobo at the same time (i.e., Mk. 9).
 					waveform_mode = WAVEFORM_MODE_DU4;
@@ -9416,14 +9900,14 @@ static uint32_t
 				}
 				break;
 			case WFM_GCK16:
-				if (deviceQuirks.hasEclipseWfm) {
+				if (ctx->deviceQuirks.hasEclipseWfm) {
 					waveform_mode = WAVEFORM_MODE_GCK16;
 				} else {
 					waveform_mode = WAVEFORM_MODE_GC16;
 				}
 				break;
 			case WFM_GLKW16:
-				if (deviceQuirks.hasEclipseWfm) {
+				if (ctx->deviceQuirks.hasEclipseWfm) {
 					waveform_mode = WAVEFORM_MODE_GLKW16;
 				} else {
 					waveform_mode = WAVEFORM_MODE_GL16;
@@ -9857,38 +10341,39 @@ static __attribute__((cold)) const char*
 
 // Small public wrapper around refresh(), without the caller having to depend on mxcfb headers
 int
-    fbink_refresh(int fbfd                              UNUSED_BY_LINUX,
-		  uint32_t region_top                   UNUSED_BY_LINUX,
-		  uint32_t region_left                  UNUSED_BY_LINUX,
-		  uint32_t region_width                 UNUSED_BY_LINUX,
-		  uint32_t region_height                UNUSED_BY_LINUX,
-		  const FBInkConfig* restrict fbink_cfg UNUSED_BY_LINUX)
+    fbink_refresh_ctx(FBInkContext* restrict ctx            UNUSED_BY_LINUX,
+		      int fbfd                              UNUSED_BY_LINUX,
+		      uint32_t region_top                   UNUSED_BY_LINUX,
+		      uint32_t region_left                  UNUSED_BY_LINUX,
+		      uint32_t region_width                 UNUSED_BY_LINUX,
+		      uint32_t region_height                UNUSED_BY_LINUX,
+		      const FBInkConfig* restrict fbink_cfg UNUSED_BY_LINUX)
 {
 #ifndef FBINK_FOR_LINUX
 	// Assume success, until shit happens ;)
 	int  rv      = EXIT_SUCCESS;
 	bool keep_fd = true;
 #	ifdef FBINK_FOR_KOBO
-	if (deviceQuirks.isSunxi) {
+	if (ctx->deviceQuirks.isSunxi) {
 		// We need the full monty on sunxi...
-		if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 			return ERRCODE(EXIT_FAILURE);
 		}
 
-		if (!isFbMapped) {
-			if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+		if (!ctx->isFbMapped) {
+			if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 				rv = ERRCODE(EXIT_FAILURE);
 				goto cleanup;
 			}
 		}
 	} else {
-		if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		if (open_fb_fd_nonblock(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 			return ERRCODE(EXIT_FAILURE);
 		}
 	}
 #	else
 	// Open the framebuffer if need be (nonblock, we'll only do ioctls)...
-	if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd_nonblock(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 #	endif    // FBINK_FOR_KOBO
@@ -9911,23 +10396,23 @@ int
 
 	// If region is empty, do a full-screen refresh!
 	if (region.top == 0U && region.left == 0U && region.width == 0U && region.height == 0U) {
-		fullscreen_region(&region);
+		fullscreen_region(ctx, &region);
 	}
 
-	if ((rv = refresh_compat(fbfd, region, false, fbink_cfg)) != EXIT_SUCCESS) {
+	if ((rv = refresh_compat(ctx, fbfd, region, false, fbink_cfg)) != EXIT_SUCCESS) {
 		PFWARN("Failed to refresh the screen");
 	}
 
 #	ifdef FBINK_FOR_KOBO
 cleanup:
-	if (deviceQuirks.isSunxi) {
-		if (isFbMapped && !keep_fd) {
-			unmap_fb();
+	if (ctx->deviceQuirks.isSunxi) {
+		if (ctx->isFbMapped && !keep_fd) {
+			unmap_fb(ctx);
 		}
 	}
 #	endif
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -9937,34 +10422,54 @@ cleanup:
 #endif    // !FBINK_FOR_LINUX
 }
 
+int
+    fbink_refresh(int      fbfd,
+		  uint32_t region_top,
+		  uint32_t region_left,
+		  uint32_t region_width,
+		  uint32_t region_height,
+		  const FBInkConfig* restrict fbink_cfg)
+{
+	return fbink_refresh_ctx(&defaultCtx, fbfd, region_top, region_left, region_width, region_height, fbink_cfg);
+}
+
 // Because I just couldn't be arsed to deal with broken out rectangles anymore ;p.
 int
-    fbink_refresh_rect(int fbfd                              UNUSED_BY_LINUX,
-		       const FBInkRect* restrict rect        UNUSED_BY_LINUX,
-		       const FBInkConfig* restrict fbink_cfg UNUSED_BY_LINUX)
+    fbink_refresh_rect_ctx(FBInkContext* restrict ctx            UNUSED_BY_LINUX,
+			   int fbfd                              UNUSED_BY_LINUX,
+			   const FBInkRect* restrict rect        UNUSED_BY_LINUX,
+			   const FBInkConfig* restrict fbink_cfg UNUSED_BY_LINUX)
 {
 #ifndef FBINK_FOR_LINUX
-	return fbink_refresh(fbfd, rect->top, rect->left, rect->width, rect->height, fbink_cfg);
+	return fbink_refresh_ctx(ctx, fbfd, rect->top, rect->left, rect->width, rect->height, fbink_cfg);
 #else
 	WARN("e-Ink screen refreshes require an e-Ink device");
 	return ERRCODE(ENOSYS);
 #endif    // !FBINK_FOR_LINUX
 }
 
+int
+    fbink_refresh_rect(int fbfd, const FBInkRect* restrict rect, const FBInkConfig* restrict fbink_cfg)
+{
+	return fbink_refresh_rect_ctx(&defaultCtx, fbfd, rect, fbink_cfg);
+}
+
 // Small public wrapper around wait_for_submission(), without the caller having to depend on mxcfb headers
 int
-    fbink_wait_for_submission(int fbfd UNUSED_BY_NOTKINDLE, uint32_t marker UNUSED_BY_NOTKINDLE)
+    fbink_wait_for_submission_ctx(FBInkContext* restrict ctx UNUSED_BY_NOTKINDLE,
+				  int fbfd                   UNUSED_BY_NOTKINDLE,
+				  uint32_t marker            UNUSED_BY_NOTKINDLE)
 {
 #if defined(FBINK_FOR_KINDLE) || defined(FBINK_FOR_KOBO)
 	// Abort early on unsupported devices
-	if (!deviceQuirks.canWaitForSubmission) {
+	if (!ctx->deviceQuirks.canWaitForSubmission) {
 		WARN("Waiting for update submission is not supported on your device");
 		return ERRCODE(ENOSYS);
 	}
 
 	// Open the framebuffer if need be (nonblock, we'll only do ioctls)...
 	bool keep_fd = true;
-	if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd_nonblock(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -9973,8 +10478,8 @@ int
 
 	// Try to retrieve the last sent marker, if any, if we passed marker 0...
 	if (marker == LAST_MARKER) {
-		if (lastMarker != LAST_MARKER) {
-			marker = lastMarker;
+		if (ctx->lastMarker != LAST_MARKER) {
+			marker = ctx->lastMarker;
 		} else {
 			// Otherwise, don't even try to wait for an invalid marker!
 			WARN("No previous update found, cannot wait for submission of an invalid update marker");
@@ -9983,13 +10488,13 @@ int
 		}
 	}
 
-	if ((rv = wait_for_submission(fbfd, marker)) != EXIT_SUCCESS) {
+	if ((rv = wait_for_submission(ctx, fbfd, marker)) != EXIT_SUCCESS) {
 		WARN("Failed to wait for submission of update %u", marker);
 	}
 
 cleanup:
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -9999,43 +10504,51 @@ cleanup:
 #endif    // FBINK_FOR_KINDLE || FBINK_FOR_KOBO
 }
 
+int
+    fbink_wait_for_submission(int fbfd, uint32_t marker)
+{
+	return fbink_wait_for_submission_ctx(&defaultCtx, fbfd, marker);
+}
+
 // Small public wrapper around wait_for_complete(), without the caller having to depend on mxcfb headers
 int
-    fbink_wait_for_complete(int fbfd UNUSED_BY_LINUX, uint32_t marker UNUSED_BY_LINUX)
+    fbink_wait_for_complete_ctx(FBInkContext* restrict ctx UNUSED_BY_LINUX,
+				int fbfd                   UNUSED_BY_LINUX,
+				uint32_t marker            UNUSED_BY_LINUX)
 {
 #ifndef FBINK_FOR_LINUX
 	// Assume success, until shit happens ;)
 	int  rv      = EXIT_SUCCESS;
 	bool keep_fd = true;
 #	ifdef FBINK_FOR_KOBO
-	if (deviceQuirks.isSunxi) {
+	if (ctx->deviceQuirks.isSunxi) {
 		// We need the full monty on sunxi...
-		if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 			return ERRCODE(EXIT_FAILURE);
 		}
 
-		if (!isFbMapped) {
-			if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+		if (!ctx->isFbMapped) {
+			if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 				rv = ERRCODE(EXIT_FAILURE);
 				goto cleanup;
 			}
 		}
 	} else {
-		if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		if (open_fb_fd_nonblock(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 			return ERRCODE(EXIT_FAILURE);
 		}
 	}
 #	else
 	// Open the framebuffer if need be (nonblock, we'll only do ioctls)...
-	if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd_nonblock(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 #	endif    // FBINK_FOR_KOBO
 
 	// Try to retrieve the last sent marker, if any, if we passed marker 0...
 	if (marker == LAST_MARKER) {
-		if (lastMarker != LAST_MARKER) {
-			marker = lastMarker;
+		if (ctx->lastMarker != LAST_MARKER) {
+			marker = ctx->lastMarker;
 		} else {
 			// Otherwise, don't even try to wait for an invalid marker!
 			WARN("No previous update found, cannot wait for completion of an invalid update marker");
@@ -10044,20 +10557,20 @@ int
 		}
 	}
 
-	if ((rv = wait_for_complete(fbfd, marker)) != EXIT_SUCCESS) {
+	if ((rv = wait_for_complete(ctx, fbfd, marker)) != EXIT_SUCCESS) {
 		WARN("Failed to wait for completion of update %u", marker);
 	}
 
 cleanup:
 #	ifdef FBINK_FOR_KOBO
-	if (deviceQuirks.isSunxi) {
-		if (isFbMapped && !keep_fd) {
-			unmap_fb();
+	if (ctx->deviceQuirks.isSunxi) {
+		if (ctx->isFbMapped && !keep_fd) {
+			unmap_fb(ctx);
 		}
 	}
 #	endif
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -10067,30 +10580,43 @@ cleanup:
 #endif    // !FBINK_FOR_LINUX
 }
 
+int
+    fbink_wait_for_complete(int fbfd, uint32_t marker)
+{
+	return fbink_wait_for_complete_ctx(&defaultCtx, fbfd, marker);
+}
+
 // Simple public getter for lastMarker
 uint32_t
-    fbink_get_last_marker(void)
+    fbink_get_last_marker_ctx(FBInkContext* restrict ctx UNUSED_BY_LINUX)
 {
 #ifndef FBINK_FOR_LINUX
-	return lastMarker;
+	return ctx->lastMarker;
 #else
 	WARN("Waiting for updates requires an e-Ink device");
 	return LAST_MARKER;
 #endif    // !FBINK_FOR_LINUX
 }
 
+uint32_t
+    fbink_get_last_marker(void)
+{
+	return fbink_get_last_marker_ctx(&defaultCtx);
+}
+
 // Simple public getter for temporary Device Quirks
 // NOTE: Deprecated, see fbink_reinit instead!
+// NOTE: As such, this only ever looks at the default context.
 bool
     fbink_is_fb_quirky(void)
 {
 	// NOTE: For now, that's easy enough, we only have one ;).
-	return deviceQuirks.isNTX16bLandscape;
+	return defaultCtx.deviceQuirks.isNTX16bLandscape;
 }
 
 #ifdef FBINK_FOR_KOBO
 static int
-    kobo_sunxi_reinit_check(int fbfd, const FBInkConfig* restrict fbink_cfg)
+    kobo_sunxi_reinit_check(FBInkContext* restrict ctx, int fbfd, const FBInkConfig* restrict fbink_cfg)
 {
 	// Assume success, until shit happens ;)
 	int rv = EXIT_SUCCESS;
@@ -10098,28 +10624,28 @@ static int
 	int rf = 0;
 
 	// We may need an I²C handle...
-	if (fbfd == FBFD_AUTO && sunxiCtx.force_rota < FORCE_ROTA_UR) {
-		if (open_accelerometer_i2c() != EXIT_SUCCESS) {
+	if (fbfd == FBFD_AUTO && ctx->sunxiCtx.force_rota < FORCE_ROTA_UR) {
+		if (open_accelerometer_i2c(ctx) != EXIT_SUCCESS) {
 			PFWARN("Cannot open accelerometer I²C handle, aborting");
 			return ERRCODE(EXIT_FAILURE);
 		}
 	}
 
-	const uint32_t old_rota = vInfo.rotate;
+	const uint32_t old_rota = ctx->vInfo.rotate;
 	int            rotate;
-	if (sunxiCtx.force_rota >= FORCE_ROTA_UR) {
-		if (sunxiCtx.force_rota == FORCE_ROTA_WORKBUF) {
+	if (ctx->sunxiCtx.force_rota >= FORCE_ROTA_UR) {
+		if (ctx->sunxiCtx.force_rota == FORCE_ROTA_WORKBUF) {
 			// Attempt to match the working buffer...
-			rotate = query_fbdamage();
+			rotate = query_fbdamage(ctx);
 			if (rotate < 0) {
 				ELOG("FBDamage is inconclusive, keeping current rotation");
 				rotate = (int) old_rota;
 			}
 		} else {
-			rotate = sunxiCtx.force_rota;
+			rotate = ctx->sunxiCtx.force_rota;
 		}
 	} else {
-		rotate = query_accelerometer();
+		rotate = query_accelerometer(ctx);
 		if (rotate < 0) {
 			ELOG("Accelerometer is inconclusive, keeping current rotation");
 			rotate = (int) old_rota;
@@ -10128,7 +10654,7 @@ static int
 
 	// If we're in an FBFD_AUTO workflow, close the I²C handle
 	if (fbfd == FBFD_AUTO) {
-		if (close_accelerometer_i2c() != EXIT_SUCCESS) {
+		if (close_accelerometer_i2c(ctx) != EXIT_SUCCESS) {
 			WARN("Failed to close accelerometer I²C handle");
 			return ERRCODE(EXIT_FAILURE);
 		}
@@ -10148,13 +10674,13 @@ static int
 		}
 
 		// Update the vInfo flag now, so we don't have to poke at the gyro again in initialize_fbink
-		vInfo.rotate = (uint32_t) rotate;
+		ctx->vInfo.rotate = (uint32_t) rotate;
 	}
 
 	// If our bitmask is not empty, it means we have a reinit to do.
 	if (rf > 0) {
 		ELOG("Reinitializing...");
-		rv = initialize_fbink(fbfd, fbink_cfg, true);
+		rv = initialize_fbink(ctx, fbfd, fbink_cfg, true);
 
 		// If it went fine, make the caller aware of why we did it by returning the bitmask
 		if (rv == EXIT_SUCCESS) {
@@ -10178,27 +10704,27 @@ static int
 //           (e.g., Plato relies on HW rotation, and KOReader may change the bitdepth).
 //       TL;DR: We now monitor *any* change in bitdepth and/or rotation.
 int
-    fbink_reinit(int fbfd, const FBInkConfig* restrict fbink_cfg)
+    fbink_reinit_ctx(FBInkContext* restrict ctx, int fbfd, const FBInkConfig* restrict fbink_cfg)
 {
 #ifdef FBINK_FOR_KOBO
 	// On sunxi, the framebuffer state is meaningless, so, just do our own thing...
-	if (deviceQuirks.isSunxi) {
-		return kobo_sunxi_reinit_check(fbfd, fbink_cfg);
+	if (ctx->deviceQuirks.isSunxi) {
+		return kobo_sunxi_reinit_check(ctx, fbfd, fbink_cfg);
 	}
 #endif
 
 	// So, we're concerned with stuff that affects the logical & physical layout, namely, bitdepth & rotation.
-	const uint32_t old_bpp       = vInfo.bits_per_pixel;
-	const uint32_t old_rota      = vInfo.rotate;
+	const uint32_t old_bpp       = ctx->vInfo.bits_per_pixel;
+	const uint32_t old_rota      = ctx->vInfo.rotate;
 	// As well as xres & yres to catch layout changes
-	const uint32_t old_xres      = vInfo.xres;
-	const uint32_t old_yres      = vInfo.yres;
+	const uint32_t old_xres      = ctx->vInfo.xres;
+	const uint32_t old_yres      = ctx->vInfo.yres;
 	// We also want to keep track of the grayscale flag to detect global nightmode swaps
-	const uint32_t old_grayscale = vInfo.grayscale;
+	const uint32_t old_grayscale = ctx->vInfo.grayscale;
 
 	// Open the framebuffer if need be (nonblock, we'll only do ioctls)...
 	bool keep_fd = true;
-	if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd_nonblock(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -10208,7 +10734,7 @@ int
 	int rf = 0;
 
 	// Now that we've stored the relevant bits of the previous state, query the current one...
-	if (ioctl(fbfd, FBIOGET_VSCREENINFO, &vInfo)) {
+	if (ioctl(fbfd, FBIOGET_VSCREENINFO, &ctx->vInfo)) {
 		PFWARN("Error reading variable fb information: %m");
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
@@ -10216,32 +10742,32 @@ int
 
 #ifdef FBINK_FOR_POCKETBOOK
 	// On PocketBook, fix the broken mess that the ioctls returns...
-	pocketbook_fix_fb_info();
+	pocketbook_fix_fb_info(ctx);
 #endif
 
 	// We want to flag each trigger independently
-	if (old_bpp != vInfo.bits_per_pixel) {
-		ELOG("Detected a change in framebuffer bitdepth (%u -> %u)", old_bpp, vInfo.bits_per_pixel);
+	if (old_bpp != ctx->vInfo.bits_per_pixel) {
+		ELOG("Detected a change in framebuffer bitdepth (%u -> %u)", old_bpp, ctx->vInfo.bits_per_pixel);
 		rf |= OK_BPP_CHANGE;
 	}
-	if (old_rota != vInfo.rotate) {
-		ELOG("Detected a change in framebuffer rotation (%u -> %u)", old_rota, vInfo.rotate);
+	if (old_rota != ctx->vInfo.rotate) {
+		ELOG("Detected a change in framebuffer rotation (%u -> %u)", old_rota, ctx->vInfo.rotate);
 		rf |= OK_ROTA_CHANGE;
 
 		// A layout change can only happen after a rotation change ;).
-		if (old_xres != vInfo.xres || old_yres != vInfo.yres) {
+		if (old_xres != ctx->vInfo.xres || old_yres != ctx->vInfo.yres) {
 			// Technically an orientation change, but layout is less likely to be confused w/ rotation ;).
 			ELOG("Detected a change in framebuffer layout (%ux%u -> %ux%u)",
 			     old_xres,
 			     old_yres,
-			     vInfo.xres,
-			     vInfo.yres);
+			     ctx->vInfo.xres,
+			     ctx->vInfo.yres);
 			rf |= OK_LAYOUT_CHANGE;
 		}
 	}
 	// The grayscale flip is only meaningful at 8bpp
-	if (old_bpp == 8U && vInfo.bits_per_pixel == 8U && old_grayscale != vInfo.grayscale) {
-		ELOG("Detected a change in grayscale state (%u -> %u)", old_grayscale, vInfo.grayscale);
+	if (old_bpp == 8U && ctx->vInfo.bits_per_pixel == 8U && old_grayscale != ctx->vInfo.grayscale) {
+		ELOG("Detected a change in grayscale state (%u -> %u)", old_grayscale, ctx->vInfo.grayscale);
 		rf |= OK_GRAYSCALE_CHANGE;
 	}
 
@@ -10249,7 +10775,7 @@ int
 	// NOTE: OK_GRAYSCALE_CHANGE doesn't technically require a reinit, but we do it anyway for simplicity's sake.
 	if (rf > 0) {
 		ELOG("Reinitializing...");
-		rv = initialize_fbink(fbfd, fbink_cfg, true);
+		rv = initialize_fbink(ctx, fbfd, fbink_cfg, true);
 
 		// If it went fine, make the caller aware of why we did it by returning the bitmask
 		if (rv == EXIT_SUCCESS) {
@@ -10262,24 +10788,37 @@ int
 
 cleanup:
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
 }
 
+int
+    fbink_reinit(int fbfd, const FBInkConfig* restrict fbink_cfg)
+{
+	return fbink_reinit_ctx(&defaultCtx, fbfd, fbink_cfg);
+}
+
 // Public wrapper around update_pen_colors
 int
-    fbink_update_pen_colors(const FBInkConfig* restrict fbink_cfg UNUSED_BY_NODRAW)
+    fbink_update_pen_colors_ctx(FBInkContext* restrict ctx            UNUSED_BY_NODRAW,
+				const FBInkConfig* restrict fbink_cfg UNUSED_BY_NODRAW)
 {
 #ifdef FBINK_WITH_DRAW
-	return update_pen_colors(fbink_cfg);
+	return update_pen_colors(ctx, fbink_cfg);
 #else
 	WARN("Drawing primitives are disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
 #endif
 }
 
+int
+    fbink_update_pen_colors(const FBInkConfig* restrict fbink_cfg)
+{
+	return fbink_update_pen_colors_ctx(&defaultCtx, fbink_cfg);
+}
+
 // Public wrapper around update_verbosity
 void
     fbink_update_verbosity(const FBInkConfig* restrict fbink_cfg)
@@ -10290,15 +10829,19 @@ void
 #ifdef FBINK_WITH_BITMAP
 // Handle drawing both types of progress bars
 int
-    draw_progress_bars(int fbfd, bool is_infinite, uint8_t value, const FBInkConfig* restrict fbink_cfg)
+    draw_progress_bars(FBInkContext* restrict ctx,
+		       int     fbfd,
+		       bool    is_infinite,
+		       uint8_t value,
+		       const FBInkConfig* restrict fbink_cfg)
 {
 	const uint8_t invert  = fbink_cfg->is_inverted ? 0xFFu : 0U;
-	const uint8_t fgcolor = penFGColor ^ invert;
-	const uint8_t bgcolor = penBGColor ^ invert;
+	const uint8_t fgcolor = ctx->penFGColor ^ invert;
+	const uint8_t bgcolor = ctx->penBGColor ^ invert;
 
 	// Let's go! Start by pilfering some computations from draw...
-	FBInkPixel fgP = penFGPixel;
-	FBInkPixel bgP = penBGPixel;
+	FBInkPixel fgP = ctx->penFGPixel;
+	FBInkPixel bgP = ctx->penBGPixel;
 	if (fbink_cfg->is_inverted) {
 		fgP.p ^= 0x00FFFFFFu;
 		bgP.p ^= 0x00FFFFFFu;
@@ -10306,14 +10849,14 @@ int
 
 	// Clear screen?
 	if (fbink_cfg->is_cleared) {
-		clear_screen(fbfd, &bgP, fbink_cfg->is_flashing);
+		clear_screen(ctx, fbfd, &bgP, fbink_cfg->is_flashing);
 	}
 
 	// Clamp v offset to safe values
 	// NOTE: This test isn't perfect, but then, if you play with this, you do it knowing the risks...
 	//       It's mainly there so that stupidly large values don't wrap back on screen because of overflow wraparound.
 	short int voffset = fbink_cfg->voffset;
-	if ((uint32_t) abs(voffset) >= viewHeight) {
+	if ((uint32_t) abs(voffset) >= ctx->viewHeight) {
 		LOG("The specified vertical offset (%hd) necessarily pushes *all* content out of bounds, discarding it",
 		    voffset);
 		voffset = 0;
@@ -10322,32 +10865,38 @@ int
 	// And then some from fbink_print...
 	short int row = fbink_cfg->row;
 	if (fbink_cfg->is_halfway) {
-		row = (short int) (row + (short int) (MAXROWS / 2U));
+		row = (short int) (row + (short int) (ctx->MAXROWS / 2U));
 		// NOTE: Clamp to positive values to avoid wrap-around,
 		//       (i.e., -MAX should always be 0, and +MAX always the last row (i.e., MAXROWS - 1)).
 		//       Our default behavior of starting negative rows from the bottom essentially amounts to valign == bottom,
 		//       which is not desirable when we explicitly asked for center ;).
-		row = (short int) MIN(MAX(0, row), (MAXROWS - 1));
+		row = (short int) MIN(MAX(0, row), (ctx->MAXROWS - 1));
 		LOG("Adjusted row to %hd for vertical centering", row);
 	}
 
 	if (row < 0) {
-		row = (short int) MAX(MAXROWS + row, 0);
+		row = (short int) MAX(ctx->MAXROWS + row, 0);
 		LOG("Adjusted row to %hd", row);
 	}
-	while (row >= MAXROWS) {
-		row = (short int) (row - MAXROWS);
+	while (row >= ctx->MAXROWS) {
+		row = (short int) (row - ctx->MAXROWS);
 		LOG("Wrapped row back to %hd", row);
 	}
 
 	// We'll begin by painting a blank canvas, just to make sure everything's clean behind us...
 	const unsigned short int top_pos =
-	    (unsigned short int) MAX(0 + (viewVertOrigin - viewVertOffset), ((row * FONTH) + voffset + viewVertOrigin));
-	const unsigned short int left_pos = 0U + viewHoriOrigin;
+	    (unsigned short int) MAX(0 + (ctx->viewVertOrigin - ctx->viewVertOffset),
+				     ((row * ctx->FONTH) + voffset + ctx->viewVertOrigin));
+	const unsigned short int left_pos = 0U + ctx->viewHoriOrigin;
 
 	// ... unless we were asked to skip background pixels... ;).
 	if (!fbink_cfg->is_bgless) {
-		(*fxpFillRectChecked)(left_pos, top_pos, (unsigned short int) screenWidth, FONTH, &bgP);
+		(*ctx->fxpFillRectChecked)(ctx,
+					   left_pos,
+					   top_pos,
+					   (unsigned short int) ctx->screenWidth,
+					   ctx->FONTH,
+					   &bgP);
 	}
 
 	// NOTE: We always use the same BG_ constant in order to get a rough inverse by just swapping to the inverted LUT ;).
@@ -10355,7 +10904,7 @@ int
 	uint8_t borderC;
 	// Handle devices with an inverted palette properly...
 #	ifdef FBINK_FOR_KINDLE
-	if (deviceQuirks.isKindleLegacy) {
+	if (ctx->deviceQuirks.isKindleLegacy) {
 		emptyC  = fbink_cfg->is_inverted ? eInkBGCMap[BG_GRAYB] : eInkFGCMap[BG_GRAYB];
 		borderC = fbink_cfg->is_inverted ? eInkBGCMap[BG_GRAY4] : eInkFGCMap[BG_GRAY4];
 	} else {
@@ -10377,7 +10926,7 @@ int
 	// Pack that into the right pixel format...
 	FBInkPixel emptyP;
 	FBInkPixel borderP;
-	switch (vInfo.bits_per_pixel) {
+	switch (ctx->vInfo.bits_per_pixel) {
 		case 4U:
 		case 8U:
 			emptyP.gray8  = emptyC;
@@ -10401,8 +10950,8 @@ int
 	struct mxcfb_rect region = {
 		.top    = top_pos,
 		.left   = left_pos,
-		.width  = screenWidth,
-		.height = FONTH,
+		.width  = ctx->screenWidth,
+		.height = ctx->FONTH,
 	};
 
 	// Which kind of bar did we request?
@@ -10411,32 +10960,35 @@ int
 
 		// We'll want 5% of padding on each side,
 		// with rounding to make sure the bar's size is constant across all percentage values...
-		const unsigned short int bar_width = (unsigned short int) (((0.90f * (float) viewWidth)) + 0.5f);
+		const unsigned short int bar_width = (unsigned short int) (((0.90f * (float) ctx->viewWidth)) + 0.5f);
 		const unsigned short int fill_width =
-		    (unsigned short int) (((value / 100.0f) * (0.90f * (float) viewWidth)) + 0.5f);
-		const unsigned short int fill_left = (unsigned short int) (left_pos + (0.05f * (float) viewWidth) + 0.5f);
+		    (unsigned short int) (((value / 100.0f) * (0.90f * (float) ctx->viewWidth)) + 0.5f);
+		const unsigned short int fill_left =
+		    (unsigned short int) (left_pos + (0.05f * (float) ctx->viewWidth) + 0.5f);
 		const unsigned short int empty_width = (unsigned short int) (bar_width - fill_width);
 		const unsigned short int empty_left  = (unsigned short int) (fill_left + fill_width);
 
 		// Draw the border...
-		(*fxpFillRectChecked)(fill_left, top_pos, bar_width, FONTH, &borderP);
+		(*ctx->fxpFillRectChecked)(ctx, fill_left, top_pos, bar_width, ctx->FONTH, &borderP);
 		// Draw the fill bar, which we want to override the border with!
-		(*fxpFillRectChecked)(fill_left, top_pos, fill_width, FONTH, &fgP);
+		(*ctx->fxpFillRectChecked)(ctx, fill_left, top_pos, fill_width, ctx->FONTH, &fgP);
 		// And the empty bar...
 		// NOTE: With a minor tweak to keep a double-width border on the bottom & right sides ;).
 		if (value == 0U) {
 			// Keep the left border alone!
-			(*fxpFillRectChecked)((unsigned short int) (empty_left + 1U),
-					      (unsigned short int) (top_pos + 1U),
-					      (unsigned short int) MAX(0, empty_width - 3),
-					      (unsigned short int) (FONTH - 3U),
-					      &emptyP);
+			(*ctx->fxpFillRectChecked)(ctx,
+						   (unsigned short int) (empty_left + 1U),
+						   (unsigned short int) (top_pos + 1U),
+						   (unsigned short int) MAX(0, empty_width - 3),
+						   (unsigned short int) (ctx->FONTH - 3U),
+						   &emptyP);
 		} else {
-			(*fxpFillRectChecked)(empty_left,
-					      (unsigned short int) (top_pos + 1U),
-					      (unsigned short int) MAX(0, empty_width - 2),
-					      (unsigned short int) (FONTH - 3U),
-					      &emptyP);
+			(*ctx->fxpFillRectChecked)(ctx,
+						   empty_left,
+						   (unsigned short int) (top_pos + 1U),
+						   (unsigned short int) MAX(0, empty_width - 2),
+						   (unsigned short int) (ctx->FONTH - 3U),
+						   &emptyP);
 		}
 
 		// We enforce centering for the percentage text...
@@ -10447,20 +10999,26 @@ int
 		const size_t line_len = strlen(percentage_text);    // Flawfinder: ignore
 
 		bool      halfcell_offset = false;
-		short int col             = (short int) ((unsigned short int) (MAXCOLS - line_len) / 2U);
+		short int col             = (short int) ((unsigned short int) (ctx->MAXCOLS - line_len) / 2U);
 
 		// NOTE: If the line itself is not a perfect fit, ask draw to start drawing half a cell
 		//       to the right to compensate, in order to achieve perfect centering...
 		//       This piggybacks a bit on the !isPerfectFit compensation done in draw,
 		//       which already does subcell placement ;).
-		if (((unsigned short int) col * 2U) + line_len != MAXCOLS) {
+		if (((unsigned short int) col * 2U) + line_len != ctx->MAXCOLS) {
 			LOG("Line is not a perfect fit, fudging centering by one half of a cell to the right");
 			// NOTE: Flag it for correction in draw
 			halfcell_offset = true;
 		}
 
 		// Draw percentage in the middle of the bar...
-		draw(percentage_text, (unsigned short int) row, (unsigned short int) col, 0U, halfcell_offset, fbink_cfg);
+		draw(ctx,
+		     percentage_text,
+		     (unsigned short int) row,
+		     (unsigned short int) col,
+		     0U,
+		     halfcell_offset,
+		     fbink_cfg);
 
 		// Don't refresh beyond the borders of the bar if we're backgroundless...
 		// This is especially important w/ A2 wfm mode,
@@ -10474,17 +11032,24 @@ int
 
 		// We'll want 5% of padding on each side,
 		// with rounding to make sure the bar's size is constant across all percentage values...
-		const unsigned short int bar_width = (unsigned short int) ((0.90f * (float) viewWidth) + 0.5f);
-		const unsigned short int bar_left  = (unsigned short int) (left_pos + (0.05f * (float) viewWidth) + 0.5f);
+		const unsigned short int bar_width = (unsigned short int) ((0.90f * (float) ctx->viewWidth) + 0.5f);
+		const unsigned short int bar_left  =
+		    (unsigned short int) (left_pos + (0.05f * (float) ctx->viewWidth) + 0.5f);
 
 		// Draw the border...
-		(*fxpFillRectChecked)(bar_left, top_pos, (unsigned short int) (bar_width), FONTH, &borderP);
+		(*ctx->fxpFillRectChecked)(ctx,
+					   bar_left,
+					   top_pos,
+					   (unsigned short int) (bar_width),
+					   ctx->FONTH,
+					   &borderP);
 		// Draw the empty bar...
-		(*fxpFillRectChecked)((unsigned short int) (bar_left + 1U),
-				      (unsigned short int) (top_pos + 1U),
-				      (unsigned short int) MAX(0, bar_width - 3),
-				      (unsigned short int) (FONTH - 3U),
-				      &emptyP);
+		(*ctx->fxpFillRectChecked)(ctx,
+					   (unsigned short int) (bar_left + 1U),
+					   (unsigned short int) (top_pos + 1U),
+					   (unsigned short int) MAX(0, bar_width - 3),
+					   (unsigned short int) (ctx->FONTH - 3U),
+					   &emptyP);
 
 		// We want our thumb to take 20% of the bar's width
 		const unsigned short int thumb_width = (unsigned short int) ((0.20f * bar_width) + 0.5f);
@@ -10494,19 +11059,20 @@ int
 		    (unsigned short int) (bar_left + ((0.05f * bar_width) * value) + 0.5f);
 
 		// And finally, draw the thumb, which we want to override the border with!
-		(*fxpFillRectChecked)(thumb_left, top_pos, thumb_width, FONTH, &fgP);
+		(*ctx->fxpFillRectChecked)(ctx, thumb_left, top_pos, thumb_width, ctx->FONTH, &fgP);
 
 		// Draw an ellipsis in the middle of the thumb...
-		const uint8_t            ellipsis_size = (uint8_t) (FONTH / 3U);
+		const uint8_t            ellipsis_size = (uint8_t) (ctx->FONTH / 3U);
 		// Three dots = two spaces, 3 + 2 = 5 ;).
 		const unsigned short int ellipsis_left = (unsigned short int) ((thumb_width - (5U * ellipsis_size)) / 2U);
 		for (uint8_t i = 0U; i < 3U; i++) {
-			(*fxpFillRectChecked)((unsigned short int) (thumb_left + ellipsis_left +
-								    (unsigned short int) (i * 2U * ellipsis_size)),
-					      (unsigned short int) (top_pos + ellipsis_size),
-					      ellipsis_size,
-					      ellipsis_size,
-					      &bgP);
+			(*ctx->fxpFillRectChecked)(ctx,
+						   (unsigned short int) (thumb_left + ellipsis_left +
+									 (unsigned short int) (i * 2U * ellipsis_size)),
+						   (unsigned short int) (top_pos + ellipsis_size),
+						   ellipsis_size,
+						   ellipsis_size,
+						   &bgP);
 		}
 
 		// Don't refresh beyond the borders of the bar if we're backgroundless...
@@ -10519,30 +11085,30 @@ int
 	}
 
 	// V offset handling is the pits.
-	if (voffset != 0 || viewVertOrigin != 0) {
+	if (voffset != 0 || ctx->viewVertOrigin != 0) {
 		LOG("Adjusting vertical pen position by %hd pixels, as requested, plus %hhu pixels, as mandated by the native viewport",
 		    voffset,
-		    viewVertOrigin);
+		    ctx->viewVertOrigin);
 		// Clamp region to sane values if h/v offset is pushing stuff off-screen
-		if ((region.top + region.height) > screenHeight) {
-			region.height = (uint32_t) MAX(0, (short int) (screenHeight - region.top));
+		if ((region.top + region.height) > ctx->screenHeight) {
+			region.height = (uint32_t) MAX(0, (short int) (ctx->screenHeight - region.top));
 			LOG("Adjusted region height to account for vertical offset pushing part of the content off-screen");
 		}
-		if (region.top >= screenHeight) {
-			region.top = screenHeight - 1;
+		if (region.top >= ctx->screenHeight) {
+			region.top = ctx->screenHeight - 1;
 			LOG("Adjusted region top to account for vertical offset pushing part of the content off-screen");
 		}
 	}
 
 	// Handle the last rect stuff...
-	set_last_rect(&region);
+	set_last_rect(ctx, &region);
 
 	// Rotate the region if need be...
-	(*fxpRotateRegion)(&region);
+	(*ctx->fxpRotateRegion)(ctx, &region);
 
 	// Fudge the region if we asked for a screen clear, so that we actually refresh the full screen...
 	if (fbink_cfg->is_cleared) {
-		fullscreen_region(&region);
+		fullscreen_region(ctx, &region);
 	}
 
 	// And finally, refresh the screen
@@ -10550,7 +11116,7 @@ int
 	//       It has the added benefit of increasing the framerate limit after which the eInk controller risks getting
 	//       confused (unless is_flashing is enabled, since that'll block,
 	//       essentially throttling the bar to the screen's refresh rate).
-	if (refresh(fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
+	if (refresh(ctx, fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
 		PFWARN("Failed to refresh the screen");
 		return ERRCODE(EXIT_FAILURE);
 	}
@@ -10561,15 +11127,16 @@ int
 
 // Draw a full-width progress bar
 int
-    fbink_print_progress_bar(int fbfd                                     UNUSED_BY_NOBITMAP,
-			     uint8_t percentage                           UNUSED_BY_NOBITMAP,
-			     const FBInkConfig* restrict caller_fbink_cfg UNUSED_BY_NOBITMAP)
+    fbink_print_progress_bar_ctx(FBInkContext* restrict ctx                   UNUSED_BY_NOBITMAP,
+				 int fbfd                                     UNUSED_BY_NOBITMAP,
+				 uint8_t percentage                           UNUSED_BY_NOBITMAP,
+				 const FBInkConfig* restrict caller_fbink_cfg UNUSED_BY_NOBITMAP)
 {
 #ifdef FBINK_WITH_BITMAP
 	// Open the framebuffer if need be...
 	// NOTE: As usual, we *expect* to be initialized at this point!
 	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -10577,8 +11144,8 @@ int
 	int rv = EXIT_SUCCESS;
 
 	// mmap the fb if need be...
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
@@ -10601,15 +11168,15 @@ int
 	// And we enforce centered text internally, so we'll set col ourselves later...
 
 	// And do the work ;).
-	rv = draw_progress_bars(fbfd, false, percentage, &fbink_cfg);
+	rv = draw_progress_bars(ctx, fbfd, false, percentage, &fbink_cfg);
 
 	// Cleanup
 cleanup:
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -10619,17 +11186,24 @@ cleanup:
 #endif    // FBINK_WITH_BITMAP
 }
 
+int
+    fbink_print_progress_bar(int fbfd, uint8_t percentage, const FBInkConfig* restrict caller_fbink_cfg)
+{
+	return fbink_print_progress_bar_ctx(&defaultCtx, fbfd, percentage, caller_fbink_cfg);
+}
+
 // Draw a full-width activity bar
 int
-    fbink_print_activity_bar(int fbfd                                     UNUSED_BY_NOBITMAP,
-			     uint8_t progress                             UNUSED_BY_NOBITMAP,
-			     const FBInkConfig* restrict caller_fbink_cfg UNUSED_BY_NOBITMAP)
+    fbink_print_activity_bar_ctx(FBInkContext* restrict ctx                   UNUSED_BY_NOBITMAP,
+				 int fbfd                                     UNUSED_BY_NOBITMAP,
+				 uint8_t progress                             UNUSED_BY_NOBITMAP,
+				 const FBInkConfig* restrict caller_fbink_cfg UNUSED_BY_NOBITMAP)
 {
 #ifdef FBINK_WITH_BITMAP
 	// Open the framebuffer if need be...
 	// NOTE: As usual, we *expect* to be initialized at this point!
 	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -10637,8 +11211,8 @@ int
 	int rv = EXIT_SUCCESS;
 
 	// mmap the fb if need be...
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
@@ -10653,15 +11227,15 @@ int
 	}
 
 	// And do the work ;).
-	rv = draw_progress_bars(fbfd, true, progress, caller_fbink_cfg);
+	rv = draw_progress_bars(ctx, fbfd, true, progress, caller_fbink_cfg);
 
 	// Cleanup
 cleanup:
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -10671,10 +11245,303 @@ cleanup:
 #endif    // FBINK_WITH_BITMAP
 }
 
+int
+    fbink_print_activity_bar(int fbfd, uint8_t progress, const FBInkConfig* restrict caller_fbink_cfg)
+{
+	return fbink_print_activity_bar_ctx(&defaultCtx, fbfd, progress, caller_fbink_cfg);
+}
+
 #ifdef FBINK_WITH_IMAGE
+// Compute the on-screen dimensions of a w x h image, according to the scaling settings in fbink_cfg
+// NOTE: On input, scaled_width & scaled_height hold the dimensions of the box the negative (i.e., viewport-relative)
+//       scaling settings refer to. That's usually the viewport, but it's a thumbnail's own box in fbink_print_thumbnails.
+static void
+    img_compute_scaled_size(int w,
+			    int h,
+			    const FBInkConfig* restrict fbink_cfg,
+			    unsigned short int* restrict scaled_width,
+			    unsigned short int* restrict scaled_height)
+{
+	const unsigned short int box_width  = *scaled_width;
+	const unsigned short int box_height = *scaled_height;
+
+	// Make sure the scaled dimensions start sane...
+	if (fbink_cfg->scaled_width > 0) {
+		// Honor the specified dimension
+		*scaled_width = (unsigned short int) fbink_cfg->scaled_width;
+	} else if (fbink_cfg->scaled_width < 0) {
+		// -1 or less -> use the viewport's dimension
+		*scaled_width = box_width;
+	} else {
+		// 0 -> No scaling requested
+		*scaled_width = (unsigned short int) w;
+	}
+	if (fbink_cfg->scaled_height > 0) {
+		// Honor the specified dimension
+		*scaled_height = (unsigned short int) fbink_cfg->scaled_height;
+	} else if (fbink_cfg->scaled_height < 0) {
+		// -1 or less -> use the viewport's dimension
+		*scaled_height = box_height;
+	} else {
+		// 0 -> No scaling requested
+		*scaled_height = (unsigned short int) h;
+	}
+
+	// NOTE: Handle AR if best fit was requested, or if scaling was requested on one side only...
+	if (fbink_cfg->scaled_width < -1 || fbink_cfg->scaled_height < -1) {
+		float aspect                      = (float) w / (float) h;
+		// We want to fit the image *inside* the viewport, so, enforce our starting scaled dimensions...
+		*scaled_width                     = box_width;
+		*scaled_height                    = box_height;
+		// NOTE: Loosely based on Qt's QSize boundedTo implementation
+		//       c.f., QSize::scaled @ https://github.com/qt/qtbase/blob/dev/src/corelib/tools/qsize.cpp
+		unsigned short int rescaled_width = (unsigned short int) (*scaled_height * aspect + 0.5f);
+		// NOTE: One would simply have to check for >= instead of <= to implement
+		//       Qt::KeepAspectRatioByExpanding instead of Qt::KeepAspectRatio
+		if (rescaled_width <= *scaled_width) {
+			*scaled_width = rescaled_width;
+		} else {
+			*scaled_height = (unsigned short int) (*scaled_width / aspect + 0.5f);
+		}
+	} else if (fbink_cfg->scaled_width == 0 && fbink_cfg->scaled_height != 0) {
+		// ?xH, compute width, honoring AR
+		float aspect  = (float) w / (float) h;
+		*scaled_width = (unsigned short int) (*scaled_height * aspect + 0.5f);
+	} else if (fbink_cfg->scaled_width != 0 && fbink_cfg->scaled_height == 0) {
+		// Wx?, compute height, honoring AR
+		float aspect   = (float) w / (float) h;
+		*scaled_height = (unsigned short int) (*scaled_width / aspect + 0.5f);
+	}
+}
+
+// NOTE: At 1/8 resolution, each 8x8 block boils down to its DC coefficient (i.e., its average),
+//       so that's all we need to compute (for the top-left pixel), and all img_load_jpeg_scaled will ever look at.
+//       This matches what stbi__idct_block computes for a block with no AC coefficients.
+static void
+    img_jpeg_idct_dc(unsigned char* out, int out_stride __attribute__((unused)), short data[64])
+{
+	*out = stbi__clamp(((data[0] + 4) >> 3) + 128);
+}
+
+// Decode a JPEG at 1/scale of its resolution (w/ scale being 2, 4 or 8), straight from the decoded DCT blocks.
+// NOTE: stbi doesn't support scaled decoding, so this is a trimmed down stbi__load_jpeg_image,
+//       which averages the component planes (instead of upsampling them to full resolution) before color conversion.
+//       This skips the full resolution upsampling & color conversion passes, as well as the full resolution output buffer,
+//       and, at 1/8, the IDCT itself.
+//       Returns NULL if that's not possible (e.g., CMYK), in which case the caller should fall back to a regular decode.
+static unsigned char*
+    img_load_jpeg_scaled(const unsigned char* restrict buffer,
+			 int                           len,
+			 int                           scale,
+			 int* restrict                 w,
+			 int* restrict                 h,
+			 int* restrict                 n,
+			 int                           req_n)
+{
+	stbi__context s;
+	stbi__start_mem(&s, buffer, len);
+
+	stbi__jpeg* restrict j = stbi__malloc(sizeof(*j));
+	if (j == NULL) {
+		return NULL;
+	}
+	memset(j, 0, sizeof(*j));
+	j->s = &s;
+	stbi__setup_jpeg(j);
+	if (scale == 8) {
+		j->idct_block_kernel = &img_jpeg_idct_dc;
+	}
+	// Make stbi__cleanup_jpeg safe
+	s.img_n = 0;
+
+	unsigned char* restrict out    = NULL;
+	unsigned char* restrict cout   = NULL;
+	int* restrict           xspans = NULL;
+	if (!stbi__decode_jpeg_image(j)) {
+		goto cleanup;
+	}
+	// We don't handle Adobe's CMYK/YCCK shenanigans, let stbi deal with those
+	if (s.img_n != 1 && s.img_n != 3) {
+		goto cleanup;
+	}
+
+	// Same logic as stbi__load_jpeg_image
+	const bool is_rgb   = s.img_n == 3 && (j->rgb == 3 || (j->app14_color_transform == 0 && !j->jfif));
+	const int  decode_n = (s.img_n == 3 && req_n < 3 && !is_rgb) ? 1 : s.img_n;
+	const int  ow       = ((int) s.img_x + scale - 1) / scale;
+	const int  oh       = ((int) s.img_y + scale - 1) / scale;
+
+	// NOTE: The extra byte is for YCbCr_to_RGB_kernel, which always writes 4 bytes per pixel.
+	out    = stbi__malloc_mad3(req_n, ow, oh, 1);
+	cout   = malloc((size_t) (decode_n * ow));
+	xspans = malloc((size_t) (decode_n * ow) * 2U * sizeof(*xspans));
+	if (out == NULL || cout == NULL || xspans == NULL) {
+		free(out);
+		out = NULL;
+		goto cleanup;
+	}
+
+	// The span of each component's plane that backs each output column
+	// NOTE: The planes of subsampled components are hs/vs times smaller than the image itself.
+	for (int k = 0; k < decode_n; k++) {
+		const int hs = j->img_h_max / j->img_comp[k].h;
+		const int cw = j->img_comp[k].x;
+		for (int ox = 0; ox < ow; ox++) {
+			const int cx0                     = MIN((ox * scale) / hs, cw - 1);
+			const int cx1                     = MIN(((ox + 1) * scale + hs - 1) / hs, cw);
+			xspans[(((k * ow) + ox) * 2) + 0] = cx0;
+			xspans[(((k * ow) + ox) * 2) + 1] = MAX(cx1, cx0 + 1);
+		}
+	}
+
+	for (int oy = 0; oy < oh; oy++) {
+		// Average each component over its span...
+		for (int k = 0; k < decode_n; k++) {
+			const int            vs     = j->img_v_max / j->img_comp[k].v;
+			const int            ch     = j->img_comp[k].y;
+			const int            stride = j->img_comp[k].w2;
+			const int            cy0    = MIN((oy * scale) / vs, ch - 1);
+			const int            cy1    = MAX(MIN(((oy + 1) * scale + vs - 1) / vs, ch), cy0 + 1);
+			const unsigned char* plane  = j->img_comp[k].data;
+			const int* restrict  spans  = xspans + (k * ow * 2);
+			unsigned char*       dst    = cout + (k * ow);
+			if (scale == 8) {
+				// Only the top-left pixel of each block is meaningful (c.f., img_jpeg_idct_dc)
+				const unsigned char* row = plane + ((cy0 & ~7) * stride);
+				for (int ox = 0; ox < ow; ox++) {
+					dst[ox] = row[spans[ox * 2] & ~7];
+				}
+			} else {
+				for (int ox = 0; ox < ow; ox++) {
+					const int    cx0 = spans[(ox * 2) + 0];
+					const int    cx1 = spans[(ox * 2) + 1];
+					unsigned int sum = 0U;
+					for (int cy = cy0; cy < cy1; cy++) {
+						const unsigned char* row = plane + (cy * stride);
+						for (int cx = cx0; cx < cx1; cx++) {
+							sum += row[cx];
+						}
+					}
+					const unsigned int count = (unsigned int) ((cy1 - cy0) * (cx1 - cx0));
+					dst[ox]                  = (unsigned char) ((sum + (count >> 1U)) / count);
+				}
+			}
+		}
+
+		// ...and then convert the averaged row to the requested format, like stbi__load_jpeg_image would.
+		unsigned char* restrict       dptr = out + ((size_t) oy * (size_t) ow * (size_t) req_n);
+		const unsigned char* restrict c0   = cout;
+		const unsigned char* restrict c1   = cout + ow;
+		const unsigned char* restrict c2   = cout + (2 * ow);
+		if (req_n >= 3) {
+			if (s.img_n == 3 && !is_rgb) {
+				j->YCbCr_to_RGB_kernel(dptr, c0, c1, c2, ow, req_n);
+			} else {
+				for (int ox = 0; ox < ow; ox++) {
+					if (s.img_n == 3) {
+						dptr[0] = c0[ox];
+						dptr[1] = c1[ox];
+						dptr[2] = c2[ox];
+					} else {
+						dptr[0] = dptr[1] = dptr[2] = c0[ox];
+					}
+					if (req_n == 4) {
+						dptr[3] = 0xFFu;
+					}
+					dptr += req_n;
+				}
+			}
+		} else {
+			for (int ox = 0; ox < ow; ox++) {
+				if (is_rgb) {
+					dptr[0] = stbi__compute_y(c0[ox], c1[ox], c2[ox]);
+				} else {
+					dptr[0] = c0[ox];
+				}
+				if (req_n == 2) {
+					dptr[1] = 0xFFu;
+				}
+				dptr += req_n;
+			}
+		}
+	}
+
+	*w = ow;
+	*h = oh;
+	*n = s.img_n;
+
+cleanup:
+	free(xspans);
+	free(cout);
+	stbi__cleanup_jpeg(j);
+	STBI_FREE(j);
+	return out;
+}
+
+// Decode image data from a memory buffer, via stbi.
+// If scaled_width & scaled_height are set, scaling was requested:
+// they'll be set to the on-screen dimensions (c.f., img_compute_scaled_size for their input values),
+// and JPEGs may be decoded at a reduced resolution in the process,
+// in which case w & h will be set to the *decoded* dimensions.
+static unsigned char*
+    img_load_from_memory(const unsigned char* restrict buffer,
+			 size_t                        len,
+			 int* restrict                 w,
+			 int* restrict                 h,
+			 int* restrict                 n,
+			 int                           req_n,
+			 const FBInkConfig* restrict   fbink_cfg,
+			 unsigned short int* restrict  scaled_width,
+			 unsigned short int* restrict  scaled_height)
+{
+	bool has_scaled_size = false;
+	if (scaled_width && scaled_height && stbi_info_from_memory(buffer, (int) len, w, h, n)) {
+		img_compute_scaled_size(*w, *h, fbink_cfg, scaled_width, scaled_height);
+		has_scaled_size = true;
+
+		// Pick the smallest DCT scaling factor that still leaves us with at least the target resolution,
+		// the AA scaler will take care of the rest.
+		int scale = 8;
+		while (scale > 1 &&
+		       (((*w + scale - 1) / scale) < *scaled_width || ((*h + scale - 1) / scale) < *scaled_height)) {
+			scale >>= 1;
+		}
+		// NOTE: That's SOI
+		if (scale > 1 && len > 2U && buffer[0] == 0xFFu && buffer[1] == 0xD8u) {
+			const int orig_w = *w;
+			const int orig_h = *h;
+			unsigned char* restrict data = img_load_jpeg_scaled(buffer, (int) len, scale, w, h, n, req_n);
+			if (data) {
+				LOG("Decoded JPEG image at 1/%d resolution (%dx%d instead of %dx%d)",
+				    scale,
+				    *w,
+				    *h,
+				    orig_w,
+				    orig_h);
+				return data;
+			}
+			LOG("Failed to decode JPEG image at 1/%d resolution, falling back to a full decode", scale);
+		}
+	}
+
+	unsigned char* restrict data = stbi_load_from_memory(buffer, (int) len, w, h, n, req_n);
+	if (data && scaled_width && scaled_height && !has_scaled_size) {
+		img_compute_scaled_size(*w, *h, fbink_cfg, scaled_width, scaled_height);
+	}
+	return data;
+}
+
 // Load & decode image data from a file or stdin, via stbi
+// c.f., img_load_from_memory for scaled_width & scaled_height
 static unsigned char*
-    img_load_from_file(const char* filename, int* restrict w, int* restrict h, int* restrict n, int req_n)
+    img_load_from_file(const char*                  filename,
+		       int* restrict                w,
+		       int* restrict                h,
+		       int* restrict                n,
+		       int                          req_n,
+		       const FBInkConfig* restrict  fbink_cfg,
+		       unsigned short int* restrict scaled_width,
+		       unsigned short int* restrict scaled_height)
 {
 	unsigned char* restrict data = NULL;
 
@@ -10744,8 +11611,39 @@ static unsigned char*
 		*/
 
 		// Finally, load the image from that buffer, and discard it once we're done.
-		data = stbi_load_from_memory(imgdata, (int) used, w, h, n, req_n);
+		data = img_load_from_memory(imgdata, used, w, h, n, req_n, fbink_cfg, scaled_width, scaled_height);
 		free(imgdata);
+	} else if (scaled_width && scaled_height) {
+		// If we're scaling, we might be able to get away with a reduced resolution decode (c.f., img_load_from_memory),
+		// so, map the file and decode it from memory.
+		int fd = open(filename, O_RDONLY | O_CLOEXEC);
+		if (fd == -1) {
+			PFWARN("open: %m");
+			WARN("Failed to open image `%s`", filename);
+			return NULL;
+		}
+
+		struct stat st;
+		if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode) || st.st_size <= 0 || st.st_size > INT_MAX) {
+			// Not something we can (or want to) map, let stbi deal with it
+			close(fd);
+			data = stbi_load(filename, w, h, n, req_n);
+			if (data) {
+				img_compute_scaled_size(*w, *h, fbink_cfg, scaled_width, scaled_height);
+			}
+		} else {
+			unsigned char* imgdata = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			close(fd);
+			if (imgdata == MAP_FAILED) {
+				PFWARN("mmap: %m");
+				WARN("Failed to map image `%s`", filename);
+				return NULL;
+			}
+
+			data = img_load_from_memory(
+			    imgdata, (size_t) st.st_size, w, h, n, req_n, fbink_cfg, scaled_width, scaled_height);
+			munmap(imgdata, (size_t) st.st_size);
+		}
 	} else {
 		// With a filepath, we can just let stbi handle it ;).
 		data = stbi_load(filename, w, h, n, req_n);
@@ -10761,7 +11659,8 @@ static unsigned char*
 }
 
 // Convert raw image data between various pixel formats
-// NOTE: This is a direct copy of stbi's stbi__convert_format, except that it doesn't free the input buffer.
+// NOTE: This is a direct copy of stbi's stbi__convert_format, except that it doesn't free the input buffer,
+//       and that grayscaling is handled by convert_px_row_to_y.
 static unsigned char*
     img_convert_px_format(const unsigned char* restrict data, int img_n, int req_comp, int x, int y)
 {
@@ -10783,6 +11682,12 @@ static unsigned char*
 		const unsigned char* restrict src = data + (j * x * img_n);
 		unsigned char* restrict dest      = good + (j * x * req_comp);
 
+		// Grayscaling is the only expensive part, so that goes through our (possibly SIMD) scanline converter.
+		if (img_n >= 3 && req_comp <= 2) {
+			convert_px_row_to_y(src, (uint8_t) img_n, dest, (uint8_t) req_comp, (size_t) x);
+			continue;
+		}
+
 #	define STBI__COMBO(a, b) ((a) * 8 + (b))
 #	define STBI__CASE(a, b)                                                                                         \
 		case STBI__COMBO(a, b):                                                                                  \
@@ -10831,28 +11736,6 @@ static unsigned char*
 				dest[3] = 255;
 			}
 			break;
-			STBI__CASE(3, 1)
-			{
-				dest[0] = stbi__compute_y(src[0], src[1], src[2]);
-			}
-			break;
-			STBI__CASE(3, 2)
-			{
-				dest[0] = stbi__compute_y(src[0], src[1], src[2]);
-				dest[1] = 255;
-			}
-			break;
-			STBI__CASE(4, 1)
-			{
-				dest[0] = stbi__compute_y(src[0], src[1], src[2]);
-			}
-			break;
-			STBI__CASE(4, 2)
-			{
-				dest[0] = stbi__compute_y(src[0], src[1], src[2]);
-				dest[1] = src[3];
-			}
-			break;
 			STBI__CASE(4, 3)
 			{
 				dest[0] = src[0];
@@ -10917,100 +11800,40 @@ static __attribute__((hot)) uint8_t
 	return (q > UINT8_MAX ? UINT8_MAX : (uint8_t) q);
 }
 
-static uint8_t
-    hhuclampf(float d, float min, float max)
-{
-	const float t = d < min ? min : d;
-	return t > max ? (uint8_t) max : (uint8_t) t;
-}
-
-static __attribute__((hot)) void
-    saturation_boost_hsp(FBInkPixelRGBA* restrict px, const float change)
-{
-	// This is Darel Rex Finley's HSP changeSaturation function.
-	// c.f., https://alienryderflex.com/saturation.html
-	// We lowered precision from double to floats for performance concerns.
-#	define Pr 0.299f
-#	define Pg 0.587f
-#	define Pb 0.114f
-
-	float R = px->color.r;
-	float G = px->color.g;
-	float B = px->color.b;
-
-	float P = sqrtf(R * R * Pr + G * G * Pg + B * B * Pb);
-
-	R = P + (R - P) * change;
-	G = P + (G - P) * change;
-	B = P + (B - P) * change;
-
-	px->color.r = hhuclampf(R, 0, UINT8_MAX);
-	px->color.g = hhuclampf(G, 0, UINT8_MAX);
-	px->color.b = hhuclampf(B, 0, UINT8_MAX);
-}
-
-// Draw image data on screen (we inherit a few of the variable types/names from stbi ;))
-static int
-    draw_image(int fbfd,
-	       const unsigned char* restrict data,
+// Compute where an image of w x h pixels lands on screen (honoring row/col, halign/valign & x_off/y_off),
+// and which part of it is actually visible (we can't have *anything* going off-screen).
+static void
+    clip_image(FBInkContext* restrict ctx,
 	       const int w,
 	       const int h,
-	       const int n,
-	       const int req_n,
 	       short int x_off,
 	       short int y_off,
-	       const FBInkConfig* restrict fbink_cfg)
+	       const FBInkConfig* restrict fbink_cfg,
+	       FBInkImageClip* restrict clip)
 {
-	// Open the framebuffer if need be...
-	// NOTE: As usual, we *expect* to be initialized at this point!
-	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
-		return ERRCODE(EXIT_FAILURE);
-	}
-
-	// Assume success, until shit happens ;)
-	int rv = EXIT_SUCCESS;
-
-	// mmap the fb if need be...
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
-			rv = ERRCODE(EXIT_FAILURE);
-			goto cleanup;
-		}
-	}
-
-	// Clear screen?
-	if (fbink_cfg->is_cleared) {
-		FBInkPixel bgP = penBGPixel;
-		if (fbink_cfg->is_inverted) {
-			bgP.p ^= 0x00FFFFFFu;
-		}
-		clear_screen(fbfd, &bgP, fbink_cfg->is_flashing);
-	}
-
 	// NOTE: We compute initial offsets from row/col, to help aligning images with text.
 	if (fbink_cfg->col < 0) {
-		x_off = (short int) (viewHoriOrigin + x_off + (MAX(MAXCOLS + fbink_cfg->col, 0) * FONTW));
+		x_off = (short int) (ctx->viewHoriOrigin + x_off + (MAX(ctx->MAXCOLS + fbink_cfg->col, 0) * ctx->FONTW));
 	} else {
-		x_off = (short int) (viewHoriOrigin + x_off + (fbink_cfg->col * FONTW));
+		x_off = (short int) (ctx->viewHoriOrigin + x_off + (fbink_cfg->col * ctx->FONTW));
 	}
 	// NOTE: Unless we *actually* specified a row, ignore viewVertOffset
 	//       The rationale being we want to keep being aligned to text rows when we do specify a row,
 	//       but we don't want the extra offset when we don't (in particular, when printing full-screen images).
 	// NOTE: This means that row 0 and row -MAXROWS *will* behave differently, but so be it...
 	if (fbink_cfg->row < 0) {
-		y_off = (short int) (viewVertOrigin + y_off + (MAX(MAXROWS + fbink_cfg->row, 0) * FONTH));
+		y_off = (short int) (ctx->viewVertOrigin + y_off + (MAX(ctx->MAXROWS + fbink_cfg->row, 0) * ctx->FONTH));
 	} else if (fbink_cfg->row == 0) {
-		y_off = (short int) (viewVertOrigin - viewVertOffset + y_off + (fbink_cfg->row * FONTH));
+		y_off = (short int) (ctx->viewVertOrigin - ctx->viewVertOffset + y_off + (fbink_cfg->row * ctx->FONTH));
 		// This of course means that row 0 effectively breaks that "align with text" contract if viewVertOffset != 0,
 		// on the off-chance we do explicitly really want to align something to row 0, so, warn about it...
 		// The "print full-screen images" use-case is greatly more prevalent than "actually rely on row 0 alignment" ;).
 		// And in case that's *really* needed, using -MAXROWS instead of 0 will honor alignment anyway.
-		if (viewVertOffset != 0U) {
-			LOG("Ignoring the %hhupx row offset because row is 0!", viewVertOffset);
+		if (ctx->viewVertOffset != 0U) {
+			LOG("Ignoring the %hhupx row offset because row is 0!", ctx->viewVertOffset);
 		}
 	} else {
-		y_off = (short int) (viewVertOrigin + y_off + (fbink_cfg->row * FONTH));
+		y_off = (short int) (ctx->viewVertOrigin + y_off + (fbink_cfg->row * ctx->FONTH));
 	}
 	LOG("Adjusted image display coordinates to (%hd, %hd), after column %hd & row %hd",
 	    x_off,
@@ -11021,11 +11844,11 @@ static int
 	// Handle horizontal alignment...
 	switch (fbink_cfg->halign) {
 		case CENTER:
-			x_off = (short int) (x_off + (int) (viewWidth / 2U));
+			x_off = (short int) (x_off + (int) (ctx->viewWidth / 2U));
 			x_off = (short int) (x_off - (w / 2));
 			break;
 		case EDGE:
-			x_off = (short int) (x_off + (int) (viewWidth - (uint32_t) w));
+			x_off = (short int) (x_off + (int) (ctx->viewWidth - (uint32_t) w));
 			break;
 		case NONE:
 		default:
@@ -11038,11 +11861,11 @@ static int
 	// Handle vertical alignment...
 	switch (fbink_cfg->valign) {
 		case CENTER:
-			y_off = (short int) (y_off + (int) (viewHeight / 2U));
+			y_off = (short int) (y_off + (int) (ctx->viewHeight / 2U));
 			y_off = (short int) (y_off - (h / 2));
 			break;
 		case EDGE:
-			y_off = (short int) (y_off + (int) (viewHeight - (uint32_t) h));
+			y_off = (short int) (y_off + (int) (ctx->viewHeight - (uint32_t) h));
 			break;
 		case NONE:
 		default:
@@ -11056,13 +11879,13 @@ static int
 	struct mxcfb_rect region;
 	// NOTE: Assign each field individually to avoid a false-positive with Clang's SA...
 	if (fbink_cfg->row == 0) {
-		region.top = MIN(screenHeight, (uint32_t) MAX((viewVertOrigin - viewVertOffset), y_off));
+		region.top = MIN(ctx->screenHeight, (uint32_t) MAX((ctx->viewVertOrigin - ctx->viewVertOffset), y_off));
 	} else {
-		region.top = MIN(screenHeight, (uint32_t) MAX(viewVertOrigin, y_off));
+		region.top = MIN(ctx->screenHeight, (uint32_t) MAX(ctx->viewVertOrigin, y_off));
 	}
-	region.left   = MIN(screenWidth, (uint32_t) MAX(viewHoriOrigin, x_off));
-	region.width  = MIN(screenWidth - region.left, (uint32_t) w);
-	region.height = MIN(screenHeight - region.top, (uint32_t) h);
+	region.left   = MIN(ctx->screenWidth, (uint32_t) MAX(ctx->viewHoriOrigin, x_off));
+	region.width  = MIN(ctx->screenWidth - region.left, (uint32_t) w);
+	region.height = MIN(ctx->screenHeight - region.top, (uint32_t) h);
 
 	// NOTE: If we ended up with negative display offsets, we should shave those off region.width & region.height,
 	//       when it makes sense to do so,
@@ -11076,27 +11899,27 @@ static int
 	unsigned short int img_y_off  = 0;
 	if (x_off < 0) {
 		// We'll start plotting from the beginning of the *visible* part of the image ;)
-		img_x_off = (unsigned short int) (abs(x_off) + viewHoriOrigin);
+		img_x_off = (unsigned short int) (abs(x_off) + ctx->viewHoriOrigin);
 		max_width = (unsigned short int) (max_width + img_x_off);
 		// Make sure we're not trying to loop past the actual width of the image!
 		max_width = (unsigned short int) MIN(w, max_width);
 		// Only if the visible section of the image's width is smaller than our screen's width...
-		if ((uint32_t) (w - img_x_off) < viewWidth) {
+		if ((uint32_t) (w - img_x_off) < ctx->viewWidth) {
 			region.width -= img_x_off;
 		}
 	}
 	if (y_off < 0) {
 		// We'll start plotting from the beginning of the *visible* part of the image ;)
 		if (fbink_cfg->row == 0) {
-			img_y_off = (unsigned short int) (abs(y_off) + viewVertOrigin - viewVertOffset);
+			img_y_off = (unsigned short int) (abs(y_off) + ctx->viewVertOrigin - ctx->viewVertOffset);
 		} else {
-			img_y_off = (unsigned short int) (abs(y_off) + viewVertOrigin);
+			img_y_off = (unsigned short int) (abs(y_off) + ctx->viewVertOrigin);
 		}
 		max_height = (unsigned short int) (max_height + img_y_off);
 		// Make sure we're not trying to loop past the actual height of the image!
 		max_height = (unsigned short int) MIN(h, max_height);
 		// Only if the visible section of the image's height is smaller than our screen's height...
-		if ((uint32_t) (h - img_y_off) < viewHeight) {
+		if ((uint32_t) (h - img_y_off) < ctx->viewHeight) {
 			region.height -= img_y_off;
 		}
 	}
@@ -11108,23 +11931,44 @@ static int
 	    max_height,
 	    w,
 	    h);
-	// Warn if there's an alpha channel, because it's usually a bit more expensive to handle...
-	// NOTE: We look at the *original* pixel format, not whatever we ended up passing to draw_image,
-	//       because we know that when we had to add an alpha layer for compatibility with the framebuffer
-	//       pixel format (i.e., a 24bpp RGB image to a 32bpp RGBA fb), it's actually fully opaque,
-	//       so we don't actually care about that component, it's just essentially padding for addressing purposes.
-	bool img_has_alpha = false;
-	if (n == 2 || n == 4) {
-		img_has_alpha = true;
-		if (fbink_cfg->ignore_alpha) {
-			LOG("Ignoring the image's alpha channel.");
-		} else {
-			LOG("Image has an alpha channel, we'll have to do alpha blending.");
-		}
-	}
+
+	clip->region     = region;
+	clip->x_off      = x_off;
+	clip->y_off      = y_off;
+	clip->img_x_off  = img_x_off;
+	clip->img_y_off  = img_y_off;
+	clip->max_width  = max_width;
+	clip->max_height = max_height;
+}
+
+// Blit the rows [y_start, y_end) of an image on screen, honoring the placement computed by clip_image.
+// NOTE: data only needs to hold the image's rows starting at data_y,
+//       which allows us to blit a scaled image band by band (c.f., draw_image).
+//       color_prep is the software color preprocessing stage to apply to 32bpp color images, if any
+//       (c.f., prepare_color_prep).
+static void
+    blit_image_rows(FBInkContext* restrict ctx,
+		    const unsigned char* restrict data,
+		    const unsigned short int      data_y,
+		    const int                     w,
+		    const int                     req_n,
+		    const bool                    img_has_alpha,
+		    const FBInkImageClip* restrict clip,
+		    const unsigned short int      y_start,
+		    const unsigned short int      y_end,
+		    const FBInkConfig* restrict   fbink_cfg,
+		    const FBInkColorPrep* restrict color_prep)
+{
+	const short int          x_off      = clip->x_off;
+	const short int          y_off      = clip->y_off;
+	const unsigned short int img_x_off  = clip->img_x_off;
+	const unsigned short int max_width  = clip->max_width;
+	// NOTE: Vertically, we only loop over the requested rows
+	const unsigned short int img_y_off  = y_start;
+	const unsigned short int max_height = y_end;
 
 	// Pre-compute the saturation boost factor, if any
-	const float sat_boost = 1.0f + (fbink_cfg->saturation_boost / 100.0f);
+	const int32_t sat_boost = prepare_saturation_boost(fbink_cfg->saturation_boost);
 
 	// Handle inversion if requested, in a way that avoids branching in the loop ;).
 	// And, as an added bonus, plays well with the fact that legacy devices have an inverted color map...
@@ -11132,8 +11976,8 @@ static int
 	uint24_t inv_rgb  = { 0U };
 	uint32_t inv_rgba = 0U;
 #	ifdef FBINK_FOR_KINDLE
-	if ((deviceQuirks.isKindleLegacy && !fbink_cfg->is_inverted) ||
-	    (!deviceQuirks.isKindleLegacy && fbink_cfg->is_inverted)) {
+	if ((ctx->deviceQuirks.isKindleLegacy && !fbink_cfg->is_inverted) ||
+	    (!ctx->deviceQuirks.isKindleLegacy && fbink_cfg->is_inverted)) {
 #	else
 	if (fbink_cfg->is_inverted) {
 #	endif
@@ -11150,10 +11994,29 @@ static int
 	//       And since we can easily do so from here,
 	//       we also entirely avoid trying to plot off-screen pixels (on any sides).
 	FBInkPixel     pixel      = { 0U };
-	if (deviceQuirks.pixelFormat == FBINK_PXFMT_Y4 || likely(deviceQuirks.pixelFormat == FBINK_PXFMT_Y8)) {
+	if (ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y4 || likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y8)) {
 		// 4bpp & 8bpp
 		if (!fbink_cfg->ignore_alpha && img_has_alpha) {
-			if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_Y8)) {
+			if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y8) && !fbink_cfg->sw_dithering &&
+			    ctx->fxpRotateCoords == &rotate_coordinates_nop) {
+				// 8bpp, w/o dithering nor rotation: we can blend whole scanlines at once
+				// (c.f., blend_px_row_ya_to_y8).
+				// NOTE: Again, assume the fb origin is @ (0, 0), which should hold true at that bitdepth.
+				if (max_width > img_x_off) {
+					for (unsigned short int j = img_y_off; j < max_height; j++) {
+						// NOTE: In this branch, req_n == 2, so we can do << 1 instead of * 2 ;).
+						const size_t img_pix_offset =
+						    (size_t) (((j - data_y) * w) + img_x_off) << 1U;
+						const size_t fb_pix_offset =
+						    ((uint32_t) (j + y_off) * ctx->fInfo.line_length) +
+						    (unsigned int) (img_x_off + x_off);
+						blend_px_row_ya_to_y8(data + img_pix_offset,
+								      ctx->fbPtr + fb_pix_offset,
+								      (size_t) (max_width - img_x_off),
+								      invert);
+					}
+				}
+			} else if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y8)) {
 				// 8bpp
 				// There's an alpha channel in the image, we'll have to do alpha blending...
 				// c.f., https://en.wikipedia.org/wiki/Alpha_compositing
@@ -11163,7 +12026,7 @@ static int
 				for (unsigned short int j = img_y_off; j < max_height; j++) {
 					for (unsigned short int i = img_x_off; i < max_width; i++) {
 						// NOTE: In this branch, req_n == 2, so we can do << 1 instead of * 2 ;).
-						const size_t img_scanline_offset = (size_t) ((j << 1U) * w);
+						const size_t img_scanline_offset = (size_t) (((j - data_y) << 1U) * w);
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
 						// First, we gobble the full image pixel (all 2 bytes)
@@ -11185,9 +12048,9 @@ static int
 							coords.y = (unsigned short int) (j + y_off);
 
 #	ifdef FBINK_FOR_POCKETBOOK
-							(*fxpRotateCoords)(&coords);
+							(*ctx->fxpRotateCoords)(ctx, &coords);
 #	endif
-							put_pixel_Gray8(&coords, &pixel);
+							put_pixel_Gray8(ctx, &coords, &pixel);
 						} else if (img_px.color.a == 0) {
 							// Transparent! Keep fb as-is.
 						} else {
@@ -11201,10 +12064,10 @@ static int
 							//       and we don't care about the rotation checks at this bpp :).
 #	ifdef FBINK_FOR_POCKETBOOK
 							// ... except on PB, where we *may* require rotation...
-							(*fxpRotateCoords)(&coords);
+							(*ctx->fxpRotateCoords)(ctx, &coords);
 #	endif
 							FBInkPixel bg_px;
-							get_pixel_Gray8(&coords, &bg_px);
+							get_pixel_Gray8(ctx, &coords, &bg_px);
 
 							const uint8_t ainv = img_px.color.a ^ 0xFFu;
 							// Blend it!
@@ -11216,7 +12079,7 @@ static int
 								pixel.gray8 = dither_o8x8(i, j, pixel.gray8);
 							}
 
-							put_pixel_Gray8(&coords, &pixel);
+							put_pixel_Gray8(ctx, &coords, &pixel);
 						}
 					}
 				}
@@ -11234,10 +12097,10 @@ static int
 						// NOTE: We use the the pixel function directly, to avoid the OOB checks,
 						//       because we know we're only processing on-screen pixels,
 						//       and we don't care about the rotation checks at this bpp :).
-						get_pixel_Gray4(&coords, &bg_px);
+						get_pixel_Gray4(ctx, &coords, &bg_px);
 
 						// NOTE: In this branch, req_n == 2, so we can do << 1 instead of * 2 ;).
-						const size_t  img_scanline_offset = (size_t) ((j << 1U) * w);
+						const size_t  img_scanline_offset = (size_t) (((j - data_y) << 1U) * w);
 						FBInkPixelG8A img_px;
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
@@ -11254,7 +12117,7 @@ static int
 							pixel.gray8 = dither_o8x8(i, j, pixel.gray8);
 						}
 
-						put_pixel_Gray4(&coords, &pixel);
+						put_pixel_Gray4(ctx, &coords, &pixel);
 					}
 				}
 			}
@@ -11262,21 +12125,28 @@ static int
 			// No alpha in image, or ignored
 			// We can do a simple copy if the target is 8bpp, the source is 8bpp (no alpha), we don't invert,
 			// and we don't dither.
-			if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_Y8) && req_n == 1 && invert == 0U &&
+			if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y8) && req_n == 1 && invert == 0U &&
 			    !fbink_cfg->sw_dithering) {
 				// Scanline by scanline, as we usually have input/output x offsets to honor
-				for (unsigned short int j = img_y_off; j < max_height; j++) {
-					// NOTE: Again, assume the fb origin is @ (0, 0), which should hold true at that bitdepth.
-					const size_t pix_offset = (size_t) ((j * w) + img_x_off);
-					const size_t fb_offset  = ((uint32_t) (j + y_off) * fInfo.line_length) +
-								  (unsigned int) (img_x_off + x_off);
-					memcpy(fbPtr + fb_offset, data + pix_offset, max_width);
+				// NOTE: We only copy the visible part of each scanline, i.e., [img_x_off, max_width)
+				if (max_width > img_x_off) {
+					for (unsigned short int j = img_y_off; j < max_height; j++) {
+						// NOTE: Again, assume the fb origin is @ (0, 0), which should hold true at that bitdepth.
+						const size_t pix_offset = (size_t) (((j - data_y) * w) + img_x_off);
+						const size_t fb_offset  =
+						    ((uint32_t) (j + y_off) * ctx->fInfo.line_length) +
+						    (unsigned int) (img_x_off + x_off);
+						memcpy(ctx->fbPtr + fb_offset,
+						       data + pix_offset,
+						       (size_t) (max_width - img_x_off));
+					}
 				}
 			} else {
 				for (unsigned short int j = img_y_off; j < max_height; j++) {
 					for (unsigned short int i = img_x_off; i < max_width; i++) {
 						// NOTE: Here, req_n is either 2, or 1 if ignore_alpha, so, no shift trickery ;)
-						const size_t pix_offset = (size_t) ((j * req_n * w) + (i * req_n));
+						const size_t pix_offset =
+						    (size_t) (((j - data_y) * req_n * w) + (i * req_n));
 						// SW dithering
 						if (fbink_cfg->sw_dithering) {
 							pixel.gray8 = dither_o8x8(i, j, data[pix_offset] ^ invert);
@@ -11291,30 +12161,69 @@ static int
 						// NOTE: Again, use the pixel functions directly, to skip redundant OOB checks,
 						//       as well as unneeded rotation checks (can't happen at this bpp).
 						// NOTE: GCC appears to be smart enough to hoist that branch out of the loop ;).
-						if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_Y8)) {
+						if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y8)) {
 #	ifdef FBINK_FOR_POCKETBOOK
-							(*fxpRotateCoords)(&coords);
+							(*ctx->fxpRotateCoords)(ctx, &coords);
 #	endif
-							put_pixel_Gray8(&coords, &pixel);
+							put_pixel_Gray8(ctx, &coords, &pixel);
 						} else {
-							put_pixel_Gray4(&coords, &pixel);
+							put_pixel_Gray4(ctx, &coords, &pixel);
 						}
 					}
 				}
 			}
 		}
-	} else if (unlikely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR24) ||
-		   unlikely(deviceQuirks.pixelFormat == FBINK_PXFMT_RGB24) ||
-		   likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGRA) || deviceQuirks.pixelFormat == FBINK_PXFMT_RGBA ||
-		   likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR32) ||
-		   deviceQuirks.pixelFormat == FBINK_PXFMT_RGB32) {
+	} else if (unlikely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR24) ||
+		   unlikely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_RGB24) ||
+		   likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGRA) ||
+		   ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_RGBA ||
+		   likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR32) ||
+		   ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_RGB32) {
 		// 24bpp & 32bpp
 		if (!fbink_cfg->ignore_alpha && img_has_alpha) {
 			FBInkPixelRGBA img_px;
-			if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGRA) ||
-			    deviceQuirks.pixelFormat == FBINK_PXFMT_RGBA ||
-			    likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR32) ||
-			    deviceQuirks.pixelFormat == FBINK_PXFMT_RGB32) {
+			if ((likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGRA) ||
+			     ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_RGBA ||
+			     likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR32) ||
+			     ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_RGB32) &&
+			    (!fbink_cfg->sw_dithering || (color_prep && color_prep->is_cfa))) {
+				// 32bpp, w/o dithering (or with the CFA-aware flavor of it):
+				// we can blend whole scanlines at once
+				// (c.f., blend_px_row_rgba_to_bgrx & blend_px_row_rgba_to_bgrx_preprocessed).
+				// NOTE: Again, assume we can safely skip rotation tweaks
+				const bool is_bgr = ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGRA ||
+						    ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR32;
+				if (max_width > img_x_off) {
+					for (unsigned short int j = img_y_off; j < max_height; j++) {
+						// NOTE: In this branch, req_n == 4, so we can do << 2 instead of * 4 ;).
+						const size_t img_pix_offset =
+						    (size_t) (((j - data_y) * w) + img_x_off) << 2U;
+						const size_t fb_pix_offset =
+						    ((uint32_t) (j + y_off) * ctx->fInfo.line_length) +
+						    ((uint32_t) (img_x_off + x_off) << 2U);
+						if (!color_prep) {
+							blend_px_row_rgba_to_bgrx(data + img_pix_offset,
+										  ctx->fbPtr + fb_pix_offset,
+										  (size_t) (max_width - img_x_off),
+										  invert,
+										  is_bgr);
+						} else {
+							blend_px_row_rgba_to_bgrx_preprocessed(
+							    data + img_pix_offset,
+							    ctx->fbPtr + fb_pix_offset,
+							    (size_t) (max_width - img_x_off),
+							    img_x_off,
+							    j,
+							    invert,
+							    is_bgr,
+							    color_prep);
+						}
+					}
+				}
+			} else if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGRA) ||
+				   ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_RGBA ||
+				   likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR32) ||
+				   ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_RGB32) {
 				// 32bpp
 				FBInkPixel fb_px;
 				// This is essentially a constant in our case... (c.f., put_pixel_RGB32)
@@ -11325,7 +12234,7 @@ static int
 
 						// Yeah, I know, GCC...
 						// NOTE: In this branch, req_n == 4, so we can do << 2 instead of * 4 ;).
-						const size_t img_scanline_offset = (size_t) ((j << 2U) * w);
+						const size_t img_scanline_offset = (size_t) (((j - data_y) << 2U) * w);
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
 						// First, we gobble the full image pixel (all 4 bytes)
@@ -11345,8 +12254,8 @@ static int
 							// but that's probably the best we can do.
 							// Hopefully the RGB vs. BGR branching will be hoisted up by the compiler...
 							// NOTE: This is why we use the full explicit list instead of isRGB: it matches the outer if.
-							if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGRA) ||
-							    likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR32)) {
+							if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGRA) ||
+							    likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR32)) {
 								if (fbink_cfg->sw_dithering) {
 									fb_px.bgra.color.r =
 									    dither_o8x8(i, j, img_px.color.r);
@@ -11375,11 +12284,11 @@ static int
 
 							const size_t fb_scanline_offset =
 							    (uint32_t) ((unsigned short int) (j + y_off) *
-									fInfo.line_length);
+									ctx->fInfo.line_length);
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
 							// And we write the full pixel to the fb (all 4 bytes)
-							*((uint32_t*) (fbPtr + fb_scanline_offset) + (i + x_off)) =
+							*((uint32_t*) (ctx->fbPtr + fb_scanline_offset) + (i + x_off)) =
 							    fb_px.p;
 #	pragma GCC diagnostic pop
 						} else if (img_px.color.a == 0) {
@@ -11390,13 +12299,13 @@ static int
 
 							const size_t fb_scanline_offset =
 							    (uint32_t) ((unsigned short int) (j + y_off) *
-									fInfo.line_length);
+									ctx->fInfo.line_length);
 							FBInkPixel bg_px;
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
 							// Again, read the full pixel from the framebuffer (all 4 bytes)
-							bg_px.p =
-							    *((uint32_t*) (fbPtr + fb_scanline_offset) + (i + x_off));
+							bg_px.p = *((uint32_t*) (ctx->fbPtr + fb_scanline_offset) +
+								    (i + x_off));
 #	pragma GCC diagnostic pop
 
 							// Saturation boost
@@ -11406,8 +12315,8 @@ static int
 							// Don't forget to honor inversion
 							img_px.p ^= invert_32b;
 							// Blend it, honoring pixel order (BGR vs. RGB) in the process ;).
-							if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGRA) ||
-							    likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR32)) {
+							if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGRA) ||
+							    likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR32)) {
 								fb_px.bgra.color.r =
 								    (uint8_t) DIV255(((img_px.color.r * img_px.color.a) +
 										      (bg_px.bgra.color.r * ainv)));
@@ -11450,7 +12359,7 @@ static int
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
 							// And we write the full blended pixel to the fb (all 4 bytes)
-							*((uint32_t*) (fbPtr + fb_scanline_offset) + (i + x_off)) =
+							*((uint32_t*) (ctx->fbPtr + fb_scanline_offset) + (i + x_off)) =
 							    fb_px.p;
 #	pragma GCC diagnostic pop
 						}
@@ -11465,7 +12374,7 @@ static int
 
 						// Yeah, I know, GCC...
 						// NOTE: In this branch, req_n == 4, so we can do << 2 instead of * 4 ;).
-						const size_t img_scanline_offset = (size_t) ((j << 2U) * w);
+						const size_t img_scanline_offset = (size_t) (((j - data_y) << 2U) * w);
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
 						// First, we gobble the full image pixel (all 4 bytes)
@@ -11477,7 +12386,7 @@ static int
 							// Fully opaque, we can blit the image (almost) directly.
 							img_px.p ^= invert_32b;
 							// We do need to handle BGR and honor inversion ;).
-							if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR24)) {
+							if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR24)) {
 								// SW dithering
 								if (fbink_cfg->sw_dithering) {
 									fb_px.bgr.color.r =
@@ -11508,9 +12417,9 @@ static int
 
 							const size_t fb_pix_offset =
 							    (uint32_t) ((unsigned short int) (i + x_off) << 2U) +
-							    ((unsigned short int) (j + y_off) * fInfo.line_length);
+							    ((unsigned short int) (j + y_off) * ctx->fInfo.line_length);
 							// And we write the full pixel to the fb (all 3 bytes)
-							*((uint24_t*) (fbPtr + fb_pix_offset)) = fb_px.rgb24;
+							*((uint24_t*) (ctx->fbPtr + fb_pix_offset)) = fb_px.rgb24;
 						} else if (img_px.color.a == 0) {
 							// Transparent! Keep fb as-is.
 						} else {
@@ -11519,15 +12428,15 @@ static int
 
 							const size_t fb_pix_offset =
 							    (uint32_t) ((unsigned short int) (i + x_off) << 2U) +
-							    ((unsigned short int) (j + y_off) * fInfo.line_length);
+							    ((unsigned short int) (j + y_off) * ctx->fInfo.line_length);
 							// Again, read the full pixel from the framebuffer (all 3 bytes)
 							FBInkPixel bg_px;
-							bg_px.rgb24 = *((uint24_t*) (fbPtr + fb_pix_offset));
+							bg_px.rgb24 = *((uint24_t*) (ctx->fbPtr + fb_pix_offset));
 
 							// Don't forget to honor inversion
 							img_px.p ^= invert_32b;
 							// Blend it, we get our BGR swap in the process ;).
-							if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR24)) {
+							if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR24)) {
 								fb_px.bgr.color.r =
 								    (uint8_t) DIV255(((img_px.color.r * img_px.color.a) +
 										      (bg_px.bgr.color.r * ainv)));
@@ -11568,7 +12477,7 @@ static int
 							}
 
 							// And we write the full blended pixel to the fb (all 3 bytes)
-							*((uint24_t*) (fbPtr + fb_pix_offset)) = fb_px.rgb24;
+							*((uint24_t*) (ctx->fbPtr + fb_pix_offset)) = fb_px.rgb24;
 						}
 					}
 				}
@@ -11576,10 +12485,50 @@ static int
 		} else {
 			// No alpha in image, or ignored
 			// We don't care about image alpha in this branch, so we don't even store it.
-			if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGRA) ||
-			    deviceQuirks.pixelFormat == FBINK_PXFMT_RGBA ||
-			    likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR32) ||
-			    deviceQuirks.pixelFormat == FBINK_PXFMT_RGB32) {
+			const bool is_bgr = likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGRA) ||
+					    likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR32);
+			if ((is_bgr && invert == 0U && !fbink_cfg->sw_dithering) ||
+			    ((is_bgr || ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_RGBA ||
+			      ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_RGB32) &&
+			     (color_prep && color_prep->is_cfa))) {
+				// 32bpp, w/o any per-pixel processing (besides the color preprocessing stage,
+				// which handles inversion & dithering itself when it's CFA-aware):
+				// this boils down to an RGB -> BGR swizzle (or just filling in the alpha byte on RGB-ordered fbs),
+				// which we can do scanline by scanline
+				// (c.f., convert_px_row_to_bgrx & convert_px_row_to_bgrx_preprocessed).
+				// NOTE: Since the per-pixel loop below knows nothing about the CFA-aware stage,
+				//       RGB-ordered fbs only ever end up here when said stage is enabled.
+				// NOTE: Again, assume we can safely skip rotation tweaks
+				if (max_width > img_x_off) {
+					for (unsigned short int j = img_y_off; j < max_height; j++) {
+						const size_t img_pix_offset =
+						    (size_t) (((j - data_y) * req_n * w) + (img_x_off * req_n));
+						const size_t fb_pix_offset =
+						    ((uint32_t) (j + y_off) * ctx->fInfo.line_length) +
+						    ((uint32_t) (img_x_off + x_off) << 2U);
+						if (!color_prep) {
+							convert_px_row_to_bgrx(data + img_pix_offset,
+									       (uint8_t) req_n,
+									       ctx->fbPtr + fb_pix_offset,
+									       (size_t) (max_width - img_x_off));
+						} else {
+							convert_px_row_to_bgrx_preprocessed(
+							    data + img_pix_offset,
+							    (uint8_t) req_n,
+							    ctx->fbPtr + fb_pix_offset,
+							    (size_t) (max_width - img_x_off),
+							    img_x_off,
+							    j,
+							    invert,
+							    is_bgr,
+							    color_prep);
+						}
+					}
+				}
+			} else if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGRA) ||
+				   ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_RGBA ||
+				   likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR32) ||
+				   ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_RGB32) {
 				// 32bpp
 				FBInkPixel fb_px;
 				// This is essentially a constant in our case...
@@ -11587,7 +12536,8 @@ static int
 				for (unsigned short int j = img_y_off; j < max_height; j++) {
 					for (unsigned short int i = img_x_off; i < max_width; i++) {
 						// NOTE: Here, req_n is either 4, or 3 if ignore_alpha, so, no shift trickery ;)
-						const size_t   img_pix_offset = (size_t) ((j * req_n * w) + (i * req_n));
+						const size_t   img_pix_offset =
+						    (size_t) (((j - data_y) * req_n * w) + (i * req_n));
 						// Gobble the full image pixel (we don't care about alpha if it's there)
 						FBInkPixelRGBA img_px;
 						// NOTE: Overread in an RGB32 pixel because it's ever so slightly faster than a 3 bytes memcpy.
@@ -11603,8 +12553,8 @@ static int
 
 						// Handle inversion, BGR swap & SW dithering
 						img_px.p ^= invert_32b;
-						if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGRA) ||
-						    likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR32)) {
+						if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGRA) ||
+						    likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR32)) {
 							if (fbink_cfg->sw_dithering) {
 								fb_px.bgra.color.r = dither_o8x8(i, j, img_px.color.r);
 								fb_px.bgra.color.g = dither_o8x8(i, j, img_px.color.g);
@@ -11631,11 +12581,12 @@ static int
 
 						// NOTE: Again, assume we can safely skip rotation tweaks
 						const size_t fb_scanline_offset =
-						    (uint32_t) ((unsigned short int) (j + y_off) * fInfo.line_length);
+						    (uint32_t) ((unsigned short int) (j + y_off) *
+								ctx->fInfo.line_length);
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
 						// Write the full pixel to the fb (all 4 bytes)
-						*((uint32_t*) (fbPtr + fb_scanline_offset) + (i + x_off)) = fb_px.p;
+						*((uint32_t*) (ctx->fbPtr + fb_scanline_offset) + (i + x_off)) = fb_px.p;
 #	pragma GCC diagnostic pop
 					}
 				}
@@ -11644,7 +12595,8 @@ static int
 				for (unsigned short int j = img_y_off; j < max_height; j++) {
 					for (unsigned short int i = img_x_off; i < max_width; i++) {
 						// NOTE: Here, req_n is either 4, or 3 if ignore_alpha, so, no shift trickery ;)
-						const size_t  img_pix_offset = (size_t) ((j * req_n * w) + (i * req_n));
+						const size_t  img_pix_offset =
+						    (size_t) (((j - data_y) * req_n * w) + (i * req_n));
 						// Gobble the full image pixel (3 bytes, we don't care about alpha if it's there)
 						FBInkPixelRGB img_px;
 						img_px.p = *((const uint24_t*) &data[img_pix_offset]);
@@ -11654,7 +12606,7 @@ static int
 						FBInkPixel fb_px;
 						// Handle inversion, BGR & SW dithering
 						img_px.p.u24 ^= invert_24b.u24;
-						if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR24)) {
+						if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR24)) {
 							if (fbink_cfg->sw_dithering) {
 								fb_px.bgr.color.r = dither_o8x8(i, j, img_px.color.r);
 								fb_px.bgr.color.g = dither_o8x8(i, j, img_px.color.g);
@@ -11678,9 +12630,9 @@ static int
 						// NOTE: Again, assume we can safely skip rotation tweaks
 						const size_t fb_pix_offset =
 						    (uint32_t) ((unsigned short int) (i + x_off) << 2U) +
-						    ((unsigned short int) (j + y_off) * fInfo.line_length);
+						    ((unsigned short int) (j + y_off) * ctx->fInfo.line_length);
 						// Write the full pixel to the fb (all 3 bytes)
-						*((uint24_t*) (fbPtr + fb_pix_offset)) = fb_px.rgb24;
+						*((uint24_t*) (ctx->fbPtr + fb_pix_offset)) = fb_px.rgb24;
 						// NOTE: Again, this should roughly amount to a 3 bytes memcpy,
 						//       although in this instance, GCC generates slightly different code.
 						//memcpy(fbPtr + pix_offset, &fb_px.p, 3 * sizeof(uint8_t));
@@ -11690,14 +12642,31 @@ static int
 		}
 	} else {
 		// 16bpp
-		if (!fbink_cfg->ignore_alpha && img_has_alpha) {
+		if (!fbink_cfg->ignore_alpha && img_has_alpha && !fbink_cfg->sw_dithering &&
+		    ctx->fxpRotateCoords == &rotate_coordinates_nop) {
+			// No per-pixel processing besides inversion, and no rotation:
+			// we can blend whole scanlines at once (c.f., blend_px_row_rgba_to_rgb565).
+			if (max_width > img_x_off) {
+				for (unsigned short int j = img_y_off; j < max_height; j++) {
+					// NOTE: In this branch, req_n == 4, so we can do << 2 instead of * 4 ;).
+					const size_t img_pix_offset = (size_t) (((j - data_y) * w) + img_x_off) << 2U;
+					const size_t fb_pix_offset  = ((uint32_t) (j + y_off) * ctx->fInfo.line_length) +
+								     ((uint32_t) (img_x_off + x_off) << 1U);
+					blend_px_row_rgba_to_rgb565(data + img_pix_offset,
+								    ctx->fbPtr + fb_pix_offset,
+								    (size_t) (max_width - img_x_off),
+								    invert,
+								    ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR565);
+				}
+			}
+		} else if (!fbink_cfg->ignore_alpha && img_has_alpha) {
 			FBInkCoordinates coords;
 			for (unsigned short int j = img_y_off; j < max_height; j++) {
 				for (unsigned short int i = img_x_off; i < max_width; i++) {
 					// NOTE: Same general idea as the fb_is_grayscale case,
 					//       except at this bpp we then have to handle rotation ourselves...
 					// NOTE: In this branch, req_n == 4, so we can do << 2 instead of * 4 ;).
-					const size_t   img_scanline_offset = (size_t) ((j << 2U) * w);
+					const size_t   img_scanline_offset = (size_t) (((j - data_y) << 2U) * w);
 					FBInkPixelRGBA img_px;
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
@@ -11720,7 +12689,7 @@ static int
 							pixel.p = img_px.p;
 						}
 						// Pack it in the right pixel order
-						if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR565)) {
+						if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR565)) {
 							pixel.rgb565 = pack_bgr565(
 							    pixel.rgba.color.r, pixel.rgba.color.g, pixel.rgba.color.b);
 						} else {
@@ -11730,8 +12699,8 @@ static int
 
 						coords.x = (unsigned short int) (i + x_off);
 						coords.y = (unsigned short int) (j + y_off);
-						(*fxpRotateCoords)(&coords);
-						put_pixel_RGB565(&coords, &pixel);
+						(*ctx->fxpRotateCoords)(ctx, &coords);
+						put_pixel_RGB565(ctx, &coords, &pixel);
 					} else if (img_px.color.a == 0) {
 						// Transparent! Keep fb as-is.
 					} else {
@@ -11742,12 +12711,12 @@ static int
 
 						coords.x = (unsigned short int) (i + x_off);
 						coords.y = (unsigned short int) (j + y_off);
-						(*fxpRotateCoords)(&coords);
+						(*ctx->fxpRotateCoords)(ctx, &coords);
 						FBInkPixel bg_px;
 
 						// Deal with pixel order
-						if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR565)) {
-							get_pixel_BGR565(&coords, &bg_px);
+						if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR565)) {
+							get_pixel_BGR565(ctx, &coords, &bg_px);
 
 							// Blend it ;).
 							pixel.bgra.color.r =
@@ -11772,7 +12741,7 @@ static int
 							pixel.rgb565 = pack_bgr565(
 							    pixel.bgra.color.r, pixel.bgra.color.g, pixel.bgra.color.b);
 						} else {
-							get_pixel_RGB565(&coords, &bg_px);
+							get_pixel_RGB565(ctx, &coords, &bg_px);
 
 							// Blend it ;).
 							pixel.rgba.color.r =
@@ -11798,17 +12767,33 @@ static int
 							    pixel.rgba.color.r, pixel.rgba.color.g, pixel.rgba.color.b);
 						}
 
-						put_pixel_RGB565(&coords, &pixel);
+						put_pixel_RGB565(ctx, &coords, &pixel);
 					}
 				}
 			}
+		} else if (invert == 0U && !fbink_cfg->sw_dithering && ctx->fxpRotateCoords == &rotate_coordinates_nop) {
+			// No alpha in image, or ignored, no per-pixel processing, and no rotation:
+			// we can pack whole scanlines at once (c.f., convert_px_row_to_rgb565).
+			if (max_width > img_x_off) {
+				for (unsigned short int j = img_y_off; j < max_height; j++) {
+					const size_t img_pix_offset =
+					    (size_t) (((j - data_y) * req_n * w) + (img_x_off * req_n));
+					const size_t fb_pix_offset  = ((uint32_t) (j + y_off) * ctx->fInfo.line_length) +
+								     ((uint32_t) (img_x_off + x_off) << 1U);
+					convert_px_row_to_rgb565(data + img_pix_offset,
+								 (uint8_t) req_n,
+								 ctx->fbPtr + fb_pix_offset,
+								 (size_t) (max_width - img_x_off),
+								 ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR565);
+				}
+			}
 		} else {
 			// No alpha in image, or ignored
 			// NOTE: For some reason, reading the image 3 or 4 bytes at once doesn't win us anything, here...
 			for (unsigned short int j = img_y_off; j < max_height; j++) {
 				for (unsigned short int i = img_x_off; i < max_width; i++) {
 					// NOTE: Here, req_n is either 4, or 3 if ignore_alpha, so, no shift trickery ;)
-					const size_t pix_offset = (size_t) ((j * req_n * w) + (i * req_n));
+					const size_t pix_offset = (size_t) (((j - data_y) * req_n * w) + (i * req_n));
 					// SW dithering
 					if (fbink_cfg->sw_dithering) {
 						pixel.rgba.color.r = dither_o8x8(i, j, data[pix_offset + 0U] ^ invert);
@@ -11820,7 +12805,7 @@ static int
 						pixel.rgba.color.b = data[pix_offset + 2U] ^ invert;
 					}
 					// Pack it in the right pixel order
-					if (likely(deviceQuirks.pixelFormat == FBINK_PXFMT_BGR565)) {
+					if (likely(ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_BGR565)) {
 						pixel.rgb565 = pack_bgr565(
 						    pixel.rgba.color.r, pixel.rgba.color.g, pixel.rgba.color.b);
 					} else {
@@ -11832,384 +12817,328 @@ static int
 					coords.x = (unsigned short int) (i + x_off);
 					coords.y = (unsigned short int) (j + y_off);
 					// NOTE: Again, we can only skip the OOB checks at this bpp.
-					(*fxpRotateCoords)(&coords);
-					put_pixel_RGB565(&coords, &pixel);
+					(*ctx->fxpRotateCoords)(ctx, &coords);
+					put_pixel_RGB565(ctx, &coords, &pixel);
 				}
 			}
 		}
 	}
+}
 
-	// Handle the last rect stuff...
-	set_last_rect(&region);
-
-	// Rotate the region if need be...
-	(*fxpRotateRegion)(&region);
+// Draw image data on screen (we inherit a few of the variable types/names from stbi ;))
+// NOTE: If the requested on-screen dimensions (dw x dh) differ from the image's (w x h),
+//       we scale it on the fly, one band of rows at a time, right before blitting said band.
+//       This means we never have to hold the full scaled image in memory,
+//       and that each band is still hot in the cache by the time we convert, dither & blend it.
+#	define IMAGE_BAND_SIZE   (64U * 1024U)
+// NOTE: Bands are independent from one another, so they can also be split across a few worker threads,
+//       each of them with its own band buffer (c.f., draw_image_bands).
+#	define IMAGE_MAX_THREADS 16U
 
-	// Fudge the region if we asked for a screen clear, so that we actually refresh the full screen...
-	if (fbink_cfg->is_cleared) {
-		fullscreen_region(&region);
+// Resolve fbink_cfg->scaling_threads to the amount of workers we'll actually use for that many independent shares
+static size_t
+    get_image_threads(const FBInkConfig* restrict fbink_cfg, size_t shares)
+{
+	size_t threads = fbink_cfg->scaling_threads;
+	if (threads == FBINK_SCALING_THREADS_AUTO) {
+		const long int cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		threads             = cpus > 0 ? (size_t) cpus : 1U;
 	}
+	threads = MIN(threads, IMAGE_MAX_THREADS);
+	return MAX(1U, MIN(threads, shares));
+}
 
-	// Refresh screen
-	if (refresh(fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
-		PFWARN("Failed to refresh the screen");
+// How many rows of a dw x dh image, scaled in req_n components, fit in a single band
+// (c.f., draw_image & fbink_scale_plan_alloc).
+static unsigned short int
+    get_image_band_rows(int dw, int dh, int req_n)
+{
+	// Keep each band small enough to stay in the cache, but do at least one full row at a time...
+	const size_t row_size = (size_t) (dw * req_n);
+	return (unsigned short int) MAX(1U, MIN((size_t) dh, IMAGE_BAND_SIZE / row_size));
+}
+
+// Run worker over each of the threads jobs (an array of job_size bytes elements), one per thread.
+// NOTE: We take care of the first one ourselves, as well as of any we couldn't spawn a thread for.
+static void
+    run_image_workers(void* (*worker)(void*), void* jobs, size_t job_size, size_t threads)
+{
+	pthread_t tids[IMAGE_MAX_THREADS];
+	bool      spawned[IMAGE_MAX_THREADS] = { false };
+	for (size_t t = 1U; t < threads; t++) {
+		spawned[t] = pthread_create(&tids[t], NULL, worker, (unsigned char*) jobs + (t * job_size)) == 0;
 	}
 
-	// Cleanup
-cleanup:
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	(*worker)(jobs);
+	for (size_t t = 1U; t < threads; t++) {
+		if (spawned[t]) {
+			pthread_join(tids[t], NULL);
+		} else {
+			(*worker)((unsigned char*) jobs + (t * job_size));
+		}
 	}
-	if (!keep_fd) {
-		close_fb(fbfd);
+}
+
+static void*
+    draw_image_bands(void* arg)
+{
+	FBInkImageBands*      job  = (FBInkImageBands*) arg;
+	FBInkContext*         ctx  = job->ctx;
+	const FBInkImageClip* clip = job->clip;
+
+	const size_t       band_step = (size_t) job->band_rows * job->band_stride;
+	unsigned short int rows;
+	for (size_t y = clip->img_y_off + ((size_t) job->first_band * job->band_rows); y < clip->max_height;
+	     y += band_step) {
+		rows = (unsigned short int) MIN(job->band_rows, clip->max_height - y);
+		if (qSmoothScaleRows(job->scale_info, job->data, job->fbink_cfg->ignore_alpha, (int) y, rows, job->band) !=
+		    0) {
+			// NOTE: Don't blit garbage, and let draw_image know it shouldn't refresh anything.
+			job->rv = ERRCODE(EXIT_FAILURE);
+			break;
+		}
+		blit_image_rows(ctx,
+				job->band,
+				(unsigned short int) y,
+				job->dw,
+				job->req_n,
+				job->img_has_alpha,
+				clip,
+				(unsigned short int) y,
+				(unsigned short int) (y + rows),
+				job->fbink_cfg,
+				job->color_prep);
 	}
 
-	return rv;
+	return NULL;
 }
-#endif    // FBINK_WITH_IMAGE
 
-// Draw an image on screen
-int
-    fbink_print_image(int fbfd                              UNUSED_BY_MINIMAL,
-		      const char* filename                  UNUSED_BY_MINIMAL,
-		      short int x_off                       UNUSED_BY_MINIMAL,
-		      short int y_off                       UNUSED_BY_MINIMAL,
-		      const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
+static int
+    draw_image(FBInkContext* restrict ctx,
+	       int fbfd,
+	       const unsigned char* restrict data,
+	       const int w,
+	       const int h,
+	       const int n,
+	       const int req_n,
+	       const int dw,
+	       const int dh,
+	       short int x_off,
+	       short int y_off,
+	       const FBInkConfig* restrict fbink_cfg,
+	       const FBInkScalePlan* restrict plan)
 {
-#ifdef FBINK_WITH_IMAGE
+	// Open the framebuffer if need be...
+	// NOTE: As usual, we *expect* to be initialized at this point!
+	bool keep_fd = true;
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
 	// Assume success, until shit happens ;)
 	int rv = EXIT_SUCCESS;
 
-	// Let stbi handle grayscaling for us
-	// NOTE: It does so via an approximation of the Rec601Luma formula, in IM-speak
-	//       (c.f., https://www.imagemagick.org/script/command-line-options.php#intensity)
-	//       (c.f., stbi__compute_y @ stb/stb_image.h)
-	int req_n;
-	switch (vInfo.bits_per_pixel) {
-		case 4U:
-			req_n = 1 + !fbink_cfg->ignore_alpha;
-			break;
-		case 8U:
-			req_n = 1 + !fbink_cfg->ignore_alpha;
-			break;
-		case 16U:
-			req_n = 3 + !fbink_cfg->ignore_alpha;
-			break;
-		case 24U:
-			req_n = 3 + !fbink_cfg->ignore_alpha;
-			break;
-		case 32U:
-		default:
-			req_n = 3 + !fbink_cfg->ignore_alpha;
-			break;
+	// mmap the fb if need be...
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
 	}
 
-	// Was scaling requested?
-	bool want_scaling = false;
-	if (fbink_cfg->scaled_width != 0 || fbink_cfg->scaled_height != 0) {
-		LOG("Image scaling requested!");
-		want_scaling = true;
-
-		// NOTE: QImageScale only accepts Y8, Y8A and RGBA input (i.e., RGBA, or RGB stored @ 32bpp, with 8 unused bits).
-		//       We, on the other hand, store RGB in 24bits, so, that won't do...
-		//       TL;DR: When outputting RGB, request RGBA from stbi instead to ensure a 32bpp buffer,
-		//              stbi will set the alpha bytes to 0xFF if the input doesn't have any alpha,
-		//              but that's not relevant, as we'll ask QImageScale to ignore alpha *processing* w/ ignore_alpha
-		// NOTE: That said, if input *has* an alpha channel, QImageScale expects premultiplied alpha,
-		//       while stbi leaves it untouched, meaning straight alpha in the vast majority of cases...
-		if (req_n == 3) {
-			LOG("Enforcing 32bpp buffer for scaling!");
-			req_n = 4;
+	// Clear screen?
+	if (fbink_cfg->is_cleared) {
+		FBInkPixel bgP = ctx->penBGPixel;
+		if (fbink_cfg->is_inverted) {
+			bgP.p ^= 0x00FFFFFFu;
 		}
+		clear_screen(ctx, fbfd, &bgP, fbink_cfg->is_flashing);
 	}
 
-	// Decode image via stbi
-	unsigned char* restrict data = NULL;
-	int w;
-	int h;
-	int n;
-	data = img_load_from_file(filename, &w, &h, &n, req_n);
-	if (data == NULL) {
-		WARN("Failed to decode image data from `%s`", filename);
-		return ERRCODE(EXIT_FAILURE);
-	}
+	// Figure out where we land on screen, and which part of the image is actually visible
+	FBInkImageClip clip;
+	clip_image(ctx, dw, dh, x_off, y_off, fbink_cfg, &clip);
+	struct mxcfb_rect region = clip.region;
 
-	unsigned char* restrict sdata = NULL;
-	// Scale it w/ QImageScale, if requested
-	if (want_scaling) {
-		// Make sure the scaled dimensions start sane...
-		unsigned short int scaled_width;
-		if (fbink_cfg->scaled_width > 0) {
-			// Honor the specified dimension
-			scaled_width = (unsigned short int) fbink_cfg->scaled_width;
-		} else if (fbink_cfg->scaled_width < 0) {
-			// -1 or less -> use the viewport's dimension
-			scaled_width = (unsigned short int) viewWidth;
-		} else {
-			// 0 -> No scaling requested
-			scaled_width = (unsigned short int) w;
-		}
-		unsigned short int scaled_height;
-		if (fbink_cfg->scaled_height > 0) {
-			// Honor the specified dimension
-			scaled_height = (unsigned short int) fbink_cfg->scaled_height;
-		} else if (fbink_cfg->scaled_height < 0) {
-			// -1 or less -> use the viewport's dimension
-			scaled_height = (unsigned short int) viewHeight;
+	// Warn if there's an alpha channel, because it's usually a bit more expensive to handle...
+	// NOTE: We look at the *original* pixel format, not whatever we ended up passing to draw_image,
+	//       because we know that when we had to add an alpha layer for compatibility with the framebuffer
+	//       pixel format (i.e., a 24bpp RGB image to a 32bpp RGBA fb), it's actually fully opaque,
+	//       so we don't actually care about that component, it's just essentially padding for addressing purposes.
+	bool img_has_alpha = false;
+	if (n == 2 || n == 4) {
+		img_has_alpha = true;
+		if (fbink_cfg->ignore_alpha) {
+			LOG("Ignoring the image's alpha channel.");
 		} else {
-			// 0 -> No scaling requested
-			scaled_height = (unsigned short int) h;
-		}
-
-		// NOTE: Handle AR if best fit was requested, or if scaling was requested on one side only...
-		if (fbink_cfg->scaled_width < -1 || fbink_cfg->scaled_height < -1) {
-			float aspect                      = (float) w / (float) h;
-			// We want to fit the image *inside* the viewport, so, enforce our starting scaled dimensions...
-			scaled_width                      = (unsigned short int) viewWidth;
-			scaled_height                     = (unsigned short int) viewHeight;
-			// NOTE: Loosely based on Qt's QSize boundedTo implementation
-			//       c.f., QSize::scaled @ https://github.com/qt/qtbase/blob/dev/src/corelib/tools/qsize.cpp
-			unsigned short int rescaled_width = (unsigned short int) (scaled_height * aspect + 0.5f);
-			// NOTE: One would simply have to check for >= instead of <= to implement
-			//       Qt::KeepAspectRatioByExpanding instead of Qt::KeepAspectRatio
-			if (rescaled_width <= scaled_width) {
-				scaled_width = rescaled_width;
-			} else {
-				scaled_height = (unsigned short int) (scaled_width / aspect + 0.5f);
-			}
-		} else if (fbink_cfg->scaled_width == 0 && fbink_cfg->scaled_height != 0) {
-			// ?xH, compute width, honoring AR
-			float aspect = (float) w / (float) h;
-			scaled_width = (unsigned short int) (scaled_height * aspect + 0.5f);
-		} else if (fbink_cfg->scaled_width != 0 && fbink_cfg->scaled_height == 0) {
-			// Wx?, compute height, honoring AR
-			float aspect  = (float) w / (float) h;
-			scaled_height = (unsigned short int) (scaled_width / aspect + 0.5f);
-		}
-
-		LOG("Scaling image from %dx%d to %hux%hu . . .", w, h, scaled_width, scaled_height);
-
-		sdata = qSmoothScaleImage(data, w, h, req_n, fbink_cfg->ignore_alpha, scaled_width, scaled_height);
-		if (sdata == NULL) {
-			PFWARN("Failed to resize image");
-			return ERRCODE(EXIT_FAILURE);
-		}
-
-		// We're drawing the scaled data, at the requested scaled resolution
-		if (draw_image(fbfd, sdata, scaled_width, scaled_height, n, req_n, x_off, y_off, fbink_cfg) !=
-		    EXIT_SUCCESS) {
-			PFWARN("Failed to display image data on screen");
-			rv = ERRCODE(EXIT_FAILURE);
-			goto cleanup;
-		}
-	} else {
-		// We're drawing the original unscaled data at its native resolution
-		if (draw_image(fbfd, data, w, h, n, req_n, x_off, y_off, fbink_cfg) != EXIT_SUCCESS) {
-			PFWARN("Failed to display image data on screen");
-			rv = ERRCODE(EXIT_FAILURE);
-			goto cleanup;
+			LOG("Image has an alpha channel, we'll have to do alpha blending.");
 		}
 	}
 
-	// Cleanup
-cleanup:
-	// Free the buffer holding our decoded image data
-	stbi_image_free(data);
-	free(sdata);
-
-	return rv;
-#else
-	WARN("Image support is disabled in this FBInk build");
-	return ERRCODE(ENOSYS);
-#endif    // FBINK_WITH_IMAGE
-}
-
-// Draw raw (supposedly image) data on screen
-int
-    fbink_print_raw_data(int fbfd                              UNUSED_BY_MINIMAL,
-			 const unsigned char* restrict data    UNUSED_BY_MINIMAL,
-			 const int w                           UNUSED_BY_MINIMAL,
-			 const int h                           UNUSED_BY_MINIMAL,
-			 const size_t len                      UNUSED_BY_MINIMAL,
-			 short int x_off                       UNUSED_BY_MINIMAL,
-			 short int y_off                       UNUSED_BY_MINIMAL,
-			 const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
-{
-#ifdef FBINK_WITH_IMAGE
-	// Assume success, until shit happens ;)
-	int rv = EXIT_SUCCESS;
-
-	// Since draw_image doesn't really handle every possible case,
-	// we'll have to fiddle with an intermediary buffer ourselves to make it happy,
-	// while still accepting various different kinds of inputs so the user doesn't have to worry about any of this...
-	int req_n;
-	switch (vInfo.bits_per_pixel) {
-		case 4U:
-			req_n = 1 + !fbink_cfg->ignore_alpha;
-			break;
-		case 8U:
-			req_n = 1 + !fbink_cfg->ignore_alpha;
-			break;
-		case 16U:
-			req_n = 3 + !fbink_cfg->ignore_alpha;
-			break;
-		case 24U:
-			req_n = 3 + !fbink_cfg->ignore_alpha;
-			break;
-		case 32U:
-		default:
-			req_n = 3 + !fbink_cfg->ignore_alpha;
-			break;
-	}
+	// Set up the software color preprocessing stage, if need be (it's shared by every band)
+	FBInkColorPrep        color_prep;
+	const FBInkColorPrep* prep = prepare_color_prep(fbink_cfg, &color_prep) ? &color_prep : NULL;
 
-	// Devising the actual amount of components in the input should be as easy as that...
-	int n = (int) len / h / w;
+	if (dw != w || dh != h) {
+		LOG("Scaling image from %dx%d to %dx%d on the fly . . .", w, h, dw, dh);
 
-	LOG("Requested %d color channels, supplied data had %d", req_n, n);
+		// Reuse the caller's scaling plan if it matches, otherwise, compute our own (c.f., fbink_scale_plan_alloc)
+		const bool use_plan = plan && plan->scale_info && plan->w == w && plan->h == h && plan->n == req_n &&
+				      plan->scaled_width == dw && plan->scaled_height == dh;
 
-	// Local pointer we'll end up passing to draw_image, as we may need to process the input data...
-	const unsigned char* restrict img_data = NULL;
+		QImageScaleInfo*       own_scale_info = NULL;
+		const QImageScaleInfo* scale_info     = NULL;
+		if (use_plan) {
+			scale_info = plan->scale_info;
+		} else {
+			if (plan) {
+				LOG("Ignoring a scaling plan that doesn't match this image");
+			}
+			own_scale_info = qSmoothScaleInfoCreate(w, h, req_n, dw, dh);
+			if (!own_scale_info) {
+				PFWARN("Failed to resize image");
+				rv = ERRCODE(EXIT_FAILURE);
+				goto cleanup;
+			}
+			scale_info = own_scale_info;
+		}
 
-	// Was scaling requested?
-	unsigned char* restrict scaled_data = NULL;
-	bool want_scaling                   = false;
-	if (fbink_cfg->scaled_width != 0 || fbink_cfg->scaled_height != 0) {
-		LOG("Image scaling requested!");
-		want_scaling = true;
+		const size_t             row_size  = (size_t) (dw * req_n);
+		const unsigned short int band_rows = get_image_band_rows(dw, dh, req_n);
+		// NOTE: We only ever scale the rows that will actually end up on screen.
+		const size_t bands = ((size_t) (clip.max_height - clip.img_y_off) + band_rows - 1U) / band_rows;
 
-		// NOTE: QImageScale only accepts Y8, Y8A and RGBA input (i.e., RGBA, or RGB stored @ 32bpp, with 8 unused bits).
-		//       We, on the other hand, store RGB in 24bits, so, that won't do...
-		//       TL;DR: When outputting RGB, request RGBA from stbi instead to ensure a 32bpp buffer,
-		//              stbi will set the alpha bytes to 0xFF if the input doesn't have any alpha,
-		//              but that's not relevant, as we'll ask QImageScale to ignore alpha *processing* w/ ignore_alpha
-		// NOTE: That said, if input *has* an alpha channel, QImageScale expects premultiplied alpha,
-		//       while stbi leaves it untouched, meaning straight alpha in the vast majority of cases...
-		if (req_n == 3) {
-			LOG("Enforcing 32bpp buffer for scaling!");
-			req_n = 4;
+		// Split those across a few threads, if requested
+		const size_t threads = get_image_threads(fbink_cfg, bands);
+		if (threads > 1U) {
+			LOG("Splitting scaling across %zu threads", threads);
 		}
-	}
 
-	// If there's a mismatch between the components in the input data vs. what the fb expects,
-	// re-interleave the data w/ stbi's help...
-	unsigned char* restrict converted_data = NULL;
-	if (req_n != n) {
-		LOG("Converting from %d components to the requested %d", n, req_n);
-		// NOTE: stbi__convert_format will *always* free the input buffer, which we do NOT want here...
-		//       Which is why we're using a tweaked internal copy, which does not free ;).
-		converted_data = img_convert_px_format(data, n, req_n, w, h);
-		if (converted_data == NULL) {
-			WARN("Failed to re-interleave input data in a suitable format");
-			rv = ERRCODE(EXIT_FAILURE);
-			goto cleanup;
+		// Reuse the plan's band buffer if it's large enough, too (it's sized for a fully visible image)
+		const size_t band_size = threads * band_rows * row_size;
+		void*        own_band  = NULL;
+		void*        band      = NULL;
+		if (use_plan && plan->band && plan->band_size >= band_size) {
+			band = plan->band;
+		} else {
+			// SSE/NEON friendly alignment, like qSmoothScaleImage
+			if (posix_memalign(&own_band, 16, band_size) != 0) {
+				PFWARN("Error allocating scaling buffer");
+				qSmoothScaleInfoFree(own_scale_info);
+				rv = ERRCODE(EXIT_FAILURE);
+				goto cleanup;
+			}
+			band = own_band;
+		}
+
+		FBInkImageBands jobs[IMAGE_MAX_THREADS];
+		for (size_t t = 0U; t < threads; t++) {
+			jobs[t] = (FBInkImageBands) { .ctx           = ctx,
+						      .data          = data,
+						      .scale_info    = scale_info,
+						      .clip          = &clip,
+						      .fbink_cfg     = fbink_cfg,
+						      .color_prep    = prep,
+						      .band          = (unsigned char*) band + (t * band_rows * row_size),
+						      .req_n         = req_n,
+						      .dw            = dw,
+						      .img_has_alpha = img_has_alpha,
+						      .band_rows     = band_rows,
+						      .first_band    = (unsigned short int) t,
+						      .band_stride   = (unsigned short int) threads,
+						      .rv            = EXIT_SUCCESS };
+		}
+		run_image_workers(&draw_image_bands, jobs, sizeof(*jobs), threads);
+
+		free(own_band);
+		qSmoothScaleInfoFree(own_scale_info);
+
+		for (size_t t = 0U; t < threads; t++) {
+			if (jobs[t].rv != EXIT_SUCCESS) {
+				PFWARN("Failed to resize image");
+				rv = jobs[t].rv;
+				goto cleanup;
+			}
 		}
-		img_data = converted_data;
 	} else {
-		// We can use the input buffer as-is :)
-		LOG("No conversion needed, using the input buffer directly");
-		img_data = data;
+		blit_image_rows(
+		    ctx, data, 0U, w, req_n, img_has_alpha, &clip, clip.img_y_off, clip.max_height, fbink_cfg, prep);
 	}
 
-	// Scale it w/ QImageScale, if requested
-	if (want_scaling) {
-		// Make sure the scaled dimensions start sane...
-		unsigned short int scaled_width;
-		if (fbink_cfg->scaled_width > 0) {
-			// Honor the specified dimension
-			scaled_width = (unsigned short int) fbink_cfg->scaled_width;
-		} else if (fbink_cfg->scaled_width < 0) {
-			// -1 or less -> use the viewport's dimension
-			scaled_width = (unsigned short int) viewWidth;
-		} else {
-			// 0 -> No scaling requested
-			scaled_width = (unsigned short int) w;
-		}
-		unsigned short int scaled_height;
-		if (fbink_cfg->scaled_height > 0) {
-			// Honor the specified dimension
-			scaled_height = (unsigned short int) fbink_cfg->scaled_height;
-		} else if (fbink_cfg->scaled_height < 0) {
-			// -1 or less -> use the viewport's dimension
-			scaled_height = (unsigned short int) viewHeight;
-		} else {
-			// 0 -> No scaling requested
-			scaled_height = (unsigned short int) h;
-		}
-
-		// NOTE: Handle AR if best fit was requested, or if scaling was requested on one side only...
-		if (fbink_cfg->scaled_width < -1 || fbink_cfg->scaled_height < -1) {
-			float aspect                      = (float) w / (float) h;
-			// We want to fit the image *inside* the viewport, so, enforce our starting scaled dimensions...
-			scaled_width                      = (unsigned short int) viewWidth;
-			scaled_height                     = (unsigned short int) viewHeight;
-			// NOTE: Loosely based on Qt's QSize boundedTo implementation
-			//       c.f., QSize::scaled @ https://github.com/qt/qtbase/blob/dev/src/corelib/tools/qsize.cpp
-			unsigned short int rescaled_width = (unsigned short int) (scaled_height * aspect + 0.5f);
-			// NOTE: One would simply have to check for >= instead of <= to implement
-			//       Qt::KeepAspectRatioByExpanding instead of Qt::KeepAspectRatio
-			if (rescaled_width <= scaled_width) {
-				scaled_width = rescaled_width;
-			} else {
-				scaled_height = (unsigned short int) (scaled_width / aspect + 0.5f);
-			}
-		} else if (fbink_cfg->scaled_width == 0 && fbink_cfg->scaled_height != 0) {
-			// ?xH, compute width, honoring AR
-			float aspect = (float) w / (float) h;
-			scaled_width = (unsigned short int) (scaled_height * aspect + 0.5f);
-		} else if (fbink_cfg->scaled_width != 0 && fbink_cfg->scaled_height == 0) {
-			// Wx?, compute height, honoring AR
-			float aspect  = (float) w / (float) h;
-			scaled_height = (unsigned short int) (scaled_width / aspect + 0.5f);
-		}
+	// Handle the last rect stuff...
+	set_last_rect(ctx, &region);
 
-		LOG("Scaling image data from %dx%d to %hux%hu . . .", w, h, scaled_width, scaled_height);
+	// Rotate the region if need be...
+	(*ctx->fxpRotateRegion)(ctx, &region);
 
-		scaled_data =
-		    qSmoothScaleImage(img_data, w, h, req_n, fbink_cfg->ignore_alpha, scaled_width, scaled_height);
-		if (scaled_data == NULL) {
-			PFWARN("Failed to resize image");
-			return ERRCODE(EXIT_FAILURE);
-		}
+	// Fudge the region if we asked for a screen clear, so that we actually refresh the full screen...
+	if (fbink_cfg->is_cleared) {
+		fullscreen_region(ctx, &region);
+	}
 
-		// We're drawing the scaled data, at the requested scaled resolution
-		if (draw_image(fbfd, scaled_data, scaled_width, scaled_height, n, req_n, x_off, y_off, fbink_cfg) !=
-		    EXIT_SUCCESS) {
-			PFWARN("Failed to display image data on screen");
-			rv = ERRCODE(EXIT_FAILURE);
-			goto cleanup;
-		}
-	} else {
-		// We should now be able to draw that on screen, knowing that it probably won't horribly implode ;p
-		if (draw_image(fbfd, img_data, w, h, n, req_n, x_off, y_off, fbink_cfg) != EXIT_SUCCESS) {
-			PFWARN("Failed to display image data on screen");
-			rv = ERRCODE(EXIT_FAILURE);
-			goto cleanup;
-		}
+	// Refresh screen
+	if (refresh(ctx, fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
+		PFWARN("Failed to refresh the screen");
 	}
 
 	// Cleanup
 cleanup:
-	// If we created an intermediary buffer ourselves, free it.
-	free(converted_data);
-	// And the scaled buffer
-	free(scaled_data);
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
+	}
+	if (!keep_fd) {
+		close_fb(ctx, fbfd);
+	}
 
 	return rv;
-#else
-	WARN("Image support is disabled in this FBInk build");
-	return ERRCODE(ENOSYS);
-#endif    // FBINK_WITH_IMAGE
 }
 
-// Dump the full fb (first visible screen)
-int
-    fbink_dump(int fbfd UNUSED_BY_MINIMAL, FBInkDump* restrict dump UNUSED_BY_MINIMAL)
+// Plot a single pixel from a packed data palette (c.f., draw_packed_data)
+static inline __attribute__((always_inline)) void
+    put_packed_pixel(FBInkContext* restrict ctx,
+		     unsigned short int x,
+		     unsigned short int y,
+		     const FBInkPixel* restrict px,
+		     uint8_t fb_bpp)
+{
+	if (fb_bpp != 0U) {
+		// Native pixel layout, we can just copy the relevant bytes of the palette entry
+		memcpy(ctx->fbPtr + ((uint32_t) y * ctx->fInfo.line_length) + ((uint32_t) x * fb_bpp), px, fb_bpp);
+		return;
+	}
+
+	FBInkCoordinates coords;
+	coords.x = x;
+	coords.y = y;
+	// NOTE: As in draw_image, only 16bpp (and 8bpp on PB) may require rotation, and Y4 never does.
+	if (ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y4) {
+		put_pixel_Gray4(ctx, &coords, px);
+	} else if (ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y8) {
+		(*ctx->fxpRotateCoords)(ctx, &coords);
+		put_pixel_Gray8(ctx, &coords, px);
+	} else {
+		(*ctx->fxpRotateCoords)(ctx, &coords);
+		put_pixel_RGB565(ctx, &coords, px);
+	}
+}
+
+// Draw packed low bitdepth data (1, 2 or 4bpp, MSB first) on screen, mapped to our pen colors
+static int
+    draw_packed_data(FBInkContext* restrict ctx,
+		     int fbfd,
+		     const unsigned char* restrict data,
+		     const int    w,
+		     const int    h,
+		     const size_t stride,
+		     const uint8_t bpp,
+		     short int    x_off,
+		     short int    y_off,
+		     const FBInkConfig* restrict fbink_cfg)
 {
-#ifdef FBINK_WITH_IMAGE
 	// Open the framebuffer if need be...
 	// NOTE: As usual, we *expect* to be initialized at this point!
 	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -12217,51 +13146,2377 @@ int
 	int rv = EXIT_SUCCESS;
 
 	// mmap the fb if need be...
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
 	}
 
-	// Dump the *full* fb
-	// Free current data in case the dump struct is being reused
-	if (dump->data) {
-		LOG("Recycling FBinkDump!");
-		free(dump->data);
-		dump->data = NULL;
-		// Reset the crop settings
-		dump->clip = (const FBInkRect) { 0U };
+	FBInkPixel fgP = ctx->penFGPixel;
+	FBInkPixel bgP = ctx->penBGPixel;
+	if (fbink_cfg->is_inverted) {
+		// NOTE: Same RGB565 caveat as in draw_image ;).
+		fgP.p ^= 0x00FFFFFFu;
+		bgP.p ^= 0x00FFFFFFu;
 	}
-	// Start by allocating enough memory for a full dump of the visible screen...
-	dump->stride = fInfo.line_length;
-	dump->size   = (size_t) (dump->stride * vInfo.yres);
-	dump->data   = calloc(dump->size, sizeof(*dump->data));
-	if (dump->data == NULL) {
-		PFWARN("dump->data %zu bytes calloc: %m", dump->size);
-		dump->stride = 0U;
-		dump->size   = 0U;
-		rv           = ERRCODE(EXIT_FAILURE);
-		goto cleanup;
+
+	// Clear screen?
+	if (fbink_cfg->is_cleared) {
+		clear_screen(ctx, fbfd, &bgP, fbink_cfg->is_flashing);
+	}
+
+	// Figure out where we land on screen, and which part of the data is actually visible
+	FBInkImageClip clip;
+	clip_image(ctx, w, h, x_off, y_off, fbink_cfg, &clip);
+	x_off                               = clip.x_off;
+	y_off                               = clip.y_off;
+	struct mxcfb_rect        region     = clip.region;
+	const unsigned short int img_x_off  = clip.img_x_off;
+	const unsigned short int img_y_off  = clip.img_y_off;
+	const unsigned short int max_width  = clip.max_width;
+	const unsigned short int max_height = clip.max_height;
+
+	// Build our palette: 0 is the background pen, all bits set is the foreground pen,
+	// and, at 2bpp & 4bpp, everything in between is a linear ramp from one to the other.
+	const uint8_t max_idx = (uint8_t) ((1U << bpp) - 1U);
+	FBInkPixel    palette[16U];
+	palette[0U]      = bgP;
+	palette[max_idx] = fgP;
+	if (max_idx > 1U) {
+		// NOTE: Y4 pens are stored as Y8, like everything else at that bitdepth.
+		const FBINK_PXFMT_INDEX_T pen_fmt =
+		    ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y4 ? FBINK_PXFMT_Y8 : ctx->deviceQuirks.pixelFormat;
+		FBInkPixelRGBA bg_px;
+		FBInkPixelRGBA fg_px;
+		unpack_px_row((const unsigned char*) &bgP, pen_fmt, &bg_px, 1U);
+		unpack_px_row((const unsigned char*) &fgP, pen_fmt, &fg_px, 1U);
+		for (uint8_t k = 1U; k < max_idx; k++) {
+			const uint8_t ik = (uint8_t) (max_idx - k);
+			palette[k]       = pack_pixel_from_rgba(
+			    ctx,
+			    (uint8_t) (((fg_px.color.r * k) + (bg_px.color.r * ik) + (max_idx >> 1U)) / max_idx),
+			    (uint8_t) (((fg_px.color.g * k) + (bg_px.color.g * ik) + (max_idx >> 1U)) / max_idx),
+			    (uint8_t) (((fg_px.color.b * k) + (bg_px.color.b * ik) + (max_idx >> 1U)) / max_idx),
+			    0xFFu);
+		}
+	}
+
+	// If the target pixel format doesn't need any rotation or sub-byte shenanigans,
+	// we can write straight to the fb.
+	uint8_t fb_bpp = 0U;
+	switch (ctx->deviceQuirks.pixelFormat) {
+		case FBINK_PXFMT_Y8:
+#	ifndef FBINK_FOR_POCKETBOOK
+			fb_bpp = 1U;
+#	endif
+			break;
+		case FBINK_PXFMT_BGR24:
+		case FBINK_PXFMT_RGB24:
+			fb_bpp = 3U;
+			break;
+		case FBINK_PXFMT_BGRA:
+		case FBINK_PXFMT_RGBA:
+		case FBINK_PXFMT_BGR32:
+		case FBINK_PXFMT_RGB32:
+			fb_bpp = 4U;
+			break;
+		default:
+			break;
+	}
+
+	// In which case, expand whole input bytes at a time via a lookup table, if there's enough data to make it worth it.
+	// NOTE: That's 256 entries of up to 8 pixels of up to 4 bytes, i.e., 8KB at worst (32bpp fb, 1bpp input).
+	const uint8_t ppb       = (uint8_t) (8U / bpp);
+	const size_t  lut_pitch = (size_t) (ppb * fb_bpp);
+	const bool    skip_bg   = fbink_cfg->is_bgless;
+	const bool    skip_fg   = fbink_cfg->is_fgless;
+	unsigned char lut[256U * 8U * 4U];
+	bool          use_lut = false;
+	if (fb_bpp != 0U &&
+	    (size_t) (max_width - img_x_off) * (size_t) (max_height - img_y_off) > (size_t) (256U * ppb)) {
+		for (size_t b = 0U; b < 256U; b++) {
+			for (uint8_t k = 0U; k < ppb; k++) {
+				const uint8_t idx = (uint8_t) ((b >> (8U - bpp - (k * bpp))) & max_idx);
+				memcpy(lut + (b * lut_pitch) + (k * fb_bpp), &palette[idx], fb_bpp);
+			}
+		}
+		use_lut = true;
+		LOG("Expanding %hhubpp input via a lookup table", bpp);
+	}
+
+	for (unsigned short int j = img_y_off; j < max_height; j++) {
+		const unsigned char* restrict src_row = data + ((size_t) j * stride);
+		const unsigned short int      fb_y    = (unsigned short int) (j + y_off);
+		unsigned short int            i       = img_x_off;
+		if (use_lut) {
+			unsigned char* restrict dst_row = ctx->fbPtr + ((uint32_t) fb_y * ctx->fInfo.line_length);
+			// Handle the leading pixels one by one until we're byte-aligned in the input...
+			for (; i < max_width && (i % ppb) != 0U; i++) {
+				const uint8_t idx =
+				    (uint8_t) ((src_row[(i * bpp) >> 3U] >> (8U - bpp - ((i * bpp) & 7U))) & max_idx);
+				if ((idx == 0U && skip_bg) || (idx == max_idx && skip_fg)) {
+					continue;
+				}
+				put_packed_pixel(ctx, (unsigned short int) (i + x_off), fb_y, &palette[idx], fb_bpp);
+			}
+			// ... then expand whole bytes at once.
+			for (; i + ppb <= max_width; i = (unsigned short int) (i + ppb)) {
+				const uint8_t b = src_row[i / ppb];
+				// NOTE: A byte is either all bg or all fg, whatever the bitdepth, only at 0x00 & 0xFF.
+				if ((b == 0x00u && skip_bg) || (b == 0xFFu && skip_fg)) {
+					continue;
+				}
+				if ((!skip_bg && !skip_fg) || b == 0x00u || b == 0xFFu) {
+					memcpy(dst_row + ((uint32_t) (i + x_off) * fb_bpp), lut + (b * lut_pitch), lut_pitch);
+				} else {
+					// Mixed byte with transparency, we'll have to look at every pixel
+					for (uint8_t k = 0U; k < ppb; k++) {
+						const uint8_t idx = (uint8_t) ((b >> (8U - bpp - (k * bpp))) & max_idx);
+						if ((idx == 0U && skip_bg) || (idx == max_idx && skip_fg)) {
+							continue;
+						}
+						put_packed_pixel(ctx,
+								 (unsigned short int) (i + k + x_off),
+								 fb_y,
+								 &palette[idx],
+								 fb_bpp);
+					}
+				}
+			}
+		}
+		// Whatever's left (or everything, if we couldn't use the LUT)
+		for (; i < max_width; i++) {
+			const uint8_t idx =
+			    (uint8_t) ((src_row[(i * bpp) >> 3U] >> (8U - bpp - ((i * bpp) & 7U))) & max_idx);
+			if ((idx == 0U && skip_bg) || (idx == max_idx && skip_fg)) {
+				continue;
+			}
+			put_packed_pixel(ctx, (unsigned short int) (i + x_off), fb_y, &palette[idx], fb_bpp);
+		}
+	}
+
+	// Handle the last rect stuff...
+	set_last_rect(ctx, &region);
+
+	// Rotate the region if need be...
+	(*ctx->fxpRotateRegion)(ctx, &region);
+
+	// Fudge the region if we asked for a screen clear, so that we actually refresh the full screen...
+	if (fbink_cfg->is_cleared) {
+		fullscreen_region(ctx, &region);
+	}
+
+	// Refresh screen
+	if (refresh(ctx, fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
+		PFWARN("Failed to refresh the screen");
+	}
+
+	// Cleanup
+cleanup:
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
+	}
+	if (!keep_fd) {
+		close_fb(ctx, fbfd);
+	}
+
+	return rv;
+}
+
+// Copy data already in the fb's pixel format straight to the fb
+// NOTE: When coordinates need to be rotated, we work in square tiles,
+//       so that neither the reads nor the writes thrash the cache too badly (same idea as in fbink_restore).
+#	define NATIVE_TILE_SIZE 32U
+static int
+    draw_native_data(FBInkContext* restrict ctx,
+		     int fbfd,
+		     const unsigned char* restrict data,
+		     const int    w,
+		     const int    h,
+		     const size_t stride,
+		     short int    x_off,
+		     short int    y_off,
+		     const FBInkConfig* restrict fbink_cfg)
+{
+	// Open the framebuffer if need be...
+	// NOTE: As usual, we *expect* to be initialized at this point!
+	bool keep_fd = true;
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// mmap the fb if need be...
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// Clear screen?
+	if (fbink_cfg->is_cleared) {
+		FBInkPixel bgP = ctx->penBGPixel;
+		if (fbink_cfg->is_inverted) {
+			bgP.p ^= 0x00FFFFFFu;
+		}
+		clear_screen(ctx, fbfd, &bgP, fbink_cfg->is_flashing);
+	}
+
+	// Figure out where we land on screen, and which part of the data is actually visible
+	FBInkImageClip clip;
+	clip_image(ctx, w, h, x_off, y_off, fbink_cfg, &clip);
+	x_off                               = clip.x_off;
+	y_off                               = clip.y_off;
+	struct mxcfb_rect        region     = clip.region;
+	const unsigned short int img_x_off  = clip.img_x_off;
+	const unsigned short int img_y_off  = clip.img_y_off;
+	const unsigned short int max_width  = clip.max_width;
+	const unsigned short int max_height = clip.max_height;
+
+	if (ctx->deviceQuirks.pixelFormat == FBINK_PXFMT_Y4) {
+		// Two pixels per byte, so we can only copy whole bytes when the input & the fb agree on nibble alignment.
+		// NOTE: Y4 is never rotated.
+		for (unsigned short int j = img_y_off; j < max_height; j++) {
+			const unsigned char* restrict src_row = data + ((size_t) j * stride);
+			unsigned char* restrict dst_row = ctx->fbPtr + ((uint32_t) (j + y_off) * ctx->fInfo.line_length);
+			unsigned short int            i       = img_x_off;
+			if (((i ^ (unsigned short int) (i + x_off)) & 0x01u) == 0U) {
+				// Get the odd leading pixel out of the way...
+				if ((i & 0x01u) != 0U && i < max_width) {
+					const size_t fb_offset = (size_t) (i + x_off) >> 1U;
+					dst_row[fb_offset] =
+					    (unsigned char) ((dst_row[fb_offset] & 0xF0u) | (src_row[i >> 1U] & 0x0Fu));
+					i++;
+				}
+				// ... then copy whole bytes
+				const unsigned short int pairs = (unsigned short int) ((max_width - MIN(i, max_width)) >> 1U);
+				memcpy(dst_row + ((size_t) (i + x_off) >> 1U), src_row + (i >> 1U), pairs);
+				i = (unsigned short int) (i + (pairs << 1U));
+			}
+			// Whatever's left (or everything, if we're misaligned), one nibble at a time
+			for (; i < max_width; i++) {
+				const uint8_t v = (uint8_t) (((i & 0x01u) == 0U) ? (src_row[i >> 1U] >> 4U)
+									       : (src_row[i >> 1U] & 0x0Fu));
+				const unsigned short int x         = (unsigned short int) (i + x_off);
+				const size_t             fb_offset = x >> 1U;
+				if ((x & 0x01u) == 0U) {
+					dst_row[fb_offset] = (unsigned char) ((dst_row[fb_offset] & 0x0Fu) | (v << 4U));
+				} else {
+					dst_row[fb_offset] = (unsigned char) ((dst_row[fb_offset] & 0xF0u) | v);
+				}
+			}
+		}
+	} else {
+		const uint8_t fb_bpp = (uint8_t) (ctx->vInfo.bits_per_pixel >> 3U);
+		if (ctx->fxpRotateCoords == &rotate_coordinates_nop) {
+			// The happy path: a plain clipped scanline copy
+			// NOTE: max_width may be smaller than img_x_off when we're entirely off-screen.
+			const size_t row_len = (size_t) (max_width - MIN(img_x_off, max_width)) * fb_bpp;
+			for (unsigned short int j = img_y_off; row_len != 0U && j < max_height; j++) {
+				const size_t src_offset = ((size_t) j * stride) + ((size_t) img_x_off * fb_bpp);
+				const size_t fb_offset  = ((uint32_t) (j + y_off) * ctx->fInfo.line_length) +
+							 ((uint32_t) (img_x_off + x_off) * fb_bpp);
+				memcpy(ctx->fbPtr + fb_offset, data + src_offset, row_len);
+			}
+		} else {
+			// We need to rotate every pixel, so, do it tile by tile
+			for (uint32_t ty = img_y_off; ty < max_height; ty += NATIVE_TILE_SIZE) {
+				const uint32_t ty_end = MIN(ty + NATIVE_TILE_SIZE, max_height);
+				for (uint32_t tx = img_x_off; tx < max_width; tx += NATIVE_TILE_SIZE) {
+					const uint32_t tx_end = MIN(tx + NATIVE_TILE_SIZE, max_width);
+					for (uint32_t j = ty; j < ty_end; j++) {
+						const unsigned char* restrict src_row = data + ((size_t) j * stride);
+						for (uint32_t i = tx; i < tx_end; i++) {
+							FBInkCoordinates coords;
+							coords.x = (unsigned short int) ((int) i + x_off);
+							coords.y = (unsigned short int) ((int) j + y_off);
+							(*ctx->fxpRotateCoords)(ctx, &coords);
+							copy_px(ctx->fbPtr +
+								    ((uint32_t) coords.y * ctx->fInfo.line_length) +
+								    ((uint32_t) coords.x * fb_bpp),
+								src_row + ((size_t) i * fb_bpp),
+								fb_bpp);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	// Handle the last rect stuff...
+	set_last_rect(ctx, &region);
+
+	// Rotate the region if need be...
+	(*ctx->fxpRotateRegion)(ctx, &region);
+
+	// Fudge the region if we asked for a screen clear, so that we actually refresh the full screen...
+	if (fbink_cfg->is_cleared) {
+		fullscreen_region(ctx, &region);
+	}
+
+	// Refresh screen
+	if (refresh(ctx, fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
+		PFWARN("Failed to refresh the screen");
+	}
+
+	// Cleanup
+cleanup:
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
+	}
+	if (!keep_fd) {
+		close_fb(ctx, fbfd);
+	}
+
+	return rv;
+}
+
+// Decode & scale a worker's share of a batch of thumbnails (c.f., fbink_print_thumbnails)
+static void*
+    load_thumbnails(void* arg)
+{
+	const FBInkThumbnailJobs* job = (const FBInkThumbnailJobs*) arg;
+
+	// Thumbnails are always scaled to fit in their own box
+	FBInkConfig scale_cfg   = *job->fbink_cfg;
+	scale_cfg.scaled_width  = -2;
+	scale_cfg.scaled_height = -2;
+
+	for (size_t i = job->first; i < job->count; i += job->stride) {
+		FBInkThumbnail* thumb = &job->thumbs[i];
+
+		// Is there a cached copy we can use?
+		if (thumb->data) {
+			if (thumb->box_width == thumb->rect.width && thumb->box_height == thumb->rect.height &&
+			    thumb->n == job->req_n) {
+				continue;
+			}
+			LOG("Discarding stale cached thumbnail %zu", i);
+			fbink_free_thumbnail_data(thumb);
+		}
+
+		if (thumb->rect.width == 0U || thumb->rect.height == 0U) {
+			continue;
+		}
+		// NOTE: We can't have several threads fighting over stdin, and it wouldn't be cacheable anyway.
+		if (strcmp(thumb->filename, "-") == 0) {
+			WARN("Thumbnail %zu: cannot read image data from stdin", i);
+			continue;
+		}
+
+		unsigned char* restrict data = NULL;
+		int                     w;
+		int                     h;
+		int                     n;
+		unsigned short int      scaled_width  = thumb->rect.width;
+		unsigned short int      scaled_height = thumb->rect.height;
+
+		data = img_load_from_file(
+		    thumb->filename, &w, &h, &n, job->req_n, &scale_cfg, &scaled_width, &scaled_height);
+		if (data == NULL) {
+			WARN("Failed to decode image data from `%s`", thumb->filename);
+			continue;
+		}
+
+		if (scaled_width != w || scaled_height != h) {
+			unsigned char* restrict scaled_data = qSmoothScaleImage(
+			    data, w, h, job->req_n, job->fbink_cfg->ignore_alpha, scaled_width, scaled_height);
+			stbi_image_free(data);
+			if (scaled_data == NULL) {
+				WARN("Failed to resize image `%s` from %dx%d to %hux%hu",
+				     thumb->filename,
+				     w,
+				     h,
+				     scaled_width,
+				     scaled_height);
+				continue;
+			}
+			data = scaled_data;
+		}
+
+		thumb->data       = data;
+		thumb->width      = scaled_width;
+		thumb->height     = scaled_height;
+		thumb->n          = (uint8_t) job->req_n;
+		thumb->has_alpha  = (n == 2 || n == 4);
+		thumb->box_width  = thumb->rect.width;
+		thumb->box_height = thumb->rect.height;
+	}
+
+	return NULL;
+}
+#endif    // FBINK_WITH_IMAGE
+
+#ifdef FBINK_WITH_IMAGE
+// Draw an image on screen (c.f., fbink_print_image & fbink_print_image_planned, plan may be NULL)
+static int
+    print_image(FBInkContext* restrict ctx,
+		int         fbfd,
+		const char* filename,
+		short int   x_off,
+		short int   y_off,
+		const FBInkConfig* restrict fbink_cfg,
+		const FBInkScalePlan* restrict plan)
+{
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// Let stbi handle grayscaling for us
+	// NOTE: It does so via an approximation of the Rec601Luma formula, in IM-speak
+	//       (c.f., https://www.imagemagick.org/script/command-line-options.php#intensity)
+	//       (c.f., stbi__compute_y @ stb/stb_image.h)
+	int req_n;
+	switch (ctx->vInfo.bits_per_pixel) {
+		case 4U:
+			req_n = 1 + !fbink_cfg->ignore_alpha;
+			break;
+		case 8U:
+			req_n = 1 + !fbink_cfg->ignore_alpha;
+			break;
+		case 16U:
+			req_n = 3 + !fbink_cfg->ignore_alpha;
+			break;
+		case 24U:
+			req_n = 3 + !fbink_cfg->ignore_alpha;
+			break;
+		case 32U:
+		default:
+			req_n = 3 + !fbink_cfg->ignore_alpha;
+			break;
+	}
+
+	// Was scaling requested?
+	bool want_scaling = false;
+	if (fbink_cfg->scaled_width != 0 || fbink_cfg->scaled_height != 0) {
+		LOG("Image scaling requested!");
+		want_scaling = true;
+
+		// NOTE: QImageScale only accepts Y8, Y8A and RGBA input (i.e., RGBA, or RGB stored @ 32bpp, with 8 unused bits).
+		//       We, on the other hand, store RGB in 24bits, so, that won't do...
+		//       TL;DR: When outputting RGB, request RGBA from stbi instead to ensure a 32bpp buffer,
+		//              stbi will set the alpha bytes to 0xFF if the input doesn't have any alpha,
+		//              but that's not relevant, as we'll ask QImageScale to ignore alpha *processing* w/ ignore_alpha
+		// NOTE: That said, if input *has* an alpha channel, QImageScale expects premultiplied alpha,
+		//       while stbi leaves it untouched, meaning straight alpha in the vast majority of cases...
+		if (req_n == 3) {
+			LOG("Enforcing 32bpp buffer for scaling!");
+			req_n = 4;
+		}
+	}
+
+	// Decode image via stbi
+	// NOTE: If we're scaling, this also computes the on-screen dimensions,
+	//       and may decode JPEGs at a reduced resolution in the process (c.f., img_load_from_memory).
+	unsigned char* restrict data = NULL;
+	int                     w;
+	int                     h;
+	int                     n;
+	unsigned short int      scaled_width  = (unsigned short int) ctx->viewWidth;
+	unsigned short int      scaled_height = (unsigned short int) ctx->viewHeight;
+
+	data = img_load_from_file(filename,
+				  &w,
+				  &h,
+				  &n,
+				  req_n,
+				  fbink_cfg,
+				  want_scaling ? &scaled_width : NULL,
+				  want_scaling ? &scaled_height : NULL);
+	if (data == NULL) {
+		WARN("Failed to decode image data from `%s`", filename);
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Scale it w/ QImageScale, if requested
+	if (want_scaling) {
+		// We're drawing the data at the requested scaled resolution (draw_image scales it on the fly)
+		if (draw_image(ctx,
+			       fbfd,
+			       data,
+			       w,
+			       h,
+			       n,
+			       req_n,
+			       scaled_width,
+			       scaled_height,
+			       x_off,
+			       y_off,
+			       fbink_cfg,
+			       plan) != EXIT_SUCCESS) {
+			PFWARN("Failed to display image data on screen");
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	} else {
+		// We're drawing the original unscaled data at its native resolution
+		if (draw_image(ctx, fbfd, data, w, h, n, req_n, w, h, x_off, y_off, fbink_cfg, NULL) != EXIT_SUCCESS) {
+			PFWARN("Failed to display image data on screen");
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// Cleanup
+cleanup:
+	// Free the buffer holding our decoded image data
+	stbi_image_free(data);
+
+	return rv;
+}
+
+// Draw raw (supposedly image) data on screen (c.f., fbink_print_raw_data & fbink_print_raw_data_planned)
+static int
+    print_raw_data(FBInkContext* restrict ctx,
+		   int fbfd,
+		   const unsigned char* restrict data,
+		   const int    w,
+		   const int    h,
+		   const size_t len,
+		   short int    x_off,
+		   short int    y_off,
+		   const FBInkConfig* restrict fbink_cfg,
+		   const FBInkScalePlan* restrict plan)
+{
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// Since draw_image doesn't really handle every possible case,
+	// we'll have to fiddle with an intermediary buffer ourselves to make it happy,
+	// while still accepting various different kinds of inputs so the user doesn't have to worry about any of this...
+	int req_n;
+	switch (ctx->vInfo.bits_per_pixel) {
+		case 4U:
+			req_n = 1 + !fbink_cfg->ignore_alpha;
+			break;
+		case 8U:
+			req_n = 1 + !fbink_cfg->ignore_alpha;
+			break;
+		case 16U:
+			req_n = 3 + !fbink_cfg->ignore_alpha;
+			break;
+		case 24U:
+			req_n = 3 + !fbink_cfg->ignore_alpha;
+			break;
+		case 32U:
+		default:
+			req_n = 3 + !fbink_cfg->ignore_alpha;
+			break;
+	}
+
+	// Devising the actual amount of components in the input should be as easy as that...
+	int n = (int) len / h / w;
+
+	LOG("Requested %d color channels, supplied data had %d", req_n, n);
+
+	// Local pointer we'll end up passing to draw_image, as we may need to process the input data...
+	const unsigned char* restrict img_data = NULL;
+
+	// Was scaling requested?
+	bool want_scaling = false;
+	if (fbink_cfg->scaled_width != 0 || fbink_cfg->scaled_height != 0) {
+		LOG("Image scaling requested!");
+		want_scaling = true;
+
+		// NOTE: QImageScale only accepts Y8, Y8A and RGBA input (i.e., RGBA, or RGB stored @ 32bpp, with 8 unused bits).
+		//       We, on the other hand, store RGB in 24bits, so, that won't do...
+		//       TL;DR: When outputting RGB, request RGBA from stbi instead to ensure a 32bpp buffer,
+		//              stbi will set the alpha bytes to 0xFF if the input doesn't have any alpha,
+		//              but that's not relevant, as we'll ask QImageScale to ignore alpha *processing* w/ ignore_alpha
+		// NOTE: That said, if input *has* an alpha channel, QImageScale expects premultiplied alpha,
+		//       while stbi leaves it untouched, meaning straight alpha in the vast majority of cases...
+		if (req_n == 3) {
+			LOG("Enforcing 32bpp buffer for scaling!");
+			req_n = 4;
+		}
+	}
+
+	// If there's a mismatch between the components in the input data vs. what the fb expects,
+	// re-interleave the data w/ stbi's help...
+	unsigned char* restrict converted_data = NULL;
+	if (req_n != n) {
+		LOG("Converting from %d components to the requested %d", n, req_n);
+		// NOTE: stbi__convert_format will *always* free the input buffer, which we do NOT want here...
+		//       Which is why we're using a tweaked internal copy, which does not free ;).
+		converted_data = img_convert_px_format(data, n, req_n, w, h);
+		if (converted_data == NULL) {
+			WARN("Failed to re-interleave input data in a suitable format");
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+		img_data = converted_data;
+	} else {
+		// We can use the input buffer as-is :)
+		LOG("No conversion needed, using the input buffer directly");
+		img_data = data;
+	}
+
+	// Scale it w/ QImageScale, if requested
+	if (want_scaling) {
+		unsigned short int scaled_width  = (unsigned short int) ctx->viewWidth;
+		unsigned short int scaled_height = (unsigned short int) ctx->viewHeight;
+		img_compute_scaled_size(w, h, fbink_cfg, &scaled_width, &scaled_height);
+
+		// We're drawing the data at the requested scaled resolution (draw_image scales it on the fly)
+		if (draw_image(ctx,
+			       fbfd,
+			       img_data,
+			       w,
+			       h,
+			       n,
+			       req_n,
+			       scaled_width,
+			       scaled_height,
+			       x_off,
+			       y_off,
+			       fbink_cfg,
+			       plan) != EXIT_SUCCESS) {
+			PFWARN("Failed to display image data on screen");
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	} else {
+		// We should now be able to draw that on screen, knowing that it probably won't horribly implode ;p
+		if (draw_image(ctx, fbfd, img_data, w, h, n, req_n, w, h, x_off, y_off, fbink_cfg, NULL) !=
+		    EXIT_SUCCESS) {
+			PFWARN("Failed to display image data on screen");
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// Cleanup
+cleanup:
+	// If we created an intermediary buffer ourselves, free it.
+	free(converted_data);
+
+	return rv;
+}
+#endif    // FBINK_WITH_IMAGE
+
+// Draw an image on screen
+int
+    fbink_print_image_ctx(FBInkContext* restrict ctx            UNUSED_BY_MINIMAL,
+			  int fbfd                              UNUSED_BY_MINIMAL,
+			  const char* filename                  UNUSED_BY_MINIMAL,
+			  short int x_off                       UNUSED_BY_MINIMAL,
+			  short int y_off                       UNUSED_BY_MINIMAL,
+			  const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	return print_image(ctx, fbfd, filename, x_off, y_off, fbink_cfg, NULL);
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
+int
+    fbink_print_image(int         fbfd,
+		      const char* filename,
+		      short int   x_off,
+		      short int   y_off,
+		      const FBInkConfig* restrict fbink_cfg)
+{
+	return fbink_print_image_ctx(&defaultCtx, fbfd, filename, x_off, y_off, fbink_cfg);
+}
+
+// Same, but w/ a precomputed scaling plan
+int
+    fbink_print_image_planned_ctx(FBInkContext* restrict ctx            UNUSED_BY_MINIMAL,
+				  int fbfd                              UNUSED_BY_MINIMAL,
+				  const char* filename                  UNUSED_BY_MINIMAL,
+				  short int x_off                       UNUSED_BY_MINIMAL,
+				  short int y_off                       UNUSED_BY_MINIMAL,
+				  const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL,
+				  const FBInkScalePlan* restrict plan   UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	return print_image(ctx, fbfd, filename, x_off, y_off, fbink_cfg, plan);
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
+int
+    fbink_print_image_planned(int         fbfd,
+			      const char* filename,
+			      short int   x_off,
+			      short int   y_off,
+			      const FBInkConfig* restrict fbink_cfg,
+			      const FBInkScalePlan* restrict plan)
+{
+	return fbink_print_image_planned_ctx(&defaultCtx, fbfd, filename, x_off, y_off, fbink_cfg, plan);
+}
+
+// Draw raw (supposedly image) data on screen
+int
+    fbink_print_raw_data_ctx(FBInkContext* restrict ctx            UNUSED_BY_MINIMAL,
+			     int fbfd                              UNUSED_BY_MINIMAL,
+			     const unsigned char* restrict data    UNUSED_BY_MINIMAL,
+			     const int w                           UNUSED_BY_MINIMAL,
+			     const int h                           UNUSED_BY_MINIMAL,
+			     const size_t len                      UNUSED_BY_MINIMAL,
+			     short int x_off                       UNUSED_BY_MINIMAL,
+			     short int y_off                       UNUSED_BY_MINIMAL,
+			     const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	return print_raw_data(ctx, fbfd, data, w, h, len, x_off, y_off, fbink_cfg, NULL);
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
+int
+    fbink_print_raw_data(int fbfd,
+			 const unsigned char* restrict data,
+			 const int    w,
+			 const int    h,
+			 const size_t len,
+			 short int    x_off,
+			 short int    y_off,
+			 const FBInkConfig* restrict fbink_cfg)
+{
+	return fbink_print_raw_data_ctx(&defaultCtx, fbfd, data, w, h, len, x_off, y_off, fbink_cfg);
+}
+
+// Same, but w/ a precomputed scaling plan
+int
+    fbink_print_raw_data_planned_ctx(FBInkContext* restrict ctx            UNUSED_BY_MINIMAL,
+				     int fbfd                              UNUSED_BY_MINIMAL,
+				     const unsigned char* restrict data    UNUSED_BY_MINIMAL,
+				     const int w                           UNUSED_BY_MINIMAL,
+				     const int h                           UNUSED_BY_MINIMAL,
+				     const size_t len                      UNUSED_BY_MINIMAL,
+				     short int x_off                       UNUSED_BY_MINIMAL,
+				     short int y_off                       UNUSED_BY_MINIMAL,
+				     const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL,
+				     const FBInkScalePlan* restrict plan   UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	return print_raw_data(ctx, fbfd, data, w, h, len, x_off, y_off, fbink_cfg, plan);
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
+int
+    fbink_print_raw_data_planned(int fbfd,
+				 const unsigned char* restrict data,
+				 const int    w,
+				 const int    h,
+				 const size_t len,
+				 short int    x_off,
+				 short int    y_off,
+				 const FBInkConfig* restrict fbink_cfg,
+				 const FBInkScalePlan* restrict plan)
+{
+	return fbink_print_raw_data_planned_ctx(&defaultCtx, fbfd, data, w, h, len, x_off, y_off, fbink_cfg, plan);
+}
+
+// Draw packed low bitdepth raw data (e.g., a 1bpp mask) on screen
+int
+    fbink_print_packed_data_ctx(FBInkContext* restrict ctx            UNUSED_BY_MINIMAL,
+				int fbfd                              UNUSED_BY_MINIMAL,
+				const unsigned char* restrict data    UNUSED_BY_MINIMAL,
+				const int w                           UNUSED_BY_MINIMAL,
+				const int h                           UNUSED_BY_MINIMAL,
+				const size_t stride                   UNUSED_BY_MINIMAL,
+				const uint8_t bpp                     UNUSED_BY_MINIMAL,
+				short int x_off                       UNUSED_BY_MINIMAL,
+				short int y_off                       UNUSED_BY_MINIMAL,
+				const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	if (bpp != 1U && bpp != 2U && bpp != 4U) {
+		WARN("Unsupported packed bitdepth: %hhu", bpp);
+		return ERRCODE(EINVAL);
+	}
+	if (w <= 0 || h <= 0) {
+		WARN("Invalid packed data dimensions: %dx%d", w, h);
+		return ERRCODE(EINVAL);
+	}
+
+	// A stride of 0 means tightly packed scanlines
+	const size_t min_stride = (((size_t) w * bpp) + 7U) >> 3U;
+	const size_t pitch      = stride ? stride : min_stride;
+	if (pitch < min_stride) {
+		WARN("Stride (%zu) is too small for a %d pixels wide scanline at %hhubpp", pitch, w, bpp);
+		return ERRCODE(EINVAL);
+	}
+
+	if (fbink_cfg->scaled_width != 0 || fbink_cfg->scaled_height != 0) {
+		LOG("Ignoring scaling request for packed data");
+	}
+
+	if (draw_packed_data(ctx, fbfd, data, w, h, pitch, bpp, x_off, y_off, fbink_cfg) != EXIT_SUCCESS) {
+		PFWARN("Failed to display packed data on screen");
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	return EXIT_SUCCESS;
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
+int
+    fbink_print_packed_data(int fbfd,
+			    const unsigned char* restrict data,
+			    const int     w,
+			    const int     h,
+			    const size_t  stride,
+			    const uint8_t bpp,
+			    short int     x_off,
+			    short int     y_off,
+			    const FBInkConfig* restrict fbink_cfg)
+{
+	return fbink_print_packed_data_ctx(&defaultCtx, fbfd, data, w, h, stride, bpp, x_off, y_off, fbink_cfg);
+}
+
+// Draw raw data that's already in the fb's pixel format on screen, as-is
+int
+    fbink_print_native_data_ctx(FBInkContext* restrict ctx            UNUSED_BY_MINIMAL,
+				int fbfd                              UNUSED_BY_MINIMAL,
+				const unsigned char* restrict data    UNUSED_BY_MINIMAL,
+				const int w                           UNUSED_BY_MINIMAL,
+				const int h                           UNUSED_BY_MINIMAL,
+				const size_t stride                   UNUSED_BY_MINIMAL,
+				FBINK_PXFMT_INDEX_T pixel_format      UNUSED_BY_MINIMAL,
+				short int x_off                       UNUSED_BY_MINIMAL,
+				short int y_off                       UNUSED_BY_MINIMAL,
+				const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	// NOTE: We don't convert anything, that's the whole point ;).
+	if (pixel_format != ctx->deviceQuirks.pixelFormat) {
+		WARN("Input pixel format (%hhu) doesn't match the framebuffer's (%hhu)",
+		     pixel_format,
+		     ctx->deviceQuirks.pixelFormat);
+		return ERRCODE(EINVAL);
+	}
+	if (w <= 0 || h <= 0) {
+		WARN("Invalid native data dimensions: %dx%d", w, h);
+		return ERRCODE(EINVAL);
+	}
+
+	// A stride of 0 means tightly packed scanlines
+	const size_t min_stride = (((size_t) w * ctx->vInfo.bits_per_pixel) + 7U) >> 3U;
+	const size_t pitch      = stride ? stride : min_stride;
+	if (pitch < min_stride) {
+		WARN("Stride (%zu) is too small for a %d pixels wide scanline at %ubpp",
+		     pitch,
+		     w,
+		     ctx->vInfo.bits_per_pixel);
+		return ERRCODE(EINVAL);
+	}
+
+	if (draw_native_data(ctx, fbfd, data, w, h, pitch, x_off, y_off, fbink_cfg) != EXIT_SUCCESS) {
+		PFWARN("Failed to display native data on screen");
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	return EXIT_SUCCESS;
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
+int
+    fbink_print_native_data(int fbfd,
+			    const unsigned char* restrict data,
+			    const int           w,
+			    const int           h,
+			    const size_t        stride,
+			    FBINK_PXFMT_INDEX_T pixel_format,
+			    short int           x_off,
+			    short int           y_off,
+			    const FBInkConfig* restrict fbink_cfg)
+{
+	return fbink_print_native_data_ctx(&defaultCtx, fbfd, data, w, h, stride, pixel_format, x_off, y_off, fbink_cfg);
+}
+
+// Draw a batch of images on screen, in one go
+int
+    fbink_print_thumbnails_ctx(FBInkContext* restrict ctx            UNUSED_BY_MINIMAL,
+			       int fbfd                              UNUSED_BY_MINIMAL,
+			       FBInkThumbnail* restrict thumbs       UNUSED_BY_MINIMAL,
+			       size_t count                          UNUSED_BY_MINIMAL,
+			       const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	if (count == 0U) {
+		WARN("No thumbnails to print");
+		return ERRCODE(EINVAL);
+	}
+
+	// Open the framebuffer if need be...
+	// NOTE: As usual, we *expect* to be initialized at this point!
+	bool keep_fd = true;
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// mmap the fb if need be...
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// Same logic as in fbink_print_image, knowing that we're always scaling (hence no 24bpp RGB).
+	int req_n = (ctx->vInfo.bits_per_pixel <= 8U ? 1 : 3) + !fbink_cfg->ignore_alpha;
+	if (req_n == 3) {
+		req_n = 4;
+	}
+
+	// Decode & scale everything first, split across a few threads if requested, like in draw_image
+	const size_t threads = get_image_threads(fbink_cfg, count);
+	if (threads > 1U) {
+		LOG("Loading %zu thumbnails across %zu threads", count, threads);
+	}
+
+	FBInkThumbnailJobs jobs[IMAGE_MAX_THREADS];
+	for (size_t t = 0U; t < threads; t++) {
+		jobs[t] = (FBInkThumbnailJobs) {
+			.thumbs = thumbs, .count = count, .fbink_cfg = fbink_cfg, .req_n = req_n, .first = t, .stride = threads
+		};
+	}
+	run_image_workers(&load_thumbnails, jobs, sizeof(*jobs), threads);
+
+	// Clear screen?
+	if (fbink_cfg->is_cleared) {
+		FBInkPixel bgP = ctx->penBGPixel;
+		if (fbink_cfg->is_inverted) {
+			bgP.p ^= 0x00FFFFFFu;
+		}
+		clear_screen(ctx, fbfd, &bgP, fbink_cfg->is_flashing);
+	}
+
+	// Then blit everything in order, and keep track of the union of what we've drawn.
+	// NOTE: Positioning is entirely up to each thumbnail's rect.
+	FBInkConfig blit_cfg = *fbink_cfg;
+	blit_cfg.row         = 0;
+	blit_cfg.col         = 0;
+	blit_cfg.halign      = NONE;
+	blit_cfg.valign      = NONE;
+
+	// The color preprocessing stage is shared by every thumbnail
+	FBInkColorPrep        color_prep;
+	const FBInkColorPrep* prep = prepare_color_prep(&blit_cfg, &color_prep) ? &color_prep : NULL;
+
+	struct mxcfb_rect region = { 0U };
+	for (size_t i = 0U; i < count; i++) {
+		FBInkThumbnail* thumb = &thumbs[i];
+		if (!thumb->data) {
+			if (thumb->rect.width != 0U && thumb->rect.height != 0U) {
+				rv = ERRCODE(EXIT_FAILURE);
+			}
+			continue;
+		}
+
+		FBInkImageClip clip;
+		clip_image(ctx,
+			   thumb->width,
+			   thumb->height,
+			   (short int) (thumb->rect.left + ((thumb->rect.width - thumb->width) / 2)),
+			   (short int) (thumb->rect.top + ((thumb->rect.height - thumb->height) / 2)),
+			   &blit_cfg,
+			   &clip);
+		blit_image_rows(ctx,
+				thumb->data,
+				0U,
+				thumb->width,
+				thumb->n,
+				thumb->has_alpha,
+				&clip,
+				clip.img_y_off,
+				clip.max_height,
+				&blit_cfg,
+				prep);
+
+		if (clip.region.width != 0U && clip.region.height != 0U) {
+			if (region.width == 0U || region.height == 0U) {
+				region = clip.region;
+			} else {
+				const uint32_t x1 = MIN(region.left, clip.region.left);
+				const uint32_t y1 = MIN(region.top, clip.region.top);
+				const uint32_t x2 = MAX(region.left + region.width, clip.region.left + clip.region.width);
+				const uint32_t y2 = MAX(region.top + region.height, clip.region.top + clip.region.height);
+				region.left       = x1;
+				region.top        = y1;
+				region.width      = x2 - x1;
+				region.height     = y2 - y1;
+			}
+		}
+
+		if (!thumb->cache) {
+			fbink_free_thumbnail_data(thumb);
+		}
+	}
+
+	// Handle the last rect stuff...
+	set_last_rect(ctx, &region);
+
+	// Rotate the region if need be...
+	(*ctx->fxpRotateRegion)(ctx, &region);
+
+	// Fudge the region if we asked for a screen clear, so that we actually refresh the full screen...
+	if (fbink_cfg->is_cleared) {
+		fullscreen_region(ctx, &region);
+	}
+
+	// Refresh screen
+	if (region.width != 0U && region.height != 0U) {
+		if (refresh(ctx, fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
+			PFWARN("Failed to refresh the screen");
+		}
+	}
+
+	// Cleanup
+cleanup:
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
+	}
+	if (!keep_fd) {
+		close_fb(ctx, fbfd);
+	}
+
+	return rv;
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
+int
+    fbink_print_thumbnails(int fbfd, FBInkThumbnail* restrict thumbs, size_t count, const FBInkConfig* restrict fbink_cfg)
+{
+	return fbink_print_thumbnails_ctx(&defaultCtx, fbfd, thumbs, count, fbink_cfg);
+}
+
+// Explicitly frees the scaled pixels cached in an FBInkThumbnail by fbink_print_thumbnails
+int
+    fbink_free_thumbnail_data(FBInkThumbnail* restrict thumb UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	if (thumb->data) {
+		free(thumb->data);
+		// Only clear what we set ourselves
+		thumb->data       = NULL;
+		thumb->width      = 0U;
+		thumb->height     = 0U;
+		thumb->n          = 0U;
+		thumb->has_alpha  = false;
+		thumb->box_width  = 0U;
+		thumb->box_height = 0U;
+
+		return EXIT_SUCCESS;
+	} else {
+		return ERRCODE(EINVAL);
+	}
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
+// Precompute the scaling of w x h images, for use with fbink_print_image_planned & fbink_print_raw_data_planned
+int
+    fbink_scale_plan_alloc_ctx(FBInkContext* restrict ctx            UNUSED_BY_MINIMAL,
+			       int w                                 UNUSED_BY_MINIMAL,
+			       int h                                 UNUSED_BY_MINIMAL,
+			       const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL,
+			       FBInkScalePlan* restrict plan         UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	if (w <= 0 || h <= 0) {
+		WARN("Invalid image dimensions: %dx%d", w, h);
+		return ERRCODE(EINVAL);
+	}
+	if (fbink_cfg->scaled_width == 0 && fbink_cfg->scaled_height == 0) {
+		WARN("No scaling requested");
+		return ERRCODE(EINVAL);
+	}
+
+	// Recycle it if need be
+	if (plan->scale_info) {
+		fbink_scale_plan_free(plan);
+	}
+
+	// Same logic as in fbink_print_image, knowing that we're always scaling (hence no 24bpp RGB).
+	int req_n = (ctx->vInfo.bits_per_pixel <= 8U ? 1 : 3) + !fbink_cfg->ignore_alpha;
+	if (req_n == 3) {
+		req_n = 4;
+	}
+
+	// Same as draw_image will end up computing for those dimensions, too.
+	unsigned short int scaled_width  = (unsigned short int) ctx->viewWidth;
+	unsigned short int scaled_height = (unsigned short int) ctx->viewHeight;
+	img_compute_scaled_size(w, h, fbink_cfg, &scaled_width, &scaled_height);
+
+	plan->scale_info = qSmoothScaleInfoCreate(w, h, req_n, scaled_width, scaled_height);
+	if (!plan->scale_info) {
+		PFWARN("Failed to compute the scaling plan");
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Allocate the band buffer(s) draw_image will scale into, too, so that planned draws don't have to.
+	// NOTE: Size it for the whole image, i.e., as many workers as a fully visible one would use.
+	const unsigned short int band_rows = get_image_band_rows(scaled_width, scaled_height, req_n);
+	const size_t             bands     = ((size_t) scaled_height + band_rows - 1U) / band_rows;
+	const size_t             band_size =
+	    get_image_threads(fbink_cfg, bands) * band_rows * (size_t) (scaled_width * req_n);
+	// SSE/NEON friendly alignment, like qSmoothScaleImage
+	if (posix_memalign(&plan->band, 16, band_size) != 0) {
+		PFWARN("Error allocating scaling buffer");
+		qSmoothScaleInfoFree(plan->scale_info);
+		plan->scale_info = NULL;
+		plan->band       = NULL;
+		return ERRCODE(EXIT_FAILURE);
+	}
+	plan->band_size     = band_size;
+	plan->w             = w;
+	plan->h             = h;
+	plan->scaled_width  = scaled_width;
+	plan->scaled_height = scaled_height;
+	plan->n             = (uint8_t) req_n;
+
+	return EXIT_SUCCESS;
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
+int
+    fbink_scale_plan_alloc(int w, int h, const FBInkConfig* restrict fbink_cfg, FBInkScalePlan* restrict plan)
+{
+	return fbink_scale_plan_alloc_ctx(&defaultCtx, w, h, fbink_cfg, plan);
+}
+
+// Release the data of a scaling plan set by fbink_scale_plan_alloc
+int
+    fbink_scale_plan_free(FBInkScalePlan* restrict plan UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	if (plan->scale_info) {
+		qSmoothScaleInfoFree(plan->scale_info);
+		free(plan->band);
+		// Only clear what we set ourselves
+		plan->scale_info    = NULL;
+		plan->band          = NULL;
+		plan->band_size     = 0U;
+		plan->w             = 0;
+		plan->h             = 0;
+		plan->scaled_width  = 0U;
+		plan->scaled_height = 0U;
+		plan->n             = 0U;
+
+		return EXIT_SUCCESS;
+	} else {
+		return ERRCODE(EINVAL);
+	}
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
+// Dump the full fb (first visible screen)
+int
+    fbink_dump_ctx(FBInkContext* restrict ctx UNUSED_BY_MINIMAL,
+		   int fbfd                   UNUSED_BY_MINIMAL,
+		   FBInkDump* restrict dump   UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	// Open the framebuffer if need be...
+	// NOTE: As usual, we *expect* to be initialized at this point!
+	bool keep_fd = true;
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// mmap the fb if need be...
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// Dump the *full* fb
+	// Free current data in case the dump struct is being reused
+	if (dump->data) {
+		LOG("Recycling FBinkDump!");
+		free(dump->data);
+		dump->data = NULL;
+		// Reset the crop settings
+		dump->clip = (const FBInkRect) { 0U };
+	}
+	// Start by allocating enough memory for a full dump of the visible screen...
+	dump->stride = ctx->fInfo.line_length;
+	dump->size   = (size_t) (dump->stride * ctx->vInfo.yres);
+	dump->data   = calloc(dump->size, sizeof(*dump->data));
+	if (dump->data == NULL) {
+		PFWARN("dump->data %zu bytes calloc: %m", dump->size);
+		dump->stride = 0U;
+		dump->size   = 0U;
+		rv           = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+	// Store the current fb state for that dump
+	dump->area.left     = 0U;
+	dump->area.top      = 0U;
+	dump->area.width    = (unsigned short int) ctx->vInfo.xres_virtual;
+	dump->area.height   = (unsigned short int) ctx->vInfo.yres;
+	dump->rota          = (uint8_t) ctx->vInfo.rotate;
+	dump->bpp           = (uint8_t) ctx->vInfo.bits_per_pixel;
+	dump->is_full       = true;
+	dump->is_compressed = false;
+	dump->pixel_format  = ctx->deviceQuirks.pixelFormat;
+	// And finally, the fb data itself
+	memcpy(dump->data, ctx->fbPtr, dump->size);
+
+	// Cleanup
+cleanup:
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
+	}
+	if (!keep_fd) {
+		close_fb(ctx, fbfd);
+	}
+
+	return rv;
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
+int
+    fbink_dump(int fbfd, FBInkDump* restrict dump)
+{
+	return fbink_dump_ctx(&defaultCtx, fbfd, dump);
+}
+
+#ifdef FBINK_WITH_IMAGE
+// Helper for fbink_region_dump & fbink_rect_dump
+static int
+    dump_region(FBInkContext* restrict ctx, struct mxcfb_rect* region, FBInkDump* restrict dump)
+{
+	// Bail if we were fed an empty region
+	if (region->width == 0U || region->height == 0U) {
+		WARN("Tried to dump an empty region");
+		return ERRCODE(EINVAL);
+	}
+
+	// Free current data in case the dump struct is being reused
+	if (dump->data) {
+		LOG("Recycling FBinkDump!");
+		free(dump->data);
+		memset(dump, 0, sizeof(*dump));
+	}
+	// Start by allocating enough memory for a full dump of the computed region...
+	// We're going to need the amount of bytes taken per pixel...
+	const uint8_t bpp = (uint8_t) (ctx->vInfo.bits_per_pixel >> 3U);
+	// And then to handle 4bpp on its own, because 4/8 == 0 ;).
+	if (ctx->vInfo.bits_per_pixel == 4U) {
+		// Align to the nearest byte boundary to make our life easier...
+		if (region->left & 0x01u) {
+			// x is odd, round *down* to the nearest multiple of two (i.e., align to the start of the current byte)
+			region->left &= ~0x01u;
+			LOG("Updated region.left to %u because of alignment constraints", region->left);
+		}
+		if (region->width & 0x01u) {
+			// w is odd, round *up* to the nearest multiple of two (i.e., align to the end of the current byte)
+			region->width = (region->width + 1U) & ~0x01u;
+			LOG("Updated region.width to %u because of alignment constraints", region->width);
+		}
+		// Two pixels per byte, and we've just ensured to never end up with a decimal when dividing by two ;).
+		dump->stride = (size_t) (region->width >> 1U);
+		dump->size   = (size_t) (dump->stride * region->height);
+		dump->data   = calloc(dump->size, sizeof(*dump->data));
+	} else {
+		dump->stride = (size_t) (region->width * bpp);
+		dump->size   = (size_t) (dump->stride * region->height);
+		dump->data   = calloc(dump->size, sizeof(*dump->data));
+	}
+	if (dump->data == NULL) {
+		PFWARN("dump->data %zu bytes calloc: %m", dump->size);
+		dump->stride = 0U;
+		dump->size   = 0U;
+		return ERRCODE(EXIT_FAILURE);
+	}
+	// Store the current fb state for that dump
+	dump->area.left     = (unsigned short int) region->left;
+	dump->area.top      = (unsigned short int) region->top;
+	dump->area.width    = (unsigned short int) region->width;
+	dump->area.height   = (unsigned short int) region->height;
+	dump->rota          = (uint8_t) ctx->vInfo.rotate;
+	dump->bpp           = (uint8_t) ctx->vInfo.bits_per_pixel;
+	dump->is_full       = false;
+	dump->is_compressed = false;
+	dump->pixel_format  = ctx->deviceQuirks.pixelFormat;
+	// And finally, the fb data itself, scanline per scanline
+	if (dump->bpp == 4U) {
+		for (unsigned short int j = dump->area.top, l = 0U; l < dump->area.height; j++, l++) {
+			size_t dump_offset = (size_t) (l * dump->stride);
+			size_t fb_offset   = (size_t) (dump->area.left >> 1U) + (j * ctx->fInfo.line_length);
+			memcpy(dump->data + dump_offset, ctx->fbPtr + fb_offset, dump->stride);
+		}
+	} else {
+		for (unsigned short int j = dump->area.top, l = 0U; l < dump->area.height; j++, l++) {
+			size_t dump_offset = (size_t) (l * dump->stride);
+			size_t fb_offset   = (size_t) (dump->area.left * bpp) + (j * ctx->fInfo.line_length);
+			memcpy(dump->data + dump_offset, ctx->fbPtr + fb_offset, dump->stride);
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
+
+// Helpers for fbink_compress_dump & fbink_restore
+// NOTE: The format is a PackBits-like RLE, except that it works on *pixels* (or bytes at 4bpp) instead of bytes,
+//       so that flat areas of color also compress nicely at 16 & 32bpp.
+//       Each packet starts with a header byte:
+//       0 <= h < 128:   h + 1 literal pixels follow.
+//       128 <= h < 256: a single pixel follows, to be repeated h - 126 times (i.e., 2 to 129 times).
+//       A compressed dump starts with a table of uint32_t offsets (one per scanline, relative to the start of data),
+//       so that we can seek to a specific scanline when clipping.
+#	define RLE_MAX_LITERAL 128U
+#	define RLE_MAX_REPEAT  129U
+
+// Compress a single scanline of len pixels (each unit bytes wide) from src into dst, returns the amount of bytes written.
+// NOTE: dst needs to be able to hold len * unit + ((len + RLE_MAX_LITERAL - 1) / RLE_MAX_LITERAL) bytes in the worst case.
+static size_t
+    rle_pack_row(const unsigned char* restrict src, size_t len, uint8_t unit, unsigned char* restrict dst)
+{
+	// NOTE: A run of two single-byte pixels isn't worth breaking a literal packet for,
+	//       that's what keeps us within the worst-case bound.
+	const size_t min_run        = unit == 1U ? 3U : 2U;
+	unsigned char* restrict out = dst;
+	size_t i                    = 0U;
+	while (i < len) {
+		// Look for a run of identical pixels...
+		const unsigned char* restrict px = src + (i * unit);
+		size_t run                       = 1U;
+		while (i + run < len && run < RLE_MAX_REPEAT && memcmp(px, px + (run * unit), unit) == 0) {
+			run++;
+		}
+
+		if (run >= min_run) {
+			*out++ = (unsigned char) (run + 126U);
+			memcpy(out, px, unit);
+			out += unit;
+			i   += run;
+		} else {
+			// Otherwise, gobble up literals until the next run (or the packet's limit)...
+			size_t lit = 1U;
+			while (i + lit < len && lit < RLE_MAX_LITERAL) {
+				const unsigned char* restrict next = src + ((i + lit) * unit);
+				if (i + lit + min_run <= len && memcmp(next, next + unit, (min_run - 1U) * unit) == 0) {
+					break;
+				}
+				lit++;
+			}
+			*out++ = (unsigned char) (lit - 1U);
+			memcpy(out, px, lit * unit);
+			out += lit * unit;
+			i   += lit;
+		}
+	}
+
+	return (size_t) (out - dst);
+}
+
+// Decompress a single scanline from src into dst,
+// skipping the first skip pixels, and only writing len pixels (each unit bytes wide).
+static void
+    rle_unpack_row(const unsigned char* restrict src, size_t skip, size_t len, uint8_t unit, unsigned char* restrict dst)
+{
+	const size_t end = skip + len;
+	size_t       pos = 0U;
+	while (pos < end) {
+		const unsigned char h = *src++;
+		if (h < RLE_MAX_LITERAL) {
+			const size_t n = (size_t) h + 1U;
+			if (pos + n > skip) {
+				// Clamp to the requested window
+				const size_t from = pos < skip ? skip - pos : 0U;
+				const size_t to   = MIN(n, end - pos);
+				memcpy(dst, src + (from * unit), (to - from) * unit);
+				dst += (to - from) * unit;
+			}
+			src += n * unit;
+			pos += n;
+		} else {
+			const size_t n = (size_t) h - 126U;
+			if (pos + n > skip) {
+				const size_t from = pos < skip ? skip - pos : 0U;
+				const size_t to   = MIN(n, end - pos);
+				if (unit == 1U) {
+					memset(dst, *src, to - from);
+					dst += to - from;
+				} else {
+					for (size_t k = from; k < to; k++) {
+						memcpy(dst, src, unit);
+						dst += unit;
+					}
+				}
+			}
+			src += unit;
+			pos += n;
+		}
+	}
+}
+
+// Decompress the (x_skip, y_skip) w x h window of a compressed dump straight into the fb @ (x, y)
+static void
+    restore_compressed_rows(FBInkContext* restrict ctx,
+			    const FBInkDump* restrict dump,
+			    unsigned short int        x,
+			    unsigned short int        y,
+			    unsigned short int        x_skip,
+			    unsigned short int        y_skip,
+			    unsigned short int        w,
+			    unsigned short int        h)
+{
+	// NOTE: At 4bpp, we work in bytes, and both area.left & area.width are byte-aligned (c.f., dump_region).
+	uint8_t unit;
+	size_t  x_offset;
+	size_t  skip;
+	size_t  len;
+	if (dump->bpp == 4U) {
+		unit     = 1U;
+		x_offset = (size_t) (x >> 1U);
+		skip     = (size_t) (x_skip >> 1U);
+		len      = (size_t) (w >> 1U);
+	} else {
+		unit     = (uint8_t) (dump->bpp >> 3U);
+		x_offset = (size_t) (x * unit);
+		skip     = x_skip;
+		len      = w;
+	}
+
+	// The offsets table lives at the start of the data (which, being malloc'ed, is suitably aligned)
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wcast-align"
+	const uint32_t* restrict row_offsets = (const uint32_t*) dump->data;
+#	pragma GCC diagnostic pop
+	for (unsigned short int j = y, l = 0U; l < h; j++, l++) {
+		size_t fb_offset = x_offset + (j * ctx->fInfo.line_length);
+		rle_unpack_row(dump->data + row_offsets[y_skip + l], skip, len, unit, ctx->fbPtr + fb_offset);
+	}
+}
+
+// Helpers for fbink_restore, when the dump needs to be converted to the current bitdepth/rotation
+// NOTE: We work in square tiles when rotating, so that neither the reads nor the writes thrash the cache too badly.
+#	define RESTORE_TILE_SIZE 32U
+
+// Rotate a region by the given amount of quarter turns (counter-clockwise),
+// width & height being the dimensions of the screen the region is *currently* relative to.
+static void
+    rotate_region_by(struct mxcfb_rect* restrict region, uint8_t quarter_turns, uint32_t width, uint32_t height)
+{
+	struct mxcfb_rect oregion = *region;
+	// NOTE: left = x, top = y
+	switch (quarter_turns & 3U) {
+		case 1U:
+			region->left   = oregion.top;
+			region->top    = width - oregion.left - oregion.width;
+			region->width  = oregion.height;
+			region->height = oregion.width;
+			break;
+		case 2U:
+			region->left = width - oregion.left - oregion.width;
+			region->top  = height - oregion.top - oregion.height;
+			break;
+		case 3U:
+			region->left   = height - oregion.top - oregion.height;
+			region->top    = oregion.left;
+			region->width  = oregion.height;
+			region->height = oregion.width;
+			break;
+		default:
+			break;
+	}
+}
+
+// Best guess at the pixel format of a dump that didn't record it
+static __attribute__((const)) FBINK_PXFMT_INDEX_T
+    pxfmt_from_bpp(uint8_t bpp)
+{
+	switch (bpp) {
+		case 4U:
+			return FBINK_PXFMT_Y4;
+		case 8U:
+			return FBINK_PXFMT_Y8;
+		case 16U:
+			return FBINK_PXFMT_BGR565;
+		case 24U:
+			return FBINK_PXFMT_BGR24;
+		case 32U:
+			return FBINK_PXFMT_BGRA;
+		default:
+			return FBINK_PXFMT_UNKNOWN;
+	}
+}
+
+// Unpack a scanline of len pixels in the fmt pixel format to RGBA
+static void
+    unpack_px_row(const unsigned char* restrict src, FBINK_PXFMT_INDEX_T fmt, FBInkPixelRGBA* restrict dst, size_t len)
+{
+	switch (fmt) {
+		case FBINK_PXFMT_Y8:
+			for (size_t i = 0U; i < len; i++) {
+				dst[i].color.r = src[i];
+				dst[i].color.g = src[i];
+				dst[i].color.b = src[i];
+				dst[i].color.a = 0xFFu;
+			}
+			break;
+		case FBINK_PXFMT_BGR565:
+		case FBINK_PXFMT_RGB565:
+			for (size_t i = 0U; i < len; i++) {
+				// NOTE: Same logic as get_pixel_BGR565 & get_pixel_RGB565
+				const uint16_t v  = (uint16_t) (src[i << 1U] | (src[(i << 1U) + 1U] << 8U));
+				const uint8_t  hi = (uint8_t) ((v & 0xF800u) >> 11U);
+				const uint8_t  g  = (v & 0x07E0u) >> 5U;
+				const uint8_t  lo = (v & 0x001Fu);
+				if (fmt == FBINK_PXFMT_BGR565) {
+					dst[i].color.r = (uint8_t) ((hi << 3U) | (hi >> 2U));
+					dst[i].color.b = (uint8_t) ((lo << 3U) | (lo >> 2U));
+				} else {
+					dst[i].color.r = (uint8_t) ((lo << 3U) | (lo >> 2U));
+					dst[i].color.b = (uint8_t) ((hi << 3U) | (hi >> 2U));
+				}
+				dst[i].color.g = (uint8_t) ((g << 2U) | (g >> 4U));
+				dst[i].color.a = 0xFFu;
+			}
+			break;
+		case FBINK_PXFMT_BGR24:
+			for (size_t i = 0U; i < len; i++) {
+				dst[i].color.b = src[(i * 3U) + 0U];
+				dst[i].color.g = src[(i * 3U) + 1U];
+				dst[i].color.r = src[(i * 3U) + 2U];
+				dst[i].color.a = 0xFFu;
+			}
+			break;
+		case FBINK_PXFMT_RGB24:
+			for (size_t i = 0U; i < len; i++) {
+				dst[i].color.r = src[(i * 3U) + 0U];
+				dst[i].color.g = src[(i * 3U) + 1U];
+				dst[i].color.b = src[(i * 3U) + 2U];
+				dst[i].color.a = 0xFFu;
+			}
+			break;
+		case FBINK_PXFMT_RGBA:
+		case FBINK_PXFMT_RGB32:
+			memcpy(dst, src, len * sizeof(*dst));
+			break;
+		case FBINK_PXFMT_BGRA:
+		case FBINK_PXFMT_BGR32:
+		default:
+			for (size_t i = 0U; i < len; i++) {
+				dst[i].color.b = src[(i << 2U) + 0U];
+				dst[i].color.g = src[(i << 2U) + 1U];
+				dst[i].color.r = src[(i << 2U) + 2U];
+				dst[i].color.a = src[(i << 2U) + 3U];
+			}
+			break;
+	}
+}
+
+// Pack a scanline of len RGBA pixels to the fmt pixel format
+static void
+    pack_px_row(const FBInkPixelRGBA* restrict src, FBINK_PXFMT_INDEX_T fmt, unsigned char* restrict dst, size_t len)
+{
+	switch (fmt) {
+		case FBINK_PXFMT_Y8:
+			for (size_t i = 0U; i < len; i++) {
+				// NOTE: Like pack_pixel_from_rgba, this is stbi__compute_y
+				dst[i] = (uint8_t) (((src[i].color.r * 77U) + (src[i].color.g * 150U) + (29U * src[i].color.b)) >> 8U);
+			}
+			break;
+		case FBINK_PXFMT_BGR565:
+		case FBINK_PXFMT_RGB565:
+			for (size_t i = 0U; i < len; i++) {
+				const uint16_t v = fmt == FBINK_PXFMT_BGR565
+						       ? pack_bgr565(src[i].color.r, src[i].color.g, src[i].color.b)
+						       : pack_rgb565(src[i].color.r, src[i].color.g, src[i].color.b);
+				dst[i << 1U]          = (uint8_t) (v & 0xFFu);
+				dst[(i << 1U) + 1U]   = (uint8_t) (v >> 8U);
+			}
+			break;
+		case FBINK_PXFMT_BGR24:
+			for (size_t i = 0U; i < len; i++) {
+				dst[(i * 3U) + 0U] = src[i].color.b;
+				dst[(i * 3U) + 1U] = src[i].color.g;
+				dst[(i * 3U) + 2U] = src[i].color.r;
+			}
+			break;
+		case FBINK_PXFMT_RGB24:
+			for (size_t i = 0U; i < len; i++) {
+				dst[(i * 3U) + 0U] = src[i].color.r;
+				dst[(i * 3U) + 1U] = src[i].color.g;
+				dst[(i * 3U) + 2U] = src[i].color.b;
+			}
+			break;
+		case FBINK_PXFMT_RGBA:
+		case FBINK_PXFMT_RGB32:
+			memcpy(dst, src, len * sizeof(*src));
+			break;
+		case FBINK_PXFMT_BGRA:
+		case FBINK_PXFMT_BGR32:
+		default:
+			for (size_t i = 0U; i < len; i++) {
+				dst[(i << 2U) + 0U] = src[i].color.b;
+				dst[(i << 2U) + 1U] = src[i].color.g;
+				dst[(i << 2U) + 2U] = src[i].color.r;
+				dst[(i << 2U) + 3U] = src[i].color.a;
+			}
+			break;
+	}
+}
+
+// Copy a single pixel of bpp bytes (keeps memcpy inlined by giving it a constant size)
+static inline __attribute__((always_inline, hot)) void
+    copy_px(unsigned char* restrict dst, const unsigned char* restrict src, uint8_t bpp)
+{
+	switch (bpp) {
+		case 1U:
+			*dst = *src;
+			break;
+		case 2U:
+			memcpy(dst, src, 2U);
+			break;
+		case 3U:
+			memcpy(dst, src, 3U);
+			break;
+		case 4U:
+		default:
+			memcpy(dst, src, 4U);
+			break;
+	}
+}
+
+// Convert the src_region part (in the dump's screen coordinates) of a dump to the current pixel format,
+// and write it to the fb, rotated by quarter_turns (c.f., rotate_region_by).
+// NOTE: dump_xres & dump_yres are the dimensions of the screen at dump time.
+//       Processes the dump in bands of RESTORE_TILE_SIZE scanlines, which avoids needing a full temporary buffer,
+//       and is compatible with compressed dumps, since we only ever need sequential access to its scanlines.
+static int
+    restore_converted_region(FBInkContext* restrict ctx,
+			     const FBInkDump* restrict         dump,
+			     FBINK_PXFMT_INDEX_T               dump_fmt,
+			     uint8_t                           quarter_turns,
+			     uint32_t                          dump_xres,
+			     uint32_t                          dump_yres,
+			     const struct mxcfb_rect* restrict src_region)
+{
+	const uint8_t src_bpp = (uint8_t) (dump->bpp >> 3U);
+	const uint8_t dst_bpp = (uint8_t) (ctx->vInfo.bits_per_pixel >> 3U);
+	const size_t  span    = src_region->width;
+	// Offsets of the requested region inside the dump
+	const size_t  x_skip  = (size_t) (src_region->left - dump->area.left);
+	const size_t  y_skip  = (size_t) (src_region->top - dump->area.top);
+
+	int rv                          = EXIT_SUCCESS;
+	unsigned char* restrict band    = NULL;
+	FBInkPixelRGBA* restrict rgba   = NULL;
+	unsigned char* restrict scratch = NULL;
+	band                            = malloc(RESTORE_TILE_SIZE * span * dst_bpp);
+	if (band == NULL) {
+		PFWARN("band malloc: %m");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+	rgba = malloc(span * sizeof(*rgba));
+	if (rgba == NULL) {
+		PFWARN("rgba malloc: %m");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+	if (dump->is_compressed) {
+		scratch = malloc(span * src_bpp);
+		if (scratch == NULL) {
+			PFWARN("scratch malloc: %m");
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wcast-align"
+	const uint32_t* restrict row_offsets = (const uint32_t*) dump->data;
+#	pragma GCC diagnostic pop
+
+	// Where does a step to the right in the dump land us in the fb (in bytes)?
+	const size_t line_length = ctx->fInfo.line_length;
+	ptrdiff_t    x_step;
+	switch (quarter_turns) {
+		case 1U:
+			x_step = -(ptrdiff_t) line_length;
+			break;
+		case 2U:
+			x_step = -(ptrdiff_t) dst_bpp;
+			break;
+		case 3U:
+			x_step = (ptrdiff_t) line_length;
+			break;
+		default:
+			x_step = (ptrdiff_t) dst_bpp;
+			break;
+	}
+
+	for (uint32_t by = 0U; by < src_region->height; by += RESTORE_TILE_SIZE) {
+		const uint32_t bh = MIN(RESTORE_TILE_SIZE, src_region->height - by);
+
+		// Convert a band of scanlines to the target pixel format...
+		for (uint32_t l = 0U; l < bh; l++) {
+			const size_t                  row = y_skip + by + l;
+			const unsigned char* restrict src_row;
+			if (dump->is_compressed) {
+				rle_unpack_row(dump->data + row_offsets[row], x_skip, span, src_bpp, scratch);
+				src_row = scratch;
+			} else {
+				src_row = dump->data + (row * dump->stride) + (x_skip * src_bpp);
+			}
+			unpack_px_row(src_row, dump_fmt, rgba, span);
+			pack_px_row(rgba, ctx->deviceQuirks.pixelFormat, band + (l * span * dst_bpp), span);
+		}
+
+		// ...and then blit it, in tiles
+		for (uint32_t bx = 0U; bx < span; bx += RESTORE_TILE_SIZE) {
+			const uint32_t bw = MIN(RESTORE_TILE_SIZE, (uint32_t) span - bx);
+			for (uint32_t l = 0U; l < bh; l++) {
+				// Where does the first pixel of this tile's row end up?
+				struct mxcfb_rect px_region = {
+					.left = src_region->left + bx, .top = src_region->top + by + l, .width = 1U, .height = 1U
+				};
+				rotate_region_by(&px_region, quarter_turns, dump_xres, dump_yres);
+				unsigned char* restrict       dst =
+				    ctx->fbPtr + (px_region.top * line_length) + (px_region.left * dst_bpp);
+				const unsigned char* restrict px  = band + (((l * span) + bx) * dst_bpp);
+				if (quarter_turns == 0U) {
+					memcpy(dst, px, (size_t) bw * dst_bpp);
+				} else {
+					for (uint32_t c = 0U; c < bw; c++) {
+						copy_px(dst, px, dst_bpp);
+						dst += x_step;
+						px  += dst_bpp;
+					}
+				}
+			}
+		}
+	}
+
+cleanup:
+	free(band);
+	free(rgba);
+	free(scratch);
+
+	return rv;
+}
+#endif    // FBINK_WITH_IMAGE
+
+// Dump a specific region of the fb
+int
+    fbink_region_dump_ctx(FBInkContext* restrict ctx            UNUSED_BY_MINIMAL,
+			  int fbfd                              UNUSED_BY_MINIMAL,
+			  short int x_off                       UNUSED_BY_MINIMAL,
+			  short int y_off                       UNUSED_BY_MINIMAL,
+			  unsigned short int w                  UNUSED_BY_MINIMAL,
+			  unsigned short int h                  UNUSED_BY_MINIMAL,
+			  const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL,
+			  FBInkDump* restrict dump              UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	// Open the framebuffer if need be...
+	// NOTE: As usual, we *expect* to be initialized at this point!
+	bool keep_fd = true;
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// mmap the fb if need be...
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// Dump a region of the fb
+	// Pilfer the coordinates computations from draw_image ;).
+	// NOTE: We compute initial offsets from row/col, to help aligning the region with text.
+	if (fbink_cfg->col < 0) {
+		x_off = (short int) (ctx->viewHoriOrigin + x_off + (MAX(ctx->MAXCOLS + fbink_cfg->col, 0) * ctx->FONTW));
+	} else {
+		x_off = (short int) (ctx->viewHoriOrigin + x_off + (fbink_cfg->col * ctx->FONTW));
+	}
+	// NOTE: Unless we *actually* specified a row, ignore viewVertOffset
+	//       The rationale being we want to keep being aligned to text rows when we do specify a row,
+	//       but we don't want the extra offset when we don't (in particular, when dumping what amounts to the full screen).
+	// NOTE: This means that row 0 and row -MAXROWS *will* behave differently, but so be it...
+	if (fbink_cfg->row < 0) {
+		y_off = (short int) (ctx->viewVertOrigin + y_off + (MAX(ctx->MAXROWS + fbink_cfg->row, 0) * ctx->FONTH));
+	} else if (fbink_cfg->row == 0) {
+		y_off = (short int) (ctx->viewVertOrigin - ctx->viewVertOffset + y_off + (fbink_cfg->row * ctx->FONTH));
+		// This of course means that row 0 effectively breaks that "align with text" contract if viewVertOffset != 0,
+		// on the off-chance we do explicitly really want to align something to row 0, so, warn about it...
+		// The "print full-screen data" use-case is greatly more prevalent than "actually rely on row 0 alignment" ;).
+		// And in case that's *really* needed, using -MAXROWS instead of 0 will honor alignment anyway.
+		if (ctx->viewVertOffset != 0U) {
+			LOG("Ignoring the %hhupx row offset because row is 0!", ctx->viewVertOffset);
+		}
+	} else {
+		y_off = (short int) (ctx->viewVertOrigin + y_off + (fbink_cfg->row * ctx->FONTH));
+	}
+	LOG("Adjusted dump coordinates to (%hd, %hd), after column %hd & row %hd",
+	    x_off,
+	    y_off,
+	    fbink_cfg->col,
+	    fbink_cfg->row);
+
+	// Handle horizontal alignment...
+	switch (fbink_cfg->halign) {
+		case CENTER:
+			x_off = (short int) (x_off + (int) (ctx->viewWidth / 2U));
+			x_off = (short int) (x_off - (w / 2));
+			break;
+		case EDGE:
+			x_off = (short int) (x_off + (int) (ctx->viewWidth - (uint32_t) w));
+			break;
+		case NONE:
+		default:
+			break;
+	}
+	if (fbink_cfg->halign != NONE) {
+		LOG("Adjusted dump coordinates to (%hd, %hd) after horizontal alignment", x_off, y_off);
+	}
+
+	// Handle vertical alignment...
+	switch (fbink_cfg->valign) {
+		case CENTER:
+			y_off = (short int) (y_off + (int) (ctx->viewHeight / 2U));
+			y_off = (short int) (y_off - (h / 2));
+			break;
+		case EDGE:
+			y_off = (short int) (y_off + (int) (ctx->viewHeight - (uint32_t) h));
+			break;
+		case NONE:
+		default:
+			break;
+	}
+	if (fbink_cfg->valign != NONE) {
+		LOG("Adjusted dump coordinates to (%hd, %hd) after vertical alignment", x_off, y_off);
+	}
+
+	// Clamp everything to a safe range, because we can't have *anything* going off-screen here.
+	struct mxcfb_rect region;
+	// NOTE: Assign each field individually to avoid a false-positive with Clang's SA...
+	if (fbink_cfg->row == 0) {
+		region.top = MIN(ctx->screenHeight, (uint32_t) MAX((ctx->viewVertOrigin - ctx->viewVertOffset), y_off));
+	} else {
+		region.top = MIN(ctx->screenHeight, (uint32_t) MAX(ctx->viewVertOrigin, y_off));
+	}
+	region.left   = MIN(ctx->screenWidth, (uint32_t) MAX(ctx->viewHoriOrigin, x_off));
+	region.width  = MIN(ctx->screenWidth - region.left, (uint32_t) w);
+	region.height = MIN(ctx->screenHeight - region.top, (uint32_t) h);
+
+	// NOTE: If we ended up with negative display offsets, we should shave those off region.width & region.height,
+	//       when it makes sense to do so.
+	unsigned short int img_x_off = 0;
+	unsigned short int img_y_off = 0;
+	if (x_off < 0) {
+		// We'll start dumping from the beginning of the *visible* part of the region ;)
+		img_x_off = (unsigned short int) (abs(x_off) + ctx->viewHoriOrigin);
+		// Only if the visible section of the region's width is smaller than our screen's width...
+		if ((uint32_t) (w - img_x_off) < ctx->viewWidth) {
+			region.width -= img_x_off;
+		}
+	}
+	if (y_off < 0) {
+		// We'll start dumping from the beginning of the *visible* part of the region ;)
+		if (fbink_cfg->row == 0) {
+			img_y_off = (unsigned short int) (abs(y_off) + ctx->viewVertOrigin - ctx->viewVertOffset);
+		} else {
+			img_y_off = (unsigned short int) (abs(y_off) + ctx->viewVertOrigin);
+		}
+		// Only if the visible section of the region's height is smaller than our screen's height...
+		if ((uint32_t) (h - img_y_off) < ctx->viewHeight) {
+			region.height -= img_y_off;
+		}
+	}
+	LOG("Region: top=%u, left=%u, width=%u, height=%u", region.top, region.left, region.width, region.height);
+	LOG("Dump becomes visible @ (%hu, %hu) for %ux%u out of the requested %dx%d pixels",
+	    img_x_off,
+	    img_y_off,
+	    region.width,
+	    region.height,
+	    w,
+	    h);
+
+	// Rotate the region if need be...
+	(*ctx->fxpRotateRegion)(ctx, &region);
+
+	rv = dump_region(ctx, &region, dump);
+
+	// Cleanup
+cleanup:
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
+	}
+	if (!keep_fd) {
+		close_fb(ctx, fbfd);
+	}
+
+	return rv;
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
+int
+    fbink_region_dump(int                fbfd,
+		      short int          x_off,
+		      short int          y_off,
+		      unsigned short int w,
+		      unsigned short int h,
+		      const FBInkConfig* restrict fbink_cfg,
+		      FBInkDump* restrict dump)
+{
+	return fbink_region_dump_ctx(&defaultCtx, fbfd, x_off, y_off, w, h, fbink_cfg, dump);
+}
+
+// Dump a specific rect of the fb (as-is)
+int
+    fbink_rect_dump_ctx(FBInkContext* restrict ctx     UNUSED_BY_MINIMAL,
+			int fbfd                       UNUSED_BY_MINIMAL,
+			const FBInkRect* restrict rect UNUSED_BY_MINIMAL,
+			FBInkDump* restrict dump       UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	// If no rect, or an empty rect was passed, fallback to a *full* dump.
+	if (!rect || (rect->width == 0U || rect->height == 0U)) {
+		WARN("Requested to dump an empty rect (or none at all), falling back to a full dump");
+		return fbink_dump_ctx(ctx, fbfd, dump);
+	}
+
+	// Open the framebuffer if need be...
+	// NOTE: As usual, we *expect* to be initialized at this point!
+	bool keep_fd = true;
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// mmap the fb if need be...
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// Sanity check...
+	if ((rect->top + rect->height > ctx->vInfo.yres) || (rect->left + rect->width > ctx->vInfo.xres)) {
+		WARN("Requested to dump an OOB rect");
+		rv = ERRCODE(EINVAL);
+		goto cleanup;
+	}
+
+	// Plain rect -> region mapping, we don't want any further rotation trickery here.
+	struct mxcfb_rect region = { .top = rect->top, .left = rect->left, .width = rect->width, .height = rect->height };
+
+	rv = dump_region(ctx, &region, dump);
+
+	// Cleanup
+cleanup:
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
+	}
+	if (!keep_fd) {
+		close_fb(ctx, fbfd);
+	}
+
+	return rv;
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
+int
+    fbink_rect_dump(int fbfd, const FBInkRect* restrict rect, FBInkDump* restrict dump)
+{
+	return fbink_rect_dump_ctx(&defaultCtx, fbfd, rect, dump);
+}
+
+// Restore a fb dump
+int
+    fbink_restore_ctx(FBInkContext* restrict ctx            UNUSED_BY_MINIMAL,
+		      int fbfd                              UNUSED_BY_MINIMAL,
+		      const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL,
+		      const FBInkDump* restrict dump        UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	// Open the framebuffer if need be...
+	// NOTE: As usual, we *expect* to be initialized at this point!
+	bool keep_fd = true;
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// mmap the fb if need be...
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// Restore (if possible)
+	if (!dump->data) {
+		WARN("No dump data to restore");
+		rv = ERRCODE(EINVAL);
+		goto cleanup;
+	}
+	// Check whether we'll need to convert the dump on the fly...
+	const FBINK_PXFMT_INDEX_T dump_fmt =
+	    dump->pixel_format != FBINK_PXFMT_UNKNOWN ? dump->pixel_format : pxfmt_from_bpp(dump->bpp);
+	const bool needs_conversion = dump->rota != ctx->vInfo.rotate || dump->bpp != ctx->vInfo.bits_per_pixel ||
+				      dump_fmt != ctx->deviceQuirks.pixelFormat;
+	// The area of the screen the dump will be restored to (which only differs from the dump's in case of rotation)
+	FBInkRect area          = dump->area;
+	uint8_t   quarter_turns = 0U;
+	uint32_t  dump_xres     = ctx->vInfo.xres;
+	uint32_t  dump_yres     = ctx->vInfo.yres;
+	if (needs_conversion) {
+		if (dump->bpp == 4U || ctx->vInfo.bits_per_pixel == 4U) {
+			WARN("Can't convert the dump because 4bpp is not supported! dump: %hhu vs. fb: %u",
+			     dump->bpp,
+			     ctx->vInfo.bits_per_pixel);
+			rv = ERRCODE(ENOTSUP);
+			goto cleanup;
+		}
+		if (dump_fmt == FBINK_PXFMT_UNKNOWN) {
+			WARN("Can't convert the dump because of its unknown pixel format (%hhubpp)", dump->bpp);
+			rv = ERRCODE(ENOTSUP);
+			goto cleanup;
+		}
+		if (dump->rota != ctx->vInfo.rotate) {
+			LOG("Rotating the dump from %hhu (%s) to %u (%s)",
+			    dump->rota,
+			    fb_rotate_to_string(dump->rota),
+			    ctx->vInfo.rotate,
+			    fb_rotate_to_string(ctx->vInfo.rotate));
+			uint32_t from_rota = dump->rota;
+			uint32_t to_rota   = ctx->vInfo.rotate;
+#	if defined(FBINK_FOR_KOBO)
+			// NOTE: Native rotate values don't necessarily follow the physical orientations on NTX boards
+			//       (c.f., ntxRotaQuirk & rotate_touch_coordinates), so, compute the delta between canonical ones.
+			from_rota = fbink_rota_native_to_canonical_ctx(ctx, from_rota);
+			to_rota   = fbink_rota_native_to_canonical_ctx(ctx, to_rota);
+#	endif
+			quarter_turns = (uint8_t) ((to_rota - from_rota) & 3U);
+			// Screen dimensions at dump time
+			if (quarter_turns & 1U) {
+				dump_xres = ctx->vInfo.yres;
+				dump_yres = ctx->vInfo.xres;
+			}
+		}
+		if (dump->bpp != ctx->vInfo.bits_per_pixel || dump_fmt != ctx->deviceQuirks.pixelFormat) {
+			LOG("Converting the dump from %s (%hhubpp) to %s (%ubpp)",
+			    fb_pixfmt_to_string(dump_fmt),
+			    dump->bpp,
+			    fb_pixfmt_to_string(ctx->deviceQuirks.pixelFormat),
+			    ctx->vInfo.bits_per_pixel);
+		}
+
+		// We only handle the visible part of the dump (i.e., we skip the scanline padding of full dumps)
+		if (dump->area.left >= dump_xres || dump->area.top >= dump_yres) {
+			WARN("Can't convert the dump because it's OOB! dump: (%hu, %hu) vs. fb: %ux%u",
+			     dump->area.left,
+			     dump->area.top,
+			     dump_xres,
+			     dump_yres);
+			rv = ERRCODE(ENOTSUP);
+			goto cleanup;
+		}
+		struct mxcfb_rect dump_region = { .left   = dump->area.left,
+						  .top    = dump->area.top,
+						  .width  = MIN(dump->area.width, dump_xres - dump->area.left),
+						  .height = MIN(dump->area.height, dump_yres - dump->area.top) };
+		rotate_region_by(&dump_region, quarter_turns, dump_xres, dump_yres);
+		area.left   = (unsigned short int) dump_region.left;
+		area.top    = (unsigned short int) dump_region.top;
+		area.width  = (unsigned short int) dump_region.width;
+		area.height = (unsigned short int) dump_region.height;
+	}
+	if (area.width > ctx->vInfo.xres_virtual) {
+		WARN("Can't restore the dump because it's wider than the screen! dump: %hu vs. fb: %u",
+		     area.width,
+		     ctx->vInfo.xres_virtual);
+		rv = ERRCODE(ENOTSUP);
+		goto cleanup;
+	}
+	if (area.height > ctx->vInfo.yres) {
+		WARN("Can't restore the dump because it's taller than the screen! dump: %hu vs. fb: %u",
+		     area.height,
+		     ctx->vInfo.yres);
+		rv = ERRCODE(ENOTSUP);
+		goto cleanup;
+	}
+	if (!needs_conversion && dump->size > ctx->fInfo.smem_len) {
+		WARN("Can't restore the dump because it's larger than the framebuffer! dump: %zu vs. fb: %u",
+		     dump->size,
+		     ctx->fInfo.smem_len);
+		rv = ERRCODE(ENOTSUP);
+		goto cleanup;
+	}
+	// Cropping related sanity checks...
+	if (dump->clip.width != 0U || dump->clip.height != 0U) {
+		if (dump->is_full) {
+			WARN("Can't crop a full-screen dump");
+			rv = ERRCODE(ENOTSUP);
+			goto cleanup;
+		}
+		if (dump->clip.width == 0U) {
+			WARN("Cropped width can't be zero");
+			rv = ERRCODE(ENOTSUP);
+			goto cleanup;
+		}
+		if (dump->clip.height == 0U) {
+			WARN("Cropped height can't be zero");
+			rv = ERRCODE(ENOTSUP);
+			goto cleanup;
+		}
+		if (dump->clip.width > ctx->vInfo.xres_virtual) {
+			WARN("Clip rectangle is wider than the screen! clip: %hu vs. fb: %u",
+			     dump->clip.width,
+			     ctx->vInfo.xres_virtual);
+			rv = ERRCODE(ENOTSUP);
+			goto cleanup;
+		}
+		if (dump->clip.height > ctx->vInfo.yres) {
+			WARN("Clip rectangle is taller than the screen! clip: %hu vs. fb: %u",
+			     dump->clip.height,
+			     ctx->vInfo.yres);
+			rv = ERRCODE(ENOTSUP);
+			goto cleanup;
+		}
+		if (dump->clip.left >= ctx->vInfo.xres) {
+			WARN("Clip rectangle's left edge is OOB! clip: %hu vs. fb: %u", dump->clip.left, ctx->vInfo.xres);
+			rv = ERRCODE(ENOTSUP);
+			goto cleanup;
+		}
+		if (dump->clip.top >= ctx->vInfo.yres) {
+			WARN("Clip rectangle's top edge is OOB! clip: %hu vs. fb: %u", dump->clip.top, ctx->vInfo.yres);
+			rv = ERRCODE(ENOTSUP);
+			goto cleanup;
+		}
+		// Overlap check (c.f., https://stackoverflow.com/q/306316)
+		if (!(area.left < dump->clip.left + dump->clip.width)) {
+			WARN("Clip rectangle is outside the dumped area (on the left)");
+			rv = ERRCODE(ENOTSUP);
+			goto cleanup;
+		}
+		if (!(area.left + area.width > dump->clip.left)) {
+			WARN("Clip rectangle is outside the dumped area (on the right)");
+			rv = ERRCODE(ENOTSUP);
+			goto cleanup;
+		}
+		if (!(area.top < dump->clip.top + dump->clip.height)) {
+			WARN("Clip rectangle is outside the dumped area (at the top)");
+			rv = ERRCODE(ENOTSUP);
+			goto cleanup;
+		}
+		if (!(area.top + area.height > dump->clip.top)) {
+			WARN("Clip rectangle is outside the dumped area (at the bottom)");
+			rv = ERRCODE(ENOTSUP);
+			goto cleanup;
+		}
+	}
+
+	// We'll need a region...
+	struct mxcfb_rect region;
+
+	if (needs_conversion) {
+		// Only restore the intersection with the clip rectangle, if any (c.f., the cropping codepath below)
+		if (dump->clip.width == 0U && dump->clip.height == 0U) {
+			region.left   = area.left;
+			region.top    = area.top;
+			region.width  = area.width;
+			region.height = area.height;
+		} else {
+			region.left   = (uint32_t) MAX(area.left, dump->clip.left);
+			region.top    = (uint32_t) MAX(area.top, dump->clip.top);
+			region.width  = (uint32_t) MIN(area.left + area.width, dump->clip.left + dump->clip.width) - region.left;
+			region.height = (uint32_t) MIN(area.top + area.height, dump->clip.top + dump->clip.height) - region.top;
+		}
+		LOG("Restoring the converted dump @ (%u, %u) %ux%u", region.left, region.top, region.width, region.height);
+
+		// Map that back to the dump's coordinates
+		struct mxcfb_rect src_region = region;
+		rotate_region_by(&src_region, (uint8_t) ((4U - quarter_turns) & 3U), ctx->vInfo.xres, ctx->vInfo.yres);
+		rv = restore_converted_region(ctx, dump, dump_fmt, quarter_turns, dump_xres, dump_yres, &src_region);
+		if (rv != EXIT_SUCCESS) {
+			goto cleanup;
+		}
+	} else if (dump->is_full) {
+		// Full dump, easy enough
+		if (dump->is_compressed) {
+			// NOTE: A full dump's stride is the fb's line_length, so we unpack whole scanlines, padding included.
+			const uint8_t unit = dump->bpp == 4U ? 1U : (uint8_t) (dump->bpp >> 3U);
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wcast-align"
+			const uint32_t* restrict row_offsets = (const uint32_t*) dump->data;
+#	pragma GCC diagnostic pop
+			for (unsigned short int l = 0U; l < dump->area.height; l++) {
+				rle_unpack_row(dump->data + row_offsets[l],
+					       0U,
+					       dump->stride / unit,
+					       unit,
+					       ctx->fbPtr + ((size_t) l * ctx->fInfo.line_length));
+			}
+		} else {
+			memcpy(ctx->fbPtr, dump->data, dump->size);
+		}
+		fullscreen_region(ctx, &region);
+	} else {
+		// NOTE: The crop codepath is perfectly safe with no cropping, it's just a little bit hairier to follow...
+		if (dump->clip.width == 0U && dump->clip.height == 0U) {
+			// Region dump, restore line by line
+			if (dump->is_compressed) {
+				restore_compressed_rows(ctx,
+							dump,
+							dump->area.left,
+							dump->area.top,
+							0U,
+							0U,
+							dump->area.width,
+							dump->area.height);
+			} else if (dump->bpp == 4U) {
+				for (unsigned short int j = dump->area.top, l = 0U; l < dump->area.height; j++, l++) {
+					size_t fb_offset   =
+					    (size_t) (dump->area.left >> 1U) + (j * ctx->fInfo.line_length);
+					size_t dump_offset = (size_t) (l * dump->stride);
+					memcpy(ctx->fbPtr + fb_offset,
+					       dump->data + dump_offset,
+					       (size_t) dump->area.width >> 1U);
+				}
+			} else {
+				// We're going to need the amount of bytes taken per pixel...
+				const uint8_t bpp = dump->bpp >> 3U;
+				for (unsigned short int j = dump->area.top, l = 0U; l < dump->area.height; j++, l++) {
+					size_t fb_offset   =
+					    (size_t) (dump->area.left * bpp) + (j * ctx->fInfo.line_length);
+					size_t dump_offset = (size_t) (l * dump->stride);
+					memcpy(ctx->fbPtr + fb_offset,
+					       dump->data + dump_offset,
+					       (size_t) dump->area.width * bpp);
+				}
+			}
+			region.left   = dump->area.left;
+			region.top    = dump->area.top;
+			region.width  = dump->area.width;
+			region.height = dump->area.height;
+		} else {
+			// Handle cropping shenanigans...
+			const unsigned short int x_skip = dump->clip.left > dump->area.left
+							      ? (unsigned short int) (dump->clip.left - dump->area.left)
+							      : 0U;
+			const unsigned short int x      = (unsigned short int) (dump->area.left + x_skip);
+			const unsigned short int y_skip =
+			    dump->clip.top > dump->area.top ? (unsigned short int) (dump->clip.top - dump->area.top) : 0U;
+			const unsigned short int y  = (unsigned short int) (dump->area.top + y_skip);
+			// NOTE: We only want to display the intersection between the full dump area and the clip rectangle...
+			//       The earlier overlap check should ensure the sanity of the resulting rectangle here.
+			//       c.f., https://stackoverflow.com/q/19753134
+			const unsigned short int x1 = (unsigned short int) MAX(dump->area.left, dump->clip.left);
+			const unsigned short int y1 = (unsigned short int) MAX(dump->area.top, dump->clip.top);
+			const unsigned short int x2 = (unsigned short int) MIN(dump->area.left + dump->area.width,
+									       dump->clip.left + dump->clip.width);
+			const unsigned short int y2 = (unsigned short int) MIN(dump->area.top + dump->area.height,
+									       dump->clip.top + dump->clip.height);
+			const unsigned short int w  = (unsigned short int) (x2 - x1);
+			const unsigned short int h  = (unsigned short int) (y2 - y1);
+			LOG("The dump area (%hu, %hu) %hux%hu",
+			    dump->area.left,
+			    dump->area.top,
+			    dump->area.width,
+			    dump->area.height);
+			LOG("and clip rectangle (%hu, %hu) %hux%hu",
+			    dump->clip.left,
+			    dump->clip.top,
+			    dump->clip.width,
+			    dump->clip.height);
+			LOG("intersect as (%hu, %hu, %hu, %hu) %hux%hu", x1, y1, x2, y2, w, h);
+			// Region dump, restore line by line
+			if (dump->is_compressed) {
+				restore_compressed_rows(ctx, dump, x, y, x_skip, y_skip, w, h);
+			} else if (dump->bpp == 4U) {
+				for (unsigned short int j = y, l = 0U; l < h; j++, l++) {
+					size_t fb_offset   = (size_t) (x >> 1U) + (j * ctx->fInfo.line_length);
+					size_t dump_offset = (x_skip >> 1U) + ((size_t) (y_skip + l) * dump->stride);
+					memcpy(ctx->fbPtr + fb_offset, dump->data + dump_offset, (size_t) w >> 1U);
+				}
+			} else {
+				// We're going to need the amount of bytes taken per pixel...
+				const uint8_t bpp = dump->bpp >> 3U;
+				for (unsigned short int j = y, l = 0U; l < h; j++, l++) {
+					size_t fb_offset = (size_t) (x * bpp) + (j * ctx->fInfo.line_length);
+					size_t dump_offset =
+					    (size_t) (x_skip * bpp) + ((size_t) (y_skip + l) * dump->stride);
+					memcpy(ctx->fbPtr + fb_offset, dump->data + dump_offset, (size_t) w * bpp);
+				}
+			}
+			region.left   = x;
+			region.top    = y;
+			region.width  = w;
+			region.height = h;
+		}
+	}
+
+	// And now, we can refresh the screen
+	if (refresh(ctx, fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
+		PFWARN("Failed to refresh the screen");
 	}
-	// Store the current fb state for that dump
-	dump->area.left   = 0U;
-	dump->area.top    = 0U;
-	dump->area.width  = (unsigned short int) vInfo.xres_virtual;
-	dump->area.height = (unsigned short int) vInfo.yres;
-	dump->rota        = (uint8_t) vInfo.rotate;
-	dump->bpp         = (uint8_t) vInfo.bits_per_pixel;
-	dump->is_full     = true;
-	// And finally, the fb data itself
-	memcpy(dump->data, fbPtr, dump->size);
 
 	// Cleanup
 cleanup:
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -12271,259 +15526,333 @@ cleanup:
 #endif    // FBINK_WITH_IMAGE
 }
 
-#ifdef FBINK_WITH_IMAGE
-// Helper for fbink_region_dump & fbink_rect_dump
-static int
-    dump_region(struct mxcfb_rect* region, FBInkDump* restrict dump)
+int
+    fbink_restore(int fbfd, const FBInkConfig* restrict fbink_cfg, const FBInkDump* restrict dump)
 {
-	// Bail if we were fed an empty region
-	if (region->width == 0U || region->height == 0U) {
-		WARN("Tried to dump an empty region");
-		return ERRCODE(EINVAL);
-	}
+	return fbink_restore_ctx(&defaultCtx, fbfd, fbink_cfg, dump);
+}
 
-	// Free current data in case the dump struct is being reused
+// Explicitly frees the FBInkDump *data* allocated by fbink_dump & fbink_region_dump
+int
+    fbink_free_dump_data(FBInkDump* restrict dump UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
 	if (dump->data) {
-		LOG("Recycling FBinkDump!");
 		free(dump->data);
+		// Clear the struct, both to clear the metadata, and to make sure not to leave a dangling pointer,
+		// ensuring a subsequent dump() won't try to recycle this struct again.
 		memset(dump, 0, sizeof(*dump));
-	}
-	// Start by allocating enough memory for a full dump of the computed region...
-	// We're going to need the amount of bytes taken per pixel...
-	const uint8_t bpp = (uint8_t) (vInfo.bits_per_pixel >> 3U);
-	// And then to handle 4bpp on its own, because 4/8 == 0 ;).
-	if (vInfo.bits_per_pixel == 4U) {
-		// Align to the nearest byte boundary to make our life easier...
-		if (region->left & 0x01u) {
-			// x is odd, round *down* to the nearest multiple of two (i.e., align to the start of the current byte)
-			region->left &= ~0x01u;
-			LOG("Updated region.left to %u because of alignment constraints", region->left);
-		}
-		if (region->width & 0x01u) {
-			// w is odd, round *up* to the nearest multiple of two (i.e., align to the end of the current byte)
-			region->width = (region->width + 1U) & ~0x01u;
-			LOG("Updated region.width to %u because of alignment constraints", region->width);
-		}
-		// Two pixels per byte, and we've just ensured to never end up with a decimal when dividing by two ;).
-		dump->stride = (size_t) (region->width >> 1U);
-		dump->size   = (size_t) (dump->stride * region->height);
-		dump->data   = calloc(dump->size, sizeof(*dump->data));
+
+		return EXIT_SUCCESS;
 	} else {
-		dump->stride = (size_t) (region->width * bpp);
-		dump->size   = (size_t) (dump->stride * region->height);
-		dump->data   = calloc(dump->size, sizeof(*dump->data));
+		return ERRCODE(EINVAL);
 	}
-	if (dump->data == NULL) {
-		PFWARN("dump->data %zu bytes calloc: %m", dump->size);
-		dump->stride = 0U;
-		dump->size   = 0U;
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
+// Compress the data of a fb dump, in place
+int
+    fbink_compress_dump(FBInkDump* restrict dump UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_IMAGE
+	if (!dump->data) {
+		WARN("No dump data to compress");
+		return ERRCODE(EINVAL);
+	}
+	if (dump->is_compressed) {
+		WARN("Dump is already compressed");
+		return ERRCODE(EINVAL);
+	}
+
+	// Work in pixels, except at 4bpp, where we work in bytes.
+	const uint8_t unit = dump->bpp == 4U ? 1U : (uint8_t) (dump->bpp >> 3U);
+	if (unit == 0U || dump->stride % unit != 0U) {
+		WARN("Can't compress a dump with a %zu bytes stride at %hhubpp", dump->stride, dump->bpp);
+		return ERRCODE(EINVAL);
+	}
+	const size_t len  = dump->stride / unit;
+	const size_t rows = dump->area.height;
+
+	// Start with a worst-case sized buffer (i.e., nothing but literal packets), we'll shrink it once we're done.
+	const size_t table_size = rows * sizeof(uint32_t);
+	const size_t max_size =
+	    table_size + dump->size + (rows * ((len + RLE_MAX_LITERAL - 1U) / RLE_MAX_LITERAL));
+	unsigned char* restrict packed = malloc(max_size);
+	if (packed == NULL) {
+		PFWARN("packed %zu bytes malloc: %m", max_size);
 		return ERRCODE(EXIT_FAILURE);
 	}
-	// Store the current fb state for that dump
-	dump->area.left   = (unsigned short int) region->left;
-	dump->area.top    = (unsigned short int) region->top;
-	dump->area.width  = (unsigned short int) region->width;
-	dump->area.height = (unsigned short int) region->height;
-	dump->rota        = (uint8_t) vInfo.rotate;
-	dump->bpp         = (uint8_t) vInfo.bits_per_pixel;
-	dump->is_full     = false;
-	// And finally, the fb data itself, scanline per scanline
-	if (dump->bpp == 4U) {
-		for (unsigned short int j = dump->area.top, l = 0U; l < dump->area.height; j++, l++) {
-			size_t dump_offset = (size_t) (l * dump->stride);
-			size_t fb_offset   = (size_t) (dump->area.left >> 1U) + (j * fInfo.line_length);
-			memcpy(dump->data + dump_offset, fbPtr + fb_offset, dump->stride);
-		}
-	} else {
-		for (unsigned short int j = dump->area.top, l = 0U; l < dump->area.height; j++, l++) {
-			size_t dump_offset = (size_t) (l * dump->stride);
-			size_t fb_offset   = (size_t) (dump->area.left * bpp) + (j * fInfo.line_length);
-			memcpy(dump->data + dump_offset, fbPtr + fb_offset, dump->stride);
+
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wcast-align"
+	uint32_t* restrict row_offsets = (uint32_t*) packed;
+#	pragma GCC diagnostic pop
+	size_t packed_size = table_size;
+	for (size_t l = 0U; l < rows; l++) {
+		row_offsets[l] = (uint32_t) packed_size;
+		packed_size   += rle_pack_row(dump->data + (l * dump->stride), len, unit, packed + packed_size);
+	}
+
+	// Don't bother if that didn't actually buy us anything...
+	if (packed_size >= dump->size) {
+		LOG("Compressed dump (%zu bytes) isn't any smaller than the original (%zu bytes), leaving it alone",
+		    packed_size,
+		    dump->size);
+		free(packed);
+		return ERRCODE(ENODATA);
+	}
+
+	// Shrink it down to size (if that fails, we just keep the larger buffer around, no harm done).
+	unsigned char* restrict shrunk = realloc(packed, packed_size);
+	if (shrunk != NULL) {
+		packed = shrunk;
+	}
+	LOG("Compressed dump from %zu to %zu bytes", dump->size, packed_size);
+
+	free(dump->data);
+	dump->data          = packed;
+	dump->size          = packed_size;
+	dump->is_compressed = true;
+
+	return EXIT_SUCCESS;
+#else
+	WARN("Image support is disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_IMAGE
+}
+
+// Return a copy of the last drawn rectangle coordinates/dimensions
+FBInkRect
+    fbink_get_last_rect_ctx(FBInkContext* restrict ctx, bool rotated)
+{
+	if (rotated) {
+		// I'm really glad I went with a different layout in FBInkRect there... >_<".
+		struct mxcfb_rect region = { .top    = ctx->lastRect.top,
+					     .left   = ctx->lastRect.left,
+					     .width  = ctx->lastRect.width,
+					     .height = ctx->lastRect.height };
+		(*ctx->fxpRotateRegion)(ctx, &region);
+		FBInkRect rect = { .left   = (unsigned short int) region.left,
+				   .top    = (unsigned short int) region.top,
+				   .width  = (unsigned short int) region.width,
+				   .height = (unsigned short int) region.height };
+		return rect;
+	}
+	return ctx->lastRect;
+}
+
+FBInkRect
+    fbink_get_last_rect(bool rotated)
+{
+	return fbink_get_last_rect_ctx(&defaultCtx, rotated);
+}
+
+// Grants direct access to the backing buffer's pointer & size
+unsigned char*
+    fbink_get_fb_pointer_ctx(FBInkContext* restrict ctx, int fbfd, size_t* buffer_size)
+{
+	if (!ctx->deviceQuirks.skipId) {
+		PFWARN("FBInk hasn't been initialized yet");
+		goto failure;
+	}
+
+	if (fbfd == FBFD_AUTO) {
+		PFWARN("Requires a persistent backing buffer");
+		goto failure;
+	}
+
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
+			goto failure;
 		}
 	}
 
-	return EXIT_SUCCESS;
+#ifdef FBINK_FOR_KOBO
+	*buffer_size = ctx->deviceQuirks.isSunxi ? ctx->sunxiCtx.alloc_size : ctx->fInfo.smem_len;
+#else
+	*buffer_size = ctx->fInfo.smem_len;
+#endif
+	return ctx->fbPtr;
+
+failure:
+	*buffer_size = 0U;
+	return NULL;
 }
-#endif    // FBINK_WITH_IMAGE
 
-// Dump a specific region of the fb
-int
-    fbink_region_dump(int fbfd                              UNUSED_BY_MINIMAL,
-		      short int x_off                       UNUSED_BY_MINIMAL,
-		      short int y_off                       UNUSED_BY_MINIMAL,
-		      unsigned short int w                  UNUSED_BY_MINIMAL,
-		      unsigned short int h                  UNUSED_BY_MINIMAL,
-		      const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL,
-		      FBInkDump* restrict dump              UNUSED_BY_MINIMAL)
+unsigned char*
+    fbink_get_fb_pointer(int fbfd, size_t* buffer_size)
 {
-#ifdef FBINK_WITH_IMAGE
-	// Open the framebuffer if need be...
-	// NOTE: As usual, we *expect* to be initialized at this point!
-	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
-		return ERRCODE(EXIT_FAILURE);
-	}
+	return fbink_get_fb_pointer_ctx(&defaultCtx, fbfd, buffer_size);
+}
 
-	// Assume success, until shit happens ;)
-	int rv = EXIT_SUCCESS;
+// Returns a *full* copy of our internal framebuffer structs
+void
+    fbink_get_fb_info_ctx(FBInkContext* restrict ctx,
+			  struct fb_var_screeninfo* var_info,
+			  struct fb_fix_screeninfo* fix_info)
+{
+	*var_info = ctx->vInfo;
+	*fix_info = ctx->fInfo;
+}
 
-	// mmap the fb if need be...
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
-			rv = ERRCODE(EXIT_FAILURE);
-			goto cleanup;
-		}
-	}
+void
+    fbink_get_fb_info(struct fb_var_screeninfo* var_info, struct fb_fix_screeninfo* fix_info)
+{
+	fbink_get_fb_info_ctx(&defaultCtx, var_info, fix_info);
+}
 
-	// Dump a region of the fb
-	// Pilfer the coordinates computations from draw_image ;).
-	// NOTE: We compute initial offsets from row/col, to help aligning the region with text.
-	if (fbink_cfg->col < 0) {
-		x_off = (short int) (viewHoriOrigin + x_off + (MAX(MAXCOLS + fbink_cfg->col, 0) * FONTW));
-	} else {
-		x_off = (short int) (viewHoriOrigin + x_off + (fbink_cfg->col * FONTW));
-	}
-	// NOTE: Unless we *actually* specified a row, ignore viewVertOffset
-	//       The rationale being we want to keep being aligned to text rows when we do specify a row,
-	//       but we don't want the extra offset when we don't (in particular, when dumping what amounts to the full screen).
-	// NOTE: This means that row 0 and row -MAXROWS *will* behave differently, but so be it...
-	if (fbink_cfg->row < 0) {
-		y_off = (short int) (viewVertOrigin + y_off + (MAX(MAXROWS + fbink_cfg->row, 0) * FONTH));
-	} else if (fbink_cfg->row == 0) {
-		y_off = (short int) (viewVertOrigin - viewVertOffset + y_off + (fbink_cfg->row * FONTH));
-		// This of course means that row 0 effectively breaks that "align with text" contract if viewVertOffset != 0,
-		// on the off-chance we do explicitly really want to align something to row 0, so, warn about it...
-		// The "print full-screen data" use-case is greatly more prevalent than "actually rely on row 0 alignment" ;).
-		// And in case that's *really* needed, using -MAXROWS instead of 0 will honor alignment anyway.
-		if (viewVertOffset != 0U) {
-			LOG("Ignoring the %hhupx row offset because row is 0!", viewVertOffset);
-		}
+#ifdef FBINK_WITH_DRAW
+// Accumulate damage on the active offscreen surface
+static void
+    damage_surface(FBInkContext* restrict ctx, const struct mxcfb_rect* restrict region)
+{
+	FBInkRect* restrict damage = &ctx->activeSurface->damage;
+	if (damage->width == 0U || damage->height == 0U) {
+		damage->left   = (unsigned short int) region->left;
+		damage->top    = (unsigned short int) region->top;
+		damage->width  = (unsigned short int) region->width;
+		damage->height = (unsigned short int) region->height;
 	} else {
-		y_off = (short int) (viewVertOrigin + y_off + (fbink_cfg->row * FONTH));
+		const uint32_t x1 = MIN((uint32_t) damage->left, region->left);
+		const uint32_t y1 = MIN((uint32_t) damage->top, region->top);
+		const uint32_t x2 = MAX((uint32_t) damage->left + damage->width, region->left + region->width);
+		const uint32_t y2 = MAX((uint32_t) damage->top + damage->height, region->top + region->height);
+		damage->left      = (unsigned short int) x1;
+		damage->top       = (unsigned short int) y1;
+		damage->width     = (unsigned short int) (x2 - x1);
+		damage->height    = (unsigned short int) (y2 - y1);
 	}
-	LOG("Adjusted dump coordinates to (%hd, %hd), after column %hd & row %hd",
-	    x_off,
-	    y_off,
-	    fbink_cfg->col,
-	    fbink_cfg->row);
+}
 
-	// Handle horizontal alignment...
-	switch (fbink_cfg->halign) {
-		case CENTER:
-			x_off = (short int) (x_off + (int) (viewWidth / 2U));
-			x_off = (short int) (x_off - (w / 2));
-			break;
-		case EDGE:
-			x_off = (short int) (x_off + (int) (viewWidth - (uint32_t) w));
-			break;
-		case NONE:
-		default:
-			break;
-	}
-	if (fbink_cfg->halign != NONE) {
-		LOG("Adjusted dump coordinates to (%hd, %hd) after horizontal alignment", x_off, y_off);
+// Check that a surface still matches the framebuffer's layout
+static bool
+    is_surface_stale(FBInkContext* restrict ctx, const FBInkSurface* restrict surface)
+{
+	if (surface->stride != ctx->fInfo.line_length || surface->bpp != ctx->vInfo.bits_per_pixel ||
+	    surface->rota != ctx->vInfo.rotate) {
+		return true;
 	}
 
-	// Handle vertical alignment...
-	switch (fbink_cfg->valign) {
-		case CENTER:
-			y_off = (short int) (y_off + (int) (viewHeight / 2U));
-			y_off = (short int) (y_off - (h / 2));
-			break;
-		case EDGE:
-			y_off = (short int) (y_off + (int) (viewHeight - (uint32_t) h));
-			break;
-		case NONE:
-		default:
-			break;
-	}
-	if (fbink_cfg->valign != NONE) {
-		LOG("Adjusted dump coordinates to (%hd, %hd) after vertical alignment", x_off, y_off);
+	// A virtual screen page has to be the currently hidden one.
+	if (surface->is_page) {
+		const size_t page_size = (size_t) ctx->fInfo.line_length * ctx->vInfo.yres;
+		return !ctx->isFbMapped || ctx->vInfo.yres_virtual < 2U * ctx->vInfo.yres || surface->size != page_size ||
+		       (ctx->vInfo.yoffset == 0U && surface->data != ctx->fbPtr + page_size) ||
+		       (ctx->vInfo.yoffset == ctx->vInfo.yres && surface->data != ctx->fbPtr) ||
+		       (ctx->vInfo.yoffset != 0U && ctx->vInfo.yoffset != ctx->vInfo.yres);
 	}
 
-	// Clamp everything to a safe range, because we can't have *anything* going off-screen here.
-	struct mxcfb_rect region;
-	// NOTE: Assign each field individually to avoid a false-positive with Clang's SA...
-	if (fbink_cfg->row == 0) {
-		region.top = MIN(screenHeight, (uint32_t) MAX((viewVertOrigin - viewVertOffset), y_off));
-	} else {
-		region.top = MIN(screenHeight, (uint32_t) MAX(viewVertOrigin, y_off));
+#	ifndef FBINK_FOR_LINUX
+	// A hardware alternate buffer lives *inside* our mapping, so it has to be the exact same one.
+	if (surface->phys_addr != 0U) {
+		const size_t offset = get_alt_buffer_offset(ctx);
+		return offset == 0U || !ctx->isFbMapped || surface->data != ctx->fbPtr + offset ||
+		       surface->size != (size_t) ctx->fInfo.line_length * ctx->vInfo.yres ||
+		       surface->phys_addr != (uint32_t) (ctx->fInfo.smem_start + offset);
 	}
-	region.left   = MIN(screenWidth, (uint32_t) MAX(viewHoriOrigin, x_off));
-	region.width  = MIN(screenWidth - region.left, (uint32_t) w);
-	region.height = MIN(screenHeight - region.top, (uint32_t) h);
+#	endif
 
-	// NOTE: If we ended up with negative display offsets, we should shave those off region.width & region.height,
-	//       when it makes sense to do so.
-	unsigned short int img_x_off = 0;
-	unsigned short int img_y_off = 0;
-	if (x_off < 0) {
-		// We'll start dumping from the beginning of the *visible* part of the region ;)
-		img_x_off = (unsigned short int) (abs(x_off) + viewHoriOrigin);
-		// Only if the visible section of the region's width is smaller than our screen's width...
-		if ((uint32_t) (w - img_x_off) < viewWidth) {
-			region.width -= img_x_off;
-		}
+	// NOTE: On sunxi, we only know the size of the mapping while it's mapped (e.g., not between FBFD_AUTO calls).
+	const size_t map_size = get_fb_map_size(ctx);
+	return map_size != 0U && surface->size != map_size;
+}
+
+#	ifndef FBINK_FOR_LINUX
+// Find room for a full screen's worth of hardware alternate buffer in the offscreen part of the framebuffer memory.
+// Returns its offset from the start of the framebuffer, or 0 if there isn't any.
+static size_t
+    get_alt_buffer_offset(FBInkContext* restrict ctx)
+{
+	const size_t page_size = (size_t) ctx->fInfo.line_length * ctx->vInfo.yres;
+	const size_t virt_size = (size_t) ctx->fInfo.line_length * ctx->vInfo.yres_virtual;
+
+	size_t offset = 0U;
+	if (ctx->fInfo.smem_len >= virt_size + page_size) {
+		// Past the virtual screen, which should be left alone by everyone else (that's what utils/alt_buffer.c does).
+		offset = virt_size;
+	} else if (ctx->vInfo.yres_virtual >= 2U * ctx->vInfo.yres && ctx->fInfo.smem_len >= virt_size &&
+		   ctx->vInfo.yoffset == 0U) {
+		// Otherwise, the second page of the virtual screen (provided it's not the one being displayed).
+		offset = page_size;
 	}
-	if (y_off < 0) {
-		// We'll start dumping from the beginning of the *visible* part of the region ;)
-		if (fbink_cfg->row == 0) {
-			img_y_off = (unsigned short int) (abs(y_off) + viewVertOrigin - viewVertOffset);
-		} else {
-			img_y_off = (unsigned short int) (abs(y_off) + viewVertOrigin);
-		}
-		// Only if the visible section of the region's height is smaller than our screen's height...
-		if ((uint32_t) (h - img_y_off) < viewHeight) {
-			region.height -= img_y_off;
-		}
+
+	// NOTE: The EPDC only deals in 32-bit physical addresses.
+	if (offset != 0U && (uint64_t) ctx->fInfo.smem_start + offset + page_size > UINT32_MAX) {
+		return 0U;
 	}
-	LOG("Region: top=%u, left=%u, width=%u, height=%u", region.top, region.left, region.width, region.height);
-	LOG("Dump becomes visible @ (%hu, %hu) for %ux%u out of the requested %dx%d pixels",
-	    img_x_off,
-	    img_y_off,
-	    region.width,
-	    region.height,
-	    w,
-	    h);
 
-	// Rotate the region if need be...
-	(*fxpRotateRegion)(&region);
+	return offset;
+}
+#	endif
 
-	rv = dump_region(&region, dump);
+// Whether a surface's data lives inside the framebuffer mapping (as opposed to a private buffer)
+static inline bool
+    is_surface_in_fb(const FBInkSurface* restrict surface)
+{
+	return surface->phys_addr != 0U || surface->is_page;
+}
 
-	// Cleanup
-cleanup:
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
-	}
-	if (!keep_fd) {
-		close_fb(fbfd);
+// Copy a surface's damaged area from one buffer to another (both with the surface's layout), one scanline at a time.
+static void
+    copy_surface_damage(const FBInkSurface* restrict surface,
+			unsigned char* restrict dst,
+			const unsigned char* restrict src)
+{
+	// NOTE: The damage is already in physical coordinates, i.e., it maps directly to the memory layout.
+	//       Make sure we don't trust it blindly, though...
+	const size_t rows = surface->size / surface->stride;
+	const size_t y1   = MIN((size_t) surface->damage.top, rows);
+	const size_t y2   = MIN((size_t) surface->damage.top + surface->damage.height, rows);
+	// NOTE: Round to the enclosing bytes, for the sake of 4bpp
+	const size_t x1   = MIN(((size_t) surface->damage.left * surface->bpp) >> 3U, surface->stride);
+	const size_t x2 =
+	    MIN((((size_t) surface->damage.left + surface->damage.width) * surface->bpp + 7U) >> 3U, surface->stride);
+	for (size_t y = y1; y < y2; y++) {
+		const size_t offset = y * surface->stride + x1;
+		memcpy(dst + offset, src + offset, x2 - x1);
+	}
+}
+
+// Pan the display to the virtual screen page starting at yoffset
+static int
+    pan_display(FBInkContext* restrict ctx, int fbfd, uint32_t yoffset)
+{
+	struct fb_var_screeninfo var = ctx->vInfo;
+	var.xoffset                  = 0U;
+	var.yoffset                  = yoffset;
+
+	if (ioctl(fbfd, FBIOPAN_DISPLAY, &var) < 0) {
+		PFWARN("FBIOPAN_DISPLAY: %m");
+		return ERRCODE(EXIT_FAILURE);
 	}
 
-	return rv;
-#else
-	WARN("Image support is disabled in this FBInk build");
-	return ERRCODE(ENOSYS);
-#endif    // FBINK_WITH_IMAGE
+	// NOTE: Keep our own copy in sync, so we don't have to round-trip through FBIOGET_VSCREENINFO.
+	ctx->vInfo.xoffset = 0U;
+	ctx->vInfo.yoffset = yoffset;
+	LOG("Panned to yoffset %u", yoffset);
+
+	return EXIT_SUCCESS;
 }
+#endif    // FBINK_WITH_DRAW
 
-// Dump a specific rect of the fb (as-is)
 int
-    fbink_rect_dump(int fbfd                       UNUSED_BY_MINIMAL,
-		    const FBInkRect* restrict rect UNUSED_BY_MINIMAL,
-		    FBInkDump* restrict dump       UNUSED_BY_MINIMAL)
+    fbink_surface_alloc_ctx(FBInkContext* restrict ctx     UNUSED_BY_NODRAW,
+			    int fbfd                       UNUSED_BY_NODRAW,
+			    FBInkSurface* restrict surface UNUSED_BY_NODRAW)
 {
-#ifdef FBINK_WITH_IMAGE
-	// If no rect, or an empty rect was passed, fallback to a *full* dump.
-	if (!rect || (rect->width == 0U || rect->height == 0U)) {
-		WARN("Requested to dump an empty rect (or none at all), falling back to a full dump");
-		return fbink_dump(fbfd, dump);
+#ifdef FBINK_WITH_DRAW
+	if (surface->is_active) {
+		WARN("Cannot recycle an active surface");
+		return ERRCODE(EBUSY);
 	}
 
 	// Open the framebuffer if need be...
 	// NOTE: As usual, we *expect* to be initialized at this point!
 	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -12531,359 +15860,471 @@ int
 	int rv = EXIT_SUCCESS;
 
 	// mmap the fb if need be...
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
 	}
 
-	// Sanity check...
-	if ((rect->top + rect->height > vInfo.yres) || (rect->left + rect->width > vInfo.xres)) {
-		WARN("Requested to dump an OOB rect");
-		rv = ERRCODE(EINVAL);
-		goto cleanup;
+	// Recycle the struct if need be
+	if (surface->data) {
+		LOG("Recycling FBInkSurface!");
+		if (!is_surface_in_fb(surface)) {
+			free(surface->data);
+		}
+		memset(surface, 0, sizeof(*surface));
 	}
 
-	// Plain rect -> region mapping, we don't want any further rotation trickery here.
-	struct mxcfb_rect region = { .top = rect->top, .left = rect->left, .width = rect->width, .height = rect->height };
-
-	rv = dump_region(&region, dump);
+	// NOTE: We mirror the *full* mapping, as some drawing functions (e.g., clear_screen) may legitimately touch all of it.
+	const size_t size = get_fb_map_size(ctx);
+	surface->data     = malloc(size);
+	if (!surface->data) {
+		PFWARN("malloc: %m");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+	memcpy(surface->data, ctx->fbPtr, size);
+	surface->size   = size;
+	surface->stride = ctx->fInfo.line_length;
+	surface->bpp    = (uint8_t) ctx->vInfo.bits_per_pixel;
+	surface->rota   = (uint8_t) ctx->vInfo.rotate;
 
 	// Cleanup
 cleanup:
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
 #else
-	WARN("Image support is disabled in this FBInk build");
+	WARN("Drawing primitives are disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
-#endif    // FBINK_WITH_IMAGE
+#endif    // FBINK_WITH_DRAW
 }
 
-// Restore a fb dump
 int
-    fbink_restore(int fbfd                              UNUSED_BY_MINIMAL,
-		  const FBInkConfig* restrict fbink_cfg UNUSED_BY_MINIMAL,
-		  const FBInkDump* restrict dump        UNUSED_BY_MINIMAL)
+    fbink_surface_alloc(int fbfd, FBInkSurface* restrict surface)
 {
-#ifdef FBINK_WITH_IMAGE
-	// Open the framebuffer if need be...
-	// NOTE: As usual, we *expect* to be initialized at this point!
-	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
-		return ERRCODE(EXIT_FAILURE);
+	return fbink_surface_alloc_ctx(&defaultCtx, fbfd, surface);
+}
+
+int
+    fbink_surface_free(FBInkSurface* restrict surface UNUSED_BY_NODRAW)
+{
+#ifdef FBINK_WITH_DRAW
+	if (surface->is_active) {
+		WARN("Cannot free an active surface");
+		return ERRCODE(EBUSY);
 	}
 
-	// Assume success, until shit happens ;)
-	int rv = EXIT_SUCCESS;
+	if (surface->is_page) {
+		WARN("Virtual screen pages must be released via fbink_page_flip_free");
+		return ERRCODE(EINVAL);
+	}
 
-	// mmap the fb if need be...
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
-			rv = ERRCODE(EXIT_FAILURE);
-			goto cleanup;
+	if (surface->data) {
+		// NOTE: A hardware alternate buffer is part of the framebuffer mapping, there's nothing to free.
+		if (surface->phys_addr == 0U) {
+			free(surface->data);
 		}
+		memset(surface, 0, sizeof(*surface));
+
+		return EXIT_SUCCESS;
+	} else {
+		return ERRCODE(EINVAL);
+	}
+#else
+	WARN("Drawing primitives are disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_DRAW
+}
+
+int
+    fbink_surface_begin_ctx(FBInkContext* restrict ctx UNUSED_BY_NODRAW, FBInkSurface* restrict surface UNUSED_BY_NODRAW)
+{
+#ifdef FBINK_WITH_DRAW
+	if (!surface->data) {
+		WARN("Surface hasn't been allocated");
+		return ERRCODE(EINVAL);
+	}
+	if (ctx->activeSurface) {
+		WARN("Another surface is already active");
+		return ERRCODE(EBUSY);
+	}
+	if (is_surface_stale(ctx, surface)) {
+		WARN("Surface is stale (framebuffer layout has changed)");
+		return ERRCODE(ENOTSUP);
 	}
 
-	// Restore (if possible)
-	if (!dump->data) {
-		WARN("No dump data to restore");
-		rv = ERRCODE(EINVAL);
-		goto cleanup;
+	// Stash the actual mapping (if any), and make every drawing function target the surface instead
+	ctx->stashedFbPtr  = ctx->fbPtr;
+	ctx->isFbStashed   = ctx->isFbMapped;
+	ctx->fbPtr         = surface->data;
+	ctx->isFbMapped    = true;
+	ctx->activeSurface = surface;
+	surface->is_active = true;
+
+	return EXIT_SUCCESS;
+#else
+	WARN("Drawing primitives are disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_DRAW
+}
+
+int
+    fbink_surface_begin(FBInkSurface* restrict surface)
+{
+	return fbink_surface_begin_ctx(&defaultCtx, surface);
+}
+
+int
+    fbink_surface_end_ctx(FBInkContext* restrict ctx UNUSED_BY_NODRAW, FBInkSurface* restrict surface UNUSED_BY_NODRAW)
+{
+#ifdef FBINK_WITH_DRAW
+	if (!surface->is_active || surface != ctx->activeSurface) {
+		WARN("Surface isn't active");
+		return ERRCODE(EINVAL);
 	}
-	if (dump->rota != vInfo.rotate) {
-		WARN("Can't restore the dump because of a rotation mismatch! dump: %hhu (%s) vs. fb: %u (%s)",
-		     dump->rota,
-		     fb_rotate_to_string(dump->rota),
-		     vInfo.rotate,
-		     fb_rotate_to_string(vInfo.rotate));
-		rv = ERRCODE(ENOTSUP);
-		goto cleanup;
+
+	ctx->fbPtr         = ctx->stashedFbPtr;
+	ctx->isFbMapped    = ctx->isFbStashed;
+	ctx->stashedFbPtr  = NULL;
+	ctx->isFbStashed   = false;
+	ctx->activeSurface = NULL;
+	surface->is_active = false;
+
+	return EXIT_SUCCESS;
+#else
+	WARN("Drawing primitives are disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_DRAW
+}
+
+int
+    fbink_surface_end(FBInkSurface* restrict surface)
+{
+	return fbink_surface_end_ctx(&defaultCtx, surface);
+}
+
+int
+    fbink_surface_present_ctx(FBInkContext* restrict ctx UNUSED_BY_NODRAW,
+			      int fbfd                       UNUSED_BY_NODRAW,
+			      FBInkSurface* restrict surface UNUSED_BY_NODRAW,
+			      const FBInkConfig* restrict fbink_cfg UNUSED_BY_NODRAW)
+{
+#ifdef FBINK_WITH_DRAW
+	if (!surface->data) {
+		WARN("Surface hasn't been allocated");
+		return ERRCODE(EINVAL);
 	}
-	if (dump->bpp != vInfo.bits_per_pixel) {
-		WARN("Can't restore the dump because of a bitdepth mismatch! dump: %hhu vs. fb: %u",
-		     dump->bpp,
-		     vInfo.bits_per_pixel);
-		rv = ERRCODE(ENOTSUP);
-		goto cleanup;
+	if (surface->is_active) {
+		WARN("Cannot present an active surface");
+		return ERRCODE(EBUSY);
 	}
-	if (dump->area.width > vInfo.xres_virtual) {
-		WARN("Can't restore the dump because it's wider than the screen! dump: %hu vs. fb: %u",
-		     dump->area.width,
-		     vInfo.xres_virtual);
-		rv = ERRCODE(ENOTSUP);
-		goto cleanup;
+	if (is_surface_stale(ctx, surface)) {
+		WARN("Surface is stale (framebuffer layout has changed)");
+		return ERRCODE(ENOTSUP);
 	}
-	if (dump->area.height > vInfo.yres) {
-		WARN("Can't restore the dump because it's taller than the screen! dump: %hu vs. fb: %u",
-		     dump->area.height,
-		     vInfo.yres);
-		rv = ERRCODE(ENOTSUP);
-		goto cleanup;
+
+	// Nothing was drawn, nothing to do!
+	if (surface->damage.width == 0U || surface->damage.height == 0U) {
+		return EXIT_SUCCESS;
 	}
-	if (dump->size > fInfo.smem_len) {
-		WARN("Can't restore the dump because it's larger than the framebuffer! dump: %zu vs. fb: %u",
-		     dump->size,
-		     fInfo.smem_len);
-		rv = ERRCODE(ENOTSUP);
-		goto cleanup;
+
+	// Open the framebuffer if need be...
+	// NOTE: As usual, we *expect* to be initialized at this point!
+	bool keep_fd = true;
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
 	}
-	// Cropping related sanity checks...
-	if (dump->clip.width != 0U || dump->clip.height != 0U) {
-		if (dump->is_full) {
-			WARN("Can't crop a full-screen dump");
-			rv = ERRCODE(ENOTSUP);
-			goto cleanup;
-		}
-		if (dump->clip.width == 0U) {
-			WARN("Cropped width can't be zero");
-			rv = ERRCODE(ENOTSUP);
-			goto cleanup;
-		}
-		if (dump->clip.height == 0U) {
-			WARN("Cropped height can't be zero");
-			rv = ERRCODE(ENOTSUP);
-			goto cleanup;
-		}
-		if (dump->clip.width > vInfo.xres_virtual) {
-			WARN("Clip rectangle is wider than the screen! clip: %hu vs. fb: %u",
-			     dump->clip.width,
-			     vInfo.xres_virtual);
-			rv = ERRCODE(ENOTSUP);
-			goto cleanup;
-		}
-		if (dump->clip.height > vInfo.yres) {
-			WARN("Clip rectangle is taller than the screen! clip: %hu vs. fb: %u",
-			     dump->clip.height,
-			     vInfo.yres);
-			rv = ERRCODE(ENOTSUP);
-			goto cleanup;
-		}
-		if (dump->clip.left >= vInfo.xres) {
-			WARN("Clip rectangle's left edge is OOB! clip: %hu vs. fb: %u", dump->clip.left, vInfo.xres);
-			rv = ERRCODE(ENOTSUP);
-			goto cleanup;
-		}
-		if (dump->clip.top >= vInfo.yres) {
-			WARN("Clip rectangle's top edge is OOB! clip: %hu vs. fb: %u", dump->clip.top, vInfo.yres);
-			rv = ERRCODE(ENOTSUP);
-			goto cleanup;
-		}
-		// Overlap check (c.f., https://stackoverflow.com/q/306316)
-		if (!(dump->area.left < dump->clip.left + dump->clip.width)) {
-			WARN("Clip rectangle is outside the dumped area (on the left)");
-			rv = ERRCODE(ENOTSUP);
-			goto cleanup;
-		}
-		if (!(dump->area.left + dump->area.width > dump->clip.left)) {
-			WARN("Clip rectangle is outside the dumped area (on the right)");
-			rv = ERRCODE(ENOTSUP);
-			goto cleanup;
-		}
-		if (!(dump->area.top < dump->clip.top + dump->clip.height)) {
-			WARN("Clip rectangle is outside the dumped area (at the top)");
-			rv = ERRCODE(ENOTSUP);
-			goto cleanup;
-		}
-		if (!(dump->area.top + dump->area.height > dump->clip.top)) {
-			WARN("Clip rectangle is outside the dumped area (at the bottom)");
-			rv = ERRCODE(ENOTSUP);
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// mmap the fb if need be...
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
 	}
 
-	// We'll need a region...
-	struct mxcfb_rect region;
+	const struct mxcfb_rect region = {
+		.top    = surface->damage.top,
+		.left   = surface->damage.left,
+		.width  = surface->damage.width,
+		.height = surface->damage.height,
+	};
 
-	if (dump->is_full) {
-		// Full dump, easy enough
-		memcpy(fbPtr, dump->data, dump->size);
-		fullscreen_region(&region);
-	} else {
-		// NOTE: The crop codepath is perfectly safe with no cropping, it's just a little bit hairier to follow...
-		if (dump->clip.width == 0U && dump->clip.height == 0U) {
-			// Region dump, restore line by line
-			if (dump->bpp == 4U) {
-				for (unsigned short int j = dump->area.top, l = 0U; l < dump->area.height; j++, l++) {
-					size_t fb_offset   = (size_t) (dump->area.left >> 1U) + (j * fInfo.line_length);
-					size_t dump_offset = (size_t) (l * dump->stride);
-					memcpy(
-					    fbPtr + fb_offset, dump->data + dump_offset, (size_t) dump->area.width >> 1U);
-				}
-			} else {
-				// We're going to need the amount of bytes taken per pixel...
-				const uint8_t bpp = dump->bpp >> 3U;
-				for (unsigned short int j = dump->area.top, l = 0U; l < dump->area.height; j++, l++) {
-					size_t fb_offset   = (size_t) (dump->area.left * bpp) + (j * fInfo.line_length);
-					size_t dump_offset = (size_t) (l * dump->stride);
-					memcpy(
-					    fbPtr + fb_offset, dump->data + dump_offset, (size_t) dump->area.width * bpp);
-				}
-			}
-			region.left   = dump->area.left;
-			region.top    = dump->area.top;
-			region.width  = dump->area.width;
-			region.height = dump->area.height;
-		} else {
-			// Handle cropping shenanigans...
-			const unsigned short int x_skip = dump->clip.left > dump->area.left
-							      ? (unsigned short int) (dump->clip.left - dump->area.left)
-							      : 0U;
-			const unsigned short int x      = (unsigned short int) (dump->area.left + x_skip);
-			const unsigned short int y_skip =
-			    dump->clip.top > dump->area.top ? (unsigned short int) (dump->clip.top - dump->area.top) : 0U;
-			const unsigned short int y  = (unsigned short int) (dump->area.top + y_skip);
-			// NOTE: We only want to display the intersection between the full dump area and the clip rectangle...
-			//       The earlier overlap check should ensure the sanity of the resulting rectangle here.
-			//       c.f., https://stackoverflow.com/q/19753134
-			const unsigned short int x1 = (unsigned short int) MAX(dump->area.left, dump->clip.left);
-			const unsigned short int y1 = (unsigned short int) MAX(dump->area.top, dump->clip.top);
-			const unsigned short int x2 = (unsigned short int) MIN(dump->area.left + dump->area.width,
-									       dump->clip.left + dump->clip.width);
-			const unsigned short int y2 = (unsigned short int) MIN(dump->area.top + dump->area.height,
-									       dump->clip.top + dump->clip.height);
-			const unsigned short int w  = (unsigned short int) (x2 - x1);
-			const unsigned short int h  = (unsigned short int) (y2 - y1);
-			LOG("The dump area (%hu, %hu) %hux%hu",
-			    dump->area.left,
-			    dump->area.top,
-			    dump->area.width,
-			    dump->area.height);
-			LOG("and clip rectangle (%hu, %hu) %hux%hu",
-			    dump->clip.left,
-			    dump->clip.top,
-			    dump->clip.width,
-			    dump->clip.height);
-			LOG("intersect as (%hu, %hu, %hu, %hu) %hux%hu", x1, y1, x2, y2, w, h);
-			// Region dump, restore line by line
-			if (dump->bpp == 4U) {
-				for (unsigned short int j = y, l = 0U; l < h; j++, l++) {
-					size_t fb_offset   = (size_t) (x >> 1U) + (j * fInfo.line_length);
-					size_t dump_offset = (x_skip >> 1U) + ((size_t) (y_skip + l) * dump->stride);
-					memcpy(fbPtr + fb_offset, dump->data + dump_offset, (size_t) w >> 1U);
-				}
-			} else {
-				// We're going to need the amount of bytes taken per pixel...
-				const uint8_t bpp = dump->bpp >> 3U;
-				for (unsigned short int j = y, l = 0U; l < h; j++, l++) {
-					size_t fb_offset = (size_t) (x * bpp) + (j * fInfo.line_length);
-					size_t dump_offset =
-					    (size_t) (x_skip * bpp) + ((size_t) (y_skip + l) * dump->stride);
-					memcpy(fbPtr + fb_offset, dump->data + dump_offset, (size_t) w * bpp);
-				}
-			}
-			region.left   = x;
-			region.top    = y;
-			region.width  = w;
-			region.height = h;
+	if (surface->is_page) {
+		// Flip the pages: the one we've drawn to becomes the visible one.
+		// NOTE: The screen was showing the previous frame, which only differs from this one in the damaged area,
+		//       so that's still all we need to refresh.
+		rv = pan_display(ctx, fbfd, surface->data == ctx->fbPtr ? 0U : ctx->vInfo.yres);
+		if (rv != EXIT_SUCCESS) {
+			goto cleanup;
 		}
+	} else if (surface->phys_addr == 0U) {
+		copy_surface_damage(surface, ctx->fbPtr, surface->data);
 	}
 
-	// And now, we can refresh the screen
-	if (refresh(fbfd, region, fbink_cfg) != EXIT_SUCCESS) {
-		PFWARN("Failed to refresh the screen");
+#	ifndef FBINK_FOR_LINUX
+	// NOTE: Otherwise, it's a hardware alternate buffer: no copy needed, the EPDC will pull the data from it directly.
+	ctx->altBufferAddr = surface->phys_addr;
+#	endif
+	rv = refresh(ctx, fbfd, region, fbink_cfg);
+#	ifndef FBINK_FOR_LINUX
+	ctx->altBufferAddr = 0U;
+#	endif
+	if (rv != EXIT_SUCCESS) {
+		WARN("Failed to refresh the screen");
+	}
+
+	// Regardless of how the refresh went, the pages *have* been flipped: switch the surface to the now hidden one.
+	// It's one frame behind, so catch it up by copying what we've just drawn, so we can keep drawing on top of it.
+	if (surface->is_page) {
+		unsigned char* const front = surface->data;
+		surface->data              = front == ctx->fbPtr ? ctx->fbPtr + surface->size : ctx->fbPtr;
+		copy_surface_damage(surface, surface->data, front);
+		surface->damage = (FBInkRect){ 0U };
+	} else if (rv == EXIT_SUCCESS) {
+		surface->damage = (FBInkRect){ 0U };
 	}
 
 	// Cleanup
 cleanup:
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
 #else
-	WARN("Image support is disabled in this FBInk build");
+	WARN("Drawing primitives are disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
-#endif    // FBINK_WITH_IMAGE
+#endif    // FBINK_WITH_DRAW
 }
 
-// Explicitly frees the FBInkDump *data* allocated by fbink_dump & fbink_region_dump
 int
-    fbink_free_dump_data(FBInkDump* restrict dump UNUSED_BY_MINIMAL)
+    fbink_surface_present(int fbfd, FBInkSurface* restrict surface, const FBInkConfig* restrict fbink_cfg)
 {
-#ifdef FBINK_WITH_IMAGE
-	if (dump->data) {
-		free(dump->data);
-		// Clear the struct, both to clear the metadata, and to make sure not to leave a dangling pointer,
-		// ensuring a subsequent dump() won't try to recycle this struct again.
-		memset(dump, 0, sizeof(*dump));
+	return fbink_surface_present_ctx(&defaultCtx, fbfd, surface, fbink_cfg);
+}
 
-		return EXIT_SUCCESS;
-	} else {
+int
+    fbink_alt_buffer_alloc_ctx(FBInkContext* restrict ctx     __attribute__((unused)),
+			       int fbfd                       __attribute__((unused)),
+			       FBInkSurface* restrict surface __attribute__((unused)))
+{
+#ifdef FBINK_WITH_DRAW
+#	ifdef FBINK_FOR_LINUX
+	WARN("Hardware alternate buffers are not supported on this platform");
+	return ERRCODE(ENOSYS);
+#	else
+	// NOTE: Only devices with an i.MX EPDC support EPDC_FLAG_USE_ALT_BUFFER.
+	if (ctx->deviceQuirks.isKindleLegacy || ctx->deviceQuirks.isSunxi || ctx->deviceQuirks.isMTK) {
+		WARN("Hardware alternate buffers are not supported on this device");
+		return ERRCODE(ENOSYS);
+	}
+
+	// NOTE: The surface's data points inside our mapping, so it has to outlive this call.
+	if (fbfd == FBFD_AUTO) {
+		WARN("Hardware alternate buffers require a persistent framebuffer fd (c.f., fbink_open)");
 		return ERRCODE(EINVAL);
 	}
+	if (surface->is_active) {
+		WARN("Cannot recycle an active surface");
+		return ERRCODE(EBUSY);
+	}
+
+	const size_t offset = get_alt_buffer_offset(ctx);
+	if (offset == 0U) {
+		WARN("Not enough offscreen framebuffer memory for an alternate buffer (smem_len: %u vs. %ux%u @ %ubpp)",
+		     ctx->fInfo.smem_len,
+		     ctx->vInfo.xres_virtual,
+		     ctx->vInfo.yres_virtual,
+		     ctx->vInfo.bits_per_pixel);
+		return ERRCODE(ENOSPC);
+	}
+
+	// mmap the fb if need be...
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
+			return ERRCODE(EXIT_FAILURE);
+		}
+	}
+
+	// Recycle the struct if need be
+	if (surface->data) {
+		LOG("Recycling FBInkSurface!");
+		if (!is_surface_in_fb(surface)) {
+			free(surface->data);
+		}
+		memset(surface, 0, sizeof(*surface));
+	}
+
+	surface->data      = ctx->fbPtr + offset;
+	surface->size      = (size_t) ctx->fInfo.line_length * ctx->vInfo.yres;
+	surface->stride    = ctx->fInfo.line_length;
+	surface->bpp       = (uint8_t) ctx->vInfo.bits_per_pixel;
+	surface->rota      = (uint8_t) ctx->vInfo.rotate;
+	surface->phys_addr = (uint32_t) (ctx->fInfo.smem_start + offset);
+	LOG("Alternate buffer @ offset %zu (physical address: %#x)", offset, surface->phys_addr);
+
+	return EXIT_SUCCESS;
+#	endif    // FBINK_FOR_LINUX
 #else
-	WARN("Image support is disabled in this FBInk build");
+	WARN("Drawing primitives are disabled in this FBInk build");
 	return ERRCODE(ENOSYS);
-#endif    // FBINK_WITH_IMAGE
+#endif    // FBINK_WITH_DRAW
 }
 
-// Return a copy of the last drawn rectangle coordinates/dimensions
-FBInkRect
-    fbink_get_last_rect(bool rotated)
+int
+    fbink_alt_buffer_alloc(int fbfd, FBInkSurface* restrict surface)
 {
-	if (rotated) {
-		// I'm really glad I went with a different layout in FBInkRect there... >_<".
-		struct mxcfb_rect region = {
-			.top = lastRect.top, .left = lastRect.left, .width = lastRect.width, .height = lastRect.height
-		};
-		(*fxpRotateRegion)(&region);
-		FBInkRect rect = { .left   = (unsigned short int) region.left,
-				   .top    = (unsigned short int) region.top,
-				   .width  = (unsigned short int) region.width,
-				   .height = (unsigned short int) region.height };
-		return rect;
-	}
-	return lastRect;
+	return fbink_alt_buffer_alloc_ctx(&defaultCtx, fbfd, surface);
 }
 
-// Grants direct access to the backing buffer's pointer & size
-unsigned char*
-    fbink_get_fb_pointer(int fbfd, size_t* buffer_size)
+int
+    fbink_page_flip_alloc_ctx(FBInkContext* restrict ctx     UNUSED_BY_NODRAW,
+			      int fbfd                       UNUSED_BY_NODRAW,
+			      FBInkSurface* restrict surface UNUSED_BY_NODRAW)
 {
-	if (!deviceQuirks.skipId) {
-		PFWARN("FBInk hasn't been initialized yet");
-		goto failure;
+#ifdef FBINK_WITH_DRAW
+	// NOTE: einkfb doesn't do panning, and the sunxi & MTK framebuffers are... not exactly real framebuffers.
+	if (ctx->deviceQuirks.isKindleLegacy || ctx->deviceQuirks.isSunxi || ctx->deviceQuirks.isMTK) {
+		WARN("Page flipping is not supported on this device");
+		return ERRCODE(ENOSYS);
 	}
 
+	// NOTE: The surface's data points inside our mapping, and we'll need to pan, so we need a persistent fd.
 	if (fbfd == FBFD_AUTO) {
-		PFWARN("Requires a persistent backing buffer");
-		goto failure;
+		WARN("Page flipping requires a persistent framebuffer fd (c.f., fbink_open)");
+		return ERRCODE(EINVAL);
+	}
+	if (surface->is_active) {
+		WARN("Cannot recycle an active surface");
+		return ERRCODE(EBUSY);
 	}
 
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
-			goto failure;
+	const size_t page_size = (size_t) ctx->fInfo.line_length * ctx->vInfo.yres;
+	if (ctx->vInfo.yres_virtual < 2U * ctx->vInfo.yres || ctx->fInfo.smem_len < 2U * page_size) {
+		WARN("The virtual screen is too small for page flipping (%ux%u for a %ux%u screen)",
+		     ctx->vInfo.xres_virtual,
+		     ctx->vInfo.yres_virtual,
+		     ctx->vInfo.xres,
+		     ctx->vInfo.yres);
+		return ERRCODE(ENOSPC);
+	}
+	// NOTE: We only know how to deal with the two first pages.
+	if (ctx->vInfo.yoffset != 0U && ctx->vInfo.yoffset != ctx->vInfo.yres) {
+		WARN("Unexpected yoffset (%u)", ctx->vInfo.yoffset);
+		return ERRCODE(ENOTSUP);
+	}
+
+	// mmap the fb if need be...
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
+			return ERRCODE(EXIT_FAILURE);
 		}
 	}
 
-#ifdef FBINK_FOR_KOBO
-	*buffer_size = deviceQuirks.isSunxi ? sunxiCtx.alloc_size : fInfo.smem_len;
+	// Recycle the struct if need be
+	if (surface->data) {
+		LOG("Recycling FBInkSurface!");
+		if (!is_surface_in_fb(surface)) {
+			free(surface->data);
+		}
+		memset(surface, 0, sizeof(*surface));
+	}
+
+	// We draw to the hidden page, which starts out as a copy of the visible one.
+	unsigned char* const front = ctx->vInfo.yoffset == 0U ? ctx->fbPtr : ctx->fbPtr + page_size;
+	surface->data              = ctx->vInfo.yoffset == 0U ? ctx->fbPtr + page_size : ctx->fbPtr;
+	memcpy(surface->data, front, page_size);
+	surface->size    = page_size;
+	surface->stride  = ctx->fInfo.line_length;
+	surface->bpp     = (uint8_t) ctx->vInfo.bits_per_pixel;
+	surface->rota    = (uint8_t) ctx->vInfo.rotate;
+	surface->is_page = true;
+
+	return EXIT_SUCCESS;
 #else
-	*buffer_size = fInfo.smem_len;
-#endif
-	return fbPtr;
+	WARN("Drawing primitives are disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_DRAW
+}
 
-failure:
-	*buffer_size = 0U;
-	return NULL;
+int
+    fbink_page_flip_alloc(int fbfd, FBInkSurface* restrict surface)
+{
+	return fbink_page_flip_alloc_ctx(&defaultCtx, fbfd, surface);
+}
+
+int
+    fbink_page_flip_free_ctx(FBInkContext* restrict ctx     UNUSED_BY_NODRAW,
+			     int fbfd                       UNUSED_BY_NODRAW,
+			     FBInkSurface* restrict surface UNUSED_BY_NODRAW)
+{
+#ifdef FBINK_WITH_DRAW
+	if (!surface->is_page) {
+		WARN("Surface isn't a virtual screen page");
+		return ERRCODE(EINVAL);
+	}
+	if (surface->is_active) {
+		WARN("Cannot free an active surface");
+		return ERRCODE(EBUSY);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// If we're currently displaying the second page, move it back to the first one, where everything else expects it to be.
+	// NOTE: The content doesn't change, so there's no need to refresh anything.
+	if (ctx->vInfo.yoffset == ctx->vInfo.yres && ctx->isFbMapped) {
+		const size_t page_size = (size_t) ctx->fInfo.line_length * ctx->vInfo.yres;
+		memcpy(ctx->fbPtr, ctx->fbPtr + page_size, page_size);
+		rv = pan_display(ctx, fbfd, 0U);
+	}
+
+	memset(surface, 0, sizeof(*surface));
+
+	return rv;
+#else
+	WARN("Drawing primitives are disabled in this FBInk build");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_DRAW
+}
+
+int
+    fbink_page_flip_free(int fbfd, FBInkSurface* restrict surface)
+{
+	return fbink_page_flip_free_ctx(&defaultCtx, fbfd, surface);
+}
+
+FBInkContext*
+    fbink_ctx_new(void)
+{
+	FBInkContext* ctx = malloc(sizeof(*ctx));
+	if (!ctx) {
+		PFWARN("malloc: %m");
+		return NULL;
+	}
+	*ctx = (FBInkContext) FBINK_CTX_INITIALIZER;
+
+	return ctx;
 }
 
-// Returns a *full* copy of our internal framebuffer structs
 void
-    fbink_get_fb_info(struct fb_var_screeninfo* var_info, struct fb_fix_screeninfo* fix_info)
+    fbink_ctx_free(FBInkContext* ctx)
 {
-	*var_info = vInfo;
-	*fix_info = fInfo;
+	free(ctx);
 }
 
 // And now, we just bundle auxiliary parts of the public or private API,
@@ -12935,3 +16376,7 @@ void
 #include "fbink_rota_quirks.c"
 // Contains the input device scanner & classifier
 #include "fbink_input_scan.c"
+// Scanline pixel format converters for image processing
+#ifdef FBINK_WITH_IMAGE
+#	include "fbink_px_convert.c"
+#endif
@@ -67,6 +67,9 @@ extern "C" {
 // As 0 is an invalid marker value, we can coopt it to try to retrieve our own last sent marker
 #define LAST_MARKER 0U
 
+// Magic number for FBInkConfig's scaling_threads, to use one thread per online CPU core
+#define FBINK_SCALING_THREADS_AUTO 0xFFu
+
 // NOTE: There's a dirty bit of trickery involved here to coerce enums into a specific data type (instead of an int):
 //       * The packed attribute, which does locally what GCC's -fshort-enums does globally,
 //         ensuring the enum's data type is only as wide as the actual values require.
@@ -675,6 +678,20 @@ typedef struct
 	bool    is_animated;         // Enable refresh animation, following fbink_mtk_set_swipe_data (Kindle MTK only)
 	uint8_t saturation_boost;    // Boost image saturation, in %. Useful on Kaleido panels. Only affects 32bpp.
 	bool    to_syslog;           // Send messages & errors to the syslog instead of stdout/stderr
+	uint8_t scaling_threads;     // Amount of threads to use when scaling images (0 or 1 means single-threaded)
+	//			    FBINK_SCALING_THREADS_AUTO means one per online CPU core.
+	uint8_t cfa_gamma[3];        // Per-channel (R, G, B) gamma of color images, in hundredths (0 means none)
+	int8_t  cfa_contrast[3];     // Per-channel (R, G, B) contrast adjustment of color images, in % (0 means none)
+	//			    NOTE: Clamped to -100 (i.e., a flat gray).
+	bool    cfa_dithering;       // Request CFA-aware (ordered) *software* dithering of color images.
+	//			    Every channel uses a different phase of the dithering pattern,
+	//			    so that they don't all switch levels on the same pixels under the CFA.
+	//			    NOTE: These three are a preprocessing stage aimed at Kaleido panels,
+	//			          to compensate for the EPDC's own CFA post-process (c.f., cfa_mode)
+	//			          being skipped or too slow.
+	//			          Only affects 32bpp (in either pixel order), and the stage runs after saturation_boost.
+	//			          When any of them is set, this stage takes over sw_dithering, too,
+	//			          and the dithering happens *before* alpha blending & inversion.
 } FBInkConfig;
 
 // Same, but for OT/TTF specific stuff. MUST be zero-initialized.
@@ -741,14 +758,59 @@ typedef struct
 typedef struct
 {
 	unsigned char* restrict data;
-	size_t    stride;
-	size_t    size;
-	FBInkRect area;
-	FBInkRect clip;    // Only restore this rectangular area of the screen (has to intersect w/ the dump's area)
+	size_t              stride;
+	size_t              size;
+	FBInkRect           area;
+	FBInkRect           clip;    // Only restore this rectangular area of the screen (has to intersect w/ the dump's area)
+	uint8_t             rota;
+	uint8_t             bpp;
+	bool                is_full;
+	bool                is_compressed;    // Set by fbink_compress_dump (data is then *not* raw fb data anymore!)
+	FBINK_PXFMT_INDEX_T pixel_format;     // deviceQuirks.pixelFormat at dump time
+} FBInkDump;
+
+// Offscreen surface (c.f., fbink_surface_alloc)
+typedef struct
+{
+	unsigned char* restrict data;    // Pixel data, in the exact same format & layout as the framebuffer
+	size_t                  stride;
+	size_t                  size;
+	FBInkRect damage;    // What was drawn since the last present, in *physical* framebuffer coordinates (i.e., rotated)
 	uint8_t   rota;
 	uint8_t   bpp;
-	bool      is_full;
-} FBInkDump;
+	bool      is_active;    // Set between fbink_surface_begin & fbink_surface_end
+	uint32_t  phys_addr;    // Physical address of a hardware alternate buffer (c.f., fbink_alt_buffer_alloc), 0 otherwise
+	bool      is_page;      // Set for the hidden page of a virtual screen (c.f., fbink_page_flip_alloc)
+} FBInkSurface;
+
+// For use with fbink_print_thumbnails
+typedef struct
+{
+	const char* filename;    // Path to the image file (same formats as fbink_print_image, but *not* stdin)
+	FBInkRect   rect;        // Box the image is scaled to fit in (honoring its AR) & centered in, in viewport coordinates
+	bool        cache;       // Keep the scaled image around (in data), and reuse it on subsequent calls
+	// Everything below is set by fbink_print_thumbnails, and released by fbink_free_thumbnail_data
+	unsigned char* restrict data;    // Scaled pixel data (Y, YA or RGBA, depending on the fb & ignore_alpha)
+	unsigned short int      width;
+	unsigned short int      height;
+	uint8_t                 n;    // Components per pixel in data
+	bool                    has_alpha;
+	unsigned short int      box_width;     // rect.width when data was computed
+	unsigned short int      box_height;    // rect.height when data was computed
+} FBInkThumbnail;
+
+// Precomputed image scaling plan (c.f., fbink_scale_plan_alloc)
+typedef struct
+{
+	void*              scale_info;    // Consider it *private*: it's only used & memory managed by FBInk itself
+	void*              band;          // Ditto (scratch buffer for the scaled rows)
+	size_t             band_size;
+	int                w;             // Dimensions of the source images this plan applies to
+	int                h;
+	unsigned short int scaled_width;    // On-screen dimensions they're scaled to
+	unsigned short int scaled_height;
+	uint8_t            n;    // Components per pixel they're scaled in (depends on the fb & ignore_alpha)
+} FBInkScalePlan;
 
 //
 ////
@@ -1194,6 +1256,8 @@ FBINK_API int fbink_print_image(int         fbfd,
 //       If this is a concern to you, make sure your input buffer is formatted in a manner adapted to your output device:
 //       Generally, that'd be RGBA (32bpp) on Kobo (or RGB (24bpp) with ignore_alpha),
 //       and YA (grayscale + alpha) on Kindle (or Y (8bpp) with ignore_alpha).
+// NOTE: For packed, low bitdepth input (e.g., 1bpp masks), see fbink_print_packed_data instead.
+// NOTE: For input that's already in the framebuffer's pixel format, see fbink_print_native_data instead.
 FBINK_API int fbink_print_raw_data(int fbfd,
 				   const unsigned char* restrict data,
 				   const int    w,
@@ -1203,6 +1267,149 @@ FBINK_API int fbink_print_raw_data(int fbfd,
 				   short int    y_off,
 				   const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
 
+// Print packed, low bitdepth raw scanlines on screen (e.g., a 1bpp barcode or QR code mask).
+// Returns -(ENOSYS) when image support is disabled (MINIMAL build w/o IMAGE).
+// Returns -(EINVAL) on an unsupported bpp, invalid dimensions, or a stride too small for w.
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call.
+// data:		Pointer to a buffer holding the packed pixel data (most significant bits first,
+//				i.e., the top-left pixel lives in the high bits of the first byte, like in a PBM file).
+// w:			Width (in pixels) of a single scanline of the input data.
+// h:			Height (in pixels) of the full input data (i.e., amount of scanlines).
+// stride:		Size (in bytes) of a single scanline, including any padding.
+//				If set to 0, scanlines are assumed to be tightly packed (i.e., ceil(w * bpp / 8) bytes).
+// bpp:			Bitdepth of the input data (Supported values: 1, 2 & 4).
+// x_off:		Target coordinates, x (honors negative offsets).
+// y_off:		Target coordinates, y (honors negative offsets).
+// fbink_cfg:		Pointer to an FBInkConfig struct.
+//				Where positioning is concerned, honors any combination of halign/valign, row/col & x_off/y_off;
+//				honors fg_color & bg_color (or the pen colors set via fbink_set_*_pen_*),
+//				is_inverted, is_bgless & is_fgless, as well as the usual refresh-related fields.
+//				Ignores scaling, dithering & everything specifically concerned with text rendering.
+// NOTE: A value of 0 maps to the background pen, while a value with all its bits set maps to the foreground pen,
+//       (so, at 1bpp, set bits are printed in black with the default pens, again, like in a PBM file).
+//       At 2bpp & 4bpp, intermediate values are mapped to a linear ramp between the two pens.
+// NOTE: The data is expanded straight to the framebuffer's pixel format, without any intermediary buffer.
+FBINK_API int fbink_print_packed_data(int fbfd,
+				      const unsigned char* restrict data,
+				      const int     w,
+				      const int     h,
+				      const size_t  stride,
+				      const uint8_t bpp,
+				      short int     x_off,
+				      short int     y_off,
+				      const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+
+// Print raw scanlines that are *already* in the framebuffer's pixel format on screen, as-is.
+// Returns -(ENOSYS) when image support is disabled (MINIMAL build w/o IMAGE).
+// Returns -(EINVAL) when pixel_format doesn't match the framebuffer's, on invalid dimensions,
+// or on a stride too small for w.
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call.
+// data:		Pointer to a buffer holding the image data, in the framebuffer's pixel format
+//				(the first pixel should be the top-left of the image).
+// w:			Width (in pixels) of a single scanline of the input data.
+// h:			Height (in pixels) of the full input data (i.e., amount of scanlines).
+// stride:		Size (in bytes) of a single scanline, including any padding.
+//				If set to 0, scanlines are assumed to be tightly packed.
+// pixel_format:	Pixel format of the input data, *must* match the framebuffer's (c.f., FBInkState's pixel_format).
+//				At 4bpp, the leftmost pixel of a byte lives in the high nibble, like in the fb itself.
+// x_off:		Target coordinates, x (honors negative offsets).
+// y_off:		Target coordinates, y (honors negative offsets).
+// fbink_cfg:		Pointer to an FBInkConfig struct.
+//				Where positioning is concerned, honors any combination of halign/valign, row/col & x_off/y_off;
+//				honors is_cleared, as well as the usual refresh-related fields.
+//				Ignores is_inverted, alpha handling, scaling, dithering & saturation_boost:
+//				the data is copied verbatim.
+// NOTE: The input is not rotated, it's expected to be in the same orientation as the *screen*
+//       (i.e., as in FBInkState's screen_width & screen_height), like in every other function.
+//       If the framebuffer doesn't require any rotation tweaks on our end, this boils down to a clipped memcpy per scanline,
+//       which makes it the fastest way to get pixels on screen by far.
+//       Otherwise, it's still a straight pixel copy, just a rotated one.
+FBINK_API int fbink_print_native_data(int fbfd,
+				      const unsigned char* restrict data,
+				      const int           w,
+				      const int           h,
+				      const size_t        stride,
+				      FBINK_PXFMT_INDEX_T pixel_format,
+				      short int           x_off,
+				      short int           y_off,
+				      const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+
+// Print a batch of images (e.g., cover thumbnails in a library view) on screen, with a single refresh.
+// Returns -(ENOSYS) when image support is disabled (MINIMAL build w/o IMAGE).
+// Returns -(EINVAL) when count is 0.
+// Otherwise, if some of the images couldn't be decoded, the others are still printed, and -(EXIT_FAILURE) is returned.
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call.
+// thumbs:		Pointer to an array of FBInkThumbnail structs (as with all FBInk structs, zero-initialize them!).
+// count:		Amount of FBInkThumbnail structs in thumbs.
+// fbink_cfg:		Pointer to an FBInkConfig struct.
+//				Ignores row/col, halign/valign & scaled_width/scaled_height, as each thumbnail's rect dictates those.
+//				Otherwise, honors the same fields as fbink_print_image, scaling_threads included.
+// NOTE: Images are decoded & scaled in parallel (across scaling_threads workers),
+//       then blitted in array order (so, later entries end up on top of earlier ones, should their rects overlap),
+//       and the union of their rects is refreshed in one go.
+// NOTE: If cache is set, the scaled pixels are kept in the FBInkThumbnail struct,
+//       and subsequent calls will skip the decoding & scaling steps entirely, as long as rect's dimensions
+//       and the pixel format still match (moving the thumbnail around is fine).
+//       That means FBInk can't tell if the file itself has changed: call fbink_free_thumbnail_data if it has.
+//       You *MUST* release a cached thumbnail via fbink_free_thumbnail_data when you're done with it.
+// NOTE: Much like in fbink_print_image, JPEGs much larger than their rect are decoded at a reduced resolution.
+FBINK_API int fbink_print_thumbnails(int fbfd,
+				     FBInkThumbnail* restrict thumbs,
+				     size_t                   count,
+				     const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+
+// Free the scaled pixels cached in an FBInkThumbnail by fbink_print_thumbnails.
+// Returns -(ENOSYS) when image support is disabled (MINIMAL build w/o IMAGE).
+// Returns -(EINVAL) when there's nothing to free.
+// thumb:		Pointer to an FBInkThumbnail struct (filename, rect & cache are left untouched).
+FBINK_API int fbink_free_thumbnail_data(FBInkThumbnail* restrict thumb) __attribute__((nonnull));
+
+// Precompute everything needed to scale w x h images to the on-screen size requested by fbink_cfg,
+// so that it can be reused across fbink_print_image_planned & fbink_print_raw_data_planned calls
+// (e.g., for the frames of a slideshow or an animation), instead of being recomputed on every call.
+// Returns -(ENOSYS) when image support is disabled (MINIMAL build w/o IMAGE).
+// Returns -(EINVAL) on invalid dimensions, or when fbink_cfg doesn't request any scaling.
+// w:			Width (in pixels) of the source images.
+// h:			Height (in pixels) of the source images.
+// fbink_cfg:		Pointer to an FBInkConfig struct
+//			(honors scaled_width, scaled_height, ignore_alpha & scaling_threads).
+// plan:		Pointer to an FBInkScalePlan struct (will be recycled if already used).
+// NOTE: Much like with FBInkDump, you *MUST* release it via fbink_scale_plan_free when you're done with it.
+// NOTE: A plan also holds the scratch buffer the scaling goes through, so that planned draws don't allocate anything.
+//       This means a single plan *MUST NOT* be used by concurrent draws (use one plan per thread instead).
+// NOTE: A plan is tied to the framebuffer layout at allocation time: if it changes (e.g., after an effective fbink_reinit),
+//       or if the images you print don't match it, it's simply ignored (i.e., the scaling is computed from scratch).
+FBINK_API int fbink_scale_plan_alloc(int w, int h, const FBInkConfig* restrict fbink_cfg, FBInkScalePlan* restrict plan)
+    __attribute__((nonnull));
+
+// Release the data of a scaling plan.
+// Returns -(ENOSYS) when image support is disabled (MINIMAL build w/o IMAGE).
+// Returns -(EINVAL) when there's nothing to free.
+FBINK_API int fbink_scale_plan_free(FBInkScalePlan* restrict plan) __attribute__((nonnull));
+
+// Same as fbink_print_image & fbink_print_raw_data, but scale via a precomputed plan (c.f., fbink_scale_plan_alloc).
+// plan:		Pointer to an FBInkScalePlan struct, as set by fbink_scale_plan_alloc with the same fbink_cfg.
+// NOTE: JPEGs much larger than their on-screen size are decoded at a reduced resolution (c.f., fbink_print_image),
+//       in which case the plan will only match if it was computed for that reduced resolution.
+FBINK_API int fbink_print_image_planned(int         fbfd,
+					const char* filename,
+					short int   x_off,
+					short int   y_off,
+					const FBInkConfig* restrict fbink_cfg,
+					const FBInkScalePlan* restrict plan) __attribute__((nonnull));
+FBINK_API int fbink_print_raw_data_planned(int fbfd,
+					   const unsigned char* restrict data,
+					   const int    w,
+					   const int    h,
+					   const size_t len,
+					   short int    x_off,
+					   short int    y_off,
+					   const FBInkConfig* restrict fbink_cfg,
+					   const FBInkScalePlan* restrict plan) __attribute__((nonnull));
+
 //
 // Just clear the screen (or a region of it), using the background pen color, eInk refresh included (or not ;)).
 // Returns -(ENOSYS) when drawing primitives are disabled (MINIMAL build w/o DRAW).
@@ -1310,7 +1517,7 @@ FBINK_API int fbink_rect_dump(int fbfd, const FBInkRect* restrict rect, FBInkDum
 // Restore a framebuffer dump made by fbink_dump/fbink_region_dump/fbink_rect_dump.
 // Returns -(ENOSYS) when image support is disabled (MINIMAL build w/o IMAGE).
 // Otherwise, returns a few different things on failure:
-//	-(ENOTSUP)	when the dump cannot be restored because it wasn't taken at the current bitdepth and/or rotation,
+//	-(ENOTSUP)	when the dump cannot be restored because it would require a conversion from/to 4bpp,
 //			or because it's wider/taller/larger than the current framebuffer, or if the crop is invalid (OOB).
 //	-(EINVAL)	when there's no data to restore.
 // fbfd:		Open file descriptor to the framebuffer character device,
@@ -1326,8 +1533,15 @@ FBINK_API int fbink_rect_dump(int fbfd, const FBInkRect* restrict rect, FBInkDum
 //       At most common bitdepths, you can somewhat work around these restrictions, obviously at a performance premium,
 //       by using fbink_print_raw_data instead (see the relevant notes for fbink_dump), with a few quirky caveats...
 //       c.f., the last few tests in utils/dump.c for highly convoluted examples that I don't recommend replicating in production.
+// NOTE: If the dump wasn't taken at the current bitdepth, pixel format and/or rotation,
+//       it will be converted on the fly (8, 16, 24 & 32bpp are supported, 4bpp isn't).
+//       A rotated dump is rotated so that it shows up the same way it did on the physical panel when it was taken,
+//       i.e., regional dumps end up at the matching (rotated) coordinates.
+//       This is obviously slower than a straight copy, but still much cheaper than re-rendering complex content ;).
+//       Note that in this case, only the visible part of the dump is restored (i.e., scanline padding is skipped),
+//       and the clip rectangle is expected in the *current* screen coordinates (as usual).
 // NOTE: "current" actually means "at last init/reinit time".
-//       Call fbink_reinit first if you really want to make sure bitdepth/rotation still match.
+//       Call fbink_reinit first if you really want to make sure bitdepth/rotation are up to date.
 // NOTE: If you need to restore only part of a dump, you can do so via the clip field of the FBInkDump struct.
 //       This FBInkRect is the only field you should ever modify yourself.
 //       This clip rectangle is relative to the *screen*, not the dump's area (i.e., these are absolute screen coordinates).
@@ -1349,6 +1563,125 @@ FBINK_API int fbink_restore(int fbfd, const FBInkConfig* restrict fbink_cfg, con
 //       as dump() will implicitly free a dirty struct in order to recycle it.
 FBINK_API int fbink_free_dump_data(FBInkDump* restrict dump) __attribute__((nonnull));
 
+// Compress the data of a dump made by fbink_dump/fbink_region_dump/fbink_rect_dump, in place.
+// Returns -(ENOSYS) when image support is disabled (MINIMAL build w/o IMAGE).
+// Otherwise, returns a few different things on failure:
+//	-(EINVAL)	when there's no dump data to compress, or if it's already compressed.
+//	-(ENODATA)	when compression wouldn't actually save any memory (the dump is left untouched in this case).
+// dump:		Pointer to an FBInkDump struct, as setup by fbink_dump or fbink_region_dump.
+// NOTE: This is aimed at keeping a few long-lived snapshots around without eating through our meager RAM:
+//       each scanline is run-length encoded on a per-pixel basis, which works out pretty well for typical eInk content
+//       (i.e., mostly white, with large flat areas).
+//       A full 32bpp dump of a mostly blank screen will usually shrink by two orders of magnitude ;).
+// NOTE: Memory usage will temporarily peak at a bit more than twice the size of the raw dump during the conversion.
+// NOTE: fbink_restore handles compressed dumps transparently (including clipping),
+//       by decompressing each scanline straight into the framebuffer, without any intermediate buffer.
+//       Moving the dump's area at restore time (c.f., utils/dump.c) still works, too.
+// NOTE: On the other hand, the data is obviously no longer valid input for fbink_print_raw_data!
+// NOTE: The usual memory management rules still apply: fbink_free_dump_data will release it, and a recycling will reset it.
+FBINK_API int fbink_compress_dump(FBInkDump* restrict dump) __attribute__((nonnull));
+
+// Allocate an offscreen surface, i.e., a private buffer with the exact same format & layout as the framebuffer.
+// It starts out as a copy of the framebuffer's current content.
+// Returns -(ENOSYS) when drawing primitives are disabled (MINIMAL build w/o DRAW).
+// Returns -(EBUSY) when trying to recycle an active surface.
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call.
+// surface:		Pointer to an FBInkSurface struct (will be recycled if already used).
+// NOTE: Much like with FBInkDump, you *MUST* release it via fbink_surface_free when you're done with it.
+//       The easiest way to make sure you don't trip on a recycled struct is to zero-initialize it.
+// NOTE: A surface is tied to the framebuffer layout at allocation time: if it changes (e.g., after an effective fbink_reinit),
+//       the surface becomes stale, and you'll need to allocate a new one.
+FBINK_API int fbink_surface_alloc(int fbfd, FBInkSurface* restrict surface) __attribute__((nonnull));
+
+// Release the data buffer of an offscreen surface.
+// Returns -(ENOSYS) when drawing primitives are disabled (MINIMAL build w/o DRAW).
+// Returns -(EINVAL) when there's no data to free, or for a virtual screen page (use fbink_page_flip_free instead).
+// Returns -(EBUSY) when the surface is active.
+FBINK_API int fbink_surface_free(FBInkSurface* restrict surface) __attribute__((nonnull));
+
+// Redirect *every* drawing function (print*, image, raw data, cls, fill, restore, ...) to an offscreen surface.
+// No refreshes will happen until the surface is presented: they're accumulated in the surface's damage rectangle instead.
+// Returns -(ENOSYS) when drawing primitives are disabled (MINIMAL build w/o DRAW).
+// Returns -(EINVAL) when the surface hasn't been allocated.
+// Returns -(EBUSY) when a surface is already active.
+// Returns -(ENOTSUP) when the surface is stale (i.e., the framebuffer layout has changed since its allocation).
+// surface:		Pointer to an FBInkSurface struct, as set by fbink_surface_alloc.
+// NOTE: Don't call fbink_reinit/fbink_init while a surface is active!
+FBINK_API int fbink_surface_begin(FBInkSurface* restrict surface) __attribute__((nonnull));
+
+// Stop drawing to an offscreen surface, and go back to drawing to the framebuffer directly.
+// Returns -(ENOSYS) when drawing primitives are disabled (MINIMAL build w/o DRAW).
+// Returns -(EINVAL) when the surface isn't the active one.
+FBINK_API int fbink_surface_end(FBInkSurface* restrict surface) __attribute__((nonnull));
+
+// Copy the damaged area of an offscreen surface to the framebuffer, and refresh it, in one go.
+// Returns -(ENOSYS) when drawing primitives are disabled (MINIMAL build w/o DRAW).
+// Returns -(EINVAL) when the surface hasn't been allocated.
+// Returns -(EBUSY) when the surface is still active (i.e., call fbink_surface_end first).
+// Returns -(ENOTSUP) when the surface is stale (i.e., the framebuffer layout has changed since its allocation).
+// fbfd:		Open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call.
+// surface:		Pointer to an FBInkSurface struct, as set by fbink_surface_alloc.
+// fbink_cfg:		Pointer to an FBInkConfig struct (honors any of the refresh-related flags, e.g., wfm_mode, is_flashing, no_refresh).
+// NOTE: The damage rectangle is reset on success. If it's empty, this is a no-op.
+// NOTE: The surface keeps its content, so you can keep drawing on top of it for the next frame.
+// NOTE: For a hardware alternate buffer (c.f., fbink_alt_buffer_alloc), nothing is copied:
+//       the EPDC is asked to update the damaged area straight from the alternate buffer instead.
+// NOTE: For a virtual screen page (c.f., fbink_page_flip_alloc), the display is panned to it, and the damaged area refreshed.
+//       The surface then switches to the *other* page (which only the damaged area is copied to, to catch it up).
+FBINK_API int fbink_surface_present(int fbfd, FBInkSurface* restrict surface, const FBInkConfig* restrict fbink_cfg)
+    __attribute__((nonnull));
+
+// Setup a hardware alternate buffer, i.e., an offscreen surface that lives in the *offscreen* part of the framebuffer memory,
+// and that the EPDC can refresh the screen from directly (c.f., EPDC_FLAG_USE_ALT_BUFFER).
+// Once that's done, it behaves like any other FBInkSurface (i.e., fbink_surface_begin, fbink_surface_end & fbink_surface_present),
+// except that presenting it is essentially free, since nothing needs to be copied to the front buffer.
+// Returns -(ENOSYS) when drawing primitives are disabled (MINIMAL build w/o DRAW),
+// or when the platform/device doesn't support alternate buffers (i.e., anything without an i.MX EPDC, Kindle legacy einkfb).
+// Returns -(EINVAL) when fbfd is FBFD_AUTO.
+// Returns -(EBUSY) when trying to recycle an active surface.
+// Returns -(ENOSPC) when there isn't enough offscreen memory for a full screen's worth of data.
+// fbfd:		Open file descriptor to the framebuffer character device (i.e., *NOT* FBFD_AUTO, the mapping has to outlive this call).
+// surface:		Pointer to an FBInkSurface struct (will be recycled if already used).
+// NOTE: We try the memory past yres_virtual first, and then the second page of the virtual screen (if yres_virtual >= 2 * yres).
+//       In practice, that means it'll generally only be possible @ 8bpp.
+// NOTE: Unlike with fbink_surface_alloc, its initial content is whatever happened to be in that memory region,
+//       and it's only valid until fbink_close (or an effective fbink_reinit), after which it becomes stale.
+//       You *MUST* still release it via fbink_surface_free, though.
+// NOTE: Once it has been presented, the screen no longer matches the front buffer!
+//       Any subsequent refresh of the front buffer will show the front buffer's content in that region again.
+// NOTE: A full-screen clear of the front buffer @ 8bpp *may* clobber the alternate buffer (it memsets all of smem_len).
+FBINK_API int fbink_alt_buffer_alloc(int fbfd, FBInkSurface* restrict surface) __attribute__((nonnull));
+
+// Setup page flipping, i.e., an offscreen surface that lives in the hidden page of a virtual screen at least twice as tall
+// as the visible one (yres_virtual >= 2 * yres), and that gets flipped to the visible page with FBIOPAN_DISPLAY on present.
+// Once that's done, it behaves like any other FBInkSurface (i.e., fbink_surface_begin, fbink_surface_end & fbink_surface_present),
+// except that presenting it is an atomic full-screen update, and it only has to copy the damaged area (to the new hidden page).
+// It starts out as a copy of the visible page.
+// Returns -(ENOSYS) when drawing primitives are disabled (MINIMAL build w/o DRAW),
+// or when the device doesn't support panning (Kindle legacy einkfb, sunxi & MTK devices).
+// Returns -(EINVAL) when fbfd is FBFD_AUTO.
+// Returns -(EBUSY) when trying to recycle an active surface.
+// Returns -(ENOSPC) when the virtual screen isn't tall enough.
+// Returns -(ENOTSUP) when the display is panned to an unexpected yoffset.
+// fbfd:		Open file descriptor to the framebuffer character device (i.e., *NOT* FBFD_AUTO, the mapping has to outlive this call).
+// surface:		Pointer to an FBInkSurface struct (will be recycled if already used).
+// NOTE: Once it has been presented, the visible page may be the *second* one:
+//       drawing without the surface (i.e., outside of fbink_surface_begin/fbink_surface_end) will then target the hidden page!
+// NOTE: This is mutually exclusive with a hardware alternate buffer that lives in the second page of the virtual screen.
+// NOTE: It's only valid until fbink_close (or an effective fbink_reinit), after which it becomes stale.
+FBINK_API int fbink_page_flip_alloc(int fbfd, FBInkSurface* restrict surface) __attribute__((nonnull));
+
+// Release a virtual screen page setup by fbink_page_flip_alloc.
+// If need be, the content of the visible page is moved back to the first page, and the display panned back to it.
+// Returns -(ENOSYS) when drawing primitives are disabled (MINIMAL build w/o DRAW).
+// Returns -(EINVAL) when the surface isn't a virtual screen page.
+// Returns -(EBUSY) when the surface is active.
+// fbfd:		Open file descriptor to the framebuffer character device, the same one that was passed to fbink_page_flip_alloc.
+// surface:		Pointer to an FBInkSurface struct, as set by fbink_page_flip_alloc.
+FBINK_API int fbink_page_flip_free(int fbfd, FBInkSurface* restrict surface) __attribute__((nonnull));
+
 //
 // Return the coordinates & dimensions of the last thing that was *drawn*.
 // Returns an empty (i.e., {0, 0, 0, 0}) rectangle if nothing was drawn.
@@ -1781,6 +2114,338 @@ FBINK_API FBInkInputDevice* fbink_input_check(const char*           filepath,
 					      INPUT_DEVICE_TYPE_T   match_types,
 					      INPUT_DEVICE_TYPE_T   exclude_types,
 					      INPUT_SETTINGS_TYPE_T settings);
+
+//
+// The functions below are context-aware variants of the stateful API above:
+// each of them takes an explicit FBInkContext as its first argument, and otherwise behaves *exactly* like its namesake,
+// see their documentation for the details.
+// In fact, the regular API simply uses a default context, private to FBInk.
+// A context holds *all* of FBInk's state
+// (framebuffer info & mmap, device quirks, font settings, pen colors, OpenType fonts, last rect & marker, etc.).
+// NOTE: Different contexts share nothing, so calls made on *different* contexts can safely be made from different threads
+//       (e.g., to handle two different framebuffers).
+//       Using the *same* context (including the default one) from multiple threads still requires your own locking.
+// NOTE: The logging settings (i.e., fbink_update_verbosity) are process-wide.
+// NOTE: Stateless functions (e.g., fbink_version, fbink_free_dump_data or fbink_scale_plan_free) have no such variant,
+//       and neither do the deprecated fbink_is_fb_quirky & fbink_button_scan (which only ever use the default context).
+//
+
+// Opaque handle to one such context.
+typedef struct FBInkContext FBInkContext;
+
+// Allocate a new, pristine context.
+// Returns NULL on failure (OOM).
+FBINK_API FBInkContext* fbink_ctx_new(void);
+
+// Release a context.
+// NOTE: This will *NOT* call fbink_close_ctx nor fbink_free_ot_fonts_ctx for you, make sure you do that beforehand.
+// NOTE: This is safe to call with a NULL pointer.
+FBINK_API void fbink_ctx_free(FBInkContext* ctx);
+
+FBINK_API int  fbink_open_ctx(FBInkContext* restrict ctx) __attribute__((nonnull(1)));
+FBINK_API int  fbink_close_ctx(FBInkContext* restrict ctx, int fbfd) __attribute__((nonnull(1)));
+FBINK_API int  fbink_init_ctx(FBInkContext* restrict ctx, int fbfd, const FBInkConfig* restrict fbink_cfg)
+    __attribute__((nonnull));
+FBINK_API void fbink_state_dump_ctx(FBInkContext* restrict ctx, const FBInkConfig* restrict fbink_cfg)
+    __attribute__((nonnull));
+FBINK_API void fbink_get_state_ctx(FBInkContext* restrict ctx,
+				   const FBInkConfig* restrict fbink_cfg,
+				   FBInkState* restrict fbink_state) __attribute__((nonnull));
+
+FBINK_API int fbink_print_ctx(FBInkContext* restrict ctx,
+			      int fbfd,
+			      const char* restrict string,
+			      const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+FBINK_API int fbink_add_ot_font_ctx(FBInkContext* restrict ctx, const char* filename, FONT_STYLE_T style)
+    __attribute__((nonnull));
+FBINK_API int fbink_add_ot_font_v2_ctx(FBInkContext* restrict ctx,
+				       const char*  filename,
+				       FONT_STYLE_T style,
+				       FBInkOTConfig* restrict cfg) __attribute__((nonnull));
+FBINK_API int fbink_free_ot_fonts_ctx(FBInkContext* restrict ctx) __attribute__((nonnull(1)));
+FBINK_API int fbink_print_ot_ctx(FBInkContext* restrict ctx,
+				 int fbfd,
+				 const char* restrict string,
+				 const FBInkOTConfig* restrict cfg,
+				 const FBInkConfig* restrict fbink_cfg,
+				 FBInkOTFit* restrict fit) __attribute__((nonnull(1, 3)));
+FBINK_API int fbink_printf_ctx(FBInkContext* restrict ctx,
+			       int fbfd,
+			       const FBInkOTConfig* restrict ot_cfg,
+			       const FBInkConfig* restrict fbink_cfg,
+			       FBInkOTFit* restrict ot_fit,
+			       const char* fmt,
+			       ...) __attribute__((nonnull(1), format(printf, 6, 7)));
+
+FBINK_API int      fbink_refresh_ctx(FBInkContext* restrict ctx,
+				     int      fbfd,
+				     uint32_t region_top,
+				     uint32_t region_left,
+				     uint32_t region_width,
+				     uint32_t region_height,
+				     const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+FBINK_API int      fbink_refresh_rect_ctx(FBInkContext* restrict ctx,
+					  int fbfd,
+					  const FBInkRect* restrict rect,
+					  const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+FBINK_API int      fbink_wait_for_submission_ctx(FBInkContext* restrict ctx, int fbfd, uint32_t marker)
+    __attribute__((nonnull(1)));
+FBINK_API int      fbink_wait_for_complete_ctx(FBInkContext* restrict ctx, int fbfd, uint32_t marker)
+    __attribute__((nonnull(1)));
+FBINK_API uint32_t fbink_get_last_marker_ctx(FBInkContext* restrict ctx) __attribute__((nonnull(1)));
+
+FBINK_API int fbink_reinit_ctx(FBInkContext* restrict ctx, int fbfd, const FBInkConfig* restrict fbink_cfg)
+    __attribute__((warn_unused_result, nonnull));
+FBINK_API int fbink_update_pen_colors_ctx(FBInkContext* restrict ctx, const FBInkConfig* restrict fbink_cfg)
+    __attribute__((nonnull));
+FBINK_API int fbink_set_fg_pen_gray_ctx(FBInkContext* restrict ctx, uint8_t y, bool quantize, bool update)
+    __attribute__((nonnull(1)));
+FBINK_API int fbink_set_bg_pen_gray_ctx(FBInkContext* restrict ctx, uint8_t y, bool quantize, bool update)
+    __attribute__((nonnull(1)));
+FBINK_API int fbink_set_fg_pen_rgba_ctx(FBInkContext* restrict ctx,
+					uint8_t r,
+					uint8_t g,
+					uint8_t b,
+					uint8_t a,
+					bool    quantize,
+					bool    update) __attribute__((nonnull(1)));
+FBINK_API int fbink_set_bg_pen_rgba_ctx(FBInkContext* restrict ctx,
+					uint8_t r,
+					uint8_t g,
+					uint8_t b,
+					uint8_t a,
+					bool    quantize,
+					bool    update) __attribute__((nonnull(1)));
+
+FBINK_API int fbink_print_progress_bar_ctx(FBInkContext* restrict ctx,
+					   int     fbfd,
+					   uint8_t percentage,
+					   const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+FBINK_API int fbink_print_activity_bar_ctx(FBInkContext* restrict ctx,
+					   int     fbfd,
+					   uint8_t progress,
+					   const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+FBINK_API int fbink_print_image_ctx(FBInkContext* restrict ctx,
+				    int         fbfd,
+				    const char* filename,
+				    short int   x_off,
+				    short int   y_off,
+				    const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+FBINK_API int fbink_print_raw_data_ctx(FBInkContext* restrict ctx,
+				       int fbfd,
+				       const unsigned char* restrict data,
+				       const int    w,
+				       const int    h,
+				       const size_t len,
+				       short int    x_off,
+				       short int    y_off,
+				       const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+FBINK_API int fbink_print_packed_data_ctx(FBInkContext* restrict ctx,
+					  int fbfd,
+					  const unsigned char* restrict data,
+					  const int     w,
+					  const int     h,
+					  const size_t  stride,
+					  const uint8_t bpp,
+					  short int     x_off,
+					  short int     y_off,
+					  const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+FBINK_API int fbink_print_native_data_ctx(FBInkContext* restrict ctx,
+					  int fbfd,
+					  const unsigned char* restrict data,
+					  const int           w,
+					  const int           h,
+					  const size_t        stride,
+					  FBINK_PXFMT_INDEX_T pixel_format,
+					  short int           x_off,
+					  short int           y_off,
+					  const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+FBINK_API int fbink_print_thumbnails_ctx(FBInkContext* restrict ctx,
+					 int fbfd,
+					 FBInkThumbnail* restrict thumbs,
+					 size_t count,
+					 const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+FBINK_API int fbink_scale_plan_alloc_ctx(FBInkContext* restrict ctx,
+					 int w,
+					 int h,
+					 const FBInkConfig* restrict fbink_cfg,
+					 FBInkScalePlan* restrict plan) __attribute__((nonnull));
+FBINK_API int fbink_print_image_planned_ctx(FBInkContext* restrict ctx,
+					    int         fbfd,
+					    const char* filename,
+					    short int   x_off,
+					    short int   y_off,
+					    const FBInkConfig* restrict fbink_cfg,
+					    const FBInkScalePlan* restrict plan) __attribute__((nonnull));
+FBINK_API int fbink_print_raw_data_planned_ctx(FBInkContext* restrict ctx,
+					       int fbfd,
+					       const unsigned char* restrict data,
+					       const int    w,
+					       const int    h,
+					       const size_t len,
+					       short int    x_off,
+					       short int    y_off,
+					       const FBInkConfig* restrict fbink_cfg,
+					       const FBInkScalePlan* restrict plan) __attribute__((nonnull));
+
+FBINK_API int fbink_cls_ctx(FBInkContext* restrict ctx,
+			    int fbfd,
+			    const FBInkConfig* restrict fbink_cfg,
+			    const FBInkRect* restrict rect,
+			    bool no_rota) __attribute__((nonnull(1, 3)));
+FBINK_API int fbink_grid_clear_ctx(FBInkContext* restrict ctx,
+				   int                fbfd,
+				   unsigned short int cols,
+				   unsigned short int rows,
+				   const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+FBINK_API int fbink_grid_refresh_ctx(FBInkContext* restrict ctx,
+				     int                fbfd,
+				     unsigned short int cols,
+				     unsigned short int rows,
+				     const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+
+FBINK_API int fbink_dump_ctx(FBInkContext* restrict ctx, int fbfd, FBInkDump* restrict dump) __attribute__((nonnull));
+FBINK_API int fbink_region_dump_ctx(FBInkContext* restrict ctx,
+				    int                fbfd,
+				    short int          x_off,
+				    short int          y_off,
+				    unsigned short int w,
+				    unsigned short int h,
+				    const FBInkConfig* restrict fbink_cfg,
+				    FBInkDump* restrict dump) __attribute__((nonnull));
+FBINK_API int fbink_rect_dump_ctx(FBInkContext* restrict ctx,
+				  int fbfd,
+				  const FBInkRect* restrict rect,
+				  FBInkDump* restrict dump) __attribute__((nonnull(1, 4)));
+FBINK_API int fbink_restore_ctx(FBInkContext* restrict ctx,
+				int fbfd,
+				const FBInkConfig* restrict fbink_cfg,
+				const FBInkDump* restrict dump) __attribute__((nonnull));
+
+FBINK_API int fbink_surface_alloc_ctx(FBInkContext* restrict ctx, int fbfd, FBInkSurface* restrict surface)
+    __attribute__((nonnull));
+FBINK_API int fbink_surface_begin_ctx(FBInkContext* restrict ctx, FBInkSurface* restrict surface)
+    __attribute__((nonnull));
+FBINK_API int fbink_surface_end_ctx(FBInkContext* restrict ctx, FBInkSurface* restrict surface) __attribute__((nonnull));
+FBINK_API int fbink_surface_present_ctx(FBInkContext* restrict ctx,
+					int fbfd,
+					FBInkSurface* restrict surface,
+					const FBInkConfig* restrict fbink_cfg) __attribute__((nonnull));
+FBINK_API int fbink_alt_buffer_alloc_ctx(FBInkContext* restrict ctx, int fbfd, FBInkSurface* restrict surface)
+    __attribute__((nonnull));
+FBINK_API int fbink_page_flip_alloc_ctx(FBInkContext* restrict ctx, int fbfd, FBInkSurface* restrict surface)
+    __attribute__((nonnull));
+FBINK_API int fbink_page_flip_free_ctx(FBInkContext* restrict ctx, int fbfd, FBInkSurface* restrict surface)
+    __attribute__((nonnull));
+
+FBINK_API FBInkRect fbink_get_last_rect_ctx(FBInkContext* restrict ctx, bool rotated) __attribute__((nonnull(1)));
+FBINK_API int       fbink_wait_for_usbms_processing_ctx(FBInkContext* restrict ctx, int fbfd, bool force_unplug)
+    __attribute__((nonnull(1)));
+FBINK_API uint8_t   fbink_rota_native_to_canonical_ctx(FBInkContext* restrict ctx, uint32_t rotate)
+    __attribute__((nonnull(1)));
+FBINK_API uint32_t  fbink_rota_canonical_to_native_ctx(FBInkContext* restrict ctx, uint8_t rotate)
+    __attribute__((nonnull(1)));
+FBINK_API int       fbink_invert_screen_ctx(FBInkContext* restrict ctx, int fbfd, const FBInkConfig* restrict fbink_cfg)
+    __attribute__((nonnull));
+FBINK_API int       fbink_invert_rect_ctx(FBInkContext* restrict ctx,
+					  int fbfd,
+					  const FBInkRect* restrict rect,
+					  bool no_rota) __attribute__((nonnull(1)));
+
+FBINK_API unsigned char* fbink_get_fb_pointer_ctx(FBInkContext* restrict ctx, int fbfd, size_t* buffer_size)
+    __attribute__((nonnull));
+FBINK_API void           fbink_get_fb_info_ctx(FBInkContext* restrict ctx,
+					       struct fb_var_screeninfo* var_info,
+					       struct fb_fix_screeninfo* fix_info) __attribute__((nonnull));
+FBINK_API int            fbink_set_fb_info_ctx(FBInkContext* restrict ctx,
+					       int      fbfd,
+					       uint32_t rota,
+					       uint8_t  bpp,
+					       uint8_t  grayscale,
+					       const FBInkConfig* restrict fbink_cfg)
+    __attribute__((warn_unused_result, nonnull));
+
+FBINK_API int fbink_fill_rect_gray_ctx(FBInkContext* restrict ctx,
+				       int fbfd,
+				       const FBInkConfig* restrict fbink_cfg,
+				       const FBInkRect* restrict rect,
+				       bool    no_rota,
+				       uint8_t y) __attribute__((nonnull(1, 3)));
+FBINK_API int fbink_fill_rect_rgba_ctx(FBInkContext* restrict ctx,
+				       int fbfd,
+				       const FBInkConfig* restrict fbink_cfg,
+				       const FBInkRect* restrict rect,
+				       bool    no_rota,
+				       uint8_t r,
+				       uint8_t g,
+				       uint8_t b,
+				       uint8_t a) __attribute__((nonnull(1, 3)));
+FBINK_API int fbink_put_pixel_gray_ctx(FBInkContext* restrict ctx, int fbfd, uint16_t x, uint16_t y, uint8_t v)
+    __attribute__((nonnull(1)));
+FBINK_API int fbink_put_pixel_rgba_ctx(FBInkContext* restrict ctx,
+				       int      fbfd,
+				       uint16_t x,
+				       uint16_t y,
+				       uint8_t  r,
+				       uint8_t  g,
+				       uint8_t  b,
+				       uint8_t  a) __attribute__((nonnull(1)));
+FBINK_API int fbink_get_pixel_ctx(FBInkContext* restrict ctx,
+				  int      fbfd,
+				  uint16_t x,
+				  uint16_t y,
+				  uint8_t* r,
+				  uint8_t* g,
+				  uint8_t* b,
+				  uint8_t* a) __attribute__((nonnull(1)));
+FBINK_API int fbink_pack_pixel_gray_ctx(FBInkContext* restrict ctx, uint8_t y, uint32_t* px) __attribute__((nonnull(1)));
+FBINK_API int fbink_pack_pixel_rgba_ctx(FBInkContext* restrict ctx,
+					uint8_t   r,
+					uint8_t   g,
+					uint8_t   b,
+					uint8_t   a,
+					uint32_t* px) __attribute__((nonnull(1)));
+FBINK_API int fbink_put_pixel_ctx(FBInkContext* restrict ctx, int fbfd, uint16_t x, uint16_t y, void* px)
+    __attribute__((nonnull(1)));
+FBINK_API int fbink_fill_rect_ctx(FBInkContext* restrict ctx,
+				  int fbfd,
+				  const FBInkConfig* restrict fbink_cfg,
+				  const FBInkRect* restrict rect,
+				  bool  no_rota,
+				  void* px) __attribute__((nonnull(1, 3)));
+
+FBINK_API int fbink_wakeup_epdc_ctx(FBInkContext* restrict ctx) __attribute__((nonnull(1)));
+FBINK_API int fbink_sunxi_toggle_ntx_pen_mode_ctx(FBInkContext* restrict ctx, int fbfd, bool toggle)
+    __attribute__((nonnull(1)));
+FBINK_API int fbink_sunxi_ntx_enforce_rota_ctx(FBInkContext* restrict ctx,
+					       int                      fbfd,
+					       SUNXI_FORCE_ROTA_INDEX_T mode,
+					       const FBInkConfig* restrict fbink_cfg)
+    __attribute__((warn_unused_result, nonnull));
+FBINK_API int fbink_mtk_set_swipe_data_ctx(FBInkContext* restrict ctx,
+					   MTK_SWIPE_DIRECTION_INDEX_T direction,
+					   uint8_t                     steps) __attribute__((nonnull(1)));
+FBINK_API int fbink_wait_for_any_complete_ctx(FBInkContext* restrict ctx, int fbfd) __attribute__((nonnull(1)));
+FBINK_API int fbink_mtk_set_halftone_ctx(FBInkContext* restrict ctx,
+					 int                       fbfd,
+					 const FBInkRect           exclude_regions[2],
+					 MTK_HALFTONE_MODE_INDEX_T size) __attribute__((nonnull(1)));
+FBINK_API int fbink_mtk_toggle_auto_reagl_ctx(FBInkContext* restrict ctx, int fbfd, bool toggle)
+    __attribute__((nonnull(1)));
+FBINK_API int fbink_mtk_toggle_pen_mode_ctx(FBInkContext* restrict ctx, int fbfd, bool toggle)
+    __attribute__((nonnull(1)));
+
+FBINK_API FBInkInputDevice* fbink_input_scan_ctx(FBInkContext* restrict ctx,
+						 INPUT_DEVICE_TYPE_T   match_types,
+						 INPUT_DEVICE_TYPE_T   exclude_types,
+						 INPUT_SETTINGS_TYPE_T settings,
+						 size_t*               dev_count) __attribute__((nonnull(1)));
+FBINK_API FBInkInputDevice* fbink_input_check_ctx(FBInkContext* restrict ctx,
+						  const char*           filepath,
+						  INPUT_DEVICE_TYPE_T   match_types,
+						  INPUT_DEVICE_TYPE_T   exclude_types,
+						  INPUT_SETTINGS_TYPE_T settings) __attribute__((nonnull(1)));
+
 //
 ///
 //
@@ -106,15 +106,19 @@ cleanup:
 }
 
 static bool
-    wait_for_background_color(uint8_t v, unsigned short int timeout, unsigned short int granularity)
+    wait_for_background_color(FBInkContext* restrict ctx,
+			      uint8_t            v,
+			      unsigned short int timeout,
+			      unsigned short int granularity)
 {
 	// Check a single pixel that should always be white in Nickel,
 	// and always black when on the "Connected" & "Importing Content" screens.
 	// Something on the bottom margin should do the trick,
 	// without falling into any "might be behind the bezel" quirk,
 	// which would cause it to potentially already be black (or transparent) in Nickel...
-	FBInkCoordinates coords = { (unsigned short int) (viewWidth / 2U), (unsigned short int) (viewHeight - 1) };
-	(*fxpRotateCoords)(&coords);
+	FBInkCoordinates coords = { (unsigned short int) (ctx->viewWidth / 2U),
+				    (unsigned short int) (ctx->viewHeight - 1) };
+	(*ctx->fxpRotateCoords)(ctx, &coords);
 	FBInkPixel pixel = { 0U };
 
 	// We loop for <timeout> seconds at most, waking up every <granularity> ms...
@@ -130,10 +134,10 @@ static bool
 		// Wait <granularity> ms . . .
 		nanosleep(&zzz, NULL);
 
-		(*fxpGetPixel)(&coords, &pixel);
+		(*ctx->fxpGetPixel)(ctx, &coords, &pixel);
 		// NOTE: get_pixel_* will only set gray8 (leaving at least bgra.color.r untouched) @ 4 & 8bpp!
 		//       (It will unpack RGB565 to RGB32, though ;)).
-		if (vInfo.bits_per_pixel > 8U) {
+		if (ctx->vInfo.bits_per_pixel > 8U) {
 			LOG("On iteration nr. %hu of %hu, pixel (%hu, %hu) was #%02hhX%02hhX%02hhX",
 			    i,
 			    iterations,
@@ -167,41 +171,41 @@ static bool
 }
 
 static bool
-    is_on_connected_screen(void)
+    is_on_connected_screen(FBInkContext* restrict ctx)
 {
 	// USB Connected screen has a black background
 	LOG("Waiting for the 'USB Connected' screen . . .");
-	return wait_for_background_color(eInkBGCMap[BG_BLACK], 10U, 250U);
+	return wait_for_background_color(ctx, eInkBGCMap[BG_BLACK], 10U, 250U);
 }
 
 static bool
-    is_on_home_screen(void)
+    is_on_home_screen(FBInkContext* restrict ctx)
 {
 	// Home screen has a white background
 	LOG("Waiting for the 'Home' screen . . .");
 	// NOTE: This one *might* need a slightly larger timeout, just to be safe...
-	return wait_for_background_color(eInkBGCMap[BG_WHITE], 12U, 250U);
+	return wait_for_background_color(ctx, eInkBGCMap[BG_WHITE], 12U, 250U);
 }
 
 static bool
-    is_on_import_screen(void)
+    is_on_import_screen(FBInkContext* restrict ctx)
 {
 	// Import screen has a black background
 	LOG("Waiting for the 'Content Import' screen . . .");
-	return wait_for_background_color(eInkBGCMap[BG_BLACK], 10U, 250U);
+	return wait_for_background_color(ctx, eInkBGCMap[BG_BLACK], 10U, 250U);
 }
 
 static bool
-    is_on_home_screen_again(void)
+    is_on_home_screen_again(FBInkContext* restrict ctx)
 {
 	// Home screen has a white background
 	LOG("Waiting for the 'Home' screen again . . .");
 	// NOTE: Give up after 5 minutes...
-	return wait_for_background_color(eInkBGCMap[BG_WHITE], (60U * 5U), 750U);
+	return wait_for_background_color(ctx, eInkBGCMap[BG_WHITE], (60U * 5U), 750U);
 }
 
 static int
-    generate_button_press(FBInkCoordinates* restrict match_coords, bool nosleep)
+    generate_button_press(FBInkContext* restrict ctx, FBInkCoordinates* restrict match_coords, bool nosleep)
 {
 	LOG("Pressing the Connect button . . .");
 	struct input_event ev;
@@ -216,7 +220,7 @@ static int
 	//       depending on the exact device, so do our best to handle that properly...
 	// NOTE: Double-check on your device w/ hexdump -x /dev/input/event1 (or -d if you prefer decimal).
 	//       Or evemu-record or evtest if you've got KoboStuff installed ;).
-	if (deviceQuirks.isKoboNonMT) {
+	if (ctx->deviceQuirks.isKoboNonMT) {
 		// NOTE: Should match what Kobo does on devices who don't have a Multi-Touch aware driver...
 		//       Should cover the Touch A/B/C, Mini, Glo & Aura HD
 		// NOTE: The original Touch is known to come in multiple variants,
@@ -233,7 +237,7 @@ static int
 		SEND_INPUT_EVENT(EV_ABS, ABS_PRESSURE, 0);
 		SEND_INPUT_EVENT(EV_KEY, BTN_TOUCH, 0);
 		SEND_INPUT_EVENT(EV_SYN, SYN_REPORT, 0);
-	} else if (deviceQuirks.isKoboMk7) {
+	} else if (ctx->deviceQuirks.isKoboMk7) {
 		// NOTE: Roughly corresponds to what we call the "Snow" protocol in KOReader.
 		//       Should handle the H2O²r2, (Aura SEr2?), Clara HD, Forma.
 		//       And possibly the H2O²r1, although this one will need a dedicated quirk to compute the proper x/y coords.
@@ -270,7 +274,7 @@ static int
 		SEND_INPUT_EVENT(EV_KEY, BTN_TOUCH, 0);
 		SEND_INPUT_EVENT(EV_KEY, BTN_TOOL_FINGER, 0);
 		SEND_INPUT_EVENT(EV_SYN, SYN_REPORT, 0);
-	} else if (deviceQuirks.isSunxi) {
+	} else if (ctx->deviceQuirks.isSunxi) {
 		// NOTE: Mostly for documentation's sake, as this feature is unsupported on sunxi SoCs...
 		// If multiple contact points are detected (e.g., multi-touch),
 		// each tracking ID is preceded by its slot assignment (e.g., EV_ABS:ABS_MT_SLOT:0 for the first finger).
@@ -344,7 +348,7 @@ static int
 	//       e.g., checking the state of the /mnt/onboard mountpoint...
 	if (!nosleep) {
 		// If we fail to detect the "Connected" screen, we've failed to press the button...
-		if (!is_on_connected_screen()) {
+		if (!is_on_connected_screen(ctx)) {
 			rv = ERRCODE(ENOTSUP);
 		}
 	}
@@ -354,11 +358,15 @@ static int
 #endif
 
 // Scan the screen's content for Kobo's "Connect" button in the "USB plugged in" popup.
-int
-    fbink_button_scan(int fbfd UNUSED_BY_NOBUTTON, bool press_button UNUSED_BY_NOBUTTON, bool nosleep UNUSED_BY_NOBUTTON)
+// NOTE: The public API is deprecated, so it only ever uses the default context.
+static int
+    button_scan(FBInkContext* restrict ctx UNUSED_BY_NOBUTTON,
+		int fbfd                   UNUSED_BY_NOBUTTON,
+		bool press_button          UNUSED_BY_NOBUTTON,
+		bool nosleep               UNUSED_BY_NOBUTTON)
 {
 #ifdef FBINK_WITH_BUTTON_SCAN
-	if (deviceQuirks.isSunxi) {
+	if (ctx->deviceQuirks.isSunxi) {
 		PFWARN("This feature is not supported on your device");
 		return ERRCODE(ENOSYS);
 	}
@@ -366,7 +374,7 @@ int
 	// Open the framebuffer if need be...
 	// NOTE: As usual, we *expect* to be initialized at this point!
 	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -374,8 +382,8 @@ int
 	int rv = EXIT_SUCCESS;
 
 	// mmap the fb if need be...
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
@@ -388,7 +396,7 @@ int
 	// NOTE: RGB565 conversions are complex and potentially slightly lossy,
 	//       with slight rounding/truncation errors that can be different depending on how exactly the conversions were done.
 	//       This matches with what *we* do, hopefully that'll be close enough to what Nickel actually does...
-	if (deviceQuirks.isNTX16bLandscape) {
+	if (ctx->deviceQuirks.isNTX16bLandscape) {
 		button_color.r = 0xDEu;
 		button_color.g = 0xDBu;
 		button_color.b = 0xDEu;
@@ -407,8 +415,8 @@ int
 	//       Possibly less on larger resolutions, and more on smaller resolutions, so try to handle everyone in one fell swoop.
 	// NOTE: Truncating floats via explicit casts is good enough for us.
 	//       With poor man's rounding, no need to pull in libm ;).
-	unsigned short int min_target_pixels = (unsigned short int) ((0.125f * (float) viewWidth) + 0.5f);
-	unsigned short int max_target_pixels = (unsigned short int) ((0.25f * (float) viewWidth) + 0.5f);
+	unsigned short int min_target_pixels = (unsigned short int) ((0.125f * (float) ctx->viewWidth) + 0.5f);
+	unsigned short int max_target_pixels = (unsigned short int) ((0.25f * (float) ctx->viewWidth) + 0.5f);
 
 	// Recap the various settings as computed for this screen...
 	LOG("Button color is expected to be #%02hhX%02hhX%02hhX", button_color.r, button_color.g, button_color.b);
@@ -416,10 +424,10 @@ int
 
 	// Only look in the area of the screen where we're likely to find the buttons, both to save some time,
 	// and to lower the risk of false positives, as unlikely as that might be.
-	unsigned short int min_height = (unsigned short int) ((0.55f * (float) viewHeight) + 0.5f);
-	unsigned short int max_height = (unsigned short int) ((0.85f * (float) viewHeight) + 0.5f);
-	unsigned short int min_width  = (unsigned short int) ((0.05f * (float) viewWidth) + 0.5f);
-	unsigned short int max_width  = (unsigned short int) ((0.80f * (float) viewWidth) + 0.5f);
+	unsigned short int min_height = (unsigned short int) ((0.55f * (float) ctx->viewHeight) + 0.5f);
+	unsigned short int max_height = (unsigned short int) ((0.85f * (float) ctx->viewHeight) + 0.5f);
+	unsigned short int min_width  = (unsigned short int) ((0.05f * (float) ctx->viewWidth) + 0.5f);
+	unsigned short int max_width  = (unsigned short int) ((0.80f * (float) ctx->viewWidth) + 0.5f);
 
 	LOG("Looking for buttons in a %hux%hu rectangle, from (%hu, %hu) to (%hu, %hu)",
 	    (unsigned short int) (max_width - min_width),
@@ -445,13 +453,13 @@ int
 			coords.y = y;
 
 			// Handle 16bpp rotation (hopefully applies in Nickel, too ;D)
-			(*fxpRotateCoords)(&coords);
-			(*fxpGetPixel)(&coords, &pixel);
+			(*ctx->fxpRotateCoords)(ctx, &coords);
+			(*ctx->fxpGetPixel)(ctx, &coords, &pixel);
 
 			// NOTE: Again, get_pixel_* will only set gray8 @ 4 & 8bpp
-			if ((vInfo.bits_per_pixel > 8U && pixel.bgra.color.r == button_color.r &&
+			if ((ctx->vInfo.bits_per_pixel > 8U && pixel.bgra.color.r == button_color.r &&
 			     pixel.bgra.color.g == button_color.g && pixel.bgra.color.b == button_color.b) ||
-			    (vInfo.bits_per_pixel <= 8U && pixel.gray8 == button_color.b)) {
+			    (ctx->vInfo.bits_per_pixel <= 8U && pixel.gray8 == button_color.b)) {
 				// Found a pixel of the right color for a button...
 				button_width++;
 			} else {
@@ -496,13 +504,13 @@ int
 			coords.x = match_coords.x;
 			coords.y = j;
 
-			(*fxpRotateCoords)(&coords);
-			(*fxpGetPixel)(&coords, &pixel);
+			(*ctx->fxpRotateCoords)(ctx, &coords);
+			(*ctx->fxpGetPixel)(ctx, &coords, &pixel);
 
 			// NOTE: Again, with the gray/rgb dance...
-			if ((vInfo.bits_per_pixel > 8U && pixel.bgra.color.r == button_color.r &&
+			if ((ctx->vInfo.bits_per_pixel > 8U && pixel.bgra.color.r == button_color.r &&
 			     pixel.bgra.color.g == button_color.g && pixel.bgra.color.b == button_color.b) ||
-			    (vInfo.bits_per_pixel <= 8U && pixel.gray8 == button_color.b)) {
+			    (ctx->vInfo.bits_per_pixel <= 8U && pixel.gray8 == button_color.b)) {
 				// Found a pixel of the right color for a button...
 				button_height++;
 			} else {
@@ -532,10 +540,10 @@ int
 		//       Note that while rotate_touch_coordinates handles Landscape orientations just fine,
 		//       the various optimizations that limit the area to scan and the size of the button to match
 		//       are completely tailored for Portrait orientations, and would probably need tweaking for Landscape...
-		if (deviceQuirks.canRotate) {
-			rotate_touch_coordinates(&match_coords);
+		if (ctx->deviceQuirks.canRotate) {
+			rotate_touch_coordinates(ctx, &match_coords);
 		} else {
-			rotate_coordinates_pickel(&match_coords);
+			rotate_coordinates_pickel(ctx, &match_coords);
 		}
 		ELOG("Transformed for input -> x=%hu, y=%hu", match_coords.x, match_coords.y);
 
@@ -543,15 +551,15 @@ int
 		//       (i.e., origin at the bottom-left instead of top-right).
 		//       Hopefully that doesn't apply to the fb itself, too...
 		// NOTE: Hide that on the Forma, since it's definitely useless there ;).
-		if (!deviceQuirks.canRotate) {
+		if (!ctx->deviceQuirks.canRotate) {
 			ELOG("Transformed for H2O²r1 input -> x=%hu, y=%hu",
-			     (unsigned short int) (screenHeight - match_coords.x - 1),
-			     (unsigned short int) (screenWidth - match_coords.y - 1));
+			     (unsigned short int) (ctx->screenHeight - match_coords.x - 1),
+			     (unsigned short int) (ctx->screenWidth - match_coords.y - 1));
 		}
 
 		// Press it if requested...
 		if (press_button) {
-			if ((rv = generate_button_press(&match_coords, nosleep)) != EXIT_SUCCESS) {
+			if ((rv = generate_button_press(ctx, &match_coords, nosleep)) != EXIT_SUCCESS) {
 				WARN("Failed to press the Connect button");
 				goto cleanup;
 			} else {
@@ -567,11 +575,11 @@ int
 
 	// Cleanup
 cleanup:
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -581,12 +589,20 @@ cleanup:
 #endif    // FBINK_WITH_BUTTON_SCAN
 }
 
+int
+    fbink_button_scan(int fbfd, bool press_button, bool nosleep)
+{
+	return button_scan(&defaultCtx, fbfd, press_button, nosleep);
+}
+
 // Wait for the end of an USBMS session, trying to detect a successful content import in the process.
 int
-    fbink_wait_for_usbms_processing(int fbfd UNUSED_BY_NOBUTTON, bool force_unplug UNUSED_BY_NOBUTTON)
+    fbink_wait_for_usbms_processing_ctx(FBInkContext* restrict ctx UNUSED_BY_NOBUTTON,
+					int fbfd                   UNUSED_BY_NOBUTTON,
+					bool force_unplug          UNUSED_BY_NOBUTTON)
 {
 #ifdef FBINK_WITH_BUTTON_SCAN
-	if (deviceQuirks.isSunxi) {
+	if (ctx->deviceQuirks.isSunxi) {
 		PFWARN("This feature is not supported on your device");
 		return ERRCODE(ENOSYS);
 	}
@@ -594,7 +610,7 @@ int
 	// Open the framebuffer if need be...
 	// NOTE: As usual, we *expect* to be initialized at this point!
 	bool keep_fd = true;
-	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -602,8 +618,8 @@ int
 	int rv = EXIT_SUCCESS;
 
 	// mmap the fb if need be...
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+	if (!ctx->isFbMapped) {
+		if (memmap_fb(ctx, fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
@@ -611,7 +627,7 @@ int
 
 	// Double-check that we're really on something that looks like the Connected screen,
 	// in case someone slipped on the wrong CLI flag or the wrong function ;).
-	if (!wait_for_background_color(eInkBGCMap[BG_BLACK], 0U, 0U)) {
+	if (!wait_for_background_color(ctx, eInkBGCMap[BG_BLACK], 0U, 0U)) {
 		// That won't do... abort!
 		WARN("We don't appear to be on the Connected screen, abort");
 		rv = ERRCODE(EXIT_FAILURE);
@@ -662,7 +678,7 @@ int
 	}
 
 	// Now check that we're back on the Home screen...
-	if (!is_on_home_screen()) {
+	if (!is_on_home_screen(ctx)) {
 		// That won't do... abort!
 		WARN("Failed to detect Home screen, can't detect content import");
 		rv = ERRCODE(EXIT_FAILURE);
@@ -670,7 +686,7 @@ int
 	}
 
 	// Then wait a while to see if the Import screen pops up...
-	if (!is_on_import_screen()) {
+	if (!is_on_import_screen(ctx)) {
 		// Maybe there was nothing to import?
 		WARN("Couldn't detect the Import screen, maybe there was nothing to import?");
 		rv = ERRCODE(ENODATA);
@@ -678,7 +694,7 @@ int
 	}
 
 	// Then wait a potentially long while (~5min) for the end of the Import process...
-	if (!is_on_home_screen_again()) {
+	if (!is_on_home_screen_again(ctx)) {
 		// NOTE: LF better method than a stupid hard timeout... ;'(
 		WARN(
 		    "Failed to detect the end of the Import process, maybe it's hung or running suspiciously long (it's been > 5min)?");
@@ -688,11 +704,11 @@ int
 
 	// Cleanup
 cleanup:
-	if (isFbMapped && !keep_fd) {
-		unmap_fb();
+	if (ctx->isFbMapped && !keep_fd) {
+		unmap_fb(ctx);
 	}
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
@@ -701,3 +717,9 @@ cleanup:
 	return ERRCODE(ENOSYS);
 #endif    // FBINK_WITH_BUTTON_SCAN
 }
+
+int
+    fbink_wait_for_usbms_processing(int fbfd, bool force_unplug)
+{
+	return fbink_wait_for_usbms_processing_ctx(&defaultCtx, fbfd, force_unplug);
+}
@@ -92,11 +92,13 @@
 
 static bool is_onboard_state(bool);
 static bool wait_for_onboard_state(bool);
-static bool wait_for_background_color(uint8_t, unsigned short int, unsigned short int);
-static bool is_on_connected_screen(void);
-static bool is_on_home_screen(void);
-static bool is_on_import_screen(void);
-static int  generate_button_press(FBInkCoordinates* restrict, bool);
+static bool wait_for_background_color(FBInkContext* restrict, uint8_t, unsigned short int, unsigned short int);
+static bool is_on_connected_screen(FBInkContext* restrict);
+static bool is_on_home_screen(FBInkContext* restrict);
+static bool is_on_import_screen(FBInkContext* restrict);
+static int  generate_button_press(FBInkContext* restrict, FBInkCoordinates* restrict, bool);
 #endif
 
+static int button_scan(FBInkContext* restrict, int, bool, bool);
+
 #endif
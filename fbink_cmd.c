@@ -396,6 +396,11 @@ static void
 	    "\n"
 	    "\tRemember that LFs are honored!\n"
 	    "\tAlso, the daemon will NOT abort on FBInk errors, and it redirects stdout & stderr to /dev/null, so errors & bogus input will be silently ignored!\n"
+	    "\tIf you need to do more than print text, set FBINK_DAEMON_PROTOCOL to binary in your environment to switch to a length-prefixed binary protocol (c.f., fbink_daemon.h & CLI.md).\n"
+	    "\tOr set FBINK_DAEMON_SOCKET to an absolute path in your environment to listen on a SOCK_SEQPACKET Unix socket instead of a named pipe,\n"
+	    "\twhich implies the binary protocol, but supports multiple clients, and replies to every message.\n"
+	    "\tOr set FBINK_DAEMON_RING to an absolute path in your environment to setup a lock-free shared memory queue there instead,\n"
+	    "\twhich implies the binary protocol, too, and is meant for multiple concurrent producers (c.f., fbink_daemon.h).\n"
 	    "\tIt can abort on early setup errors, though, before *or* after having redirected stderr...\n"
 	    "\tIt does enforce logging to the syslog, though, but, again, early commandline parsing errors may still be sent to stderr...\n"
 	    "\n");
@@ -567,6 +572,557 @@ static void
 	}
 }
 
+// Rate-limited fbink_reinit, for the daemon's sake.
+// NOTE: We used to reinit before every single message, but that's an extra ioctl per message,
+//       for a state that very rarely changes (in practice, only rotation and, much more rarely, bitdepth).
+//       So, instead, we only check if we've been idle for a while, or if we haven't checked in a while,
+//       which means a stream of updates will only pay for a reinit every FBINK_DAEMON_REINIT_INTERVAL_MS.
+//       On sunxi, fbink_reinit is already a cheap sysfs/accelerometer check, so we don't bother.
+static int
+    daemon_reinit(int fbfd, const FBInkConfig* fbink_cfg)
+{
+	static struct timespec last_check = { 0 };
+	static int             is_sunxi   = -1;
+
+	// That one won't change, so, only check it once
+	if (is_sunxi == -1) {
+		FBInkState state = { 0 };
+		fbink_get_state(fbink_cfg, &state);
+		is_sunxi = state.is_sunxi;
+	}
+
+	if (!is_sunxi) {
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		const long int elapsed_ms =
+		    (now.tv_sec - last_check.tv_sec) * 1000L + (now.tv_nsec - last_check.tv_nsec) / 1000000L;
+		if (last_check.tv_sec != 0 && elapsed_ms < FBINK_DAEMON_REINIT_INTERVAL_MS) {
+			return EXIT_SUCCESS;
+		}
+		last_check = now;
+	}
+
+	return fbink_reinit(fbfd, fbink_cfg);
+}
+
+// Handle a single binary daemon message (c.f., fbink_daemon.h)
+// NOTE: Unlike in text mode, messages are stateless: we don't track lines, and positioning is entirely up to the client,
+//       either via the daemon's own setup (i.e., the commandline), or via a per-message FBInkConfig.
+static int
+    handle_daemon_msg(int                      fbfd,
+		      const FBInkDaemonHeader* hdr,
+		      const unsigned char*     payload,
+		      const FBInkConfig*       daemon_cfg,
+		      const FBInkOTConfig*     daemon_ot_cfg,
+		      FBInkDump*               dumps)
+{
+	int         rv   = EXIT_SUCCESS;
+	size_t      left = hdr->size;
+	FBInkConfig cfg  = *daemon_cfg;
+
+	// Start by consuming the optional config overrides
+	if (hdr->flags & FBINK_DAEMON_FLAG_CFG) {
+		if (left < sizeof(cfg)) {
+			return ERRCODE(EINVAL);
+		}
+		memcpy(&cfg, payload, sizeof(cfg));
+		payload += sizeof(cfg);
+		left -= sizeof(cfg);
+
+		// Init-time stuff is our business, not the client's
+		cfg.fontmult    = daemon_cfg->fontmult;
+		cfg.fontname    = daemon_cfg->fontname;
+		cfg.no_viewport = daemon_cfg->no_viewport;
+		cfg.is_verbose  = daemon_cfg->is_verbose;
+		cfg.is_quiet    = daemon_cfg->is_quiet;
+		cfg.to_syslog   = daemon_cfg->to_syslog;
+	}
+	FBInkOTConfig ot_cfg = *daemon_ot_cfg;
+	if (hdr->flags & FBINK_DAEMON_FLAG_OT_CFG) {
+		if (left < sizeof(ot_cfg)) {
+			return ERRCODE(EINVAL);
+		}
+		memcpy(&ot_cfg, payload, sizeof(ot_cfg));
+		payload += sizeof(ot_cfg);
+		left -= sizeof(ot_cfg);
+
+		// We only ever use the global fonts, c.f., load_ot_fonts
+		ot_cfg.font = daemon_ot_cfg->font;
+	}
+
+	// Pen colors are only processed on demand, so, make sure we honor the client's, if need be...
+	const bool pen_update = (cfg.fg_color != daemon_cfg->fg_color || cfg.bg_color != daemon_cfg->bg_color);
+	if (pen_update) {
+		fbink_update_pen_colors(&cfg);
+	}
+
+	// Scratch space for whichever op we're handling...
+	char*            str = NULL;
+	FBInkOTFit       ot_fit;
+	FBInkDaemonImage img;
+	FBInkDaemonRaw   raw;
+	FBInkDaemonFill  fill;
+	FBInkRect        rect;
+	FBInkDaemonDump  dump;
+	switch (hdr->op) {
+		case FBINK_OP_PRINT:
+		case FBINK_OP_PRINT_OT:
+			str = strndup((const char*) payload, left);
+			if (!str) {
+				PFWARN("strndup: %m");
+				rv = ERRCODE(ENOMEM);
+				break;
+			}
+			if (hdr->op == FBINK_OP_PRINT) {
+				rv = fbink_print(fbfd, str, &cfg);
+			} else {
+				rv = fbink_print_ot(fbfd, str, &ot_cfg, &cfg, &ot_fit);
+			}
+			free(str);
+			break;
+		case FBINK_OP_IMAGE:
+			if (left <= sizeof(img)) {
+				rv = ERRCODE(EINVAL);
+				break;
+			}
+			memcpy(&img, payload, sizeof(img));
+			str = strndup((const char*) payload + sizeof(img), left - sizeof(img));
+			if (!str) {
+				PFWARN("strndup: %m");
+				rv = ERRCODE(ENOMEM);
+				break;
+			}
+			rv = fbink_print_image(fbfd, str, img.x_off, img.y_off, &cfg);
+			free(str);
+			break;
+		case FBINK_OP_RAW:
+			if (left <= sizeof(raw)) {
+				rv = ERRCODE(EINVAL);
+				break;
+			}
+			memcpy(&raw, payload, sizeof(raw));
+			// NOTE: fbink_print_raw_data validates len against w & h for us
+			rv = fbink_print_raw_data(
+			    fbfd, payload + sizeof(raw), raw.w, raw.h, left - sizeof(raw), raw.x_off, raw.y_off, &cfg);
+			break;
+		case FBINK_OP_FILL:
+			if (left != sizeof(fill)) {
+				rv = ERRCODE(EINVAL);
+				break;
+			}
+			memcpy(&fill, payload, sizeof(fill));
+			rv = fbink_fill_rect_rgba(fbfd, &cfg, &fill.rect, fill.no_rota, fill.r, fill.g, fill.b, fill.a);
+			break;
+		case FBINK_OP_REFRESH:
+			if (left == 0U) {
+				rect = (FBInkRect){ 0U };
+			} else if (left == sizeof(rect)) {
+				memcpy(&rect, payload, sizeof(rect));
+			} else {
+				rv = ERRCODE(EINVAL);
+				break;
+			}
+			rv = fbink_refresh_rect(fbfd, &rect, &cfg);
+			break;
+		case FBINK_OP_DUMP:
+		case FBINK_OP_RESTORE:
+			if (left != sizeof(dump)) {
+				rv = ERRCODE(EINVAL);
+				break;
+			}
+			memcpy(&dump, payload, sizeof(dump));
+			if (dump.slot >= FBINK_DAEMON_DUMP_SLOTS) {
+				rv = ERRCODE(EINVAL);
+				break;
+			}
+			if (hdr->op == FBINK_OP_DUMP) {
+				rv = fbink_rect_dump(fbfd, &dump.rect, &dumps[dump.slot]);
+				// NOTE: Not being able to compress it is not an error
+				if (rv == EXIT_SUCCESS && dump.compress) {
+					fbink_compress_dump(&dumps[dump.slot]);
+				}
+			} else {
+				rv = fbink_restore(fbfd, &cfg, &dumps[dump.slot]);
+			}
+			break;
+		default:
+			rv = ERRCODE(EINVAL);
+			break;
+	}
+
+	// Restore our own pen colors
+	if (pen_update) {
+		fbink_update_pen_colors(daemon_cfg);
+	}
+
+	return rv;
+}
+
+// Handle as many complete binary daemon messages as we've got buffered
+static void
+    process_daemon_buffer(int                  fbfd,
+			  FBInkDaemonBuffer*   msg_buf,
+			  const FBInkConfig*   daemon_cfg,
+			  const FBInkOTConfig* daemon_ot_cfg,
+			  FBInkDump*           dumps)
+{
+	size_t offset = 0U;
+	while (msg_buf->len - offset >= sizeof(FBInkDaemonHeader)) {
+		FBInkDaemonHeader hdr;
+		memcpy(&hdr, msg_buf->data + offset, sizeof(hdr));
+
+		// NOTE: There's no way to reliably resync on a corrupted stream, so, just drop everything we've got.
+		//       Since writers are expected to write whole messages at once, we should be back on track on the next one.
+		if (hdr.magic != FBINK_DAEMON_MAGIC || hdr.version != FBINK_DAEMON_VERSION ||
+		    hdr.size > FBINK_DAEMON_MAX_PAYLOAD) {
+			WARN("Invalid message header (magic: %#x, version: %hhu, size: %u), dropping %zu bytes of input",
+			     hdr.magic,
+			     hdr.version,
+			     hdr.size,
+			     msg_buf->len - offset);
+			msg_buf->len = 0U;
+			return;
+		}
+
+		// Wait for the rest of the payload
+		if (msg_buf->len - offset - sizeof(hdr) < hdr.size) {
+			break;
+		}
+
+		// NOTE: As in text mode, we *ignore* errors in order not to die on bogus input, we just log them.
+		int rv = handle_daemon_msg(fbfd, &hdr, msg_buf->data + offset + sizeof(hdr), daemon_cfg, daemon_ot_cfg, dumps);
+		if (rv < 0) {
+			WARN("Failed to handle a message (op: %hhu): %d", hdr.op, rv);
+		}
+		offset += sizeof(hdr) + hdr.size;
+	}
+
+	// Move any incomplete message to the front of the buffer
+	if (offset > 0U) {
+		memmove(msg_buf->data, msg_buf->data + offset, msg_buf->len - offset);
+		msg_buf->len -= offset;
+	}
+}
+
+// Drain the pipe, and handle any complete binary daemon message we might have gotten
+static int
+    read_daemon_fifo(int                  fbfd,
+		     int                  pipefd,
+		     FBInkDaemonBuffer*   msg_buf,
+		     const FBInkConfig*   daemon_cfg,
+		     const FBInkOTConfig* daemon_ot_cfg,
+		     FBInkDump*           dumps)
+{
+	// NOTE: PIPE_BUF is only the atomicity guarantee: larger messages may be split across multiple reads,
+	//       possibly interleaved with a poll() round-trip, hence the reassembly buffer.
+	bool is_reinit_done = false;
+	while (1) {
+		if (msg_buf->cap - msg_buf->len < PIPE_BUF) {
+			size_t cap = msg_buf->cap ? msg_buf->cap << 1U : PIPE_BUF * 4U;
+			// Header + max payload, plus a full read's worth of the next message
+			if (cap > sizeof(FBInkDaemonHeader) + FBINK_DAEMON_MAX_PAYLOAD + PIPE_BUF) {
+				cap = sizeof(FBInkDaemonHeader) + FBINK_DAEMON_MAX_PAYLOAD + PIPE_BUF;
+			}
+			unsigned char* data = realloc(msg_buf->data, cap);
+			if (!data) {
+				PFWARN("realloc: %m");
+				return ERRCODE(EXIT_FAILURE);
+			}
+			msg_buf->data = data;
+			msg_buf->cap  = cap;
+		}
+
+		ssize_t bytes_read = 0;
+		do {
+			// Flawfinder: ignore
+			bytes_read = read(pipefd, msg_buf->data + msg_buf->len, msg_buf->cap - msg_buf->len);
+		} while (bytes_read == -1 && errno == EINTR);
+		if (bytes_read == -1) {
+			if (errno == EAGAIN) {
+				// Back to poll()!
+				break;
+			}
+			PFWARN("read: %m");
+			return ERRCODE(EXIT_FAILURE);
+		}
+		if (bytes_read <= 0) {
+			break;
+		}
+		msg_buf->len += (size_t) bytes_read;
+
+		// First things first, do an explicit reinit, as we might have been running for a while.
+		if (!is_reinit_done) {
+			if (unlikely(daemon_reinit(fbfd, daemon_cfg) < 0)) {
+				// We don't track state, so we only need to handle plain failures.
+				PFWARN("fbink_reinit");
+				return ERRCODE(EXIT_FAILURE);
+			}
+			is_reinit_done = true;
+		}
+
+		// Handle what we can right away, so that the buffer never has to hold more than a single message
+		process_daemon_buffer(fbfd, msg_buf, daemon_cfg, daemon_ot_cfg, dumps);
+	}
+
+	return EXIT_SUCCESS;
+}
+
+// Handle a single packet from a socket mode client, and reply to it.
+// Returns 0 on success, and -1 if the client should be dropped.
+static int
+    handle_daemon_packet(int                  fbfd,
+			 int                  clientfd,
+			 FBInkDaemonBuffer*   msg_buf,
+			 const FBInkConfig*   daemon_cfg,
+			 const FBInkOTConfig* daemon_ot_cfg,
+			 FBInkDump*           dumps)
+{
+	// Make sure the largest valid packet will fit.
+	// NOTE: We can't just peek at the size of the packet first, because recv only reports the real length
+	//       of a truncated packet w/ MSG_TRUNC since Linux 3.4, and a lot of our targets run older kernels.
+	//       We're only ever going to touch the pages we actually receive into, so this is cheaper than it looks.
+	const size_t max_pkt_len = sizeof(FBInkDaemonHeader) + FBINK_DAEMON_MAX_PAYLOAD;
+	if (msg_buf->cap < max_pkt_len) {
+		// NOTE: Don't realloc, we don't care about the previous contents
+		free(msg_buf->data);
+		msg_buf->cap  = 0U;
+		msg_buf->data = malloc(max_pkt_len);
+		if (!msg_buf->data) {
+			PFWARN("malloc: %m");
+			return -1;
+		}
+		msg_buf->cap = max_pkt_len;
+	}
+
+	struct iovec  iov     = { .iov_base = msg_buf->data, .iov_len = msg_buf->cap };
+	struct msghdr msg     = { .msg_iov = &iov, .msg_iovlen = 1 };
+	ssize_t       pkt_len = 0;
+	do {
+		pkt_len = recvmsg(clientfd, &msg, 0);
+	} while (pkt_len == -1 && errno == EINTR);
+	if (pkt_len == -1) {
+		if (errno == EAGAIN) {
+			return 0;
+		}
+		PFWARN("recvmsg: %m");
+		return -1;
+	}
+	// NOTE: Zero-length packets are valid with SOCK_SEQPACKET, but we don't send nor expect any,
+	//       so we can safely treat this as an orderly shutdown.
+	if (pkt_len == 0) {
+		return -1;
+	}
+	if (msg.msg_flags & MSG_TRUNC) {
+		// Too large, the rest of it has already been discarded, so just reply with an error
+		pkt_len = 0;
+	}
+
+	FBInkDaemonReply  reply = { .rv = ERRCODE(EINVAL) };
+	FBInkDaemonHeader hdr;
+	if ((size_t) pkt_len >= sizeof(hdr)) {
+		memcpy(&hdr, msg_buf->data, sizeof(hdr));
+	}
+	// Since packet boundaries are preserved, the size field has to match exactly.
+	if ((size_t) pkt_len >= sizeof(hdr) && hdr.magic == FBINK_DAEMON_MAGIC && hdr.version == FBINK_DAEMON_VERSION &&
+	    hdr.size == (size_t) pkt_len - sizeof(hdr)) {
+		// First things first, do an explicit reinit, as we might have been running for a while.
+		if (unlikely(daemon_reinit(fbfd, daemon_cfg) < 0)) {
+			PFWARN("fbink_reinit");
+			return -1;
+		}
+
+		reply.rv = handle_daemon_msg(fbfd, &hdr, msg_buf->data + sizeof(hdr), daemon_cfg, daemon_ot_cfg, dumps);
+		if (reply.rv >= 0 && hdr.flags & FBINK_DAEMON_FLAG_WAIT) {
+			// NOTE: This may legitimately fail w/ ENOSYS on devices w/o this ioctl, which is fine.
+			fbink_wait_for_complete(fbfd, LAST_MARKER);
+		}
+	} else {
+		WARN("Received a malformed packet (%zd bytes)", pkt_len);
+	}
+	reply.marker    = fbink_get_last_marker();
+	reply.last_rect = fbink_get_last_rect(false);
+
+	// NOTE: MSG_NOSIGNAL, because a client going away before we reply shouldn't kill us
+	ssize_t sent = 0;
+	do {
+		sent = send(clientfd, &reply, sizeof(reply), MSG_NOSIGNAL);
+	} while (sent == -1 && errno == EINTR);
+	if (sent == -1) {
+		// A full socket buffer means the client isn't reading its replies, so, drop it, too.
+		PFWARN("send: %m");
+		return -1;
+	}
+
+	return 0;
+}
+
+// Socket mode main loop: serve up to FBINK_DAEMON_MAX_CLIENTS clients at once, one message at a time.
+static int
+    serve_daemon_socket(int                  fbfd,
+			int                  sockfd,
+			FBInkDaemonBuffer*   msg_buf,
+			const FBInkConfig*   daemon_cfg,
+			const FBInkOTConfig* daemon_ot_cfg,
+			FBInkDump*           dumps)
+{
+	int rv = EXIT_SUCCESS;
+
+	// Slot 0 is the listening socket, the rest are clients (fd set to -1 when unused, which poll ignores).
+	struct pollfd pfds[FBINK_DAEMON_MAX_CLIENTS + 1U];
+	pfds[0].fd     = sockfd;
+	pfds[0].events = POLLIN;
+	for (size_t i = 1U; i <= FBINK_DAEMON_MAX_CLIENTS; i++) {
+		pfds[i].fd     = -1;
+		pfds[i].events = POLLIN;
+	}
+	size_t nclients = 0U;
+
+	// Forevah'!
+	while (1) {
+		// If we caught one of the signals we setup earlier, it's time to die ;).
+		if (g_timeToDie != 0) {
+			ELOG("Caught a cleanup signal (%s by UID: %ld, PID: %ld), winding down . . .",
+			     strsignal(g_sigCaught.signo),
+			     (long int) g_sigCaught.uid,
+			     (long int) g_sigCaught.pid);
+			break;
+		}
+
+		// Stop accepting new clients while we're full
+		pfds[0].events = nclients < FBINK_DAEMON_MAX_CLIENTS ? POLLIN : 0;
+		int pn         = poll(pfds, FBINK_DAEMON_MAX_CLIENTS + 1U, -1);
+		if (pn == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+			PFWARN("poll: %m");
+			rv = ERRCODE(EXIT_FAILURE);
+			break;
+		}
+
+		if (pfds[0].revents & POLLIN) {
+			int clientfd = accept4(sockfd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+			if (clientfd == -1) {
+				if (errno != EAGAIN && errno != EINTR && errno != ECONNABORTED) {
+					PFWARN("accept4: %m");
+				}
+			} else {
+				for (size_t i = 1U; i <= FBINK_DAEMON_MAX_CLIENTS; i++) {
+					if (pfds[i].fd == -1) {
+						pfds[i].fd      = clientfd;
+						pfds[i].revents = 0;
+						nclients++;
+						break;
+					}
+				}
+			}
+		}
+
+		// NOTE: Clients are served one message at a time, in turn, so a chatty one can't starve the others.
+		for (size_t i = 1U; i <= FBINK_DAEMON_MAX_CLIENTS; i++) {
+			if (pfds[i].fd == -1 || pfds[i].revents == 0) {
+				continue;
+			}
+
+			bool drop = false;
+			if (pfds[i].revents & POLLIN) {
+				drop = handle_daemon_packet(fbfd, pfds[i].fd, msg_buf, daemon_cfg, daemon_ot_cfg, dumps) != 0;
+			} else if (pfds[i].revents & (POLLHUP | POLLERR | POLLNVAL)) {
+				drop = true;
+			}
+			if (drop) {
+				close(pfds[i].fd);
+				pfds[i].fd = -1;
+				nclients--;
+			}
+		}
+	}
+
+	for (size_t i = 1U; i <= FBINK_DAEMON_MAX_CLIENTS; i++) {
+		if (pfds[i].fd != -1) {
+			close(pfds[i].fd);
+		}
+	}
+
+	return rv;
+}
+
+// Ring mode main loop: we're the single consumer of the shared memory ring (c.f., fbink_daemon.h)
+static int
+    serve_daemon_ring(int                  fbfd,
+		      FBInkDaemonRing*     ring,
+		      const FBInkConfig*   daemon_cfg,
+		      const FBInkOTConfig* daemon_ot_cfg,
+		      FBInkDump*           dumps)
+{
+	uint32_t head = 0U;
+
+	// Forevah'!
+	while (1) {
+		// If we caught one of the signals we setup earlier, it's time to die ;).
+		if (g_timeToDie != 0) {
+			ELOG("Caught a cleanup signal (%s by UID: %ld, PID: %ld), winding down . . .",
+			     strsignal(g_sigCaught.signo),
+			     (long int) g_sigCaught.uid,
+			     (long int) g_sigCaught.pid);
+			break;
+		}
+
+		// NOTE: Read the doorbell *before* checking the slot, so we can't miss a publication between the two.
+		FBInkDaemonRingSlot* slot = &ring->slot[head & (FBINK_DAEMON_RING_SLOTS - 1U)];
+		const uint32_t       bell = __atomic_load_n(&ring->doorbell, __ATOMIC_ACQUIRE);
+		if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != head + 1U) {
+			// Nothing to do, sleep until a producer rings the bell (or a signal wakes us up)
+			if (fbink_daemon_futex(&ring->doorbell, FUTEX_WAIT, bell, NULL) == -1 && errno != EAGAIN &&
+			    errno != EINTR) {
+				PFWARN("futex: %m");
+				return ERRCODE(EXIT_FAILURE);
+			}
+			continue;
+		}
+
+		FBInkDaemonReply  reply = { .rv = ERRCODE(EINVAL) };
+		FBInkDaemonHeader hdr   = { 0 };
+		const uint32_t    len   = slot->len;
+		if (len >= sizeof(hdr) && len <= FBINK_DAEMON_RING_SLOT_SIZE) {
+			memcpy(&hdr, slot->data, sizeof(hdr));
+		}
+		// As with packets, the size field has to match exactly.
+		if (len >= sizeof(hdr) && len <= FBINK_DAEMON_RING_SLOT_SIZE && hdr.magic == FBINK_DAEMON_MAGIC &&
+		    hdr.version == FBINK_DAEMON_VERSION && hdr.size == len - sizeof(hdr)) {
+			// First things first, do an explicit reinit, as we might have been running for a while.
+			if (unlikely(daemon_reinit(fbfd, daemon_cfg) < 0)) {
+				PFWARN("fbink_reinit");
+				return ERRCODE(EXIT_FAILURE);
+			}
+
+			reply.rv = handle_daemon_msg(fbfd, &hdr, slot->data + sizeof(hdr), daemon_cfg, daemon_ot_cfg, dumps);
+			if (reply.rv < 0) {
+				WARN("Failed to handle a message (op: %hhu): %d", hdr.op, reply.rv);
+			} else if (hdr.flags & FBINK_DAEMON_FLAG_WAIT) {
+				// NOTE: This may legitimately fail w/ ENOSYS on devices w/o this ioctl, which is fine.
+				fbink_wait_for_complete(fbfd, LAST_MARKER);
+			}
+		} else {
+			WARN("Found a malformed message in slot %u (%u bytes)", head & (FBINK_DAEMON_RING_SLOTS - 1U), len);
+		}
+
+		// Hand the slot back, either to its producer, so it can collect the reply, or straight to the next lap
+		if (hdr.flags & FBINK_DAEMON_FLAG_REPLY) {
+			reply.marker    = fbink_get_last_marker();
+			reply.last_rect = fbink_get_last_rect(false);
+			slot->reply     = reply;
+			__atomic_store_n(&slot->seq, head + 2U, __ATOMIC_RELEASE);
+		} else {
+			__atomic_store_n(&slot->seq, head + FBINK_DAEMON_RING_SLOTS, __ATOMIC_RELEASE);
+		}
+		fbink_daemon_futex(&slot->seq, FUTEX_WAKE, INT_MAX, NULL);
+		head++;
+	}
+
+	return EXIT_SUCCESS;
+}
+
 // Small utility functions for want_lastrect
 static void
     compute_lastrect(void)
@@ -832,6 +1388,7 @@ int
 	bool                        is_help        = false;
 	const char*                 pipe_path      = NULL;
 	bool                        is_daemon      = false;
+	bool                        is_binary      = false;
 	uint8_t                     daemon_lines   = 0U;
 	bool                        wait_for       = false;
 	uint8_t                     progress       = 0;
@@ -2024,6 +2581,15 @@ int
 	int fbfd   = -1;
 	// Same idea for the pipe fd in daemon mode
 	int pipefd = -1;
+	// And the socket in socket mode
+	int         sockfd      = -1;
+	const char* socket_path = NULL;
+	// And the shared memory in ring mode
+	FBInkDaemonRing* ring      = NULL;
+	const char*      ring_path = NULL;
+	// And the binary protocol's state
+	FBInkDaemonBuffer msg_buf                        = { 0 };
+	FBInkDump         dumps[FBINK_DAEMON_DUMP_SLOTS] = { 0 };
 
 	// Show the "help" message
 	if (is_help) {
@@ -2252,6 +2818,90 @@ int
 			goto cleanup;
 		}
 
+		// Make sure we only load fonts once...
+		if (is_truetype) {
+			load_ot_fonts(reg_ot_file, bd_ot_file, it_ot_file, bdit_ot_file, &fbink_cfg, &ot_config);
+		}
+
+		// If we were asked to listen on a Unix socket, do that instead of the named pipe.
+		// NOTE: This implies the binary protocol.
+		const char* custom_socket = getenv("FBINK_DAEMON_SOCKET");
+		if (custom_socket) {
+			struct sockaddr_un addr = { .sun_family = AF_UNIX };
+			if (strlen(custom_socket) >= sizeof(addr.sun_path)) {
+				WARN("Socket path '%s' is too long", custom_socket);
+				rv = ERRCODE(ENAMETOOLONG);
+				goto cleanup;
+			}
+			strcpy(addr.sun_path, custom_socket);    // Flawfinder: ignore
+
+			sockfd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+			if (sockfd == -1) {
+				PFWARN("socket: %m");
+				rv = ERRCODE(EXIT_FAILURE);
+				goto cleanup;
+			}
+			// NOTE: As with the pipe, you cannot re-use an existing socket!
+			if (bind(sockfd, (const struct sockaddr*) &addr, sizeof(addr)) != 0) {
+				PFWARN("bind(%s): %m", custom_socket);
+				rv = ERRCODE(EXIT_FAILURE);
+				goto cleanup;
+			}
+			// Now that it's ours, we're responsible for deleting it
+			socket_path = custom_socket;
+			if (listen(sockfd, FBINK_DAEMON_MAX_CLIENTS) != 0) {
+				PFWARN("listen: %m");
+				rv = ERRCODE(EXIT_FAILURE);
+				goto cleanup;
+			}
+
+			rv = serve_daemon_socket(fbfd, sockfd, &msg_buf, &fbink_cfg, &ot_config, dumps);
+			goto cleanup;
+		}
+
+		// Or to setup a shared memory ring, do that instead, too.
+		// NOTE: This implies the binary protocol.
+		const char* custom_ring = getenv("FBINK_DAEMON_RING");
+		if (custom_ring) {
+			// NOTE: As with the pipe, you cannot re-use an existing file!
+			int ringfd = open(custom_ring, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0666);
+			if (ringfd == -1) {
+				PFWARN("open(%s): %m", custom_ring);
+				rv = ERRCODE(EXIT_FAILURE);
+				goto cleanup;
+			}
+			// Now that it's ours, we're responsible for deleting it
+			ring_path = custom_ring;
+			if (ftruncate(ringfd, sizeof(*ring)) != 0) {
+				PFWARN("ftruncate: %m");
+				close(ringfd);
+				rv = ERRCODE(EXIT_FAILURE);
+				goto cleanup;
+			}
+			void* map = mmap(NULL, sizeof(*ring), PROT_READ | PROT_WRITE, MAP_SHARED, ringfd, 0);
+			// NOTE: The mapping doesn't need the fd to stick around
+			close(ringfd);
+			if (map == MAP_FAILED) {
+				PFWARN("mmap: %m");
+				rv = ERRCODE(EXIT_FAILURE);
+				goto cleanup;
+			}
+			ring = map;
+
+			// ftruncate zero-filled it for us, so we just need to setup the slots, and then the header,
+			// with the magic last, so that producers can check it to know we're ready.
+			for (uint32_t i = 0U; i < FBINK_DAEMON_RING_SLOTS; i++) {
+				ring->slot[i].seq = i;
+			}
+			ring->version   = FBINK_DAEMON_VERSION;
+			ring->slots     = FBINK_DAEMON_RING_SLOTS;
+			ring->slot_size = FBINK_DAEMON_RING_SLOT_SIZE;
+			__atomic_store_n(&ring->magic, FBINK_DAEMON_RING_MAGIC, __ATOMIC_RELEASE);
+
+			rv = serve_daemon_ring(fbfd, ring, &fbink_cfg, &ot_config, dumps);
+			goto cleanup;
+		}
+
 		// If we want to use a custom pipe name, honor that...
 		const char* custom_pipe = getenv("FBINK_NAMED_PIPE");
 		if (custom_pipe) {
@@ -2283,9 +2933,10 @@ int
 			goto cleanup;
 		}
 
-		// Make sure we only load fonts once...
-		if (is_truetype) {
-			load_ot_fonts(reg_ot_file, bd_ot_file, it_ot_file, bdit_ot_file, &fbink_cfg, &ot_config);
+		// Check which protocol we're supposed to speak...
+		const char* protocol = getenv("FBINK_DAEMON_PROTOCOL");
+		if (protocol && strcasecmp(protocol, "binary") == 0) {
+			is_binary = true;
 		}
 
 		// We'll need to keep track of the amount of printed lines to honor daemon_lines...
@@ -2319,7 +2970,13 @@ int
 			}
 
 			if (pn > 0) {
-				if (pfd.revents & POLLIN) {
+				if (pfd.revents & POLLIN && is_binary) {
+					if (read_daemon_fifo(fbfd, pfd.fd, &msg_buf, &fbink_cfg, &ot_config, dumps) !=
+					    EXIT_SUCCESS) {
+						rv = ERRCODE(EXIT_FAILURE);
+						goto cleanup;
+					}
+				} else if (pfd.revents & POLLIN) {
 					// We've got data to read, do it!
 					char    buf[PIPE_BUF] = { 0 };
 					ssize_t bytes_read    = 0;
@@ -2345,7 +3002,7 @@ int
 					}
 
 					// First things first, do an explicit reinit, as we might have been running for a while.
-					if (unlikely(fbink_reinit(fbfd, &fbink_cfg) < 0)) {
+					if (unlikely(daemon_reinit(fbfd, &fbink_cfg) < 0)) {
 						// We don't track state, so we only need to handle plain failures.
 						PFWARN("fbink_reinit");
 						rv = ERRCODE(EXIT_FAILURE);
@@ -2993,6 +3650,32 @@ cleanup:
 				PFWARN("unlink(%s): %m", pipe_path);
 			}
 		}
+		if (sockfd != -1) {
+			if (close(sockfd) != 0) {
+				PFWARN("close: %m");
+			}
+		}
+		if (socket_path) {
+			if (unlink(socket_path) != 0) {
+				PFWARN("unlink(%s): %m", socket_path);
+			}
+		}
+		if (ring) {
+			if (munmap(ring, sizeof(*ring)) != 0) {
+				PFWARN("munmap: %m");
+			}
+		}
+		if (ring_path) {
+			if (unlink(ring_path) != 0) {
+				PFWARN("unlink(%s): %m", ring_path);
+			}
+		}
+		free(msg_buf.data);
+		for (size_t i = 0U; i < FBINK_DAEMON_DUMP_SLOTS; i++) {
+			if (dumps[i].data) {
+				fbink_free_dump_data(&dumps[i]);
+			}
+		}
 	}
 
 	if (fbink_close(fbfd) == ERRCODE(EXIT_FAILURE)) {
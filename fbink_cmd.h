@@ -23,6 +23,7 @@
 #define __FBINK_CMD_H
 
 #include "fbink.h"
+#include "fbink_daemon.h"
 
 #include <alloca.h>
 #include <errno.h>
@@ -37,8 +38,11 @@
 #include <string.h>
 #include <strings.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/un.h>
 #include <syslog.h>
 #include <time.h>
 #include <unistd.h>
@@ -66,6 +70,12 @@
 // Where our named pipe lives (/tmp should be a safe bet on every supported platform)
 #define FBINK_PIPE "/tmp/fbink-fifo"
 
+// How many clients we'll serve concurrently in socket mode
+#define FBINK_DAEMON_MAX_CLIENTS 16U
+
+// How long the daemon can go without checking for fb state changes (c.f., daemon_reinit)
+#define FBINK_DAEMON_REINIT_INTERVAL_MS 500L
+
 // We'll need a global instead of relying on the FBInkConfig field, because we're using these macros in various places:
 // where we have a *pointer* to an FBInkConfig struct, where we have an *instance* of it, or where we have nothing...
 bool toSysLog = false;
@@ -123,6 +133,26 @@ FBInkSigInfo g_sigCaught = { 0 };
 static void  cleanup_handler(int __attribute__((unused)), siginfo_t*, void* __attribute__((unused)));
 static int   daemonize(void);
 
+// Used to reassemble binary daemon messages
+typedef struct
+{
+	unsigned char* data;
+	size_t         len;
+	size_t         cap;
+} FBInkDaemonBuffer;
+static int daemon_reinit(int, const FBInkConfig*);
+static int handle_daemon_msg(int,
+			     const FBInkDaemonHeader*,
+			     const unsigned char*,
+			     const FBInkConfig*,
+			     const FBInkOTConfig*,
+			     FBInkDump*);
+static void process_daemon_buffer(int, FBInkDaemonBuffer*, const FBInkConfig*, const FBInkOTConfig*, FBInkDump*);
+static int read_daemon_fifo(int, int, FBInkDaemonBuffer*, const FBInkConfig*, const FBInkOTConfig*, FBInkDump*);
+static int handle_daemon_packet(int, int, FBInkDaemonBuffer*, const FBInkConfig*, const FBInkOTConfig*, FBInkDump*);
+static int serve_daemon_socket(int, int, FBInkDaemonBuffer*, const FBInkConfig*, const FBInkOTConfig*, FBInkDump*);
+static int serve_daemon_ring(int, FBInkDaemonRing*, const FBInkConfig*, const FBInkOTConfig*, FBInkDump*);
+
 static int do_infinite_progress_bar(int, const FBInkConfig*);
 
 static void load_ot_fonts(const char*, const char*, const char*, const char*, const FBInkConfig*, FBInkOTConfig*);
@@ -0,0 +1,258 @@
+/*
+	FBInk: FrameBuffer eInker, a library to print text & images to an eInk Linux framebuffer
+	Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef __FBINK_DAEMON_H
+#define __FBINK_DAEMON_H
+
+// Wire format of the binary protocol spoken by the CLI tool's daemon mode (c.f., fbink -d & CLI.md).
+// Over the FIFO, it's a plain stream of messages, while in socket mode (SOCK_SEQPACKET), each packet is a single message.
+// NOTE: This is a purely local IPC mechanism: everything is in host byte order, with native struct layouts,
+//       which is why the structs below are shared with the fbink.h ones (e.g., FBInkConfig).
+//       In practice, this means that clients need to be built against the same FBInk version as the daemon,
+//       which is enforced by the version field in the header.
+
+#include "fbink.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// "FBNK", in little-endian
+#define FBINK_DAEMON_MAGIC 0x4B4E4246u
+// Bumped whenever anything in this file (or any of the fbink.h structs embedded in a message) changes.
+#define FBINK_DAEMON_VERSION 1U
+// Sanity limit on the payload size (for reference, a full 32bpp dump of a 1872x1404 screen is ~10MB)
+#define FBINK_DAEMON_MAX_PAYLOAD (32U * 1024U * 1024U)
+// Amount of dump slots available for FBINK_OP_DUMP & FBINK_OP_RESTORE
+#define FBINK_DAEMON_DUMP_SLOTS 8U
+
+// What a message asks the daemon to do
+typedef enum
+{
+	FBINK_OP_PRINT = 1U,    // fbink_print. Payload: a UTF-8 string (no NUL terminator needed)
+	FBINK_OP_PRINT_OT,      // fbink_print_ot. Payload: a UTF-8 string (requires the daemon to have been started w/ -t)
+	FBINK_OP_IMAGE,         // fbink_print_image. Payload: an FBInkDaemonImage, followed by a path
+	FBINK_OP_RAW,           // fbink_print_raw_data. Payload: an FBInkDaemonRaw, followed by the pixel data
+	FBINK_OP_FILL,          // fbink_fill_rect_rgba. Payload: an FBInkDaemonFill
+	FBINK_OP_REFRESH,       // fbink_refresh_rect. Payload: an FBInkRect (empty for a full-screen refresh)
+	FBINK_OP_DUMP,          // fbink_rect_dump. Payload: an FBInkDaemonDump
+	FBINK_OP_RESTORE,       // fbink_restore. Payload: an FBInkDaemonDump (only slot is used)
+	FBINK_OP_MAX = UINT8_MAX,    // uint8_t
+} __attribute__((packed)) FBINK_DAEMON_OP_INDEX_E;
+typedef uint8_t FBINK_DAEMON_OP_INDEX_T;
+
+// Flags, affecting the layout of the payload
+// NOTE: When set, the payload starts with a full FBInkConfig, which replaces the daemon's own (for this message only).
+//       Fields that only matter at init time (fontmult, fontname, no_viewport, is_verbose, is_quiet & to_syslog)
+//       are ignored, the daemon's own values are used instead.
+#define FBINK_DAEMON_FLAG_CFG 0x01u
+// NOTE: When set, it's then followed by a full FBInkOTConfig (its font field is ignored), same deal.
+//       Only honored by FBINK_OP_PRINT_OT.
+#define FBINK_DAEMON_FLAG_OT_CFG 0x02u
+// NOTE: Socket & ring modes only: wait for the refresh to actually complete before replying (c.f., fbink_wait_for_complete).
+#define FBINK_DAEMON_FLAG_WAIT 0x04u
+// NOTE: Ring mode only: the producer wants a reply, and *will* collect it via fbink_daemon_ring_wait.
+#define FBINK_DAEMON_FLAG_REPLY 0x08u
+
+// Every message starts with this header, immediately followed by size bytes of payload.
+typedef struct
+{
+	uint32_t                magic;       // FBINK_DAEMON_MAGIC
+	uint32_t                size;        // Size of the payload (i.e., header excluded), in bytes
+	uint8_t                 version;     // FBINK_DAEMON_VERSION
+	FBINK_DAEMON_OP_INDEX_T op;          // FBINK_DAEMON_OP_INDEX_E
+	uint8_t                 flags;       // FBINK_DAEMON_FLAG_*
+	uint8_t                 reserved;    // Must be 0
+} FBInkDaemonHeader;
+
+typedef struct
+{
+	short int x_off;
+	short int y_off;
+} FBInkDaemonImage;
+
+typedef struct
+{
+	int       w;
+	int       h;
+	short int x_off;
+	short int y_off;
+} FBInkDaemonRaw;
+
+typedef struct
+{
+	FBInkRect rect;    // Empty for the full screen
+	bool      no_rota;
+	uint8_t   r;
+	uint8_t   g;
+	uint8_t   b;
+	uint8_t   a;
+} FBInkDaemonFill;
+
+typedef struct
+{
+	FBInkRect rect;        // Empty for a full dump
+	uint8_t   slot;        // < FBINK_DAEMON_DUMP_SLOTS
+	bool      compress;    // c.f., fbink_compress_dump
+} FBInkDaemonDump;
+
+// In socket mode, every message gets one of these in reply, in a single packet.
+typedef struct
+{
+	int32_t   rv;           // Return value of the FBInk call (or -(EINVAL) for a malformed message)
+	uint32_t  marker;       // fbink_get_last_marker
+	FBInkRect last_rect;    // fbink_get_last_rect
+} FBInkDaemonReply;
+
+// Shared memory ring mode (c.f., FBINK_DAEMON_RING in CLI.md).
+// The daemon creates (and owns) a file containing an FBInkDaemonRing, that producers mmap (MAP_SHARED),
+// and push messages to, without any lock: it's a bounded multi-producer, single-consumer queue,
+// where each slot's sequence number tells who owns it, for a given ticket t (i.e., t % FBINK_DAEMON_RING_SLOTS):
+//   seq == t                          -> free, the producer that got ticket t from tail can fill it
+//   seq == t + 1                      -> published, waiting for the daemon
+//   seq == t + 2                      -> handled, reply available (FBINK_DAEMON_FLAG_REPLY only)
+//   seq == t + FBINK_DAEMON_RING_SLOTS -> free again, for the next lap
+// seq doubles as a (shared) futex word, and so does doorbell, which producers bump after publishing to wake the daemon up.
+// Messages are handled in ticket order, one at a time.
+// NOTE: A producer that dies after having claimed a ticket, but before having published it,
+//       or without having collected a reply it asked for, *will* stall the queue for everyone!
+// "RING", in little-endian
+#define FBINK_DAEMON_RING_MAGIC 0x474E4952u
+// Must be a power of two
+#define FBINK_DAEMON_RING_SLOTS 16U
+// Maximum size of a single message (header included). Larger ones have to go through the FIFO or the socket.
+#define FBINK_DAEMON_RING_SLOT_SIZE (256U * 1024U)
+
+typedef struct
+{
+	uint32_t         seq;      // c.f., above
+	uint32_t         len;      // Size of the message (header included)
+	FBInkDaemonReply reply;    // Only valid once seq == t + 2
+	unsigned char    data[FBINK_DAEMON_RING_SLOT_SIZE] __attribute__((aligned(8)));    // A full message, header first
+} FBInkDaemonRingSlot;
+
+typedef struct
+{
+	uint32_t magic;        // FBINK_DAEMON_RING_MAGIC
+	uint32_t version;      // FBINK_DAEMON_VERSION
+	uint32_t slots;        // FBINK_DAEMON_RING_SLOTS
+	uint32_t slot_size;    // FBINK_DAEMON_RING_SLOT_SIZE
+	// NOTE: Keep the contended words on their own cachelines
+	uint32_t            tail __attribute__((aligned(64)));        // Next ticket
+	uint32_t            doorbell __attribute__((aligned(64)));    // Bumped after each publication
+	FBInkDaemonRingSlot slot[FBINK_DAEMON_RING_SLOTS] __attribute__((aligned(64)));
+} FBInkDaemonRing;
+
+// NOTE: The mapping is shared between processes, so we can't use the private futex ops.
+static inline long int
+    fbink_daemon_futex(uint32_t* uaddr, int op, uint32_t val, const struct timespec* timeout)
+{
+	return syscall(SYS_futex, uaddr, op, val, timeout, NULL, 0);
+}
+
+// Push a message (i.e., an FBInkDaemonHeader immediately followed by its payload) to the ring.
+// Returns 0 on success, storing the message's ticket in *ticket (needed for fbink_daemon_ring_wait).
+// Returns -(EMSGSIZE) if the message is larger than FBINK_DAEMON_RING_SLOT_SIZE.
+// Returns -(EAGAIN) if the ring is full, and nonblock is true (otherwise, this blocks until a slot frees up).
+// Returns -(EINTR) if we were interrupted by a signal while waiting for a slot.
+static inline int
+    fbink_daemon_ring_submit(FBInkDaemonRing* ring, const void* msg, size_t len, bool nonblock, uint32_t* ticket)
+{
+	if (len > FBINK_DAEMON_RING_SLOT_SIZE) {
+		return -(EMSGSIZE);
+	}
+
+	FBInkDaemonRingSlot* slot;
+	uint32_t             t = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+	while (1) {
+		slot               = &ring->slot[t & (FBINK_DAEMON_RING_SLOTS - 1U)];
+		const uint32_t seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+		const int32_t  dif = (int32_t) (seq - t);
+		if (dif == 0) {
+			// It's free, try to grab the ticket (on failure, t is updated to the current tail)
+			if (__atomic_compare_exchange_n(&ring->tail, &t, t + 1U, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+				break;
+			}
+		} else if (dif < 0) {
+			// It's still in use from the previous lap, i.e., we're full: that's our backpressure.
+			if (nonblock) {
+				return -(EAGAIN);
+			}
+			if (fbink_daemon_futex(&slot->seq, FUTEX_WAIT, seq, NULL) == -1 && errno == EINTR) {
+				return -(EINTR);
+			}
+			t = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+		} else {
+			// Someone else got this ticket first
+			t = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+		}
+	}
+
+	memcpy(slot->data, msg, len);
+	slot->len = (uint32_t) len;
+	__atomic_store_n(&slot->seq, t + 1U, __ATOMIC_RELEASE);
+
+	// Ring the bell
+	__atomic_add_fetch(&ring->doorbell, 1U, __ATOMIC_RELEASE);
+	fbink_daemon_futex(&ring->doorbell, FUTEX_WAKE, 1U, NULL);
+
+	*ticket = t;
+	return 0;
+}
+
+// Wait for the daemon to handle the message with the given ticket, collect its reply, and release its slot.
+// Only valid for messages sent with FBINK_DAEMON_FLAG_REPLY (and you *have* to call it for those).
+// Returns 0 on success, or -(EINTR) if we were interrupted by a signal (just call it again).
+static inline int
+    fbink_daemon_ring_wait(FBInkDaemonRing* ring, uint32_t ticket, FBInkDaemonReply* reply)
+{
+	FBInkDaemonRingSlot* slot = &ring->slot[ticket & (FBINK_DAEMON_RING_SLOTS - 1U)];
+	while (1) {
+		const uint32_t seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+		if (seq == ticket + 2U) {
+			break;
+		}
+		if (fbink_daemon_futex(&slot->seq, FUTEX_WAIT, seq, NULL) == -1 && errno == EINTR) {
+			return -(EINTR);
+		}
+	}
+
+	*reply = slot->reply;
+	__atomic_store_n(&slot->seq, ticket + FBINK_DAEMON_RING_SLOTS, __ATOMIC_RELEASE);
+	// Wake up anyone waiting for room
+	fbink_daemon_futex(&slot->seq, FUTEX_WAKE, INT_MAX, NULL);
+
+	return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -26,62 +26,62 @@
 // NOTE: This is adapted from KindleTool,
 //       c.f., https://github.com/NiLuJe/KindleTool/blob/master/KindleTool/kindle_tool.h#L189
 static bool
-    is_kindle_device(uint32_t dev)
+    is_kindle_device(FBInkContext* restrict ctx, uint32_t dev)
 {
 	switch (dev) {
 		case 0x01u:    // K1
-			deviceQuirks.isKindleLegacy = true;
-			strtcpy(deviceQuirks.deviceName, "1", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Fiona", sizeof(deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.isKindleLegacy = true;
+			strtcpy(ctx->deviceQuirks.deviceName, "1", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Fiona", sizeof(ctx->deviceQuirks.deviceCodename));
 			// NOTE: Possibly Fiona, too, as ADS was a proto.
 			//       But later models have shown than a proto's board name often ends up naming the platform...
-			strtcpy(deviceQuirks.devicePlatform, "ADS", sizeof(deviceQuirks.devicePlatform));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "ADS", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x02u:    // K2
 		case 0x03u:
-			deviceQuirks.isKindleLegacy = true;
-			strtcpy(deviceQuirks.deviceName, "2", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Turing", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mario", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isKindleLegacy = true;
+			strtcpy(ctx->deviceQuirks.deviceName, "2", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Turing", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mario", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x04u:    // KDX
 		case 0x05u:
 		case 0x09u:
-			deviceQuirks.isKindleLegacy = true;
-			deviceQuirks.screenDPI      = 150U;
-			strtcpy(deviceQuirks.deviceName, "DX", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Nell", sizeof(deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.isKindleLegacy = true;
+			ctx->deviceQuirks.screenDPI      = 150U;
+			strtcpy(ctx->deviceQuirks.deviceName, "DX", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Nell", sizeof(ctx->deviceQuirks.deviceCodename));
 			// NOTE: Possibly Banjo? Never figured out if that platform ever saw the light of day...
-			strtcpy(deviceQuirks.devicePlatform, "Mario", sizeof(deviceQuirks.devicePlatform));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mario", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x08u:    // K3
 		case 0x06u:
 		case 0x0Au:
-			deviceQuirks.isKindleLegacy = true;
-			strtcpy(deviceQuirks.deviceName, "3", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Shasta", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Luigi", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isKindleLegacy = true;
+			strtcpy(ctx->deviceQuirks.deviceName, "3", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Shasta", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Luigi", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x0Eu:    // K4
-			deviceQuirks.isKindleLegacy = true;
-			strtcpy(deviceQuirks.deviceName, "4", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Tequila", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Yoshi", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isKindleLegacy = true;
+			strtcpy(ctx->deviceQuirks.deviceName, "4", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Tequila", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Yoshi", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x0Fu:    // K5
 		case 0x11u:
 		case 0x10u:
 		case 0x12u:
-			deviceQuirks.isKindlePearlScreen = true;
-			strtcpy(deviceQuirks.deviceName, "Touch", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Whitney", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Yoshi", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isKindlePearlScreen = true;
+			strtcpy(ctx->deviceQuirks.deviceName, "Touch", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Whitney", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Yoshi", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x23u:    // K4b
-			deviceQuirks.isKindleLegacy = true;
-			strtcpy(deviceQuirks.deviceName, "4", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Sauza", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Yoshi", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isKindleLegacy = true;
+			strtcpy(ctx->deviceQuirks.deviceName, "4", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Sauza", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Yoshi", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x24u:    // PW1
 		case 0x1Bu:
@@ -89,12 +89,12 @@ static bool
 		case 0x1Du:
 		case 0x1Fu:
 		case 0x20u:
-			deviceQuirks.isKindlePearlScreen = true;
-			deviceQuirks.screenDPI           = 212U;
-			strtcpy(deviceQuirks.deviceName, "PaperWhite", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Celeste", sizeof(deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.isKindlePearlScreen = true;
+			ctx->deviceQuirks.screenDPI           = 212U;
+			strtcpy(ctx->deviceQuirks.deviceName, "PaperWhite", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Celeste", sizeof(ctx->deviceQuirks.deviceCodename));
 			// NOTE: AKA Yoshime3
-			strtcpy(deviceQuirks.devicePlatform, "Yoshime", sizeof(deviceQuirks.devicePlatform));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Yoshime", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0xD4u:    // PW2
 		case 0x5Au:
@@ -110,56 +110,56 @@ static bool
 		case 0x62u:
 		case 0x61u:
 		case 0x5Fu:
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceName, "PaperWhite 2", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Pinot", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Wario", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceName, "PaperWhite 2", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Pinot", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Wario", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0xC6u:    // KT2
-			strtcpy(deviceQuirks.deviceName, "Basic", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Bourbon", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Wario", sizeof(deviceQuirks.devicePlatform));
+			strtcpy(ctx->deviceQuirks.deviceName, "Basic", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Bourbon", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Wario", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x13u:    // KV
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceName, "Voyage", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Icewine", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Wario", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Voyage", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Icewine", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Wario", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x16u:    // ??
 		case 0x21u:
-			strtcpy(deviceQuirks.deviceName, "Unknown!", sizeof(deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceName, "Unknown!", sizeof(ctx->deviceQuirks.deviceName));
 			return true;
 		case 0x54u:    // KV
 		case 0x2Au:
 		case 0x4Fu:
 		case 0x52u:
 		case 0x53u:
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceName, "Voyage", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Icewine", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Wario", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Voyage", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Icewine", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Wario", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x07u:    // ??
 		case 0x0Bu:
 		case 0x0Cu:
 		case 0x0Du:
 		case 0x99u:
-			strtcpy(deviceQuirks.deviceName, "Unknown!", sizeof(deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceName, "Unknown!", sizeof(ctx->deviceQuirks.deviceName));
 			return true;
 		case 0xDDu:    // KT2 AUS
-			strtcpy(deviceQuirks.deviceName, "Basic", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Bourbon", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Wario", sizeof(deviceQuirks.devicePlatform));
+			strtcpy(ctx->deviceQuirks.deviceName, "Basic", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Bourbon", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Wario", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		default:
-			strtcpy(deviceQuirks.deviceName, "Unidentified!", sizeof(deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceName, "Unidentified!", sizeof(ctx->deviceQuirks.deviceName));
 			return false;
 	}
 }
 
 static bool
-    is_kindle_device_new(uint32_t dev)
+    is_kindle_device_new(FBInkContext* restrict ctx, uint32_t dev)
 {
 	switch (dev) {
 		case 0x201u:    // PW3
@@ -176,10 +176,10 @@ static bool
 		case 0x270u:
 		case 0x293u:
 		case 0x294u:
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceName, "PaperWhite 3", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Muscat", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Wario", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "PaperWhite 3", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Muscat", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Wario", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x20Cu:    // KOA
 		case 0x20Du:
@@ -187,17 +187,17 @@ static bool
 		case 0x21Au:
 		case 0x21Bu:
 		case 0x21Cu:
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceName, "Oasis", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Whisky", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Duet", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Oasis", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Whisky", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Duet", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x1BCu:    // KT3
 		case 0x269u:
 		case 0x26Au:
-			strtcpy(deviceQuirks.deviceName, "Basic 2", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Eanab", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Heisenberg", sizeof(deviceQuirks.devicePlatform));
+			strtcpy(ctx->deviceQuirks.deviceName, "Basic 2", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Eanab", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Heisenberg", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x295u:    // KOA2
 		case 0x296u:
@@ -214,12 +214,12 @@ static bool
 		case 0x344u:
 		case 0x347u:
 		case 0x34Au:
-			deviceQuirks.isKindleZelda = true;
-			deviceQuirks.hasEclipseWfm = true;
-			deviceQuirks.screenDPI     = 300U;
-			strtcpy(deviceQuirks.deviceName, "Oasis 2", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Cognac", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Zelda", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isKindleZelda = true;
+			ctx->deviceQuirks.hasEclipseWfm = true;
+			ctx->deviceQuirks.screenDPI     = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Oasis 2", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Cognac", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Zelda", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x2F7u:    // PW4
 		case 0x361u:
@@ -242,11 +242,11 @@ static bool
 		case 0x4DBu:
 		case 0x4DCu:
 		case 0x4DDu:
-			deviceQuirks.isKindleRex = true;
-			deviceQuirks.screenDPI   = 300U;
-			strtcpy(deviceQuirks.deviceName, "PaperWhite 4", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Moonshine", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Rex", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isKindleRex = true;
+			ctx->deviceQuirks.screenDPI   = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "PaperWhite 4", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Moonshine", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Rex", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x414u:    // KT4
 		case 0x3CFu:
@@ -254,10 +254,10 @@ static bool
 		case 0x3D1u:
 		case 0x3D2u:
 		case 0x3ABu:
-			deviceQuirks.isKindleRex = true;
-			strtcpy(deviceQuirks.deviceName, "Basic 3", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Jaeger", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Rex", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isKindleRex = true;
+			strtcpy(ctx->deviceQuirks.deviceName, "Basic 3", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Jaeger", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Rex", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x434u:    // KOA3
 		case 0x3D8u:
@@ -265,12 +265,12 @@ static bool
 		case 0x3D6u:
 		case 0x3D5u:
 		case 0x3D4u:
-			deviceQuirks.isKindleZelda = true;
-			deviceQuirks.hasEclipseWfm = true;
-			deviceQuirks.screenDPI     = 300U;
-			strtcpy(deviceQuirks.deviceName, "Oasis 3", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Stinger", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Zelda", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isKindleZelda = true;
+			ctx->deviceQuirks.hasEclipseWfm = true;
+			ctx->deviceQuirks.screenDPI     = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Oasis 3", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Stinger", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Zelda", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x690u:    // PW5
 		case 0x700u:
@@ -281,12 +281,12 @@ static bool
 		case 0x971u:
 		case 0x972u:
 		case 0x9B3u:
-			deviceQuirks.isMTK         = true;
-			deviceQuirks.hasEclipseWfm = true;
-			deviceQuirks.screenDPI     = 300U;
-			strtcpy(deviceQuirks.deviceName, "PaperWhite 5", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Malbec", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Bellatrix", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isMTK         = true;
+			ctx->deviceQuirks.hasEclipseWfm = true;
+			ctx->deviceQuirks.screenDPI     = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "PaperWhite 5", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Malbec", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Bellatrix", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x84Du:    // KT5
 		case 0x8BBu:
@@ -295,12 +295,12 @@ static bool
 		case 0x957u:
 		case 0x7F1u:
 		case 0x84Cu:
-			deviceQuirks.isMTK         = true;
-			deviceQuirks.hasEclipseWfm = true;
-			deviceQuirks.screenDPI     = 300U;
-			strtcpy(deviceQuirks.deviceName, "Basic 4", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Cava", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Bellatrix", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isMTK         = true;
+			ctx->deviceQuirks.hasEclipseWfm = true;
+			ctx->deviceQuirks.screenDPI     = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Basic 4", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Cava", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Bellatrix", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x8F2u:    // KS
 		case 0x974u:
@@ -310,12 +310,12 @@ static bool
 		case 0x874u:
 		case 0x875u:
 		case 0x8E0u:
-			deviceQuirks.isMTK         = true;
-			deviceQuirks.hasEclipseWfm = true;
-			deviceQuirks.screenDPI     = 300U;
-			strtcpy(deviceQuirks.deviceName, "Scribe", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Barolo", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Bellatrix3", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isMTK         = true;
+			ctx->deviceQuirks.hasEclipseWfm = true;
+			ctx->deviceQuirks.screenDPI     = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Scribe", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Barolo", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Bellatrix3", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0xE85u:    // KT6
 		case 0xE86u:
@@ -324,12 +324,12 @@ static bool
 		case 0x2909u:
 		case 0xE82u:
 		case 0xE75u:
-			deviceQuirks.isMTK         = true;
-			deviceQuirks.hasEclipseWfm = true;
-			deviceQuirks.screenDPI     = 300U;
-			strtcpy(deviceQuirks.deviceName, "Basic 5", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Rossini", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Bellatrix", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isMTK         = true;
+			ctx->deviceQuirks.hasEclipseWfm = true;
+			ctx->deviceQuirks.screenDPI     = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Basic 5", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Rossini", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Bellatrix", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0xC89u:    // PW6
 		case 0xC86u:
@@ -341,13 +341,13 @@ static bool
 		case 0xE28u:
 		case 0xE45u:
 		case 0xE5Au:
-			deviceQuirks.isMTK              = true;
-			deviceQuirks.isKindleBellatrix4 = true;
-			deviceQuirks.hasEclipseWfm      = true;
-			deviceQuirks.screenDPI          = 300U;
-			strtcpy(deviceQuirks.deviceName, "PaperWhite 6", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Sangria", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Bellatrix4", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isMTK              = true;
+			ctx->deviceQuirks.isKindleBellatrix4 = true;
+			ctx->deviceQuirks.hasEclipseWfm      = true;
+			ctx->deviceQuirks.screenDPI          = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "PaperWhite 6", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Sangria", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Bellatrix4", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0xFA0u:    // KS2
 		case 0xFA1u:
@@ -357,12 +357,12 @@ static bool
 		case 0xFE3u:
 		case 0x102Eu:
 		case 0x102Du:
-			deviceQuirks.isMTK         = true;
-			deviceQuirks.hasEclipseWfm = true;
-			deviceQuirks.screenDPI     = 300U;
-			strtcpy(deviceQuirks.deviceName, "Scribe 2", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Pisco", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Bellatrix3", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isMTK         = true;
+			ctx->deviceQuirks.hasEclipseWfm = true;
+			ctx->deviceQuirks.screenDPI     = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Scribe 2", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Pisco", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Bellatrix3", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0xE29u:    // CS
 		case 0xE24u:
@@ -376,14 +376,14 @@ static bool
 		case 0x10A6u:
 		case 0x10A5u:
 		case 0x11D7u:
-			deviceQuirks.isMTK              = true;
-			deviceQuirks.isKindleBellatrix4 = true;
-			deviceQuirks.hasEclipseWfm      = true;
-			deviceQuirks.screenDPI          = 300U;
-			deviceQuirks.hasColorPanel      = true;
-			strtcpy(deviceQuirks.deviceName, "ColorSoft", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "SeaBreeze", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Bellatrix4", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isMTK              = true;
+			ctx->deviceQuirks.isKindleBellatrix4 = true;
+			ctx->deviceQuirks.hasEclipseWfm      = true;
+			ctx->deviceQuirks.screenDPI          = 300U;
+			ctx->deviceQuirks.hasColorPanel      = true;
+			strtcpy(ctx->deviceQuirks.deviceName, "ColorSoft", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "SeaBreeze", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Bellatrix4", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x12F0u:    // KS3
 		case 0x12EEu:
@@ -392,12 +392,12 @@ static bool
 		case 0x11EAu:
 		case 0x10A4u:
 			// TODO: Double-check this!
-			deviceQuirks.isMTK         = true;
-			deviceQuirks.hasEclipseWfm = true;
-			deviceQuirks.screenDPI     = 300U;
-			strtcpy(deviceQuirks.deviceName, "Scribe 3", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Paloma", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Platpa6", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isMTK         = true;
+			ctx->deviceQuirks.hasEclipseWfm = true;
+			ctx->deviceQuirks.screenDPI     = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Scribe 3", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Paloma", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Platpa6", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x13BFu:    // KS CS
 		case 0x12EFu:
@@ -406,21 +406,21 @@ static bool
 		case 0x11EBu:
 		case 0x10D7u:
 			// TODO: Double-check this!
-			deviceQuirks.isMTK              = true;
-			deviceQuirks.isKindleBellatrix4 = true;
-			deviceQuirks.hasEclipseWfm      = true;
-			deviceQuirks.screenDPI          = 300U;
-			deviceQuirks.hasColorPanel      = true;
-			strtcpy(deviceQuirks.deviceName, "Scribe ColorSoft", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Calvados", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Platcs8", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isMTK              = true;
+			ctx->deviceQuirks.isKindleBellatrix4 = true;
+			ctx->deviceQuirks.hasEclipseWfm      = true;
+			ctx->deviceQuirks.screenDPI          = 300U;
+			ctx->deviceQuirks.hasColorPanel      = true;
+			strtcpy(ctx->deviceQuirks.deviceName, "Scribe ColorSoft", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Calvados", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Platcs8", sizeof(ctx->deviceQuirks.devicePlatform));
 			return true;
 		case 0x146Cu:    // ??
 		case 0x4FB9u:
-			strtcpy(deviceQuirks.deviceName, "Unknown!", sizeof(deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceName, "Unknown!", sizeof(ctx->deviceQuirks.deviceName));
 			return true;
 		default:
-			strtcpy(deviceQuirks.deviceName, "Unidentified!", sizeof(deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceName, "Unidentified!", sizeof(ctx->deviceQuirks.deviceName));
 			return false;
 	}
 }
@@ -511,7 +511,7 @@ static char*
 // NOTE: This is adapted from KindleTool,
 //       c.f., https://github.com/NiLuJe/KindleTool/blob/master/KindleTool/create.c#L1915
 static void
-    identify_kindle(void)
+    identify_kindle(FBInkContext* restrict ctx)
 {
 	FILE* fp = fopen("/proc/usid", "r" STDIO_CLOEXEC);
 	if (!fp) {
@@ -534,7 +534,7 @@ static void
 			// It's in hex, easy peasy.
 			dev = (uint32_t) strtoul(device_code, NULL, 16);
 			// Check if that looks like a known id in the old device id scheme...
-			if (!is_kindle_device(dev)) {
+			if (!is_kindle_device(ctx, dev)) {
 				WARN("Unidentified Kindle device %s (0x%02X) [%.6s]", device_code, dev, serial_no);
 			}
 		} else {
@@ -544,17 +544,17 @@ static void
 			// (these ones are encoded in a slightly custom base 32)
 			dev = from_base(device_code, 32U);
 			// Check if that looks like a known id in the new device id scheme...
-			if (!is_kindle_device_new(dev)) {
+			if (!is_kindle_device_new(ctx, dev)) {
 				WARN("Unidentified Kindle device %s (0x%03X) [%.6s]", device_code, dev, serial_no);
 			}
 		}
 		// Store the device ID...
-		deviceQuirks.deviceId = (unsigned short int) dev;
+		ctx->deviceQuirks.deviceId = (unsigned short int) dev;
 		// HW invert should be safe on Kindle, so just blacklist einkfb devices
-		if (deviceQuirks.isKindleLegacy) {
-			deviceQuirks.canHWInvert = false;
+		if (ctx->deviceQuirks.isKindleLegacy) {
+			ctx->deviceQuirks.canHWInvert = false;
 		} else {
-			deviceQuirks.canHWInvert = true;
+			ctx->deviceQuirks.canHWInvert = true;
 		}
 	}
 }
@@ -562,7 +562,7 @@ static void
 // Read pcb id from NTX_HWCONFIG for BQ/Fnac devices, adapted from OKreader's kobo_hwconfig:
 // https://github.com/lgeek/okreader/blob/master/src/kobo_hwconfig/kobo_hwconfig.c
 static void
-    identify_cervantes(void)
+    identify_cervantes(FBInkContext* restrict ctx)
 {
 	FILE* fp = fopen(HWCONFIG_DEVICE, "re");
 	if (!fp) {
@@ -592,53 +592,53 @@ static void
 		}
 
 		// Store the device ID...
-		deviceQuirks.deviceId                   = config.pcb_id;
+		ctx->deviceQuirks.deviceId                   = config.pcb_id;
 		// Some devices *may* be based on the same board as the Kobo Aura, so, let's be cautious...
-		deviceQuirks.canHWInvert                = false;
+		ctx->deviceQuirks.canHWInvert                = false;
 		// NOTE: See the comments in set_kobo_quirks about this.
 		//       I'm hoping there aren't any special snowflakes in the lineup...
-		deviceQuirks.ntxBootRota                = FB_ROTATE_UD;
+		ctx->deviceQuirks.ntxBootRota                = FB_ROTATE_UD;
 		// Standard NTX rotation quirks...
-		deviceQuirks.ntxRotaQuirk               = NTX_ROTA_STRAIGHT;
-		deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CW;
-		deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
-		deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CCW;
-		deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
-		deviceQuirks.touchSwapAxes              = true;
-		deviceQuirks.touchMirrorX               = true;
+		ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_STRAIGHT;
+		ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CW;
+		ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
+		ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CCW;
+		ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
+		ctx->deviceQuirks.touchSwapAxes              = true;
+		ctx->deviceQuirks.touchMirrorX               = true;
 		// List of supported devices,
 		// c.f., https://github.com/bq/cervantes/blob/master/bqHAL/Devices/mx508/src/DeviceInfoMx508.cpp#L33-L37
 		switch (config.pcb_id) {
 			case DEVICE_CERVANTES_TOUCH:    // BQ Cervantes Touch - Fnac Touch (2012-2013)
-				deviceQuirks.screenDPI = 167U;
-				strtcpy(deviceQuirks.deviceName, "Touch", sizeof(deviceQuirks.deviceName));
+				ctx->deviceQuirks.screenDPI = 167U;
+				strtcpy(ctx->deviceQuirks.deviceName, "Touch", sizeof(ctx->deviceQuirks.deviceName));
 				break;
 			case DEVICE_CERVANTES_TOUCHLIGHT:    // BQ Cervantes TouchLight - Fnac Touch Plus (2012-2013)
-				deviceQuirks.screenDPI = 167U;
-				strtcpy(deviceQuirks.deviceName, "TouchLight", sizeof(deviceQuirks.deviceName));
+				ctx->deviceQuirks.screenDPI = 167U;
+				strtcpy(ctx->deviceQuirks.deviceName, "TouchLight", sizeof(ctx->deviceQuirks.deviceName));
 				break;
 			case DEVICE_CERVANTES_2013:    // BQ Cervantes 2013 - Fnac Touch Light (2013)
-				deviceQuirks.screenDPI = 212U;
-				strtcpy(deviceQuirks.deviceName, "2013", sizeof(deviceQuirks.deviceName));
+				ctx->deviceQuirks.screenDPI = 212U;
+				strtcpy(ctx->deviceQuirks.deviceName, "2013", sizeof(ctx->deviceQuirks.deviceName));
 				break;
 			case DEVICE_CERVANTES_3:    // BQ Cervantes 3 - Fnac Touch Light 2 (2016)
-				deviceQuirks.screenDPI = 300U;
-				strtcpy(deviceQuirks.deviceName, "3", sizeof(deviceQuirks.deviceName));
+				ctx->deviceQuirks.screenDPI = 300U;
+				strtcpy(ctx->deviceQuirks.deviceName, "3", sizeof(ctx->deviceQuirks.deviceName));
 				break;
 			case DEVICE_CERVANTES_4:    // BQ Cervantes 4
-				deviceQuirks.screenDPI = 300U;
-				strtcpy(deviceQuirks.deviceName, "4", sizeof(deviceQuirks.deviceName));
+				ctx->deviceQuirks.screenDPI = 300U;
+				strtcpy(ctx->deviceQuirks.deviceName, "4", sizeof(ctx->deviceQuirks.deviceName));
 				break;
 			default:
 				WARN("Unidentified Cervantes device (%hhu)", config.pcb_id);
-				strtcpy(deviceQuirks.deviceName, "Unknown!", sizeof(deviceQuirks.deviceName));
+				strtcpy(ctx->deviceQuirks.deviceName, "Unknown!", sizeof(ctx->deviceQuirks.deviceName));
 				break;
 		}
 	}
 }
 #	elif defined(FBINK_FOR_KOBO)
 static void
-    set_kobo_quirks(unsigned short int kobo_id)
+    set_kobo_quirks(FBInkContext* restrict ctx, unsigned short int kobo_id)
 {
 	// Attempt to discriminate between the Touch A & B variants...
 	// NOTE: This will only happen if we actually found a Nickel version tag,
@@ -687,11 +687,11 @@ static void
 	}
 
 	// Store the device ID...
-	deviceQuirks.deviceId                   = kobo_id;
+	ctx->deviceQuirks.deviceId                   = kobo_id;
 	// We're a Kobo unless proven otherwise ;)
-	deviceQuirks.isTolino                   = false;
+	ctx->deviceQuirks.isTolino                   = false;
 	// HW invert should *generally* be safe on Kobo, with a few exceptions...
-	deviceQuirks.canHWInvert                = true;
+	ctx->deviceQuirks.canHWInvert                = true;
 	// NOTE: Shaky assumption that almost everything follows the same rotation scheme, with:
 	//       Boot rotation is FB_ROTATE_UD, pickel is FB_ROTATE_UR, nickel is FB_ROTATE_CCW
 	//       With the exception of the Aura HD and the H2O.
@@ -702,391 +702,391 @@ static void
 	//       as does nickel in the default Portrait orientation (buttons on the right).
 	//       I *think* the boot rota is FB_ROTATE_UR,
 	//       but detecting it as pickel instead appears to do the right thing right now, so I'm not going to mess with it...
-	deviceQuirks.ntxBootRota                = FB_ROTATE_UD;
+	ctx->deviceQuirks.ntxBootRota                = FB_ROTATE_UD;
 	// NOTE: Most kernels thankfully don't resort to weird rotation quirks ;).
 	//       c.f., mxc_epdc_fb_check_var @ drivers/video/fbdev/mxc/mxc_epdc_v2_fb.c
-	deviceQuirks.ntxRotaQuirk               = NTX_ROTA_STRAIGHT;
+	ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_STRAIGHT;
 	// NOTE: As far as handling touch coordinates translation, ntxBootRota & ntxRotaQuirk should be considered *deprecated*,
 	//       rotationMap, paired with touchSwapAxes & touchMirrorX/touchMirrorY all paint a much clearer picture...
 	// Most common native -> canonical rotation mapping; {1, 2, 3, 0}
 	// (index is native, value is canonical; beware of that because most custom maps happen to match both ways!)
-	deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CW;
-	deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
-	deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CCW;
-	deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
+	ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CW;
+	ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
+	ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CCW;
+	ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
 	// Most common touch panel setup (while the swap is currently a constant, the mirroring varies on a few devices).
 	// NOTE: This one *happens* to match a sane orientation (touch panel is oriented CCW, i.e., origin at the top-right corner),
 	//       but this isn't always the case!
 	//       This is why we break it down in terms of swap & mirror flags, instead of a simple "touch-to-UR" offset in units of 90° rotations.
-	deviceQuirks.touchSwapAxes              = true;
-	deviceQuirks.touchMirrorX               = true;
+	ctx->deviceQuirks.touchSwapAxes              = true;
+	ctx->deviceQuirks.touchMirrorX               = true;
 	// NOTE: Device code list pilfered from
 	//       https://github.com/pgaskin/KoboStuff/blob/gh-pages/kobofirmware.js#L11
 	//       See also https://github.com/pgaskin/koboutils/pull/1 and the links referenced there
 	//       for all you ever wanted to know about Kobo codenames ;).
 	switch (kobo_id) {
 		case DEVICE_KOBO_TOUCH_A:    // Touch A (trilogy, freescale)
-			deviceQuirks.isKoboNonMT = true;
-			strtcpy(deviceQuirks.deviceName, "Touch A", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.deviceCodename, "Trilogy", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 3", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isKoboNonMT = true;
+			strtcpy(ctx->deviceQuirks.deviceName, "Touch A", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Trilogy", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 3", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_TOUCH_B:    // Touch B (trilogy)
-			deviceQuirks.isKoboNonMT = true;
-			strtcpy(deviceQuirks.deviceName, "Touch B", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Trilogy", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 3", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isKoboNonMT = true;
+			strtcpy(ctx->deviceQuirks.deviceName, "Touch B", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Trilogy", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 3", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_TOUCH_C:    // Touch C (trilogy)
-			deviceQuirks.isKoboNonMT = true;
-			strtcpy(deviceQuirks.deviceName, "Touch C", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Trilogy", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 4", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isKoboNonMT = true;
+			strtcpy(ctx->deviceQuirks.deviceName, "Touch C", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Trilogy", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 4", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_MINI:    // Mini (pixie)
-			deviceQuirks.isKoboNonMT = true;
-			deviceQuirks.screenDPI   = 200U;
-			strtcpy(deviceQuirks.deviceName, "Mini", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Pixie", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 4", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isKoboNonMT = true;
+			ctx->deviceQuirks.screenDPI   = 200U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Mini", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Pixie", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 4", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_GLO:    // Glo (kraken)
-			deviceQuirks.isKoboNonMT                = true;
+			ctx->deviceQuirks.isKoboNonMT                = true;
 			// {3, 2, 1, 0}, but no ioctl quirks
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CCW_TOUCH;
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
-			deviceQuirks.screenDPI                  = 212U;
-			strtcpy(deviceQuirks.deviceName, "Glo", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Kraken", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 4", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CCW_TOUCH;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
+			ctx->deviceQuirks.screenDPI                  = 212U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Glo", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Kraken", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 4", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_GLO_HD:    // Glo HD (alyssum)
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceName, "Glo HD", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Alyssum", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 6", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Glo HD", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Alyssum", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 6", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_TOLINO_SHINE_2HD:    // Tolino Shine 2HD (shine2) (~ Glo HD)
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceName, "Shine 2HD", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Shine2", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 6", sizeof(deviceQuirks.devicePlatform));
-			deviceQuirks.isTolino = true;
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Shine 2HD", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Shine2", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 6", sizeof(ctx->deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isTolino = true;
 			break;
 		case DEVICE_KOBO_TOUCH_2:    // Touch 2.0 (pika)
-			strtcpy(deviceQuirks.deviceName, "Touch 2.0", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Pika", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 6", sizeof(deviceQuirks.devicePlatform));
+			strtcpy(ctx->deviceQuirks.deviceName, "Touch 2.0", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Pika", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 6", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_AURA:    // Aura (phoenix)
 			// NOTE: The bottom 10 pixels are blacked out by Nickel (behind the bezel)
-			deviceQuirks.koboVertOffset = -10;
+			ctx->deviceQuirks.koboVertOffset = -10;
 			// NOTE: According to the nightmode hack, the Aura's kernel *may* be crashy w/ PxP inversion...
-			deviceQuirks.canHWInvert    = false;
-			deviceQuirks.screenDPI      = 212U;
-			strtcpy(deviceQuirks.deviceName, "Aura", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Phoenix", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 5", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.canHWInvert    = false;
+			ctx->deviceQuirks.screenDPI      = 212U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Aura", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Phoenix", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 5", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_AURA_HD:    // Aura HD (dragon)
-			deviceQuirks.isKoboNonMT                = true;
+			ctx->deviceQuirks.isKoboNonMT                = true;
 			// NOTE: Boot rotation is FB_ROTATE_UR, pickel is FB_ROTATE_UD, nickel is FB_ROTATE_CW
-			deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_ALL_INVERTED;
+			ctx->deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_ALL_INVERTED;
 			// {1, 0, 3, 2}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UR;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UD;
-			deviceQuirks.screenDPI                  = 265U;
-			strtcpy(deviceQuirks.deviceName, "Aura HD", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Dragon", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 4", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UR;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UD;
+			ctx->deviceQuirks.screenDPI                  = 265U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Aura HD", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Dragon", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 4", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_AURA_H2O:    // Aura H2O (dahlia)
 			// NOTE: The top 11 pixels are blacked out by Nickel (behind the bezel)
-			deviceQuirks.koboVertOffset             = 11;
+			ctx->deviceQuirks.koboVertOffset             = 11;
 			// NOTE: Boot rotation is FB_ROTATE_UR, pickel is FB_ROTATE_UD, nickel is FB_ROTATE_CW
-			deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
+			ctx->deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
 			// Canonical -> native rotation mapping: { UR: 1, CW: 0, UD: 3, CCW: 2 }
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_ALL_INVERTED;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_ALL_INVERTED;
 			// {1, 0, 3, 2}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UR;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UD;
-			deviceQuirks.screenDPI                  = 265U;
-			strtcpy(deviceQuirks.deviceName, "Aura H2O", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Dahlia", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 5", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UR;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UD;
+			ctx->deviceQuirks.screenDPI                  = 265U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Aura H2O", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Dahlia", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 5", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_AURA_H2O_2:    // Aura H2O² (snow)
 			// NOTE: *Might* be UD like the other ROTA_STRAIGHT devices
-			deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
+			ctx->deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
 			// NOTE: Is indeed NTX_ROTA_STRAIGHT
 			// {3, 0, 1, 2}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UR;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UR;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UD;
 			// Beware, this touch panel quirk *only* applies to r1 devices!
-			deviceQuirks.touchMirrorX               = false;
-			deviceQuirks.screenDPI                  = 265U;
-			strtcpy(deviceQuirks.deviceName, "Aura H2O²", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Snow", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 6", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.touchMirrorX               = false;
+			ctx->deviceQuirks.screenDPI                  = 265U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Aura H2O²", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Snow", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 6", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_AURA_H2O_2_R2:    // Aura H2O² r2 (snow)
-			deviceQuirks.isKoboMk7                  = true;
-			deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
+			ctx->deviceQuirks.isKoboMk7                  = true;
+			ctx->deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
 			// NOTE: *Might* be NTX_ROTA_ODD_INVERTED
 			// {3, 0, 1, 2}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UR;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UD;
-			deviceQuirks.screenDPI                  = 265U;
-			strtcpy(deviceQuirks.deviceName, "Aura H2O² r2", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Snow", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 7", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UR;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UD;
+			ctx->deviceQuirks.screenDPI                  = 265U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Aura H2O² r2", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Snow", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 7", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_AURA_ONE:    // Aura ONE (daylight)
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceName, "Aura One", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Daylight", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 6", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Aura One", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Daylight", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 6", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_AURA_ONE_LE:    // Aura ONE LE (daylight)
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceName, "Aura One LE", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Daylight", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 6", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Aura One LE", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Daylight", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 6", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_AURA_SE:    // Aura SE (star)
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceName, "Aura SE", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Star", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 6", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Aura SE", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Star", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 6", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_TOLINO_VISION:    // Tolino Vision (vision) (~ Aura SE)
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceName, "Tolino Vision", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Vision", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 6", sizeof(deviceQuirks.devicePlatform));
-			deviceQuirks.isTolino = true;
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Tolino Vision", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Vision", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 6", sizeof(ctx->deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isTolino = true;
 			break;
 		case DEVICE_KOBO_AURA_SE_R2:    // Aura SE r2 (star)
-			deviceQuirks.isKoboMk7 = true;
+			ctx->deviceQuirks.isKoboMk7 = true;
 			// NOTE: *Might* be NTX_ROTA_ODD_INVERTED
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceName, "Aura SE r2", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Star", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 7", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Aura SE r2", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Star", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 7", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_CLARA_HD:    // Clara HD (nova)
-			deviceQuirks.isKoboMk7 = true;
+			ctx->deviceQuirks.isKoboMk7 = true;
 			// NOTE: Is indeed NTX_ROTA_STRAIGHT
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceName, "Clara HD", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Nova", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 7", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Clara HD", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Nova", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 7", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_TOLINO_SHINE_3:    // Shine 3 (loki) (~ Clara HD)
-			deviceQuirks.isKoboMk7 = true;
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceName, "Shine 3", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Loki", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 7", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isKoboMk7 = true;
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Shine 3", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Loki", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 7", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_FORMA:    // Forma (frost)
-			deviceQuirks.isKoboMk7                  = true;
-			deviceQuirks.canRotate                  = true;
+			ctx->deviceQuirks.isKoboMk7                  = true;
+			ctx->deviceQuirks.canRotate                  = true;
 			// NOTE: Because Mk.7 and KOBO_HWCFG_DisplayBusWidth (35) is "16Bits_mirror" (3)
 			// Canonical -> native rotation mapping: { UR: 3, CW: 2, UD: 1, CCW: 0 }
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_ODD_INVERTED;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_ODD_INVERTED;
 			// {3, 2, 1, 0}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
-			deviceQuirks.screenDPI                  = 300U;
-			strtcpy(deviceQuirks.deviceName, "Forma", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Frost", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 7", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
+			ctx->deviceQuirks.screenDPI                  = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Forma", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Frost", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 7", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_FORMA_32GB:    // Forma 32GB (frost)
-			deviceQuirks.isKoboMk7                  = true;
-			deviceQuirks.canRotate                  = true;
+			ctx->deviceQuirks.isKoboMk7                  = true;
+			ctx->deviceQuirks.canRotate                  = true;
 			// NOTE: Because Mk.7 and KOBO_HWCFG_DisplayBusWidth (35) is "16Bits_mirror" (3)
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_ODD_INVERTED;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_ODD_INVERTED;
 			// {3, 2, 1, 0}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
-			deviceQuirks.screenDPI                  = 300U;
-			strtcpy(deviceQuirks.deviceName, "Forma 32GB", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Frost", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 7", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
+			ctx->deviceQuirks.screenDPI                  = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Forma 32GB", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Frost", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 7", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_TOLINO_EPOS_2:    // Epos 2 (freya) (~ Forma @ 16GB)
-			deviceQuirks.isKoboMk7                  = true;
-			deviceQuirks.canRotate                  = true;
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_ODD_INVERTED;
+			ctx->deviceQuirks.isKoboMk7                  = true;
+			ctx->deviceQuirks.canRotate                  = true;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_ODD_INVERTED;
 			// {3, 2, 1, 0}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
-			deviceQuirks.screenDPI                  = 300U;
-			strtcpy(deviceQuirks.deviceName, "Epos 2", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Freya", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 7", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
+			ctx->deviceQuirks.screenDPI                  = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Epos 2", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Freya", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 7", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_LIBRA_H2O:    // Libra H2O (storm)
-			deviceQuirks.isKoboMk7                  = true;
+			ctx->deviceQuirks.isKoboMk7                  = true;
 			// NOTE: Boot rotation is FB_ROTATE_UR, pickel is FB_ROTATE_UR, nickel is FB_ROTATE_UR
 			//       And panel is *actually* in Portrait. Finally!
 			//       Despite this, the kernel explicitly mangles the touch translation to match the "usual" layout.
-			deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
-			deviceQuirks.canRotate                  = true;
+			ctx->deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
+			ctx->deviceQuirks.canRotate                  = true;
 			// NOTE: This one deserves a specific entry, because the H2O² also happens to be UR + STRAIGHT,
 			//       but it is decidedly *NOT* sane ;).
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_SANE;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_SANE;
 			// {0, 1, 2, 3}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_UR;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_UD;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_UR;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_CCW;
 			// NOTE: The Libra was the first device to exhibit weirdly broken MXCFB_WAIT_FOR_UPDATE_COMPLETE behavior,
 			//       where the ioctl would apparently randomly timeout after the full 5s for no reason...
 			//       This can be reproduced in Nickel.
 			//       In KOReader, we just sleep for a few ms instead as a workaround, c.f.,
 			//       https://github.com/koreader/koreader-base/blob/21f4b974c7ab64a149075adc32318f87bf71dcdc/ffi/framebuffer_mxcfb.lua#L230-L235
-			deviceQuirks.unreliableWaitFor          = true;
-			deviceQuirks.screenDPI                  = 300U;
-			strtcpy(deviceQuirks.deviceName, "Libra H2O", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Storm", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 7", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.unreliableWaitFor          = true;
+			ctx->deviceQuirks.screenDPI                  = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Libra H2O", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Storm", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 7", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_TOLINO_VISION_5:    // Tolino Vision 5 (arya) (~ Libra H2O)
-			deviceQuirks.isKoboMk7                  = true;
-			deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
-			deviceQuirks.canRotate                  = true;
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_SANE;
+			ctx->deviceQuirks.isKoboMk7                  = true;
+			ctx->deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
+			ctx->deviceQuirks.canRotate                  = true;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_SANE;
 			// {0, 1, 2, 3}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_UR;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_UD;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_CCW;
-			deviceQuirks.unreliableWaitFor          = true;
-			deviceQuirks.screenDPI                  = 300U;
-			strtcpy(deviceQuirks.deviceName, "Vision 5", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Arya", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 7", sizeof(deviceQuirks.devicePlatform));
-			deviceQuirks.isTolino = true;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_UR;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_CCW;
+			ctx->deviceQuirks.unreliableWaitFor          = true;
+			ctx->deviceQuirks.screenDPI                  = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Vision 5", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Arya", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 7", sizeof(ctx->deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isTolino = true;
 			break;
 		case DEVICE_KOBO_NIA:    // Nia (luna)
-			deviceQuirks.isKoboMk7         = true;
+			ctx->deviceQuirks.isKoboMk7         = true;
 			// The board is similar to the Libra 2, so assume it suffers from the same quirks.
-			deviceQuirks.unreliableWaitFor = true;
-			deviceQuirks.screenDPI         = 212U;
-			strtcpy(deviceQuirks.deviceName, "Nia", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Luna", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 7", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.unreliableWaitFor = true;
+			ctx->deviceQuirks.screenDPI         = 212U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Nia", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Luna", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 7", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_ELIPSA:    // Elipsa (Europa)
-			deviceQuirks.isSunxi                    = true;
-			deviceQuirks.hasEclipseWfm              = true;
+			ctx->deviceQuirks.isSunxi                    = true;
+			ctx->deviceQuirks.hasEclipseWfm              = true;
 			// Sunxi means no HW inversion :'(.
 			// (And the nightmode_test flag toggled via the debugfs nightenable/nightdisable command doesn't count,
 			// it just flips the buffer in C, and forces the *K waveform modes (dubbed "eclipse" mode)).
-			deviceQuirks.canHWInvert                = false;
+			ctx->deviceQuirks.canHWInvert                = false;
 			// Has an accelerometer, but Nickel doesn't update the rotate flag, as it's meaningless.
 			// That said, "native" rotation still matches the usual layout, as does the touch panel translation.
-			deviceQuirks.ntxBootRota                = FB_ROTATE_CCW;    // e.g., fat bezel side UP.
-			deviceQuirks.canRotate                  = true;
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_SUNXI;
+			ctx->deviceQuirks.ntxBootRota                = FB_ROTATE_CCW;    // e.g., fat bezel side UP.
+			ctx->deviceQuirks.canRotate                  = true;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_SUNXI;
 			// There's no real linuxfb rotation support, so, {0, 1, 2, 3}
 			// In practice, kobo_sunxi_fb_fixup ensures that the rotate flag returned by fbink_get_state is canonical,
 			// despite what the actual, unused/unsupported by the driver value is...
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_UR;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_UD;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_CCW;
-			deviceQuirks.screenDPI                  = 227U;
-			strtcpy(deviceQuirks.deviceName, "Elipsa", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Europa", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 8", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_UR;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_CCW;
+			ctx->deviceQuirks.screenDPI                  = 227U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Elipsa", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Europa", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 8", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_LIBRA_2:    // Libra 2 (Io)
-			deviceQuirks.hasEclipseWfm = true;
-			deviceQuirks.isKoboMk7     = true;    // Same MXCFB API ;).
+			ctx->deviceQuirks.hasEclipseWfm = true;
+			ctx->deviceQuirks.isKoboMk7     = true;    // Same MXCFB API ;).
 			// Both pickel & nickel then jump to FB_ROTATE_CW...
-			deviceQuirks.ntxBootRota   = FB_ROTATE_UR;
+			ctx->deviceQuirks.ntxBootRota   = FB_ROTATE_UR;
 			// ...KOBO_HWCFG_DisplayBusWidth (35) is "16Bits" (1),
 			// meaning it is indeed NTX_ROTA_STRAIGHT (-ish) ;).
 			// NOTE: Touch panel seems to have forgone part of the usual translation, though,
 			//       it's UR-ish (x & y swapped as usual, but no mirroring at all).
-			deviceQuirks.canRotate     = true;
+			ctx->deviceQuirks.canRotate     = true;
 			// Canonical -> native rotation mapping: { UR: 1, CW: 0, UD: 3, CCW: 2 }
-			deviceQuirks.ntxRotaQuirk  = NTX_ROTA_CW_TOUCH;    // c.f., above, don't trust the name
+			ctx->deviceQuirks.ntxRotaQuirk  = NTX_ROTA_CW_TOUCH;    // c.f., above, don't trust the name
 			// {1, 0, 3, 2}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UR;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UR;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UD;
 			// Same touch panel quirk as the H2O²r1
-			deviceQuirks.touchMirrorX               = false;
+			ctx->deviceQuirks.touchMirrorX               = false;
 			// It apparently inherited its ancestor's issues...
-			deviceQuirks.unreliableWaitFor          = true;
-			deviceQuirks.screenDPI                  = 300U;
-			strtcpy(deviceQuirks.deviceName, "Libra 2", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Io", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 9", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.unreliableWaitFor          = true;
+			ctx->deviceQuirks.screenDPI                  = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Libra 2", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Io", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 9", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_SAGE:    // Sage (Cadmus)
-			deviceQuirks.isSunxi                    = true;
-			deviceQuirks.hasEclipseWfm              = true;
+			ctx->deviceQuirks.isSunxi                    = true;
+			ctx->deviceQuirks.hasEclipseWfm              = true;
 			// NOTE: The EINK_NEGATIVE_MODE flag just does a software inversion
 			//       (pixel by pixel, in plain C, in the eink_image_process kthread).
-			deviceQuirks.canHWInvert                = false;
-			deviceQuirks.ntxBootRota                = FB_ROTATE_CW;    // e.g., fat bezel side DOWN.
-			deviceQuirks.canRotate                  = true;
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_SUNXI;
+			ctx->deviceQuirks.canHWInvert                = false;
+			ctx->deviceQuirks.ntxBootRota                = FB_ROTATE_CW;    // e.g., fat bezel side DOWN.
+			ctx->deviceQuirks.canRotate                  = true;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_SUNXI;
 			// There's no real linuxfb rotation support, so, {0, 1, 2, 3}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_UR;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_UD;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_CCW;
-			deviceQuirks.screenDPI                  = 300U;
-			strtcpy(deviceQuirks.deviceName, "Sage", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Cadmus", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 8", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_UR;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_CCW;
+			ctx->deviceQuirks.screenDPI                  = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Sage", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Cadmus", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 8", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_TOLINO_EPOS_3:    // Epos 3 (rigel) (~ Sage)
-			deviceQuirks.isSunxi                    = true;
-			deviceQuirks.hasEclipseWfm              = true;
-			deviceQuirks.canHWInvert                = false;
-			deviceQuirks.ntxBootRota                = FB_ROTATE_CW;    // e.g., fat bezel side DOWN.
-			deviceQuirks.canRotate                  = true;
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_SUNXI;
+			ctx->deviceQuirks.isSunxi                    = true;
+			ctx->deviceQuirks.hasEclipseWfm              = true;
+			ctx->deviceQuirks.canHWInvert                = false;
+			ctx->deviceQuirks.ntxBootRota                = FB_ROTATE_CW;    // e.g., fat bezel side DOWN.
+			ctx->deviceQuirks.canRotate                  = true;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_SUNXI;
 			// There's no real linuxfb rotation support, so, {0, 1, 2, 3}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_UR;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_UD;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_CCW;
-			deviceQuirks.screenDPI                  = 300U;
-			strtcpy(deviceQuirks.deviceName, "Epos 3", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Rigel", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 8", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_UR;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_CCW;
+			ctx->deviceQuirks.screenDPI                  = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Epos 3", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Rigel", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 8", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_CLARA_2E:    // Clara 2E (Goldfinch)
-			deviceQuirks.hasEclipseWfm              = true;
-			deviceQuirks.isKoboMk7                  = true;    // Same MXCFB API ;).
+			ctx->deviceQuirks.hasEclipseWfm              = true;
+			ctx->deviceQuirks.isKoboMk7                  = true;    // Same MXCFB API ;).
 			// NOTE: Touch panel's native orientation is the usual CCW, i.e., origin on the top-right corner.
 			// NOTE: NTXHWConfig says there ought to be a KX122 gyro, but apparently not?
 			// NOTE: ioctls are straightforward (DisplayBusWidth is 8Bits),
@@ -1094,25 +1094,25 @@ static void
 			//       Either NTX_ROTA_ODD_INVERTED or NTX_ROTA_CW_TOUCH would behave,
 			//       but their description doesn't actually match what's happening...
 			// Canonical -> native rotation mapping: { UR: 3, CW: 2, UD: 1, CCW: 0 }
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CCW_TOUCH;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CCW_TOUCH;
 			// {3, 2, 1, 0}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
 			// The board is nearly identical to the Libra 2, and as such, exhibits the same quirks...
-			deviceQuirks.unreliableWaitFor          = true;
-			deviceQuirks.screenDPI                  = 300U;
-			strtcpy(deviceQuirks.deviceName, "Clara 2E", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Goldfinch", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 10", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.unreliableWaitFor          = true;
+			ctx->deviceQuirks.screenDPI                  = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Clara 2E", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Goldfinch", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 10", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_ELIPSA_2E:    // Elipsa 2E (Condor)
-			deviceQuirks.isMTK                      = true;
-			deviceQuirks.hasEclipseWfm              = true;
+			ctx->deviceQuirks.isMTK                      = true;
+			ctx->deviceQuirks.hasEclipseWfm              = true;
 			// NOTE: It technically can, but not via update flags, it's a global state.
 			//       You can toggle it via fbink_set_fb_info if need be.
-			deviceQuirks.canHWInvert                = false;
+			ctx->deviceQuirks.canHWInvert                = false;
 			// Unlike the Libra 2, KOBO_HWCFG_DisplayBusWidth (35) is "16Bits_mirror" (3),
 			// but the touch-screen appears to behave similary, and its native orientation is also CW.
 			// (Unlike on Mk.7+ mxcfb, hwtcon_fb_check_var doesn't do any kind of rotate trickery,
@@ -1123,247 +1123,253 @@ static void
 			//       that might actually differ...
 			//       In any case, for our purposes, that works out well enough.
 			//       (c.f., the Libra Colour comment around its onw ntxBootRota assignment)
-			deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
-			deviceQuirks.canRotate                  = true;
+			ctx->deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
+			ctx->deviceQuirks.canRotate                  = true;
 			// Canonical -> native rotation mapping: { UR: 1, CW: 0, UD: 3, CCW: 2 }
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CW_TOUCH;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CW_TOUCH;
 			// {1, 0, 3, 2}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UR;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UR;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UD;
 			// Mirrors the *other* axis compared to (most) other NTX boards...
-			deviceQuirks.touchMirrorX               = false;
-			deviceQuirks.touchMirrorY               = true;
-			deviceQuirks.screenDPI                  = 227U;
-			strtcpy(deviceQuirks.deviceName, "Elipsa 2E", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Condor", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 11", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.touchMirrorX               = false;
+			ctx->deviceQuirks.touchMirrorY               = true;
+			ctx->deviceQuirks.screenDPI                  = 227U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Elipsa 2E", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Condor", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 11", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_KOBO_LIBRA_COLOUR:    // Libra Colour (Monza)
-			deviceQuirks.hasColorPanel              = true;
-			deviceQuirks.isMTK                      = true;
-			deviceQuirks.hasEclipseWfm              = true;
+			ctx->deviceQuirks.hasColorPanel              = true;
+			ctx->deviceQuirks.isMTK                      = true;
+			ctx->deviceQuirks.hasEclipseWfm              = true;
 			// NOTE: It technically can, but not via update flags, it's a global state.
 			//       You can toggle it via fbink_set_fb_info if need be.
-			deviceQuirks.canHWInvert                = false;
+			ctx->deviceQuirks.canHWInvert                = false;
 			// NOTE: Appears to actually already match its final form (CW @ 32bpp) at boot,
 			//       but this keeps the deprecated fbdepth -r -1 logic accurate...
-			deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
-			deviceQuirks.canRotate                  = true;
+			ctx->deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
+			ctx->deviceQuirks.canRotate                  = true;
 			// Canonical -> native rotation mapping: { UR: 1, CW: 0, UD: 3, CCW: 2 }
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CW_TOUCH;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CW_TOUCH;
 			// {1, 0, 3, 2}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UR;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UR;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UD;
 			// Mirrors the *other* axis compared to (most) other NTX boards...
-			deviceQuirks.touchMirrorX               = false;
-			deviceQuirks.touchMirrorY               = true;
-			deviceQuirks.screenDPI                  = 300U;
-			strtcpy(deviceQuirks.deviceName, "Libra Colour", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Monza", sizeof(deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.touchMirrorX               = false;
+			ctx->deviceQuirks.touchMirrorY               = true;
+			ctx->deviceQuirks.screenDPI                  = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Libra Colour", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Monza", sizeof(ctx->deviceQuirks.deviceCodename));
 			// NOTE: Initial FW were flagged Mk. 11 before someone realized that was weird, and they fixed it in 4.39.23027
-			strtcpy(deviceQuirks.devicePlatform, "Mark 13", sizeof(deviceQuirks.devicePlatform));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 13", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_TOLINO_VISION_COLOR:    // Tolino Vision Color (Monza Tolino)
-			deviceQuirks.hasColorPanel              = true;
-			deviceQuirks.isMTK                      = true;
-			deviceQuirks.hasEclipseWfm              = true;
+			ctx->deviceQuirks.hasColorPanel              = true;
+			ctx->deviceQuirks.isMTK                      = true;
+			ctx->deviceQuirks.hasEclipseWfm              = true;
 			// NOTE: It technically can, but not via update flags, it's a global state.
 			//       You can toggle it via fbink_set_fb_info if need be.
-			deviceQuirks.canHWInvert                = false;
+			ctx->deviceQuirks.canHWInvert                = false;
 			// NOTE: Appears to actually already match its final form (CW @ 32bpp) at boot,
 			//       but this keeps the deprecated fbdepth -r -1 logic accurate...
-			deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
-			deviceQuirks.canRotate                  = true;
+			ctx->deviceQuirks.ntxBootRota                = FB_ROTATE_UR;
+			ctx->deviceQuirks.canRotate                  = true;
 			// Canonical -> native rotation mapping: { UR: 1, CW: 0, UD: 3, CCW: 2 }
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CW_TOUCH;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CW_TOUCH;
 			// {1, 0, 3, 2}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UR;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UR;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UD;
 			// Mirrors the *other* axis compared to (most) other NTX boards...
-			deviceQuirks.touchMirrorX               = false;
-			deviceQuirks.touchMirrorY               = true;
-			deviceQuirks.screenDPI                  = 300U;
-			strtcpy(deviceQuirks.deviceName, "Vision Color", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Monza Tolino", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 13", sizeof(deviceQuirks.devicePlatform));
-			deviceQuirks.isTolino = true;
+			ctx->deviceQuirks.touchMirrorX               = false;
+			ctx->deviceQuirks.touchMirrorY               = true;
+			ctx->deviceQuirks.screenDPI                  = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Vision Color", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename,
+				"Monza Tolino",
+				sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 13", sizeof(ctx->deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isTolino = true;
 			break;
 		case DEVICE_KOBO_CLARA_BW:    // Clara B&W (Spa BW)
-			deviceQuirks.isMTK                      = true;
-			deviceQuirks.hasEclipseWfm              = true;
+			ctx->deviceQuirks.isMTK                      = true;
+			ctx->deviceQuirks.hasEclipseWfm              = true;
 			// NOTE: It technically can, but not via update flags, it's a global state.
 			//       You can toggle it via fbink_set_fb_info if need be.
-			deviceQuirks.canHWInvert                = false;
+			ctx->deviceQuirks.canHWInvert                = false;
 			// NOTE: Assume goldfinch-like for now...
 			// Canonical -> native rotation mapping: { UR: 3, CW: 2, UD: 1, CCW: 0 }
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CCW_TOUCH;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CCW_TOUCH;
 			// {3, 2, 1, 0}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
-			deviceQuirks.screenDPI                  = 300U;
-			strtcpy(deviceQuirks.deviceName, "Clara B&W", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Spa BW", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 12", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
+			ctx->deviceQuirks.screenDPI                  = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Clara B&W", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Spa BW", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 12", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_TOLINO_SHINE_BW:    // Tolino Shine B&W (Spa Tolino BW)
-			deviceQuirks.isMTK                      = true;
-			deviceQuirks.hasEclipseWfm              = true;
+			ctx->deviceQuirks.isMTK                      = true;
+			ctx->deviceQuirks.hasEclipseWfm              = true;
 			// NOTE: It technically can, but not via update flags, it's a global state.
 			//       You can toggle it via fbink_set_fb_info if need be.
-			deviceQuirks.canHWInvert                = false;
+			ctx->deviceQuirks.canHWInvert                = false;
 			// NOTE: Assume goldfinch-like for now...
 			// Canonical -> native rotation mapping: { UR: 3, CW: 2, UD: 1, CCW: 0 }
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CCW_TOUCH;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CCW_TOUCH;
 			// {3, 2, 1, 0}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
-			deviceQuirks.screenDPI                  = 300U;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
+			ctx->deviceQuirks.screenDPI                  = 300U;
 			// NOTE: Marketed as Tolino Shine, sometimes with a (5. Gen) appended,
 			//       which approaches Kindle levels of impractical device names...
-			strtcpy(deviceQuirks.deviceName, "Shine B&W", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Spa Tolino BW", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 12", sizeof(deviceQuirks.devicePlatform));
-			deviceQuirks.isTolino = true;
+			strtcpy(ctx->deviceQuirks.deviceName, "Shine B&W", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename,
+				"Spa Tolino BW",
+				sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 12", sizeof(ctx->deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isTolino = true;
 			break;
 		case DEVICE_KOBO_CLARA_COLOUR:    // Clara Colour (Spa Colour)
-			deviceQuirks.hasColorPanel              = true;
-			deviceQuirks.isMTK                      = true;
-			deviceQuirks.hasEclipseWfm              = true;
+			ctx->deviceQuirks.hasColorPanel              = true;
+			ctx->deviceQuirks.isMTK                      = true;
+			ctx->deviceQuirks.hasEclipseWfm              = true;
 			// NOTE: It technically can, but not via update flags, it's a global state.
 			//       You can toggle it via fbink_set_fb_info if need be.
-			deviceQuirks.canHWInvert                = false;
+			ctx->deviceQuirks.canHWInvert                = false;
 			// NOTE: Assume goldfinch-like for now...
 			// Canonical -> native rotation mapping: { UR: 3, CW: 2, UD: 1, CCW: 0 }
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CCW_TOUCH;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CCW_TOUCH;
 			// {3, 2, 1, 0}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
-			deviceQuirks.screenDPI                  = 300U;
-			strtcpy(deviceQuirks.deviceName, "Clara Colour", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Spa Colour", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 12", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
+			ctx->deviceQuirks.screenDPI                  = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Clara Colour", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Spa Colour", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 12", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_TOLINO_SHINE_COLOR:    // Tolino Shine Color (Spa Tolino Colour)
-			deviceQuirks.hasColorPanel              = true;
-			deviceQuirks.isMTK                      = true;
-			deviceQuirks.hasEclipseWfm              = true;
+			ctx->deviceQuirks.hasColorPanel              = true;
+			ctx->deviceQuirks.isMTK                      = true;
+			ctx->deviceQuirks.hasEclipseWfm              = true;
 			// NOTE: It technically can, but not via update flags, it's a global state.
 			//       You can toggle it via fbink_set_fb_info if need be.
-			deviceQuirks.canHWInvert                = false;
+			ctx->deviceQuirks.canHWInvert                = false;
 			// NOTE: Assume goldfinch-like for now...
 			// Canonical -> native rotation mapping: { UR: 3, CW: 2, UD: 1, CCW: 0 }
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CCW_TOUCH;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CCW_TOUCH;
 			// {3, 2, 1, 0}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
-			deviceQuirks.screenDPI                  = 300U;
-			strtcpy(deviceQuirks.deviceName, "Shine Color", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Spa Tolino Colour", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 12", sizeof(deviceQuirks.devicePlatform));
-			deviceQuirks.isTolino = true;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
+			ctx->deviceQuirks.screenDPI                  = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Shine Color", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename,
+				"Spa Tolino Colour",
+				sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 12", sizeof(ctx->deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isTolino = true;
 			break;
 		case DEVICE_KOBO_CLARA_BW_TPV:    // Clara B&W (Spa BW TPV)
-			deviceQuirks.isMTK                      = true;
-			deviceQuirks.hasEclipseWfm              = true;
+			ctx->deviceQuirks.isMTK                      = true;
+			ctx->deviceQuirks.hasEclipseWfm              = true;
 			// NOTE: It technically can, but not via update flags, it's a global state.
 			//       You can toggle it via fbink_set_fb_info if need be.
-			deviceQuirks.canHWInvert                = false;
+			ctx->deviceQuirks.canHWInvert                = false;
 			// NOTE: Assume it matches the other Clara B&W boards...
 			// Canonical -> native rotation mapping: { UR: 3, CW: 2, UD: 1, CCW: 0 }
-			deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CCW_TOUCH;
+			ctx->deviceQuirks.ntxRotaQuirk               = NTX_ROTA_CCW_TOUCH;
 			// {3, 2, 1, 0}
-			deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
-			deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
-			deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
-			deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
-			deviceQuirks.screenDPI                  = 300U;
-			strtcpy(deviceQuirks.deviceName, "Clara B&W", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Spa BW TPV", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 12", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UR]  = FB_ROTATE_CCW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CW]  = FB_ROTATE_UD;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_UD]  = FB_ROTATE_CW;
+			ctx->deviceQuirks.rotationMap[FB_ROTATE_CCW] = FB_ROTATE_UR;
+			ctx->deviceQuirks.screenDPI                  = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Clara B&W", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Spa BW TPV", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 12", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_UNKNOWN:
 			// Like kobo_config.sh, assume Trilogy as a fallback
-			deviceQuirks.isKoboNonMT = true;
-			strtcpy(deviceQuirks.deviceName, "Touch A?", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Trilogy?", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 3?", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isKoboNonMT = true;
+			strtcpy(ctx->deviceQuirks.deviceName, "Touch A?", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Trilogy?", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 3?", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_MAINLINE_TOLINO_SHINE_2HD:    // Tolino Shine 2HD (Glo HD-ish)
 			// Mainline kernels expect to use the same set of ioctls as on Mk. 7+, even on older devices.
-			deviceQuirks.isKoboMk7 = true;
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceName, "Shine 2HD", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Mainline", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Tolino", sizeof(deviceQuirks.devicePlatform));
-			deviceQuirks.isTolino = true;
+			ctx->deviceQuirks.isKoboMk7 = true;
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Shine 2HD", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Mainline", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Tolino", sizeof(ctx->deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isTolino = true;
 			break;
 		case DEVICE_MAINLINE_TOLINO_SHINE_3:    // Tolino Shine 3 (Clara HD-ish)
-			deviceQuirks.isKoboMk7 = true;
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceName, "Shine 3", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Mainline", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Tolino", sizeof(deviceQuirks.devicePlatform));
-			deviceQuirks.isTolino = true;
+			ctx->deviceQuirks.isKoboMk7 = true;
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Shine 3", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Mainline", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Tolino", sizeof(ctx->deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isTolino = true;
 			break;
 		case DEVICE_MAINLINE_TOLINO_VISION:    // Tolino Vision (Aura SE-ish, maybe?)
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceName, "Vision", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Mainline", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Tolino", sizeof(deviceQuirks.devicePlatform));
-			deviceQuirks.isTolino = true;
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Vision", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Mainline", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Tolino", sizeof(ctx->deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isTolino = true;
 			break;
 		case DEVICE_MAINLINE_TOLINO_VISION_5:    // Tolino Vision 5 (Libra H2O-ish)
-			deviceQuirks.isKoboMk7    = true;
-			deviceQuirks.ntxBootRota  = FB_ROTATE_UR;
-			deviceQuirks.canRotate    = true;
-			deviceQuirks.ntxRotaQuirk = NTX_ROTA_SANE;
-			deviceQuirks.screenDPI    = 300U;
-			strtcpy(deviceQuirks.deviceName, "Vision 5", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Mainline", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Tolino", sizeof(deviceQuirks.devicePlatform));
-			deviceQuirks.isTolino = true;
+			ctx->deviceQuirks.isKoboMk7    = true;
+			ctx->deviceQuirks.ntxBootRota  = FB_ROTATE_UR;
+			ctx->deviceQuirks.canRotate    = true;
+			ctx->deviceQuirks.ntxRotaQuirk = NTX_ROTA_SANE;
+			ctx->deviceQuirks.screenDPI    = 300U;
+			strtcpy(ctx->deviceQuirks.deviceName, "Vision 5", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Mainline", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Tolino", sizeof(ctx->deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isTolino = true;
 			break;
 		case DEVICE_MAINLINE_GENERIC_IMX5:
 			// Generic fallback for i.MX5 devices on mainline kernels
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceName, "i.MX5", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Mainline", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark <= 5", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceName, "i.MX5", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Mainline", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark <= 5", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_MAINLINE_GENERIC_IMX6:
 			// Generic fallback for i.MX6 devices on mainline kernels
-			deviceQuirks.isKoboMk7 = true;
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceName, "i.MX6", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Mainline", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark >= 6", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isKoboMk7 = true;
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceName, "i.MX6", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Mainline", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark >= 6", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		case DEVICE_MAINLINE_GENERIC_SUNXI_B300:
 			// Generic fallback for sunxi B300 devices
-			deviceQuirks.isSunxi       = true;
-			deviceQuirks.hasEclipseWfm = true;
-			deviceQuirks.canHWInvert   = false;
-			deviceQuirks.ntxBootRota   = FB_ROTATE_UR;    // Assume nothing
-			deviceQuirks.canRotate     = true;
-			deviceQuirks.ntxRotaQuirk  = NTX_ROTA_SUNXI;
-			deviceQuirks.screenDPI     = 227U;
-			strtcpy(deviceQuirks.deviceName, "B300", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "Mainline", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark 8", sizeof(deviceQuirks.devicePlatform));
+			ctx->deviceQuirks.isSunxi       = true;
+			ctx->deviceQuirks.hasEclipseWfm = true;
+			ctx->deviceQuirks.canHWInvert   = false;
+			ctx->deviceQuirks.ntxBootRota   = FB_ROTATE_UR;    // Assume nothing
+			ctx->deviceQuirks.canRotate     = true;
+			ctx->deviceQuirks.ntxRotaQuirk  = NTX_ROTA_SUNXI;
+			ctx->deviceQuirks.screenDPI     = 227U;
+			strtcpy(ctx->deviceQuirks.deviceName, "B300", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "Mainline", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark 8", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 		default:
 			// Print something slightly different if we completely failed to even compute a kobo_id...
@@ -1372,9 +1378,9 @@ static void
 			} else {
 				WARN("Unidentified Kobo device code (%hu)", kobo_id);
 			}
-			strtcpy(deviceQuirks.deviceName, "Unknown!", sizeof(deviceQuirks.deviceName));
-			strtcpy(deviceQuirks.deviceCodename, "??", sizeof(deviceQuirks.deviceCodename));
-			strtcpy(deviceQuirks.devicePlatform, "Mark ?", sizeof(deviceQuirks.devicePlatform));
+			strtcpy(ctx->deviceQuirks.deviceName, "Unknown!", sizeof(ctx->deviceQuirks.deviceName));
+			strtcpy(ctx->deviceQuirks.deviceCodename, "??", sizeof(ctx->deviceQuirks.deviceCodename));
+			strtcpy(ctx->deviceQuirks.devicePlatform, "Mark ?", sizeof(ctx->deviceQuirks.devicePlatform));
 			break;
 	}
 }
@@ -1382,7 +1388,7 @@ static void
 // NOTE: This is lifted from FBGrab,
 //       c.f., http://trac.ak-team.com/trac/browser/niluje/Configs/trunk/Kindle/Misc/FBGrab/fbgrab.c#L808
 static void
-    identify_kobo(void)
+    identify_kobo(FBInkContext* restrict ctx)
 {
 	// Get the model from Nickel's version tag file...
 	FILE* fp = fopen("/mnt/onboard/.kobo/version", "re");
@@ -1406,7 +1412,7 @@ static void
 			// final characters, so that's easy enough to extract without
 			// having to worry about the formatting...
 			const unsigned short int kobo_id = (unsigned short int) strtoul(line + (size - 3), NULL, 10);
-			set_kobo_quirks(kobo_id);
+			set_kobo_quirks(ctx, kobo_id);
 
 			// Get out now, we're done!
 			// NOTE: The nickel tag has been found and *successfully* read,
@@ -1424,7 +1430,7 @@ static void
 			// NOTE: This codepath can genuinely be reached if you're unlucky enough that a crash
 			//       leads to zapping the file to 0 bytes (e.g., after an fsck),
 			//       which is why we don't abort now, and instead go on to try to read the HWConfig block.
-			set_kobo_quirks(DEVICE_INVALID);
+			set_kobo_quirks(ctx, DEVICE_INVALID);
 		}
 	}
 
@@ -1485,7 +1491,7 @@ static void
 				fclose(fp);
 
 				// NOTE: This is "fatal", stop there, and make it clear we failed to identify the device...
-				set_kobo_quirks(DEVICE_INVALID);
+				set_kobo_quirks(ctx, DEVICE_INVALID);
 				return;
 			}
 
@@ -1586,7 +1592,7 @@ static void
 			// Assuming we actually *know* about this PCB ID...
 			if (kobo_id != DEVICE_UNKNOWN) {
 				// ...we can do this, as accurately as if onboard were mounted ;).
-				set_kobo_quirks(kobo_id);
+				set_kobo_quirks(ctx, kobo_id);
 
 				// Get out now, we're done!
 				return;
@@ -1598,11 +1604,11 @@ static void
 	//       *and* either we're not on an NTX board, or the NTXHWConfig block device is unavailable;
 	//       or we failed to detect a device with either of those two methods.
 	//       That usually points to a device running a mainline kernel, so let's poke at the DTB...
-	return identify_mainline();
+	return identify_mainline(ctx);
 }
 
 static void
-    identify_mainline(void)
+    identify_mainline(FBInkContext* restrict ctx)
 {
 	// This is aimed at mainline kernels, c.f., https://github.com/NiLuJe/FBInk/issues/70
 	// NOTE: Like rcS, if all else fails, assume it's an old Freescale Trilogy...
@@ -1664,20 +1670,20 @@ static void
 		fclose(fp);
 	}
 
-	set_kobo_quirks(kobo_id);
+	set_kobo_quirks(ctx, kobo_id);
 
 	// NOTE: We enforce NTX_ROTA_STRAIGHT on all the mxcfb devices here, as Andrea's kernels all behave sanely on that front...
 	//       c.f., https://github.com/akemnade/linux/blob/c240ea6209ebea7d577db3f54abaa1658fd5f15c/drivers/video/fbdev/mxc/mxc_epdc_v2_fb.c#L2654
-	if (deviceQuirks.isSunxi == false && deviceQuirks.ntxRotaQuirk != NTX_ROTA_SANE) {
+	if (ctx->deviceQuirks.isSunxi == false && ctx->deviceQuirks.ntxRotaQuirk != NTX_ROTA_SANE) {
 		// NOTE: The Libra is flagged NTX_ROTA_SANE, and there *are* a few deprecated codepaths that will make use of this,
 		//       so we leave it alone, given that it doesn't really affect the ioctl behavior.
-		deviceQuirks.ntxRotaQuirk = NTX_ROTA_STRAIGHT;
+		ctx->deviceQuirks.ntxRotaQuirk = NTX_ROTA_STRAIGHT;
 	}
 }
 
 #	elif defined(FBINK_FOR_REMARKABLE)
 static void
-    identify_remarkable(void)
+    identify_remarkable(FBInkContext* restrict ctx)
 {
 	// NOTE: Follow the lead of https://github.com/reMarkable/update_engine (utils::GetMachineModel)
 	FILE* fp               = fopen("/sys/devices/soc0/machine", "re");
@@ -1699,30 +1705,30 @@ static void
 	if (strcmp(machine_tag, "reMarkable 2.0") == 0) {
 		// NOTE: This is currently a very weird and mostly unsupported beast...
 		//       c.f., https://rmkit.dev/news/rm2-status/
-		deviceQuirks.screenDPI    = 226U;
-		deviceQuirks.canHWInvert  = false;    // No EPDC :(
+		ctx->deviceQuirks.screenDPI    = 226U;
+		ctx->deviceQuirks.canHWInvert  = false;    // No EPDC :(
 		// NOTE: Not actually an NTX board, but useful nonetheless for fbdepth ;).
-		deviceQuirks.ntxBootRota  = FB_ROTATE_CW;
-		deviceQuirks.ntxRotaQuirk = NTX_ROTA_SANE;
-		deviceQuirks.canRotate    = true;
-		strtcpy(deviceQuirks.deviceName, "reMarkable 2", sizeof(deviceQuirks.deviceName));
-		strtcpy(deviceQuirks.deviceCodename, "Zero Sugar", sizeof(deviceQuirks.deviceCodename));
-		deviceQuirks.deviceId = DEVICE_REMARKABLE_2;
+		ctx->deviceQuirks.ntxBootRota  = FB_ROTATE_CW;
+		ctx->deviceQuirks.ntxRotaQuirk = NTX_ROTA_SANE;
+		ctx->deviceQuirks.canRotate    = true;
+		strtcpy(ctx->deviceQuirks.deviceName, "reMarkable 2", sizeof(ctx->deviceQuirks.deviceName));
+		strtcpy(ctx->deviceQuirks.deviceCodename, "Zero Sugar", sizeof(ctx->deviceQuirks.deviceCodename));
+		ctx->deviceQuirks.deviceId = DEVICE_REMARKABLE_2;
 	} else {
-		deviceQuirks.screenDPI    = 226U;
-		deviceQuirks.canHWInvert  = true;
+		ctx->deviceQuirks.screenDPI    = 226U;
+		ctx->deviceQuirks.canHWInvert  = true;
 		// NOTE: Not actually an NTX board, but useful nonetheless for fbdepth ;).
-		deviceQuirks.ntxBootRota  = FB_ROTATE_CW;
-		deviceQuirks.ntxRotaQuirk = NTX_ROTA_SANE;
-		deviceQuirks.canRotate    = true;
-		strtcpy(deviceQuirks.deviceName, "reMarkable", sizeof(deviceQuirks.deviceName));
-		strtcpy(deviceQuirks.deviceCodename, "Zero Gravitas", sizeof(deviceQuirks.deviceCodename));
-		deviceQuirks.deviceId = DEVICE_REMARKABLE_1;
+		ctx->deviceQuirks.ntxBootRota  = FB_ROTATE_CW;
+		ctx->deviceQuirks.ntxRotaQuirk = NTX_ROTA_SANE;
+		ctx->deviceQuirks.canRotate    = true;
+		strtcpy(ctx->deviceQuirks.deviceName, "reMarkable", sizeof(ctx->deviceQuirks.deviceName));
+		strtcpy(ctx->deviceQuirks.deviceCodename, "Zero Gravitas", sizeof(ctx->deviceQuirks.deviceCodename));
+		ctx->deviceQuirks.deviceId = DEVICE_REMARKABLE_1;
 	}
 }
 #	elif defined(FBINK_FOR_POCKETBOOK)
 static void
-    identify_pocketbook(void)
+    identify_pocketbook(FBInkContext* restrict ctx)
 {
 	char* model_name = NULL;
 	// NOTE: I'm not super happy about calling InkView here,
@@ -1754,7 +1760,7 @@ static void
 	}
 
 	// Unless otherwise specified, let's allow HW inversion everywhere for now...
-	deviceQuirks.canHWInvert = true;
+	ctx->deviceQuirks.canHWInvert = true;
 
 	// NOTE: PB apparently has a bad habit of reporting the device name in a somewhat erratic fashion, so,
 	//       attempt to cover all known variants...
@@ -1766,223 +1772,341 @@ static void
 	if (model_name) {
 		// Keep the model name dance in the same order as KOReader...
 		if (PB_CODENAME_MATCH("515")) {
-			deviceQuirks.screenDPI = 200U;
-			strtcpy(deviceQuirks.deviceCodename, "PBMini", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_MINI;
+			ctx->deviceQuirks.screenDPI = 200U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBMini", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_MINI;
 		} else if (PB_CODENAME_MATCH("606")) {
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceCodename, "PB606", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_606;
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PB606", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_606;
 		} else if (PB_CODENAME_MATCH("611")) {
-			deviceQuirks.screenDPI = 167U;
-			strtcpy(deviceQuirks.deviceCodename, "PB611", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_611;
+			ctx->deviceQuirks.screenDPI = 167U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PB611", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_611;
 		} else if (PB_CODENAME_MATCH("613")) {
-			deviceQuirks.screenDPI = 167U;
-			strtcpy(deviceQuirks.deviceCodename, "PB613B", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_613;
+			ctx->deviceQuirks.screenDPI = 167U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PB613B", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_613;
 		} else if (PB_CODENAME_MATCH("614") || PB_CODENAME_MATCH("614W")) {
-			deviceQuirks.screenDPI = 167U;
-			strtcpy(deviceQuirks.deviceCodename, "PB614W", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_614;
+			ctx->deviceQuirks.screenDPI = 167U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PB614W", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_614;
 		} else if (PB_CODENAME_MATCH("615") || PB_CODENAME_MATCH("615W")) {
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceCodename, "PBBLux", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_615;
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBBLux", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_615;
 		} else if (PB_CODENAME_MATCH("616") || PB_CODENAME_MATCH("616W")) {
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceCodename, "PBBLux2", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_616;
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBBLux2", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_616;
 		} else if (PB_CODENAME_MATCH("617")) {
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceCodename, "PBBLux3", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_617;
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBBLux3", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_617;
 		} else if (PB_CODENAME_MATCH("618")) {
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceCodename, "PBBLux4", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_618;
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBBLux4", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_618;
 		} else if (PB_CODENAME_MATCH("622")) {
-			deviceQuirks.screenDPI = 167U;
-			strtcpy(deviceQuirks.deviceCodename, "PBTouch", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_TOUCH;
+			ctx->deviceQuirks.screenDPI = 167U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBTouch", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_TOUCH;
 		} else if (PB_CODENAME_MATCH("623")) {
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceCodename, "PBLux", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_LUX;
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBLux", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_LUX;
 		} else if (PB_CODENAME_MATCH("624")) {
-			deviceQuirks.screenDPI = 167U;
-			strtcpy(deviceQuirks.deviceCodename, "PBBTouch", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_BASIC_TOUCH;
+			ctx->deviceQuirks.screenDPI = 167U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBBTouch", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_BASIC_TOUCH;
 		} else if (PB_CODENAME_MATCH("625")) {
-			deviceQuirks.screenDPI = 167U;
-			strtcpy(deviceQuirks.deviceCodename, "PBBTouch2", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_BASIC_TOUCH_2;
+			ctx->deviceQuirks.screenDPI = 167U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBBTouch2", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_BASIC_TOUCH_2;
 		} else if (PB_CODENAME_MATCH("626") || PB_CODENAME_MATCH("626(2)-TL3")) {
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceCodename, "PBLux3", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_LUX_3;
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBLux3", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_LUX_3;
 		} else if (PB_CODENAME_MATCH("627")) {
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceCodename, "PBLux4", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_LUX_4;
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBLux4", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_LUX_4;
 		} else if (PB_CODENAME_MATCH("628")) {
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceCodename, "PBLux5", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_LUX_5;
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBLux5", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_LUX_5;
 		} else if (PB_CODENAME_MATCH("629")) {
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceCodename, "PBVerse", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_VERSE;
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBVerse", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_VERSE;
 		} else if (PB_CODENAME_MATCH("630")) {
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceCodename, "PBSense", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_SENSE;
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBSense", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_SENSE;
 		} else if (PB_CODENAME_MATCH("631")) {
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceCodename, "PBTouchHD", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_TOUCH_HD;
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBTouchHD", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_TOUCH_HD;
 		} else if (PB_CODENAME_MATCH("632")) {
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceCodename, "PBTouchHD+", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_TOUCH_HD_PLUS;
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBTouchHD+", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_TOUCH_HD_PLUS;
 		} else if (PB_CODENAME_MATCH("633")) {
-			deviceQuirks.hasColorPanel = true;
-			deviceQuirks.screenDPI     = 300U;
-			strtcpy(deviceQuirks.deviceCodename, "PBColor", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_COLOR;
+			ctx->deviceQuirks.hasColorPanel = true;
+			ctx->deviceQuirks.screenDPI     = 300U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBColor", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_COLOR;
 		} else if (PB_CODENAME_MATCH("634")) {
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceCodename, "PBVersePro", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_VERSE_PRO;
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBVersePro", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_VERSE_PRO;
 		} else if (PB_CODENAME_MATCH("634K3")) {
-			deviceQuirks.hasColorPanel = true;
-			deviceQuirks.screenDPI     = 300U;
-			strtcpy(deviceQuirks.deviceCodename, "PBVerseProColor", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_VERSE_PRO_COLOR;
+			ctx->deviceQuirks.hasColorPanel = true;
+			ctx->deviceQuirks.screenDPI     = 300U;
+			strtcpy(ctx->deviceQuirks.deviceCodename,
+				"PBVerseProColor",
+				sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_VERSE_PRO_COLOR;
 		} else if (PB_CODENAME_MATCH("640")) {
-			deviceQuirks.screenDPI = 167U;
-			strtcpy(deviceQuirks.deviceCodename, "PBAqua", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_AQUA;
+			ctx->deviceQuirks.screenDPI = 167U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBAqua", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_AQUA;
 		} else if (PB_CODENAME_MATCH("641")) {
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceCodename, "PBAqua2", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_AQUA2;
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBAqua2", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_AQUA2;
 		} else if (PB_CODENAME_MATCH("650")) {
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceCodename, "PBUltra", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_ULTRA;
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBUltra", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_ULTRA;
 		} else if (PB_CODENAME_MATCH("700")) {
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceCodename, "PBEra", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_ERA;
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBEra", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_ERA;
 		} else if (PB_CODENAME_MATCH("700K3")) {
-			deviceQuirks.hasColorPanel = true;
-			deviceQuirks.screenDPI     = 300U;
-			strtcpy(deviceQuirks.deviceCodename, "PBEraColor", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_ERA_COLOR;
+			ctx->deviceQuirks.hasColorPanel = true;
+			ctx->deviceQuirks.screenDPI     = 300U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBEraColor", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_ERA_COLOR;
 		} else if (PB_CODENAME_MATCH("740")) {
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceCodename, "PBInkPad3", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD_3;
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBInkPad3", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD_3;
 		} else if (PB_CODENAME_MATCH("740-2") || PB_CODENAME_MATCH("740-3")) {
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceCodename, "PBInkPad3Pro", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD_3_PRO;
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceCodename,
+				"PBInkPad3Pro",
+				sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD_3_PRO;
 		} else if (PB_CODENAME_MATCH("741")) {
-			deviceQuirks.hasColorPanel = true;
-			deviceQuirks.screenDPI     = 300U;
-			strtcpy(deviceQuirks.deviceCodename, "PBInkPadColor", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD_COLOR;
+			ctx->deviceQuirks.hasColorPanel = true;
+			ctx->deviceQuirks.screenDPI     = 300U;
+			strtcpy(ctx->deviceQuirks.deviceCodename,
+				"PBInkPadColor",
+				sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD_COLOR;
 		} else if (PB_CODENAME_MATCH("743C")) {
-			deviceQuirks.hasColorPanel = true;
-			deviceQuirks.screenDPI     = 300U;
-			strtcpy(deviceQuirks.deviceCodename, "PBInkPadColor2", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD_COLOR_2;
+			ctx->deviceQuirks.hasColorPanel = true;
+			ctx->deviceQuirks.screenDPI     = 300U;
+			strtcpy(ctx->deviceQuirks.deviceCodename,
+				"PBInkPadColor2",
+				sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD_COLOR_2;
 		} else if (PB_CODENAME_MATCH("743K")) {
-			deviceQuirks.hasColorPanel = true;
-			deviceQuirks.screenDPI     = 300U;
-			strtcpy(deviceQuirks.deviceCodename, "PBInkPadColor3", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD_COLOR_3;
+			ctx->deviceQuirks.hasColorPanel = true;
+			ctx->deviceQuirks.screenDPI     = 300U;
+			strtcpy(ctx->deviceQuirks.deviceCodename,
+				"PBInkPadColor3",
+				sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD_COLOR_3;
 		} else if (PB_CODENAME_MATCH("743G") || PB_CODENAME_MATCH("743g")) {
-			deviceQuirks.screenDPI = 300U;
-			strtcpy(deviceQuirks.deviceCodename, "PBInkPad4", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD_4;
+			ctx->deviceQuirks.screenDPI = 300U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBInkPad4", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD_4;
 		} else if (PB_CODENAME_MATCH("840") || strcmp(model_name, "Reader InkPad") == 0) {
-			deviceQuirks.screenDPI = 250U;
-			strtcpy(deviceQuirks.deviceCodename, "PBInkPad", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD;
+			ctx->deviceQuirks.screenDPI = 250U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBInkPad", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD;
 		} else if (PB_CODENAME_MATCH("970")) {
-			deviceQuirks.screenDPI = 150U;
-			strtcpy(deviceQuirks.deviceCodename, "PBInkPadLite", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD_LITE;
+			ctx->deviceQuirks.screenDPI = 150U;
+			strtcpy(ctx->deviceQuirks.deviceCodename,
+				"PBInkPadLite",
+				sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD_LITE;
 		} else if (PB_CODENAME_MATCH("1040")) {
-			deviceQuirks.screenDPI = 227U;
-			strtcpy(deviceQuirks.deviceCodename, "PBInkPadX", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD_X;
+			ctx->deviceQuirks.screenDPI = 227U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBInkPadX", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_INKPAD_X;
 		} else if (PB_CODENAME_MATCH("Color Lux")) {
-			deviceQuirks.hasColorPanel = true;
-			deviceQuirks.screenDPI     = 125U;
-			strtcpy(deviceQuirks.deviceCodename, "PBColorLux", sizeof(deviceQuirks.deviceCodename));
-			deviceQuirks.deviceId = DEVICE_POCKETBOOK_COLOR_LUX;
+			ctx->deviceQuirks.hasColorPanel = true;
+			ctx->deviceQuirks.screenDPI     = 125U;
+			strtcpy(ctx->deviceQuirks.deviceCodename, "PBColorLux", sizeof(ctx->deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.deviceId = DEVICE_POCKETBOOK_COLOR_LUX;
 		} else {
 			WARN("Unidentified PocketBook model: `%s`", model_name);
-			deviceQuirks.screenDPI = 212U;
-			strtcpy(deviceQuirks.deviceCodename, "Unidentified", sizeof(deviceQuirks.deviceCodename));
+			ctx->deviceQuirks.screenDPI = 212U;
+			strtcpy(ctx->deviceQuirks.deviceCodename,
+				"Unidentified",
+				sizeof(ctx->deviceQuirks.deviceCodename));
 		}
 	} else {
 		// NOTE: Failed to query DeviceModel via InkView, so, fake something...
 		WARN("Couldn't query PocketBook model name via InkView");
-		deviceQuirks.screenDPI = 212U;
-		strtcpy(deviceQuirks.deviceCodename, "Unknown", sizeof(deviceQuirks.deviceCodename));
+		ctx->deviceQuirks.screenDPI = 212U;
+		strtcpy(ctx->deviceQuirks.deviceCodename, "Unknown", sizeof(ctx->deviceQuirks.deviceCodename));
 	}
 }
 #	endif    // FBINK_FOR_KINDLE
 
+// Fill in the key fields of a device id cache entry, i.e., everything that should invalidate it when it changes.
+static int
+    get_device_id_cache_keys(FBInkDeviceIdCache* restrict cache)
+{
+	// NOTE: Start from a clean slate, as we compare keys via memcmp...
+	memset(cache, 0, sizeof(*cache));
+	cache->magic       = FBINK_ID_CACHE_MAGIC;
+	cache->version     = FBINK_ID_CACHE_VERSION;
+	cache->quirks_size = sizeof(cache->quirks);
+	strtcpy(cache->fbink_version, FBINK_VERSION, sizeof(cache->fbink_version));
+
+	// The boot ID changes on every boot, which takes care of pretty much everything...
+	FILE* fp = fopen("/proc/sys/kernel/random/boot_id", "re");
+	if (!fp) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+	const size_t size = fread(cache->boot_id, sizeof(*cache->boot_id), sizeof(cache->boot_id) - 1U, fp);
+	fclose(fp);
+	if (size == 0U) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// ... but the kernel build is what actually matters, so, make sure to catch a kexec, too.
+	struct utsname uts;
+	if (uname(&uts) != 0) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+	snprintf(cache->kernel, sizeof(cache->kernel), "%s %s", uts.release, uts.version);
+
+	return EXIT_SUCCESS;
+}
+
+// Restore deviceQuirks from the cache, if it's valid
+static bool
+    load_device_id_cache(FBInkContext* restrict ctx, const FBInkDeviceIdCache* restrict keys)
+{
+	int fd = open(FBINK_ID_CACHE_PATH, O_RDONLY | O_CLOEXEC | O_NOFOLLOW);
+	if (fd == -1) {
+		return false;
+	}
+
+	FBInkDeviceIdCache cache   = { 0 };
+	bool               is_good = false;
+	struct stat        st;
+	// NOTE: Since it lives in a world-writable directory, only trust it if it was written by us (or root).
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && (st.st_uid == geteuid() || st.st_uid == 0U) &&
+	    read(fd, &cache, sizeof(cache)) == (ssize_t) sizeof(cache)) {
+		is_good = memcmp(&cache, keys, offsetof(FBInkDeviceIdCache, quirks)) == 0;
+	}
+	close(fd);
+
+	if (!is_good) {
+		ELOG("Ignoring stale device identification cache");
+		return false;
+	}
+
+	// Never trust strings from the outside world ;)
+	cache.quirks.deviceName[sizeof(cache.quirks.deviceName) - 1U]         = '\0';
+	cache.quirks.deviceCodename[sizeof(cache.quirks.deviceCodename) - 1U] = '\0';
+	cache.quirks.devicePlatform[sizeof(cache.quirks.devicePlatform) - 1U] = '\0';
+	ctx->deviceQuirks                                                     = cache.quirks;
+	ELOG("Loaded device identification from cache");
+
+	return true;
+}
+
+// Store deviceQuirks in the cache, right after identification
+static void
+    store_device_id_cache(FBInkContext* restrict ctx, const FBInkDeviceIdCache* restrict keys)
+{
+	FBInkDeviceIdCache cache = *keys;
+	cache.quirks             = ctx->deviceQuirks;
+
+	// NOTE: Write to a temporary file first, so that concurrent readers only ever see a complete file.
+	char tmp_path[PATH_MAX] = { 0 };
+	snprintf(tmp_path, sizeof(tmp_path), "%s.%ld", FBINK_ID_CACHE_PATH, (long int) getpid());
+	int fd = open(tmp_path, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+	if (fd == -1) {
+		// Not fatal, we'll just have to do this again next time...
+		return;
+	}
+	const ssize_t written = write(fd, &cache, sizeof(cache));
+	if (close(fd) != 0 || written != (ssize_t) sizeof(cache) || rename(tmp_path, FBINK_ID_CACHE_PATH) != 0) {
+		unlink(tmp_path);
+	}
+}
+
 static void
-    identify_device(void)
+    identify_device(FBInkContext* restrict ctx)
 {
+	// NOTE: Identification can be fairly expensive (e.g., raw eMMC reads on Kobo, or dlopen'ing InkView on PocketBook),
+	//       and its results can't change without a reboot, so we cache them across runs.
+	//       Set FBINK_NO_ID_CACHE in your env to bypass the cache entirely.
+	FBInkDeviceIdCache cache_keys = { 0 };
+	const bool         use_cache  = !getenv("FBINK_NO_ID_CACHE") && get_device_id_cache_keys(&cache_keys) == EXIT_SUCCESS;
+	if (!use_cache || !load_device_id_cache(ctx, &cache_keys)) {
+#	if defined(FBINK_FOR_KINDLE)
+		identify_kindle(ctx);
+#	elif defined(FBINK_FOR_CERVANTES)
+		identify_cervantes(ctx);
+#	elif defined(FBINK_FOR_KOBO)
+		identify_kobo(ctx);
+#	elif defined(FBINK_FOR_REMARKABLE)
+		identify_remarkable(ctx);
+#	elif defined(FBINK_FOR_POCKETBOOK)
+		identify_pocketbook(ctx);
+#	endif
+		if (use_cache) {
+			store_device_id_cache(ctx, &cache_keys);
+		}
+	}
+
 #	if defined(FBINK_FOR_KINDLE)
-	identify_kindle();
-	if (deviceQuirks.deviceId > 0xFFu) {
-		char* restrict dev_id = to_base(deviceQuirks.deviceId, 32U, 3U);
+	if (ctx->deviceQuirks.deviceId > 0xFFu) {
+		char* restrict dev_id = to_base(ctx->deviceQuirks.deviceId, 32U, 3U);
 		ELOG("Detected a Kindle %s (%s -> 0x%03X => %s on %s)",
-		     deviceQuirks.deviceName,
+		     ctx->deviceQuirks.deviceName,
 		     dev_id,
-		     deviceQuirks.deviceId,
-		     deviceQuirks.deviceCodename,
-		     deviceQuirks.devicePlatform);
+		     ctx->deviceQuirks.deviceId,
+		     ctx->deviceQuirks.deviceCodename,
+		     ctx->deviceQuirks.devicePlatform);
 		free(dev_id);
 	} else {
 		ELOG("Detected a Kindle %s (0x%02X => %s on %s)",
-		     deviceQuirks.deviceName,
-		     deviceQuirks.deviceId,
-		     deviceQuirks.deviceCodename,
-		     deviceQuirks.devicePlatform);
+		     ctx->deviceQuirks.deviceName,
+		     ctx->deviceQuirks.deviceId,
+		     ctx->deviceQuirks.deviceCodename,
+		     ctx->deviceQuirks.devicePlatform);
 	}
 #	elif defined(FBINK_FOR_CERVANTES)
-	identify_cervantes();
-	ELOG("Detected a BQ Cervantes %s (%hu)", deviceQuirks.deviceName, deviceQuirks.deviceId);
+	ELOG("Detected a BQ Cervantes %s (%hu)", ctx->deviceQuirks.deviceName, ctx->deviceQuirks.deviceId);
 #	elif defined(FBINK_FOR_KOBO)
-	identify_kobo();
 	ELOG("Detected a %s %s (%hu => %s @ %s)",
-	     deviceQuirks.deviceId >= (TOLINO_DEVICE_ID_OFFSET * 2) ? "Tolino" : "Kobo",
-	     deviceQuirks.deviceName,
-	     deviceQuirks.deviceId,
-	     deviceQuirks.deviceCodename,
-	     deviceQuirks.devicePlatform);
+	     ctx->deviceQuirks.deviceId >= (TOLINO_DEVICE_ID_OFFSET * 2) ? "Tolino" : "Kobo",
+	     ctx->deviceQuirks.deviceName,
+	     ctx->deviceQuirks.deviceId,
+	     ctx->deviceQuirks.deviceCodename,
+	     ctx->deviceQuirks.devicePlatform);
 #	elif defined(FBINK_FOR_REMARKABLE)
-	identify_remarkable();
-	ELOG("Detected a %s (%s)", deviceQuirks.deviceName, deviceQuirks.deviceCodename);
+	ELOG("Detected a %s (%s)", ctx->deviceQuirks.deviceName, ctx->deviceQuirks.deviceCodename);
 #	elif defined(FBINK_FOR_POCKETBOOK)
-	identify_pocketbook();
-	ELOG("Detected a PocketBook (%s)", deviceQuirks.deviceCodename);
+	ELOG("Detected a PocketBook (%s)", ctx->deviceQuirks.deviceCodename);
 #	endif
 	// Warn if canHWInvert was flipped
-	if (!deviceQuirks.canHWInvert) {
+	if (!ctx->deviceQuirks.canHWInvert) {
 		// NOTE: Allow overriding that via an env var
 		if (getenv("FBINK_ALLOW_HW_INVERT")) {
 			ELOG("Enforced HW inversion support on a device where it may be buggy!");
-			deviceQuirks.canHWInvert = true;
+			ctx->deviceQuirks.canHWInvert = true;
 		} else {
 			ELOG("This device does not support HW inversion");
 		}
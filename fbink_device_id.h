@@ -27,6 +27,7 @@
 #include "fbink_internal.h"
 
 #include <linux/fs.h>
+#include <sys/utsname.h>
 
 // Used as a sentinel value during device detection
 #define DEVICE_INVALID UINT16_MAX
@@ -105,13 +106,13 @@ static const HWConfigBlockDev HWCONFIG_BLOCKS[] = {
 
 #	if defined(FBINK_FOR_KINDLE)
 #		define KINDLE_SERIAL_NO_LENGTH 16
-static bool     is_kindle_device(uint32_t);
-static bool     is_kindle_device_new(uint32_t);
+static bool     is_kindle_device(FBInkContext* restrict, uint32_t);
+static bool     is_kindle_device_new(FBInkContext* restrict, uint32_t);
 static uint32_t from_base(const char*, uint8_t);
 static char*    to_base(int64_t, uint8_t, size_t);
-static void     identify_kindle(void);
+static void     identify_kindle(FBInkContext* restrict);
 #	elif defined(FBINK_FOR_CERVANTES)
-static void identify_cervantes(void);
+static void identify_cervantes(FBInkContext* restrict);
 #	elif defined(FBINK_FOR_KOBO)
 // List of NTX/Kobo PCB IDs... For a given device,
 // what we get in the NTXHWConfig payload @ index KOBO_HWCFG_CPU corresponds to an index in this array.
@@ -189,16 +190,37 @@ static const char* kobo_disp_busw[] = { "8Bits", "16Bits", "8Bits_mirror", "16Bi
 // And for mainline kernels, this is where we poke for device identification
 #		define MAINLINE_DEVICE_ID_SYSFS "/sys/firmware/devicetree/base/compatible"
 
-static void set_kobo_quirks(unsigned short int);
-static void identify_kobo(void);
-static void identify_mainline(void);
+static void set_kobo_quirks(FBInkContext* restrict, unsigned short int);
+static void identify_kobo(FBInkContext* restrict);
+static void identify_mainline(FBInkContext* restrict);
 #	elif defined(FBINK_FOR_REMARKABLE)
-static void identify_remarkable(void);
+static void identify_remarkable(FBInkContext* restrict);
 #	elif defined(FBINK_FOR_POCKETBOOK)
-static void identify_pocketbook(void);
+static void identify_pocketbook(FBInkContext* restrict);
 #	endif    // FBINK_FOR_KINDLE
 
-static void identify_device(void);
+// Where we cache the results of the device identification (/tmp should be a safe bet on every supported platform)
+#	define FBINK_ID_CACHE_PATH    "/tmp/fbink-device-id.cache"
+// "FBID", in little-endian
+#	define FBINK_ID_CACHE_MAGIC   0x44494246u
+// Bump this if anything that affects the identification changes in a way FBINK_VERSION wouldn't catch
+#	define FBINK_ID_CACHE_VERSION 1U
+// NOTE: Everything before quirks is the key, it's only valid if it matches the current state *exactly*.
+typedef struct
+{
+	uint32_t          magic;
+	uint32_t          version;
+	uint32_t          quirks_size;          // sizeof(FBInkDeviceQuirks), to catch build variations
+	char              fbink_version[64];    // FBINK_VERSION
+	char              boot_id[40];          // /proc/sys/kernel/random/boot_id
+	char              kernel[sizeof(((struct utsname*) NULL)->release) + sizeof(((struct utsname*) NULL)->version)];
+	FBInkDeviceQuirks quirks;
+} FBInkDeviceIdCache;
+
+static int  get_device_id_cache_keys(FBInkDeviceIdCache* restrict);
+static bool load_device_id_cache(FBInkContext* restrict, const FBInkDeviceIdCache* restrict);
+static void store_device_id_cache(FBInkContext* restrict, const FBInkDeviceIdCache* restrict);
+static void identify_device(FBInkContext* restrict);
 #endif    // !FBINK_FOR_LINUX
 
 #endif
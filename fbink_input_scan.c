@@ -270,7 +270,7 @@ static void
 }
 
 static int
-    check_device_cap(FBInkInputDevice* restrict dev)
+    check_device_cap(FBInkContext* restrict ctx, FBInkInputDevice* restrict dev)
 {
 	unsigned long  bitmask_ev[NBITS(EV_MAX)]            = { 0U };
 	unsigned long  bitmask_abs[NBITS(ABS_MAX)]          = { 0U };
@@ -339,14 +339,14 @@ static int
 	if (dev->type & INPUT_TABLET) {
 		// This is easy enough if we're running as part of FBInk proper, and we run post-init,
 		// but we'll have to do some more work otherwise (e.g., in standalone input lib builds)...
-		if (vInfo.xres == 0U && vInfo.yres == 0U) {
+		if (ctx->vInfo.xres == 0U && ctx->vInfo.yres == 0U) {
 			// Open the framebuffer...
 			int fbfd = open("/dev/fb0", O_RDONLY | O_NONBLOCK | O_CLOEXEC);
 			if (fbfd == -1) {
 				PFWARN("Cannot open framebuffer character device (%m)");
 			} else {
 				// Request the info we need
-				if (ioctl(fbfd, FBIOGET_VSCREENINFO, &vInfo)) {
+				if (ioctl(fbfd, FBIOGET_VSCREENINFO, &ctx->vInfo)) {
 					PFWARN("Error reading variable fb information: %m");
 					// Too bad, we'll go on anyway
 				}
@@ -363,7 +363,8 @@ static int
 		uint32_t max_y = (uint32_t) abs_info.maximum;
 
 		// Check both dimensions to account for rotation shenanigans...
-		if ((max_x == vInfo.xres || max_x == vInfo.yres) && (max_y == vInfo.xres || max_y == vInfo.yres)) {
+		if ((max_x == ctx->vInfo.xres || max_x == ctx->vInfo.yres) &&
+		    (max_y == ctx->vInfo.xres || max_y == ctx->vInfo.yres)) {
 			dev->type |= INPUT_SCALED_TABLET;
 		}
 	}
@@ -459,7 +460,8 @@ static __attribute__((cold)) void
 
 // We've got an open fd, check the device's caps and apply the match filters
 static void
-    check_device(FBInkInputDevice* restrict dev,
+    check_device(FBInkContext* restrict ctx,
+		 FBInkInputDevice* restrict dev,
 		 INPUT_DEVICE_TYPE_T match_types,
 		 INPUT_DEVICE_TYPE_T exclude_types,
 		 INPUT_DEVICE_TYPE_T settings)
@@ -468,7 +470,7 @@ static void
 	ioctl(dev->fd, EVIOCGNAME(sizeof(dev->name)), dev->name);
 
 	// Let udev's builtin input_id logic do its thing!
-	check_device_cap(dev);
+	check_device_cap(ctx, dev);
 
 	// Recap the device's capabilities, unless requested otherwise.
 	if (!(settings & NO_RECAP)) {
@@ -513,10 +515,11 @@ static void
 
 // Scan /dev/input/event* for input devices, and classify/filter them
 FBInkInputDevice*
-    fbink_input_scan(INPUT_DEVICE_TYPE_T match_types   UNUSED_BY_NOINPUT,
-		     INPUT_DEVICE_TYPE_T exclude_types UNUSED_BY_NOINPUT,
-		     INPUT_DEVICE_TYPE_T settings      UNUSED_BY_NOINPUT,
-		     size_t* dev_count                 UNUSED_BY_NOINPUT)
+    fbink_input_scan_ctx(FBInkContext* restrict ctx        UNUSED_BY_NOINPUT,
+			 INPUT_DEVICE_TYPE_T match_types   UNUSED_BY_NOINPUT,
+			 INPUT_DEVICE_TYPE_T exclude_types UNUSED_BY_NOINPUT,
+			 INPUT_DEVICE_TYPE_T settings      UNUSED_BY_NOINPUT,
+			 size_t* dev_count                 UNUSED_BY_NOINPUT)
 {
 #ifdef FBINK_WITH_INPUT
 	struct dirent** namelist = NULL;
@@ -562,7 +565,7 @@ FBInkInputDevice*
 		fcntl(dev->fd, F_SETFD, fdflags | FD_CLOEXEC);
 #	endif
 
-		check_device(dev, match_types, exclude_types, settings);
+		check_device(ctx, dev, match_types, exclude_types, settings);
 
 		free(namelist[i]);
 	}
@@ -575,12 +578,22 @@ FBInkInputDevice*
 #endif    // FBINK_WITH_INPUT
 }
 
+FBInkInputDevice*
+    fbink_input_scan(INPUT_DEVICE_TYPE_T match_types,
+		     INPUT_DEVICE_TYPE_T exclude_types,
+		     INPUT_DEVICE_TYPE_T settings,
+		     size_t*             dev_count)
+{
+	return fbink_input_scan_ctx(&defaultCtx, match_types, exclude_types, settings, dev_count);
+}
+
 // Variant that takes a path instead of scanning /dev/input/event*
 FBInkInputDevice*
-    fbink_input_check(const char* filepath              UNUSED_BY_NOINPUT,
-		      INPUT_DEVICE_TYPE_T match_types   UNUSED_BY_NOINPUT,
-		      INPUT_DEVICE_TYPE_T exclude_types UNUSED_BY_NOINPUT,
-		      INPUT_DEVICE_TYPE_T settings      UNUSED_BY_NOINPUT)
+    fbink_input_check_ctx(FBInkContext* restrict ctx        UNUSED_BY_NOINPUT,
+			  const char* filepath              UNUSED_BY_NOINPUT,
+			  INPUT_DEVICE_TYPE_T match_types   UNUSED_BY_NOINPUT,
+			  INPUT_DEVICE_TYPE_T exclude_types UNUSED_BY_NOINPUT,
+			  INPUT_DEVICE_TYPE_T settings      UNUSED_BY_NOINPUT)
 {
 #ifdef FBINK_WITH_INPUT
 	// Default to NONBLOCK
@@ -604,7 +617,7 @@ FBInkInputDevice*
 
 	dev->fd = fd;
 	strtcpy(dev->path, filepath, sizeof(dev->path));
-	check_device(dev, match_types, exclude_types, settings);
+	check_device(ctx, dev, match_types, exclude_types, settings);
 
 	return dev;
 #else
@@ -612,3 +625,12 @@ FBInkInputDevice*
 	return NULL;
 #endif    // FBINK_WITH_INPUT
 }
+
+FBInkInputDevice*
+    fbink_input_check(const char*         filepath,
+		      INPUT_DEVICE_TYPE_T match_types,
+		      INPUT_DEVICE_TYPE_T exclude_types,
+		      INPUT_DEVICE_TYPE_T settings)
+{
+	return fbink_input_check_ctx(&defaultCtx, filepath, match_types, exclude_types, settings);
+}
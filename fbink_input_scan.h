@@ -81,8 +81,9 @@ static bool test_key(FBInkInputDevice* restrict dev,
 		     const unsigned long* restrict bitmask_ev,
 		     const unsigned long* restrict bitmask_key);
 static void test_platform_keys(FBInkInputDevice* restrict dev, const unsigned long* restrict bitmask_key);
-static int  check_device_cap(FBInkInputDevice* restrict dev);
-static void check_device(FBInkInputDevice* restrict dev,
+static int  check_device_cap(FBInkContext* restrict ctx, FBInkInputDevice* restrict dev);
+static void check_device(FBInkContext* restrict ctx,
+			 FBInkInputDevice* restrict dev,
 			 INPUT_DEVICE_TYPE_T match_types,
 			 INPUT_DEVICE_TYPE_T exclude_types,
 			 INPUT_DEVICE_TYPE_T settings);
@@ -147,6 +147,8 @@
 #include <limits.h>
 #include <linux/fb.h>
 #include <linux/kd.h>
+#include <pthread.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/ioctl.h>
@@ -488,150 +490,210 @@ static const uint8_t eInkBGCMap[16] = { 0xFF, 0xEE, 0xDD, 0xCC, 0xBB, 0xAA, 0x99
 //       is not noticeably faster than pack_rgb565() in our use-cases ;).
 //#include "fbink_rgb565.h"
 
-// Global variables to store fb/screen info
-unsigned char* restrict fbPtr = NULL;
-bool isFbMapped               = false;
+// The state of an FBInk session, c.f., FBInkContext in fbink.h
+// NOTE: The regular API simply uses defaultCtx, the _ctx API uses whichever one it's given.
+struct FBInkContext
+{
+	// fb/screen info
+	unsigned char* restrict fbPtr;
+	bool                    isFbMapped;
 #ifdef FBINK_FOR_KOBO
-FBInkKoboSunxi sunxiCtx = {
-	.disp_fd      = -1,
-	.i2c_fd       = -1,
-	.i2c_dev      = { 0 },
-	.ion_fd       = -1,
-	.alloc_size   = 0U,
-	.ion          = { .handle = 0, .fd = -1 },
-	.layer        = {},
-	.rota         = 0U,
-	.force_rota   = FORCE_ROTA_GYRO,
-	.has_fbdamage = false
-};
-// Provided by <https://github.com/NiLuJe/mxc_epdc_fb_damage>
-#	define FBDAMAGE_ROTATE_SYSFS "/sys/devices/virtual/fbdamage/fbdamage/rotate"
+	FBInkKoboSunxi sunxiCtx;
 #endif
 #ifdef FBINK_FOR_KINDLE
-struct mxcfb_swipe_data mtkSwipeData = { 0 };
-#endif
-struct fb_var_screeninfo vInfo = { 0 };
-struct fb_fix_screeninfo fInfo = { 0 };
-uint32_t                 viewWidth;
-uint32_t                 viewHeight;
-uint32_t                 screenWidth;
-uint32_t                 screenHeight;
-uint8_t                  viewHoriOrigin = 0U;
-uint8_t                  viewVertOrigin = 0U;
-uint8_t                  viewVertOffset = 0U;
-uint8_t                  glyphWidth     = 8U;
-uint8_t                  glyphHeight    = 8U;
-unsigned short int       FONTW          = 8U;
-unsigned short int       FONTH          = 8U;
-uint8_t                  FONTSIZE_MULT  = 1U;
-uint8_t                  penFGColor     = 0x00u;
-uint8_t                  penBGColor     = 0xFFu;
-FBInkPixel               penFGPixel;
-FBInkPixel               penBGPixel;
-uint32_t                 lastMarker                                         = 0U;
-// Slightly arbitrary-ish fallback values
-unsigned short int       MAXROWS                                            = 45U;
-unsigned short int       MAXCOLS                                            = 32U;
-// Verbose is for diagnostic/debug info in general
-bool                     g_isVerbose                                        = false;
-// Quiet is for fbink_init's hardware setup info
-bool                     g_isQuiet                                          = false;
-// Whether we log to stdout/stderr or the syslog
-bool                     g_toSysLog                                         = false;
-// This should be a pretty accurate fallback...
-long int                 USER_HZ                                            = 100;
-// Pointers to the appropriate put_pixel/get_pixel functions for the fb's bpp
-//void (*fxpPutPixel)(const FBInkCoordinates* restrict, const FBInkPixel* restrict) = NULL;
-void (*fxpGetPixel)(const FBInkCoordinates* restrict, FBInkPixel* restrict) = NULL;
-void (*fxpFillRect)(unsigned short int,
-		    unsigned short int,
-		    unsigned short int,
-		    unsigned short int,
-		    const FBInkPixel* restrict)                             = NULL;
-void (*fxpFillRectChecked)(unsigned short int,
-			   unsigned short int,
-			   unsigned short int,
-			   unsigned short int,
-			   const FBInkPixel* restrict)                      = NULL;
-// As well as the appropriate coordinates rotation functions...
-void (*fxpRotateCoords)(FBInkCoordinates* restrict)                         = NULL;
-void (*fxpRotateRegion)(struct mxcfb_rect* restrict)                        = NULL;
-// And the font bitmap getter...
-const unsigned char* (*fxpFont8xGetBitmap)(uint32_t)                        = NULL;
+	struct mxcfb_swipe_data mtkSwipeData;
+#endif
+	struct fb_var_screeninfo vInfo;
+	struct fb_fix_screeninfo fInfo;
+	uint32_t                 viewWidth;
+	uint32_t                 viewHeight;
+	uint32_t                 screenWidth;
+	uint32_t                 screenHeight;
+	uint8_t                  viewHoriOrigin;
+	uint8_t                  viewVertOrigin;
+	uint8_t                  viewVertOffset;
+	uint8_t                  glyphWidth;
+	uint8_t                  glyphHeight;
+	unsigned short int       FONTW;
+	unsigned short int       FONTH;
+	uint8_t                  FONTSIZE_MULT;
+	uint8_t                  penFGColor;
+	uint8_t                  penBGColor;
+	FBInkPixel               penFGPixel;
+	FBInkPixel               penBGPixel;
+	uint32_t                 lastMarker;
+	unsigned short int       MAXROWS;
+	unsigned short int       MAXCOLS;
+	long int                 USER_HZ;
+	// Pointers to the appropriate get_pixel/fill_rect functions for the fb's bpp
+	void (*fxpGetPixel)(FBInkContext* restrict, const FBInkCoordinates* restrict, FBInkPixel* restrict);
+	void (*fxpFillRect)(FBInkContext* restrict,
+			    unsigned short int,
+			    unsigned short int,
+			    unsigned short int,
+			    unsigned short int,
+			    const FBInkPixel* restrict);
+	void (*fxpFillRectChecked)(FBInkContext* restrict,
+				   unsigned short int,
+				   unsigned short int,
+				   unsigned short int,
+				   unsigned short int,
+				   const FBInkPixel* restrict);
+	// As well as the appropriate coordinates rotation functions...
+	void (*fxpRotateCoords)(FBInkContext* restrict, FBInkCoordinates* restrict);
+	void (*fxpRotateRegion)(FBInkContext* restrict, struct mxcfb_rect* restrict);
+	// And the font bitmap getter...
+	const unsigned char* (*fxpFont8xGetBitmap)(uint32_t);
 #ifdef FBINK_WITH_FONTS
-const uint16_t* (*fxpFont16xGetBitmap)(uint32_t) = NULL;
-const uint32_t* (*fxpFont32xGetBitmap)(uint32_t) = NULL;
-//const uint64_t* (*fxpFont64xGetBitmap)(uint32_t) = NULL;
+	const uint16_t* (*fxpFont16xGetBitmap)(uint32_t);
+	const uint32_t* (*fxpFont32xGetBitmap)(uint32_t);
+	//const uint64_t* (*fxpFont64xGetBitmap)(uint32_t);
 #endif
-
 #ifdef FBINK_FOR_KOBO
-// And the epdc wakeup one...
-int (*fxpWakeupEpdc)(void) = NULL;
+	// And the epdc wakeup one...
+	int (*fxpWakeupEpdc)(void);
+#endif
+	// Where we track device/screen-specific quirks
+	FBInkDeviceQuirks deviceQuirks;
+	// Where we track the last drawn rectangle
+	FBInkRect         lastRect;
+#ifndef FBINK_FOR_LINUX
+	// Physical address of the hardware alternate buffer we're refreshing from, if any (c.f., fbink_surface_present)
+	uint32_t altBufferAddr;
+#endif
+#ifdef FBINK_WITH_DRAW
+	// The offscreen surface we're currently drawing to, if any (c.f., fbink_surface_begin)
+	FBInkSurface*  activeSurface;
+	// And the actual framebuffer mapping, stashed away while it's active
+	unsigned char* stashedFbPtr;
+	bool           isFbStashed;
 #endif
-
-// Where we track device/screen-specific quirks
-FBInkDeviceQuirks deviceQuirks = { 0 };
-
-// Where we track the last drawn rectangle
-FBInkRect lastRect = { 0 };
-
 #ifdef FBINK_WITH_OPENTYPE
-// Information about the currently loaded OpenType font
-bool         otInit  = false;
-FBInkOTFonts otFonts = { NULL, NULL, NULL, NULL };
+	// Information about the currently loaded OpenType font
+	bool         otInit;
+	FBInkOTFonts otFonts;
 #endif
+};
+
+#ifdef FBINK_FOR_KOBO
+#	define FBINK_CTX_KOBO_INITIALIZER                                                                               \
+		.sunxiCtx = { .disp_fd      = -1,                                                                        \
+			      .i2c_fd       = -1,                                                                        \
+			      .i2c_dev      = { 0 },                                                                     \
+			      .ion_fd       = -1,                                                                        \
+			      .alloc_size   = 0U,                                                                        \
+			      .ion          = { .handle = 0, .fd = -1 },                                                 \
+			      .layer        = {},                                                                        \
+			      .rota         = 0U,                                                                        \
+			      .force_rota   = FORCE_ROTA_GYRO,                                                           \
+			      .has_fbdamage = false },
+// Provided by <https://github.com/NiLuJe/mxc_epdc_fb_damage>
+#	define FBDAMAGE_ROTATE_SYSFS "/sys/devices/virtual/fbdamage/fbdamage/rotate"
+#else
+#	define FBINK_CTX_KOBO_INITIALIZER
+#endif
+// NOTE: As a macro, because we also need it for the contexts allocated by fbink_ctx_new.
+//       Anything that isn't listed here starts zeroed.
+#define FBINK_CTX_INITIALIZER                                                                                            \
+	{                                                                                                                \
+		FBINK_CTX_KOBO_INITIALIZER                                                                               \
+		.glyphWidth    = 8U,                                                                                     \
+		.glyphHeight   = 8U,                                                                                     \
+		.FONTW         = 8U,                                                                                     \
+		.FONTH         = 8U,                                                                                     \
+		.FONTSIZE_MULT = 1U,                                                                                     \
+		.penFGColor    = 0x00u,                                                                                  \
+		.penBGColor    = 0xFFu,                                                                                  \
+		/* Slightly arbitrary-ish fallback values */                                                             \
+		.MAXROWS       = 45U,                                                                                    \
+		.MAXCOLS       = 32U,                                                                                    \
+		/* This should be a pretty accurate fallback... */                                                       \
+		.USER_HZ       = 100,                                                                                    \
+	}
+
+// The state used by the regular API
+static FBInkContext defaultCtx = FBINK_CTX_INITIALIZER;
+
+// NOTE: Logging is process-wide, it's not part of an FBInkContext.
+// Verbose is for diagnostic/debug info in general
+bool g_isVerbose = false;
+// Quiet is for fbink_init's hardware setup info
+bool g_isQuiet   = false;
+// Whether we log to stdout/stderr or the syslog
+bool g_toSysLog  = false;
 
 #if defined(FBINK_FOR_KOBO) || defined(FBINK_FOR_CERVANTES) || defined(FBINK_FOR_POCKETBOOK)
-static void rotate_coordinates_pickel(FBInkCoordinates* restrict);
+static void rotate_coordinates_pickel(FBInkContext* restrict, FBInkCoordinates* restrict);
 #endif
 #if defined(FBINK_FOR_KOBO) || defined(FBINK_FOR_CERVANTES)
-static void rotate_coordinates_boot(FBInkCoordinates* restrict);
+static void rotate_coordinates_boot(FBInkContext* restrict, FBInkCoordinates* restrict);
 #	ifdef FBINK_WITH_BUTTON_SCAN
-static void rotate_touch_coordinates(FBInkCoordinates* restrict);
+static void rotate_touch_coordinates(FBInkContext* restrict, FBInkCoordinates* restrict);
 #	endif
 #endif
-static void rotate_coordinates_nop(FBInkCoordinates* restrict __attribute__((unused)));
+static void rotate_coordinates_nop(FBInkContext* restrict __attribute__((unused)),
+				   FBInkCoordinates* restrict __attribute__((unused)));
 
 // NOTE: Making sure most of those are inlined helps fbink_print_ot (c.f., #43).
 #ifdef FBINK_WITH_DRAW
 static inline __attribute__((const, always_inline, hot)) uint16_t pack_bgr565(uint8_t, uint8_t, uint8_t);
 static inline __attribute__((const, always_inline, hot)) uint16_t pack_rgb565(uint8_t, uint8_t, uint8_t);
 
-static __attribute__((pure)) FBInkPixel pack_pixel_from_rgba(uint8_t, uint8_t, uint8_t, uint8_t);
-static __attribute__((pure)) FBInkPixel pack_pixel_from_y8(uint8_t);
+static __attribute__((pure)) FBInkPixel pack_pixel_from_rgba(FBInkContext* restrict, uint8_t, uint8_t, uint8_t, uint8_t);
+static __attribute__((pure)) FBInkPixel pack_pixel_from_y8(FBInkContext* restrict, uint8_t);
 
-static inline __attribute__((always_inline, hot)) void put_pixel_Gray4(const FBInkCoordinates* restrict,
+static inline __attribute__((always_inline, hot)) void put_pixel_Gray4(FBInkContext* restrict,
+								       const FBInkCoordinates* restrict,
 								       const FBInkPixel* restrict);
-static inline __attribute__((always_inline, hot)) void put_pixel_Gray8(const FBInkCoordinates* restrict,
+static inline __attribute__((always_inline, hot)) void put_pixel_Gray8(FBInkContext* restrict,
+								       const FBInkCoordinates* restrict,
 								       const FBInkPixel* restrict);
-static inline __attribute__((always_inline)) void      put_pixel_BGR24(const FBInkCoordinates* restrict,
+static inline __attribute__((always_inline)) void      put_pixel_BGR24(FBInkContext* restrict,
+								       const FBInkCoordinates* restrict,
 								       const FBInkPixel* restrict);
-static inline __attribute__((always_inline)) void      put_pixel_RGB24(const FBInkCoordinates* restrict,
+static inline __attribute__((always_inline)) void      put_pixel_RGB24(FBInkContext* restrict,
+								       const FBInkCoordinates* restrict,
 								       const FBInkPixel* restrict);
-static inline __attribute__((always_inline, hot)) void put_pixel_RGB32(const FBInkCoordinates* restrict,
+static inline __attribute__((always_inline, hot)) void put_pixel_RGB32(FBInkContext* restrict,
+								       const FBInkCoordinates* restrict,
 								       const FBInkPixel* restrict);
-static inline __attribute__((always_inline, hot)) void put_pixel_RGB565(const FBInkCoordinates* restrict,
+static inline __attribute__((always_inline, hot)) void put_pixel_RGB565(FBInkContext* restrict,
+									const FBInkCoordinates* restrict,
 									const FBInkPixel* restrict);
 // NOTE: We pass coordinates by value here, because a rotation transformation *may* be applied to them,
 //       and that's a rotation that the caller will *never* care about.
-static inline __attribute__((always_inline, hot)) void put_pixel(FBInkCoordinates, const FBInkPixel* restrict, bool);
+static inline __attribute__((always_inline, hot)) void put_pixel(FBInkContext* restrict,
+								 FBInkCoordinates,
+								 const FBInkPixel* restrict,
+								 bool);
 // NOTE: On the other hand, if you happen to be calling function pointers directly,
 //       it's left to you to not do anything stupid ;)
 
-static inline __attribute__((always_inline, hot)) void get_pixel_Gray4(const FBInkCoordinates* restrict,
+static inline __attribute__((always_inline, hot)) void get_pixel_Gray4(FBInkContext* restrict,
+								       const FBInkCoordinates* restrict,
 								       FBInkPixel* restrict);
-static inline __attribute__((always_inline, hot)) void get_pixel_Gray8(const FBInkCoordinates* restrict,
+static inline __attribute__((always_inline, hot)) void get_pixel_Gray8(FBInkContext* restrict,
+								       const FBInkCoordinates* restrict,
 								       FBInkPixel* restrict);
-static inline __attribute__((always_inline)) void get_pixel_BGR24(const FBInkCoordinates* restrict, FBInkPixel* restrict);
-static inline __attribute__((always_inline)) void get_pixel_RGB24(const FBInkCoordinates* restrict, FBInkPixel* restrict);
-static inline __attribute__((always_inline, hot)) void get_pixel_RGB32(const FBInkCoordinates* restrict,
+static inline __attribute__((always_inline)) void get_pixel_BGR24(FBInkContext* restrict,
+								  const FBInkCoordinates* restrict,
+								  FBInkPixel* restrict);
+static inline __attribute__((always_inline)) void get_pixel_RGB24(FBInkContext* restrict,
+								  const FBInkCoordinates* restrict,
+								  FBInkPixel* restrict);
+static inline __attribute__((always_inline, hot)) void get_pixel_RGB32(FBInkContext* restrict,
+								       const FBInkCoordinates* restrict,
 								       FBInkPixel* restrict);
-static inline __attribute__((always_inline, hot)) void get_pixel_BGR565(const FBInkCoordinates* restrict,
+static inline __attribute__((always_inline, hot)) void get_pixel_BGR565(FBInkContext* restrict,
+									const FBInkCoordinates* restrict,
 									FBInkPixel* restrict);
-static inline __attribute__((always_inline, hot)) void get_pixel_RGB565(const FBInkCoordinates* restrict,
+static inline __attribute__((always_inline, hot)) void get_pixel_RGB565(FBInkContext* restrict,
+									const FBInkCoordinates* restrict,
 									FBInkPixel* restrict);
 // NOTE: Same as put_pixel ;)
-static inline __attribute__((always_inline, hot)) void get_pixel(FBInkCoordinates, FBInkPixel* restrict);
+static inline __attribute__((always_inline, hot)) void get_pixel(FBInkContext* restrict,
+								 FBInkCoordinates,
+								 FBInkPixel* restrict);
 #endif    // FBINK_WITH_DRAW
 
 #if defined(FBINK_WITH_IMAGE) || defined(FBINK_WITH_OPENTYPE)
@@ -659,57 +721,68 @@ static inline __attribute__((always_inline, hot)) void get_pixel(FBInkCoordinate
 #ifdef FBINK_WITH_DRAW
 // NOTE: Enforced inlining on fill_rect currently doesn't gain us anything, on the other hand.
 //       Which is why we went with a function pointer to bitdepth-specific branchless variants ;).
-static __attribute__((hot)) void fill_rect_Gray4(unsigned short int,
+static __attribute__((hot)) void fill_rect_Gray4(FBInkContext* restrict,
+						 unsigned short int,
 						 unsigned short int,
 						 unsigned short int,
 						 unsigned short int,
 						 const FBInkPixel* restrict);
-static __attribute__((hot)) void fill_rect_Gray4_checked(unsigned short int,
+static __attribute__((hot)) void fill_rect_Gray4_checked(FBInkContext* restrict,
+							 unsigned short int,
 							 unsigned short int,
 							 unsigned short int,
 							 unsigned short int,
 							 const FBInkPixel* restrict);
-static __attribute__((hot)) void fill_rect_Gray8(unsigned short int,
+static __attribute__((hot)) void fill_rect_Gray8(FBInkContext* restrict,
+						 unsigned short int,
 						 unsigned short int,
 						 unsigned short int,
 						 unsigned short int,
 						 const FBInkPixel* restrict);
-static __attribute__((hot)) void fill_rect_Gray8_checked(unsigned short int,
+static __attribute__((hot)) void fill_rect_Gray8_checked(FBInkContext* restrict,
+							 unsigned short int,
 							 unsigned short int,
 							 unsigned short int,
 							 unsigned short int,
 							 const FBInkPixel* restrict);
-static __attribute__((hot)) void fill_rect_RGB565(unsigned short int,
+static __attribute__((hot)) void fill_rect_RGB565(FBInkContext* restrict,
+						  unsigned short int,
 						  unsigned short int,
 						  unsigned short int,
 						  unsigned short int,
 						  const FBInkPixel* restrict);
-static __attribute__((hot)) void fill_rect_RGB565_checked(unsigned short int,
+static __attribute__((hot)) void fill_rect_RGB565_checked(FBInkContext* restrict,
+							  unsigned short int,
 							  unsigned short int,
 							  unsigned short int,
 							  unsigned short int,
 							  const FBInkPixel* restrict);
-static void                      fill_rect_RGB24(unsigned short int,
+static void                      fill_rect_RGB24(FBInkContext* restrict,
+						 unsigned short int,
 						 unsigned short int,
 						 unsigned short int,
 						 unsigned short int,
 						 const FBInkPixel* restrict);
-static void                      fill_rect_RGB24_checked(unsigned short int,
+static void                      fill_rect_RGB24_checked(FBInkContext* restrict,
+							 unsigned short int,
 							 unsigned short int,
 							 unsigned short int,
 							 unsigned short int,
 							 const FBInkPixel* restrict);
-static __attribute__((hot)) void fill_rect_RGB32(unsigned short int,
+static __attribute__((hot)) void fill_rect_RGB32(FBInkContext* restrict,
+						 unsigned short int,
 						 unsigned short int,
 						 unsigned short int,
 						 unsigned short int,
 						 const FBInkPixel* restrict);
-static __attribute__((hot)) void fill_rect_RGB32_checked(unsigned short int,
+static __attribute__((hot)) void fill_rect_RGB32_checked(FBInkContext* restrict,
+							 unsigned short int,
 							 unsigned short int,
 							 unsigned short int,
 							 unsigned short int,
 							 const FBInkPixel* restrict);
-static void                      clear_screen(int UNUSED_BY_NOTKINDLE, FBInkPixel*, bool UNUSED_BY_NOTKINDLE);
+static void
+    clear_screen(FBInkContext* restrict, int UNUSED_BY_NOTKINDLE, FBInkPixel*, bool UNUSED_BY_NOTKINDLE);
 //static void checkerboard_screen(void);
 #endif    // FBINK_WITH_DRAW
 
@@ -722,7 +795,8 @@ static __attribute__((cold)) const char* fontname_to_string(FONT_INDEX_E);
 #ifdef FBINK_WITH_BITMAP
 static int zu_print_length(size_t);
 
-static struct mxcfb_rect draw(const char* restrict,
+static struct mxcfb_rect draw(FBInkContext* restrict,
+			      const char* restrict,
 			      unsigned short int,
 			      unsigned short int,
 			      unsigned short int,
@@ -731,45 +805,57 @@ static struct mxcfb_rect draw(const char* restrict,
 #endif
 
 #ifndef FBINK_FOR_LINUX
-static __attribute__((cold)) long int jiffies_to_ms(long int);
+static __attribute__((cold)) long int jiffies_to_ms(FBInkContext* restrict, long int);
+static uint32_t
+    set_alt_buffer_data(FBInkContext* restrict, const struct mxcfb_rect, struct mxcfb_alt_buffer_data* restrict);
 #	if defined(FBINK_FOR_KINDLE)
-static int refresh_legacy(int, const struct mxcfb_rect, bool);
-static int wait_for_submission_kindle(int, uint32_t);
-static int refresh_kindle(int, const struct mxcfb_rect, const FBInkConfig*);
-static int wait_for_complete_kindle_pearl(int, uint32_t);
-static int wait_for_complete_kindle(int, uint32_t);
-static int refresh_kindle_zelda(int, const struct mxcfb_rect, const FBInkConfig*);
-static int refresh_kindle_rex(int, const struct mxcfb_rect, const FBInkConfig*);
-static int refresh_kindle_mtk(int, const struct mxcfb_rect, const FBInkConfig*);
+static int refresh_legacy(FBInkContext* restrict, int, const struct mxcfb_rect, bool);
+static int wait_for_submission_kindle(FBInkContext* restrict, int, uint32_t);
+static int refresh_kindle(FBInkContext* restrict, int, const struct mxcfb_rect, const FBInkConfig*);
+static int wait_for_complete_kindle_pearl(FBInkContext* restrict, int, uint32_t);
+static int wait_for_complete_kindle(FBInkContext* restrict, int, uint32_t);
+static int refresh_kindle_zelda(FBInkContext* restrict, int, const struct mxcfb_rect, const FBInkConfig*);
+static int refresh_kindle_rex(FBInkContext* restrict, int, const struct mxcfb_rect, const FBInkConfig*);
+static int refresh_kindle_mtk(FBInkContext* restrict, int, const struct mxcfb_rect, const FBInkConfig*);
 #	elif defined(FBINK_FOR_CERVANTES)
-static int refresh_cervantes(int, const struct mxcfb_rect, const FBInkConfig*);
-static int wait_for_complete_cervantes(int, uint32_t);
+static int refresh_cervantes(FBInkContext* restrict, int, const struct mxcfb_rect, const FBInkConfig*);
+static int wait_for_complete_cervantes(FBInkContext* restrict, int, uint32_t);
 #	elif defined(FBINK_FOR_REMARKABLE)
-static int refresh_remarkable(int, const struct mxcfb_rect, const FBInkConfig*);
-static int wait_for_complete_remarkable(int, uint32_t);
+static int refresh_remarkable(FBInkContext* restrict, int, const struct mxcfb_rect, const FBInkConfig*);
+static int wait_for_complete_remarkable(FBInkContext* restrict, int, uint32_t);
 #	elif defined(FBINK_FOR_POCKETBOOK)
-static int refresh_pocketbook(int, const struct mxcfb_rect, const FBInkConfig*);
-static int wait_for_complete_pocketbook(int, uint32_t);
+static int refresh_pocketbook(FBInkContext* restrict, int, const struct mxcfb_rect, const FBInkConfig*);
+static int wait_for_complete_pocketbook(FBInkContext* restrict, int, uint32_t);
 #	elif defined(FBINK_FOR_KOBO)
-static int refresh_kobo(int, const struct mxcfb_rect, const FBInkConfig*);
-static int wait_for_complete_kobo(int, uint32_t);
-static int refresh_kobo_mk7(int, const struct mxcfb_rect, const FBInkConfig*);
-static int wait_for_complete_kobo_mk7(int, uint32_t);
-static int refresh_kobo_sunxi(const struct mxcfb_rect, const FBInkConfig*);
-static int wait_for_complete_kobo_sunxi(uint32_t);
-static int refresh_kobo_mtk(int, const struct mxcfb_rect, const FBInkConfig*);
-static int wait_for_submission_kobo_mtk(int, uint32_t);
-static int wait_for_complete_kobo_mtk(int, uint32_t);
+static int refresh_kobo(FBInkContext* restrict, int, const struct mxcfb_rect, const FBInkConfig*);
+static int wait_for_complete_kobo(FBInkContext* restrict, int, uint32_t);
+static int refresh_kobo_mk7(FBInkContext* restrict, int, const struct mxcfb_rect, const FBInkConfig*);
+static int wait_for_complete_kobo_mk7(FBInkContext* restrict, int, uint32_t);
+static int refresh_kobo_sunxi(FBInkContext* restrict, const struct mxcfb_rect, const FBInkConfig*);
+static int wait_for_complete_kobo_sunxi(FBInkContext* restrict, uint32_t);
+static int refresh_kobo_mtk(FBInkContext* restrict, int, const struct mxcfb_rect, const FBInkConfig*);
+static int wait_for_submission_kobo_mtk(FBInkContext* restrict, int, uint32_t);
+static int wait_for_complete_kobo_mtk(FBInkContext* restrict, int, uint32_t);
 #	endif    // FBINK_FOR_KINDLE
-static inline void compute_update_marker(void);
+static inline void compute_update_marker(FBInkContext* restrict);
 #endif    // !FBINK_FOR_LINUX
-static int refresh_compat(int, const struct mxcfb_rect, bool, const FBInkConfig*);
-static int refresh(int, const struct mxcfb_rect, const FBInkConfig*);
+static int refresh_compat(FBInkContext* restrict, int, const struct mxcfb_rect, bool, const FBInkConfig*);
+static int refresh(FBInkContext* restrict, int, const struct mxcfb_rect, const FBInkConfig*);
+#ifdef FBINK_WITH_DRAW
+static void damage_surface(FBInkContext* restrict, const struct mxcfb_rect* restrict);
+static bool is_surface_stale(FBInkContext* restrict, const FBInkSurface* restrict);
+#	ifndef FBINK_FOR_LINUX
+static size_t get_alt_buffer_offset(FBInkContext* restrict);
+#	endif
+static inline bool is_surface_in_fb(const FBInkSurface* restrict);
+static void        copy_surface_damage(const FBInkSurface* restrict, unsigned char* restrict, const unsigned char* restrict);
+static int         pan_display(FBInkContext* restrict, int, uint32_t);
+#endif
 #if defined(FBINK_FOR_KINDLE) || defined(FBINK_FOR_KOBO)
-static int wait_for_submission(int, uint32_t);
+static int wait_for_submission(FBInkContext* restrict, int, uint32_t);
 #endif
 #ifndef FBINK_FOR_LINUX
-static int wait_for_complete(int, uint32_t);
+static int wait_for_complete(FBInkContext* restrict, int, uint32_t);
 #endif
 #ifdef FBINK_FOR_KOBO
 #	define NTX_NXP_EPDC_POWER "/sys/class/graphics/fb0/power_state"
@@ -779,8 +865,10 @@ static int wakeup_epdc_kobo_mtk(void);
 #endif
 
 static inline __attribute__((always_inline)) const char* get_fbdev_path(void);
-static int                                               open_fb_fd(int* restrict, bool* restrict);
-static int                                               open_fb_fd_nonblock(int* restrict, bool* restrict);
+static int
+    open_fb_fd(FBInkContext* restrict, int* restrict, bool* restrict);
+static int
+    open_fb_fd_nonblock(FBInkContext* restrict, int* restrict, bool* restrict);
 
 static __attribute__((cold)) const char* fb_rotate_to_string(uint32_t);
 static __attribute__((cold)) const char* fb_pixfmt_to_string(FBINK_PXFMT_INDEX_E);
@@ -788,82 +876,205 @@ static __attribute__((cold)) const char* fb_pixfmt_to_string(FBINK_PXFMT_INDEX_E
 static __attribute__((cold)) const char* einkfb_orientation_to_string(orientation_t);
 #endif
 #ifdef FBINK_WITH_DRAW
-static __attribute__((cold)) int set_pen_color(bool, bool, bool, bool, uint8_t, uint8_t, uint8_t, uint8_t);
-static __attribute__((cold)) int update_pen_colors(const FBInkConfig* restrict);
+static __attribute__((cold)) int
+    set_pen_color(FBInkContext* restrict, bool, bool, bool, bool, uint8_t, uint8_t, uint8_t, uint8_t);
+static __attribute__((cold)) int update_pen_colors(FBInkContext* restrict, const FBInkConfig* restrict);
 #endif
 static __attribute__((cold)) void update_verbosity(const FBInkConfig* restrict);
 #ifdef FBINK_FOR_POCKETBOOK
-static __attribute__((cold)) void pocketbook_fix_fb_info(void);
+static __attribute__((cold)) void pocketbook_fix_fb_info(FBInkContext* restrict);
 #endif
 #ifdef FBINK_FOR_KOBO
-static __attribute__((cold)) void        kobo_sunxi_fb_fixup(bool);
+static __attribute__((cold)) void        kobo_sunxi_fb_fixup(FBInkContext* restrict, bool);
 static __attribute__((cold)) const char* sunxi_force_rota_to_string(SUNXI_FORCE_ROTA_INDEX_E);
 #endif
-static __attribute__((cold)) int initialize_fbink(int, const FBInkConfig* restrict, bool);
+static __attribute__((cold)) int initialize_fbink(FBInkContext* restrict, int, const FBInkConfig* restrict, bool);
 
-static int memmap_fb(int);
+static int memmap_fb(FBInkContext* restrict, int);
 #ifdef FBINK_FOR_KOBO
 static void yield_to_sunxi_disp(void);
-static int  memmap_ion(void);
+static int  memmap_ion(FBInkContext* restrict);
 #endif
-static inline void close_fb(int);
-static int         unmap_fb(void);
+static inline void close_fb(FBInkContext* restrict, int);
+static int         unmap_fb(FBInkContext* restrict);
 #ifdef FBINK_FOR_KOBO
-static int unmap_ion(void);
+static int unmap_ion(FBInkContext* restrict);
+#endif
+#ifdef FBINK_WITH_DRAW
+static size_t get_fb_map_size(FBInkContext* restrict);
 #endif
 
 #if defined(FBINK_FOR_KOBO) || defined(FBINK_FOR_CERVANTES) || defined(FBINK_FOR_POCKETBOOK)
-static void rotate_region_pickel(struct mxcfb_rect* restrict);
+static void rotate_region_pickel(FBInkContext* restrict, struct mxcfb_rect* restrict);
 #endif
 #if defined(FBINK_FOR_KOBO) || defined(FBINK_FOR_CERVANTES)
-static void rotate_region_boot(struct mxcfb_rect* restrict);
+static void rotate_region_boot(FBInkContext* restrict, struct mxcfb_rect* restrict);
 #endif
-static void rotate_region_nop(struct mxcfb_rect* restrict);
-static void fullscreen_region(struct mxcfb_rect* restrict);
+static void rotate_region_nop(FBInkContext* restrict, struct mxcfb_rect* restrict);
+static void fullscreen_region(FBInkContext* restrict, struct mxcfb_rect* restrict);
 
 #ifdef FBINK_WITH_DRAW
-static int fill_rect(int, const FBInkConfig* restrict, const FBInkRect* restrict, const FBInkPixel* restrict, bool);
+static int fill_rect(FBInkContext* restrict,
+		     int,
+		     const FBInkConfig* restrict,
+		     const FBInkRect* restrict,
+		     const FBInkPixel* restrict,
+		     bool);
 #endif
 
-static int grid_to_region(int, unsigned short int, unsigned short int, bool, const FBInkConfig* restrict);
+static int grid_to_region(FBInkContext* restrict,
+			  int,
+			  unsigned short int,
+			  unsigned short int,
+			  bool,
+			  const FBInkConfig* restrict);
 
-static void set_last_rect(const struct mxcfb_rect* restrict);
+static void set_last_rect(FBInkContext* restrict, const struct mxcfb_rect* restrict);
 
 #ifdef FBINK_WITH_BITMAP
-int draw_progress_bars(int, bool, uint8_t, const FBInkConfig* restrict);
+int draw_progress_bars(FBInkContext* restrict, int, bool, uint8_t, const FBInkConfig* restrict);
 #endif
 
 #ifdef FBINK_WITH_IMAGE
 unsigned char*
     qSmoothScaleImage(const unsigned char* restrict src, int sw, int sh, int sn, bool ignore_alpha, int dw, int dh);
-
-static unsigned char*               img_load_from_file(const char*, int* restrict, int* restrict, int* restrict, int);
+// c.f., qimagescale/qimagescale_p.h
+typedef struct QImageScaleInfo QImageScaleInfo;
+QImageScaleInfo* qSmoothScaleInfoCreate(int sw, int sh, int sn, int dw, int dh);
+void             qSmoothScaleInfoFree(QImageScaleInfo* isi);
+int              qSmoothScaleRows(const QImageScaleInfo* isi,
+				  const unsigned char* restrict src,
+				  bool                          ignore_alpha,
+				  int                           dy,
+				  int                           rows,
+				  unsigned char* restrict dest);
+
+static void                         img_compute_scaled_size(int,
+							    int,
+							    const FBInkConfig* restrict,
+							    unsigned short int* restrict,
+							    unsigned short int* restrict);
+static void                         img_jpeg_idct_dc(unsigned char*, int, short[64]);
+static unsigned char*
+    img_load_jpeg_scaled(const unsigned char* restrict, int, int, int* restrict, int* restrict, int* restrict, int);
+static unsigned char*               img_load_from_memory(const unsigned char* restrict,
+							 size_t,
+							 int* restrict,
+							 int* restrict,
+							 int* restrict,
+							 int,
+							 const FBInkConfig* restrict,
+							 unsigned short int* restrict,
+							 unsigned short int* restrict);
+static unsigned char*               img_load_from_file(const char*,
+						       int* restrict,
+						       int* restrict,
+						       int* restrict,
+						       int,
+						       const FBInkConfig* restrict,
+						       unsigned short int* restrict,
+						       unsigned short int* restrict);
 static unsigned char*               img_convert_px_format(const unsigned char* restrict, int, int, int, int);
 static __attribute__((hot)) uint8_t dither_o8x8(unsigned short int, unsigned short int, uint8_t);
-static uint8_t                      hhuclampf(float d, float min, float max);
-static __attribute__((hot)) void    saturation_boost_hsp(FBInkPixelRGBA* restrict px, const float);
-static int                          draw_image(int,
+static void                         clip_image(FBInkContext* restrict,
+					       const int,
+					       const int,
+					       short int,
+					       short int,
+					       const FBInkConfig* restrict,
+					       FBInkImageClip* restrict);
+static void                         blit_image_rows(FBInkContext* restrict,
+						    const unsigned char* restrict,
+						    const unsigned short int,
+						    const int,
+						    const int,
+						    const bool,
+						    const FBInkImageClip* restrict,
+						    const unsigned short int,
+						    const unsigned short int,
+						    const FBInkConfig* restrict,
+						    const FBInkColorPrep* restrict);
+static size_t                       get_image_threads(const FBInkConfig* restrict, size_t);
+static unsigned short int           get_image_band_rows(int, int, int);
+static void                         run_image_workers(void* (*)(void*), void*, size_t, size_t);
+static void*                        draw_image_bands(void*);
+static int                          draw_image(FBInkContext* restrict,
+					       int,
 					       const unsigned char* restrict,
 					       const int,
 					       const int,
 					       const int,
 					       const int,
+					       const int,
+					       const int,
 					       short int,
 					       short int,
-					       const FBInkConfig* restrict);
+					       const FBInkConfig* restrict,
+					       const FBInkScalePlan* restrict);
+static int                          print_image(FBInkContext* restrict,
+						int,
+						const char*,
+						short int,
+						short int,
+						const FBInkConfig* restrict,
+						const FBInkScalePlan* restrict);
+static int                          print_raw_data(FBInkContext* restrict,
+						   int,
+						   const unsigned char* restrict,
+						   const int,
+						   const int,
+						   const size_t,
+						   short int,
+						   short int,
+						   const FBInkConfig* restrict,
+						   const FBInkScalePlan* restrict);
+static inline __attribute__((always_inline)) void put_packed_pixel(FBInkContext* restrict,
+								   unsigned short int,
+								   unsigned short int,
+								   const FBInkPixel* restrict,
+								   uint8_t);
+static int                          draw_packed_data(FBInkContext* restrict,
+						     int,
+						     const unsigned char* restrict,
+						     const int,
+						     const int,
+						     const size_t,
+						     const uint8_t,
+						     short int,
+						     short int,
+						     const FBInkConfig* restrict);
+static int                          draw_native_data(FBInkContext* restrict,
+						     int,
+						     const unsigned char* restrict,
+						     const int,
+						     const int,
+						     const size_t,
+						     short int,
+						     short int,
+						     const FBInkConfig* restrict);
+static void*                        load_thumbnails(void*);
 #endif
 
 #ifdef FBINK_WITH_OPENTYPE
 static __attribute__((cold)) const char* font_style_to_string(FONT_STYLE_E);
-static __attribute__((cold)) int         add_ot_font(const char*, FONT_STYLE_T, FBInkOTFonts* restrict);
+static __attribute__((cold)) int
+    add_ot_font(FBInkContext* restrict, const char*, FONT_STYLE_T, FBInkOTFonts* restrict);
 static __attribute__((cold)) int         free_ot_font(stbtt_fontinfo** restrict);
 static __attribute__((cold)) int         free_ot_fonts(FBInkOTFonts* restrict);
 static void                              parse_simple_md(const char* restrict, size_t, unsigned char* restrict);
 static __attribute__((cold)) const char* glyph_style_to_string(CHARACTER_FONT_E);
 #endif
 
+static int vprintf_text(FBInkContext* restrict,
+			int,
+			const FBInkOTConfig* restrict,
+			const FBInkConfig* restrict,
+			FBInkOTFit* restrict,
+			const char*,
+			va_list) __attribute__((format(printf, 6, 0)));
+
 #ifndef FBINK_FOR_LINUX
-static uint32_t                          get_wfm_mode(WFM_MODE_INDEX_T);
+static uint32_t                          get_wfm_mode(FBInkContext* restrict, WFM_MODE_INDEX_T);
 static __attribute__((cold)) const char* wfm_to_string(WFM_MODE_INDEX_E);
 #	ifdef FBINK_FOR_KINDLE
 static __attribute__((cold)) const char* kindle_wfm_to_string(uint32_t);
@@ -885,11 +1096,34 @@ static __attribute__((cold)) const char* hwd_to_string(HW_DITHER_INDEX_E);
 #endif
 
 #ifdef FBINK_FOR_KOBO
-static int kobo_sunxi_reinit_check(int, const FBInkConfig* restrict);
+static int kobo_sunxi_reinit_check(FBInkContext* restrict, int, const FBInkConfig* restrict);
 #endif
 
 #ifdef FBINK_WITH_IMAGE
-static int dump_region(struct mxcfb_rect* region, FBInkDump* restrict dump);
+static int    dump_region(FBInkContext* restrict ctx, struct mxcfb_rect* region, FBInkDump* restrict dump);
+static size_t rle_pack_row(const unsigned char* restrict, size_t, uint8_t, unsigned char* restrict);
+static void   rle_unpack_row(const unsigned char* restrict, size_t, size_t, uint8_t, unsigned char* restrict);
+static void   restore_compressed_rows(FBInkContext* restrict,
+				      const FBInkDump* restrict,
+				      unsigned short int,
+				      unsigned short int,
+				      unsigned short int,
+				      unsigned short int,
+				      unsigned short int,
+				      unsigned short int);
+static void   rotate_region_by(struct mxcfb_rect* restrict, uint8_t, uint32_t, uint32_t);
+static __attribute__((const)) FBINK_PXFMT_INDEX_T pxfmt_from_bpp(uint8_t);
+static void unpack_px_row(const unsigned char* restrict, FBINK_PXFMT_INDEX_T, FBInkPixelRGBA* restrict, size_t);
+static void pack_px_row(const FBInkPixelRGBA* restrict, FBINK_PXFMT_INDEX_T, unsigned char* restrict, size_t);
+static inline __attribute__((always_inline, hot)) void
+	    copy_px(unsigned char* restrict, const unsigned char* restrict, uint8_t);
+static int restore_converted_region(FBInkContext* restrict,
+				    const FBInkDump* restrict,
+				    FBINK_PXFMT_INDEX_T,
+				    uint8_t,
+				    uint32_t,
+				    uint32_t,
+				    const struct mxcfb_rect* restrict);
 #endif
 
 // For identify_device, which we need outside of fbink_device_id.c ;)
@@ -902,6 +1136,11 @@ static int dump_region(struct mxcfb_rect* region, FBInkDump* restrict dump);
 #	include "fbink_rota_quirks.h"
 #endif
 
+// Scanline pixel format converters, which we need for image processing
+#ifdef FBINK_WITH_IMAGE
+#	include "fbink_px_convert.h"
+#endif
+
 // String utilities, to avoid using strncpy (c.f., string_copying(7)).
 #if defined(FBINK_WITH_INPUT) || !defined(FBINK_FOR_LINUX)
 #	include "fbink_string_utils.h"
@@ -0,0 +1,467 @@
+/*
+	FBInk: FrameBuffer eInker, a library to print text & images to an eInk Linux framebuffer
+	Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fbink_px_convert.h"
+#include "qimagescale/qsimd_p.h"
+
+#ifdef QT_COMPILER_SUPPORTS_SIMD
+QT_SIMD_TARGET_PUSH
+#	if defined(QT_COMPILER_SUPPORTS_NEON)
+#		include "fbink_px_convert_neon.c"
+#	endif
+#	if defined(QT_COMPILER_SUPPORTS_SSE4_1)
+#		include "fbink_px_convert_sse4.c"
+#	endif
+QT_SIMD_TARGET_POP
+
+// The SIMD kernels, if the CPU actually supports them (c.f., resolve_px_convert_kernels).
+// NOTE: These only depend on the CPU, so they're process-wide, and not part of an FBInkContext's state.
+static size_t (*fxpConvertPxRowToY)(const unsigned char*, uint8_t, unsigned char*, uint8_t, size_t)  = NULL;
+static size_t (*fxpConvertPxRowToBGRX)(const unsigned char*, uint8_t, unsigned char*, size_t)        = NULL;
+static size_t (*fxpConvertPxRowToRGB565)(const unsigned char*, uint8_t, unsigned char*, size_t, bool) = NULL;
+static size_t (*fxpBlendPxRowToY8)(const unsigned char*, unsigned char*, size_t, uint8_t)            = NULL;
+static size_t (*fxpBlendPxRowToBGRX)(const unsigned char*, unsigned char*, size_t, uint8_t, bool)    = NULL;
+static size_t (*fxpBlendPxRowToRGB565)(const unsigned char*, unsigned char*, size_t, uint8_t, bool)  = NULL;
+static pthread_once_t pxConvertOnce                                                                     = PTHREAD_ONCE_INIT;
+
+static void
+    resolve_px_convert_kernels(void)
+{
+	if (!qCpuHasSimd()) {
+		LOG("SIMD scanline converters are unsupported on this CPU");
+		return;
+	}
+
+#	if defined(QT_COMPILER_SUPPORTS_SSE4_1)
+	fxpConvertPxRowToY      = &convert_px_row_to_y_sse4;
+	fxpConvertPxRowToBGRX   = &convert_px_row_to_bgrx_sse4;
+	fxpConvertPxRowToRGB565 = &convert_px_row_to_rgb565_sse4;
+	fxpBlendPxRowToY8       = &blend_px_row_ya_to_y8_sse4;
+	fxpBlendPxRowToBGRX     = &blend_px_row_rgba_to_bgrx_sse4;
+	fxpBlendPxRowToRGB565   = &blend_px_row_rgba_to_rgb565_sse4;
+#	elif defined(QT_COMPILER_SUPPORTS_NEON)
+	fxpConvertPxRowToY      = &convert_px_row_to_y_neon;
+	fxpConvertPxRowToBGRX   = &convert_px_row_to_bgrx_neon;
+	fxpConvertPxRowToRGB565 = &convert_px_row_to_rgb565_neon;
+	fxpBlendPxRowToY8       = &blend_px_row_ya_to_y8_neon;
+	fxpBlendPxRowToBGRX     = &blend_px_row_rgba_to_bgrx_neon;
+	fxpBlendPxRowToRGB565   = &blend_px_row_rgba_to_rgb565_neon;
+#	endif
+}
+#endif
+
+// Grayscale a scanline of len RGB (src_n == 3) or RGBA (src_n == 4) pixels to Y (dst_n == 1) or YA (dst_n == 2).
+// NOTE: Bit-exact w/ stbi__compute_y, alpha is either passed through, or set to 0xFF if the input has none.
+static void
+    convert_px_row_to_y(const unsigned char* src, uint8_t src_n, unsigned char* dst, uint8_t dst_n, size_t len)
+{
+	size_t i = 0U;
+#ifdef QT_COMPILER_SUPPORTS_SIMD
+	pthread_once(&pxConvertOnce, &resolve_px_convert_kernels);
+	if (fxpConvertPxRowToY) {
+		i = (*fxpConvertPxRowToY)(src, src_n, dst, dst_n, len);
+	}
+#endif
+
+	// Scalar fallback, and whatever's left after the SIMD codepath
+	for (src += i * src_n, dst += i * dst_n; i < len; i++, src += src_n, dst += dst_n) {
+		dst[0] = (unsigned char) (((src[0] * 77U) + (src[1] * 150U) + (29U * src[2])) >> 8U);
+		if (dst_n == 2U) {
+			dst[1] = src_n == 4U ? src[3] : 0xFFu;
+		}
+	}
+}
+
+// Swizzle a scanline of len RGB (src_n == 3) or RGBA (src_n == 4) pixels to BGRX (i.e., BGRA w/ a fully opaque alpha).
+// NOTE: src & dst may only alias for RGBA input.
+static void
+    convert_px_row_to_bgrx(const unsigned char* src, uint8_t src_n, unsigned char* dst, size_t len)
+{
+	size_t i = 0U;
+#ifdef QT_COMPILER_SUPPORTS_SIMD
+	pthread_once(&pxConvertOnce, &resolve_px_convert_kernels);
+	if (fxpConvertPxRowToBGRX) {
+		i = (*fxpConvertPxRowToBGRX)(src, src_n, dst, len);
+	}
+#endif
+
+	for (src += i * src_n, dst += i << 2U; i < len; i++, src += src_n, dst += 4U) {
+		const unsigned char r = src[0];
+		dst[0]                = src[2];
+		dst[1]                = src[1];
+		dst[2]                = r;
+		dst[3]                = 0xFFu;
+	}
+}
+
+// Pack a scanline of len RGB (src_n == 3) or RGBA (src_n == 4) pixels to RGB565 (or BGR565 if bgr is true),
+// following the same conventions as pack_rgb565 & pack_bgr565.
+static void
+    convert_px_row_to_rgb565(const unsigned char* src, uint8_t src_n, unsigned char* dst, size_t len, bool bgr)
+{
+	size_t i = 0U;
+#ifdef QT_COMPILER_SUPPORTS_SIMD
+	pthread_once(&pxConvertOnce, &resolve_px_convert_kernels);
+	if (fxpConvertPxRowToRGB565) {
+		i = (*fxpConvertPxRowToRGB565)(src, src_n, dst, len, bgr);
+	}
+#endif
+
+	for (src += i * src_n, dst += i << 1U; i < len; i++, src += src_n, dst += 2U) {
+		const uint16_t v = bgr ? pack_bgr565(src[0], src[1], src[2]) : pack_rgb565(src[0], src[1], src[2]);
+		// NOTE: Native endianness, like the fb itself.
+		memcpy(dst, &v, sizeof(v));
+	}
+}
+
+// Alpha blend a scanline of len YA pixels over a scanline of len Y8 fb pixels
+static void
+    blend_px_row_ya_to_y8(const unsigned char* restrict src, unsigned char* restrict dst, size_t len, uint8_t invert)
+{
+	size_t i = 0U;
+#ifdef QT_COMPILER_SUPPORTS_SIMD
+	pthread_once(&pxConvertOnce, &resolve_px_convert_kernels);
+	if (fxpBlendPxRowToY8) {
+		i = (*fxpBlendPxRowToY8)(src, dst, len, invert);
+	}
+#endif
+
+	for (src += i << 1U, dst += i; i < len; i++, src += 2U, dst++) {
+		const uint8_t a = src[1];
+		if (a == 0xFFu) {
+			*dst = src[0] ^ invert;
+		} else if (a != 0U) {
+			*dst = (unsigned char) DIV255((((src[0] ^ invert) * a) + (*dst * (a ^ 0xFFu))));
+		}
+	}
+}
+
+// Alpha blend a scanline of len RGBA pixels over a scanline of len BGRX (or RGBX if bgr is false) fb pixels
+// NOTE: Like every other 32bpp codepath, the fb's alpha is set to 0xFF.
+static void
+    blend_px_row_rgba_to_bgrx(
+	const unsigned char* restrict src, unsigned char* restrict dst, size_t len, uint8_t invert, bool bgr)
+{
+	size_t i = 0U;
+#ifdef QT_COMPILER_SUPPORTS_SIMD
+	pthread_once(&pxConvertOnce, &resolve_px_convert_kernels);
+	if (fxpBlendPxRowToBGRX) {
+		i = (*fxpBlendPxRowToBGRX)(src, dst, len, invert, bgr);
+	}
+#endif
+
+	// Where r & b land in the fb
+	const uint8_t ri = bgr ? 2U : 0U;
+	const uint8_t bi = bgr ? 0U : 2U;
+	for (src += i << 2U, dst += i << 2U; i < len; i++, src += 4U, dst += 4U) {
+		const uint8_t a = src[3];
+		if (a == 0xFFu) {
+			dst[ri] = src[0] ^ invert;
+			dst[1]  = src[1] ^ invert;
+			dst[bi] = src[2] ^ invert;
+			dst[3]  = 0xFFu;
+		} else if (a != 0U) {
+			const uint8_t ainv = a ^ 0xFFu;
+			dst[ri]            = (unsigned char) DIV255((((src[0] ^ invert) * a) + (dst[ri] * ainv)));
+			dst[1]             = (unsigned char) DIV255((((src[1] ^ invert) * a) + (dst[1] * ainv)));
+			dst[bi]            = (unsigned char) DIV255((((src[2] ^ invert) * a) + (dst[bi] * ainv)));
+			dst[3]             = 0xFFu;
+		}
+	}
+}
+
+// Alpha blend a scanline of len RGBA pixels over a scanline of len RGB565 (or BGR565 if bgr is true) fb pixels,
+// following the same conventions as get_pixel_RGB565 & pack_rgb565 (or get_pixel_BGR565 & pack_bgr565).
+static void
+    blend_px_row_rgba_to_rgb565(
+	const unsigned char* restrict src, unsigned char* restrict dst, size_t len, uint8_t invert, bool bgr)
+{
+	size_t i = 0U;
+#ifdef QT_COMPILER_SUPPORTS_SIMD
+	pthread_once(&pxConvertOnce, &resolve_px_convert_kernels);
+	if (fxpBlendPxRowToRGB565) {
+		i = (*fxpBlendPxRowToRGB565)(src, dst, len, invert, bgr);
+	}
+#endif
+
+	for (src += i << 2U, dst += i << 1U; i < len; i++, src += 4U, dst += 2U) {
+		const uint8_t a = src[3];
+		if (a == 0U) {
+			continue;
+		}
+
+		uint8_t r = src[0] ^ invert;
+		uint8_t g = src[1] ^ invert;
+		uint8_t b = src[2] ^ invert;
+		if (a != 0xFFu) {
+			// NOTE: Native endianness, like the fb itself.
+			uint16_t v;
+			memcpy(&v, dst, sizeof(v));
+			const uint8_t hi5  = (uint8_t) ((v & 0xF800u) >> 11U);
+			const uint8_t g6   = (v & 0x07E0u) >> 5U;
+			const uint8_t lo5  = (v & 0x001Fu);
+			const uint8_t hi   = (uint8_t) ((hi5 << 3U) | (hi5 >> 2U));
+			const uint8_t bg_g = (uint8_t) ((g6 << 2U) | (g6 >> 4U));
+			const uint8_t lo   = (uint8_t) ((lo5 << 3U) | (lo5 >> 2U));
+			// BGR565 has red in the high bits, RGB565 has blue
+			const uint8_t bg_r = bgr ? hi : lo;
+			const uint8_t bg_b = bgr ? lo : hi;
+
+			const uint8_t ainv = a ^ 0xFFu;
+			r                  = (uint8_t) DIV255(((r * a) + (bg_r * ainv)));
+			g                  = (uint8_t) DIV255(((g * a) + (bg_g * ainv)));
+			b                  = (uint8_t) DIV255(((b * a) + (bg_b * ainv)));
+		}
+		const uint16_t v = bgr ? pack_bgr565(r, g, b) : pack_rgb565(r, g, b);
+		memcpy(dst, &v, sizeof(v));
+	}
+}
+
+// HSP's perceived brightness is the square root of a weighted sum of squares (c.f., saturation_boost_hsp).
+// We keep the weights in Q16 (they sum to 65536), so that sum is P^2 in Q16, and its square root is P in Q8.
+// That root comes from a table of the square roots of [0, 4096) in Q8, with the input normalized to [1024, 4096)
+// by an even shift, which we then only have to halve on the way out.
+// NOTE: Unlike the boost factor, this doesn't depend on anything, so it's built once, and shared by everyone.
+#define HSP_SQRT_LUT_SIZE 4096U
+static uint16_t       hspSqrtLUT[HSP_SQRT_LUT_SIZE];
+static pthread_once_t hspSqrtOnce = PTHREAD_ONCE_INIT;
+
+static void
+    build_hsp_sqrt_lut(void)
+{
+	for (uint32_t i = 0U; i < HSP_SQRT_LUT_SIZE; i++) {
+		hspSqrtLUT[i] = (uint16_t) lroundf(sqrtf((float) i) * 256.0f);
+	}
+}
+
+static inline __attribute__((always_inline)) uint32_t
+    hsp_sqrt(uint32_t v)
+{
+	if (v < HSP_SQRT_LUT_SIZE) {
+		return (hspSqrtLUT[v] + 128U) >> 8U;
+	}
+
+	// v has at least 13 significant bits here, keep the top 11 or 12, depending on the parity of the shift
+	const uint32_t shift = (uint32_t) (21 - __builtin_clz(v)) & ~1U;
+	return ((uint32_t) hspSqrtLUT[v >> shift] << (shift >> 1U)) >> 8U;
+}
+
+// Returns the Q12 saturation factor (i.e., 1 + boost%) to pass along to saturation_boost_hsp,
+// making sure it's ready to go.
+static int32_t
+    prepare_saturation_boost(uint8_t boost)
+{
+	if (boost == 0U) {
+		return 1 << 12;
+	}
+
+	pthread_once(&hspSqrtOnce, &build_hsp_sqrt_lut);
+	return (1 << 12) + (((boost << 12) + 50) / 100);
+}
+
+// Convert back from Q20, with the same truncation & clamping as the original floating-point implementation
+static inline __attribute__((always_inline)) uint8_t
+    hsp_clamp(int32_t v)
+{
+	if (v < 0) {
+		return 0U;
+	}
+	v >>= 20U;
+	return v > UINT8_MAX ? UINT8_MAX : (uint8_t) v;
+}
+
+// This is Darel Rex Finley's HSP changeSaturation function.
+// c.f., https://alienryderflex.com/saturation.html
+// NOTE: It used to rely on floats (down from the original's doubles), and sqrtf.
+//       It's now entirely fixed-point (w/ a Q12 change factor, c.f., prepare_saturation_boost),
+//       which is significantly faster, especially on devices with a weak (or no) FPU,
+//       and stays within one level of the floating-point version.
+static __attribute__((hot)) void
+    saturation_boost_hsp(FBInkPixelRGBA* restrict px, const int32_t change)
+{
+	// Pr = 0.299, Pg = 0.587 & Pb = 0.114, in Q16
+	const int32_t R = px->color.r;
+	const int32_t G = px->color.g;
+	const int32_t B = px->color.b;
+
+	// NOTE: The largest possible sum is 255 * 255 * 65536, which fits in an uint32_t.
+	const int32_t P =
+	    (int32_t) hsp_sqrt((uint32_t) (R * R) * 19595U + (uint32_t) (G * G) * 38470U + (uint32_t) (B * B) * 7471U);
+
+	// P + (C - P) * change, in Q20
+	// NOTE: That's at most ~905 (i.e., 255 + 255 * 2.55), so it fits in an int32_t, even in Q20.
+	px->color.r = hsp_clamp((P << 12) + ((R << 8) - P) * change);
+	px->color.g = hsp_clamp((P << 12) + ((G << 8) - P) * change);
+	px->color.b = hsp_clamp((P << 12) + ((B << 8) - P) * change);
+}
+
+// Build the software color preprocessing stage requested by fbink_cfg (c.f., FBInkColorPrep & preprocess_px_row).
+// Returns false if there's nothing to do, in which case prep is left untouched.
+static bool
+    prepare_color_prep(const FBInkConfig* restrict fbink_cfg, FBInkColorPrep* restrict prep)
+{
+	bool has_curves = false;
+	for (uint8_t c = 0U; c < 3U; c++) {
+		const uint8_t gamma = fbink_cfg->cfa_gamma[c];
+		if ((gamma != 0U && gamma != 100U) || fbink_cfg->cfa_contrast[c] != 0) {
+			has_curves = true;
+		}
+	}
+	if (fbink_cfg->saturation_boost == 0U && !has_curves && !fbink_cfg->cfa_dithering) {
+		return false;
+	}
+
+	prep->sat_boost  = prepare_saturation_boost(fbink_cfg->saturation_boost);
+	prep->has_boost  = fbink_cfg->saturation_boost != 0U;
+	prep->is_cfa     = has_curves || fbink_cfg->cfa_dithering;
+	// NOTE: Since the CFA stage takes over SW dithering, honor it, too (albeit w/o the per-channel phases).
+	prep->has_dither = prep->is_cfa && (fbink_cfg->cfa_dithering || fbink_cfg->sw_dithering);
+
+	// Offset each channel by a different step of the first level of the threshold map (c.f., dither_o8x8),
+	// i.e., a quarter of its range apart.
+	static const uint8_t phase_x[3] = { 0U, 1U, 0U };
+	static const uint8_t phase_y[3] = { 0U, 1U, 1U };
+	for (uint8_t c = 0U; c < 3U; c++) {
+		prep->dither_x[c] = fbink_cfg->cfa_dithering ? phase_x[c] : 0U;
+		prep->dither_y[c] = fbink_cfg->cfa_dithering ? phase_y[c] : 0U;
+
+		const float gamma    = fbink_cfg->cfa_gamma[c] != 0U ? fbink_cfg->cfa_gamma[c] / 100.0f : 1.0f;
+		// NOTE: Anything below -100% would flip the curve over, so, clamp it to a flat gray.
+		const float contrast = 1.0f + ((float) MAX(fbink_cfg->cfa_contrast[c], -100) / 100.0f);
+		for (uint16_t v = 0U; v < 256U; v++) {
+			// Gamma first (as in ImageMagick's -gamma), then contrast, around the midpoint
+			float f = powf(v / 255.0f, 1.0f / gamma);
+			f       = ((f - 0.5f) * contrast) + 0.5f;
+			f       = f < 0.0f ? 0.0f : (f > 1.0f ? 1.0f : f);
+
+			prep->curves[c][v] = (uint8_t) lroundf(f * 255.0f);
+		}
+	}
+
+	return true;
+}
+
+// Run a scanline of len RGB or RGBA pixels, starting at image coordinates (x, y), through the software color
+// preprocessing stage: saturation boost, tone curves, dithering, then inversion.
+// The alpha channel, if any, is passed through as-is.
+// The output can then go through the other scanline helpers (c.f., blit_image_rows).
+// NOTE: The tone curves & the dithering are LUT-driven, which, sadly, doesn't really lend itself to SSE4.1 or NEON,
+//       as neither can do a gather from a 256 entries table (at least, not efficiently).
+static __attribute__((hot)) void
+    preprocess_px_row(const unsigned char* restrict src,
+		      uint8_t                       src_n,
+		      unsigned char* restrict       dst,
+		      size_t                        len,
+		      unsigned short int            x,
+		      unsigned short int            y,
+		      uint8_t                       invert,
+		      const FBInkColorPrep* restrict prep)
+{
+	for (size_t i = 0U; i < len; i++, src += src_n, dst += src_n) {
+		FBInkPixelRGBA px;
+		px.color.r = src[0];
+		px.color.g = src[1];
+		px.color.b = src[2];
+		if (prep->has_boost) {
+			saturation_boost_hsp(&px, prep->sat_boost);
+		}
+		if (prep->is_cfa) {
+			px.color.r = prep->curves[0][px.color.r];
+			px.color.g = prep->curves[1][px.color.g];
+			px.color.b = prep->curves[2][px.color.b];
+		}
+		dst[0] = px.color.r;
+		dst[1] = px.color.g;
+		dst[2] = px.color.b;
+		if (prep->has_dither) {
+			for (uint8_t c = 0U; c < 3U; c++) {
+				const unsigned short int dx = (unsigned short int) (x + i + prep->dither_x[c]);
+				const unsigned short int dy = (unsigned short int) (y + prep->dither_y[c]);
+				dst[c]                      = dither_o8x8(dx, dy, dst[c]);
+			}
+		}
+		// NOTE: Invert last, like the blending does (c.f., blend_px_row_rgba_to_bgrx_preprocessed),
+		//       so that both end up with the exact same pattern.
+		dst[0] ^= invert;
+		dst[1] ^= invert;
+		dst[2] ^= invert;
+		if (src_n == 4U) {
+			dst[3] = src[3];
+		}
+	}
+}
+
+// Same as convert_px_row_to_bgrx & blend_px_row_rgba_to_bgrx,
+// but with the software color preprocessing stage applied to the input first (c.f., preprocess_px_row).
+// If bgr is false, the output is RGBX instead (i.e., same pixel order, w/ a fully opaque alpha).
+// NOTE: The preprocessed pixels go through a small bounce buffer on the stack, this many at a time,
+//       so that they're still hot in the cache by the time the converter gets to them.
+#define COLOR_PREP_CHUNK 256U
+static void
+    convert_px_row_to_bgrx_preprocessed(const unsigned char* restrict src,
+					uint8_t                       src_n,
+					unsigned char* restrict       dst,
+					size_t                        len,
+					unsigned short int            x,
+					unsigned short int            y,
+					uint8_t                       invert,
+					bool                          bgr,
+					const FBInkColorPrep* restrict prep)
+{
+	unsigned char px[COLOR_PREP_CHUNK * 4U];
+	for (size_t i = 0U; i < len; i += COLOR_PREP_CHUNK) {
+		const size_t chunk = MIN(len - i, COLOR_PREP_CHUNK);
+		preprocess_px_row(src + (i * src_n), src_n, px, chunk, (unsigned short int) (x + i), y, invert, prep);
+		if (bgr) {
+			convert_px_row_to_bgrx(px, src_n, dst + (i << 2U), chunk);
+		} else {
+			const unsigned char* p = px;
+			unsigned char*       d = dst + (i << 2U);
+			for (size_t k = 0U; k < chunk; k++, p += src_n, d += 4U) {
+				d[0] = p[0];
+				d[1] = p[1];
+				d[2] = p[2];
+				d[3] = 0xFFu;
+			}
+		}
+	}
+}
+
+// NOTE: Inversion is left to the blending, so that it doesn't affect the fb side.
+//       It still happens after the dithering, as in preprocess_px_row.
+static void
+    blend_px_row_rgba_to_bgrx_preprocessed(const unsigned char* restrict src,
+					   unsigned char* restrict       dst,
+					   size_t                        len,
+					   unsigned short int            x,
+					   unsigned short int            y,
+					   uint8_t                       invert,
+					   bool                          bgr,
+					   const FBInkColorPrep* restrict prep)
+{
+	unsigned char px[COLOR_PREP_CHUNK * 4U];
+	for (size_t i = 0U; i < len; i += COLOR_PREP_CHUNK) {
+		const size_t chunk = MIN(len - i, COLOR_PREP_CHUNK);
+		preprocess_px_row(src + (i << 2U), 4U, px, chunk, (unsigned short int) (x + i), y, 0U, prep);
+		blend_px_row_rgba_to_bgrx(px, dst + (i << 2U), chunk, invert, bgr);
+	}
+}
@@ -0,0 +1,83 @@
+/*
+	FBInk: FrameBuffer eInker, a library to print text & images to an eInk Linux framebuffer
+	Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef __FBINK_PX_CONVERT_H
+#define __FBINK_PX_CONVERT_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+// NOTE: Scanline pixel format converters, with SSE4.1 & NEON variants (c.f., fbink_px_convert_sse4.c & fbink_px_convert_neon.c),
+//       selected at runtime the same way as in QImageScale (c.f., qimagescale/qsimd_p.h),
+//       including the FBINK_QIS_NO_SIMD escape hatch.
+//       Unless specified otherwise, src & dst *may* alias when the output pixel format is no larger than the input's,
+//       which is why these don't use restricted pointers.
+static void convert_px_row_to_y(const unsigned char*, uint8_t, unsigned char*, uint8_t, size_t);
+static void convert_px_row_to_bgrx(const unsigned char*, uint8_t, unsigned char*, size_t);
+static void convert_px_row_to_rgb565(const unsigned char*, uint8_t, unsigned char*, size_t, bool);
+
+// NOTE: Alpha blenders, compositing a scanline of straight alpha input over a scanline of the fb, in place,
+//       bit-exact w/ the DIV255-based blending in blit_image_rows.
+//       invert is applied to the color components of the input (i.e., it's either 0x00 or 0xFF).
+//       Fully opaque pixels are simply stored, and fully transparent ones leave the fb untouched;
+//       the SIMD kernels check that for a whole block of 16 pixels at once, so runs of either skip the blending entirely,
+//       and transparent runs don't even touch the fb.
+//       The input is never the fb itself, hence the restricted pointers.
+static void blend_px_row_ya_to_y8(const unsigned char* restrict, unsigned char* restrict, size_t, uint8_t);
+static void blend_px_row_rgba_to_bgrx(const unsigned char* restrict, unsigned char* restrict, size_t, uint8_t, bool);
+static void blend_px_row_rgba_to_rgb565(const unsigned char* restrict, unsigned char* restrict, size_t, uint8_t, bool);
+
+// NOTE: Fixed-point HSP saturation boost. prepare_saturation_boost returns the factor saturation_boost_hsp expects,
+//       and *must* have been called first.
+static int32_t prepare_saturation_boost(uint8_t);
+static __attribute__((hot)) void saturation_boost_hsp(FBInkPixelRGBA* restrict, int32_t);
+
+// NOTE: Software color preprocessing stage (saturation boost & CFA-aware tone curves/dithering) for 32bpp color images.
+static bool prepare_color_prep(const FBInkConfig* restrict, FBInkColorPrep* restrict);
+static __attribute__((hot)) void preprocess_px_row(const unsigned char* restrict,
+						   uint8_t,
+						   unsigned char* restrict,
+						   size_t,
+						   unsigned short int,
+						   unsigned short int,
+						   uint8_t,
+						   const FBInkColorPrep* restrict);
+static void convert_px_row_to_bgrx_preprocessed(const unsigned char* restrict,
+						uint8_t,
+						unsigned char* restrict,
+						size_t,
+						unsigned short int,
+						unsigned short int,
+						uint8_t,
+						bool,
+						const FBInkColorPrep* restrict);
+static void blend_px_row_rgba_to_bgrx_preprocessed(const unsigned char* restrict,
+						   unsigned char* restrict,
+						   size_t,
+						   unsigned short int,
+						   unsigned short int,
+						   uint8_t,
+						   bool,
+						   const FBInkColorPrep* restrict);
+
+#endif
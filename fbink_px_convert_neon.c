@@ -0,0 +1,266 @@
+/*
+	FBInk: FrameBuffer eInker, a library to print text & images to an eInk Linux framebuffer
+	Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fbink_px_convert.h"
+#include "qimagescale/qsimd_p.h"
+
+#ifdef QT_COMPILER_SUPPORTS_NEON
+#	include <arm_neon.h>
+
+// NOTE: Every kernel processes 16 pixels per iteration, and returns how many pixels it actually processed,
+//       leaving the remainder to the scalar codepath.
+//       All the loads for an iteration happen before any of its stores, which is what makes aliasing safe
+//       when the output is no larger than the input.
+//       The structured loads (vld3/vld4) do the deinterleaving for us, which makes these fairly straightforward.
+
+// Load 16 RGB or RGBA pixels as separate r, g, b & a planes
+static inline __attribute__((always_inline)) uint8x16x4_t
+    load_rgba_x16_neon(const unsigned char* src, uint8_t src_n)
+{
+	uint8x16x4_t px;
+	if (src_n == 4U) {
+		px = vld4q_u8(src);
+	} else {
+		const uint8x16x3_t rgb = vld3q_u8(src);
+		px.val[0]              = rgb.val[0];
+		px.val[1]              = rgb.val[1];
+		px.val[2]              = rgb.val[2];
+		px.val[3]              = vdupq_n_u8(0xFFu);
+	}
+	return px;
+}
+
+// (r * 77 + g * 150 + b * 29) >> 8 for 8 pixels (the sum can't overflow 16 bits)
+static inline __attribute__((always_inline)) uint8x8_t
+    luma_x8_neon(uint8x8_t r, uint8x8_t g, uint8x8_t b)
+{
+	uint16x8_t y = vmull_u8(r, vdup_n_u8(77U));
+	y            = vmlal_u8(y, g, vdup_n_u8(150U));
+	y            = vmlal_u8(y, b, vdup_n_u8(29U));
+	return vshrn_n_u16(y, 8);
+}
+
+static size_t
+    convert_px_row_to_y_neon(const unsigned char* src, uint8_t src_n, unsigned char* dst, uint8_t dst_n, size_t len)
+{
+	size_t i = 0U;
+	for (; i + 16U <= len; i += 16U, src += 16U * src_n, dst += 16U * dst_n) {
+		const uint8x16x4_t px = load_rgba_x16_neon(src, src_n);
+		const uint8x16_t   y  = vcombine_u8(
+		    luma_x8_neon(vget_low_u8(px.val[0]), vget_low_u8(px.val[1]), vget_low_u8(px.val[2])),
+		    luma_x8_neon(vget_high_u8(px.val[0]), vget_high_u8(px.val[1]), vget_high_u8(px.val[2])));
+		if (dst_n == 1U) {
+			vst1q_u8(dst, y);
+		} else {
+			uint8x16x2_t ya;
+			ya.val[0] = y;
+			ya.val[1] = px.val[3];
+			vst2q_u8(dst, ya);
+		}
+	}
+	return i;
+}
+
+static size_t
+    convert_px_row_to_bgrx_neon(const unsigned char* src, uint8_t src_n, unsigned char* dst, size_t len)
+{
+	size_t i = 0U;
+	for (; i + 16U <= len; i += 16U, src += 16U * src_n, dst += 64U) {
+		const uint8x16x4_t px = load_rgba_x16_neon(src, src_n);
+		uint8x16x4_t       bgrx;
+		bgrx.val[0] = px.val[2];
+		bgrx.val[1] = px.val[1];
+		bgrx.val[2] = px.val[0];
+		bgrx.val[3] = vdupq_n_u8(0xFFu);
+		vst4q_u8(dst, bgrx);
+	}
+	return i;
+}
+
+// NOTE: Same bit layout as pack_rgb565 & pack_bgr565, via shift-right-and-insert, starting from the top 5 bits.
+static inline __attribute__((always_inline)) uint16x8_t
+    rgb565_x8_neon(uint8x8_t hi, uint8x8_t g, uint8x8_t lo)
+{
+	uint16x8_t v = vshll_n_u8(hi, 8);
+	v            = vsriq_n_u16(v, vshll_n_u8(g, 8), 5);
+	v            = vsriq_n_u16(v, vshll_n_u8(lo, 8), 11);
+	return v;
+}
+
+static size_t
+    convert_px_row_to_rgb565_neon(const unsigned char* src, uint8_t src_n, unsigned char* dst, size_t len, bool bgr)
+{
+	size_t i = 0U;
+	for (; i + 16U <= len; i += 16U, src += 16U * src_n, dst += 32U) {
+		const uint8x16x4_t px = load_rgba_x16_neon(src, src_n);
+		// RGB565 has blue in the high bits, BGR565 has red
+		const uint8x16_t   hi = bgr ? px.val[0] : px.val[2];
+		const uint8x16_t   lo = bgr ? px.val[2] : px.val[0];
+		const uint16x8_t   v0 = rgb565_x8_neon(vget_low_u8(hi), vget_low_u8(px.val[1]), vget_low_u8(lo));
+		const uint16x8_t   v1 = rgb565_x8_neon(vget_high_u8(hi), vget_high_u8(px.val[1]), vget_high_u8(lo));
+		// NOTE: Byte stores, as dst may not be 16-bit aligned
+		vst1q_u8(dst + 0U, vreinterpretq_u8_u16(v0));
+		vst1q_u8(dst + 16U, vreinterpretq_u8_u16(v1));
+	}
+	return i;
+}
+// (fg * a + bg * (255 - a)) / 255 for 8 pixels, via DIV255 (c.f., fbink_internal.h)
+// NOTE: The largest input is 255 * 255, so neither of the additions can overflow.
+static inline __attribute__((always_inline)) uint8x8_t
+    blend_x8_neon(uint8x8_t fg, uint8x8_t bg, uint8x8_t a)
+{
+	uint16x8_t t = vmull_u8(fg, a);
+	t            = vmlal_u8(t, bg, vmvn_u8(a));
+	t            = vaddq_u16(t, vdupq_n_u16(128U));
+	return vshrn_n_u16(vsraq_n_u16(t, t, 8), 8);
+}
+
+static inline __attribute__((always_inline)) uint8x16_t
+    blend_x16_neon(uint8x16_t fg, uint8x16_t bg, uint8x16_t a)
+{
+	return vcombine_u8(blend_x8_neon(vget_low_u8(fg), vget_low_u8(bg), vget_low_u8(a)),
+			   blend_x8_neon(vget_high_u8(fg), vget_high_u8(bg), vget_high_u8(a)));
+}
+
+// NOTE: Checking the two 64-bit halves is cheaper than a horizontal reduction, and works on ARMv7, too.
+static inline __attribute__((always_inline)) bool
+    is_all_clear_x16_neon(uint8x16_t a)
+{
+	const uint64x2_t v = vreinterpretq_u64_u8(a);
+	return (vgetq_lane_u64(v, 0) | vgetq_lane_u64(v, 1)) == 0U;
+}
+
+static inline __attribute__((always_inline)) bool
+    is_all_opaque_x16_neon(uint8x16_t a)
+{
+	const uint64x2_t v = vreinterpretq_u64_u8(a);
+	return (vgetq_lane_u64(v, 0) & vgetq_lane_u64(v, 1)) == UINT64_MAX;
+}
+
+static size_t
+    blend_px_row_ya_to_y8_neon(const unsigned char* src, unsigned char* dst, size_t len, uint8_t invert)
+{
+	const uint8x16_t inv = vdupq_n_u8(invert);
+	size_t           i   = 0U;
+	for (; i + 16U <= len; i += 16U, src += 32U, dst += 16U) {
+		const uint8x16x2_t ya = vld2q_u8(src);
+		if (is_all_clear_x16_neon(ya.val[1])) {
+			// Fully transparent, keep the fb as-is
+			continue;
+		}
+
+		const uint8x16_t v = veorq_u8(ya.val[0], inv);
+		if (is_all_opaque_x16_neon(ya.val[1])) {
+			// Fully opaque
+			vst1q_u8(dst, v);
+		} else {
+			vst1q_u8(dst, blend_x16_neon(v, vld1q_u8(dst), ya.val[1]));
+		}
+	}
+	return i;
+}
+
+static size_t
+    blend_px_row_rgba_to_bgrx_neon(const unsigned char* src, unsigned char* dst, size_t len, uint8_t invert, bool bgr)
+{
+	const uint8x16_t inv = vdupq_n_u8(invert);
+	// Where r & b land in the fb
+	const uint8_t    ri  = bgr ? 2U : 0U;
+	const uint8_t    bi  = bgr ? 0U : 2U;
+	size_t           i   = 0U;
+	for (; i + 16U <= len; i += 16U, src += 64U, dst += 64U) {
+		const uint8x16x4_t px = vld4q_u8(src);
+		if (is_all_clear_x16_neon(px.val[3])) {
+			continue;
+		}
+
+		uint8x16x4_t out;
+		out.val[ri] = veorq_u8(px.val[0], inv);
+		out.val[1]  = veorq_u8(px.val[1], inv);
+		out.val[bi] = veorq_u8(px.val[2], inv);
+		out.val[3]  = vdupq_n_u8(0xFFu);
+		if (!is_all_opaque_x16_neon(px.val[3])) {
+			const uint8x16x4_t bg = vld4q_u8(dst);
+			out.val[0]            = blend_x16_neon(out.val[0], bg.val[0], px.val[3]);
+			out.val[1]            = blend_x16_neon(out.val[1], bg.val[1], px.val[3]);
+			out.val[2]            = blend_x16_neon(out.val[2], bg.val[2], px.val[3]);
+			// Fully transparent pixels are left untouched, alpha included
+			out.val[3]            = vorrq_u8(bg.val[3], vtstq_u8(px.val[3], px.val[3]));
+		}
+		vst4q_u8(dst, out);
+	}
+	return i;
+}
+
+// Expand the 5 or 6 bits wide fields of 8 RGB565 pixels to 8 bits (c.f., get_pixel_RGB565)
+static inline __attribute__((always_inline)) void
+    unpack_rgb565_x8_neon(uint16x8_t v, uint8x8_t* hi, uint8x8_t* g, uint8x8_t* lo)
+{
+	const uint8x8_t hi8 = vshrn_n_u16(v, 8);
+	const uint8x8_t g8  = vshrn_n_u16(v, 3);
+	const uint8x8_t lo8 = vshl_n_u8(vmovn_u16(v), 3);
+	// Replicate the top bits in the low ones
+	*hi                 = vsri_n_u8(hi8, hi8, 5);
+	*g                  = vsri_n_u8(vand_u8(g8, vdup_n_u8(0xFCu)), g8, 6);
+	*lo                 = vsri_n_u8(lo8, lo8, 5);
+}
+
+static size_t
+    blend_px_row_rgba_to_rgb565_neon(const unsigned char* src, unsigned char* dst, size_t len, uint8_t invert, bool bgr)
+{
+	const uint8x16_t inv = vdupq_n_u8(invert);
+	size_t           i   = 0U;
+	for (; i + 16U <= len; i += 16U, src += 64U, dst += 32U) {
+		const uint8x16x4_t px = vld4q_u8(src);
+		if (is_all_clear_x16_neon(px.val[3])) {
+			continue;
+		}
+
+		// RGB565 has blue in the high bits, BGR565 has red
+		const uint8x16_t r  = veorq_u8(px.val[0], inv);
+		const uint8x16_t g  = veorq_u8(px.val[1], inv);
+		const uint8x16_t b  = veorq_u8(px.val[2], inv);
+		uint8x16_t       hi = bgr ? r : b;
+		uint8x16_t       cg = g;
+		uint8x16_t       lo = bgr ? b : r;
+		if (!is_all_opaque_x16_neon(px.val[3])) {
+			// NOTE: Byte loads, as dst may not be 16-bit aligned
+			uint8x8_t bg_hi0;
+			uint8x8_t bg_g0;
+			uint8x8_t bg_lo0;
+			uint8x8_t bg_hi1;
+			uint8x8_t bg_g1;
+			uint8x8_t bg_lo1;
+			unpack_rgb565_x8_neon(vreinterpretq_u16_u8(vld1q_u8(dst + 0U)), &bg_hi0, &bg_g0, &bg_lo0);
+			unpack_rgb565_x8_neon(vreinterpretq_u16_u8(vld1q_u8(dst + 16U)), &bg_hi1, &bg_g1, &bg_lo1);
+			hi = blend_x16_neon(hi, vcombine_u8(bg_hi0, bg_hi1), px.val[3]);
+			cg = blend_x16_neon(cg, vcombine_u8(bg_g0, bg_g1), px.val[3]);
+			lo = blend_x16_neon(lo, vcombine_u8(bg_lo0, bg_lo1), px.val[3]);
+		}
+		const uint16x8_t v0 = rgb565_x8_neon(vget_low_u8(hi), vget_low_u8(cg), vget_low_u8(lo));
+		const uint16x8_t v1 = rgb565_x8_neon(vget_high_u8(hi), vget_high_u8(cg), vget_high_u8(lo));
+		vst1q_u8(dst + 0U, vreinterpretq_u8_u16(v0));
+		vst1q_u8(dst + 16U, vreinterpretq_u8_u16(v1));
+	}
+	return i;
+}
+#endif    // QT_COMPILER_SUPPORTS_NEON
@@ -0,0 +1,327 @@
+/*
+	FBInk: FrameBuffer eInker, a library to print text & images to an eInk Linux framebuffer
+	Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fbink_px_convert.h"
+#include "qimagescale/qsimd_p.h"
+
+#ifdef QT_COMPILER_SUPPORTS_SSE4_1
+#	include <immintrin.h>
+
+// NOTE: Every kernel processes 16 pixels per iteration, and returns how many pixels it actually processed,
+//       leaving the remainder to the scalar codepath.
+//       All the loads for an iteration happen before any of its stores, which is what makes aliasing safe
+//       when the output is no larger than the input.
+
+// Load 16 RGB or RGBA pixels as 4 vectors of 4 RGBX pixels (i.e., one pixel per 32-bit lane, r in the LSB)
+static inline __attribute__((always_inline)) void
+    load_rgbx_x16_sse4(const unsigned char* src, uint8_t src_n, __m128i px[4])
+{
+	if (src_n == 4U) {
+		px[0] = _mm_loadu_si128((const __m128i*) (const void*) (src + 0U));
+		px[1] = _mm_loadu_si128((const __m128i*) (const void*) (src + 16U));
+		px[2] = _mm_loadu_si128((const __m128i*) (const void*) (src + 32U));
+		px[3] = _mm_loadu_si128((const __m128i*) (const void*) (src + 48U));
+	} else {
+		// 48 bytes, i.e., exactly 3 loads, which we then spread over 4 vectors of 12 useful bytes each
+		const __m128i shuf = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+		const __m128i a    = _mm_loadu_si128((const __m128i*) (const void*) (src + 0U));
+		const __m128i b    = _mm_loadu_si128((const __m128i*) (const void*) (src + 16U));
+		const __m128i c    = _mm_loadu_si128((const __m128i*) (const void*) (src + 32U));
+		px[0]              = _mm_shuffle_epi8(a, shuf);
+		px[1]              = _mm_shuffle_epi8(_mm_alignr_epi8(b, a, 12), shuf);
+		px[2]              = _mm_shuffle_epi8(_mm_alignr_epi8(c, b, 8), shuf);
+		px[3]              = _mm_shuffle_epi8(_mm_srli_si128(c, 4), shuf);
+		// Opaque alpha
+		const __m128i alpha = _mm_set1_epi32((int) 0xFF000000u);
+		px[0]               = _mm_or_si128(px[0], alpha);
+		px[1]               = _mm_or_si128(px[1], alpha);
+		px[2]               = _mm_or_si128(px[2], alpha);
+		px[3]               = _mm_or_si128(px[3], alpha);
+	}
+}
+
+// (r * 77 + g * 150 + b * 29) >> 8 for 4 RGBX pixels, one result per 32-bit lane
+static inline __attribute__((always_inline)) __m128i
+    luma_x4_sse4(__m128i px)
+{
+	const __m128i mask  = _mm_set1_epi32(0x00FF00FF);
+	// r & b in the 16-bit halves of each lane, and g & a in the other one
+	const __m128i rb    = _mm_and_si128(px, mask);
+	const __m128i ga    = _mm_and_si128(_mm_srli_epi32(px, 8), mask);
+	const __m128i rb_w  = _mm_set1_epi32((29 << 16) | 77);
+	const __m128i ga_w  = _mm_set1_epi32(150);
+	const __m128i y     = _mm_add_epi32(_mm_madd_epi16(rb, rb_w), _mm_madd_epi16(ga, ga_w));
+	return _mm_srli_epi32(y, 8);
+}
+
+static size_t
+    convert_px_row_to_y_sse4(const unsigned char* src, uint8_t src_n, unsigned char* dst, uint8_t dst_n, size_t len)
+{
+	size_t i = 0U;
+	for (; i + 16U <= len; i += 16U, src += 16U * src_n, dst += 16U * dst_n) {
+		__m128i px[4];
+		load_rgbx_x16_sse4(src, src_n, px);
+
+		// Every intermediate value fits in 8 bits, so saturation never kicks in
+		const __m128i y = _mm_packus_epi16(_mm_packs_epi32(luma_x4_sse4(px[0]), luma_x4_sse4(px[1])),
+						   _mm_packs_epi32(luma_x4_sse4(px[2]), luma_x4_sse4(px[3])));
+		if (dst_n == 1U) {
+			_mm_storeu_si128((__m128i*) (void*) dst, y);
+		} else {
+			const __m128i a = _mm_packus_epi16(
+			    _mm_packs_epi32(_mm_srli_epi32(px[0], 24), _mm_srli_epi32(px[1], 24)),
+			    _mm_packs_epi32(_mm_srli_epi32(px[2], 24), _mm_srli_epi32(px[3], 24)));
+			_mm_storeu_si128((__m128i*) (void*) (dst + 0U), _mm_unpacklo_epi8(y, a));
+			_mm_storeu_si128((__m128i*) (void*) (dst + 16U), _mm_unpackhi_epi8(y, a));
+		}
+	}
+	return i;
+}
+
+static size_t
+    convert_px_row_to_bgrx_sse4(const unsigned char* src, uint8_t src_n, unsigned char* dst, size_t len)
+{
+	const __m128i shuf = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+	const __m128i alpha = _mm_set1_epi32((int) 0xFF000000u);
+	size_t        i     = 0U;
+	for (; i + 16U <= len; i += 16U, src += 16U * src_n, dst += 64U) {
+		__m128i px[4];
+		load_rgbx_x16_sse4(src, src_n, px);
+		for (uint8_t k = 0U; k < 4U; k++) {
+			_mm_storeu_si128((__m128i*) (void*) (dst + (k << 4U)),
+					 _mm_or_si128(_mm_shuffle_epi8(px[k], shuf), alpha));
+		}
+	}
+	return i;
+}
+
+// NOTE: Same bit layout as pack_rgb565 & pack_bgr565
+static inline __attribute__((always_inline)) __m128i
+    rgb565_x4_sse4(__m128i px, bool bgr)
+{
+	const __m128i g = _mm_and_si128(_mm_srli_epi32(px, 5), _mm_set1_epi32(0x07E0));
+	if (bgr) {
+		const __m128i r = _mm_and_si128(_mm_slli_epi32(px, 8), _mm_set1_epi32(0xF800));
+		const __m128i b = _mm_and_si128(_mm_srli_epi32(px, 19), _mm_set1_epi32(0x001F));
+		return _mm_or_si128(_mm_or_si128(r, g), b);
+	} else {
+		const __m128i b = _mm_and_si128(_mm_srli_epi32(px, 8), _mm_set1_epi32(0xF800));
+		const __m128i r = _mm_and_si128(_mm_srli_epi32(px, 3), _mm_set1_epi32(0x001F));
+		return _mm_or_si128(_mm_or_si128(b, g), r);
+	}
+}
+
+static size_t
+    convert_px_row_to_rgb565_sse4(const unsigned char* src, uint8_t src_n, unsigned char* dst, size_t len, bool bgr)
+{
+	size_t i = 0U;
+	for (; i + 16U <= len; i += 16U, src += 16U * src_n, dst += 32U) {
+		__m128i px[4];
+		load_rgbx_x16_sse4(src, src_n, px);
+		// NOTE: _mm_packus_epi32 is SSE4.1, and our values are all <= 0xFFFF, so this is lossless
+		_mm_storeu_si128((__m128i*) (void*) (dst + 0U),
+				 _mm_packus_epi32(rgb565_x4_sse4(px[0], bgr), rgb565_x4_sse4(px[1], bgr)));
+		_mm_storeu_si128((__m128i*) (void*) (dst + 16U),
+				 _mm_packus_epi32(rgb565_x4_sse4(px[2], bgr), rgb565_x4_sse4(px[3], bgr)));
+	}
+	return i;
+}
+
+// DIV255 (c.f., fbink_internal.h) for 8 16-bit lanes
+// NOTE: The largest input is 255 * 255, so neither of the additions can overflow.
+static inline __attribute__((always_inline)) __m128i
+    div255_x8_sse4(__m128i v)
+{
+	const __m128i t = _mm_add_epi16(v, _mm_set1_epi16(128));
+	return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+// (fg * a + bg * (255 - a)) / 255 for 8 16-bit lanes
+static inline __attribute__((always_inline)) __m128i
+    blend_x8_sse4(__m128i fg, __m128i bg, __m128i a)
+{
+	const __m128i ainv = _mm_xor_si128(a, _mm_set1_epi16(0x00FF));
+	return div255_x8_sse4(_mm_add_epi16(_mm_mullo_epi16(fg, a), _mm_mullo_epi16(bg, ainv)));
+}
+
+// The alpha of 16 RGBA pixels (i.e., the top byte of each 32-bit lane of px), as 16 bytes
+static inline __attribute__((always_inline)) __m128i
+    alpha_x16_sse4(const __m128i px[4])
+{
+	return _mm_packus_epi16(_mm_packs_epi32(_mm_srli_epi32(px[0], 24), _mm_srli_epi32(px[1], 24)),
+				_mm_packs_epi32(_mm_srli_epi32(px[2], 24), _mm_srli_epi32(px[3], 24)));
+}
+
+static size_t
+    blend_px_row_ya_to_y8_sse4(const unsigned char* src, unsigned char* dst, size_t len, uint8_t invert)
+{
+	const __m128i lo_mask = _mm_set1_epi16(0x00FF);
+	const __m128i ones    = _mm_set1_epi8(-1);
+	const __m128i inv     = _mm_set1_epi16(invert);
+	size_t        i       = 0U;
+	for (; i + 16U <= len; i += 16U, src += 32U, dst += 16U) {
+		const __m128i ya0 = _mm_loadu_si128((const __m128i*) (const void*) (src + 0U));
+		const __m128i ya1 = _mm_loadu_si128((const __m128i*) (const void*) (src + 16U));
+		// v in the low byte of each 16-bit lane, a in the high one
+		const __m128i v0  = _mm_xor_si128(_mm_and_si128(ya0, lo_mask), inv);
+		const __m128i v1  = _mm_xor_si128(_mm_and_si128(ya1, lo_mask), inv);
+		const __m128i a0  = _mm_srli_epi16(ya0, 8);
+		const __m128i a1  = _mm_srli_epi16(ya1, 8);
+		const __m128i a   = _mm_packus_epi16(a0, a1);
+
+		if (_mm_testz_si128(a, a)) {
+			// Fully transparent, keep the fb as-is
+			continue;
+		}
+		if (_mm_test_all_ones(_mm_cmpeq_epi8(a, ones))) {
+			// Fully opaque
+			_mm_storeu_si128((__m128i*) (void*) dst, _mm_packus_epi16(v0, v1));
+			continue;
+		}
+
+		const __m128i bg = _mm_loadu_si128((const __m128i*) (const void*) dst);
+		const __m128i y0 = blend_x8_sse4(v0, _mm_cvtepu8_epi16(bg), a0);
+		const __m128i y1 = blend_x8_sse4(v1, _mm_unpackhi_epi8(bg, _mm_setzero_si128()), a1);
+		_mm_storeu_si128((__m128i*) (void*) dst, _mm_packus_epi16(y0, y1));
+	}
+	return i;
+}
+
+static size_t
+    blend_px_row_rgba_to_bgrx_sse4(const unsigned char* src, unsigned char* dst, size_t len, uint8_t invert, bool bgr)
+{
+	const __m128i shuf  = bgr ? _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15)
+				  : _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	// Broadcast the alpha of each of the two pixels held in 8 16-bit lanes
+	const __m128i abc   = _mm_setr_epi8(6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15);
+	const __m128i alpha = _mm_set1_epi32((int) 0xFF000000u);
+	const __m128i inv   = _mm_set1_epi32(invert ? 0x00FFFFFF : 0);
+	const __m128i ones  = _mm_set1_epi8(-1);
+	size_t        i     = 0U;
+	for (; i + 16U <= len; i += 16U, src += 64U, dst += 64U) {
+		__m128i px[4];
+		load_rgbx_x16_sse4(src, 4U, px);
+		const __m128i a = alpha_x16_sse4(px);
+
+		if (_mm_testz_si128(a, a)) {
+			continue;
+		}
+		const bool opaque = _mm_test_all_ones(_mm_cmpeq_epi8(a, ones));
+		for (uint8_t k = 0U; k < 4U; k++) {
+			unsigned char* out = dst + (k << 4U);
+			// Handle inversion & pixel order
+			const __m128i  fg  = _mm_shuffle_epi8(_mm_xor_si128(px[k], inv), shuf);
+			if (opaque) {
+				_mm_storeu_si128((__m128i*) (void*) out, _mm_or_si128(fg, alpha));
+				continue;
+			}
+
+			const __m128i bg = _mm_loadu_si128((const __m128i*) (const void*) out);
+			const __m128i f0 = _mm_cvtepu8_epi16(fg);
+			const __m128i f1 = _mm_unpackhi_epi8(fg, _mm_setzero_si128());
+			const __m128i c0 = blend_x8_sse4(f0, _mm_cvtepu8_epi16(bg), _mm_shuffle_epi8(f0, abc));
+			const __m128i c1 =
+			    blend_x8_sse4(f1, _mm_unpackhi_epi8(bg, _mm_setzero_si128()), _mm_shuffle_epi8(f1, abc));
+			// NOTE: The alpha lanes are garbage at this point, but we enforce an opaque alpha anyway,
+			//       except for fully transparent pixels, which we leave untouched.
+			const __m128i clear = _mm_cmpeq_epi32(_mm_srli_epi32(px[k], 24), _mm_setzero_si128());
+			_mm_storeu_si128((__m128i*) (void*) out,
+					 _mm_blendv_epi8(_mm_or_si128(_mm_packus_epi16(c0, c1), alpha), bg, clear));
+		}
+	}
+	return i;
+}
+
+// Expand the 5 or 6 bits wide fields of 8 RGB565 pixels to 8 bits (c.f., get_pixel_RGB565)
+static inline __attribute__((always_inline)) void
+    unpack_rgb565_x8_sse4(__m128i v, __m128i* hi, __m128i* g, __m128i* lo)
+{
+	const __m128i hi5 = _mm_srli_epi16(v, 11);
+	const __m128i g6  = _mm_and_si128(_mm_srli_epi16(v, 5), _mm_set1_epi16(0x3F));
+	const __m128i lo5 = _mm_and_si128(v, _mm_set1_epi16(0x1F));
+	*hi               = _mm_or_si128(_mm_slli_epi16(hi5, 3), _mm_srli_epi16(hi5, 2));
+	*g                = _mm_or_si128(_mm_slli_epi16(g6, 2), _mm_srli_epi16(g6, 4));
+	*lo               = _mm_or_si128(_mm_slli_epi16(lo5, 3), _mm_srli_epi16(lo5, 2));
+}
+
+// And the other way around (c.f., pack_rgb565)
+static inline __attribute__((always_inline)) __m128i
+    pack_rgb565_x8_sse4(__m128i hi, __m128i g, __m128i lo)
+{
+	const __m128i v =
+	    _mm_or_si128(_mm_slli_epi16(_mm_srli_epi16(hi, 3), 11), _mm_slli_epi16(_mm_srli_epi16(g, 2), 5));
+	return _mm_or_si128(v, _mm_srli_epi16(lo, 3));
+}
+
+// One channel of 8 RGBA pixels, as 8 16-bit lanes
+static inline __attribute__((always_inline)) __m128i
+    channel_x8_sse4(__m128i p0, __m128i p1, int shift)
+{
+	const __m128i mask = _mm_set1_epi32(0xFF);
+	return _mm_packus_epi32(_mm_and_si128(_mm_srli_epi32(p0, shift), mask),
+				_mm_and_si128(_mm_srli_epi32(p1, shift), mask));
+}
+
+static size_t
+    blend_px_row_rgba_to_rgb565_sse4(const unsigned char* src, unsigned char* dst, size_t len, uint8_t invert, bool bgr)
+{
+	const __m128i inv  = _mm_set1_epi16(invert);
+	const __m128i ones = _mm_set1_epi8(-1);
+	size_t        i    = 0U;
+	for (; i + 16U <= len; i += 16U, src += 64U, dst += 32U) {
+		__m128i px[4];
+		load_rgbx_x16_sse4(src, 4U, px);
+		const __m128i a = alpha_x16_sse4(px);
+
+		if (_mm_testz_si128(a, a)) {
+			continue;
+		}
+		const bool opaque = _mm_test_all_ones(_mm_cmpeq_epi8(a, ones));
+		for (uint8_t k = 0U; k < 2U; k++) {
+			unsigned char* out = dst + (k << 4U);
+			const __m128i  p0  = px[k << 1U];
+			const __m128i  p1  = px[(k << 1U) + 1U];
+			// Split 8 pixels into 16-bit planes (NOTE: _mm_packus_epi32 is SSE4.1)
+			const __m128i  r   = _mm_xor_si128(channel_x8_sse4(p0, p1, 0), inv);
+			const __m128i  g   = _mm_xor_si128(channel_x8_sse4(p0, p1, 8), inv);
+			const __m128i  b   = _mm_xor_si128(channel_x8_sse4(p0, p1, 16), inv);
+			// BGR565 has red in the high bits, RGB565 has blue
+			if (opaque) {
+				_mm_storeu_si128((__m128i*) (void*) out,
+						 bgr ? pack_rgb565_x8_sse4(r, g, b) : pack_rgb565_x8_sse4(b, g, r));
+				continue;
+			}
+
+			const __m128i pa = _mm_packus_epi32(_mm_srli_epi32(p0, 24), _mm_srli_epi32(p1, 24));
+			__m128i       bg_hi;
+			__m128i       bg_g;
+			__m128i       bg_lo;
+			unpack_rgb565_x8_sse4(_mm_loadu_si128((const __m128i*) (const void*) out), &bg_hi, &bg_g, &bg_lo);
+			const __m128i hi = blend_x8_sse4(bgr ? r : b, bg_hi, pa);
+			const __m128i cg = blend_x8_sse4(g, bg_g, pa);
+			const __m128i lo = blend_x8_sse4(bgr ? b : r, bg_lo, pa);
+			_mm_storeu_si128((__m128i*) (void*) out, pack_rgb565_x8_sse4(hi, cg, lo));
+		}
+	}
+	return i;
+}
+#endif    // QT_COMPILER_SUPPORTS_SSE4_1
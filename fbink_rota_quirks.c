@@ -24,7 +24,7 @@
 #if defined(FBINK_FOR_KOBO)
 // Figure out on which bus and at which address is the accelerometer driver registered.
 static int
-    find_accelerometer(const char* driver)
+    find_accelerometer(FBInkContext* restrict ctx, const char* driver)
 {
 	char sysfs_path[PATH_MAX] = { 0 };
 	snprintf(sysfs_path, sizeof(sysfs_path) - 1U, "/sys/bus/i2c/drivers/%s/", driver);
@@ -45,11 +45,11 @@ static int
 		}
 
 		// There should only one, so, just parse it...
-		if (sscanf(de->d_name, "%hu-%hx", &sunxiCtx.i2c_dev.bus, &sunxiCtx.i2c_dev.address) != 2) {
+		if (sscanf(de->d_name, "%hu-%hx", &ctx->sunxiCtx.i2c_dev.bus, &ctx->sunxiCtx.i2c_dev.address) != 2) {
 			PFWARN("Failed to parse `%s` via sscanf: %m", de->d_name);
-			sunxiCtx.i2c_dev.bus     = 0U;
-			sunxiCtx.i2c_dev.address = 0U;
-			rv                       = ERRCODE(EXIT_FAILURE);
+			ctx->sunxiCtx.i2c_dev.bus     = 0U;
+			ctx->sunxiCtx.i2c_dev.address = 0U;
+			rv                            = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		} else {
 			break;
@@ -64,16 +64,16 @@ cleanup:
 
 // Close the I²C fd if necessary
 static int
-    close_accelerometer_i2c(void)
+    close_accelerometer_i2c(FBInkContext* restrict ctx)
 {
 	int rv = EXIT_SUCCESS;
 
-	if (sunxiCtx.i2c_fd != -1) {
-		if (close(sunxiCtx.i2c_fd) != 0) {
+	if (ctx->sunxiCtx.i2c_fd != -1) {
+		if (close(ctx->sunxiCtx.i2c_fd) != 0) {
 			PFWARN("close: %m");
 			rv = ERRCODE(EXIT_FAILURE);
 		} else {
-			sunxiCtx.i2c_fd = -1;
+			ctx->sunxiCtx.i2c_fd = -1;
 		}
 	}
 
@@ -82,14 +82,14 @@ static int
 
 // Search for the right accelerometer for the device
 static int
-    populate_accelerometer_i2c_info(void)
+    populate_accelerometer_i2c_info(FBInkContext* restrict ctx)
 {
-	switch (deviceQuirks.deviceId) {
+	switch (ctx->deviceQuirks.deviceId) {
 		case DEVICE_KOBO_ELIPSA:
 		case DEVICE_KOBO_SAGE:
 			// kx122
 			// NOTE: Could be queried via NTXHWConfig ([11] RSensor).
-			if (find_accelerometer("kx122") != EXIT_SUCCESS) {
+			if (find_accelerometer(ctx, "kx122") != EXIT_SUCCESS) {
 				WARN("Failed to find the I²C bus/address combo for the KX122 accelerometer");
 				return ERRCODE(EXIT_FAILURE);
 			}
@@ -105,30 +105,30 @@ static int
 
 // Open the right I²C character device for the device's accelerometer...
 static int
-    open_accelerometer_i2c(void)
+    open_accelerometer_i2c(FBInkContext* restrict ctx)
 {
 	int rv = EXIT_SUCCESS;
 
 	// Check if the address looks sane...
-	if (sunxiCtx.i2c_dev.address < 0x08 || sunxiCtx.i2c_dev.address > 0x77) {
-		WARN("I²C address for the accelerometer looks fishy (%#hx), aborting", sunxiCtx.i2c_dev.address);
+	if (ctx->sunxiCtx.i2c_dev.address < 0x08 || ctx->sunxiCtx.i2c_dev.address > 0x77) {
+		WARN("I²C address for the accelerometer looks fishy (%#hx), aborting", ctx->sunxiCtx.i2c_dev.address);
 		rv = ERRCODE(ENOTSUP);
 		goto cleanup;
 	}
 
 	// Okay, we've got a bus and an address, now open it :).
 	char dev_path[PATH_MAX] = { 0 };
-	snprintf(dev_path, sizeof(dev_path) - 1U, "/dev/i2c-%hu", sunxiCtx.i2c_dev.bus);
+	snprintf(dev_path, sizeof(dev_path) - 1U, "/dev/i2c-%hu", ctx->sunxiCtx.i2c_dev.bus);
 
-	sunxiCtx.i2c_fd = open(dev_path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
-	if (sunxiCtx.i2c_fd == -1) {
+	ctx->sunxiCtx.i2c_fd = open(dev_path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+	if (ctx->sunxiCtx.i2c_fd == -1) {
 		PFWARN("open: %m");
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
 	}
 
 	// Poke at the right address (force, because there's already a kernel driver on it).
-	if (ioctl(sunxiCtx.i2c_fd, I2C_SLAVE_FORCE, sunxiCtx.i2c_dev.address) < 0) {
+	if (ioctl(ctx->sunxiCtx.i2c_fd, I2C_SLAVE_FORCE, ctx->sunxiCtx.i2c_dev.address) < 0) {
 		PFWARN("I2C_SLAVE_FORCE: %m");
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
@@ -137,7 +137,7 @@ static int
 	return EXIT_SUCCESS;
 
 cleanup:
-	if (close_accelerometer_i2c() != EXIT_SUCCESS) {
+	if (close_accelerometer_i2c(ctx) != EXIT_SUCCESS) {
 		rv = ERRCODE(EXIT_FAILURE);
 	}
 
@@ -167,7 +167,7 @@ static __attribute__((cold)) const char*
 
 // Make sense of the register constants...
 static int
-    translate_kx122(uint16_t val)
+    translate_kx122(FBInkContext* restrict ctx, uint16_t val)
 {
 	int rota = GYRO_STATE_UNKNOWN;
 
@@ -194,7 +194,7 @@ static int
 	}
 
 	// Translate it accordingly for our device...
-	switch (deviceQuirks.deviceId) {
+	switch (ctx->deviceQuirks.deviceId) {
 		case DEVICE_KOBO_ELIPSA:
 			if (rota >= 0) {
 				// NOTE: The Elipsa (PCB index 94) is flagged EBRMAIN_ROTATE_R_180 in the kernel driver
@@ -228,16 +228,16 @@ static int
 
 // Poke at the right registers for a KX122
 static int
-    query_kx122(void)
+    query_kx122(FBInkContext* restrict ctx)
 {
 	// Start by checking the *current* status
-	int32_t state = i2c_smbus_read_byte_data(sunxiCtx.i2c_fd, KX122_TSCP);
+	int32_t state = i2c_smbus_read_byte_data(ctx->sunxiCtx.i2c_fd, KX122_TSCP);
 	if (state < 0) {
 		PFWARN("Failed to read TSCP register: %m");
 		return ERRCODE(EXIT_FAILURE);
 	}
 
-	int rota = translate_kx122((uint16_t) state);
+	int rota = translate_kx122(ctx, (uint16_t) state);
 	LOG("KX122 says the current rotation is: %#hx -> %d (%s)", (uint16_t) state, rota, gyro_state_to_string(rota));
 	// If we got an actionable value, we're done!
 	if (rota >= 0) {
@@ -245,13 +245,13 @@ static int
 	}
 
 	// Otherwise, check the *previous* status...
-	state = i2c_smbus_read_byte_data(sunxiCtx.i2c_fd, KX122_TSPP);
+	state = i2c_smbus_read_byte_data(ctx->sunxiCtx.i2c_fd, KX122_TSPP);
 	if (state < 0) {
 		PFWARN("Failed to read TSPP register: %m");
 		return ERRCODE(EXIT_FAILURE);
 	}
 
-	rota = translate_kx122((uint16_t) state);
+	rota = translate_kx122(ctx, (uint16_t) state);
 	LOG("KX122 says the previous rotation was: %#hx -> %d (%s)", (uint16_t) state, rota, gyro_state_to_string(rota));
 	// If we got an actionable value, we're done!
 	if (rota >= 0) {
@@ -264,7 +264,7 @@ static int
 
 // Get the current G2D rotation angle of the working buffer, and translate it to a linuxfb rotation constant
 static int
-    query_fbdamage(void)
+    query_fbdamage(FBInkContext* restrict ctx)
 {
 	char g2d_rotate[8] = { 0 };
 
@@ -292,7 +292,7 @@ static int
 
 	// Convert that angle to a linuxfb rotation, according to device quirks...
 	// (kobo_sunxi_fb_fixup does the reverse).
-	uint32_t rota = (deviceQuirks.ntxBootRota - (rota_angle / 90U)) & 3;
+	uint32_t rota = (ctx->deviceQuirks.ntxBootRota - (rota_angle / 90U)) & 3;
 	LOG("FBDamage says the working buffer's rotation is: %u (%s)", rota, fb_rotate_to_string(rota));
 
 	return (int) rota;
@@ -300,10 +300,10 @@ static int
 
 // And, finally, get the current rotation, according to the accelerometer...
 static int
-    query_accelerometer(void)
+    query_accelerometer(FBInkContext* restrict ctx)
 {
 	// We need an I²C handle
-	if (sunxiCtx.i2c_fd == -1) {
+	if (ctx->sunxiCtx.i2c_fd == -1) {
 		WARN("No I²C handle, can't query the accelerometer");
 		return ERRCODE(ENOENT);
 	}
@@ -311,13 +311,13 @@ static int
 	int rv = FB_ROTATE_UR;
 
 	// We need to know how to handle the accelerometer...
-	switch (deviceQuirks.deviceId) {
+	switch (ctx->deviceQuirks.deviceId) {
 		case DEVICE_KOBO_ELIPSA:
 		case DEVICE_KOBO_SAGE:
 		case DEVICE_KOBO_ELIPSA_2E:
 		case DEVICE_KOBO_LIBRA_COLOUR:
 			// kx122
-			rv = query_kx122();
+			rv = query_kx122(ctx);
 			if (rv < 0) {
 				LOG("Poking at the KX122 accelerometer over I²C was unfruitful");
 				return rv;
@@ -330,31 +330,32 @@ static int
 	}
 
 	// Check if what we got matches the force_rota constraints...
-	if (sunxiCtx.force_rota == FORCE_ROTA_PORTRAIT) {
+	if (ctx->sunxiCtx.force_rota == FORCE_ROTA_PORTRAIT) {
 		if ((rv & 0x01) == 1) {
 			// Odd, Landscape :(
 			LOG("Gyro state falls outside of the requested constraints (Landscape instead of Portrait), ignoring it");
 			rv = GYRO_STATE_OUTSIDE_CONSTRAINTS;
 		}
-	} else if (sunxiCtx.force_rota == FORCE_ROTA_LANDSCAPE) {
+	} else if (ctx->sunxiCtx.force_rota == FORCE_ROTA_LANDSCAPE) {
 		if ((rv & 0x01) == 0) {
 			// Even, Portrait :(
 			LOG("Gyro state falls outside of the requested constraints (Portrait instead of Landscape), ignoring it");
 			rv = GYRO_STATE_OUTSIDE_CONSTRAINTS;
 		}
-	} else if (sunxiCtx.force_rota == FORCE_ROTA_CURRENT_ROTA || sunxiCtx.force_rota == FORCE_ROTA_CURRENT_LAYOUT) {
-		int wb_rotate = query_fbdamage();
+	} else if (ctx->sunxiCtx.force_rota == FORCE_ROTA_CURRENT_ROTA ||
+		   ctx->sunxiCtx.force_rota == FORCE_ROTA_CURRENT_LAYOUT) {
+		int wb_rotate = query_fbdamage(ctx);
 		if (wb_rotate < 0) {
 			LOG("FBDamage is inconclusive, assuming Upright");
 			wb_rotate = FB_ROTATE_UR;
 		}
 
-		if (sunxiCtx.force_rota == FORCE_ROTA_CURRENT_ROTA) {
+		if (ctx->sunxiCtx.force_rota == FORCE_ROTA_CURRENT_ROTA) {
 			if (rv != wb_rotate) {
 				LOG("Gyro state falls outside of the requested constraints (same rotation as working buffer), honoring working buffer's state instead");
 				rv = wb_rotate;
 			}
-		} else if (sunxiCtx.force_rota == FORCE_ROTA_CURRENT_LAYOUT) {
+		} else if (ctx->sunxiCtx.force_rota == FORCE_ROTA_CURRENT_LAYOUT) {
 			if ((rv & 0x01) != (wb_rotate & 0x01)) {
 				LOG("Gyro state falls outside of the requested constraints (same layout as working buffer), honoring working buffer's state instead");
 				rv = wb_rotate;
@@ -374,7 +375,7 @@ static int
 // See also rotate_touch_coordinates @ fbink.c for an earlier and gnarlier attempt at this.
 // And if you liked that one, you can look at the old implementations, which are archived in tools/rota_map.c ;).
 uint8_t
-    fbink_rota_native_to_canonical(uint32_t rotate UNUSED_BY_NOTKOBO)
+    fbink_rota_native_to_canonical_ctx(FBInkContext* restrict ctx UNUSED_BY_NOTKOBO, uint32_t rotate UNUSED_BY_NOTKOBO)
 {
 #if defined(FBINK_FOR_KOBO)
 	// Safety net for bogus input
@@ -382,20 +383,26 @@ uint8_t
 		return ERANGE;
 	}
 
-	return deviceQuirks.rotationMap[rotate];
+	return ctx->deviceQuirks.rotationMap[rotate];
 #else
 	WARN("Rotation quirks are only handled on Kobo");
 	return ENOSYS;
 #endif
 }
 
+uint8_t
+    fbink_rota_native_to_canonical(uint32_t rotate)
+{
+	return fbink_rota_native_to_canonical_ctx(&defaultCtx, rotate);
+}
+
 uint32_t
-    fbink_rota_canonical_to_native(uint8_t rotate UNUSED_BY_NOTKOBO)
+    fbink_rota_canonical_to_native_ctx(FBInkContext* restrict ctx UNUSED_BY_NOTKOBO, uint8_t rotate UNUSED_BY_NOTKOBO)
 {
 #if defined(FBINK_FOR_KOBO)
 	// This is a less common operation, so we don't actually keep a reverse LUT around.
 	for (uint8_t rota = FB_ROTATE_UR; rota <= FB_ROTATE_CCW; rota++) {
-		if (deviceQuirks.rotationMap[rota] == rotate) {
+		if (ctx->deviceQuirks.rotationMap[rota] == rotate) {
 			return rota;
 		}
 	}
@@ -408,6 +415,12 @@ uint32_t
 #endif
 }
 
+uint32_t
+    fbink_rota_canonical_to_native(uint8_t rotate)
+{
+	return fbink_rota_canonical_to_native_ctx(&defaultCtx, rotate);
+}
+
 #ifdef FBINK_FOR_KINDLE
 static orientation_t
     linuxfb_rotate_to_einkfb_orientation(uint32_t rotate)
@@ -459,9 +472,14 @@ static int
 
 // See utils/fbdepth.c for all the gory details ;).
 int
-    fbink_set_fb_info(int fbfd, uint32_t rota, uint8_t bpp, uint8_t grayscale, const FBInkConfig* restrict fbink_cfg)
+    fbink_set_fb_info_ctx(FBInkContext* restrict ctx,
+			  int      fbfd,
+			  uint32_t rota,
+			  uint8_t  bpp,
+			  uint8_t  grayscale,
+			  const FBInkConfig* restrict fbink_cfg)
 {
-	if (!deviceQuirks.skipId) {
+	if (!ctx->deviceQuirks.skipId) {
 		PFWARN("FBInk hasn't been initialized yet");
 		return ERRCODE(ENODEV);
 	}
@@ -481,8 +499,8 @@ int
 	}
 
 	// We have our own private buffer on sunxi, so we can only deal with rotation...
-	if (deviceQuirks.isSunxi) {
-		return fbink_sunxi_ntx_enforce_rota(fbfd, (SUNXI_FORCE_ROTA_INDEX_T) rota, fbink_cfg);
+	if (ctx->deviceQuirks.isSunxi) {
+		return fbink_sunxi_ntx_enforce_rota_ctx(ctx, fbfd, (SUNXI_FORCE_ROTA_INDEX_T) rota, fbink_cfg);
 	}
 
 	// Validate the rest...
@@ -516,41 +534,41 @@ int
 	}
 
 	// Work on copy to avoid breaking fbink_reinit...
-	struct fb_var_screeninfo new_vinfo = vInfo;
+	struct fb_var_screeninfo new_vinfo = ctx->vInfo;
 
 	// Start with the easy stuff...
 	if (bpp == KEEP_CURRENT_BITDEPTH) {
-		LOG("Keeping current bitdepth: %ubpp", vInfo.bits_per_pixel);
+		LOG("Keeping current bitdepth: %ubpp", ctx->vInfo.bits_per_pixel);
 	} else {
-		LOG("Updating bitdepth from %ubpp to %hhubpp", vInfo.bits_per_pixel, bpp);
+		LOG("Updating bitdepth from %ubpp to %hhubpp", ctx->vInfo.bits_per_pixel, bpp);
 		new_vinfo.bits_per_pixel = (uint32_t) bpp;
 	}
 
 	if (new_vinfo.bits_per_pixel == 8U) {
 		if (grayscale == KEEP_CURRENT_GRAYSCALE) {
 			if (bpp == KEEP_CURRENT_BITDEPTH) {
-				LOG("Keeping current grayscale value: %u", vInfo.grayscale);
+				LOG("Keeping current grayscale value: %u", ctx->vInfo.grayscale);
 			} else {
 				LOG("Sanitizing grayscale flag for 8bpp");
 				new_vinfo.grayscale = GRAYSCALE_8BIT;
 			}
 		} else {
 			if (grayscale == TOGGLE_GRAYSCALE) {
-				if (vInfo.grayscale == GRAYSCALE_8BIT) {
+				if (ctx->vInfo.grayscale == GRAYSCALE_8BIT) {
 					grayscale = GRAYSCALE_8BIT_INVERTED;
 				} else {
 					grayscale = GRAYSCALE_8BIT;
 				}
 #if defined(FBINK_FOR_KINDLE)
 				// Handle CFA properly...
-				if (deviceQuirks.isKindleBellatrix4) {
-					if (vInfo.grayscale == GRAYSCALE_8BIT) {
+				if (ctx->deviceQuirks.isKindleBellatrix4) {
+					if (ctx->vInfo.grayscale == GRAYSCALE_8BIT) {
 						grayscale = GRAYSCALE_8BIT_INVERTED;
-					} else if (vInfo.grayscale == GRAYSCALE_8BIT_INVERTED) {
+					} else if (ctx->vInfo.grayscale == GRAYSCALE_8BIT_INVERTED) {
 						grayscale = GRAYSCALE_8BIT;
-					} else if (vInfo.grayscale == GRAYSCALE_COLOR) {
+					} else if (ctx->vInfo.grayscale == GRAYSCALE_COLOR) {
 						grayscale = GRAYSCALE_COLOR_NIGHTMODE;
-					} else if (vInfo.grayscale == GRAYSCALE_COLOR_NIGHTMODE) {
+					} else if (ctx->vInfo.grayscale == GRAYSCALE_COLOR_NIGHTMODE) {
 						grayscale = GRAYSCALE_COLOR;
 					} else {
 						grayscale = GRAYSCALE_8BIT;
@@ -558,7 +576,7 @@ int
 				}
 #endif
 			}
-			LOG("Updating grayscale value from %u to %hhu", vInfo.grayscale, grayscale);
+			LOG("Updating grayscale value from %u to %hhu", ctx->vInfo.grayscale, grayscale);
 			new_vinfo.grayscale = (uint32_t) grayscale;
 		}
 	} else if (new_vinfo.bits_per_pixel == 4U) {
@@ -574,7 +592,7 @@ int
 	// NOTE: So far, the driver itself doesn't seem to care all that much about the state of the grayscale flag itself,
 	//       so we're free to actually modify it like if we were on mxcfb.
 	//       That allows us to handle a toggle sanely, as we don't actually have a getter for the `invert_fb` flag...
-	if (deviceQuirks.isMTK && new_vinfo.grayscale != vInfo.grayscale) {
+	if (ctx->deviceQuirks.isMTK && new_vinfo.grayscale != ctx->vInfo.grayscale) {
 		if (new_vinfo.grayscale == GRAYSCALE_8BIT_INVERTED) {
 			// Inverted grayscale, flip `invert_fb` to *on*
 			// NOTE: Technically, we could actually very much have it enabled at 16bpp or 32bpp,
@@ -596,11 +614,11 @@ int
 	uint32_t expected_bpp = new_vinfo.bits_per_pixel;
 
 	if (rota == KEEP_CURRENT_ROTATE) {
-		LOG("Keeping current rotation: %u (%s)", vInfo.rotate, fb_rotate_to_string(vInfo.rotate));
+		LOG("Keeping current rotation: %u (%s)", ctx->vInfo.rotate, fb_rotate_to_string(ctx->vInfo.rotate));
 	} else {
 		LOG("Updating rotation from %u (%s) to %u (%s)",
-		    vInfo.rotate,
-		    fb_rotate_to_string(vInfo.rotate),
+		    ctx->vInfo.rotate,
+		    fb_rotate_to_string(ctx->vInfo.rotate),
 		    rota,
 		    fb_rotate_to_string(rota));
 		new_vinfo.rotate = rota;
@@ -608,7 +626,7 @@ int
 
 	// Open the framebuffer if need be (nonblock, we'll only do ioctls)...
 	bool keep_fd = true;
-	if (open_fb_fd_nonblock(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+	if (open_fb_fd_nonblock(ctx, &fbfd, &keep_fd) != EXIT_SUCCESS) {
 		return ERRCODE(EXIT_FAILURE);
 	}
 
@@ -624,13 +642,13 @@ int
 #endif
 
 #if defined(FBINK_FOR_KOBO)
-	if (deviceQuirks.ntxRotaQuirk == NTX_ROTA_ALL_INVERTED) {
+	if (ctx->deviceQuirks.ntxRotaQuirk == NTX_ROTA_ALL_INVERTED) {
 		// NOTE: This should cover the H2O and the few other devices suffering from the same quirk...
 		new_vinfo.rotate ^= 2;
 		LOG("Mangling rotate to %u (%s) to account for kernel rotation quirks",
 		    new_vinfo.rotate,
 		    fb_rotate_to_string(new_vinfo.rotate));
-	} else if (deviceQuirks.ntxRotaQuirk == NTX_ROTA_ODD_INVERTED) {
+	} else if (ctx->deviceQuirks.ntxRotaQuirk == NTX_ROTA_ODD_INVERTED) {
 		// NOTE: This is for the Forma, which only inverts CW & CCW (i.e., odd numbers)...
 		if ((new_vinfo.rotate & 0x01) == 1) {
 			new_vinfo.rotate ^= 2;
@@ -642,7 +660,7 @@ int
 
 	// On newer MTK devices, we first need to update the MDP src format to convince the fbdev driver to switch bitdepth...
 	// (c.f., comments around the bitdepth sanity check below for more details).
-	if (deviceQuirks.isMTK && deviceQuirks.deviceId != DEVICE_KOBO_ELIPSA_2E) {
+	if (ctx->deviceQuirks.isMTK && ctx->deviceQuirks.deviceId != DEVICE_KOBO_ELIPSA_2E) {
 		LOG("Target device needs help to switch bitdepth...");
 		if (new_vinfo.bits_per_pixel == 8 || new_vinfo.bits_per_pixel == 32) {
 			// The current kernels only expose Y8, ARGB32 & ABGR32 in the gtMDP_SRC_FMTA array,
@@ -699,7 +717,7 @@ int
 
 #ifdef FBINK_FOR_KINDLE
 	// Deal once again with einkfb properly...
-	if (deviceQuirks.isKindleLegacy) {
+	if (ctx->deviceQuirks.isKindleLegacy) {
 		orientation_t orientation = linuxfb_rotate_to_einkfb_orientation(expected_rota);
 		if (ioctl(fbfd, FBIO_EINK_SET_DISPLAY_ORIENTATION, orientation)) {
 			PFWARN("FBIO_EINK_SET_DISPLAY_ORIENTATION: %m");
@@ -787,9 +805,9 @@ int
 		    new_vinfo.bits_per_pixel,
 		    expected_bpp);
 
-		if (new_vinfo.grayscale != vInfo.grayscale) {
+		if (new_vinfo.grayscale != ctx->vInfo.grayscale) {
 			LOG("Restoring the original grayscale flag");
-			new_vinfo.grayscale = vInfo.grayscale;
+			new_vinfo.grayscale = ctx->vInfo.grayscale;
 			if (ioctl(fbfd, FBIOPUT_VSCREENINFO, &new_vinfo)) {
 				PFWARN("FBIOPUT_VSCREENINFO: %m");
 				rv = ERRCODE(ECANCELED);
@@ -798,7 +816,7 @@ int
 
 #if defined(FBINK_FOR_KOBO)
 			// Attempt to restore a meaningful invert status, too...
-			if (deviceQuirks.isMTK) {
+			if (ctx->deviceQuirks.isMTK) {
 				if (new_vinfo.grayscale == GRAYSCALE_8BIT_INVERTED) {
 					if (kobo_mtk_invert_fb(true) == EXIT_SUCCESS) {
 						LOG("Enabled the MTK invert_fb flag");
@@ -815,7 +833,7 @@ int
 
 #ifdef FBINK_FOR_KINDLE
 	// And, again, einkfb is a special snowflake...
-	if (deviceQuirks.isKindleLegacy) {
+	if (ctx->deviceQuirks.isKindleLegacy) {
 		orientation_t orientation = orientation_portrait;
 		if (ioctl(fbfd, FBIO_EINK_GET_DISPLAY_ORIENTATION, &orientation)) {
 			PFWARN("FBIO_EINK_GET_DISPLAY_ORIENTATION: %m");
@@ -834,12 +852,18 @@ int
 	    new_vinfo.rotate,
 	    fb_rotate_to_string(new_vinfo.rotate));
 
-	rv = fbink_reinit(fbfd, fbink_cfg);
+	rv = fbink_reinit_ctx(ctx, fbfd, fbink_cfg);
 
 cleanup:
 	if (!keep_fd) {
-		close_fb(fbfd);
+		close_fb(ctx, fbfd);
 	}
 
 	return rv;
 }
+
+int
+    fbink_set_fb_info(int fbfd, uint32_t rota, uint8_t bpp, uint8_t grayscale, const FBInkConfig* restrict fbink_cfg)
+{
+	return fbink_set_fb_info_ctx(&defaultCtx, fbfd, rota, bpp, grayscale, fbink_cfg);
+}
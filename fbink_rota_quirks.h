@@ -40,15 +40,15 @@
 // We need the KX122 register constants :).
 #	include "eink/kx122-kobo.h"
 
-static int                               find_accelerometer(const char* driver);
-static int                               close_accelerometer_i2c(void);
-static int                               populate_accelerometer_i2c_info(void);
-static int                               open_accelerometer_i2c(void);
+static int                               find_accelerometer(FBInkContext* restrict ctx, const char* driver);
+static int                               close_accelerometer_i2c(FBInkContext* restrict);
+static int                               populate_accelerometer_i2c_info(FBInkContext* restrict);
+static int                               open_accelerometer_i2c(FBInkContext* restrict);
 static __attribute__((cold)) const char* gyro_state_to_string(int state);
-static int                               translate_kx122(uint16_t val);
-static int                               query_kx122(void);
-static int                               query_accelerometer(void);
-static int                               query_fbdamage(void);
+static int                               translate_kx122(FBInkContext* restrict ctx, uint16_t val);
+static int                               query_kx122(FBInkContext* restrict);
+static int                               query_accelerometer(FBInkContext* restrict);
+static int                               query_fbdamage(FBInkContext* restrict);
 #endif    // FBINK_FOR_KOBO
 
 #ifdef FBINK_FOR_KINDLE
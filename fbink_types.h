@@ -175,6 +175,62 @@ typedef union
 	} gray4;
 } FBInkPixel;
 
+#ifdef FBINK_WITH_IMAGE
+// Where an image lands on screen, and which part of it is actually visible (c.f., clip_image)
+typedef struct
+{
+	struct mxcfb_rect  region;
+	short int          x_off;
+	short int          y_off;
+	unsigned short int img_x_off;
+	unsigned short int img_y_off;
+	unsigned short int max_width;
+	unsigned short int max_height;
+} FBInkImageClip;
+
+// The software color preprocessing stage applied to 32bpp color images, built once per draw (c.f., prepare_color_prep)
+typedef struct
+{
+	int32_t sat_boost;         // Q12 saturation factor (c.f., prepare_saturation_boost)
+	bool    has_boost;
+	bool    is_cfa;            // Any of the cfa_ fields are set, which enables the scanline codepaths unconditionally
+	bool    has_dither;
+	uint8_t dither_x[3];       // Per-channel (R, G, B) phase of the dithering pattern (c.f., dither_o8x8)
+	uint8_t dither_y[3];
+	uint8_t curves[3][256];    // Per-channel (R, G, B) tone curves (gamma & contrast)
+} FBInkColorPrep;
+
+// A worker's share of an image being scaled on the fly (c.f., draw_image)
+typedef struct
+{
+	FBInkContext*                 ctx;
+	const unsigned char* restrict data;
+	const struct QImageScaleInfo* scale_info;
+	const FBInkImageClip*         clip;
+	const FBInkConfig*            fbink_cfg;
+	const FBInkColorPrep*         color_prep;    // NULL if there's nothing to do
+	unsigned char*                band;          // This worker's own band buffer
+	int                           req_n;
+	int                           dw;
+	bool                          img_has_alpha;
+	unsigned short int            band_rows;
+	unsigned short int            first_band;     // This worker handles every band_stride-th band, starting from this one
+	unsigned short int            band_stride;    // i.e., the amount of workers
+	int                           rv;             // Set if we failed to scale a band
+} FBInkImageBands;
+
+// A worker's share of a batch of thumbnails being decoded & scaled (c.f., fbink_print_thumbnails)
+typedef struct
+{
+	FBInkThumbnail*    thumbs;
+	size_t             count;
+	const FBInkConfig* fbink_cfg;
+	int                req_n;
+	size_t             first;     // This worker handles every stride-th thumbnail, starting from this one
+	size_t             stride;    // i.e., the amount of workers
+} FBInkThumbnailJobs;
+#endif    // FBINK_WITH_IMAGE
+
 #ifdef FBINK_WITH_OPENTYPE
 // Stores the information necessary to render a line of text
 // using OpenType/TrueType fonts
@@ -13,6 +13,7 @@
 // Constants
 cdecl_const(FBFD_AUTO)
 cdecl_const(LAST_MARKER)
+cdecl_const(FBINK_SCALING_THREADS_AUTO)
 
 // Typedefs
 cdecl_type(FONT_INDEX_E)
@@ -66,6 +67,9 @@ cdecl_type(FBInkOTFit)
 cdecl_type(FBInkRect)
 
 cdecl_type(FBInkDump)
+cdecl_type(FBInkSurface)
+cdecl_type(FBInkThumbnail)
+cdecl_type(FBInkScalePlan)
 
 // API
 cdecl_func(fbink_version)
@@ -113,6 +117,14 @@ cdecl_func(fbink_print_activity_bar)
 
 cdecl_func(fbink_print_image)
 cdecl_func(fbink_print_raw_data)
+cdecl_func(fbink_print_packed_data)
+cdecl_func(fbink_print_native_data)
+cdecl_func(fbink_print_thumbnails)
+cdecl_func(fbink_free_thumbnail_data)
+cdecl_func(fbink_scale_plan_alloc)
+cdecl_func(fbink_scale_plan_free)
+cdecl_func(fbink_print_image_planned)
+cdecl_func(fbink_print_raw_data_planned)
 
 cdecl_func(fbink_cls)
 
@@ -124,6 +136,15 @@ cdecl_func(fbink_region_dump)
 cdecl_func(fbink_rect_dump)
 cdecl_func(fbink_restore)
 cdecl_func(fbink_free_dump_data)
+cdecl_func(fbink_compress_dump)
+cdecl_func(fbink_surface_alloc)
+cdecl_func(fbink_surface_free)
+cdecl_func(fbink_surface_begin)
+cdecl_func(fbink_surface_end)
+cdecl_func(fbink_surface_present)
+cdecl_func(fbink_alt_buffer_alloc)
+cdecl_func(fbink_page_flip_alloc)
+cdecl_func(fbink_page_flip_free)
 
 cdecl_func(fbink_get_last_rect)
 
@@ -151,3 +172,67 @@ cdecl_func(fbink_wait_for_any_complete)
 cdecl_func(fbink_mtk_set_halftone)
 cdecl_func(fbink_mtk_toggle_auto_reagl)
 cdecl_func(fbink_mtk_toggle_pen_mode)
+
+cdecl_type(FBInkContext)
+cdecl_func(fbink_ctx_new)
+cdecl_func(fbink_ctx_free)
+cdecl_func(fbink_open_ctx)
+cdecl_func(fbink_close_ctx)
+cdecl_func(fbink_init_ctx)
+cdecl_func(fbink_state_dump_ctx)
+cdecl_func(fbink_get_state_ctx)
+cdecl_func(fbink_print_ctx)
+cdecl_func(fbink_add_ot_font_ctx)
+cdecl_func(fbink_add_ot_font_v2_ctx)
+cdecl_func(fbink_free_ot_fonts_ctx)
+cdecl_func(fbink_print_ot_ctx)
+cdecl_func(fbink_printf_ctx)
+cdecl_func(fbink_refresh_ctx)
+cdecl_func(fbink_wait_for_submission_ctx)
+cdecl_func(fbink_wait_for_complete_ctx)
+cdecl_func(fbink_get_last_marker_ctx)
+cdecl_func(fbink_reinit_ctx)
+cdecl_func(fbink_update_pen_colors_ctx)
+cdecl_func(fbink_set_fg_pen_gray_ctx)
+cdecl_func(fbink_set_bg_pen_gray_ctx)
+cdecl_func(fbink_set_fg_pen_rgba_ctx)
+cdecl_func(fbink_set_bg_pen_rgba_ctx)
+cdecl_func(fbink_print_progress_bar_ctx)
+cdecl_func(fbink_print_activity_bar_ctx)
+cdecl_func(fbink_print_image_ctx)
+cdecl_func(fbink_print_raw_data_ctx)
+cdecl_func(fbink_print_packed_data_ctx)
+cdecl_func(fbink_print_native_data_ctx)
+cdecl_func(fbink_print_thumbnails_ctx)
+cdecl_func(fbink_scale_plan_alloc_ctx)
+cdecl_func(fbink_print_image_planned_ctx)
+cdecl_func(fbink_print_raw_data_planned_ctx)
+cdecl_func(fbink_cls_ctx)
+cdecl_func(fbink_grid_clear_ctx)
+cdecl_func(fbink_grid_refresh_ctx)
+cdecl_func(fbink_dump_ctx)
+cdecl_func(fbink_region_dump_ctx)
+cdecl_func(fbink_rect_dump_ctx)
+cdecl_func(fbink_restore_ctx)
+cdecl_func(fbink_surface_alloc_ctx)
+cdecl_func(fbink_surface_begin_ctx)
+cdecl_func(fbink_surface_end_ctx)
+cdecl_func(fbink_surface_present_ctx)
+cdecl_func(fbink_alt_buffer_alloc_ctx)
+cdecl_func(fbink_page_flip_alloc_ctx)
+cdecl_func(fbink_page_flip_free_ctx)
+cdecl_func(fbink_get_last_rect_ctx)
+cdecl_func(fbink_wait_for_usbms_processing_ctx)
+cdecl_func(fbink_rota_native_to_canonical_ctx)
+cdecl_func(fbink_rota_canonical_to_native_ctx)
+cdecl_func(fbink_invert_screen_ctx)
+cdecl_func(fbink_get_fb_pointer_ctx)
+cdecl_func(fbink_get_fb_info_ctx)
+cdecl_func(fbink_set_fb_info_ctx)
+cdecl_func(fbink_sunxi_toggle_ntx_pen_mode_ctx)
+cdecl_func(fbink_sunxi_ntx_enforce_rota_ctx)
+cdecl_func(fbink_mtk_set_swipe_data_ctx)
+cdecl_func(fbink_wait_for_any_complete_ctx)
+cdecl_func(fbink_mtk_set_halftone_ctx)
+cdecl_func(fbink_mtk_toggle_auto_reagl_ctx)
+cdecl_func(fbink_mtk_toggle_pen_mode_ctx)
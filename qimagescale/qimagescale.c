@@ -41,17 +41,21 @@
 #include "qglobal.h"
 #include "qimagescale_p.h"
 #include "qrgb.h"
+#include "qsimd_p.h"
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
-#ifndef FBINK_QIS_NO_SIMD
-#	if defined(__ARM_NEON__)
+#ifdef QT_COMPILER_SUPPORTS_SIMD
+QT_SIMD_TARGET_PUSH
+#	if defined(QT_COMPILER_SUPPORTS_NEON)
 #		include "qimagescale_neon.c"
 #	endif
-#	if defined(__SSE4_1__)
+#	if defined(QT_COMPILER_SUPPORTS_SSE4_1)
 #		include "qimagescale_sse4.c"
 #	endif
+QT_SIMD_TARGET_POP
 #endif
 
 /*
@@ -102,49 +106,25 @@
  * (C) Daniel M. Duley.
  */
 
-static const unsigned int**   qimageCalcYPoints(const unsigned int* restrict src, int sw, int sh, int dh);
-static const unsigned char**  qimageCalcYPointsY8(const unsigned char* restrict src, int sw, int sh, int dh);
-static const unsigned short** qimageCalcYPointsY8A(const unsigned short* restrict src, int sw, int sh, int dh);
-static int*                   qimageCalcXPoints(int sw, int dw);
-static int*                   qimageCalcApoints(int s, int d, int up);
-static QImageScaleInfo*       qimageFreeScaleInfo(QImageScaleInfo* isi);
-static QImageScaleInfo*
-    qimageCalcScaleInfo(const unsigned char* restrict img, int sw, int sh, int sn, int dw, int dh, char aa);
+// Use a box-filter prepass for reductions of at least this factor (c.f., qimageCalcScaleInfo)
+#define QIS_BOX_MIN_FACTOR 3
+// A box spans less than twice that many rows, which keeps the vertical sums in 16 bits (i.e., 255 * 255 < 65536)
+#define QIS_BOX_MAX_FACTOR 128
+
+static int*             qimageCalcYOffsets(int sw, int sh, int dh);
+static int*             qimageCalcXPoints(int sw, int dw);
+static int*             qimageCalcApoints(int s, int d, int up);
+static QImageScaleInfo* qimageFreeScaleInfo(QImageScaleInfo* isi);
+static QImageScaleInfo* qimageCalcScaleInfo(int sw, int sh, int sn, int dw, int dh, char aa, char box);
 
 //
 // Code ported from Imlib...
 //
 
-static const unsigned int**
-    qimageCalcYPoints(const unsigned int* restrict src, int sw, int sh, int dh)
-{
-	int j = 0, rv = 0;
-
-	if (dh < 0) {
-		dh = -dh;
-		rv = 1;
-	}
-	const unsigned int** p = malloc((size_t) (dh + 1) * sizeof(src));
-
-	const int    up  = qAbs(dh) >= sh;
-	qint64       val = up ? 0x8000 * sh / dh - 0x8000 : 0;
-	const qint64 inc = (((qint64) sh) << 16) / dh;
-	for (int i = 0; i < dh; i++) {
-		p[j++] = src + qMax(0LL, val >> 16) * sw;
-		val   += inc;
-	}
-	if (rv) {
-		for (int i = dh / 2; --i >= 0;) {
-			const unsigned int* tmp = p[i];
-			p[i]                    = p[dh - i - 1];
-			p[dh - i - 1]           = tmp;
-		}
-	}
-	return (p);
-}
-
-static const unsigned char**
-    qimageCalcYPointsY8(const unsigned char* restrict src, int sw, int sh, int dh)
+// NOTE: Unlike upstream, we store row offsets (in pixels) instead of row pointers,
+//       so that the scale info doesn't depend on the actual source buffer (c.f., qSmoothScaleRows).
+static int*
+    qimageCalcYOffsets(int sw, int sh, int dh)
 {
 	int j = 0, rv = 0;
 
@@ -152,51 +132,26 @@ static const unsigned char**
 		dh = -dh;
 		rv = 1;
 	}
-	const unsigned char** p = malloc((size_t) (dh + 1) * sizeof(src));
-
-	const int    up  = qAbs(dh) >= sh;
-	qint64       val = up ? 0x8000 * sh / dh - 0x8000 : 0;
-	const qint64 inc = (((qint64) sh) << 16) / dh;
-	for (int i = 0; i < dh; i++) {
-		p[j++] = src + qMax(0LL, val >> 16) * sw;
-		val   += inc;
-	}
-	if (rv) {
-		for (int i = dh / 2; --i >= 0;) {
-			const unsigned char* tmp = p[i];
-			p[i]                     = p[dh - i - 1];
-			p[dh - i - 1]            = tmp;
-		}
-	}
-	return (p);
-}
-
-static const unsigned short**
-    qimageCalcYPointsY8A(const unsigned short* restrict src, int sw, int sh, int dh)
-{
-	int j = 0, rv = 0;
-
-	if (dh < 0) {
-		dh = -dh;
-		rv = 1;
+	int* p = malloc((size_t) (dh + 1) * sizeof(int));
+	if (!p) {
+		return NULL;
 	}
-	const unsigned short** p = malloc((size_t) (dh + 1) * sizeof(src));
 
 	const int    up  = qAbs(dh) >= sh;
 	qint64       val = up ? 0x8000 * sh / dh - 0x8000 : 0;
 	const qint64 inc = (((qint64) sh) << 16) / dh;
 	for (int i = 0; i < dh; i++) {
-		p[j++] = src + qMax(0LL, val >> 16) * sw;
+		p[j++] = (int) qMax(0LL, val >> 16) * sw;
 		val   += inc;
 	}
 	if (rv) {
 		for (int i = dh / 2; --i >= 0;) {
-			const unsigned short* tmp = p[i];
-			p[i]                      = p[dh - i - 1];
-			p[dh - i - 1]             = tmp;
+			const int tmp = p[i];
+			p[i]          = p[dh - i - 1];
+			p[dh - i - 1] = tmp;
 		}
 	}
-	return (p);
+	return p;
 }
 
 static int*
@@ -280,10 +235,9 @@ static QImageScaleInfo*
     qimageFreeScaleInfo(QImageScaleInfo* isi)
 {
 	if (isi) {
+		qimageFreeScaleInfo(isi->box_isi);
 		free(isi->xpoints);
-		free(isi->ypoints);
-		free(isi->ypoints_y8);
-		free(isi->ypoints_y8a);
+		free(isi->yoffsets);
 		free(isi->xapoints);
 		free(isi->yapoints);
 		free(isi);
@@ -292,56 +246,62 @@ static QImageScaleInfo*
 }
 
 static QImageScaleInfo*
-    qimageCalcScaleInfo(const unsigned char* restrict img, int sw, int sh, int sn, int dw, int dh, char aa)
+    qimageCalcScaleInfo(int sw, int sh, int sn, int dw, int dh, char aa, char box)
 {
 	int scw = dw;
 	int sch = dh;
 
+	// NOTE: c.f., qSmoothScaleRows for why we'll never get sn == 3 here.
+	if (sn != 4 && sn != 2 && sn != 1) {
+		return NULL;
+	}
+
 	QImageScaleInfo* isi = calloc(1U, sizeof(QImageScaleInfo));
 	if (!isi) {
 		return NULL;
 	}
 
+	isi->sw      = sw;
+	isi->sh      = sh;
+	isi->sn      = sn;
+	isi->dw      = dw;
+	isi->dh      = dh;
 	isi->xup_yup = (qAbs(dw) >= sw) + ((qAbs(dh) >= sh) << 1);
 
+	// NOTE: Past a QIS_BOX_MIN_FACTOR reduction, most of the time would be spent computing per-pixel area weights,
+	//       so we box-filter the source by the integer part of the scaling factor first (which is cheap, and exact for
+	//       integer factors), and only AA scale what's left (i.e., a much smaller reduction) from there.
+	//       This is not bit-exact with a straight AA pass, but it's close enough, and a *lot* faster.
+	if (aa && box) {
+		const int kx = sw >= QIS_BOX_MIN_FACTOR * dw ? qMin(sw / dw, QIS_BOX_MAX_FACTOR) : 1;
+		const int ky = sh >= QIS_BOX_MIN_FACTOR * dh ? qMin(sh / dh, QIS_BOX_MAX_FACTOR) : 1;
+		if (kx > 1 || ky > 1) {
+			// NOTE: The boxes are spread evenly over the whole source, so they're either k or k + 1 pixels wide
+			//       (unless k is exact, obviously), and none of the source pixels get left out.
+			const int iw = sw / kx;
+			const int ih = sh / ky;
+			// NOTE: Because of QIS_BOX_MAX_FACTOR, what's left may still be a large enough reduction to warrant a box pass,
+			//       but qSmoothScaleRowsBox expects a plain AA pass for the second stage, so make sure we get one.
+			isi->box_isi = qimageCalcScaleInfo(iw, ih, sn, dw, dh, aa, false);
+			if (!isi->box_isi) {
+				return qimageFreeScaleInfo(isi);
+			}
+			// That's all we'll need, the box pass doesn't use any of the tables
+			return isi;
+		}
+	}
+
 	isi->xpoints = qimageCalcXPoints(sw, scw);
 	if (!isi->xpoints) {
 		return qimageFreeScaleInfo(isi);
 	}
 	// NOTE: We use sw directly as a simplification. Technically, it's img bytes-per-lines / bytes-per-pixel
 	//       (i.e., img's width (sw) * number of color components (sn) / sizeof(*img) for unpadded packed pixels).
-	//       This explains the casts and the need for different functions according to pointer width.
-	switch (sn) {
-		case 4:
-			// sn is 4, as is sizeof(uint32_t), hence using width directly ;).
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wcast-align"
-			isi->ypoints = qimageCalcYPoints((const unsigned int* restrict) img, sw, sh, sch);
-#pragma GCC diagnostic pop
-			if (!isi->ypoints) {
-				return qimageFreeScaleInfo(isi);
-			}
-			break;
-		case 2:
-			// sn is 2, as is sizeof(unsigned short), hence using width directly ;).
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wcast-align"
-			isi->ypoints_y8a = qimageCalcYPointsY8A((const unsigned short* restrict) img, sw, sh, sch);
-#pragma GCC diagnostic pop
-			if (!isi->ypoints_y8a) {
-				return qimageFreeScaleInfo(isi);
-			}
-			break;
-		case 1:
-			// sn is 1, as is sizeof(unsigned char), hence using width directly ;).
-			isi->ypoints_y8 = qimageCalcYPointsY8((const unsigned char* restrict) img, sw, sh, sch);
-			if (!isi->ypoints_y8) {
-				return qimageFreeScaleInfo(isi);
-			}
-			break;
-		default:
-			return qimageFreeScaleInfo(isi);
-			break;
+	//       This is why the offsets are in pixels, and are resolved against a pointer of the right width
+	//       (i.e., sn bytes) in qSmoothScaleRows.
+	isi->yoffsets = qimageCalcYOffsets(sw, sh, sch);
+	if (!isi->yoffsets) {
+		return qimageFreeScaleInfo(isi);
 	}
 	if (aa) {
 		isi->xapoints = qimageCalcApoints(sw, scw, isi->xup_yup & 1);
@@ -356,7 +316,6 @@ static QImageScaleInfo*
 	return isi;
 }
 
-#if defined(FBINK_QIS_NO_SIMD) || !(defined(__SSE4_1__) || defined(__ARM_NEON__))
 static void qt_qimageScaleAARGBA_up_x_down_y(QImageScaleInfo* isi,
 					     unsigned int* restrict dest,
 					     int dw,
@@ -377,88 +336,129 @@ static void qt_qimageScaleAARGBA_down_xy(QImageScaleInfo* isi,
 					 int dh,
 					 int dow,
 					 int sow);
-#endif
 
-#ifndef FBINK_QIS_NO_SIMD
-#	if defined(__SSE4_1__)
-inline static void qt_qimageScaleAARGBA_up_x_down_y_sse4(QImageScaleInfo* isi,
-							 unsigned int* restrict dest,
-							 int dw,
-							 int dh,
-							 int dow,
-							 int sow);
-inline static void qt_qimageScaleAARGBA_down_x_up_y_sse4(QImageScaleInfo* isi,
-							 unsigned int* restrict dest,
-							 int dw,
-							 int dh,
-							 int dow,
-							 int sow);
-inline static void qt_qimageScaleAARGBA_down_xy_sse4(QImageScaleInfo* isi,
-						     unsigned int* restrict dest,
-						     int dw,
-						     int dh,
-						     int dow,
-						     int sow);
-
-inline static void qt_qimageScaleAARGB_up_x_down_y_sse4(QImageScaleInfo* isi,
-							unsigned int* restrict dest,
-							int dw,
-							int dh,
-							int dow,
-							int sow);
-inline static void qt_qimageScaleAARGB_down_x_up_y_sse4(QImageScaleInfo* isi,
-							unsigned int* restrict dest,
-							int dw,
-							int dh,
-							int dow,
-							int sow);
-inline static void qt_qimageScaleAARGB_down_xy_sse4(QImageScaleInfo* isi,
-						    unsigned int* restrict dest,
-						    int dw,
-						    int dh,
-						    int dow,
-						    int sow);
+#ifdef QT_COMPILER_SUPPORTS_SIMD
+QT_SIMD_TARGET_PUSH
+#	if defined(QT_COMPILER_SUPPORTS_SSE4_1)
+static void qt_qimageScaleAARGBA_up_x_down_y_sse4(QImageScaleInfo* isi,
+						  unsigned int* restrict dest,
+						  int dw,
+						  int dh,
+						  int dow,
+						  int sow);
+static void qt_qimageScaleAARGBA_down_x_up_y_sse4(QImageScaleInfo* isi,
+						  unsigned int* restrict dest,
+						  int dw,
+						  int dh,
+						  int dow,
+						  int sow);
+static void qt_qimageScaleAARGBA_down_xy_sse4(QImageScaleInfo* isi,
+					      unsigned int* restrict dest,
+					      int dw,
+					      int dh,
+					      int dow,
+					      int sow);
+
+static void qt_qimageScaleAARGB_up_x_down_y_sse4(QImageScaleInfo* isi,
+						 unsigned int* restrict dest,
+						 int dw,
+						 int dh,
+						 int dow,
+						 int sow);
+static void qt_qimageScaleAARGB_down_x_up_y_sse4(QImageScaleInfo* isi,
+						 unsigned int* restrict dest,
+						 int dw,
+						 int dh,
+						 int dow,
+						 int sow);
+static void qt_qimageScaleAARGB_down_xy_sse4(QImageScaleInfo* isi,
+					     unsigned int* restrict dest,
+					     int dw,
+					     int dh,
+					     int dow,
+					     int sow);
+
+static int qt_qimageScaleAA_lerp_rows_u8_sse4(unsigned char* restrict dst,
+					      const unsigned char* restrict top,
+					      const unsigned char* restrict bot,
+					      int n,
+					      int yap);
+static int qt_qimageScaleAA_blend_rows_u16_sse4(unsigned short* restrict dst,
+						const unsigned char* restrict top,
+						const unsigned char* restrict bot,
+						int n,
+						int yap);
+static int qt_qimageScaleAA_vsum_rows_u8_sse4(int* restrict dst,
+					      const unsigned char* restrict pix,
+					      int n,
+					      int sow,
+					      int yap,
+					      int Cy);
+static int qt_qimageScaleBox_accum_row_u16_sse4(unsigned short* restrict acc,
+						const unsigned char* restrict row,
+						int n);
 #	endif
 
-#	if defined(__ARM_NEON__)
-inline static void qt_qimageScaleAARGBA_up_x_down_y_neon(QImageScaleInfo* isi,
-							 unsigned int* restrict dest,
-							 int dw,
-							 int dh,
-							 int dow,
-							 int sow);
-inline static void qt_qimageScaleAARGBA_down_x_up_y_neon(QImageScaleInfo* isi,
-							 unsigned int* restrict dest,
-							 int dw,
-							 int dh,
-							 int dow,
-							 int sow);
-inline static void qt_qimageScaleAARGBA_down_xy_neon(QImageScaleInfo* isi,
-						     unsigned int* restrict dest,
-						     int dw,
-						     int dh,
-						     int dow,
-						     int sow);
-
-inline static void qt_qimageScaleAARGB_up_x_down_y_neon(QImageScaleInfo* isi,
-							unsigned int* restrict dest,
-							int dw,
-							int dh,
-							int dow,
-							int sow);
-inline static void qt_qimageScaleAARGB_down_x_up_y_neon(QImageScaleInfo* isi,
-							unsigned int* restrict dest,
-							int dw,
-							int dh,
-							int dow,
-							int sow);
-inline static void qt_qimageScaleAARGB_down_xy_neon(QImageScaleInfo* isi,
-						    unsigned int* restrict dest,
-						    int dw,
-						    int dh,
-						    int dow,
-						    int sow);
+#	if defined(QT_COMPILER_SUPPORTS_NEON)
+static void qt_qimageScaleAARGBA_up_x_down_y_neon(QImageScaleInfo* isi,
+						  unsigned int* restrict dest,
+						  int dw,
+						  int dh,
+						  int dow,
+						  int sow);
+static void qt_qimageScaleAARGBA_down_x_up_y_neon(QImageScaleInfo* isi,
+						  unsigned int* restrict dest,
+						  int dw,
+						  int dh,
+						  int dow,
+						  int sow);
+static void qt_qimageScaleAARGBA_down_xy_neon(QImageScaleInfo* isi,
+					      unsigned int* restrict dest,
+					      int dw,
+					      int dh,
+					      int dow,
+					      int sow);
+
+static void qt_qimageScaleAARGB_up_x_down_y_neon(QImageScaleInfo* isi,
+						 unsigned int* restrict dest,
+						 int dw,
+						 int dh,
+						 int dow,
+						 int sow);
+static void qt_qimageScaleAARGB_down_x_up_y_neon(QImageScaleInfo* isi,
+						 unsigned int* restrict dest,
+						 int dw,
+						 int dh,
+						 int dow,
+						 int sow);
+static void qt_qimageScaleAARGB_down_xy_neon(QImageScaleInfo* isi,
+					     unsigned int* restrict dest,
+					     int dw,
+					     int dh,
+					     int dow,
+					     int sow);
+
+static int qt_qimageScaleAA_lerp_rows_u8_neon(unsigned char* restrict dst,
+					      const unsigned char* restrict top,
+					      const unsigned char* restrict bot,
+					      int n,
+					      int yap);
+static int qt_qimageScaleAA_blend_rows_u16_neon(unsigned short* restrict dst,
+						const unsigned char* restrict top,
+						const unsigned char* restrict bot,
+						int n,
+						int yap);
+static int qt_qimageScaleAA_vsum_rows_u8_neon(int* restrict dst,
+					      const unsigned char* restrict pix,
+					      int n,
+					      int sow,
+					      int yap,
+					      int Cy);
+static int qt_qimageScaleBox_accum_row_u16_neon(unsigned short* restrict acc,
+						const unsigned char* restrict row,
+						int n);
 #	endif
+QT_SIMD_TARGET_POP
 #endif
 
 static void
@@ -514,49 +514,51 @@ static void
 	}
 	/* if we're scaling down vertically */
 	else if (isi->xup_yup == 1) {
-#ifndef FBINK_QIS_NO_SIMD
-#	if defined(__SSE4_1__)
-		qt_qimageScaleAARGBA_up_x_down_y_sse4(isi, dest, dw, dh, dow, sow);
-#	elif defined(__ARM_NEON__)
-		qt_qimageScaleAARGBA_up_x_down_y_neon(isi, dest, dw, dh, dow, sow);
-#	else
-		qt_qimageScaleAARGBA_up_x_down_y(isi, dest, dw, dh, dow, sow);
-#	endif
-#else
-		qt_qimageScaleAARGBA_up_x_down_y(isi, dest, dw, dh, dow, sow);
+#if defined(QT_COMPILER_SUPPORTS_SSE4_1)
+		if (qCpuHasFeature(SSE4_1)) {
+			qt_qimageScaleAARGBA_up_x_down_y_sse4(isi, dest, dw, dh, dow, sow);
+		} else
+#elif defined(QT_COMPILER_SUPPORTS_NEON)
+		if (qCpuHasFeature(NEON)) {
+			qt_qimageScaleAARGBA_up_x_down_y_neon(isi, dest, dw, dh, dow, sow);
+		} else
 #endif
+		{
+			qt_qimageScaleAARGBA_up_x_down_y(isi, dest, dw, dh, dow, sow);
+		}
 	}
 	/* if we're scaling down horizontally */
 	else if (isi->xup_yup == 2) {
-#ifndef FBINK_QIS_NO_SIMD
-#	if defined(__SSE4_1__)
-		qt_qimageScaleAARGBA_down_x_up_y_sse4(isi, dest, dw, dh, dow, sow);
-#	elif defined(__ARM_NEON__)
-		qt_qimageScaleAARGBA_down_x_up_y_neon(isi, dest, dw, dh, dow, sow);
-#	else
-		qt_qimageScaleAARGBA_down_x_up_y(isi, dest, dw, dh, dow, sow);
-#	endif
-#else
-		qt_qimageScaleAARGBA_down_x_up_y(isi, dest, dw, dh, dow, sow);
+#if defined(QT_COMPILER_SUPPORTS_SSE4_1)
+		if (qCpuHasFeature(SSE4_1)) {
+			qt_qimageScaleAARGBA_down_x_up_y_sse4(isi, dest, dw, dh, dow, sow);
+		} else
+#elif defined(QT_COMPILER_SUPPORTS_NEON)
+		if (qCpuHasFeature(NEON)) {
+			qt_qimageScaleAARGBA_down_x_up_y_neon(isi, dest, dw, dh, dow, sow);
+		} else
 #endif
+		{
+			qt_qimageScaleAARGBA_down_x_up_y(isi, dest, dw, dh, dow, sow);
+		}
 	}
 	/* if we're scaling down horizontally & vertically */
 	else {
-#ifndef FBINK_QIS_NO_SIMD
-#	if defined(__SSE4_1__)
-		qt_qimageScaleAARGBA_down_xy_sse4(isi, dest, dw, dh, dow, sow);
-#	elif defined(__ARM_NEON__)
-		qt_qimageScaleAARGBA_down_xy_neon(isi, dest, dw, dh, dow, sow);
-#	else
-		qt_qimageScaleAARGBA_down_xy(isi, dest, dw, dh, dow, sow);
-#	endif
-#else
-		qt_qimageScaleAARGBA_down_xy(isi, dest, dw, dh, dow, sow);
+#if defined(QT_COMPILER_SUPPORTS_SSE4_1)
+		if (qCpuHasFeature(SSE4_1)) {
+			qt_qimageScaleAARGBA_down_xy_sse4(isi, dest, dw, dh, dow, sow);
+		} else
+#elif defined(QT_COMPILER_SUPPORTS_NEON)
+		if (qCpuHasFeature(NEON)) {
+			qt_qimageScaleAARGBA_down_xy_neon(isi, dest, dw, dh, dow, sow);
+		} else
 #endif
+		{
+			qt_qimageScaleAARGBA_down_xy(isi, dest, dw, dh, dow, sow);
+		}
 	}
 }
 
-#if defined(FBINK_QIS_NO_SIMD) || !(defined(__SSE4_1__) || defined(__ARM_NEON__))
 static inline __attribute__((always_inline)) void
     qt_qimageScaleAARGBA_helper(const unsigned int* restrict pix,
 				const int xyap,
@@ -732,7 +734,6 @@ static void qt_qimageScaleAARGB_down_xy(QImageScaleInfo* isi,
 					int dh,
 					int dow,
 					int sow);
-#endif    // FBINK_QIS_NO_SIMD || !(__SSE4_1__ || __ARM_NEON__)
 
 /* scale by area sampling - IGNORE the ALPHA byte*/
 static void
@@ -744,49 +745,51 @@ static void
 	}
 	/* if we're scaling down vertically */
 	else if (isi->xup_yup == 1) {
-#ifndef FBINK_QIS_NO_SIMD
-#	if defined(__SSE4_1__)
-		qt_qimageScaleAARGB_up_x_down_y_sse4(isi, dest, dw, dh, dow, sow);
-#	elif defined(__ARM_NEON__)
-		qt_qimageScaleAARGB_up_x_down_y_neon(isi, dest, dw, dh, dow, sow);
-#	else
-		qt_qimageScaleAARGB_up_x_down_y(isi, dest, dw, dh, dow, sow);
-#	endif
-#else
-		qt_qimageScaleAARGB_up_x_down_y(isi, dest, dw, dh, dow, sow);
+#if defined(QT_COMPILER_SUPPORTS_SSE4_1)
+		if (qCpuHasFeature(SSE4_1)) {
+			qt_qimageScaleAARGB_up_x_down_y_sse4(isi, dest, dw, dh, dow, sow);
+		} else
+#elif defined(QT_COMPILER_SUPPORTS_NEON)
+		if (qCpuHasFeature(NEON)) {
+			qt_qimageScaleAARGB_up_x_down_y_neon(isi, dest, dw, dh, dow, sow);
+		} else
 #endif
+		{
+			qt_qimageScaleAARGB_up_x_down_y(isi, dest, dw, dh, dow, sow);
+		}
 	}
 	/* if we're scaling down horizontally */
 	else if (isi->xup_yup == 2) {
-#ifndef FBINK_QIS_NO_SIMD
-#	if defined(__SSE4_1__)
-		qt_qimageScaleAARGB_down_x_up_y_sse4(isi, dest, dw, dh, dow, sow);
-#	elif defined(__ARM_NEON__)
-		qt_qimageScaleAARGB_down_x_up_y_neon(isi, dest, dw, dh, dow, sow);
-#	else
-		qt_qimageScaleAARGB_down_x_up_y(isi, dest, dw, dh, dow, sow);
-#	endif
-#else
-		qt_qimageScaleAARGB_down_x_up_y(isi, dest, dw, dh, dow, sow);
+#if defined(QT_COMPILER_SUPPORTS_SSE4_1)
+		if (qCpuHasFeature(SSE4_1)) {
+			qt_qimageScaleAARGB_down_x_up_y_sse4(isi, dest, dw, dh, dow, sow);
+		} else
+#elif defined(QT_COMPILER_SUPPORTS_NEON)
+		if (qCpuHasFeature(NEON)) {
+			qt_qimageScaleAARGB_down_x_up_y_neon(isi, dest, dw, dh, dow, sow);
+		} else
 #endif
+		{
+			qt_qimageScaleAARGB_down_x_up_y(isi, dest, dw, dh, dow, sow);
+		}
 	}
 	/* if we're scaling down horizontally & vertically */
 	else {
-#ifndef FBINK_QIS_NO_SIMD
-#	if defined(__SSE4_1__)
-		qt_qimageScaleAARGB_down_xy_sse4(isi, dest, dw, dh, dow, sow);
-#	elif defined(__ARM_NEON__)
-		qt_qimageScaleAARGB_down_xy_neon(isi, dest, dw, dh, dow, sow);
-#	else
-		qt_qimageScaleAARGB_down_xy(isi, dest, dw, dh, dow, sow);
-#	endif
-#else
-		qt_qimageScaleAARGB_down_xy(isi, dest, dw, dh, dow, sow);
+#if defined(QT_COMPILER_SUPPORTS_SSE4_1)
+		if (qCpuHasFeature(SSE4_1)) {
+			qt_qimageScaleAARGB_down_xy_sse4(isi, dest, dw, dh, dow, sow);
+		} else
+#elif defined(QT_COMPILER_SUPPORTS_NEON)
+		if (qCpuHasFeature(NEON)) {
+			qt_qimageScaleAARGB_down_xy_neon(isi, dest, dw, dh, dow, sow);
+		} else
 #endif
+		{
+			qt_qimageScaleAARGB_down_xy(isi, dest, dw, dh, dow, sow);
+		}
 	}
 }
 
-#if defined(FBINK_QIS_NO_SIMD) || !(defined(__SSE4_1__) || defined(__ARM_NEON__))
 static inline __attribute__((always_inline)) void
     qt_qimageScaleAARGB_helper(const unsigned int* restrict pix,
 			       const int xyap,
@@ -930,7 +933,90 @@ static void
 		}
 	}
 }
-#endif    // FBINK_QIS_NO_SIMD || !(__SSE4_1__ || __ARM_NEON__)
+
+#ifdef QT_COMPILER_SUPPORTS_SIMD
+QT_SIMD_TARGET_PUSH
+// NOTE: The grayscale scalers are split in separate horizontal & vertical passes over whole rows,
+//       which lets us vectorize the vertical ones (the horizontal ones are basically gathers, so they stay scalar).
+//       The integer math is exactly the same as in the "per-pixel" versions, so the results are bit-exact.
+//       For Y8A, a row is simply treated as 2 * width bytes, since both channels are processed identically.
+
+/* (top * (256 - yap) + bot * yap) >> 8, with 0 < yap < 256 */
+static inline void
+    qt_qimageScaleAA_lerp_rows_u8(unsigned char* restrict dst,
+				  const unsigned char* restrict top,
+				  const unsigned char* restrict bot,
+				  int n,
+				  int yap)
+{
+#	if defined(QT_COMPILER_SUPPORTS_SSE4_1)
+	int i = qt_qimageScaleAA_lerp_rows_u8_sse4(dst, top, bot, n, yap);
+#	elif defined(QT_COMPILER_SUPPORTS_NEON)
+	int i = qt_qimageScaleAA_lerp_rows_u8_neon(dst, top, bot, n, yap);
+#	endif
+	for (; i < n; i++) {
+		dst[i] = (unsigned char) ((top[i] * (256 - yap) + bot[i] * yap) >> 8);
+	}
+}
+
+/* top * (256 - yap) + bot * yap, with 0 < yap < 256 */
+static inline void
+    qt_qimageScaleAA_blend_rows_u16(unsigned short* restrict dst,
+				    const unsigned char* restrict top,
+				    const unsigned char* restrict bot,
+				    int n,
+				    int yap)
+{
+#	if defined(QT_COMPILER_SUPPORTS_SSE4_1)
+	int i = qt_qimageScaleAA_blend_rows_u16_sse4(dst, top, bot, n, yap);
+#	elif defined(QT_COMPILER_SUPPORTS_NEON)
+	int i = qt_qimageScaleAA_blend_rows_u16_neon(dst, top, bot, n, yap);
+#	endif
+	for (; i < n; i++) {
+		dst[i] = (unsigned short) (top[i] * (256 - yap) + bot[i] * yap);
+	}
+}
+
+/* Area sum of the column span starting at each of the n bytes of pix */
+// NOTE: Too large to be worth inlining (it's called once per row, anyway).
+static void
+    qt_qimageScaleAA_vsum_rows_u8(int* restrict dst, const unsigned char* restrict pix, int n, int sow, int yap, int Cy)
+{
+#	if defined(QT_COMPILER_SUPPORTS_SSE4_1)
+	int i = qt_qimageScaleAA_vsum_rows_u8_sse4(dst, pix, n, sow, yap, Cy);
+#	elif defined(QT_COMPILER_SUPPORTS_NEON)
+	int i = qt_qimageScaleAA_vsum_rows_u8_neon(dst, pix, n, sow, yap, Cy);
+#	endif
+	for (; i < n; i++) {
+		const unsigned char* restrict sptr = pix + i;
+		int                           v    = *sptr * yap;
+		int                           j;
+		for (j = (1 << 14) - yap; j > Cy; j -= Cy) {
+			sptr += sow;
+			v    += *sptr * Cy;
+		}
+		sptr += sow;
+		v    += *sptr * j;
+		dst[i] = v;
+	}
+}
+
+/* Same as qt_qimageScaleAAY8_helper, but on the 16-bit output of qt_qimageScaleAA_blend_rows_u16 */
+static inline __attribute__((always_inline)) int
+    qt_qimageScaleAA_helper_u16(const unsigned short* restrict pix, const int xyap, const int Cxy, const int step)
+{
+	int v = *pix * xyap;
+	int j;
+	for (j = (1 << 14) - xyap; j > Cxy; j -= Cxy) {
+		pix += step;
+		v   += *pix * Cxy;
+	}
+	pix += step;
+	v   += *pix * j;
+	return v;
+}
+QT_SIMD_TARGET_POP
+#endif    // QT_COMPILER_SUPPORTS_SIMD
 
 static inline __attribute__((always_inline)) void
     qt_qimageScaleAAY8_helper(const unsigned char* restrict pix,
@@ -1097,9 +1183,193 @@ static void
 	}
 }
 
+#ifdef QT_COMPILER_SUPPORTS_SIMD
+QT_SIMD_TARGET_PUSH
+/* Horizontal pass of qt_qimageScaleAAY8_up_xy */
+static inline void
+    qt_qimageScaleAAY8_up_x_row(unsigned char* restrict dptr,
+				const unsigned char* restrict sptr,
+				const int* restrict xpoints,
+				const int* restrict xapoints,
+				int dw)
+{
+	for (int x = 0; x < dw; x++) {
+		const unsigned char* restrict pix = sptr + xpoints[x];
+		const int xap                     = xapoints[x];
+		if (xap > 0) {
+			*dptr = INTERPOLATE_8BPP_PIXEL_256(
+			    pix[0], (unsigned int) (256 - xap), pix[1], (unsigned int) xap);
+		} else {
+			*dptr = pix[0];
+		}
+		dptr++;
+	}
+}
+
+static void
+    qt_qimageScaleAAY8_up_xy_simd(QImageScaleInfo* isi, unsigned char* restrict dest, int dw, int dh, int dow, int sow)
+{
+	const unsigned char** restrict ypoints = (const unsigned char** restrict) isi->ypoints_y8;
+	const int* restrict xpoints            = isi->xpoints;
+	const int* restrict xapoints           = isi->xapoints;
+	const int* restrict yapoints           = isi->yapoints;
+
+	// NOTE: When upscaling vertically, consecutive output lines interpolate between the same two source lines,
+	//       so we only interpolate said source lines horizontally once, and blend the results vertically.
+	unsigned char* buffer = malloc((size_t) dw * 2U);
+	if (!buffer) {
+		qt_qimageScaleAAY8_up_xy(isi, dest, dw, dh, dow, sow);
+		return;
+	}
+	unsigned char*       top     = buffer;
+	unsigned char*       bot     = buffer + dw;
+	const unsigned char* top_src = NULL;
+	const unsigned char* bot_src = NULL;
+
+	/* go through every scanline in the output buffer */
+	for (int y = 0; y < dh; y++) {
+		/* calculate the source line we'll scan from */
+		const unsigned char* restrict sptr = ypoints[y];
+		unsigned char* restrict dptr       = dest + (y * dow);
+		const int yap                      = yapoints[y];
+		if (sptr != top_src) {
+			if (sptr == bot_src) {
+				// We've moved down a line, what was the bottom line is now the top one
+				unsigned char* tmp = top;
+				top                = bot;
+				bot                = tmp;
+				bot_src            = top_src;
+			} else {
+				qt_qimageScaleAAY8_up_x_row(top, sptr, xpoints, xapoints, dw);
+			}
+			top_src = sptr;
+		}
+		if (yap > 0) {
+			// NOTE: Only look at the next source line when we actually need it, like the scalar code.
+			if (sptr + sow != bot_src) {
+				qt_qimageScaleAAY8_up_x_row(bot, sptr + sow, xpoints, xapoints, dw);
+				bot_src = sptr + sow;
+			}
+			qt_qimageScaleAA_lerp_rows_u8(dptr, top, bot, dw, yap);
+		} else {
+			memcpy(dptr, top, (size_t) dw);
+		}
+	}
+
+	free(buffer);
+}
+
+static void
+    qt_qimageScaleAAY8_up_x_down_y_simd(QImageScaleInfo* isi,
+					unsigned char* restrict dest,
+					int dw,
+					int dh,
+					int dow,
+					int sow)
+{
+	const unsigned char** restrict ypoints = (const unsigned char** restrict) isi->ypoints_y8;
+	const int* restrict xpoints            = isi->xpoints;
+	const int* restrict xapoints           = isi->xapoints;
+	const int* restrict yapoints           = isi->yapoints;
+
+	// Vertical area sums for every source column of the current output line
+	int* restrict vsum = malloc((size_t) sow * sizeof(*vsum));
+	if (!vsum) {
+		qt_qimageScaleAAY8_up_x_down_y(isi, dest, dw, dh, dow, sow);
+		return;
+	}
+
+	for (int y = 0; y < dh; y++) {
+		const int Cy  = (yapoints[y]) >> 16;
+		const int yap = (yapoints[y]) & 0xffff;
+
+		qt_qimageScaleAA_vsum_rows_u8(vsum, ypoints[y], sow, sow, yap, Cy);
+
+		unsigned char* restrict dptr = dest + (y * dow);
+		for (int x = 0; x < dw; x++) {
+			const int* restrict vptr = vsum + xpoints[x];
+			int                 v    = vptr[0];
+
+			const int xap = xapoints[x];
+			if (xap > 0) {
+				v = v * (256 - xap);
+				v = (v + (vptr[1] * xap)) >> 8;
+			}
+			*dptr++ = (unsigned char) (v >> 14);
+		}
+	}
+
+	free(vsum);
+}
+
+static void
+    qt_qimageScaleAAY8_down_x_up_y_simd(QImageScaleInfo* isi,
+					unsigned char* restrict dest,
+					int dw,
+					int dh,
+					int dow,
+					int sow)
+{
+	const unsigned char** restrict ypoints = (const unsigned char** restrict) isi->ypoints_y8;
+	const int* restrict xpoints            = isi->xpoints;
+	const int* restrict xapoints           = isi->xapoints;
+	const int* restrict yapoints           = isi->yapoints;
+
+	// NOTE: Blending the two source lines *before* the horizontal area sum is exact (it's all linear integer math),
+	//       and it fits in 16 bits, at which point we just have to fold the final >> 8 into the >> 14.
+	unsigned short* restrict blend = malloc((size_t) sow * sizeof(*blend));
+	if (!blend) {
+		qt_qimageScaleAAY8_down_x_up_y(isi, dest, dw, dh, dow, sow);
+		return;
+	}
+
+	/* go through every scanline in the output buffer */
+	for (int y = 0; y < dh; y++) {
+		unsigned char* restrict dptr = dest + (y * dow);
+		const int yap                = yapoints[y];
+		if (yap > 0) {
+			qt_qimageScaleAA_blend_rows_u16(blend, ypoints[y], ypoints[y] + sow, sow, yap);
+			for (int x = 0; x < dw; x++) {
+				const int Cx  = xapoints[x] >> 16;
+				const int xap = xapoints[x] & 0xffff;
+
+				const int v = qt_qimageScaleAA_helper_u16(blend + xpoints[x], xap, Cx, 1);
+				*dptr++     = (unsigned char) (v >> (8 + 14));
+			}
+		} else {
+			for (int x = 0; x < dw; x++) {
+				const int Cx  = xapoints[x] >> 16;
+				const int xap = xapoints[x] & 0xffff;
+
+				int v;
+				qt_qimageScaleAAY8_helper(ypoints[y] + xpoints[x], xap, Cx, 1, &v);
+				*dptr++ = (unsigned char) (v >> 14);
+			}
+		}
+	}
+
+	free(blend);
+}
+QT_SIMD_TARGET_POP
+#endif    // QT_COMPILER_SUPPORTS_SIMD
+
 static void
     qt_qimageScaleAAY8(QImageScaleInfo* isi, unsigned char* restrict dest, int dw, int dh, int dow, int sow)
 {
+#ifdef QT_COMPILER_SUPPORTS_SIMD
+	if (qCpuHasSimd()) {
+		if (isi->xup_yup == 3) {
+			qt_qimageScaleAAY8_up_xy_simd(isi, dest, dw, dh, dow, sow);
+		} else if (isi->xup_yup == 1) {
+			qt_qimageScaleAAY8_up_x_down_y_simd(isi, dest, dw, dh, dow, sow);
+		} else if (isi->xup_yup == 2) {
+			qt_qimageScaleAAY8_down_x_up_y_simd(isi, dest, dw, dh, dow, sow);
+		} else {
+			qt_qimageScaleAAY8_down_xy(isi, dest, dw, dh, dow, sow);
+		}
+		return;
+	}
+#endif
 	if (isi->xup_yup == 3) {
 		qt_qimageScaleAAY8_up_xy(isi, dest, dw, dh, dow, sow);
 	} else if (isi->xup_yup == 1) {
@@ -1290,9 +1560,205 @@ static void
 	}
 }
 
+#ifdef QT_COMPILER_SUPPORTS_SIMD
+QT_SIMD_TARGET_PUSH
+/* Horizontal pass of qt_qimageScaleAAY8A_up_xy */
+static inline void
+    qt_qimageScaleAAY8A_up_x_row(unsigned short* restrict dptr,
+				 const unsigned short* restrict sptr,
+				 const int* restrict xpoints,
+				 const int* restrict xapoints,
+				 int dw)
+{
+	for (int x = 0; x < dw; x++) {
+		const unsigned short* restrict pix = sptr + xpoints[x];
+		const int xap                      = xapoints[x];
+		if (xap > 0) {
+			*dptr = INTERPOLATE_16BPP_PIXEL_256(
+			    pix[0], (unsigned int) (256 - xap), pix[1], (unsigned int) xap);
+		} else {
+			*dptr = pix[0];
+		}
+		dptr++;
+	}
+}
+
+static void
+    qt_qimageScaleAAY8A_up_xy_simd(QImageScaleInfo* isi, unsigned short* restrict dest, int dw, int dh, int dow, int sow)
+{
+	const unsigned short** restrict ypoints = (const unsigned short** restrict) isi->ypoints_y8a;
+	const int* restrict xpoints             = isi->xpoints;
+	const int* restrict xapoints            = isi->xapoints;
+	const int* restrict yapoints            = isi->yapoints;
+
+	// NOTE: Same idea as qt_qimageScaleAAY8_up_xy_simd,
+	//       INTERPOLATE_16BPP_PIXEL_256 handles both channels separately, so we can blend the lines bytewise.
+	unsigned short* buffer = malloc((size_t) dw * 2U * sizeof(*buffer));
+	if (!buffer) {
+		qt_qimageScaleAAY8A_up_xy(isi, dest, dw, dh, dow, sow);
+		return;
+	}
+	unsigned short*       top     = buffer;
+	unsigned short*       bot     = buffer + dw;
+	const unsigned short* top_src = NULL;
+	const unsigned short* bot_src = NULL;
+
+	/* go through every scanline in the output buffer */
+	for (int y = 0; y < dh; y++) {
+		/* calculate the source line we'll scan from */
+		const unsigned short* restrict sptr = ypoints[y];
+		unsigned short* restrict dptr       = dest + (y * dow);
+		const int yap                       = yapoints[y];
+		if (sptr != top_src) {
+			if (sptr == bot_src) {
+				// We've moved down a line, what was the bottom line is now the top one
+				unsigned short* tmp = top;
+				top                 = bot;
+				bot                 = tmp;
+				bot_src             = top_src;
+			} else {
+				qt_qimageScaleAAY8A_up_x_row(top, sptr, xpoints, xapoints, dw);
+			}
+			top_src = sptr;
+		}
+		if (yap > 0) {
+			// NOTE: Only look at the next source line when we actually need it, like the scalar code.
+			if (sptr + sow != bot_src) {
+				qt_qimageScaleAAY8A_up_x_row(bot, sptr + sow, xpoints, xapoints, dw);
+				bot_src = sptr + sow;
+			}
+			qt_qimageScaleAA_lerp_rows_u8((unsigned char*) dptr,
+						      (const unsigned char*) top,
+						      (const unsigned char*) bot,
+						      dw * 2,
+						      yap);
+		} else {
+			memcpy(dptr, top, (size_t) dw * sizeof(*dptr));
+		}
+	}
+
+	free(buffer);
+}
+
+static void
+    qt_qimageScaleAAY8A_up_x_down_y_simd(QImageScaleInfo* isi,
+					 unsigned short* restrict dest,
+					 int dw,
+					 int dh,
+					 int dow,
+					 int sow)
+{
+	const unsigned short** restrict ypoints = (const unsigned short** restrict) isi->ypoints_y8a;
+	const int* restrict xpoints             = isi->xpoints;
+	const int* restrict xapoints            = isi->xapoints;
+	const int* restrict yapoints            = isi->yapoints;
+
+	// Vertical area sums for every source column of the current output line (interleaved, Y then A)
+	int* restrict vsum = malloc((size_t) sow * 2U * sizeof(*vsum));
+	if (!vsum) {
+		qt_qimageScaleAAY8A_up_x_down_y(isi, dest, dw, dh, dow, sow);
+		return;
+	}
+
+	for (int y = 0; y < dh; y++) {
+		const int Cy  = (yapoints[y]) >> 16;
+		const int yap = (yapoints[y]) & 0xffff;
+
+		qt_qimageScaleAA_vsum_rows_u8(vsum, (const unsigned char*) ypoints[y], sow * 2, sow * 2, yap, Cy);
+
+		unsigned short* restrict dptr = dest + (y * dow);
+		for (int x = 0; x < dw; x++) {
+			const int* restrict vptr = vsum + (xpoints[x] * 2);
+			int                 v    = vptr[0];
+			int                 a    = vptr[1];
+
+			const int xap = xapoints[x];
+			if (xap > 0) {
+				v = v * (256 - xap);
+				a = a * (256 - xap);
+				v = (v + (vptr[2] * xap)) >> 8;
+				a = (a + (vptr[3] * xap)) >> 8;
+			}
+			*dptr++ = (unsigned short int) qY8A(v >> 14, a >> 14);
+		}
+	}
+
+	free(vsum);
+}
+
+static void
+    qt_qimageScaleAAY8A_down_x_up_y_simd(QImageScaleInfo* isi,
+					 unsigned short* restrict dest,
+					 int dw,
+					 int dh,
+					 int dow,
+					 int sow)
+{
+	const unsigned short** restrict ypoints = (const unsigned short** restrict) isi->ypoints_y8a;
+	const int* restrict xpoints             = isi->xpoints;
+	const int* restrict xapoints            = isi->xapoints;
+	const int* restrict yapoints            = isi->yapoints;
+
+	// NOTE: c.f., qt_qimageScaleAAY8_down_x_up_y_simd (interleaved, Y then A)
+	unsigned short* restrict blend = malloc((size_t) sow * 2U * sizeof(*blend));
+	if (!blend) {
+		qt_qimageScaleAAY8A_down_x_up_y(isi, dest, dw, dh, dow, sow);
+		return;
+	}
+
+	/* go through every scanline in the output buffer */
+	for (int y = 0; y < dh; y++) {
+		unsigned short* restrict dptr = dest + (y * dow);
+		const int yap                 = yapoints[y];
+		if (yap > 0) {
+			qt_qimageScaleAA_blend_rows_u16(blend,
+							(const unsigned char*) ypoints[y],
+							(const unsigned char*) (ypoints[y] + sow),
+							sow * 2,
+							yap);
+			for (int x = 0; x < dw; x++) {
+				const int Cx  = xapoints[x] >> 16;
+				const int xap = xapoints[x] & 0xffff;
+
+				const unsigned short* restrict bptr = blend + (xpoints[x] * 2);
+				const int v = qt_qimageScaleAA_helper_u16(bptr, xap, Cx, 2);
+				const int a = qt_qimageScaleAA_helper_u16(bptr + 1, xap, Cx, 2);
+				*dptr++     = (unsigned short int) qY8A(v >> (8 + 14), a >> (8 + 14));
+			}
+		} else {
+			for (int x = 0; x < dw; x++) {
+				const int Cx  = xapoints[x] >> 16;
+				const int xap = xapoints[x] & 0xffff;
+
+				int v, a;
+				qt_qimageScaleAAY8A_helper(ypoints[y] + xpoints[x], xap, Cx, 1, &v, &a);
+				*dptr++ = (unsigned short int) qY8A(v >> 14, a >> 14);
+			}
+		}
+	}
+
+	free(blend);
+}
+QT_SIMD_TARGET_POP
+#endif    // QT_COMPILER_SUPPORTS_SIMD
+
 static void
     qt_qimageScaleAAY8A(QImageScaleInfo* isi, unsigned short* restrict dest, int dw, int dh, int dow, int sow)
 {
+#ifdef QT_COMPILER_SUPPORTS_SIMD
+	if (qCpuHasSimd()) {
+		if (isi->xup_yup == 3) {
+			qt_qimageScaleAAY8A_up_xy_simd(isi, dest, dw, dh, dow, sow);
+		} else if (isi->xup_yup == 1) {
+			qt_qimageScaleAAY8A_up_x_down_y_simd(isi, dest, dw, dh, dow, sow);
+		} else if (isi->xup_yup == 2) {
+			qt_qimageScaleAAY8A_down_x_up_y_simd(isi, dest, dw, dh, dow, sow);
+		} else {
+			qt_qimageScaleAAY8A_down_xy(isi, dest, dw, dh, dow, sow);
+		}
+		return;
+	}
+#endif
 	if (isi->xup_yup == 3) {
 		qt_qimageScaleAAY8A_up_xy(isi, dest, dw, dh, dow, sow);
 	} else if (isi->xup_yup == 1) {
@@ -1304,61 +1770,297 @@ static void
 	}
 }
 
-unsigned char*
-    qSmoothScaleImage(const unsigned char* restrict src, int sw, int sh, int sn, bool ignore_alpha, int dw, int dh)
+/* Box averages of the vertical sums in acc, nc out of every sn channels, c.f., qSmoothScaleRowsBox */
+// NOTE: Boxes are either bw or bw + 1 columns wide (c.f., qimageCalcScaleInfo),
+//       so we can step through them without any divisions, and use a reciprocal instead of dividing the sums.
+static inline __attribute__((always_inline)) void
+    qt_qimageScaleBox_hsum_row(unsigned char* restrict dptr,
+			       const unsigned short* restrict aptr,
+			       int                            iw,
+			       int                            bw,
+			       int                            br,
+			       const unsigned int* restrict   rcp,
+			       const int                      sn,
+			       const int                      nc)
 {
-	unsigned char* restrict buffer = NULL;
-	if (src == NULL || dw <= 0 || dh <= 0) {
-		return buffer;
+	int err = 0;
+	for (int ix = 0; ix < iw; ix++) {
+		err            += br;
+		const int wide  = err >= iw;
+		if (wide) {
+			err -= iw;
+		}
+		const int    w       = bw + wide;
+		unsigned int sums[4] = { 0U };
+		for (int sx = 0; sx < w; sx++) {
+			for (int c = 0; c < nc; c++) {
+				sums[c] += aptr[c];
+			}
+			aptr += sn;
+		}
+		for (int c = 0; c < nc; c++) {
+			*dptr++ = (unsigned char) (((quint64) sums[c] * rcp[wide] + (1U << 23)) >> 24);
+		}
+		// NOTE: Like qt_qimageScaleAARGB, make the result opaque when we're ignoring the alpha channel
+		if (nc != sn) {
+			*dptr++ = 0xFFu;
+		}
 	}
+}
 
-	QImageScaleInfo* scaleinfo = qimageCalcScaleInfo(src, sw, sh, sn, dw, dh, true);
-	if (!scaleinfo) {
-		return buffer;
+/* acc[i] += row[i], for the vertical sums of the box-filter prepass */
+static inline void
+    qt_qimageScaleBox_accum_row_u16(unsigned short* restrict acc, const unsigned char* restrict row, int n)
+{
+	int i = 0;
+#if defined(QT_COMPILER_SUPPORTS_SSE4_1)
+	if (qCpuHasFeature(SSE4_1)) {
+		i = qt_qimageScaleBox_accum_row_u16_sse4(acc, row, n);
+	}
+#elif defined(QT_COMPILER_SUPPORTS_NEON)
+	if (qCpuHasFeature(NEON)) {
+		i = qt_qimageScaleBox_accum_row_u16_neon(acc, row, n);
 	}
+#endif
+	for (; i < n; i++) {
+		acc[i] = (unsigned short) (acc[i] + row[i]);
+	}
+}
 
-	// NOTE: For RGB/RGBA input, output format is always RGBA!
-	//       In case our input was RGB, we've already ensured that our input buffer is already 32bpp,
-	//       c.f., comments below.
-	// SSE/NEON friendly alignment, just in case...
-	void* ptr;
-	if (posix_memalign(&ptr, 16, (size_t) (dw * dh * sn)) != 0) {
-		fprintf(stderr, "qSmoothScaleImage: out of memory, returning null!\n");
-		qimageFreeScaleInfo(scaleinfo);
+QImageScaleInfo*
+    qSmoothScaleInfoCreate(int sw, int sh, int sn, int dw, int dh)
+{
+	if (sw <= 0 || sh <= 0 || dw <= 0 || dh <= 0) {
 		return NULL;
-	} else {
-		buffer = (unsigned char* restrict) ptr;
 	}
 
-	// NOTE: In the same way, we enforce 32bpp input buffers for RGB,
+	return qimageCalcScaleInfo(sw, sh, sn, dw, dh, true, true);
+}
+
+void
+    qSmoothScaleInfoFree(QImageScaleInfo* isi)
+{
+	qimageFreeScaleInfo(isi);
+}
+
+// The scaling routines want actual row pointers, which we resolve on the stack, this many rows at a time
+#define QIS_ROWS_PER_PASS 64
+
+static void
+    qSmoothScaleRowsPass(const QImageScaleInfo* isi,
+			 const unsigned char* restrict src,
+			 int                           src_y,
+			 bool                          ignore_alpha,
+			 int                           dy,
+			 int                           rows,
+			 unsigned char* restrict dest)
+{
+	// NOTE: The scaling routines only ever look at ypoints[y] & yapoints[y] for the destination row they're on,
+	//       so we can simply offset those to scale an arbitrary band of rows [dy, dy + rows) into dest.
+	//       xup_yup was computed against the full destination height, so the sampling is unaffected.
+	//       Likewise, src only needs to hold the source rows they actually point to, starting from row src_y.
+	QImageScaleInfo band         = *isi;
+	band.yapoints                = isi->yapoints + dy;
+	const int           sw       = isi->sw;
+	const int           dw       = isi->dw;
+	const int* restrict yoffsets = isi->yoffsets + dy;
+	const int           src_off  = src_y * sw;
+
+	// NOTE: For RGB/RGBA input, output format is always RGBA!
+	//       In the same way, we enforce 32bpp input buffers for RGB,
 	//       because that's what Qt uses, even for RGB with no alpha.
 	//       (the pixelformat constant is helpfully named RGB32 to remind you of that ;)).
 	//       This is why we'll never get sn == 3 here, FBInk takes care of never allowing that to happen.
 	// NOTE: See comment in qimageCalcScaleInfo regarding our simplification of using sw directly.
-	switch (sn) {
-		case 4:
+	switch (isi->sn) {
+		case 4: {
+			const unsigned int* ypoints[QIS_ROWS_PER_PASS];
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-align"
+			for (int y = 0; y < rows; y++) {
+				ypoints[y] = (const unsigned int*) src + (yoffsets[y] - src_off);
+			}
+#pragma GCC diagnostic pop
+			band.ypoints = ypoints;
 			if (ignore_alpha) {
 				// NOTE: Input buffer is still 32bpp, we just skip *processing* of the alpha channel.
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcast-align"
-				qt_qimageScaleAARGB(scaleinfo, (unsigned int* restrict) buffer, dw, dh, dw, sw);
+				qt_qimageScaleAARGB(&band, (unsigned int* restrict) dest, dw, rows, dw, sw);
 #pragma GCC diagnostic pop
 			} else {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcast-align"
-				qt_qimageScaleAARGBA(scaleinfo, (unsigned int* restrict) buffer, dw, dh, dw, sw);
+				qt_qimageScaleAARGBA(&band, (unsigned int* restrict) dest, dw, rows, dw, sw);
 #pragma GCC diagnostic pop
 			}
 			break;
-		case 2:
+		}
+		case 2: {
+			const unsigned short* ypoints[QIS_ROWS_PER_PASS];
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcast-align"
-			qt_qimageScaleAAY8A(scaleinfo, (unsigned short* restrict) buffer, dw, dh, dw, sw);
+			for (int y = 0; y < rows; y++) {
+				ypoints[y] = (const unsigned short*) src + (yoffsets[y] - src_off);
+			}
+			band.ypoints_y8a = ypoints;
+			qt_qimageScaleAAY8A(&band, (unsigned short* restrict) dest, dw, rows, dw, sw);
 #pragma GCC diagnostic pop
 			break;
-		case 1:
-			qt_qimageScaleAAY8(scaleinfo, (unsigned char* restrict) buffer, dw, dh, dw, sw);
+		}
+		case 1: {
+			const unsigned char* ypoints[QIS_ROWS_PER_PASS];
+			for (int y = 0; y < rows; y++) {
+				ypoints[y] = src + (yoffsets[y] - src_off);
+			}
+			band.ypoints_y8 = ypoints;
+			qt_qimageScaleAAY8(&band, (unsigned char* restrict) dest, dw, rows, dw, sw);
 			break;
+		}
+	}
+}
+
+// NOTE: Scales the destination rows [dy, dy + rows) through the box-filtered intermediate image (c.f., qimageCalcScaleInfo).
+//       We only ever box-filter the intermediate rows those actually need, which keeps this banding/threading friendly.
+//       Returns 0 on success, -1 if we failed to allocate our scratch buffers (in which case dest is left untouched).
+static int
+    qSmoothScaleRowsBox(const QImageScaleInfo* isi,
+			const unsigned char* restrict src,
+			bool                          ignore_alpha,
+			int                           dy,
+			int                           rows,
+			unsigned char* restrict dest)
+{
+	const QImageScaleInfo* box = isi->box_isi;
+	const int              sw  = isi->sw;
+	const int              sh  = isi->sh;
+	const int              sn  = isi->sn;
+	const int              iw  = box->sw;
+	const int              ih  = box->sh;
+	const int              bw  = sw / iw;
+	const int              br  = sw % iw;
+	// We don't need to average the alpha channel if we're going to ignore it
+	const int nc = (sn == 4 && ignore_alpha) ? 3 : sn;
+
+	// A destination row spans at most ceil(ih / dh) + 1 intermediate rows
+	const int y0 = box->yoffsets[dy] / iw;
+	const int y1 = qMin(ih, box->yoffsets[dy + rows - 1] / iw + (ih + box->dh - 1) / box->dh + 1);
+
+	const size_t             srow_size = (size_t) sw * (size_t) sn;
+	const size_t             irow_size = (size_t) iw * (size_t) sn;
+	unsigned short* restrict acc       = malloc(srow_size * sizeof(*acc));
+	unsigned char* restrict  img       = malloc((size_t) (y1 - y0) * irow_size);
+	if (!acc || !img) {
+		fprintf(stderr, "qSmoothScaleRowsBox: out of memory!\n");
+		free(acc);
+		free(img);
+		return -1;
+	}
+
+	for (int iy = y0; iy < y1; iy++) {
+		// Vertical sums of the source rows backing this intermediate row...
+		const int sy0 = (int) (((qint64) iy * sh) / ih);
+		const int sy1 = (int) (((qint64) (iy + 1) * sh) / ih);
+		memset(acc, 0, srow_size * sizeof(*acc));
+		for (int sy = sy0; sy < sy1; sy++) {
+			qt_qimageScaleBox_accum_row_u16(acc, src + ((size_t) sy * srow_size), (int) srow_size);
+		}
+
+		// ...then horizontal sums of those, and we're left with the average.
+		const int               bh     = sy1 - sy0;
+		const unsigned int      rcp[2] = { (1U << 24) / (unsigned int) (bw * bh),
+						   (1U << 24) / (unsigned int) ((bw + 1) * bh) };
+		unsigned char* restrict dptr   = img + ((size_t) (iy - y0) * irow_size);
+		// NOTE: Make sure the compiler gets to see constant channel counts, so it can unroll/vectorize the sums.
+		if (sn == 4 && nc == 3) {
+			qt_qimageScaleBox_hsum_row(dptr, acc, iw, bw, br, rcp, 4, 3);
+		} else if (sn == 4) {
+			qt_qimageScaleBox_hsum_row(dptr, acc, iw, bw, br, rcp, 4, 4);
+		} else if (sn == 2) {
+			qt_qimageScaleBox_hsum_row(dptr, acc, iw, bw, br, rcp, 2, 2);
+		} else {
+			qt_qimageScaleBox_hsum_row(dptr, acc, iw, bw, br, rcp, 1, 1);
+		}
+	}
+	free(acc);
+
+	const size_t drow_size = (size_t) box->dw * (size_t) sn;
+	for (int y = 0; y < rows; y += QIS_ROWS_PER_PASS) {
+		const int pass_rows = qMin(QIS_ROWS_PER_PASS, rows - y);
+		qSmoothScaleRowsPass(box, img, y0, ignore_alpha, dy + y, pass_rows, dest + ((size_t) y * drow_size));
+	}
+	free(img);
+
+	return 0;
+}
+
+int
+    qSmoothScaleRows(const QImageScaleInfo* isi,
+		     const unsigned char* restrict src,
+		     bool                          ignore_alpha,
+		     int                           dy,
+		     int                           rows,
+		     unsigned char* restrict dest)
+{
+	if (rows <= 0) {
+		return 0;
+	}
+	if (isi->box_isi) {
+		return qSmoothScaleRowsBox(isi, src, ignore_alpha, dy, rows, dest);
+	}
+
+	const size_t row_size = (size_t) isi->dw * (size_t) isi->sn;
+	for (int y = 0; y < rows; y += QIS_ROWS_PER_PASS) {
+		const int pass_rows = qMin(QIS_ROWS_PER_PASS, rows - y);
+		qSmoothScaleRowsPass(isi, src, 0, ignore_alpha, dy + y, pass_rows, dest + ((size_t) y * row_size));
+	}
+
+	return 0;
+}
+
+int
+    qSmoothScaleImageInto(const QImageScaleInfo* isi,
+			  const unsigned char* restrict src,
+			  bool                          ignore_alpha,
+			  unsigned char* restrict dest)
+{
+	if (isi == NULL || src == NULL || dest == NULL) {
+		return -1;
+	}
+
+	return qSmoothScaleRows(isi, src, ignore_alpha, 0, isi->dh, dest);
+}
+
+unsigned char*
+    qSmoothScaleImage(const unsigned char* restrict src, int sw, int sh, int sn, bool ignore_alpha, int dw, int dh)
+{
+	unsigned char* restrict buffer = NULL;
+	if (src == NULL || dw <= 0 || dh <= 0) {
+		return buffer;
+	}
+
+	QImageScaleInfo* scaleinfo = qimageCalcScaleInfo(sw, sh, sn, dw, dh, true, true);
+	if (!scaleinfo) {
+		return buffer;
+	}
+
+	// NOTE: For RGB/RGBA input, output format is always RGBA!
+	//       In case our input was RGB, we've already ensured that our input buffer is already 32bpp,
+	//       c.f., comments in qSmoothScaleRowsPass.
+	// SSE/NEON friendly alignment, just in case...
+	void* ptr;
+	if (posix_memalign(&ptr, 16, (size_t) (dw * dh * sn)) != 0) {
+		fprintf(stderr, "qSmoothScaleImage: out of memory, returning null!\n");
+		qimageFreeScaleInfo(scaleinfo);
+		return NULL;
+	} else {
+		buffer = (unsigned char* restrict) ptr;
+	}
+
+	if (qSmoothScaleImageInto(scaleinfo, src, ignore_alpha, buffer) != 0) {
+		fprintf(stderr, "qSmoothScaleImage: failed to scale image, returning null!\n");
+		free(buffer);
+		buffer = NULL;
 	}
 
 	qimageFreeScaleInfo(scaleinfo);
@@ -39,8 +39,9 @@
 ****************************************************************************/
 
 #include "qimagescale_p.h"
+#include "qsimd_p.h"
 
-#if defined(__ARM_NEON__)
+#ifdef QT_COMPILER_SUPPORTS_NEON
 
 static inline __attribute__((always_inline)) uint32x4_t
     qt_qimageScaleAARGBA_helper_neon(const unsigned int* restrict pix, const int xyap, const int Cxy, const int step)
@@ -62,7 +63,7 @@ static inline __attribute__((always_inline)) uint32x4_t
 	return vx;
 }
 
-static inline void
+static void
     qt_qimageScaleAARGBA_up_x_down_y_neon(QImageScaleInfo* isi,
 					  unsigned int* restrict dest,
 					  int dw,
@@ -103,7 +104,7 @@ static inline void
 	}
 }
 
-static inline void
+static void
     qt_qimageScaleAARGB_up_x_down_y_neon(QImageScaleInfo* isi,
 					 unsigned int* restrict dest,
 					 int dw,
@@ -145,7 +146,7 @@ static inline void
 	}
 }
 
-static inline void
+static void
     qt_qimageScaleAARGBA_down_x_up_y_neon(QImageScaleInfo* isi,
 					  unsigned int* restrict dest,
 					  int dw,
@@ -186,7 +187,7 @@ static inline void
 	}
 }
 
-static inline void
+static void
     qt_qimageScaleAARGB_down_x_up_y_neon(QImageScaleInfo* isi,
 					 unsigned int* restrict dest,
 					 int dw,
@@ -228,7 +229,7 @@ static inline void
 	}
 }
 
-static inline void
+static void
     qt_qimageScaleAARGBA_down_xy_neon(QImageScaleInfo* isi, unsigned int* restrict dest, int dw, int dh, int dow, int sow)
 {
 	const unsigned int** restrict ypoints = isi->ypoints;
@@ -273,7 +274,7 @@ static inline void
 	}
 }
 
-static inline void
+static void
     qt_qimageScaleAARGB_down_xy_neon(QImageScaleInfo* isi, unsigned int* restrict dest, int dw, int dh, int dow, int sow)
 {
 	const unsigned int** restrict ypoints = isi->ypoints;
@@ -319,4 +320,120 @@ static inline void
 	}
 }
 
+// NOTE: The following kernels only implement the vertical passes of the grayscale (Y8/Y8A) scalers,
+//       on whole rows of bytes at once (so Y8A simply has twice as many of them).
+//       They return how many bytes they've processed, the caller takes care of the tail.
+
+/* (top * (256 - yap) + bot * yap) >> 8, with 0 < yap < 256 */
+static int
+    qt_qimageScaleAA_lerp_rows_u8_neon(unsigned char* restrict dst,
+				       const unsigned char* restrict top,
+				       const unsigned char* restrict bot,
+				       int n,
+				       int yap)
+{
+	const uint8x8_t vyap    = vdup_n_u8((uint8_t) yap);
+	const uint8x8_t vinvyap = vdup_n_u8((uint8_t) (256 - yap));
+
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		const uint8x16_t vt = vld1q_u8(top + i);
+		const uint8x16_t vb = vld1q_u8(bot + i);
+
+		uint16x8_t vlo = vmull_u8(vget_low_u8(vt), vinvyap);
+		uint16x8_t vhi = vmull_u8(vget_high_u8(vt), vinvyap);
+		vlo            = vmlal_u8(vlo, vget_low_u8(vb), vyap);
+		vhi            = vmlal_u8(vhi, vget_high_u8(vb), vyap);
+		vst1q_u8(dst + i, vcombine_u8(vshrn_n_u16(vlo, 8), vshrn_n_u16(vhi, 8)));
+	}
+	return i;
+}
+
+/* top * (256 - yap) + bot * yap, with 0 < yap < 256, i.e., the same thing as above, minus the final shift */
+static int
+    qt_qimageScaleAA_blend_rows_u16_neon(unsigned short* restrict dst,
+					 const unsigned char* restrict top,
+					 const unsigned char* restrict bot,
+					 int n,
+					 int yap)
+{
+	const uint8x8_t vyap    = vdup_n_u8((uint8_t) yap);
+	const uint8x8_t vinvyap = vdup_n_u8((uint8_t) (256 - yap));
+
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		const uint8x16_t vt = vld1q_u8(top + i);
+		const uint8x16_t vb = vld1q_u8(bot + i);
+
+		uint16x8_t vlo = vmull_u8(vget_low_u8(vt), vinvyap);
+		uint16x8_t vhi = vmull_u8(vget_high_u8(vt), vinvyap);
+		vlo            = vmlal_u8(vlo, vget_low_u8(vb), vyap);
+		vhi            = vmlal_u8(vhi, vget_high_u8(vb), vyap);
+		vst1q_u16(dst + i, vlo);
+		vst1q_u16(dst + i + 8, vhi);
+	}
+	return i;
+}
+
+/* Area sum of a column span of 8-bit rows, c.f., qt_qimageScaleAAY8_helper (w/ a step of sow) */
+static int
+    qt_qimageScaleAA_vsum_rows_u8_neon(int* restrict dst,
+				       const unsigned char* restrict pix,
+				       int n,
+				       int sow,
+				       int yap,
+				       int Cy)
+{
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		const unsigned char* restrict sptr = pix + i;
+		uint8x16_t                    vp   = vld1q_u8(sptr);
+		uint16x8_t                    vlo  = vmovl_u8(vget_low_u8(vp));
+		uint16x8_t                    vhi  = vmovl_u8(vget_high_u8(vp));
+		uint32x4_t                    v0   = vmull_n_u16(vget_low_u16(vlo), (uint16_t) yap);
+		uint32x4_t                    v1   = vmull_n_u16(vget_high_u16(vlo), (uint16_t) yap);
+		uint32x4_t                    v2   = vmull_n_u16(vget_low_u16(vhi), (uint16_t) yap);
+		uint32x4_t                    v3   = vmull_n_u16(vget_high_u16(vhi), (uint16_t) yap);
+
+		int j;
+		for (j = (1 << 14) - yap; j > Cy; j -= Cy) {
+			sptr += sow;
+			vp    = vld1q_u8(sptr);
+			vlo   = vmovl_u8(vget_low_u8(vp));
+			vhi   = vmovl_u8(vget_high_u8(vp));
+			v0    = vmlal_n_u16(v0, vget_low_u16(vlo), (uint16_t) Cy);
+			v1    = vmlal_n_u16(v1, vget_high_u16(vlo), (uint16_t) Cy);
+			v2    = vmlal_n_u16(v2, vget_low_u16(vhi), (uint16_t) Cy);
+			v3    = vmlal_n_u16(v3, vget_high_u16(vhi), (uint16_t) Cy);
+		}
+		sptr += sow;
+		vp    = vld1q_u8(sptr);
+		vlo   = vmovl_u8(vget_low_u8(vp));
+		vhi   = vmovl_u8(vget_high_u8(vp));
+		v0    = vmlal_n_u16(v0, vget_low_u16(vlo), (uint16_t) j);
+		v1    = vmlal_n_u16(v1, vget_high_u16(vlo), (uint16_t) j);
+		v2    = vmlal_n_u16(v2, vget_low_u16(vhi), (uint16_t) j);
+		v3    = vmlal_n_u16(v3, vget_high_u16(vhi), (uint16_t) j);
+
+		vst1q_s32(dst + i, vreinterpretq_s32_u32(v0));
+		vst1q_s32(dst + i + 4, vreinterpretq_s32_u32(v1));
+		vst1q_s32(dst + i + 8, vreinterpretq_s32_u32(v2));
+		vst1q_s32(dst + i + 12, vreinterpretq_s32_u32(v3));
+	}
+	return i;
+}
+
+/* acc[i] += row[i], c.f., qSmoothScaleRowsBox */
+static int
+    qt_qimageScaleBox_accum_row_u16_neon(unsigned short* restrict acc, const unsigned char* restrict row, int n)
+{
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		const uint8x16_t vp = vld1q_u8(row + i);
+		vst1q_u16(acc + i, vaddw_u8(vld1q_u16(acc + i), vget_low_u8(vp)));
+		vst1q_u16(acc + i + 8, vaddw_u8(vld1q_u16(acc + i + 8), vget_high_u8(vp)));
+	}
+	return i;
+}
+
 #endif
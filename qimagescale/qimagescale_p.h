@@ -53,18 +53,52 @@
 
 #include <stdbool.h>
 
-unsigned char*
-    qSmoothScaleImage(const unsigned char* restrict src, int sw, int sh, int sn, bool ignore_alpha, int dw, int dh);
-
-typedef struct
+// NOTE: This is our scale "plan": it only depends on the dimensions (and never on the actual source pixels),
+//       so it can be computed once, and then reused to scale any number of same-sized source buffers.
+typedef struct QImageScaleInfo
 {
 	int* restrict xpoints;
+	int* restrict yoffsets;    // Offset (in pixels) of the source row backing each destination row
+	// NOTE: The row pointers are only ever resolved against a specific source buffer, one pass at a time,
+	//       c.f., qSmoothScaleRowsPass
 	const unsigned int** restrict ypoints;
 	const unsigned char** restrict ypoints_y8;
 	const unsigned short** restrict ypoints_y8a;
 	int* restrict xapoints;
 	int* restrict yapoints;
 	int xup_yup;
+	// NOTE: For large reductions, we first box-filter the source down by an integer factor,
+	//       and then only run the AA scaler (i.e., box_isi) on that much smaller intermediate image.
+	struct QImageScaleInfo* box_isi;
+	int sw;
+	int sh;
+	int sn;
+	int dw;
+	int dh;
 } QImageScaleInfo;
 
+unsigned char*
+    qSmoothScaleImage(const unsigned char* restrict src, int sw, int sh, int sn, bool ignore_alpha, int dw, int dh);
+
+// NOTE: Allows scaling the same geometry over and over (e.g., the frames of a slideshow or an animation),
+//       without having to recompute the scale info, nor allocate a new destination buffer every time.
+//       dest must be large enough to hold dw * dh * sn bytes (c.f., qSmoothScaleImage for RGB input).
+//       Returns 0 on success, -1 on invalid input or if we ran out of memory.
+QImageScaleInfo* qSmoothScaleInfoCreate(int sw, int sh, int sn, int dw, int dh);
+void             qSmoothScaleInfoFree(QImageScaleInfo* isi);
+int              qSmoothScaleImageInto(const QImageScaleInfo* isi,
+				       const unsigned char* restrict src,
+				       bool                          ignore_alpha,
+				       unsigned char* restrict dest);
+
+// NOTE: Allows scaling the destination image in bands of rows, without ever having to hold all of it in memory.
+//       The same scale info can be reused for every band, and bands can be scaled concurrently (c.f., draw_image).
+//       Returns 0 on success, -1 if we ran out of memory (for large reductions, c.f., QImageScaleInfo's box_isi).
+int qSmoothScaleRows(const QImageScaleInfo* isi,
+		     const unsigned char* restrict src,
+		     bool                          ignore_alpha,
+		     int                           dy,
+		     int                           rows,
+		     unsigned char* restrict dest);
+
 #endif
@@ -39,8 +39,9 @@
 ****************************************************************************/
 
 #include "qimagescale_p.h"
+#include "qsimd_p.h"
 
-#if defined(__SSE4_1__)
+#ifdef QT_COMPILER_SUPPORTS_SSE4_1
 
 static inline __attribute__((always_inline)) __m128i Q_DECL_VECTORCALL
     qt_qimageScaleAARGBA_helper_sse4(const unsigned int* restrict pix,
@@ -64,7 +65,7 @@ static inline __attribute__((always_inline)) __m128i Q_DECL_VECTORCALL
 	return vx;
 }
 
-static inline void
+static void
     qt_qimageScaleAARGBA_up_x_down_y_sse4(QImageScaleInfo* isi,
 					  unsigned int* restrict dest,
 					  int dw,
@@ -112,7 +113,7 @@ static inline void
 	}
 }
 
-static inline void
+static void
     qt_qimageScaleAARGB_up_x_down_y_sse4(QImageScaleInfo* isi,
 					 unsigned int* restrict dest,
 					 int dw,
@@ -159,7 +160,7 @@ static inline void
 	}
 }
 
-static inline void
+static void
     qt_qimageScaleAARGBA_down_x_up_y_sse4(QImageScaleInfo* isi,
 					  unsigned int* restrict dest,
 					  int dw,
@@ -207,7 +208,7 @@ static inline void
 	}
 }
 
-static inline void
+static void
     qt_qimageScaleAARGB_down_x_up_y_sse4(QImageScaleInfo* isi,
 					 unsigned int* restrict dest,
 					 int dw,
@@ -254,7 +255,7 @@ static inline void
 	}
 }
 
-static inline void
+static void
     qt_qimageScaleAARGBA_down_xy_sse4(QImageScaleInfo* isi, unsigned int* restrict dest, int dw, int dh, int dow, int sow)
 {
 	const unsigned int** restrict ypoints = isi->ypoints;
@@ -299,7 +300,7 @@ static inline void
 	}
 }
 
-static inline void
+static void
     qt_qimageScaleAARGB_down_xy_sse4(QImageScaleInfo* isi, unsigned int* restrict dest, int dw, int dh, int dow, int sow)
 {
 	const unsigned int** restrict ypoints = isi->ypoints;
@@ -343,4 +344,131 @@ static inline void
 	}
 }
 
+// NOTE: The following kernels only implement the vertical passes of the grayscale (Y8/Y8A) scalers,
+//       on whole rows of bytes at once (so Y8A simply has twice as many of them).
+//       They return how many bytes they've processed, the caller takes care of the tail.
+
+/* (top * (256 - yap) + bot * yap) >> 8, with 0 < yap < 256 */
+static int
+    qt_qimageScaleAA_lerp_rows_u8_sse4(unsigned char* restrict dst,
+				       const unsigned char* restrict top,
+				       const unsigned char* restrict bot,
+				       int n,
+				       int yap)
+{
+	const __m128i vyap    = _mm_set1_epi16((short) yap);
+	const __m128i vinvyap = _mm_set1_epi16((short) (256 - yap));
+	const __m128i vzero   = _mm_setzero_si128();
+
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		const __m128i vt = _mm_loadu_si128((const __m128i*) (const void*) (top + i));
+		const __m128i vb = _mm_loadu_si128((const __m128i*) (const void*) (bot + i));
+
+		// NOTE: The sum fits in 16 bits (255 * 256 at most), so the low half of the products is all we need.
+		__m128i vlo = _mm_add_epi16(_mm_mullo_epi16(_mm_cvtepu8_epi16(vt), vinvyap),
+					    _mm_mullo_epi16(_mm_cvtepu8_epi16(vb), vyap));
+		__m128i vhi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(vt, vzero), vinvyap),
+					    _mm_mullo_epi16(_mm_unpackhi_epi8(vb, vzero), vyap));
+		vlo         = _mm_srli_epi16(vlo, 8);
+		vhi         = _mm_srli_epi16(vhi, 8);
+		_mm_storeu_si128((__m128i*) (void*) (dst + i), _mm_packus_epi16(vlo, vhi));
+	}
+	return i;
+}
+
+/* top * (256 - yap) + bot * yap, with 0 < yap < 256, i.e., the same thing as above, minus the final shift */
+static int
+    qt_qimageScaleAA_blend_rows_u16_sse4(unsigned short* restrict dst,
+					 const unsigned char* restrict top,
+					 const unsigned char* restrict bot,
+					 int n,
+					 int yap)
+{
+	const __m128i vyap    = _mm_set1_epi16((short) yap);
+	const __m128i vinvyap = _mm_set1_epi16((short) (256 - yap));
+	const __m128i vzero   = _mm_setzero_si128();
+
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		const __m128i vt = _mm_loadu_si128((const __m128i*) (const void*) (top + i));
+		const __m128i vb = _mm_loadu_si128((const __m128i*) (const void*) (bot + i));
+
+		const __m128i vlo = _mm_add_epi16(_mm_mullo_epi16(_mm_cvtepu8_epi16(vt), vinvyap),
+						  _mm_mullo_epi16(_mm_cvtepu8_epi16(vb), vyap));
+		const __m128i vhi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(vt, vzero), vinvyap),
+						  _mm_mullo_epi16(_mm_unpackhi_epi8(vb, vzero), vyap));
+		_mm_storeu_si128((__m128i*) (void*) (dst + i), vlo);
+		_mm_storeu_si128((__m128i*) (void*) (dst + i + 8), vhi);
+	}
+	return i;
+}
+
+/* Area sum of a column span of 8-bit rows, c.f., qt_qimageScaleAAY8_helper (w/ a step of sow) */
+static int
+    qt_qimageScaleAA_vsum_rows_u8_sse4(int* restrict dst,
+				       const unsigned char* restrict pix,
+				       int n,
+				       int sow,
+				       int yap,
+				       int Cy)
+{
+	// NOTE: Weights fit in a signed short, and we zero-extend the pixels to 32-bit,
+	//       so pmaddwd against (w, 0) pairs gives us an exact pix * w.
+	const __m128i vyap = _mm_set1_epi32(yap);
+	const __m128i vCy  = _mm_set1_epi32(Cy);
+
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		const unsigned char* restrict sptr = pix + i;
+		__m128i                       vp   = _mm_loadu_si128((const __m128i*) (const void*) sptr);
+		__m128i                       v0   = _mm_madd_epi16(_mm_cvtepu8_epi32(vp), vyap);
+		__m128i                       v1   = _mm_madd_epi16(_mm_cvtepu8_epi32(_mm_srli_si128(vp, 4)), vyap);
+		__m128i                       v2   = _mm_madd_epi16(_mm_cvtepu8_epi32(_mm_srli_si128(vp, 8)), vyap);
+		__m128i                       v3   = _mm_madd_epi16(_mm_cvtepu8_epi32(_mm_srli_si128(vp, 12)), vyap);
+
+		int j;
+		for (j = (1 << 14) - yap; j > Cy; j -= Cy) {
+			sptr += sow;
+			vp    = _mm_loadu_si128((const __m128i*) (const void*) sptr);
+			v0    = _mm_add_epi32(v0, _mm_madd_epi16(_mm_cvtepu8_epi32(vp), vCy));
+			v1    = _mm_add_epi32(v1, _mm_madd_epi16(_mm_cvtepu8_epi32(_mm_srli_si128(vp, 4)), vCy));
+			v2    = _mm_add_epi32(v2, _mm_madd_epi16(_mm_cvtepu8_epi32(_mm_srli_si128(vp, 8)), vCy));
+			v3    = _mm_add_epi32(v3, _mm_madd_epi16(_mm_cvtepu8_epi32(_mm_srli_si128(vp, 12)), vCy));
+		}
+		sptr            += sow;
+		vp               = _mm_loadu_si128((const __m128i*) (const void*) sptr);
+		const __m128i vj = _mm_set1_epi32(j);
+		v0               = _mm_add_epi32(v0, _mm_madd_epi16(_mm_cvtepu8_epi32(vp), vj));
+		v1               = _mm_add_epi32(v1, _mm_madd_epi16(_mm_cvtepu8_epi32(_mm_srli_si128(vp, 4)), vj));
+		v2               = _mm_add_epi32(v2, _mm_madd_epi16(_mm_cvtepu8_epi32(_mm_srli_si128(vp, 8)), vj));
+		v3               = _mm_add_epi32(v3, _mm_madd_epi16(_mm_cvtepu8_epi32(_mm_srli_si128(vp, 12)), vj));
+
+		_mm_storeu_si128((__m128i*) (void*) (dst + i), v0);
+		_mm_storeu_si128((__m128i*) (void*) (dst + i + 4), v1);
+		_mm_storeu_si128((__m128i*) (void*) (dst + i + 8), v2);
+		_mm_storeu_si128((__m128i*) (void*) (dst + i + 12), v3);
+	}
+	return i;
+}
+
+/* acc[i] += row[i], c.f., qSmoothScaleRowsBox */
+static int
+    qt_qimageScaleBox_accum_row_u16_sse4(unsigned short* restrict acc, const unsigned char* restrict row, int n)
+{
+	const __m128i vzero = _mm_setzero_si128();
+
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		const __m128i vp  = _mm_loadu_si128((const __m128i*) (const void*) (row + i));
+		__m128i       vlo = _mm_loadu_si128((const __m128i*) (const void*) (acc + i));
+		__m128i       vhi = _mm_loadu_si128((const __m128i*) (const void*) (acc + i + 8));
+		vlo               = _mm_add_epi16(vlo, _mm_cvtepu8_epi16(vp));
+		vhi               = _mm_add_epi16(vhi, _mm_unpackhi_epi8(vp, vzero));
+		_mm_storeu_si128((__m128i*) (void*) (acc + i), vlo);
+		_mm_storeu_si128((__m128i*) (void*) (acc + i + 8), vhi);
+	}
+	return i;
+}
+
 #endif
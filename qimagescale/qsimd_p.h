@@ -0,0 +1,199 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+** SPDX-License-Identifier: LGPL-3.0-only
+**
+** This file is part of the QtGui module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#ifndef QSIMD_P_H
+#define QSIMD_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+// NOTE: Loosely based on Qt's own qsimd_p.h, but limited to the couple of extensions we actually care about.
+//       QT_COMPILER_SUPPORTS_<ext> means that we build the SIMD codepaths for that extension,
+//       QT_COMPILER_USES_<ext> means that the compiler's baseline already guarantees it (i.e., no runtime check needed).
+//       Otherwise, the SIMD codepaths are built w/ a target pragma (c.f., QT_SIMD_TARGET_PUSH),
+//       and callers are expected to check qCpuHasFeature at runtime before using them.
+//       This means a single binary built for, e.g., a plain ARMv7 baseline can still make use of NEON where available.
+//       NOTE: Building SIMD code for a target the baseline doesn't support requires GCC >= 4.9 on x86,
+//             and GCC >= 8 on ARM (i.e., an arm_neon.h that can be included w/o -mfpu=neon).
+//             It also requires an ABI w/ access to the FPU on ARM (i.e., not -mfloat-abi=soft).
+//             Otherwise, we stick to what the baseline provides, like we used to.
+#ifndef FBINK_QIS_NO_SIMD
+#	if defined(__SSE4_1__)
+#		define QT_COMPILER_SUPPORTS_SSE4_1
+#		define QT_COMPILER_USES_SSE4_1
+#	elif (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__clang__) &&                   \
+	    ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#		define QT_COMPILER_SUPPORTS_SSE4_1
+#	endif
+#	if defined(__ARM_NEON__)
+#		define QT_COMPILER_SUPPORTS_NEON
+#		define QT_COMPILER_USES_NEON
+#	elif defined(__arm__) && defined(__ARM_ARCH) && (__ARM_ARCH >= 7) && defined(__ARM_ARCH_PROFILE) &&             \
+	    (__ARM_ARCH_PROFILE == 'A') && defined(__ARM_FP) && defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 8)
+#		define QT_COMPILER_SUPPORTS_NEON
+#	endif
+#endif
+
+#if defined(QT_COMPILER_SUPPORTS_SSE4_1) || defined(QT_COMPILER_SUPPORTS_NEON)
+#	define QT_COMPILER_SUPPORTS_SIMD
+#endif
+
+// Wrap the definitions of SIMD codepaths in these, so they get built for the right target, whatever the baseline.
+#if defined(QT_COMPILER_SUPPORTS_SSE4_1) && !defined(QT_COMPILER_USES_SSE4_1)
+#	define QT_SIMD_TARGET_PUSH _Pragma("GCC push_options") _Pragma("GCC target(\"sse4.1\")")
+#	define QT_SIMD_TARGET_POP  _Pragma("GCC pop_options")
+#elif defined(QT_COMPILER_SUPPORTS_NEON) && !defined(QT_COMPILER_USES_NEON)
+#	define QT_SIMD_TARGET_PUSH _Pragma("GCC push_options") _Pragma("GCC target(\"fpu=neon\")")
+#	define QT_SIMD_TARGET_POP  _Pragma("GCC pop_options")
+#else
+#	define QT_SIMD_TARGET_PUSH
+#	define QT_SIMD_TARGET_POP
+#endif
+
+#if defined(QT_COMPILER_SUPPORTS_SSE4_1) && !defined(QT_COMPILER_USES_SSE4_1)
+// NOTE: Since GCC 4.9, the intrinsics headers are usable regardless of the baseline.
+#	include <immintrin.h>
+#	include <cpuid.h>
+#elif defined(QT_COMPILER_SUPPORTS_NEON) && !defined(QT_COMPILER_USES_NEON)
+QT_SIMD_TARGET_PUSH
+#	include <arm_neon.h>
+QT_SIMD_TARGET_POP
+#	include <elf.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#	if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 16))
+#		include <sys/auxv.h>
+#	endif
+#	ifndef HWCAP_ARM_NEON
+#		define HWCAP_ARM_NEON (1U << 12U)
+#	endif
+#endif
+
+#define CpuFeatureSSE4_1 (1U << 0U)
+#define CpuFeatureNEON   (1U << 1U)
+// Set once we've actually looked, so that a CPU w/ none of the above doesn't trigger a new check every time
+#define QSimdInitialized (1U << 31U)
+
+#if defined(QT_COMPILER_USES_SSE4_1)
+#	define qCompilerCpuFeatures CpuFeatureSSE4_1
+#elif defined(QT_COMPILER_USES_NEON)
+#	define qCompilerCpuFeatures CpuFeatureNEON
+#else
+#	define qCompilerCpuFeatures 0U
+#endif
+
+#if defined(QT_COMPILER_SUPPORTS_SSE4_1) && !defined(QT_COMPILER_USES_SSE4_1)
+static inline unsigned int
+    qDetectCpuFeatures(void)
+{
+	unsigned int eax, ebx, ecx, edx;
+	if (__get_cpuid(1U, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSE4_1)) {
+		return CpuFeatureSSE4_1;
+	}
+	return 0U;
+}
+#elif defined(QT_COMPILER_SUPPORTS_NEON) && !defined(QT_COMPILER_USES_NEON)
+static inline unsigned int
+    qDetectCpuFeatures(void)
+{
+	unsigned long int hwcap = 0U;
+#	if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 16))
+	hwcap = getauxval(AT_HWCAP);
+#	else
+	// NOTE: No getauxval on older glibc versions, so, do it the hard way...
+	int fd = open("/proc/self/auxv", O_RDONLY | O_CLOEXEC);
+	if (fd != -1) {
+		Elf32_auxv_t auxv;
+		while (read(fd, &auxv, sizeof(auxv)) == (ssize_t) sizeof(auxv)) {
+			if (auxv.a_type == AT_HWCAP) {
+				hwcap = auxv.a_un.a_val;
+				break;
+			} else if (auxv.a_type == AT_NULL) {
+				break;
+			}
+		}
+		close(fd);
+	}
+#	endif
+	return (hwcap & HWCAP_ARM_NEON) ? CpuFeatureNEON : 0U;
+}
+#else
+static inline unsigned int
+    qDetectCpuFeatures(void)
+{
+	return 0U;
+}
+#endif
+
+// NOTE: Cached after the first check. The detection itself is idempotent, so racing on it is harmless,
+//       we just use relaxed atomics to keep things well-defined.
+static unsigned int qt_cpu_features = 0U;
+
+static inline unsigned int
+    qCpuFeatures(void)
+{
+	unsigned int features = __atomic_load_n(&qt_cpu_features, __ATOMIC_RELAXED);
+	if (__builtin_expect(features == 0U, 0)) {
+		features = qDetectCpuFeatures() | QSimdInitialized;
+		__atomic_store_n(&qt_cpu_features, features, __ATOMIC_RELAXED);
+	}
+	return features;
+}
+
+#define qCpuHasFeature(feature)                                                                                          \
+	((qCompilerCpuFeatures & CpuFeature##feature) || (qCpuFeatures() & CpuFeature##feature))
+
+// We only ever build a single SIMD flavor per architecture
+#if defined(QT_COMPILER_SUPPORTS_SSE4_1)
+#	define qCpuHasSimd() qCpuHasFeature(SSE4_1)
+#elif defined(QT_COMPILER_SUPPORTS_NEON)
+#	define qCpuHasSimd() qCpuHasFeature(NEON)
+#else
+#	define qCpuHasSimd() false
+#endif
+
+#endif
@@ -49,14 +49,14 @@ static int
     refresh_kobo_compat(int fbfd, const struct mxcfb_rect region, WFM_MODE_INDEX_T waveform_mode, bool is_flashing)
 {
 	// Increase the marker, because we're bypassing FBInk's refresh
-	++lastMarker;
+	++defaultCtx.lastMarker;
 
 	FBInkConfig cfg = { 0 };
 
 	cfg.wfm_mode    = waveform_mode;
 	cfg.is_flashing = is_flashing;
 
-	int ret = refresh_kobo(fbfd, region, &cfg);
+	int ret = refresh_kobo(&defaultCtx, fbfd, region, &cfg);
 	return ret;
 }
 
@@ -65,7 +65,7 @@ static int
     refresh_kobo_alt(int fbfd, const struct mxcfb_rect region, uint32_t waveform_mode, uint32_t update_mode)
 {
 	// Increase the marker, because we're bypassing FBInk's refresh
-	++lastMarker;
+	++defaultCtx.lastMarker;
 
 	// NOTE: Alternate update region dimensions must match screen update region dimensions.
 	//       (Yes, that's a straight quote from the driver :D).
@@ -73,8 +73,8 @@ static int
 	struct mxcfb_alt_buffer_data_ntx alt = {
 		.virt_addr         = NULL,
 		.phys_addr         = altAddr,
-		.width             = vInfo.xres_virtual,
-		.height            = vInfo.yres,
+		.width             = defaultCtx.vInfo.xres_virtual,
+		.height            = defaultCtx.vInfo.yres,
 		.alt_update_region = region,
 	};
 
@@ -82,7 +82,7 @@ static int
 		.update_region   = region,
 		.waveform_mode   = waveform_mode,
 		.update_mode     = update_mode,
-		.update_marker   = lastMarker,
+		.update_marker   = defaultCtx.lastMarker,
 		.temp            = TEMP_USE_AMBIENT,
 		.flags           = (waveform_mode == WAVEFORM_MODE_REAGLD) ? EPDC_FLAG_USE_AAD
 				   : (waveform_mode == WAVEFORM_MODE_A2)   ? EPDC_FLAG_FORCE_MONOCHROME
@@ -114,7 +114,7 @@ static int
 static void
     flip_draw_buffer(unsigned char* const buff_ptr)
 {
-	fbPtr = buff_ptr;
+	defaultCtx.fbPtr = buff_ptr;
 }
 
 int
@@ -141,8 +141,8 @@ int
 	}
 
 	// We're of course going to need to mmap the fb
-	if (!isFbMapped) {
-		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+	if (!defaultCtx.isFbMapped) {
+		if (memmap_fb(&defaultCtx, fbfd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
@@ -152,7 +152,7 @@ int
 	//       since it has to be *inside* the fb memory.
 	// NOTE: That does imply we need enough scratch space for a shadow buffer, which means 32bpp is out.
 	//       Since no-one in their right mind should be using RGB565, that leaves 8bpp ;).
-	if (vInfo.bits_per_pixel != 8U) {
+	if (defaultCtx.vInfo.bits_per_pixel != 8U) {
 		fprintf(stderr, "Not running @ 8bpp, not enough memory for an overlay buffer . . .\n");
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
@@ -163,63 +163,64 @@ int
 	// NOTE: We know that yoffset is always 0, which is why we never bothered with it for fbPtr.
 	//       So our buffer simply starts at yres_virt * line_length!
 	//       It also ought to be exactly halfway through smem_len ;).
-	altPtr  = fbPtr + (vInfo.yres_virtual * fInfo.line_length);
-	altAddr = (uint32_t) (fInfo.smem_start + (vInfo.yres_virtual * fInfo.line_length));
+	altPtr  = defaultCtx.fbPtr + (defaultCtx.vInfo.yres_virtual * defaultCtx.fInfo.line_length);
+	altAddr =
+	    (uint32_t) (defaultCtx.fInfo.smem_start + (defaultCtx.vInfo.yres_virtual * defaultCtx.fInfo.line_length));
 	// Print raw pointer values...
-	fprintf(stdout, "fbPtr: %p vs. altPtr: %p\n", fbPtr, altPtr);
+	fprintf(stdout, "fbPtr: %p vs. altPtr: %p\n", defaultCtx.fbPtr, altPtr);
 	fprintf(stdout,
 		"altAddr: %#x (Bounds: %#zx to %#zx)\n",
 		altAddr,
-		(size_t) fInfo.smem_start,
-		(size_t) (fInfo.smem_start + fInfo.smem_len));
+		(size_t) defaultCtx.fInfo.smem_start,
+		(size_t) (defaultCtx.fInfo.smem_start + defaultCtx.fInfo.smem_len));
 	// Remember which is which, so we can easily flip to a specific draw buffer
-	unsigned char* const front_buffer = fbPtr;
+	unsigned char* const front_buffer = defaultCtx.fbPtr;
 	unsigned char* const alt_buffer   = altPtr;
 
 	// We start with something simple:
 	// Paint the front buffer white
-	memset(fbPtr, eInkBGCMap[0], (size_t) (fInfo.line_length * vInfo.yres));
+	memset(defaultCtx.fbPtr, eInkBGCMap[0], (size_t) (defaultCtx.fInfo.line_length * defaultCtx.vInfo.yres));
 
 	// Paint the overlay buffer black
-	memset(altPtr, eInkFGCMap[0], (size_t) (fInfo.line_length * vInfo.yres));
+	memset(altPtr, eInkFGCMap[0], (size_t) (defaultCtx.fInfo.line_length * defaultCtx.vInfo.yres));
 
 	// We'll be sleeping between tests
 	const struct timespec zzz = { 1L, 500 * 1e+6 };
 
 	// Our shiny marker
-	lastMarker = 41U;
+	defaultCtx.lastMarker = 41U;
 
 	// Refresh w/ the front buffer
 	struct mxcfb_rect region = { 0U };
-	fullscreen_region(&region);
+	fullscreen_region(&defaultCtx, &region);
 	fprintf(stdout, "[01] White front buffer\n");
 	refresh_kobo_compat(fbfd, region, WFM_GC16, true);
-	fbink_wait_for_complete(fbfd, lastMarker);
+	fbink_wait_for_complete(fbfd, defaultCtx.lastMarker);
 	nanosleep(&zzz, NULL);
 
 	// Refresh w/ the overlay buffer
 	fprintf(stdout, "[02] Black overlay buffer\n");
-	refresh_kobo_alt(fbfd, region, get_wfm_mode(WFM_GC16), UPDATE_MODE_FULL);
-	fbink_wait_for_complete(fbfd, lastMarker);
+	refresh_kobo_alt(fbfd, region, get_wfm_mode(&defaultCtx, WFM_GC16), UPDATE_MODE_FULL);
+	fbink_wait_for_complete(fbfd, defaultCtx.lastMarker);
 	nanosleep(&zzz, NULL);
 
 	// Back to the front buffer
 	fprintf(stdout, "[03] White front buffer\n");
 	refresh_kobo_compat(fbfd, region, WFM_GC16, true);
-	fbink_wait_for_complete(fbfd, lastMarker);
+	fbink_wait_for_complete(fbfd, defaultCtx.lastMarker);
 	nanosleep(&zzz, NULL);
 
 	// Now paint the alt buffer dark gray
 	// NOTE: We could also tweak a fill_rect to the right ptr if we needed more control,
 	//       but this is good enough for a PoC ;).
-	memset(altPtr, eInkFGCMap[3], (size_t) (fInfo.line_length * vInfo.yres));
+	memset(altPtr, eInkFGCMap[3], (size_t) (defaultCtx.fInfo.line_length * defaultCtx.vInfo.yres));
 
 	// And only display the bottom half of it
-	region.top    = vInfo.yres / 2U;
-	region.height = vInfo.yres / 2U;
+	region.top    = defaultCtx.vInfo.yres / 2U;
+	region.height = defaultCtx.vInfo.yres / 2U;
 	fprintf(stdout, "[04] Bottom half gray overlay buffer\n");
-	refresh_kobo_alt(fbfd, region, get_wfm_mode(WFM_GC16), UPDATE_MODE_FULL);
-	fbink_wait_for_complete(fbfd, lastMarker);
+	refresh_kobo_alt(fbfd, region, get_wfm_mode(&defaultCtx, WFM_GC16), UPDATE_MODE_FULL);
+	fbink_wait_for_complete(fbfd, defaultCtx.lastMarker);
 	nanosleep(&zzz, NULL);
 
 	// Now, if we want to print a smaller region of the alt buffer, on top of the *full* front buffer,
@@ -228,11 +229,11 @@ int
 	fprintf(stdout, "[05] Bottom quarter gray overlay buffer (ioctl x 2)\n");
 	refresh_kobo_compat(fbfd, region, WFM_GC16, true);
 	// Then refresh a smaller bit of the alt buffer...
-	region.top    = vInfo.yres / 4U * 3U;
-	region.height = vInfo.yres / 4U;
-	refresh_kobo_alt(fbfd, region, get_wfm_mode(WFM_GC16), UPDATE_MODE_FULL);
+	region.top    = defaultCtx.vInfo.yres / 4U * 3U;
+	region.height = defaultCtx.vInfo.yres / 4U;
+	refresh_kobo_alt(fbfd, region, get_wfm_mode(&defaultCtx, WFM_GC16), UPDATE_MODE_FULL);
 	// And only *now*, we wait, to hopefully let the EPDC merge those two...
-	fbink_wait_for_complete(fbfd, lastMarker);
+	fbink_wait_for_complete(fbfd, defaultCtx.lastMarker);
 	nanosleep(&zzz, NULL);
 	// NOTE: In practice, getting the two to merge appears tricky, which makes the whole thing slightly less appealing...
 	//       No matter the wfm mode, and no matter which combination of FULL/PARTIAL between the two, they won't merge,
@@ -242,28 +243,28 @@ int
 	//       and copying it to the overlay buffer, and then updating from the overlay buffer.
 	//       Or vice-versa...
 	fprintf(stdout, "[06] Bottom quarter gray overlay buffer (memcpy + ioctl)\n");
-	region.top    = vInfo.yres / 2U;
-	region.height = vInfo.yres / 4U;
+	region.top    = defaultCtx.vInfo.yres / 2U;
+	region.height = defaultCtx.vInfo.yres / 4U;
 	// Copy the third quarter slice of the screen from the front to the overlay buffer
-	memcpy(altPtr + (region.top * fInfo.line_length),
-	       fbPtr + (region.top * fInfo.line_length),
-	       region.height * fInfo.line_length);
-	region.top    = vInfo.yres / 2U;
-	region.height = vInfo.yres / 2U;
+	memcpy(altPtr + (region.top * defaultCtx.fInfo.line_length),
+	       defaultCtx.fbPtr + (region.top * defaultCtx.fInfo.line_length),
+	       region.height * defaultCtx.fInfo.line_length);
+	region.top    = defaultCtx.vInfo.yres / 2U;
+	region.height = defaultCtx.vInfo.yres / 2U;
 	// Display the spliced bottom half of the screen from the overlay buffer
-	refresh_kobo_alt(fbfd, region, get_wfm_mode(WFM_GC16), UPDATE_MODE_FULL);
-	fbink_wait_for_complete(fbfd, lastMarker);
+	refresh_kobo_alt(fbfd, region, get_wfm_mode(&defaultCtx, WFM_GC16), UPDATE_MODE_FULL);
+	fbink_wait_for_complete(fbfd, defaultCtx.lastMarker);
 	nanosleep(&zzz, NULL);
 
 	// Run the double ioctl variant again, to double-check...
 	fprintf(stdout, "[07] Bottom quarter gray overlay buffer (ioctl x 2)\n");
 	refresh_kobo_compat(fbfd, region, WFM_GC16, true);
 	// Then refresh a smaller bit of the alt buffer...
-	region.top    = vInfo.yres / 4U * 3U;
-	region.height = vInfo.yres / 4U;
-	refresh_kobo_alt(fbfd, region, get_wfm_mode(WFM_GC16), UPDATE_MODE_FULL);
+	region.top    = defaultCtx.vInfo.yres / 4U * 3U;
+	region.height = defaultCtx.vInfo.yres / 4U;
+	refresh_kobo_alt(fbfd, region, get_wfm_mode(&defaultCtx, WFM_GC16), UPDATE_MODE_FULL);
 	// And only *now*, we wait, to hopefully let the EPDC merge those two...
-	fbink_wait_for_complete(fbfd, lastMarker);
+	fbink_wait_for_complete(fbfd, defaultCtx.lastMarker);
 	nanosleep(&zzz, NULL);
 
 	// NOTE: Another approach could be to copy the (full?) front buffer to the overlay buffer *before*
@@ -293,22 +294,22 @@ int
 	fbink_print_image(fbfd, "2.png", 0, 0, &fbink_cfg);
 
 	// Refresh w/ the front buffer
-	fullscreen_region(&region);
+	fullscreen_region(&defaultCtx, &region);
 	fprintf(stdout, "[10] Full front buffer\n");
 	refresh_kobo_compat(fbfd, region, WFM_GC16, true);
-	fbink_wait_for_complete(fbfd, lastMarker);
+	fbink_wait_for_complete(fbfd, defaultCtx.lastMarker);
 	nanosleep(&zzz, NULL);
 
 	// Refresh w/ the overlay buffer
 	fprintf(stdout, "[11] Full overlay buffer\n");
-	refresh_kobo_alt(fbfd, region, get_wfm_mode(WFM_GC16), UPDATE_MODE_FULL);
-	fbink_wait_for_complete(fbfd, lastMarker);
+	refresh_kobo_alt(fbfd, region, get_wfm_mode(&defaultCtx, WFM_GC16), UPDATE_MODE_FULL);
+	fbink_wait_for_complete(fbfd, defaultCtx.lastMarker);
 	nanosleep(&zzz, NULL);
 
 	// Back to the front buffer
 	fprintf(stdout, "[12] Full front buffer\n");
 	refresh_kobo_compat(fbfd, region, WFM_GC16, true);
-	fbink_wait_for_complete(fbfd, lastMarker);
+	fbink_wait_for_complete(fbfd, defaultCtx.lastMarker);
 	nanosleep(&zzz, NULL);
 
 	// Render "3.png" to the overlay buffer
@@ -317,50 +318,50 @@ int
 	fbink_print_image(fbfd, "3.png", 0, 0, &fbink_cfg);
 
 	// And only display the bottom half of it
-	region.top    = vInfo.yres / 2U;
-	region.height = vInfo.yres / 2U;
+	region.top    = defaultCtx.vInfo.yres / 2U;
+	region.height = defaultCtx.vInfo.yres / 2U;
 	fprintf(stdout, "[14] Bottom half overlay buffer\n");
-	refresh_kobo_alt(fbfd, region, get_wfm_mode(WFM_GC16), UPDATE_MODE_FULL);
-	fbink_wait_for_complete(fbfd, lastMarker);
+	refresh_kobo_alt(fbfd, region, get_wfm_mode(&defaultCtx, WFM_GC16), UPDATE_MODE_FULL);
+	fbink_wait_for_complete(fbfd, defaultCtx.lastMarker);
 	nanosleep(&zzz, NULL);
 
 	// Bottom quarter of the overlay buffer, on top of the full front buffer
 	fprintf(stdout, "[15] Bottom quarter overlay buffer (ioctl x 2)\n");
 	refresh_kobo_compat(fbfd, region, WFM_GC16, true);
 	// Then refresh a smaller bit of the alt buffer...
-	region.top    = vInfo.yres / 4U * 3U;
-	region.height = vInfo.yres / 4U;
-	refresh_kobo_alt(fbfd, region, get_wfm_mode(WFM_GC16), UPDATE_MODE_FULL);
+	region.top    = defaultCtx.vInfo.yres / 4U * 3U;
+	region.height = defaultCtx.vInfo.yres / 4U;
+	refresh_kobo_alt(fbfd, region, get_wfm_mode(&defaultCtx, WFM_GC16), UPDATE_MODE_FULL);
 	// And only *now*, we wait, to hopefully let the EPDC merge those two...
-	fbink_wait_for_complete(fbfd, lastMarker);
+	fbink_wait_for_complete(fbfd, defaultCtx.lastMarker);
 	nanosleep(&zzz, NULL);
 
 	// Same, but by splicing the fb buffers ourselves
 	fprintf(stdout, "[16] Bottom quarter overlay buffer (memcpy + ioctl)\n");
-	region.top    = vInfo.yres / 2U;
-	region.height = vInfo.yres / 4U;
+	region.top    = defaultCtx.vInfo.yres / 2U;
+	region.height = defaultCtx.vInfo.yres / 4U;
 	// Copy the third quarter slice of the screen from the front to the overlay buffer
 	// NOTE: Flip back to the front buffer first, otherwise fbPtr still == altPtr ;).
 	flip_draw_buffer(front_buffer);
-	memcpy(altPtr + (region.top * fInfo.line_length),
-	       fbPtr + (region.top * fInfo.line_length),
-	       region.height * fInfo.line_length);
-	region.top    = vInfo.yres / 2U;
-	region.height = vInfo.yres / 2U;
+	memcpy(altPtr + (region.top * defaultCtx.fInfo.line_length),
+	       defaultCtx.fbPtr + (region.top * defaultCtx.fInfo.line_length),
+	       region.height * defaultCtx.fInfo.line_length);
+	region.top    = defaultCtx.vInfo.yres / 2U;
+	region.height = defaultCtx.vInfo.yres / 2U;
 	// Display the spliced bottom half of the screen from the overlay buffer
-	refresh_kobo_alt(fbfd, region, get_wfm_mode(WFM_GC16), UPDATE_MODE_FULL);
-	fbink_wait_for_complete(fbfd, lastMarker);
+	refresh_kobo_alt(fbfd, region, get_wfm_mode(&defaultCtx, WFM_GC16), UPDATE_MODE_FULL);
+	fbink_wait_for_complete(fbfd, defaultCtx.lastMarker);
 	nanosleep(&zzz, NULL);
 
 	// Run the double ioctl variant again, to double-check...
 	fprintf(stdout, "[17] Bottom quarter overlay buffer (ioctl x 2)\n");
 	refresh_kobo_compat(fbfd, region, WFM_GC16, true);
 	// Then refresh a smaller bit of the alt buffer...
-	region.top    = vInfo.yres / 4U * 3U;
-	region.height = vInfo.yres / 4U;
-	refresh_kobo_alt(fbfd, region, get_wfm_mode(WFM_GC16), UPDATE_MODE_FULL);
+	region.top    = defaultCtx.vInfo.yres / 4U * 3U;
+	region.height = defaultCtx.vInfo.yres / 4U;
+	refresh_kobo_alt(fbfd, region, get_wfm_mode(&defaultCtx, WFM_GC16), UPDATE_MODE_FULL);
 	// And only *now*, we wait, to hopefully let the EPDC merge those two...
-	fbink_wait_for_complete(fbfd, lastMarker);
+	fbink_wait_for_complete(fbfd, defaultCtx.lastMarker);
 	nanosleep(&zzz, NULL);
 cleanup:
 	if (fbink_close(fbfd) == ERRCODE(EXIT_FAILURE)) {
@@ -48,27 +48,27 @@ static bool
     get_fbinfo(void)
 {
 	// Get variable fb info
-	if (ioctl(fbFd, FBIOGET_VSCREENINFO, &vInfo)) {
+	if (ioctl(fbFd, FBIOGET_VSCREENINFO, &defaultCtx.vInfo)) {
 		perror("ioctl GET_V");
 		return false;
 	}
 	LOG("Variable fb info: %ux%u (%ux%u), %ubpp @ rotation: %u (%s)",
-	    vInfo.xres,
-	    vInfo.yres,
-	    vInfo.xres_virtual,
-	    vInfo.yres_virtual,
-	    vInfo.bits_per_pixel,
-	    vInfo.rotate,
-	    fb_rotate_to_string(vInfo.rotate));
+	    defaultCtx.vInfo.xres,
+	    defaultCtx.vInfo.yres,
+	    defaultCtx.vInfo.xres_virtual,
+	    defaultCtx.vInfo.yres_virtual,
+	    defaultCtx.vInfo.bits_per_pixel,
+	    defaultCtx.vInfo.rotate,
+	    fb_rotate_to_string(defaultCtx.vInfo.rotate));
 	// Get fixed fb information
-	if (ioctl(fbFd, FBIOGET_FSCREENINFO, &fInfo)) {
+	if (ioctl(fbFd, FBIOGET_FSCREENINFO, &defaultCtx.fInfo)) {
 		perror("ioctl GET_F");
 		return false;
 	}
 	LOG("Fixed fb info: ID is \"%s\", length of fb mem: %u bytes & line length: %u bytes",
-	    fInfo.id,
-	    fInfo.smem_len,
-	    fInfo.line_length);
+	    defaultCtx.fInfo.id,
+	    defaultCtx.fInfo.smem_len,
+	    defaultCtx.fInfo.line_length);
 
 	return true;
 }
@@ -80,114 +80,117 @@ static bool
 {
 	// Set variable fb info
 	// Bitdepth
-	vInfo.bits_per_pixel = bpp;
-	LOG("Setting bitdepth to %ubpp", vInfo.bits_per_pixel);
+	defaultCtx.vInfo.bits_per_pixel = bpp;
+	LOG("Setting bitdepth to %ubpp", defaultCtx.vInfo.bits_per_pixel);
 	// Grayscale flag
 	if (bpp == 8U) {
 		// NOTE: 1 for Grayscale, 2 for Inverted Grayscale (like on einkfb).
 		//       We obviously don't want to inflict an inverted palette on ourselves ;).
 		//       c.f., GRAYSCALE_* defines @ mxcfb.h
-		vInfo.grayscale = (uint32_t) GRAYSCALE_8BIT;
-		LOG("Setting grayscale to %u", vInfo.grayscale);
+		defaultCtx.vInfo.grayscale = (uint32_t) GRAYSCALE_8BIT;
+		LOG("Setting grayscale to %u", defaultCtx.vInfo.grayscale);
 	} else {
 		// NOTE: And of course, 0 for color ;)
-		vInfo.grayscale = (uint32_t) 0U;
-		LOG("Setting grayscale to %u", vInfo.grayscale);
+		defaultCtx.vInfo.grayscale = (uint32_t) 0U;
+		LOG("Setting grayscale to %u", defaultCtx.vInfo.grayscale);
 	}
 
 	// NOTE: We have to counteract the rotation shenanigans the Kernel might be enforcing...
 	//       c.f., mxc_epdc_fb_check_var @ drivers/video/mxc/mxc_epdc_fb.c OR drivers/video/fbdev/mxc/mxc_epdc_v2_fb.c
 	//       The goal being to end up in the *same* effective rotation as before.
 	// First, remember the current rotation as the expected one...
-	uint32_t expected_rota = vInfo.rotate;
+	uint32_t expected_rota = defaultCtx.vInfo.rotate;
 	// Then, set the requested rotation, if there was one...
 	if (rota != -1) {
-		vInfo.rotate = (uint32_t) rota;
-		LOG("Setting rotate to %u (%s)", vInfo.rotate, fb_rotate_to_string(vInfo.rotate));
+		defaultCtx.vInfo.rotate = (uint32_t) rota;
+		LOG("Setting rotate to %u (%s)", defaultCtx.vInfo.rotate, fb_rotate_to_string(defaultCtx.vInfo.rotate));
 		// And flag it as the expected rota for the sanity checks
 		expected_rota = (uint32_t) rota;
 	}
-	if (deviceQuirks.ntxRotaQuirk == NTX_ROTA_ALL_INVERTED) {
+	if (defaultCtx.deviceQuirks.ntxRotaQuirk == NTX_ROTA_ALL_INVERTED) {
 		// NOTE: This should cover the H2O and the few other devices suffering from the same quirk...
-		vInfo.rotate ^= 2;
+		defaultCtx.vInfo.rotate ^= 2;
 		LOG("Setting rotate to %u (%s) to account for kernel rotation quirks",
-		    vInfo.rotate,
-		    fb_rotate_to_string(vInfo.rotate));
-	} else if (deviceQuirks.ntxRotaQuirk == NTX_ROTA_ODD_INVERTED) {
+		    defaultCtx.vInfo.rotate,
+		    fb_rotate_to_string(defaultCtx.vInfo.rotate));
+	} else if (defaultCtx.deviceQuirks.ntxRotaQuirk == NTX_ROTA_ODD_INVERTED) {
 		// NOTE: This is for the Forma, which only inverts CW & CCW (i.e., odd numbers)...
-		if ((vInfo.rotate & 0x01) == 1) {
-			vInfo.rotate ^= 2;
+		if ((defaultCtx.vInfo.rotate & 0x01) == 1) {
+			defaultCtx.vInfo.rotate ^= 2;
 			LOG("Setting rotate to %u (%s) to account for kernel rotation quirks",
-			    vInfo.rotate,
-			    fb_rotate_to_string(vInfo.rotate));
+			    defaultCtx.vInfo.rotate,
+			    fb_rotate_to_string(defaultCtx.vInfo.rotate));
 		}
 	}
 
-	if (ioctl(fbFd, FBIOPUT_VSCREENINFO, &vInfo)) {
+	if (ioctl(fbFd, FBIOPUT_VSCREENINFO, &defaultCtx.vInfo)) {
 		perror("ioctl PUT_V");
 		return false;
 	}
 
 	// NOTE: Double-check that we weren't bit by rotation quirks...
-	if (vInfo.rotate != expected_rota) {
+	if (defaultCtx.vInfo.rotate != expected_rota) {
 		LOG("\nCurrent rotation (%u) doesn't match the expected rotation (%u), attempting to fix it . . .",
-		    vInfo.rotate,
+		    defaultCtx.vInfo.rotate,
 		    expected_rota);
 
 		// Brute-force it until it matches...
-		for (uint32_t i = vInfo.rotate, j = FB_ROTATE_UR; j <= FB_ROTATE_CCW; i = (i + 1U) & 3U, j++) {
+		for (uint32_t i = defaultCtx.vInfo.rotate, j = FB_ROTATE_UR; j <= FB_ROTATE_CCW; i = (i + 1U) & 3U, j++) {
 			// If we finally got the right orientation, break the loop
-			if (vInfo.rotate == expected_rota) {
+			if (defaultCtx.vInfo.rotate == expected_rota) {
 				break;
 			}
 			// Do the i -> i + 1 -> i dance to be extra sure...
 			// (This is useful on devices where the kernel *always* switches to the invert orientation, c.f., rota.c)
-			vInfo.rotate = i;
-			if (ioctl(fbFd, FBIOPUT_VSCREENINFO, &vInfo)) {
+			defaultCtx.vInfo.rotate = i;
+			if (ioctl(fbFd, FBIOPUT_VSCREENINFO, &defaultCtx.vInfo)) {
 				perror("ioctl PUT_V");
 				return false;
 			}
-			LOG("Kernel rotation quirk recovery: %u -> %u", i, vInfo.rotate);
+			LOG("Kernel rotation quirk recovery: %u -> %u", i, defaultCtx.vInfo.rotate);
 
 			// Don't do anything extra if that was enough...
-			if (vInfo.rotate == expected_rota) {
+			if (defaultCtx.vInfo.rotate == expected_rota) {
 				continue;
 			}
 			// Now for i + 1 w/ wraparound, since the valid rotation range is [0..3] (FB_ROTATE_UR to FB_ROTATE_CCW).
 			// (i.e., a Portrait/Landscape swap to counteract potential side-effects of a kernel-side mandatory invert)
-			uint32_t n   = (i + 1U) & 3U;
-			vInfo.rotate = n;
-			if (ioctl(fbFd, FBIOPUT_VSCREENINFO, &vInfo)) {
+			uint32_t n              = (i + 1U) & 3U;
+			defaultCtx.vInfo.rotate = n;
+			if (ioctl(fbFd, FBIOPUT_VSCREENINFO, &defaultCtx.vInfo)) {
 				perror("ioctl PUT_V");
 				return false;
 			}
-			LOG("Kernel rotation quirk recovery (intermediary @ %u): %u -> %u", i, n, vInfo.rotate);
+			LOG("Kernel rotation quirk recovery (intermediary @ %u): %u -> %u",
+			    i,
+			    n,
+			    defaultCtx.vInfo.rotate);
 
 			// And back to i, if need be...
-			if (vInfo.rotate == expected_rota) {
+			if (defaultCtx.vInfo.rotate == expected_rota) {
 				continue;
 			}
-			vInfo.rotate = i;
-			if (ioctl(fbFd, FBIOPUT_VSCREENINFO, &vInfo)) {
+			defaultCtx.vInfo.rotate = i;
+			if (ioctl(fbFd, FBIOPUT_VSCREENINFO, &defaultCtx.vInfo)) {
 				perror("ioctl PUT_V");
 				return false;
 			}
-			LOG("Kernel rotation quirk recovery: %u -> %u", i, vInfo.rotate);
+			LOG("Kernel rotation quirk recovery: %u -> %u", i, defaultCtx.vInfo.rotate);
 		}
 	}
 
 	// Finally, warn if things *still* look FUBAR...
-	if (vInfo.rotate != expected_rota) {
+	if (defaultCtx.vInfo.rotate != expected_rota) {
 		LOG("\nCurrent rotation (%u) doesn't match the expected rotation (%u), here be dragons!",
-		    vInfo.rotate,
+		    defaultCtx.vInfo.rotate,
 		    expected_rota);
 	}
 
 	LOG("Bitdepth is now %ubpp (grayscale: %u) @ rotate: %u (%s)\n",
-	    vInfo.bits_per_pixel,
-	    vInfo.grayscale,
-	    vInfo.rotate,
-	    fb_rotate_to_string(vInfo.rotate));
+	    defaultCtx.vInfo.bits_per_pixel,
+	    defaultCtx.vInfo.grayscale,
+	    defaultCtx.vInfo.rotate,
+	    fb_rotate_to_string(defaultCtx.vInfo.rotate));
 
 	return true;
 }
@@ -274,13 +277,13 @@ static unsigned int
 static void
     spread_fire_fs(size_t offset)
 {
-	uint8_t pixel = *((uint8_t*) (fbPtr + offset));
+	uint8_t pixel = *((uint8_t*) (defaultCtx.fbPtr + offset));
 	if (pixel == fire_palette[0U]) {
-		*((uint8_t*) (fbPtr + offset - fInfo.line_length)) = fire_palette[0U];
+		*((uint8_t*) (defaultCtx.fbPtr + offset - defaultCtx.fInfo.line_length)) = fire_palette[0U];
 	} else {
 		const size_t random                             = (rand() * 3) & 3;
 		const size_t dst                                = offset - random + 1U;
-		*((uint8_t*) (fbPtr + dst - fInfo.line_length)) = (uint8_t) (pixel - (random & 1U));
+		*((uint8_t*) (defaultCtx.fbPtr + dst - defaultCtx.fInfo.line_length)) = (uint8_t) (pixel - (random & 1U));
 		// Huh, if we go the palette way here, the fire doesn't reach as high...
 		/*
 		const unsigned int pal_idx                      = find_palette_id(pixel);
@@ -292,13 +295,13 @@ static void
 static void
     do_fire_fs(void)
 {
-	const uint32_t vertViewport = (uint32_t) (viewVertOrigin - viewVertOffset);
+	const uint32_t vertViewport = (uint32_t) (defaultCtx.viewVertOrigin - defaultCtx.viewVertOffset);
 	// Burn baby, burn!
 	// NOTE: Switching the outer loop to the y one leads to different interactions w/ the PXP & the EPDC...
 	//       Also, slightly uglier flames ;p.
-	for (uint32_t x = 0U; x < fInfo.line_length; x++) {
-		for (uint32_t y = 1U + vertViewport; y < viewHeight + vertViewport; y++) {
-			spread_fire_fs(y * fInfo.line_length + x);
+	for (uint32_t x = 0U; x < defaultCtx.fInfo.line_length; x++) {
+		for (uint32_t y = 1U + vertViewport; y < defaultCtx.viewHeight + vertViewport; y++) {
+			spread_fire_fs(y * defaultCtx.fInfo.line_length + x);
 		}
 	}
 }
@@ -310,13 +313,17 @@ static void
 	setup_palette();
 
 	// Fill the whole screen w/ color 0
-	memset(fbPtr, fire_palette[0U], fInfo.smem_len);
+	memset(defaultCtx.fbPtr, fire_palette[0U], defaultCtx.fInfo.smem_len);
 
 	// Set the bottom line to the final color
 	const FBInkPixel px           = { .gray8 = fire_palette[sizeof(fire_palette) - 1U] };
-	const uint32_t   vertViewport = (uint32_t) (viewVertOrigin - viewVertOffset);
-	fill_rect_Gray8(
-	    0U, (unsigned short int) (viewHeight + vertViewport - 1U), (unsigned short int) fInfo.line_length, 1U, &px);
+	const uint32_t   vertViewport = (uint32_t) (defaultCtx.viewVertOrigin - defaultCtx.viewVertOffset);
+	fill_rect_Gray8(&defaultCtx,
+			0U,
+			(unsigned short int) (defaultCtx.viewHeight + vertViewport - 1U),
+			(unsigned short int) defaultCtx.fInfo.line_length,
+			1U,
+			&px);
 }
 
 // And now for a -- hopefully -- slightly less taxing version, in a smaller window...
@@ -332,17 +339,17 @@ static void
 	setup_palette();
 
 	// Compute window position (centered)
-	const uint32_t vertViewport = (uint32_t) (viewVertOrigin - viewVertOffset);
-	fire_y_origin               = (unsigned short int) (viewHeight / 2U - FIRE_HEIGHT / 2U + vertViewport);
-	fire_x_origin               = (unsigned short int) (viewWidth / 2U - FIRE_WIDTH / 2U);
+	const uint32_t vertViewport = (uint32_t) (defaultCtx.viewVertOrigin - defaultCtx.viewVertOffset);
+	fire_y_origin               = (unsigned short int) (defaultCtx.viewHeight / 2U - FIRE_HEIGHT / 2U + vertViewport);
+	fire_x_origin               = (unsigned short int) (defaultCtx.viewWidth / 2U - FIRE_WIDTH / 2U);
 
 	// Fill the window w/ color 0
 	const FBInkPixel bg = { .gray8 = fire_palette[0U] };
-	fill_rect_Gray8(fire_x_origin, fire_y_origin, FIRE_WIDTH, FIRE_HEIGHT, &bg);
+	fill_rect_Gray8(&defaultCtx, fire_x_origin, fire_y_origin, FIRE_WIDTH, FIRE_HEIGHT, &bg);
 
 	// Set the bottom line to the final color
 	const FBInkPixel fire = { .gray8 = fire_palette[sizeof(fire_palette) - 1U] };
-	fill_rect_Gray8(fire_x_origin,
+	fill_rect_Gray8(&defaultCtx, fire_x_origin,
 			(unsigned short int) (fire_y_origin + FIRE_HEIGHT - 1U),
 			(unsigned short int) FIRE_WIDTH,
 			1U,
@@ -352,19 +359,20 @@ static void
 static void
     spread_fire(size_t offset, uint32_t x, uint32_t y)
 {
-	uint8_t pixel = *((uint8_t*) (fbPtr + offset));
+	uint8_t pixel = *((uint8_t*) (defaultCtx.fbPtr + offset));
 	if (pixel == fire_palette[0U]) {
-		*((uint8_t*) (fbPtr + offset - fInfo.line_length)) = fire_palette[0U];
+		*((uint8_t*) (defaultCtx.fbPtr + offset - defaultCtx.fInfo.line_length)) = fire_palette[0U];
 	} else {
 		const size_t       random  = (rand() * 3) & 3;
 		// Make sure we stay within our window...
 		const size_t       shift   = ((y - fire_y_origin) * FIRE_WIDTH + (x - fire_x_origin)) - random + 1U;
 		const size_t       dst_y   = shift / FIRE_WIDTH + fire_y_origin;
 		const size_t       dst_x   = shift % FIRE_WIDTH + fire_x_origin;
-		const size_t       dst     = dst_y * fInfo.line_length + dst_x;
+		const size_t       dst     = dst_y * defaultCtx.fInfo.line_length + dst_x;
 		// We'll need the palette id of the current pixel so we can swap it to another *palette* color!
 		const unsigned int pal_idx = find_palette_id(pixel);
-		*((uint8_t*) (fbPtr + dst - fInfo.line_length)) = fire_palette[(pal_idx - (random & 1U))];
+		*((uint8_t*) (defaultCtx.fbPtr + dst - defaultCtx.fInfo.line_length)) =
+		    fire_palette[(pal_idx - (random & 1U))];
 	}
 }
 
@@ -376,7 +384,7 @@ static void
 	//       Also, slightly uglier flames ;p.
 	for (uint32_t x = fire_x_origin; x < FIRE_WIDTH + fire_x_origin; x++) {
 		for (uint32_t y = 1U + fire_y_origin; y < FIRE_HEIGHT + fire_y_origin; y++) {
-			spread_fire(y * fInfo.line_length + x, x, y);
+			spread_fire(y * defaultCtx.fInfo.line_length + x, x, y);
 		}
 	}
 }
@@ -397,20 +405,25 @@ static void
 	scaled_Height = scale * FIRE_HEIGHT;
 
 	// Compute window position (centered)
-	const uint32_t vertViewport = (uint32_t) (viewVertOrigin - viewVertOffset);
-	fire_y_origin               = (unsigned short int) (viewHeight / 2U - scaled_Height / 2U + vertViewport);
-	fire_x_origin               = (unsigned short int) (viewWidth / 2U - scaled_Width / 2U);
+	const uint32_t vertViewport = (uint32_t) (defaultCtx.viewVertOrigin - defaultCtx.viewVertOffset);
+	fire_y_origin               =
+	    (unsigned short int) (defaultCtx.viewHeight / 2U - scaled_Height / 2U + vertViewport);
+	fire_x_origin               = (unsigned short int) (defaultCtx.viewWidth / 2U - scaled_Width / 2U);
 
 	// Fill the window w/ color 0
 	const FBInkPixel bg = { .gray8 = fire_palette[0U] };
-	fill_rect_Gray8(
-	    fire_x_origin, fire_y_origin, (unsigned short int) scaled_Width, (unsigned short int) scaled_Height, &bg);
+	fill_rect_Gray8(&defaultCtx,
+			fire_x_origin,
+			fire_y_origin,
+			(unsigned short int) scaled_Width,
+			(unsigned short int) scaled_Height,
+			&bg);
 	// And the source canvas
 	memset(fire_canvas, fire_palette[0U], sizeof(fire_canvas));
 
 	// Set the bottom line to the final color
 	const FBInkPixel fire = { .gray8 = fire_palette[sizeof(fire_palette) - 1U] };
-	fill_rect_Gray8(fire_x_origin,
+	fill_rect_Gray8(&defaultCtx, fire_x_origin,
 			(unsigned short int) (fire_y_origin + scaled_Height - 1U),
 			(unsigned short int) scaled_Width,
 			scale,
@@ -428,7 +441,7 @@ static void
 		*((uint8_t*) (fire_canvas + offset - FIRE_WIDTH)) = fire_palette[0U];
 		// Update the fb
 		const FBInkPixel px                               = { .gray8 = fire_palette[0U] };
-		fill_rect_Gray8((unsigned short int) (fire_x_origin + (x * scale)),
+		fill_rect_Gray8(&defaultCtx, (unsigned short int) (fire_x_origin + (x * scale)),
 				(unsigned short int) (fire_y_origin + ((y * scale) - 1U)),
 				scale,
 				scale,
@@ -444,7 +457,8 @@ static void
 		const size_t     dst_y                         = dst / FIRE_WIDTH * scale + fire_y_origin;
 		const size_t     dst_x                         = dst % FIRE_WIDTH * scale + fire_x_origin;
 		const FBInkPixel px                            = { .gray8 = fire_palette[(pal_idx - (random & 1U))] };
-		fill_rect_Gray8((unsigned short int) dst_x, (unsigned short int) (dst_y - 1U), scale, scale, &px);
+		fill_rect_Gray8(
+		    &defaultCtx, (unsigned short int) dst_x, (unsigned short int) (dst_y - 1U), scale, scale, &px);
 	}
 }
 
@@ -473,7 +487,7 @@ static void
 		*((uint8_t*) (fire_canvas + offset)) = fire_palette[(pal_idx - random)];
 		// Update the fb
 		const FBInkPixel px                  = { .gray8 = fire_palette[(pal_idx - random)] };
-		fill_rect_Gray8((unsigned short int) (fire_x_origin + (x * scale)),
+		fill_rect_Gray8(&defaultCtx, (unsigned short int) (fire_x_origin + (x * scale)),
 				(unsigned short int) (fire_y_origin + (y * scale)),
 				scale,
 				scale,
@@ -512,10 +526,10 @@ static void
     spread_fire_32(size_t offset)
 {
 	FBInkPixel px;
-	px.p = *((uint32_t*) (fbPtr + offset));
+	px.p = *((uint32_t*) (defaultCtx.fbPtr + offset));
 	if (px.bgra.color.r == fire_colors[0U][0U] && px.bgra.color.g == fire_colors[0U][1U] &&
 	    px.bgra.color.b == fire_colors[0U][2U]) {
-		*((uint32_t*) (fbPtr + offset - fInfo.line_length)) = px.p;
+		*((uint32_t*) (defaultCtx.fbPtr + offset - defaultCtx.fInfo.line_length)) = px.p;
 	} else {
 		const size_t       random  = (rand() * 3) & 3;
 		const size_t       dst     = offset - random + 1U;
@@ -524,7 +538,7 @@ static void
 		px.bgra.color.r            = fire_colors[idx][0U];
 		px.bgra.color.g            = fire_colors[idx][1U];
 		px.bgra.color.b            = fire_colors[idx][2U];
-		*((uint32_t*) (fbPtr + dst - fInfo.line_length)) = px.p;
+		*((uint32_t*) (defaultCtx.fbPtr + dst - defaultCtx.fInfo.line_length)) = px.p;
 	}
 }
 
@@ -532,9 +546,9 @@ static void
     do_fire_32(void)
 {
 	// Burn baby, burn!
-	for (uint32_t x = 0U; x < viewWidth; x++) {
-		for (uint32_t y = 1U; y < viewHeight; y++) {
-			spread_fire_32((y * fInfo.line_length) + (x << 2U));
+	for (uint32_t x = 0U; x < defaultCtx.viewWidth; x++) {
+		for (uint32_t y = 1U; y < defaultCtx.viewHeight; y++) {
+			spread_fire_32((y * defaultCtx.fInfo.line_length) + (x << 2U));
 		}
 	}
 }
@@ -546,14 +560,24 @@ static void
 	const FBInkPixel bg = { .bgra.color.r = fire_colors[0U][0U],
 				.bgra.color.g = fire_colors[0U][1U],
 				.bgra.color.b = fire_colors[0U][2U] };
-	fill_rect_RGB32(0U, 0U, (unsigned short int) viewWidth, (unsigned short int) viewHeight, &bg);
+	fill_rect_RGB32(&defaultCtx,
+			0U,
+			0U,
+			(unsigned short int) defaultCtx.viewWidth,
+			(unsigned short int) defaultCtx.viewHeight,
+			&bg);
 
 	// Set the bottom line to the final color
 	const size_t     idx = sizeof(fire_colors) / sizeof(*fire_colors) - 1U;
 	const FBInkPixel px  = { .bgra.color.r = fire_colors[idx][0U],
 				 .bgra.color.g = fire_colors[idx][1U],
 				 .bgra.color.b = fire_colors[idx][2U] };
-	fill_rect_RGB32(0U, (unsigned short int) (viewHeight - 1U), (unsigned short int) viewWidth, 1U, &px);
+	fill_rect_RGB32(&defaultCtx,
+			0U,
+			(unsigned short int) (defaultCtx.viewHeight - 1U),
+			(unsigned short int) defaultCtx.viewWidth,
+			1U,
+			&px);
 }
 #endif    // !FBINK_FOR_LINUX
 
@@ -770,7 +794,7 @@ int
 
 #ifndef FBINK_FOR_LINUX
 	// NOTE: We're going to need to identify the device, to handle rotation quirks...
-	identify_device();
+	identify_device(&defaultCtx);
 #endif
 
 	// NOTE: We'll need to write to the fb, so do a full open
@@ -792,10 +816,10 @@ int
 		// NOTE: For *most* devices, Nickel's Portrait orientation should *always* match BootRota + 1
 		//       Thankfully, the Libra appears to be ushering in a new era filled with puppies and rainbows,
 		//       and, hopefully, less insane rotation quirks ;).
-		if (deviceQuirks.ntxRotaQuirk != NTX_ROTA_SANE) {
-			req_rota = (deviceQuirks.ntxBootRota + 1) & 3;
+		if (defaultCtx.deviceQuirks.ntxRotaQuirk != NTX_ROTA_SANE) {
+			req_rota = (defaultCtx.deviceQuirks.ntxBootRota + 1) & 3;
 		} else {
-			req_rota = (int8_t) deviceQuirks.ntxBootRota;
+			req_rota = (int8_t) defaultCtx.deviceQuirks.ntxBootRota;
 		}
 		LOG("Device's expected Portrait orientation should be: %hhd (%s)!",
 		    req_rota,
@@ -815,10 +839,10 @@ int
 
 	// If a change was requested, do it, but check if it's necessary first
 	bool is_change_needed = false;
-	if (vInfo.bits_per_pixel == req_bpp) {
+	if (defaultCtx.vInfo.bits_per_pixel == req_bpp) {
 		// Also check that the grayscale flag is flipped properly
-		if ((vInfo.bits_per_pixel == 8U && vInfo.grayscale != GRAYSCALE_8BIT) ||
-		    (vInfo.bits_per_pixel > 8U && vInfo.grayscale != 0U)) {
+		if ((defaultCtx.vInfo.bits_per_pixel == 8U && defaultCtx.vInfo.grayscale != GRAYSCALE_8BIT) ||
+		    (defaultCtx.vInfo.bits_per_pixel > 8U && defaultCtx.vInfo.grayscale != 0U)) {
 			LOG("\nCurrent bitdepth is already %ubpp, but the grayscale flag is bogus!", req_bpp);
 			// Continue, we'll need to flip the grayscale flag properly
 			is_change_needed = true;
@@ -832,7 +856,7 @@ int
 
 	// Same for rotation, if we requested one...
 	if (req_rota != -1) {
-		if (vInfo.rotate == (uint32_t) req_rota) {
+		if (defaultCtx.vInfo.rotate == (uint32_t) req_rota) {
 			LOG("\nCurrent rotation is already %hhd!", req_rota);
 			// No change needed as far as rotation is concerned...
 		} else {
@@ -845,12 +869,12 @@ int
 		if (req_rota != -1) {
 			LOG("\nSwitching fb to %ubpp%s @ rotation %hhd . . .",
 			    req_bpp,
-			    (req_bpp == vInfo.bits_per_pixel) ? " (current bitdepth)" : "",
+			    (req_bpp == defaultCtx.vInfo.bits_per_pixel) ? " (current bitdepth)" : "",
 			    req_rota);
 		} else {
 			LOG("\nSwitching fb to %ubpp%s . . .",
 			    req_bpp,
-			    (req_bpp == vInfo.bits_per_pixel) ? " (current bitdepth)" : "");
+			    (req_bpp == defaultCtx.vInfo.bits_per_pixel) ? " (current bitdepth)" : "");
 		}
 		if (!set_fbinfo(req_bpp, req_rota)) {
 			rv = ERRCODE(EXIT_FAILURE);
@@ -863,7 +887,7 @@ int
 		}
 	}
 #	else
-	if (vInfo.bits_per_pixel != req_bpp) {
+	if (defaultCtx.vInfo.bits_per_pixel != req_bpp) {
 		fprintf(stderr, "Requires a K4+!\n");
 		return ERRCODE(ENOSYS);
 	}
@@ -892,8 +916,8 @@ int
 		goto cleanup;
 	}
 	// We also need to mmap the fb
-	if (!isFbMapped) {
-		if (memmap_fb(fbFd) != EXIT_SUCCESS) {
+	if (!defaultCtx.isFbMapped) {
+		if (memmap_fb(&defaultCtx, fbFd) != EXIT_SUCCESS) {
 			rv = ERRCODE(EXIT_FAILURE);
 			goto cleanup;
 		}
@@ -939,7 +963,7 @@ int
 		}
 	} else if (scaling_factor > 1U) {
 		// Start by clamping the scaling factor to safe values...
-		scaling_factor = (uint8_t) MIN(scaling_factor, viewWidth / FIRE_HEIGHT);
+		scaling_factor = (uint8_t) MIN(scaling_factor, defaultCtx.viewWidth / FIRE_HEIGHT);
 
 		setup_fire_scaled(scaling_factor);
 
@@ -1017,7 +1041,7 @@ int
 		}
 	}
 #else
-	if (vInfo.bits_per_pixel != 32U) {
+	if (defaultCtx.vInfo.bits_per_pixel != 32U) {
 		fprintf(stderr, "Requires a 32bpp fb!\n");
 		return ERRCODE(ENOSYS);
 	}
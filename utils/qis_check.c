@@ -0,0 +1,206 @@
+/*
+	FBInk: FrameBuffer eInker, a library to print text & images to an eInk Linux framebuffer
+	Copyright (C) 2018-2024 NiLuJe <ninuje@gmail.com>
+	SPDX-License-Identifier: GPL-3.0-or-later
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// NOTE: Checks that the grayscale SIMD (SSE4.1/NEON) codepaths of QImageScale are bit-exact with the plain C ones.
+//       It scales a bunch of pseudo-random Y8 & Y8A images through every scaler
+//       (upscaling, downscaling & box-filtered large reductions), and prints a hash of each result.
+//       The RGB(A) SIMD codepaths come straight from Qt, and only match the C ones to within rounding,
+//       so they're skipped.
+//       The idea being to build it twice, once as-is, and once with -DFBINK_QIS_NO_SIMD (c.f., the qischeck target),
+//       and to compare the output of both builds, e.g., on the target device, for the NEON codepaths:
+//       ./qis_check_scalar | ./qis_check -
+
+// Because we're pretty much Linux-bound ;).
+#ifndef _GNU_SOURCE
+#	define _GNU_SOURCE
+#endif
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../qimagescale/qimagescale_p.h"
+#include "../qimagescale/qsimd_p.h"
+
+// Source & destination dimensions
+typedef struct
+{
+	int sw;
+	int sh;
+	int dw;
+	int dh;
+} QISCheckCase;
+
+static const QISCheckCase cases[] = {
+	// Upscaling
+	{ 17, 13, 61, 47 },
+	{ 1, 1, 5, 3 },
+	{ 64, 64, 64, 65 },
+	// Up in one direction, down in the other
+	{ 33, 97, 70, 29 },
+	{ 97, 33, 29, 70 },
+	{ 300, 1, 17, 4 },
+	// Downscaling
+	{ 211, 157, 67, 41 },
+	{ 128, 64, 48, 32 },
+	{ 5, 3, 1, 1 },
+	// Large reductions (i.e., box-filtered first)
+	{ 1203, 907, 37, 29 },
+	{ 640, 480, 13, 11 },
+	{ 999, 50, 31, 45 },
+	// Huge reductions (i.e., still large enough after a QIS_BOX_MAX_FACTOR box pass), in both directions, and in only one
+	{ 4000, 3000, 8, 6 },
+	{ 4000, 300, 10, 200 },
+};
+
+static uint32_t rng_state = 0x1337u;
+
+// Plain LCG, we just need something deterministic
+static uint8_t
+    rng(void)
+{
+	rng_state = rng_state * 1103515245u + 12345u;
+	return (uint8_t) (rng_state >> 16U);
+}
+
+// FNV-1a
+static uint64_t
+    hash_buffer(const unsigned char* data, size_t len)
+{
+	uint64_t h = 0xCBF29CE484222325u;
+	for (size_t i = 0U; i < len; i++) {
+		h ^= data[i];
+		h *= 0x100000001B3u;
+	}
+	return h;
+}
+
+int
+    main(int argc, char* argv[])
+{
+	FILE* ref = NULL;
+	if (argc > 1) {
+		if (strcmp(argv[1], "-") == 0) {
+			ref = stdin;
+		} else {
+			ref = fopen(argv[1], "re");
+			if (!ref) {
+				fprintf(stderr, "Failed to open reference file `%s`: %m\n", argv[1]);
+				return EXIT_FAILURE;
+			}
+		}
+	}
+
+#if defined(QT_COMPILER_SUPPORTS_SSE4_1)
+	fprintf(stderr, "SIMD codepaths: SSE4.1 (%s)\n", qCpuHasSimd() ? "enabled" : "unsupported by this CPU");
+#elif defined(QT_COMPILER_SUPPORTS_NEON)
+	fprintf(stderr, "SIMD codepaths: NEON (%s)\n", qCpuHasSimd() ? "enabled" : "unsupported by this CPU");
+#else
+	fprintf(stderr, "SIMD codepaths: none\n");
+#endif
+
+	int    rv         = EXIT_SUCCESS;
+	size_t mismatches = 0U;
+	static const struct
+	{
+		int  sn;
+		bool ignore_alpha;
+	} formats[] = {
+		{ 1, false },
+		{ 2, false },
+	};
+	for (size_t f = 0U; f < sizeof(formats) / sizeof(*formats); f++) {
+		for (size_t c = 0U; c < sizeof(cases) / sizeof(*cases); c++) {
+			const QISCheckCase* cc  = &cases[c];
+			const int           sn  = formats[f].sn;
+			const size_t        len = (size_t) cc->sw * (size_t) cc->sh * (size_t) sn;
+			unsigned char*      src = malloc(len);
+			if (!src) {
+				fprintf(stderr, "Out of memory!\n");
+				rv = EXIT_FAILURE;
+				goto cleanup;
+			}
+			for (size_t i = 0U; i < len; i++) {
+				src[i] = rng();
+			}
+
+			unsigned char* dst =
+			    qSmoothScaleImage(src, cc->sw, cc->sh, sn, formats[f].ignore_alpha, cc->dw, cc->dh);
+			free(src);
+			if (!dst) {
+				fprintf(stderr,
+					"Failed to scale a %dx%d image to %dx%d!\n",
+					cc->sw,
+					cc->sh,
+					cc->dw,
+					cc->dh);
+				rv = EXIT_FAILURE;
+				goto cleanup;
+			}
+			char line[128];
+			snprintf(line,
+				 sizeof(line),
+				 "sn=%d%s %dx%d -> %dx%d: %016" PRIx64 "\n",
+				 sn,
+				 formats[f].ignore_alpha ? " (ignore alpha)" : "",
+				 cc->sw,
+				 cc->sh,
+				 cc->dw,
+				 cc->dh,
+				 hash_buffer(dst, (size_t) cc->dw * (size_t) cc->dh * (size_t) sn));
+			free(dst);
+
+			if (ref) {
+				char ref_line[128];
+				if (!fgets(ref_line, sizeof(ref_line), ref)) {
+					fprintf(stderr, "Reference output is too short!\n");
+					rv = EXIT_FAILURE;
+					goto cleanup;
+				}
+				if (strcmp(line, ref_line) != 0) {
+					printf("MISMATCH: expected %s          got      %s", ref_line, line);
+					mismatches++;
+				}
+			} else {
+				fputs(line, stdout);
+			}
+		}
+	}
+
+	if (ref) {
+		if (mismatches > 0U) {
+			printf("%zu mismatches!\n", mismatches);
+			rv = EXIT_FAILURE;
+		} else {
+			printf("All good!\n");
+		}
+	}
+
+cleanup:
+	if (ref && ref != stdin) {
+		fclose(ref);
+	}
+
+	return rv;
+}
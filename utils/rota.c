@@ -37,37 +37,37 @@ static void
     get_fbinfo(void)
 {
 	// Get variable fb info
-	if (ioctl(fbFd, FBIOGET_VSCREENINFO, &vInfo)) {
+	if (ioctl(fbFd, FBIOGET_VSCREENINFO, &defaultCtx.vInfo)) {
 		perror("ioctl GET_V");
 	}
 	LOG("Variable fb info: %ux%u, %ubpp @ rotation: %u (%s)",
-	    vInfo.xres,
-	    vInfo.yres,
-	    vInfo.bits_per_pixel,
-	    vInfo.rotate,
-	    fb_rotate_to_string(vInfo.rotate));
+	    defaultCtx.vInfo.xres,
+	    defaultCtx.vInfo.yres,
+	    defaultCtx.vInfo.bits_per_pixel,
+	    defaultCtx.vInfo.rotate,
+	    fb_rotate_to_string(defaultCtx.vInfo.rotate));
 	// Get fixed fb information
-	if (ioctl(fbFd, FBIOGET_FSCREENINFO, &fInfo)) {
+	if (ioctl(fbFd, FBIOGET_FSCREENINFO, &defaultCtx.fInfo)) {
 		perror("ioctl GET_F");
 	}
 	LOG("Fixed fb info: ID is \"%s\", length of fb mem: %u bytes & line length: %u bytes",
-	    fInfo.id,
-	    fInfo.smem_len,
-	    fInfo.line_length);
+	    defaultCtx.fInfo.id,
+	    defaultCtx.fInfo.smem_len,
+	    defaultCtx.fInfo.line_length);
 }
 
 static void
     set_fbinfo(int rota)
 {
 	// Set variable fb info
-	vInfo.rotate = (uint32_t) rota;
-	LOG("Setting rotate to %u (%s)", vInfo.rotate, fb_rotate_to_string(vInfo.rotate));
+	defaultCtx.vInfo.rotate = (uint32_t) rota;
+	LOG("Setting rotate to %u (%s)", defaultCtx.vInfo.rotate, fb_rotate_to_string(defaultCtx.vInfo.rotate));
 
-	if (ioctl(fbFd, FBIOPUT_VSCREENINFO, &vInfo)) {
+	if (ioctl(fbFd, FBIOPUT_VSCREENINFO, &defaultCtx.vInfo)) {
 		perror("ioctl PUT_V");
 	}
 
-	LOG("Rotate is now %u (%s)", vInfo.rotate, fb_rotate_to_string(vInfo.rotate));
+	LOG("Rotate is now %u (%s)", defaultCtx.vInfo.rotate, fb_rotate_to_string(defaultCtx.vInfo.rotate));
 }
 
 static void
@@ -124,7 +124,7 @@ int
 		//       sending an ioctl with the current rotate value doesn't actually change the rotate value at all,
 		//       unless *other* variables than the rotation are changing, too...
 		//       Echoing it to /sys/class/graphics/fb0/rotate *will* work, no matter what, though...
-		if (vInfo.rotate == (uint32_t) i) {
+		if (defaultCtx.vInfo.rotate == (uint32_t) i) {
 			LOG("Intermerdiary rotation...");
 			do_eet((i + 1) % 4);
 			LOG("Requested rotation");
@@ -136,7 +136,7 @@ int
 	LOG("\nFB_ROTATE_CW to FB_ROTATE_CCW, +2 increments, intermerdiary rota if ==");
 	for (int i = FB_ROTATE_CW; i <= FB_ROTATE_CCW; i += 2) {
 		// If current rotate = to be set value, set += 1 (wrapping at 4) first to swap portrait/landscape
-		if (vInfo.rotate == (uint32_t) i) {
+		if (defaultCtx.vInfo.rotate == (uint32_t) i) {
 			LOG("Intermerdiary rotation...");
 			do_eet((i + 1) % 4);
 			LOG("Requested rotation");